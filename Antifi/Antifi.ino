@@ -2,6 +2,14 @@
 #include "inject.h"
 
 #include "scan.h"
+#include "scan_query.h"
+#include "scan_store.h"
+#include "scan_journal.h"
+#include "device_count.h"
+#include "top_talkers.h"
+#include "wids_monitor.h"
+#include "flow.h"
+#include "seq_gap.h"
 #include "beacon.h"
 #include "deauth.h"
 #include "captive_portal.h"
@@ -11,6 +19,11 @@
 void stop_wifi() {
   esp_wifi_set_promiscuous(false);
   esp_wifi_stop();
+  topTalkersStop();
+  widsMonitorStop();
+  flowStop();
+  seqGapStop();
+  rxBusReset();
 }
 
 static uint8_t hexCharToNibble(char c) {
@@ -372,6 +385,26 @@ void processCommand(String cmd) {
     Serial.println(version);
   }
   // ====== SNIFF ======
+  else if (cmd.startsWith("sniff -b ")) {
+    String arg = cmd.substring(9);
+    arg.trim();
+    unsigned int b[6];
+    uint8_t bssid[6];
+    if (sscanf(arg.c_str(), "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) {
+      Serial.println(F("Usage: sniff -b <bssid> (aa:bb:cc:dd:ee:ff)"));
+      return;
+    }
+    for (int i = 0; i < 6; i++) bssid[i] = b[i];
+
+    Serial.println("Following " + arg + ": searching for its beacons");
+    delay(1000);
+
+    if (!sniffer.startFollow(bssid)) {
+      Serial.println("ERROR: sniffer could not join the RX bus (full, or already capturing)");
+    }
+
+    showPrompt = false;
+  }
   else if (cmd.startsWith("sniff")) {
     int cpos = cmd.indexOf("-c");
     if (cpos < 0) {
@@ -385,11 +418,15 @@ void processCommand(String cmd) {
     Serial.println("Sniffing started");
     delay(1000);
 
+    bool started;
     if (arg.equalsIgnoreCase("all")) {
-      sniffer.start(0);
+      started = sniffer.start(0);
     } else {
       int ch = arg.toInt();
-      sniffer.start((uint8_t)ch);
+      started = sniffer.start((uint8_t)ch);
+    }
+    if (!started) {
+      Serial.println("ERROR: sniffer could not join the RX bus (full, or another capture pinned a different channel)");
     }
 
     showPrompt = false;
@@ -406,6 +443,236 @@ void processCommand(String cmd) {
       showPrompt = false;
     }
   }
+  else if (lowerCmd.startsWith("scan -k ")) {
+    int k = lowerCmd.substring(8).toInt();
+    if (k < 1) {
+      Serial.println(F("Usage: scan -k <n>"));
+    } else {
+      setDisplayTopK(k);
+      Serial.printf("Display top-K: %d APs / %d clients\n", scan.ap_top_k, scan.client_top_k);
+    }
+  }
+  else if (lowerCmd.startsWith("scan -o ")) {
+    String key = lowerCmd.substring(8);
+    key.trim();
+    if (key == "rssi") {
+      setDisplaySortKey(RANK_BY_RSSI);
+      Serial.println(F("Display order: RSSI"));
+    } else if (key == "seen") {
+      setDisplaySortKey(RANK_BY_LAST_SEEN);
+      Serial.println(F("Display order: last seen"));
+    } else {
+      Serial.println(F("Usage: scan -o <rssi || seen>"));
+    }
+  }
+  else if (lowerCmd.startsWith("scan -f ")) {
+    String format = lowerCmd.substring(8);
+    format.trim();
+    if (format == "table") {
+      setScanOutputFormat(SCAN_OUTPUT_TABLE);
+      Serial.println(F("Scan output: tables"));
+    } else if (format == "events") {
+      setScanOutputFormat(SCAN_OUTPUT_EVENTS);
+    } else {
+      Serial.println(F("Usage: scan -f <table || events>"));
+    }
+  }
+  else if (lowerCmd.startsWith("scan -dwell ")) {
+    String mode = lowerCmd.substring(12);
+    mode.trim();
+    if (mode == "adaptive") {
+      setDwellMode(DWELL_ADAPTIVE);
+      Serial.println(F("Channel dwell: adaptive"));
+    } else if (mode == "fixed") {
+      setDwellMode(DWELL_FIXED);
+      Serial.printf("Channel dwell: fixed, %lu ms per channel\n", scan.channel_hop_interval);
+    } else {
+      Serial.println(F("Usage: scan -dwell <adaptive || fixed>"));
+    }
+  }
+  else if (lowerCmd.startsWith("scan -fast ")) {
+    String mode = lowerCmd.substring(11);
+    mode.trim();
+    if (mode == "on" || mode == "off") {
+      setFastStart(mode == "on");
+      Serial.printf("Fast start: %s\n", mode.c_str());
+    } else {
+      Serial.println(F("Usage: scan -fast <on || off>"));
+    }
+  }
+  else if (lowerCmd.startsWith("scan -ewma ")) {
+    int shift = lowerCmd.substring(11).toInt();
+    if (shift < 1 || shift > RSSI_EWMA_SHIFT_MAX) {
+      Serial.println(F("Usage: scan -ewma <1-6>"));
+    } else {
+      setRssiSmoothing(shift);
+      Serial.printf("RSSI smoothing: alpha = 1/%d\n", 1 << shift);
+    }
+  }
+  else if (lowerCmd.startsWith("scan rssi ")) {
+    String mac = lowerCmd.substring(10);
+    mac.trim();
+    displayRssiStats(mac);
+  }
+  else if (lowerCmd == "scan channels") {
+    chanSchedReport(millis(), scan.dwell_mode);
+  }
+  else if (lowerCmd == "scan snapshot") {
+    emitScanSnapshot();
+  }
+  else if (lowerCmd.startsWith("scan query")) {
+    String args = lowerCmd.substring(10);
+    args.trim();
+    runScanQuery(args);
+  }
+  else if (lowerCmd == "scan heap") {
+    displayScanHeapReport();
+  }
+  else if (lowerCmd == "scan save") {
+    if (scanStoreSaveNow()) Serial.println("Snapshot saved to " SCAN_STORE_PATH);
+    else Serial.println("ERROR: snapshot save failed (SD card?)");
+  }
+  else if (lowerCmd == "scan load") {
+    if (scan.active_ap || scan.active_sta) {
+      Serial.println(F("Stop the scan first"));
+    } else {
+      scanStoreWarmStart();
+    }
+  }
+  else if (lowerCmd.startsWith("scan -autosave ")) {
+    String arg = lowerCmd.substring(15);
+    arg.trim();
+    long sec = arg.toInt();
+    if (arg == "off") {
+      scanStoreSetAutosave(0);
+      Serial.println("Autosave: off");
+    } else if (sec > 0) {
+      scanStoreSetAutosave(sec * 1000UL);
+      Serial.printf("Autosave: every %ld s when tables change\n", sec);
+    } else {
+      Serial.println(F("Usage: scan -autosave <sec || off>"));
+    }
+  }
+  else if (lowerCmd == "scan store") {
+    scanStoreReport();
+  }
+  else if (lowerCmd == "scan devices") {
+    deviceCountReport();
+  }
+  else if (lowerCmd == "scan journal") {
+    scanJournalReport();
+  }
+  else if (lowerCmd == "scan journal on") {
+    if (scanJournalEnable(true)) Serial.println("Journaling scan events to " SCAN_JOURNAL_PATH);
+    else Serial.println("ERROR: cannot open the journal (SD card?)");
+  }
+  else if (lowerCmd == "scan journal off") {
+    scanJournalEnable(false);
+    Serial.println("Journal committed and closed");
+  }
+  else if (lowerCmd == "rx stats") {
+    rxBusReport();
+  }
+  else if (lowerCmd == "stats top on") {
+    if (topTalkersStart()) Serial.println("Top talkers: counting on the current channel(s)");
+    else Serial.println("ERROR: RX bus is full");
+  }
+  else if (lowerCmd == "stats top off") {
+    topTalkersStop();
+    Serial.println("Top talkers: stopped (counts kept)");
+  }
+  else if (lowerCmd == "stats top reset") {
+    topTalkersReset();
+    Serial.println("Top talkers: counts cleared");
+  }
+  else if (lowerCmd == "stats seq on") {
+    if (seqGapStart()) Serial.println("Sequence gaps: tracking capture completeness");
+    else Serial.println("ERROR: RX bus is full");
+  }
+  else if (lowerCmd == "stats seq off") {
+    seqGapStop();
+    Serial.println("Sequence gaps: stopped (counts kept)");
+  }
+  else if (lowerCmd == "stats seq reset") {
+    seqGapReset();
+    Serial.println("Sequence gaps: counts cleared");
+  }
+  else if (lowerCmd == "stats seq") {
+    seqGapReport();
+  }
+  else if (lowerCmd == "wids on") {
+    if (widsMonitorStart()) Serial.println("WIDS: monitoring; alerts print as JSON lines");
+    else Serial.println("ERROR: RX bus is full");
+  }
+  else if (lowerCmd == "wids off") {
+    widsMonitorStop();
+    Serial.println("WIDS: stopped");
+  }
+  else if (lowerCmd == "wids") {
+    widsMonitorReport();
+  }
+  else if (lowerCmd.startsWith("wids -t ")) {
+    String args = lowerCmd.substring(8);
+    args.trim();
+    int space = args.indexOf(' ');
+    String name = space > 0 ? args.substring(0, space) : args;
+    String value = space > 0 ? args.substring(space + 1) : "";
+    value.trim();
+    if (!value.length() || !widsMonitorSetThreshold(name, value.toInt())) {
+      Serial.println(F("Usage: wids -t <deauth || beacons || ssid> <n> (0 = off)"));
+    } else {
+      Serial.printf("WIDS: %s threshold %ld\n", name.c_str(), value.toInt());
+    }
+  }
+  else if (lowerCmd == "flow -s serial" || lowerCmd == "flow -s sd") {
+    FlowSink sink = lowerCmd.endsWith("sd") ? FLOW_SINK_SD : FLOW_SINK_SERIAL;
+    if (flowActive()) Serial.println("Flow: already running (flow stop first)");
+    else if (flowStart(sink)) Serial.printf("Flow: exporting to %s\n", sink == FLOW_SINK_SD ? FLOW_PATH : "serial");
+    else if (sink == FLOW_SINK_SD) Serial.println("ERROR: cannot open " FLOW_PATH " (SD card?)");
+    else Serial.println("ERROR: out of memory or RX bus full");
+  }
+  else if (lowerCmd == "flow stop") {
+    flowStop();
+    Serial.println("Flow: stopped, open flows exported");
+  }
+  else if (lowerCmd == "flow") {
+    flowReport();
+  }
+  else if (lowerCmd.startsWith("flow -t ")) {
+    String args = lowerCmd.substring(8);
+    args.trim();
+    int space = args.indexOf(' ');
+    long idle = space > 0 ? args.substring(0, space).toInt() : 0;
+    long active = space > 0 ? args.substring(space + 1).toInt() : 0;
+    if (idle < 1 || active < idle || active > 86400) {
+      Serial.println(F("Usage: flow -t <idle s> <active s> (1 <= idle <= active)"));
+    } else {
+      flowSetTimeouts(idle * 1000UL, active * 1000UL);
+      Serial.printf("Flow: idle %ld s, active %ld s\n", idle, active);
+    }
+  }
+  else if (lowerCmd == "stats top" || lowerCmd.startsWith("stats top ")) {
+    String arg = lowerCmd.substring(9);
+    arg.trim();
+    long ch = arg.toInt();
+    if (arg.length() && (ch < 1 || ch > 14)) {
+      Serial.println(F("Usage: stats top [on || off || reset || <channel 1-14>]"));
+    } else {
+      topTalkersReport(ch);
+    }
+  }
+  else if (lowerCmd.startsWith("scan -ttl ")) {
+    String args = lowerCmd.substring(10);
+    args.trim();
+    int space = args.indexOf(' ');
+    String type = space > 0 ? args.substring(0, space) : args;
+    long seconds = space > 0 ? args.substring(space + 1).toInt() : 0;
+    if (seconds < 1 || !setRecordTTL(type, seconds * 1000UL)) {
+      Serial.println(F("Usage: scan -ttl <ap || client || assoc || ssid || probe> <seconds>"));
+    } else {
+      Serial.printf("%s TTL: %ld s\n", type.c_str(), seconds);
+    }
+  }
   // ====== DEAUTH ======
   else if (lowerCmd.startsWith("deauth")) {
     handleDeauthCommand(lowerCmd);
@@ -1701,6 +1968,12 @@ void setup() {
   // Initialize sniffer with default hopping parameters
   sniffer.begin(SNIFF_START_CHANNEL, SNIFF_END_CHANNEL, SNIFF_HOP_INTERVAL_MS);
 
+  // Restore the last scan tables so the first scan displays immediately
+  scanBegin();
+  scanStoreWarmStart();
+  // Cut a journal tail torn by a crash before anything appends to it
+  scanJournalRecover();
+
   inputBuffer.reserve(64);
 
   stop_wifi();
@@ -1718,4 +1991,6 @@ void loop() {
   beacon_loop();
   deauth_loop();
   scan_loop();
+  widsMonitorLoop();
+  flowLoop(millis());
 }
\ No newline at end of file
@@ -0,0 +1,342 @@
+#include "assoc_graph.h"
+#include "timer_wheel.h"
+
+// ===== Graph State =====
+static AssocNode nodes[ASSOC_MAX_NODES];
+static AssocEdge edges[ASSOC_MAX_EDGES];
+static assoc_id_t node_buckets[ASSOC_NODE_BUCKETS];
+static assoc_id_t edge_buckets[ASSOC_EDGE_BUCKETS];
+static assoc_id_t free_nodes = ASSOC_NONE;  // Linked through AssocNode::edges
+static assoc_id_t free_edges = ASSOC_NONE;  // Linked through AssocEdge::lru_next
+static assoc_id_t lru_head = ASSOC_NONE;
+static assoc_id_t lru_tail = ASSOC_NONE;
+static int node_count = 0;
+static int edge_count = 0;
+
+// ===== Hashing =====
+static inline uint32_t mix(uint32_t hash, uint8_t byte) {
+  return (hash ^ byte) * 16777619u;
+}
+
+static uint16_t nodeHome(const uint8_t* mac, uint8_t kind) {
+  uint32_t hash = mix(2166136261u, kind);
+  for (int i = 0; i < 6; i++) hash = mix(hash, mac[i]);
+  return hash & (ASSOC_NODE_BUCKETS - 1);
+}
+
+static uint16_t edgeHome(assoc_id_t ap, assoc_id_t sta) {
+  uint32_t key = ((uint32_t)ap << 16) | sta;
+  key *= 2654435761u;
+  return (key >> 16) & (ASSOC_EDGE_BUCKETS - 1);
+}
+
+// Backward-shift deletion for both indexes; home() gives an entry's home bucket
+template <int BUCKETS, typename HomeFn>
+static void bucketRemove(assoc_id_t* buckets, uint16_t hole, HomeFn home) {
+  buckets[hole] = ASSOC_NONE;
+  uint16_t b = (hole + 1) & (BUCKETS - 1);
+  while (buckets[b] != ASSOC_NONE) {
+    uint16_t h = home(buckets[b]);
+    bool movable = (hole <= b) ? (h <= hole || h > b) : (h <= hole && h > b);
+    if (movable) {
+      buckets[hole] = buckets[b];
+      buckets[b] = ASSOC_NONE;
+      hole = b;
+    }
+    b = (b + 1) & (BUCKETS - 1);
+  }
+}
+
+// ===== Nodes =====
+static int nodeBucket(const uint8_t* mac, uint8_t kind) {
+  uint16_t b = nodeHome(mac, kind);
+  for (int probes = 0; probes < ASSOC_NODE_BUCKETS; probes++) {
+    assoc_id_t id = node_buckets[b];
+    if (id == ASSOC_NONE) return -1;
+    if (nodes[id].kind == kind && memcmp(nodes[id].mac.data(), mac, 6) == 0) return b;
+    b = (b + 1) & (ASSOC_NODE_BUCKETS - 1);
+  }
+  return -1;
+}
+
+static assoc_id_t findNode(const uint8_t* mac, uint8_t kind) {
+  int b = nodeBucket(mac, kind);
+  return b < 0 ? ASSOC_NONE : node_buckets[b];
+}
+
+static assoc_id_t createNode(const uint8_t* mac, uint8_t kind) {
+  if (free_nodes == ASSOC_NONE) return ASSOC_NONE;
+
+  assoc_id_t id = free_nodes;
+  free_nodes = nodes[id].edges;
+
+  AssocNode& n = nodes[id];
+  memcpy(n.mac.data(), mac, 6);
+  n.kind = kind;
+  n.degree = 0;
+  n.edges = ASSOC_NONE;
+  n.current = ASSOC_NONE;
+
+  uint16_t b = nodeHome(mac, kind);
+  while (node_buckets[b] != ASSOC_NONE) {
+    b = (b + 1) & (ASSOC_NODE_BUCKETS - 1);
+  }
+  node_buckets[b] = id;
+  node_count++;
+  return id;
+}
+
+static void releaseNode(assoc_id_t id) {
+  int b = nodeBucket(nodes[id].mac.data(), nodes[id].kind);
+  if (b >= 0) {
+    bucketRemove<ASSOC_NODE_BUCKETS>(node_buckets, b, [](assoc_id_t n) {
+      return nodeHome(nodes[n].mac.data(), nodes[n].kind);
+    });
+  }
+  nodes[id].edges = free_nodes;
+  free_nodes = id;
+  node_count--;
+}
+
+// ===== Edges =====
+static int edgeBucket(assoc_id_t ap, assoc_id_t sta) {
+  uint16_t b = edgeHome(ap, sta);
+  for (int probes = 0; probes < ASSOC_EDGE_BUCKETS; probes++) {
+    assoc_id_t id = edge_buckets[b];
+    if (id == ASSOC_NONE) return -1;
+    if (edges[id].ap == ap && edges[id].sta == sta) return b;
+    b = (b + 1) & (ASSOC_EDGE_BUCKETS - 1);
+  }
+  return -1;
+}
+
+static void lruUnlink(assoc_id_t id) {
+  AssocEdge& e = edges[id];
+  if (e.lru_prev != ASSOC_NONE) edges[e.lru_prev].lru_next = e.lru_next;
+  else lru_head = e.lru_next;
+  if (e.lru_next != ASSOC_NONE) edges[e.lru_next].lru_prev = e.lru_prev;
+  else lru_tail = e.lru_prev;
+}
+
+static void lruPushFront(assoc_id_t id) {
+  AssocEdge& e = edges[id];
+  e.lru_prev = ASSOC_NONE;
+  e.lru_next = lru_head;
+  if (lru_head != ASSOC_NONE) edges[lru_head].lru_prev = id;
+  lru_head = id;
+  if (lru_tail == ASSOC_NONE) lru_tail = id;
+}
+
+// Newest edge left on a station after one was removed
+static assoc_id_t newestStationEdge(assoc_id_t sta) {
+  assoc_id_t best = ASSOC_NONE;
+  for (assoc_id_t e = nodes[sta].edges; e != ASSOC_NONE; e = edges[e].sta_next) {
+    if (best == ASSOC_NONE || (long)(edges[e].last_seen - edges[best].last_seen) > 0) best = e;
+  }
+  return best;
+}
+
+static void removeEdge(assoc_id_t id) {
+  AssocEdge& e = edges[id];
+  AssocNode& ap = nodes[e.ap];
+  AssocNode& sta = nodes[e.sta];
+
+  int b = edgeBucket(e.ap, e.sta);
+  if (b >= 0) {
+    bucketRemove<ASSOC_EDGE_BUCKETS>(edge_buckets, b, [](assoc_id_t x) {
+      return edgeHome(edges[x].ap, edges[x].sta);
+    });
+  }
+
+  if (e.ap_prev != ASSOC_NONE) edges[e.ap_prev].ap_next = e.ap_next;
+  else ap.edges = e.ap_next;
+  if (e.ap_next != ASSOC_NONE) edges[e.ap_next].ap_prev = e.ap_prev;
+
+  if (e.sta_prev != ASSOC_NONE) edges[e.sta_prev].sta_next = e.sta_next;
+  else sta.edges = e.sta_next;
+  if (e.sta_next != ASSOC_NONE) edges[e.sta_next].sta_prev = e.sta_prev;
+
+  lruUnlink(id);
+
+  ap.degree--;
+  sta.degree--;
+  if (sta.current == id) sta.current = newestStationEdge(e.sta);
+
+  assoc_id_t ap_id = e.ap;
+  assoc_id_t sta_id = e.sta;
+  mac_address_t ap_mac = ap.mac;
+  mac_address_t sta_mac = sta.mac;
+  timerCancel(TIMER_ASSOC, id);
+  e.ap = ASSOC_NONE;  // Marks the edge free for a late expiry check
+  e.lru_next = free_edges;
+  free_edges = id;
+  edge_count--;
+
+  if (nodes[ap_id].degree == 0) releaseNode(ap_id);
+  if (nodes[sta_id].degree == 0) releaseNode(sta_id);
+  scanAssocChanged(ap_mac.data(), sta_mac.data());
+}
+
+// ===== Public API =====
+void assocGraphClear() {
+  memset(node_buckets, 0xFF, sizeof(node_buckets));
+  memset(edge_buckets, 0xFF, sizeof(edge_buckets));
+
+  for (int i = 0; i < ASSOC_MAX_NODES; i++) {
+    nodes[i].edges = (i + 1 < ASSOC_MAX_NODES) ? i + 1 : ASSOC_NONE;
+  }
+  for (int i = 0; i < ASSOC_MAX_EDGES; i++) {
+    edges[i].ap = ASSOC_NONE;
+    edges[i].lru_next = (i + 1 < ASSOC_MAX_EDGES) ? i + 1 : ASSOC_NONE;
+  }
+  free_nodes = 0;
+  free_edges = 0;
+  lru_head = ASSOC_NONE;
+  lru_tail = ASSOC_NONE;
+  node_count = 0;
+  edge_count = 0;
+}
+
+assoc_id_t assocUpsert(const uint8_t* ap_bssid, const uint8_t* sta_mac, unsigned long now) {
+  assoc_id_t ap = findNode(ap_bssid, ASSOC_NODE_AP);
+  assoc_id_t sta = findNode(sta_mac, ASSOC_NODE_STA);
+
+  if (ap != ASSOC_NONE && sta != ASSOC_NONE) {
+    int b = edgeBucket(ap, sta);
+    if (b >= 0) {
+      assoc_id_t id = edge_buckets[b];
+      AssocEdge& e = edges[id];
+      e.last_seen = now;
+      e.count++;
+      if (lru_head != id) {
+        lruUnlink(id);
+        lruPushFront(id);
+      }
+      if (nodes[sta].current != id) {
+        nodes[sta].current = id;
+        scanAssocChanged(ap_bssid, sta_mac);
+      }
+      return id;
+    }
+  }
+
+  // New edge: recycle the stalest one if the pool is full. That may free
+  // the nodes looked up above, so look them up again afterwards.
+  if (free_edges == ASSOC_NONE && lru_tail != ASSOC_NONE) {
+    removeEdge(lru_tail);
+    ap = findNode(ap_bssid, ASSOC_NODE_AP);
+    sta = findNode(sta_mac, ASSOC_NODE_STA);
+  }
+  if (free_edges == ASSOC_NONE) return ASSOC_NONE;
+
+  bool new_ap = false;
+  if (ap == ASSOC_NONE) {
+    ap = createNode(ap_bssid, ASSOC_NODE_AP);
+    if (ap == ASSOC_NONE) return ASSOC_NONE;
+    new_ap = true;
+  }
+  if (sta == ASSOC_NONE) {
+    sta = createNode(sta_mac, ASSOC_NODE_STA);
+    if (sta == ASSOC_NONE) {
+      if (new_ap) releaseNode(ap);
+      return ASSOC_NONE;
+    }
+  }
+
+  assoc_id_t id = free_edges;
+  free_edges = edges[id].lru_next;
+
+  AssocEdge& e = edges[id];
+  e.ap = ap;
+  e.sta = sta;
+  e.first_seen = now;
+  e.last_seen = now;
+  e.count = 1;
+
+  e.ap_prev = ASSOC_NONE;
+  e.ap_next = nodes[ap].edges;
+  if (e.ap_next != ASSOC_NONE) edges[e.ap_next].ap_prev = id;
+  nodes[ap].edges = id;
+  nodes[ap].degree++;
+
+  e.sta_prev = ASSOC_NONE;
+  e.sta_next = nodes[sta].edges;
+  if (e.sta_next != ASSOC_NONE) edges[e.sta_next].sta_prev = id;
+  nodes[sta].edges = id;
+  nodes[sta].degree++;
+  nodes[sta].current = id;
+
+  lruPushFront(id);
+
+  uint16_t b = edgeHome(ap, sta);
+  while (edge_buckets[b] != ASSOC_NONE) {
+    b = (b + 1) & (ASSOC_EDGE_BUCKETS - 1);
+  }
+  edge_buckets[b] = id;
+  edge_count++;
+
+  timerArm(TIMER_ASSOC, id, now + scan.assoc_ttl_ms);
+  scanAssocChanged(ap_bssid, sta_mac);
+  return id;
+}
+
+bool assocRemove(const uint8_t* ap_bssid, const uint8_t* sta_mac) {
+  assoc_id_t ap = findNode(ap_bssid, ASSOC_NODE_AP);
+  assoc_id_t sta = findNode(sta_mac, ASSOC_NODE_STA);
+  if (ap == ASSOC_NONE || sta == ASSOC_NONE) return false;
+
+  int b = edgeBucket(ap, sta);
+  if (b < 0) return false;
+  removeEdge(edge_buckets[b]);
+  return true;
+}
+
+// Timer wheel handler: refreshes only move last_seen, so check it here
+bool assocTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  if (id >= ASSOC_MAX_EDGES || edges[id].ap == ASSOC_NONE) return false;
+
+  unsigned long expires = edges[id].last_seen + scan.assoc_ttl_ms;
+  if ((long)(expires - now) > 0) {
+    *rearm_at = expires;
+    return true;
+  }
+  removeEdge(id);
+  return false;
+}
+
+int assocDegree(const uint8_t* ap_bssid) {
+  assoc_id_t ap = findNode(ap_bssid, ASSOC_NODE_AP);
+  return ap == ASSOC_NONE ? -1 : nodes[ap].degree;
+}
+
+bool assocCurrentAP(const uint8_t* sta_mac, mac_address_t* out) {
+  assoc_id_t sta = findNode(sta_mac, ASSOC_NODE_STA);
+  if (sta == ASSOC_NONE) return false;
+
+  assoc_id_t e = nodes[sta].current;
+  if (e >= ASSOC_MAX_EDGES || edges[e].ap >= ASSOC_MAX_NODES) return false;
+  *out = nodes[edges[e].ap].mac;
+  return true;
+}
+
+int assocForEachClient(const uint8_t* ap_bssid,
+                       void (*fn)(const AssocNode& sta, const AssocEdge& edge, void* ctx), void* ctx) {
+  assoc_id_t ap = findNode(ap_bssid, ASSOC_NODE_AP);
+  if (ap == ASSOC_NONE) return 0;
+
+  int visited = 0;
+  for (assoc_id_t e = nodes[ap].edges; e < ASSOC_MAX_EDGES && visited < ASSOC_MAX_EDGES; e = edges[e].ap_next) {
+    if (edges[e].sta >= ASSOC_MAX_NODES) break;
+    fn(nodes[edges[e].sta], edges[e], ctx);
+    visited++;
+  }
+  return visited;
+}
+
+int assocEdgeCount() {
+  return edge_count;
+}
+
+int assocNodeCount() {
+  return node_count;
+}
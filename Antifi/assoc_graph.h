@@ -0,0 +1,75 @@
+#ifndef ASSOC_GRAPH_H
+#define ASSOC_GRAPH_H
+
+#include "scan.h"
+
+// ===== Configuration Constants =====
+#define ASSOC_MAX_NODES 512     // APs + stations with at least one edge
+#define ASSOC_NODE_BUCKETS 1024 // Power of two, > 2x ASSOC_MAX_NODES
+#define ASSOC_MAX_EDGES 512     // Least recently seen edge is recycled when full
+#define ASSOC_EDGE_BUCKETS 1024 // Power of two, > 2x ASSOC_MAX_EDGES
+#define ASSOC_NONE 0xFFFF
+
+#define ASSOC_NODE_AP 0
+#define ASSOC_NODE_STA 1
+
+typedef uint16_t assoc_id_t;
+
+// ===== Association Graph =====
+// Single source of truth for client <-> AP association. Nodes are APs and
+// stations with compact IDs; each edge sits on three intrusive lists (its
+// AP's, its station's and a global recency list), so upsert, remove and
+// expiry (TIMER_ASSOC, scan.assoc_ttl_ms) are O(1) and an AP's clients are enumerated without a search.
+// Nodes disappear with their last edge.
+//
+// Owned by the RX path: only the writer (the RX callback, or loop() while the
+// scan subscription is paused) may call into the graph. Every change of an
+// AP's degree or a station's current AP is handed to scanAssocChanged(), which
+// copies it into the AP and client records under their seqlocks; display,
+// export and queries read those copies instead of walking the graph.
+typedef struct {
+  mac_address_t mac;
+  uint8_t kind;        // ASSOC_NODE_AP or ASSOC_NODE_STA
+  uint16_t degree;     // Edges on this node
+  assoc_id_t edges;    // Head of this node's edge list
+  assoc_id_t current;  // STA: most recently seen edge
+} AssocNode;
+
+typedef struct {
+  assoc_id_t ap;
+  assoc_id_t sta;
+  assoc_id_t ap_prev, ap_next;    // Other stations of the same AP
+  assoc_id_t sta_prev, sta_next;  // Other APs of the same station
+  assoc_id_t lru_prev, lru_next;  // Recency (head = most recent)
+  unsigned long first_seen;
+  unsigned long last_seen;
+  uint32_t count;  // Frames that tied the pair together
+} AssocEdge;
+
+// Threads the free lists; scanBegin() runs it before the first frame
+void assocGraphClear();
+
+// Creates or refreshes the AP <-> station edge
+assoc_id_t assocUpsert(const uint8_t* ap_bssid, const uint8_t* sta_mac, unsigned long now);
+
+// Drops the edge; false if there was none
+bool assocRemove(const uint8_t* ap_bssid, const uint8_t* sta_mac);
+
+// Stations on the AP, or -1 if the AP never took part in an association
+int assocDegree(const uint8_t* ap_bssid);
+
+// BSSID of the station's most recently seen AP
+bool assocCurrentAP(const uint8_t* sta_mac, mac_address_t* out);
+
+// Calls fn for every station of the AP, returns how many were visited
+int assocForEachClient(const uint8_t* ap_bssid,
+                       void (*fn)(const AssocNode& sta, const AssocEdge& edge, void* ctx), void* ctx);
+
+int assocEdgeCount();
+int assocNodeCount();
+
+// Defined by the scan module: republish the pair's AP degree and the
+// station's current AP into their records
+void scanAssocChanged(const uint8_t* ap_bssid, const uint8_t* sta_mac);
+
+#endif  // ASSOC_GRAPH_H
@@ -0,0 +1,43 @@
+#ifndef BEACON_HASH_H
+#define BEACON_HASH_H
+
+// Also builds on the host (beacon replay), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#endif
+#include "crc32.h"
+
+#define BEACON_CAPABILITY_OFFSET 34  // Header + timestamp + beacon interval
+#define BEACON_ELEMENT_TIM 5         // DTIM count and traffic bitmap, new every beacon
+#define BEACON_ELEMENT_BSS_LOAD 11   // Station count and channel utilization
+
+// ===== Beacon Change Detection =====
+// An AP's beacons only differ in timestamp, sequence number and a few
+// volatile elements, so a CRC of the rest tells whether the IEs need
+// parsing again. Covers the capability field and every element except TIM
+// and BSS Load. `len` leaves out the FCS; `seed` folds in the settings that
+// change what a parse extracts. 0 when there is no body to hash.
+static inline uint32_t beaconBodyHash(const uint8_t* frame, uint16_t len, uint32_t seed) {
+  if (len < BEACON_CAPABILITY_OFFSET + 2) return 0;
+
+  uint32_t crc = crc32Le(seed, frame + BEACON_CAPABILITY_OFFSET, 2);
+  uint16_t pos = BEACON_CAPABILITY_OFFSET + 2;
+  while (pos + 2 <= len) {
+    uint8_t element_id = frame[pos];
+    uint16_t element_size = 2 + frame[pos + 1];
+
+    if (pos + element_size > len) {
+      crc = crc32Le(crc, frame + pos, len - pos);
+      break;
+    }
+    if (element_id != BEACON_ELEMENT_TIM && element_id != BEACON_ELEMENT_BSS_LOAD) {
+      crc = crc32Le(crc, frame + pos, element_size);
+    }
+    pos += element_size;
+  }
+  return crc;
+}
+
+#endif  // BEACON_HASH_H
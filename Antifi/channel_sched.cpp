@@ -0,0 +1,183 @@
+#include "channel_sched.h"
+
+#ifdef ARDUINO
+#include "rssi_stats.h"
+#else
+#include <string.h>
+#include <algorithm>
+using std::min;
+
+unsigned long millis();  // The host tool's clock
+#endif
+
+// ===== Scheduler State =====
+#define CHAN_ALL ((uint16_t)(((1u << CHAN_COUNT) - 1) << 1))  // Bits 1..14
+#define CHAN_YIELD_CAP 64                                      // New records counted per visit
+
+typedef struct {
+  int32_t yield;             // EWMA of new records per visit (x256)
+  unsigned long last_visit;  // When the last visit ended
+  uint32_t visits;
+  uint32_t dwell_ms;
+  uint32_t discoveries;
+} ChannelStats;
+
+static ChannelStats channels[CHAN_COUNT + 1];  // Indexed by channel number, [0] unused
+
+// Written by the RX callback
+static uint32_t found[CHAN_COUNT + 1];
+static unsigned long last_found_ms = 0;
+static uint32_t curve[CHAN_CURVE_POINTS];  // ms after scan start of each discovery
+static uint32_t found_total = 0;
+
+// Loop side
+static int current = 1;
+static unsigned long scan_start = 0;
+static unsigned long dwell_start = 0;
+static uint32_t dwell_base = 0;  // found[current] when the visit began
+static uint16_t sweep_seen = 0;  // Channels visited in this sweep
+static unsigned long sweep_start = 0;
+static uint32_t sweeps = 0;
+
+// ===== Visits =====
+static void enterChannel(int channel, unsigned long now) {
+  current = channel;
+  dwell_start = now;
+  dwell_base = __atomic_load_n(&found[channel], __ATOMIC_RELAXED);
+  channels[channel].visits++;
+  sweep_seen |= 1u << channel;
+}
+
+static void leaveChannel(unsigned long now) {
+  ChannelStats& c = channels[current];
+  uint32_t fresh = __atomic_load_n(&found[current], __ATOMIC_RELAXED) - dwell_base;
+  int32_t sample = (int32_t)min<uint32_t>(fresh, CHAN_YIELD_CAP) << 8;
+
+  // The first visit replaces the prior outright
+  c.yield = c.visits == 1 ? sample : c.yield + ((sample - c.yield) / 4);
+  c.dwell_ms += now - dwell_start;
+  c.discoveries += fresh;
+  c.last_visit = now;
+}
+
+// Time left in the sweep after a minimal visit to every channel it still owes
+static long sweepSlack(unsigned long now) {
+  int owed = __builtin_popcount(CHAN_ALL & ~sweep_seen);
+  return (long)CHAN_SWEEP_BUDGET_MS - (long)(now - sweep_start) - (long)owed * CHAN_QUIET_MS;
+}
+
+static int pickChannel(unsigned long now) {
+  bool owed_only = sweepSlack(now) <= 0;
+  int best = 0;
+  uint64_t best_score = 0;
+
+  for (int ch = 1; ch <= CHAN_COUNT; ch++) {
+    if (ch == current) continue;
+    if (owed_only && (sweep_seen & (1u << ch))) continue;
+    uint64_t score = (uint64_t)(channels[ch].yield + CHAN_YIELD_FLOOR) * (now - channels[ch].last_visit + 1);
+    if (score > best_score) {
+      best_score = score;
+      best = ch;
+    }
+  }
+  return best ? best : current % CHAN_COUNT + 1;
+}
+
+// ===== Public API =====
+void chanSchedReset(unsigned long now, int channel) {
+  memset(channels, 0, sizeof(channels));
+  for (int ch = 1; ch <= CHAN_COUNT; ch++) {
+    channels[ch].yield = CHAN_YIELD_UNKNOWN;
+    channels[ch].last_visit = now;
+  }
+  memset(found, 0, sizeof(found));
+  __atomic_store_n(&found_total, 0, __ATOMIC_RELEASE);
+  last_found_ms = now;
+  scan_start = now;
+  sweep_start = now;
+  sweep_seen = 0;
+  sweeps = 0;
+  enterChannel(channel >= 1 && channel <= CHAN_COUNT ? channel : 1, now);
+}
+
+void chanSchedDiscovered(int channel) {
+  if (channel < 1 || channel > CHAN_COUNT) return;
+  unsigned long now = millis();
+  __atomic_fetch_add(&found[channel], 1, __ATOMIC_RELAXED);
+  __atomic_store_n(&last_found_ms, now, __ATOMIC_RELAXED);
+
+  uint32_t n = found_total;
+  if (n < CHAN_CURVE_POINTS) curve[n] = now - scan_start;
+  __atomic_store_n(&found_total, n + 1, __ATOMIC_RELEASE);
+}
+
+int chanSchedTick(unsigned long now, uint8_t mode, unsigned long hop_interval, bool* sweep_done) {
+  *sweep_done = false;
+  unsigned long elapsed = now - dwell_start;
+
+  if (mode == DWELL_FIXED) {
+    if (elapsed < hop_interval) return 0;
+  } else {
+    if (elapsed < CHAN_QUIET_MS) return 0;
+
+    // Anything new during this visit pushes the quiet deadline out
+    unsigned long quiet_since = dwell_start;
+    if (__atomic_load_n(&found[current], __ATOMIC_RELAXED) != dwell_base) {
+      unsigned long last = __atomic_load_n(&last_found_ms, __ATOMIC_RELAXED);
+      if ((long)(last - dwell_start) > 0) quiet_since = last;
+    }
+    bool busy = now - quiet_since < CHAN_QUIET_MS;
+    if (busy && elapsed < CHAN_DWELL_MAX_MS && sweepSlack(now) > 0) return 0;
+  }
+
+  leaveChannel(now);
+  if ((sweep_seen & CHAN_ALL) == CHAN_ALL) {
+    *sweep_done = true;
+    sweeps++;
+    sweep_seen = 0;
+    sweep_start = now;
+  }
+
+  int next = mode == DWELL_FIXED ? current % CHAN_COUNT + 1 : pickChannel(now);
+  enterChannel(next, now);
+  return next;
+}
+
+#ifdef ARDUINO
+// ===== Report =====
+// Seconds until `pct` percent of the discoveries so far had been made
+static float discoveryTime(uint32_t n, int pct) {
+  uint32_t k = (n * pct + 99) / 100;
+  return k ? curve[k - 1] / 1000.0f : 0.0f;
+}
+
+void chanSchedReport(unsigned long now, uint8_t mode) {
+  uint32_t total = __atomic_load_n(&found_total, __ATOMIC_ACQUIRE);
+
+  Serial.println("\n=== CHANNEL SCHEDULER ===");
+  Serial.printf("Mode: %s | Sweeps: %lu | Tuned: %d | Running: %lu s\n",
+                mode == DWELL_FIXED ? "fixed" : "adaptive", (unsigned long)sweeps, current,
+                (now - scan_start) / 1000);
+  Serial.println("Ch | Visits | Dwell (s) | Found | Yield/visit | Noise | Last visit");
+  Serial.println("--------------------------------------------------------------------");
+  for (int ch = 1; ch <= CHAN_COUNT; ch++) {
+    const ChannelStats& c = channels[ch];
+    int noise = rssiNoiseFloor(ch);
+    char noise_str[8];
+    if (noise) snprintf(noise_str, sizeof(noise_str), "%d", noise);
+    else strcpy(noise_str, "-");
+    Serial.printf("%2d | %6lu | %9.1f | %5lu | %11.2f | %5s | %lu s ago\n",
+                  ch, (unsigned long)c.visits, c.dwell_ms / 1000.0f, (unsigned long)c.discoveries,
+                  c.yield / 256.0f, noise_str, (now - c.last_visit) / 1000);
+  }
+
+  if (total == 0) {
+    Serial.println("Discoveries: 0");
+    return;
+  }
+  uint32_t n = min<uint32_t>(total, CHAN_CURVE_POINTS);
+  Serial.printf("Discoveries: %lu | t50 %.1f s | t90 %.1f s | t95 %.1f s%s\n",
+                (unsigned long)total, discoveryTime(n, 50), discoveryTime(n, 90), discoveryTime(n, 95),
+                total > n ? " (first discoveries only)" : "");
+}
+#endif
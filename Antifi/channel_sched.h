@@ -0,0 +1,52 @@
+#ifndef CHANNEL_SCHED_H
+#define CHANNEL_SCHED_H
+
+// Also builds on the host (scan replay tool), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#endif
+
+// ===== Configuration Constants =====
+#define CHAN_COUNT 14
+#define CHAN_QUIET_MS 150          // Leave a channel after this long without a discovery (> one beacon interval)
+#define CHAN_DWELL_MAX_MS 1500     // Longest single visit, however productive
+#define CHAN_SWEEP_BUDGET_MS 5000  // Every channel is visited at least once per sweep (RSSI refresh)
+#define CHAN_YIELD_UNKNOWN 1024    // Assumed yield of a never-visited channel (4 new records/visit)
+#define CHAN_YIELD_FLOOR 32        // Converged channels still score 1/8 record/visit
+#define CHAN_CURVE_POINTS 512      // Discovery timestamps kept for the time-to-N% report
+
+// ===== Dwell Modes =====
+enum ChanDwellMode : uint8_t {
+  DWELL_FIXED,     // Round-robin, one hop interval per channel
+  DWELL_ADAPTIVE,  // Discovery-aware (below)
+};
+
+// ===== Channel Scheduler =====
+// Adaptive mode stays on a channel while new BSSIDs/stations keep turning up
+// and leaves once it has been quiet for CHAN_QUIET_MS. The next channel is
+// the one with the best (yield + floor) * time-since-visit score, so
+// productive channels come round often and converged ones rarely. Yield is
+// an EWMA of new records per visit (x256). Sweeps bound the staleness: once
+// the time left in a sweep only covers a short visit to every channel not
+// yet seen in it, those channels are visited back to back.
+//
+// The RX callback reports discoveries; loop() drives the hops.
+
+// Starts a new scan tuned to `channel`
+void chanSchedReset(unsigned long now, int channel);
+
+// RX callback: a new AP or station was just seen on the tuned channel
+void chanSchedDiscovered(int channel);
+
+// Decides whether to hop. Returns the channel to tune to, or 0 to stay.
+// *sweep_done is set when every channel has been visited since the last one.
+int chanSchedTick(unsigned long now, uint8_t mode, unsigned long hop_interval, bool* sweep_done);
+
+#ifdef ARDUINO
+// Per-channel visits/yield and time to 50/90/95% of the discoveries so far
+void chanSchedReport(unsigned long now, uint8_t mode);
+#endif
+
+#endif  // CHANNEL_SCHED_H
@@ -28,6 +28,11 @@ void showHelp() {
                    "╠══════════════════════════════════════════════════════════════════════════════════╣\n"
                    "║ SNIFFING:                                                                        ║\n"
                    "║   sniff -c <ch || all>        Sniff WiFi on all channels or specific channel     ║\n"
+                   "║   sniff -b <bssid>            Capture one AP: track its channel (CSA, restarts)  ║\n"
+                   "║   flow -s <serial || sd>      Aggregate frames into flow records (CSV or SD)     ║\n"
+                   "║   flow -t <idle s> <active s> Flow timeouts (default 15 s idle, 120 s active)    ║\n"
+                   "║   flow                        Flow counts, exports and size vs. PCAPNG           ║\n"
+                   "║   flow stop                   Export open flows and stop                         ║\n"
                    "║                                                                                  ║\n"
                    "║ PACKET INJECTION:                                                                ║\n"
                    "║   inject<n> -i <hex> -c <ch> -p <rate> -m <max|non> -r <dbm>                     ║\n"
@@ -39,6 +44,34 @@ void showHelp() {
                    "║                                                                                  ║\n"
                    "║ SCANNING:                                                                        ║\n"
                    "║   scan -t <ap || sta>         Scan for WiFi networks or clients                  ║\n"
+                   "║   scan -k <n>                 Show the top <n> APs/clients per display pass      ║\n"
+                   "║   scan -o <rssi || seen>      Order displays by signal or by last seen           ║\n"
+                   "║   scan -f <table || events>   Output full tables or JSON-lines change events     ║\n"
+                   "║   scan snapshot               Print every AP/client as JSON lines (event format) ║\n"
+                   "║   scan -dwell <mode>          Channel dwell: adaptive (discovery-aware) or fixed ║\n"
+                   "║   scan -fast <on || off>      Seed AP scans with one driver scan before sniffing ║\n"
+                   "║   scan -ewma <1-6>            RSSI smoothing, alpha = 1/2^n (default 2)          ║\n"
+                   "║   scan rssi <mac>             RSSI EWMA, range, histogram and noise floor        ║\n"
+                   "║   scan channels               Per-channel dwell/yield and time to 95% discovery  ║\n"
+                   "║   scan query <ap || sta> ...  Filter/sort tables (ch= enc= vendor= rssi>= ...)   ║\n"
+                   "║   scan -ttl <type> <sec>      Record lifetime (ap, client, assoc, ssid, probe)   ║\n"
+                   "║   scan heap                   Scan arena, pool usage and heap fragmentation      ║\n"
+                   "║   scan devices                Unique transmitters per channel/AP/window (HLL)    ║\n"
+                   "║   scan save || scan load      Write or reload the SD snapshot (loaded at boot)   ║\n"
+                   "║   scan -autosave <sec || off> Background snapshot interval while tables change   ║\n"
+                   "║   scan store                  Snapshot size, save/load times and failures        ║\n"
+                   "║   scan journal <on || off>    Append scan events to the SD journal (batched)     ║\n"
+                   "║   scan journal                Journal commits, commit time, drops and recovery   ║\n"
+                   "║   rx stats                    RX bus subscribers, channel owner, cycles/frame    ║\n"
+                   "║   stats top <on || off>       Count heaviest transmitters/pairs per channel      ║\n"
+                   "║   stats top [ch || reset]     Top talkers with frame error bounds and bytes      ║\n"
+                   "║   stats seq <on || off>       Estimate capture loss from 802.11 sequence gaps    ║\n"
+                   "║   stats seq [reset]           Completeness per channel and dwell, lossiest TAs   ║\n"
+                   "║                                                                                  ║\n"
+                   "║ DETECTION:                                                                       ║\n"
+                   "║   wids <on || off>            Flag deauth/disassoc floods, beacon floods, twins  ║\n"
+                   "║   wids                        Detector thresholds, frame counts and alerts       ║\n"
+                   "║   wids -t <name> <n>          Set deauth (/s), beacons (new/s) or ssid (APs)     ║\n"
                    "║                                                                                  ║\n"
                    "║ BEACON ATTACK:                                                                   ║\n"
                    "║   beacon -s                    Start beacon spam attack                          ║\n"
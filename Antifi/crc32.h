@@ -0,0 +1,35 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+// Also builds on the host (replay and benchmark tools), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "esp_rom_crc.h"
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+// zlib CRC-32, chained: pass the previous result (0 to start). The ROM
+// routine on the device; the same polynomial from a table on the host.
+#ifdef ARDUINO
+static inline uint32_t crc32Le(uint32_t crc, const uint8_t* p, size_t len) {
+  return esp_rom_crc32_le(crc, p, len);
+}
+#else
+static inline uint32_t crc32Le(uint32_t crc, const uint8_t* p, size_t len) {
+  static uint32_t table[256];
+  if (!table[1]) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = (c >> 1) ^ (c & 1 ? 0xEDB88320u : 0);
+      table[i] = c;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+#endif
+
+#endif  // CRC32_H
@@ -0,0 +1,132 @@
+#include "device_count.h"
+#include "sketch.h"
+#include "scan.h"
+
+// ===== Sketches =====
+// Written by the RX callback; loop() only reads them, and clears them when a
+// scan starts
+static HyperLogLog<DEVICE_TOTAL_P> total;
+static HyperLogLog<DEVICE_CHANNEL_P> channels[15];  // [0] unused
+static HyperLogLog<DEVICE_WINDOW_P> windows[DEVICE_WINDOWS];
+static HyperLogLog<DEVICE_AP_P> ap_stations[MAX_APS];
+
+static uint8_t window_cur = 0;
+static uint8_t windows_used = 1;
+static unsigned long window_start = 0;
+static uint32_t frames_counted = 0;
+
+void deviceCountClear(unsigned long now) {
+  total.clear();
+  for (auto& c : channels) c.clear();
+  for (auto& w : windows) w.clear();
+  for (auto& a : ap_stations) a.clear();
+  window_cur = 0;
+  windows_used = 1;
+  window_start = now;
+  frames_counted = 0;
+}
+
+// ===== RX Path =====
+// Moves to the next window once the current one is full; after a long quiet
+// spell every window is stale, so all of them start over
+static void rollWindows(unsigned long now) {
+  if (now - window_start < DEVICE_WINDOW_MS) return;
+
+  unsigned long elapsed = (now - window_start) / DEVICE_WINDOW_MS;
+  int steps = elapsed < DEVICE_WINDOWS ? (int)elapsed : DEVICE_WINDOWS;
+  for (int i = 0; i < steps; i++) {
+    window_cur = (window_cur + 1) % DEVICE_WINDOWS;
+    windows[window_cur].clear();
+  }
+  windows_used = min<int>(windows_used + steps, DEVICE_WINDOWS);
+  window_start += elapsed * DEVICE_WINDOW_MS;
+}
+
+void deviceCountFrame(const FrameView& f, unsigned long now) {
+  if (!f.ta) return;  // ACK / CTS name no transmitter
+
+  rollWindows(now);
+  uint64_t h = macHash64(f.ta);
+  total.add(h);
+  windows[window_cur].add(h);
+  if (f.channel >= 1 && f.channel <= 14) channels[f.channel].add(h);
+  frames_counted++;
+}
+
+void deviceCountStation(int ap_slot, const uint8_t* sta_mac) {
+  if (ap_slot < 0 || ap_slot >= MAX_APS) return;
+  ap_stations[ap_slot].add(macHash64(sta_mac));
+}
+
+void deviceCountResetAP(int ap_slot) {
+  if (ap_slot < 0 || ap_slot >= MAX_APS) return;
+  ap_stations[ap_slot].clear();
+}
+
+uint32_t deviceCountAP(int ap_slot) {
+  if (ap_slot < 0 || ap_slot >= MAX_APS) return 0;
+  return ap_stations[ap_slot].estimate();
+}
+
+// ===== Report =====
+void deviceCountReport() {
+  unsigned long now = millis();
+  size_t bytes = sizeof(total) + sizeof(channels) + sizeof(windows) + sizeof(ap_stations);
+
+  Serial.println("\n=== UNIQUE DEVICES (HyperLogLog) ===");
+  Serial.printf("Transmitters since scan start: ~%lu (+/-%.1f%%) | Frames counted: %lu\n",
+                (unsigned long)total.estimate(), HyperLogLog<DEVICE_TOTAL_P>::errorPercent(),
+                (unsigned long)frames_counted);
+  Serial.printf("Client table: %u/%d records (evicts oldest when full)\n", (unsigned)client_list.size(), MAX_CLIENTS);
+
+  HyperLogLog<DEVICE_WINDOW_P> recent;
+  for (int i = 0; i < windows_used; i++) {
+    recent.merge(windows[(window_cur + DEVICE_WINDOWS - i) % DEVICE_WINDOWS]);
+  }
+  Serial.printf("This window (%lu s): ~%lu | Last %d windows: ~%lu (+/-%.1f%%, %d s windows)\n",
+                (now - window_start) / 1000, (unsigned long)windows[window_cur].estimate(), windows_used,
+                (unsigned long)recent.estimate(), HyperLogLog<DEVICE_WINDOW_P>::errorPercent(),
+                DEVICE_WINDOW_MS / 1000);
+
+  // Channels overlap (a device is heard on several); the merge counts it once
+  HyperLogLog<DEVICE_CHANNEL_P> all;
+  Serial.println("Channel | Transmitters");
+  for (int ch = 1; ch <= 14; ch++) {
+    if (channels[ch].empty()) continue;
+    Serial.printf("%7d | ~%lu\n", ch, (unsigned long)channels[ch].estimate());
+    all.merge(channels[ch]);
+  }
+  Serial.printf("Merged  | ~%lu (+/-%.1f%%)\n", (unsigned long)all.estimate(),
+                HyperLogLog<DEVICE_CHANNEL_P>::errorPercent());
+
+  // Top APs by distinct stations: a small insertion-sorted list
+  int top[DEVICE_TOP_APS];
+  uint32_t top_est[DEVICE_TOP_APS];
+  int shown = 0;
+  for (int slot = 0; slot < ap_count; slot++) {
+    uint32_t est = ap_stations[slot].estimate();
+    if (est == 0) continue;
+    int pos = shown < DEVICE_TOP_APS ? shown++ : DEVICE_TOP_APS;
+    while (pos > 0 && top_est[pos - 1] < est) {
+      if (pos < DEVICE_TOP_APS) {
+        top[pos] = top[pos - 1];
+        top_est[pos] = top_est[pos - 1];
+      }
+      pos--;
+    }
+    if (pos < DEVICE_TOP_APS) {
+      top[pos] = slot;
+      top_est[pos] = est;
+    }
+  }
+  if (shown) {
+    Serial.printf("Top APs by distinct stations (+/-%.0f%%):\n", HyperLogLog<DEVICE_AP_P>::errorPercent());
+    for (int i = 0; i < shown; i++) {
+      char bssid[18];
+      formatMAC(aps[top[i]].bssid.data(), bssid);
+      Serial.printf("  %-32.*s %s ~%lu\n", aps[top[i]].ssid_len, aps[top[i]].ssid, bssid,
+                    (unsigned long)top_est[i]);
+    }
+  }
+  Serial.printf("Sketch memory: %u bytes\n", (unsigned)bytes);
+}
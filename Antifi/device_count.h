@@ -0,0 +1,42 @@
+#ifndef DEVICE_COUNT_H
+#define DEVICE_COUNT_H
+
+#include <Arduino.h>
+#include "frame_view.h"
+
+// ===== Configuration Constants =====
+#define DEVICE_TOTAL_P 10      // 1 KB, 3.3% error: every transmitter since scan start
+#define DEVICE_WINDOW_P 9      // 512 B, 4.6% error per window
+#define DEVICE_CHANNEL_P 8     // 256 B, 6.5% error per channel
+#define DEVICE_AP_P 6          // 64 B, 13% error per AP (near exact below ~150)
+#define DEVICE_WINDOWS 5       // Rolling windows kept
+#define DEVICE_WINDOW_MS 60000
+#define DEVICE_TOP_APS 10      // APs listed by the report
+
+// ===== Unique Device Counts =====
+// The client table holds at most MAX_CLIENTS stations and evicts the oldest,
+// so in a crowd it undercounts. These HyperLogLog sketches count distinct
+// transmitter addresses instead, in fixed memory whatever the crowd size:
+// per channel, per AP (distinct stations tied to it), per time window and
+// in total. Updated from the RX callback; the report merges channel and
+// window sketches, so hop cycles and windows combine without double
+// counting.
+
+// Clears every sketch and restarts the windows at `now` (loop() side)
+void deviceCountClear(unsigned long now);
+
+// Counts the frame's transmitter (RX callback)
+void deviceCountFrame(const FrameView& f, unsigned long now);
+
+// Counts a station seen talking to the AP in `ap_slot` (RX callback)
+void deviceCountStation(int ap_slot, const uint8_t* sta_mac);
+
+// The AP slot was reused for another BSSID
+void deviceCountResetAP(int ap_slot);
+
+// Estimated distinct stations of one AP
+uint32_t deviceCountAP(int ap_slot);
+
+void deviceCountReport();
+
+#endif  // DEVICE_COUNT_H
@@ -0,0 +1,388 @@
+#include "flow.h"
+#include <SD.h>
+#include <unistd.h>
+#include "esp_heap_caps.h"
+#include "rssi_stats.h"
+#include "rx_bus.h"
+#include "scan.h"
+#include "sketch.h"
+
+#define FLOW_MASK (FLOW_TABLE - 1)
+#define EPB_OVERHEAD 32  // PCAPNG enhanced packet block around each frame
+
+// ===== Flow Table =====
+typedef struct {
+  uint8_t ra[6];
+  uint8_t ta[6];
+  uint8_t bssid[6];
+  uint8_t cls;      // FRAME_KEY with the QoS bit folded away
+  uint8_t channel;
+} FlowKey;
+
+typedef struct {
+  FlowKey key;
+  uint8_t used;
+  uint16_t home;    // Slot the key hashes to, for backward-shift deletion
+  uint16_t retries;
+  uint32_t packets;
+  uint32_t bytes;
+  uint32_t first_ms;
+  uint32_t last_ms;
+  RssiStats rssi;
+} FlowEntry;
+
+// Exported form; loop() encodes it
+typedef struct {
+  FlowKey key;
+  uint8_t reason;
+  uint16_t retries;
+  uint32_t packets;
+  uint32_t bytes;
+  uint32_t first_ms;
+  uint32_t last_ms;
+  int8_t rssi;
+  int8_t rssi_min;
+  int8_t rssi_max;
+} FlowDone;
+
+static FlowEntry* table = nullptr;
+static uint16_t sweep_cursor = 0;
+static int flow_rx = -1;
+static FlowSink sink = FLOW_SINK_SERIAL;
+static unsigned long idle_ms = FLOW_IDLE_MS;
+static unsigned long active_ms = FLOW_ACTIVE_MS;
+
+// Finished flows: RX callback produces, loop() consumes
+static FlowDone ring[FLOW_EXPORT_RING];
+static uint32_t ring_head = 0;
+static uint32_t ring_tail = 0;
+
+// SD batch (loop only)
+static File file;
+static uint8_t batch[FLOW_WRITE_BATCH * FLOW_RECORD_LEN];
+static int batch_count = 0;
+static unsigned long batch_since = 0;
+static uint32_t export_seq = 0;
+
+static struct {
+  uint32_t frames;      // RX callback
+  uint64_t frame_bytes;
+  uint32_t created;
+  uint32_t live;
+  uint32_t ended[FLOW_END_FLUSH + 1];
+  uint32_t dropped;     // Export ring full
+  uint32_t written;     // loop()
+  uint64_t written_bytes;
+  uint32_t write_failures;
+} stats;
+
+// ===== Export Hand-off (RX callback) =====
+static void finish(const FlowEntry& e, uint8_t reason) {
+  stats.ended[reason]++;
+  uint32_t head = ring_head;
+  if (head - __atomic_load_n(&ring_tail, __ATOMIC_ACQUIRE) >= FLOW_EXPORT_RING) {
+    stats.dropped++;
+    return;
+  }
+
+  FlowDone& d = ring[head & (FLOW_EXPORT_RING - 1)];
+  d.key = e.key;
+  d.reason = reason;
+  d.retries = e.retries;
+  d.packets = e.packets;
+  d.bytes = e.bytes;
+  d.first_ms = e.first_ms;
+  d.last_ms = e.last_ms;
+  d.rssi = rssiStatsValue(e.rssi);
+  d.rssi_min = e.rssi.min;
+  d.rssi_max = e.rssi.max;
+  __atomic_store_n(&ring_head, head + 1, __ATOMIC_RELEASE);
+}
+
+// Backward-shift deletion: entries further down the probe chain move up so
+// lookups never need tombstones
+static void removeAt(uint16_t slot) {
+  uint16_t hole = slot;
+  uint16_t j = slot;
+  for (;;) {
+    j = (j + 1) & FLOW_MASK;
+    if (!table[j].used) break;
+    uint16_t home = table[j].home;
+    bool stays = hole <= j ? (home > hole && home <= j) : (home > hole || home <= j);
+    if (stays) continue;
+    table[hole] = table[j];
+    hole = j;
+  }
+  table[hole].used = 0;
+  stats.live--;
+}
+
+static void sweep(uint32_t now) {
+  for (int i = 0; i < FLOW_SWEEP_PER_FRAME; i++) {
+    uint16_t slot = sweep_cursor;
+    sweep_cursor = (sweep_cursor + 1) & FLOW_MASK;
+    FlowEntry& e = table[slot];
+    if (!e.used) continue;
+
+    uint8_t reason = 0;
+    if (now - e.last_ms >= idle_ms) reason = FLOW_END_IDLE;
+    else if (now - e.first_ms >= active_ms) reason = FLOW_END_ACTIVE;
+    if (!reason) continue;
+
+    finish(e, reason);
+    removeAt(slot);
+  }
+}
+
+// ===== RX Path =====
+static void onFrame(const RxFrame& rx) {
+  const FrameView& f = rx.view;
+  uint32_t now = millis();
+  stats.frames++;
+  stats.frame_bytes += f.len;
+  sweep(now);
+
+  FlowKey key;
+  memcpy(key.ra, f.ra, 6);
+  if (f.ta) memcpy(key.ta, f.ta, 6);
+  else memset(key.ta, 0, 6);
+  if (f.bssid) memcpy(key.bssid, f.bssid, 6);
+  else memset(key.bssid, 0, 6);
+  key.cls = FRAME_KEY(f.type, f.type == FRAME_TYPE_DATA ? (f.subtype & ~0x08) : f.subtype);
+  key.channel = f.channel;
+
+  uint16_t home = bytesHash64((const uint8_t*)&key, sizeof(key)) & FLOW_MASK;
+  uint16_t slot = home;
+  uint16_t stalest = home;
+  FlowEntry* e = nullptr;
+  for (int probe = 0; probe < FLOW_PROBE_LIMIT; probe++, slot = (slot + 1) & FLOW_MASK) {
+    FlowEntry& cand = table[slot];
+    if (!cand.used) {
+      e = &cand;
+      break;
+    }
+    if (memcmp(&cand.key, &key, sizeof(key)) == 0) {
+      e = &cand;
+      break;
+    }
+    if ((int32_t)(cand.last_ms - table[stalest].last_ms) < 0) stalest = slot;
+  }
+
+  if (!e || !e->used) {
+    // No free slot near home: the stalest flow in the window makes room. Its
+    // slot stays occupied, so the probe chains through it stay intact.
+    if (!e) {
+      e = &table[stalest];
+      finish(*e, FLOW_END_EVICTED);
+    } else {
+      stats.live++;
+    }
+    e->key = key;
+    e->used = 1;
+    e->home = home;
+    e->retries = 0;
+    e->packets = 0;
+    e->bytes = 0;
+    e->first_ms = now;
+    rssiStatsReset(e->rssi);
+    stats.created++;
+  }
+
+  e->packets++;
+  e->bytes += f.len;
+  e->last_ms = now;
+  if ((f.flags & FC_RETRY) && e->retries < UINT16_MAX) e->retries++;
+  rssiStatsAdd(e->rssi, f.rssi, RSSI_EWMA_SHIFT_DEFAULT);
+}
+
+// ===== Sinks (loop) =====
+static inline void put16(uint8_t* p, uint16_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+static inline void put32(uint8_t* p, uint32_t v) {
+  put16(p, v);
+  put16(p + 2, v >> 16);
+}
+
+static void encode(uint8_t* p, const FlowDone& d, uint32_t seq) {
+  memset(p, 0, FLOW_RECORD_LEN);
+  put32(p, seq);
+  memcpy(p + 4, d.key.ra, 6);
+  memcpy(p + 10, d.key.ta, 6);
+  memcpy(p + 16, d.key.bssid, 6);
+  p[22] = d.key.cls;
+  p[23] = d.key.channel;
+  put32(p + 24, d.packets);
+  put32(p + 28, d.bytes);
+  put32(p + 32, d.first_ms);
+  put32(p + 36, d.last_ms);
+  put16(p + 40, d.retries);
+  p[42] = (uint8_t)d.rssi;
+  p[43] = (uint8_t)d.rssi_min;
+  p[44] = (uint8_t)d.rssi_max;
+  p[45] = d.reason;
+}
+
+static void writeBatch() {
+  if (!batch_count) return;
+  size_t len = (size_t)batch_count * FLOW_RECORD_LEN;
+  if (file.write(batch, len) == len) {
+    file.flush();
+    stats.written_bytes += len;
+  } else {
+    stats.write_failures++;
+  }
+  batch_count = 0;
+}
+
+static void printCsv(const FlowDone& d, uint32_t seq) {
+  char ra[18], ta[18], bssid[18];
+  formatMAC(d.key.ra, ra);
+  formatMAC(d.key.ta, ta);
+  formatMAC(d.key.bssid, bssid);
+  Serial.printf("flow,%lu,%u,%u,%u.%u,%s,%s,%s,%lu,%lu,%lu,%lu,%u,%d,%d,%d\n", (unsigned long)seq, d.reason,
+                d.key.channel, d.key.cls >> 4, d.key.cls & 0x0F, ra, ta, bssid, (unsigned long)d.packets,
+                (unsigned long)d.bytes, (unsigned long)d.first_ms, (unsigned long)d.last_ms, d.retries, d.rssi,
+                d.rssi_min, d.rssi_max);
+}
+
+static void emit(const FlowDone& d, unsigned long now) {
+  uint32_t seq = ++export_seq;
+  stats.written++;
+  if (sink == FLOW_SINK_SERIAL) {
+    printCsv(d, seq);
+    return;
+  }
+  if (!batch_count) batch_since = now;
+  encode(batch + batch_count * FLOW_RECORD_LEN, d, seq);
+  if (++batch_count == FLOW_WRITE_BATCH) writeBatch();
+}
+
+void flowLoop(unsigned long now) {
+  for (int i = 0; i < FLOW_EXPORT_BUDGET; i++) {
+    uint32_t tail = ring_tail;
+    if (tail == __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE)) break;
+    emit(ring[tail & (FLOW_EXPORT_RING - 1)], now);
+    __atomic_store_n(&ring_tail, tail + 1, __ATOMIC_RELEASE);
+  }
+  if (batch_count && now - batch_since >= FLOW_WRITE_MS) writeBatch();
+}
+
+// ===== Control =====
+static bool openFile() {
+  if (SD.cardType() == CARD_NONE) return false;
+  if (!SD.exists(FLOW_DIR) && !SD.mkdir(FLOW_DIR)) return false;
+
+  File old = SD.open(FLOW_PATH, FILE_READ);
+  if (old) {
+    size_t size = old.size();
+    old.close();
+    size_t keep = size < FLOW_HEADER_LEN ? 0 : size - (size - FLOW_HEADER_LEN) % FLOW_RECORD_LEN;
+    if (keep < size && truncate(FLOW_VFS_PATH, keep) != 0) return false;
+  }
+
+  file = SD.open(FLOW_PATH, FILE_APPEND);
+  if (!file) return false;
+  if (file.size() == 0) {
+    uint8_t header[FLOW_HEADER_LEN] = {};
+    put32(header, FLOW_MAGIC);
+    put16(header + 4, FLOW_VERSION);
+    put16(header + 6, FLOW_RECORD_LEN);
+    file.write(header, sizeof(header));
+  }
+  return true;
+}
+
+bool flowStart(FlowSink s) {
+  if (flow_rx >= 0) return false;
+
+  size_t bytes = sizeof(FlowEntry) * FLOW_TABLE;
+  table = (FlowEntry*)heap_caps_calloc(1, bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!table) table = (FlowEntry*)heap_caps_calloc(1, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!table) return false;
+
+  sink = s;
+  if (sink == FLOW_SINK_SD && !openFile()) {
+    heap_caps_free(table);
+    table = nullptr;
+    return false;
+  }
+
+  memset(&stats, 0, sizeof(stats));
+  sweep_cursor = 0;
+  export_seq = 0;
+  batch_count = 0;
+  ring_tail = ring_head;
+  if (sink == FLOW_SINK_SERIAL) {
+    Serial.println("flow,seq,reason,ch,class,addr1,addr2,bssid,packets,bytes,first_ms,last_ms,retries,rssi,rssi_min,"
+                   "rssi_max");
+  }
+
+  RxSubscription sub = { "flow", RX_PKT_MGMT | RX_PKT_DATA | RX_PKT_CTRL, RX_KEYS_ALL, -128, false, onFrame };
+  flow_rx = rxBusSubscribe(sub);
+  if (flow_rx < 0) {
+    if (file) file.close();
+    heap_caps_free(table);
+    table = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void flowStop() {
+  if (flow_rx < 0) return;
+  // Returns only after a frame still inside onFrame() has finished, so from
+  // here on loop() is the ring's only producer and owns the table
+  rxBusUnsubscribe(flow_rx);
+  flow_rx = -1;
+  unsigned long now = millis();
+  while (ring_tail != ring_head) flowLoop(now);
+  for (int slot = 0; slot < FLOW_TABLE; slot++) {
+    if (!table[slot].used) continue;
+    finish(table[slot], FLOW_END_FLUSH);
+    flowLoop(now);
+  }
+  writeBatch();
+  if (file) file.close();
+
+  heap_caps_free(table);
+  table = nullptr;
+  stats.live = 0;
+}
+
+bool flowActive() {
+  return flow_rx >= 0;
+}
+
+void flowSetTimeouts(unsigned long idle, unsigned long active) {
+  idle_ms = idle;
+  active_ms = active;
+}
+
+// ===== Report =====
+void flowReport() {
+  static const char* const reasons[] = { "", "idle", "active", "evicted", "flushed" };
+
+  Serial.println("\n=== FLOW RECORDS ===");
+  Serial.printf("Mode: %s | Sink: %s | Idle timeout: %lu s | Active timeout: %lu s\n", flow_rx >= 0 ? "on" : "off",
+                sink == FLOW_SINK_SD ? FLOW_PATH : "serial (CSV)", idle_ms / 1000, active_ms / 1000);
+  Serial.printf("Frames: %lu | Flows: %lu created, %lu open/%d slots\n", (unsigned long)stats.frames,
+                (unsigned long)stats.created, (unsigned long)stats.live, FLOW_TABLE);
+  Serial.print("Ended:");
+  for (int r = FLOW_END_IDLE; r <= FLOW_END_FLUSH; r++) {
+    Serial.printf(" %s %lu%s", reasons[r], (unsigned long)stats.ended[r], r < FLOW_END_FLUSH ? " |" : "");
+  }
+  Serial.printf(" | Dropped (ring full): %lu\n", (unsigned long)stats.dropped);
+
+  uint64_t pcap = stats.frame_bytes + (uint64_t)stats.frames * EPB_OVERHEAD;
+  uint64_t flows = (uint64_t)stats.written * FLOW_RECORD_LEN;
+  Serial.printf("Exported: %lu records (%llu bytes as records) | PCAPNG of the same frames: ~%llu bytes (%.2f%%)\n",
+                (unsigned long)stats.written, (unsigned long long)flows, (unsigned long long)pcap,
+                pcap ? 100.0 * flows / pcap : 0.0);
+  if (sink == FLOW_SINK_SD) {
+    Serial.printf("SD: %llu bytes written | Write failures: %lu\n", (unsigned long long)stats.written_bytes,
+                  (unsigned long)stats.write_failures);
+  }
+}
@@ -0,0 +1,70 @@
+#ifndef FLOW_H
+#define FLOW_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define FLOW_TABLE 256            // Flow slots (power of two), allocated on start
+#define FLOW_PROBE_LIMIT 8        // Slots searched before the stalest one is evicted
+#define FLOW_SWEEP_PER_FRAME 2    // Slots checked for timeouts per received frame
+#define FLOW_EXPORT_RING 64       // Finished flows waiting for loop() (power of two)
+#define FLOW_EXPORT_BUDGET 16     // Records exported per loop() pass
+#define FLOW_IDLE_MS 15000        // Default: no frame for this long ends a flow
+#define FLOW_ACTIVE_MS 120000     // Default: long flows are cut and restarted
+#define FLOW_DIR "/flows"
+#define FLOW_PATH "/flows/flows.bin"
+#define FLOW_VFS_PATH "/sd/flows/flows.bin"  // Same file through the SD mount (truncate)
+#define FLOW_MAGIC 0x4C464641u    // "AFFL"
+#define FLOW_VERSION 1
+#define FLOW_HEADER_LEN 16
+#define FLOW_RECORD_LEN 48
+#define FLOW_WRITE_BATCH 32       // Records per SD write
+#define FLOW_WRITE_MS 2000        // Write a partial batch once its oldest record is this old
+
+// ===== Flow Records =====
+// NetFlow-style aggregation of the promiscuous stream. A flow is one
+// (addr1, addr2, BSSID, frame class, channel) tuple; the class is the frame
+// type and subtype with the QoS bit folded away, so a conversation's data and
+// QoS data frames share a flow. Each flow counts frames, bytes, retries,
+// first/last time and RSSI, and is exported when it goes idle, runs past the
+// active timeout, is evicted to make room, or when flow mode stops.
+//
+// The RX callback owns the table while flow mode runs (lookups, timeouts,
+// eviction) and hands finished flows to loop() through a ring; loop() writes
+// them to the serial port as CSV lines or appends them to FLOW_PATH.
+//
+// SD file, little-endian: a 16-byte header (magic u32 | version u16 |
+// record length u16 | 8 zero bytes) written once, then 48-byte records:
+//
+//   seq u32 | addr1[6] | addr2[6] | bssid[6] | class u8 | channel u8 |
+//   packets u32 | bytes u32 | first ms u32 | last ms u32 | retries u16 |
+//   rssi i8 | rssi min i8 | rssi max i8 | reason u8 | 2 zero bytes
+//
+// Absent addresses are all zero. `seq` restarts with every flow session;
+// timestamps are uptime. A record torn by power loss is cut off when the next
+// session opens the file, so appended sessions stay aligned. CLI/flow_decode.py turns the file into CSV.
+typedef enum {
+  FLOW_SINK_SERIAL,
+  FLOW_SINK_SD,
+} FlowSink;
+
+enum FlowEndReason : uint8_t {
+  FLOW_END_IDLE = 1,
+  FLOW_END_ACTIVE,
+  FLOW_END_EVICTED,
+  FLOW_END_FLUSH,  // Flow mode stopped
+};
+
+// ===== Public API =====
+bool flowStart(FlowSink sink);
+// Unsubscribes, exports every open flow and closes the sink
+void flowStop();
+bool flowActive();
+
+// Exports finished flows (loop)
+void flowLoop(unsigned long now);
+
+void flowSetTimeouts(unsigned long idle_ms, unsigned long active_ms);
+void flowReport();
+
+#endif  // FLOW_H
@@ -0,0 +1,151 @@
+#ifndef FRAME_VIEW_H
+#define FRAME_VIEW_H
+
+// Also builds on the host (WIDS replay tool), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#endif
+
+// ===== Frame Keys =====
+// type (2 bits) and subtype (4 bits) of the frame control field as one
+// 0-63 index, used by the dispatch tables
+#define FRAME_KEYS 64
+#define FRAME_KEY(type, subtype) ((uint8_t)(((type) << 4) | (subtype)))
+#define FRAME_BIT(type, subtype) (1ULL << FRAME_KEY(type, subtype))
+#define FRAME_BITS_OF_TYPE(type) (0xFFFFULL << ((type) << 4))
+
+// Frame control, second byte
+#define FC_TO_DS 0x01
+#define FC_FROM_DS 0x02
+#define FC_RETRY 0x08
+#define FC_PROTECTED 0x40
+#define FC_ORDER 0x80
+
+// ===== Frame View =====
+// One decode per received frame. Addresses are resolved by the DS bits, so
+// `sa`/`da` are the real source and destination and `bssid` is the BSS the
+// frame belongs to (nullptr for 4-address WDS/mesh frames). `ta`/`ra` are the
+// radio transmitter and receiver: the wireless endpoints of this hop.
+// Pointers into the payload are only valid inside the RX callback.
+typedef struct {
+  const uint8_t* frame;
+  uint16_t len;
+  uint8_t type;
+  uint8_t subtype;
+  uint8_t key;       // FRAME_KEY(type, subtype)
+  uint8_t flags;     // Frame control byte 1 (FC_*)
+  uint8_t hdr_len;   // MAC header bytes, body starts here
+  uint16_t seq;      // Sequence number (0 for control frames)
+  const uint8_t* ra;
+  const uint8_t* ta;     // nullptr for ACK/CTS
+  const uint8_t* da;
+  const uint8_t* sa;
+  const uint8_t* bssid;  // nullptr if the frame names none
+  const uint8_t* body;
+  uint16_t body_len;
+  int8_t rssi;       // Normalized dBm
+  uint8_t channel;   // Tuned channel when received
+} FrameView;
+
+// Decodes the MAC header; false if the frame is too short for its type
+static inline bool frameDecode(const uint8_t* frame, uint16_t len, int8_t rssi, uint8_t channel, FrameView* f) {
+  if (len < 10) return false;
+
+  f->frame = frame;
+  f->len = len;
+  f->type = (frame[0] & 0x0C) >> 2;
+  f->subtype = (frame[0] & 0xF0) >> 4;
+  f->key = FRAME_KEY(f->type, f->subtype);
+  f->flags = frame[1];
+  f->rssi = rssi;
+  f->channel = channel;
+  f->ra = frame + 4;
+  f->ta = nullptr;
+  f->da = f->ra;
+  f->sa = nullptr;
+  f->bssid = nullptr;
+  f->seq = 0;
+
+  if (f->type == 0x01) {  // Control: RA (+ TA for RTS, PS-Poll, BAR, BA ...)
+    f->hdr_len = len >= 16 ? 16 : 10;
+    if (f->hdr_len == 16) f->ta = f->sa = frame + 10;
+  } else {
+    if (len < 24) return false;
+    const uint8_t* a2 = frame + 10;
+    const uint8_t* a3 = frame + 16;
+    f->ta = a2;
+    f->seq = (frame[22] | (frame[23] << 8)) >> 4;
+    f->hdr_len = 24;
+
+    switch (f->flags & (FC_TO_DS | FC_FROM_DS)) {
+      case 0:  // Management, IBSS and direct data
+        f->sa = a2;
+        f->bssid = a3;
+        break;
+      case FC_TO_DS:  // Station to AP
+        f->bssid = f->ra;
+        f->sa = a2;
+        f->da = a3;
+        break;
+      case FC_FROM_DS:  // AP to station
+        f->bssid = a2;
+        f->sa = a3;
+        break;
+      default:  // WDS / mesh: addr4 is the source
+        if (len < 30) return false;
+        f->da = a3;
+        f->sa = frame + 24;
+        f->hdr_len = 30;
+        break;
+    }
+
+    // QoS data adds a control field, +HTC when Order is set on QoS frames
+    if (f->type == 0x02 && (f->subtype & 0x08)) {
+      f->hdr_len += 2;
+      if (f->flags & FC_ORDER) f->hdr_len += 4;
+    }
+    if (len < f->hdr_len) return false;
+  }
+
+  f->body = frame + f->hdr_len;
+  f->body_len = len - f->hdr_len;
+  return true;
+}
+
+// ===== Dispatch Tables =====
+// Analyzers register the frame keys they want; the table maps each of the 64
+// keys to a bitmask of registered analyzers, built entirely at compile time,
+// so dispatch is one table load and a call per interested analyzer.
+#define FRAME_MAX_ANALYZERS 8  // Bits in a dispatch entry
+
+typedef void (*FrameAnalyzer)(const FrameView& f);
+
+typedef struct {
+  uint64_t keys;  // FRAME_BIT()s the analyzer handles
+  FrameAnalyzer fn;
+} AnalyzerReg;
+
+template <size_t N>
+constexpr uint8_t analyzerMask(const AnalyzerReg (&regs)[N], int key, size_t i = 0) {
+  return i == N ? 0 : (uint8_t)((((regs[i].keys >> key) & 1) << i) | analyzerMask(regs, key, i + 1));
+}
+
+#define DISPATCH_ROW4(regs, k) \
+  analyzerMask(regs, k), analyzerMask(regs, k + 1), analyzerMask(regs, k + 2), analyzerMask(regs, k + 3)
+#define DISPATCH_ROW16(regs, k) \
+  DISPATCH_ROW4(regs, k), DISPATCH_ROW4(regs, k + 4), DISPATCH_ROW4(regs, k + 8), DISPATCH_ROW4(regs, k + 12)
+#define DISPATCH_TABLE(regs) \
+  { DISPATCH_ROW16(regs, 0), DISPATCH_ROW16(regs, 16), DISPATCH_ROW16(regs, 32), DISPATCH_ROW16(regs, 48) }
+
+// Runs every analyzer registered for the frame's key, in registration order
+static inline void frameDispatch(const uint8_t* table, const AnalyzerReg* regs, const FrameView& f) {
+  for (uint8_t mask = table[f.key]; mask; mask &= mask - 1) {
+    regs[__builtin_ctz(mask)].fn(f);
+  }
+}
+
+#endif  // FRAME_VIEW_H
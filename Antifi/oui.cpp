@@ -0,0 +1,36 @@
+#include "oui.h"
+#include "oui_db.h"
+
+int ouiLookup(const uint8_t* mac) {
+  if (!mac) return OUI_NOT_FOUND;
+
+  uint32_t key = ((uint32_t)mac[0] << 16) | ((uint32_t)mac[1] << 8) | mac[2];
+
+  // Binary search over the sorted key table
+  int lo = 0;
+  int hi = OUI_DB_ENTRIES - 1;
+  while (lo <= hi) {
+    int mid = lo + ((hi - lo) >> 1);
+    uint32_t probe = oui_db_keys[mid];
+    if (probe == key) return mid;
+    if (probe < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return OUI_NOT_FOUND;
+}
+
+const char* ouiVendorName(int index) {
+  if (index < 0 || index >= OUI_DB_ENTRIES) return "Unknown";
+  return &oui_db_names[oui_db_name_offsets[index]];
+}
+
+const char* ouiVendor(const uint8_t* mac) {
+  return ouiVendorName(ouiLookup(mac));
+}
+
+int ouiTableSize() {
+  return OUI_DB_ENTRIES;
+}
@@ -0,0 +1,26 @@
+#ifndef OUI_H
+#define OUI_H
+
+// Also builds on the host (CLI/oui_bench.cpp), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#endif
+
+#define OUI_NOT_FOUND -1
+
+// Index of the MAC's OUI in the vendor table, or OUI_NOT_FOUND
+int ouiLookup(const uint8_t* mac);
+
+// Vendor name for a table index; "Unknown" for OUI_NOT_FOUND.
+// The returned string lives in flash and never needs to be freed.
+const char* ouiVendorName(int index);
+
+// Convenience wrapper: ouiVendorName(ouiLookup(mac))
+const char* ouiVendor(const uint8_t* mac);
+
+// Number of OUIs compiled into the firmware
+int ouiTableSize();
+
+#endif  // OUI_H
@@ -0,0 +1,3944 @@
+// Generated by CLI/gen_oui_db.py from data/oui.csv -- do not edit.
+// Vendors with >= 3 MA-L blocks: 15877 of 34742 registry OUIs
+// Flash cost: 15877 OUIs, 612 vendors, 63508 B keys + 31754 B offsets + 10721 B names = 105983 B
+#ifndef OUI_DB_H
+#define OUI_DB_H
+
+#include <stdint.h>
+
+#define OUI_DB_ENTRIES 15877
+
+// Sorted 24-bit OUIs (searched with binary search)
+static constexpr uint32_t oui_db_keys[OUI_DB_ENTRIES] = {
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x00000C, 0x00000E, 0x000017, 0x00001D, 0x00001F, 0x000048,
+  0x00004C, 0x00005F, 0x000060, 0x000064, 0x00006C, 0x00006F, 0x000074, 0x000075,
+  0x00007D, 0x000085, 0x000088, 0x000097, 0x0000A5, 0x0000A8, 0x0000AA, 0x0000B4,
+  0x0000BC, 0x0000C1, 0x0000C3, 0x0000C5, 0x0000C9, 0x0000CA, 0x0000D2, 0x0000F0,
+  0x0000F4, 0x0000F8, 0x000101, 0x000102, 0x000103, 0x00010F, 0x000130, 0x000131,
+  0x000136, 0x000142, 0x000143, 0x000144, 0x000147, 0x00014A, 0x00014F, 0x00015D,
+  0x000163, 0x000164, 0x000181, 0x000196, 0x000197, 0x0001AF, 0x0001C7, 0x0001C9,
+  0x0001D7, 0x0001E3, 0x0001E6, 0x0001E7, 0x0001F4, 0x0001FE, 0x00020E, 0x000216,
+  0x000217, 0x00023B, 0x00023D, 0x00024A, 0x00024B, 0x000252, 0x000255, 0x00025F,
+  0x000271, 0x000276, 0x000278, 0x00027D, 0x00027E, 0x000281, 0x00029C, 0x0002A5,
+  0x0002B3, 0x0002B9, 0x0002BA, 0x0002C7, 0x0002C9, 0x0002EE, 0x0002FC, 0x0002FD,
+  0x000327, 0x000331, 0x000332, 0x000342, 0x000347, 0x00034B, 0x00036B, 0x00036C,
+  0x000378, 0x00037F, 0x000389, 0x000391, 0x000393, 0x00039D, 0x00039F, 0x0003A0,
+  0x0003BA, 0x0003C9, 0x0003E0, 0x0003E3, 0x0003E4, 0x0003FD, 0x0003FE, 0x0003FF,
+  0x000400, 0x00040B, 0x00040D, 0x00040E, 0x00041F, 0x000423, 0x000427, 0x000428,
+  0x000438, 0x00044B, 0x00044D, 0x00044E, 0x000456, 0x000463, 0x00046D, 0x00046E,
+  0x000475, 0x000476, 0x00047D, 0x000480, 0x000494, 0x000496, 0x00049A, 0x00049B,
+  0x0004A3, 0x0004AC, 0x0004BD, 0x0004C0, 0x0004C1, 0x0004CF, 0x0004DC, 0x0004DD,
+  0x0004DE, 0x0004DF, 0x0004E2, 0x0004E3, 0x0004EA, 0x0004FC, 0x000500, 0x000501,
+  0x000502, 0x000512, 0x00051A, 0x00051E, 0x000531, 0x000532, 0x000533, 0x00053C,
+  0x00054F, 0x00055E, 0x00055F, 0x000569, 0x000573, 0x000574, 0x000578, 0x00057A,
+  0x000585, 0x00058E, 0x000594, 0x00059A, 0x00059B, 0x0005C9, 0x0005CD, 0x0005DC,
+  0x0005DD, 0x0005F7, 0x00060B, 0x000628, 0x000629, 0x00062A, 0x000631, 0x000652,
+  0x000653, 0x00065B, 0x00065F, 0x00066E, 0x000678, 0x00067C, 0x00068C, 0x0006B1,
+  0x0006C1, 0x0006D6, 0x0006D7, 0x0006EC, 0x0006F5, 0x0006F6, 0x0006F7, 0x000701,
+  0x000704, 0x00070D, 0x00070E, 0x00071C, 0x000726, 0x000740, 0x00074D, 0x00074F,
+  0x000750, 0x000772, 0x00077D, 0x000782, 0x000784, 0x000785, 0x000795, 0x0007AB,
+  0x0007AF, 0x0007B3, 0x0007B4, 0x0007C1, 0x0007C3, 0x0007CB, 0x0007D8, 0x0007E9,
+  0x0007EB, 0x0007EC, 0x000802, 0x00080D, 0x00080E, 0x000820, 0x000821, 0x000827,
+  0x00082F, 0x000830, 0x000831, 0x000832, 0x000874, 0x00087C, 0x00087D, 0x000883,
+  0x000889, 0x00089F, 0x0008A3, 0x0008A4, 0x0008B9, 0x0008C2, 0x0008C7, 0x0008E2,
+  0x0008E3, 0x0008F6, 0x0008F9, 0x00090F, 0x000911, 0x000912, 0x00092D, 0x00093A,
+  0x000941, 0x000943, 0x000944, 0x00095B, 0x00096B, 0x00097B, 0x00097C, 0x000993,
+  0x000997, 0x0009B6, 0x0009B7, 0x0009BF, 0x0009DF, 0x0009E1, 0x0009E8, 0x0009E9,
+  0x000A04, 0x000A08, 0x000A25, 0x000A27, 0x000A30, 0x000A33, 0x000A41, 0x000A42,
+  0x000A49, 0x000A57, 0x000A5E, 0x000A6E, 0x000A73, 0x000A8A, 0x000A8B, 0x000A95,
+  0x000AB7, 0x000AB8, 0x000AC6, 0x000AD9, 0x000ADC, 0x000AE4, 0x000AE6, 0x000AEB,
+  0x000AED, 0x000AF3, 0x000AF4, 0x000AF7, 0x000B06, 0x000B16, 0x000B18, 0x000B23,
+  0x000B2E, 0x000B3B, 0x000B45, 0x000B46, 0x000B4E, 0x000B4F, 0x000B57, 0x000B5D,
+  0x000B5F, 0x000B60, 0x000B6A, 0x000B6B, 0x000B82, 0x000B85, 0x000B86, 0x000B90,
+  0x000BA2, 0x000BA3, 0x000BAB, 0x000BAC, 0x000BBA, 0x000BBE, 0x000BBF, 0x000BC5,
+  0x000BCD, 0x000BDB, 0x000BF4, 0x000BFC, 0x000BFD, 0x000C02, 0x000C0D, 0x000C29,
+  0x000C30, 0x000C31, 0x000C41, 0x000C42, 0x000C50, 0x000C53, 0x000C63, 0x000C6E,
+  0x000C76, 0x000C85, 0x000C86, 0x000C8A, 0x000CC1, 0x000CCE, 0x000CCF, 0x000CDB,
+  0x000CE5, 0x000CE6, 0x000CF1, 0x000CF7, 0x000CF8, 0x000D02, 0x000D0B, 0x000D28,
+  0x000D29, 0x000D2C, 0x000D39, 0x000D3A, 0x000D4B, 0x000D54, 0x000D56, 0x000D58,
+  0x000D60, 0x000D65, 0x000D66, 0x000D67, 0x000D72, 0x000D87, 0x000D88, 0x000D92,
+  0x000D93, 0x000D9D, 0x000DA7, 0x000DB6, 0x000DBC, 0x000DBD, 0x000DC2, 0x000DD4,
+  0x000DEC, 0x000DED, 0x000DF2, 0x000E03, 0x000E07, 0x000E08, 0x000E0C, 0x000E17,
+  0x000E1E, 0x000E22, 0x000E2E, 0x000E2F, 0x000E35, 0x000E38, 0x000E39, 0x000E40,
+  0x000E50, 0x000E58, 0x000E59, 0x000E5C, 0x000E5E, 0x000E62, 0x000E6A, 0x000E6D,
+  0x000E7B, 0x000E7F, 0x000E83, 0x000E84, 0x000E8C, 0x000E8F, 0x000EA4, 0x000EA6,
+  0x000EB3, 0x000EB6, 0x000EC0, 0x000ED6, 0x000ED7, 0x000EE8, 0x000EED, 0x000EEF,
+  0x000F06, 0x000F09, 0x000F15, 0x000F1F, 0x000F20, 0x000F21, 0x000F23, 0x000F24,
+  0x000F2C, 0x000F34, 0x000F35, 0x000F3D, 0x000F4B, 0x000F5D, 0x000F61, 0x000F66,
+  0x000F6A, 0x000F7D, 0x000F86, 0x000F8F, 0x000F90, 0x000F93, 0x000F94, 0x000F96,
+  0x000F9F, 0x000FA3, 0x000FB3, 0x000FB5, 0x000FBD, 0x000FCB, 0x000FCC, 0x000FCD,
+  0x000FDB, 0x000FDE, 0x000FE2, 0x000FE4, 0x000FEA, 0x000FF7, 0x000FF8, 0x001007,
+  0x00100B, 0x00100D, 0x001011, 0x001014, 0x001018, 0x00101F, 0x001029, 0x00102F,
+  0x001035, 0x001045, 0x00104B, 0x00104F, 0x001054, 0x00105A, 0x001067, 0x001079,
+  0x00107B, 0x001083, 0x001095, 0x00109B, 0x0010A4, 0x0010A6, 0x0010B5, 0x0010C1,
+  0x0010C6, 0x0010CA, 0x0010DB, 0x0010DC, 0x0010E0, 0x0010E3, 0x0010E7, 0x0010F6,
+  0x0010FA, 0x0010FE, 0x0010FF, 0x001105, 0x00110A, 0x001111, 0x00111A, 0x001120,
+  0x001121, 0x001124, 0x001125, 0x00112F, 0x001143, 0x001157, 0x001158, 0x00115B,
+  0x00115C, 0x00115D, 0x001165, 0x00116E, 0x001174, 0x001175, 0x001180, 0x001185,
+  0x001188, 0x00118B, 0x001192, 0x001193, 0x001195, 0x00119F, 0x0011A9, 0x0011AE,
+  0x0011BB, 0x0011BC, 0x0011C6, 0x0011D8, 0x0011E3, 0x0011E6, 0x0011F5, 0x0011F9,
+  0x0011FC, 0x001200, 0x001201, 0x00120E, 0x001217, 0x00121C, 0x00121E, 0x001225,
+  0x00122A, 0x001237, 0x00123F, 0x001243, 0x001244, 0x001247, 0x001248, 0x00124B,
+  0x00125A, 0x001262, 0x001279, 0x00127F, 0x001280, 0x001283, 0x001288, 0x00128A,
+  0x0012A9, 0x0012BF, 0x0012C1, 0x0012C9, 0x0012CF, 0x0012D1, 0x0012D2, 0x0012D9,
+  0x0012DA, 0x0012EE, 0x0012F0, 0x0012F2, 0x0012F3, 0x0012FB, 0x0012FE, 0x001302,
+  0x00130A, 0x001310, 0x001311, 0x001315, 0x001317, 0x001319, 0x00131A, 0x001320,
+  0x001321, 0x001345, 0x001346, 0x001347, 0x001349, 0x00135F, 0x001360, 0x001365,
+  0x001370, 0x001371, 0x001372, 0x001374, 0x001377, 0x00137F, 0x001380, 0x00138F,
+  0x001392, 0x001397, 0x0013A3, 0x0013A9, 0x0013C3, 0x0013C4, 0x0013C8, 0x0013CD,
+  0x0013CE, 0x0013D3, 0x0013D4, 0x0013D5, 0x0013E0, 0x0013E8, 0x0013F7, 0x0013FD,
+  0x001404, 0x00140D, 0x00140E, 0x00141B, 0x00141C, 0x001422, 0x00142A, 0x001438,
+  0x001449, 0x00144F, 0x001451, 0x001457, 0x00145E, 0x001469, 0x00146A, 0x00146C,
+  0x001478, 0x00147C, 0x00147F, 0x00148C, 0x001495, 0x00149A, 0x0014A4, 0x0014A5,
+  0x0014A7, 0x0014A8, 0x0014A9, 0x0014BF, 0x0014C2, 0x0014C3, 0x0014C7, 0x0014C9,
+  0x0014D1, 0x0014E8, 0x0014F1, 0x0014F2, 0x0014F6, 0x0014F8, 0x001500, 0x001505,
+  0x00150C, 0x001517, 0x00152A, 0x00152B, 0x00152C, 0x00152F, 0x001530, 0x001540,
+  0x001556, 0x00155D, 0x001560, 0x001562, 0x001563, 0x00156D, 0x001570, 0x001577,
+  0x001596, 0x001599, 0x00159A, 0x00159B, 0x0015A0, 0x0015A2, 0x0015A3, 0x0015A4,
+  0x0015A8, 0x0015AF, 0x0015B7, 0x0015B9, 0x0015C1, 0x0015C5, 0x0015C6, 0x0015C7,
+  0x0015CE, 0x0015CF, 0x0015D0, 0x0015D1, 0x0015DE, 0x0015E0, 0x0015E8, 0x0015E9,
+  0x0015EB, 0x0015F2, 0x0015F9, 0x0015FA, 0x0015FF, 0x001601, 0x001620, 0x001626,
+  0x001632, 0x001635, 0x001636, 0x001638, 0x00163B, 0x001641, 0x001646, 0x001647,
+  0x00164D, 0x00164E, 0x001656, 0x001660, 0x00166B, 0x00166C, 0x00166D, 0x00166F,
+  0x001675, 0x001676, 0x00168F, 0x001692, 0x001697, 0x00169C, 0x00169D, 0x0016B4,
+  0x0016B5, 0x0016B6, 0x0016B8, 0x0016B9, 0x0016BC, 0x0016C7, 0x0016C8, 0x0016CA,
+  0x0016CB, 0x0016CE, 0x0016CF, 0x0016D3, 0x0016DB, 0x0016E0, 0x0016E3, 0x0016E6,
+  0x0016EA, 0x0016EB, 0x0016EC, 0x0016F0, 0x0016F6, 0x0016FA, 0x0016FB, 0x0016FE,
+  0x001700, 0x001708, 0x00170E, 0x00170F, 0x001710, 0x001731, 0x001733, 0x00173B,
+  0x00173F, 0x001742, 0x00174B, 0x001753, 0x001759, 0x00175A, 0x00175C, 0x001761,
+  0x001765, 0x00176F, 0x001783, 0x001784, 0x001794, 0x001795, 0x00179A, 0x0017A4,
+  0x0017AB, 0x0017B0, 0x0017C2, 0x0017C8, 0x0017C9, 0x0017CA, 0x0017CB, 0x0017CC,
+  0x0017D1, 0x0017D5, 0x0017DF, 0x0017E0, 0x0017E2, 0x0017E3, 0x0017E4, 0x0017E5,
+  0x0017E6, 0x0017E7, 0x0017E8, 0x0017E9, 0x0017EA, 0x0017EB, 0x0017EC, 0x0017EE,
+  0x0017EF, 0x0017F2, 0x0017F3, 0x0017FA, 0x001801, 0x001802, 0x001809, 0x00180A,
+  0x00180C, 0x00180F, 0x001813, 0x001818, 0x001819, 0x001823, 0x001825, 0x00182F,
+  0x001830, 0x001831, 0x001832, 0x001833, 0x001834, 0x001839, 0x00183A, 0x00183F,
+  0x001842, 0x00184D, 0x001862, 0x001864, 0x001868, 0x00186E, 0x001871, 0x001873,
+  0x001874, 0x001882, 0x001885, 0x00188B, 0x00188D, 0x00189B, 0x0018A4, 0x0018AF,
+  0x0018B0, 0x0018B1, 0x0018B9, 0x0018BA, 0x0018C0, 0x0018C5, 0x0018D1, 0x0018DE,
+  0x0018F3, 0x0018F6, 0x0018F8, 0x0018FE, 0x001906, 0x001907, 0x001915, 0x00191D,
+  0x001921, 0x00192C, 0x00192D, 0x00192F, 0x001930, 0x00193E, 0x001947, 0x00194B,
+  0x00194F, 0x001955, 0x001956, 0x00195B, 0x00195E, 0x001963, 0x001966, 0x001969,
+  0x001977, 0x001979, 0x00197D, 0x00197E, 0x00197F, 0x001987, 0x001992, 0x001999,
+  0x00199D, 0x0019A6, 0x0019A9, 0x0019AA, 0x0019B7, 0x0019B9, 0x0019BB, 0x0019C0,
+  0x0019C1, 0x0019C5, 0x0019C6, 0x0019C7, 0x0019CB, 0x0019D1, 0x0019D2, 0x0019DB,
+  0x0019DF, 0x0019E0, 0x0019E1, 0x0019E2, 0x0019E3, 0x0019E4, 0x0019E7, 0x0019E8,
+  0x0019F0, 0x0019FB, 0x0019FD, 0x001A11, 0x001A16, 0x001A1B, 0x001A1E, 0x001A29,
+  0x001A2A, 0x001A2F, 0x001A30, 0x001A34, 0x001A37, 0x001A3F, 0x001A45, 0x001A4B,
+  0x001A4D, 0x001A4F, 0x001A64, 0x001A66, 0x001A6B, 0x001A6C, 0x001A6D, 0x001A70,
+  0x001A73, 0x001A75, 0x001A77, 0x001A80, 0x001A89, 0x001A8A, 0x001A8C, 0x001A8F,
+  0x001A92, 0x001A9A, 0x001AA0, 0x001AA1, 0x001AA2, 0x001AA9, 0x001AAD, 0x001AB6,
+  0x001AC1, 0x001AC3, 0x001AC4, 0x001AC5, 0x001ADB, 0x001ADC, 0x001ADE, 0x001AE2,
+  0x001AE3, 0x001AE9, 0x001AEB, 0x001AF0, 0x001AF4, 0x001B0C, 0x001B0D, 0x001B11,
+  0x001B17, 0x001B1B, 0x001B21, 0x001B24, 0x001B25, 0x001B2A, 0x001B2B, 0x001B2F,
+  0x001B32, 0x001B33, 0x001B38, 0x001B3F, 0x001B4F, 0x001B52, 0x001B53, 0x001B54,
+  0x001B59, 0x001B5B, 0x001B63, 0x001B67, 0x001B6E, 0x001B77, 0x001B78, 0x001B7A,
+  0x001B8B, 0x001B8F, 0x001B90, 0x001B98, 0x001B9E, 0x001BA9, 0x001BAF, 0x001BB1,
+  0x001BB9, 0x001BBA, 0x001BBF, 0x001BC0, 0x001BD3, 0x001BD4, 0x001BD5, 0x001BD7,
+  0x001BDD, 0x001BE9, 0x001BEA, 0x001BED, 0x001BEE, 0x001BFB, 0x001BFC, 0x001C0E,
+  0x001C0F, 0x001C10, 0x001C11, 0x001C12, 0x001C14, 0x001C17, 0x001C23, 0x001C25,
+  0x001C26, 0x001C2E, 0x001C35, 0x001C43, 0x001C44, 0x001C4A, 0x001C50, 0x001C54,
+  0x001C57, 0x001C58, 0x001C62, 0x001C64, 0x001C73, 0x001C7B, 0x001C7E, 0x001C7F,
+  0x001C8E, 0x001C9A, 0x001C9C, 0x001CA2, 0x001CA4, 0x001CA8, 0x001CB0, 0x001CB1,
+  0x001CB3, 0x001CBE, 0x001CBF, 0x001CC0, 0x001CC1, 0x001CC3, 0x001CC4, 0x001CC5,
+  0x001CCC, 0x001CD4, 0x001CD6, 0x001CD7, 0x001CDF, 0x001CEA, 0x001CEB, 0x001CEE,
+  0x001CEF, 0x001CF0, 0x001CF6, 0x001CF9, 0x001CFA, 0x001CFB, 0x001CFC, 0x001CFD,
+  0x001D08, 0x001D09, 0x001D0D, 0x001D0F, 0x001D16, 0x001D19, 0x001D20, 0x001D25,
+  0x001D28, 0x001D2E, 0x001D38, 0x001D3B, 0x001D42, 0x001D45, 0x001D46, 0x001D4C,
+  0x001D4F, 0x001D5A, 0x001D60, 0x001D68, 0x001D6A, 0x001D6B, 0x001D6E, 0x001D70,
+  0x001D71, 0x001D72, 0x001D73, 0x001D7D, 0x001D7E, 0x001D82, 0x001D8B, 0x001D92,
+  0x001D98, 0x001D9C, 0x001DA1, 0x001DA2, 0x001DAA, 0x001DAF, 0x001DB3, 0x001DB5,
+  0x001DBA, 0x001DBC, 0x001DBE, 0x001DCD, 0x001DCE, 0x001DCF, 0x001DD0, 0x001DD1,
+  0x001DD2, 0x001DD3, 0x001DD4, 0x001DD5, 0x001DD6, 0x001DD8, 0x001DD9, 0x001DDF,
+  0x001DE0, 0x001DE1, 0x001DE5, 0x001DE6, 0x001DE9, 0x001DF6, 0x001DFA, 0x001DFD,
+  0x001E0B, 0x001E10, 0x001E13, 0x001E14, 0x001E1F, 0x001E21, 0x001E2A, 0x001E31,
+  0x001E33, 0x001E35, 0x001E37, 0x001E3A, 0x001E3B, 0x001E3D, 0x001E40, 0x001E45,
+  0x001E46, 0x001E49, 0x001E4A, 0x001E4C, 0x001E4F, 0x001E52, 0x001E58, 0x001E5A,
+  0x001E64, 0x001E65, 0x001E67, 0x001E68, 0x001E69, 0x001E6B, 0x001E73, 0x001E74,
+  0x001E75, 0x001E76, 0x001E79, 0x001E7A, 0x001E7D, 0x001E7E, 0x001E80, 0x001E8C,
+  0x001E8D, 0x001E8F, 0x001E90, 0x001EA3, 0x001EA4, 0x001EA7, 0x001EA9, 0x001EAE,
+  0x001EB2, 0x001EBD, 0x001EBE, 0x001EC0, 0x001EC1, 0x001EC2, 0x001EC7, 0x001EC9,
+  0x001ECA, 0x001EDC, 0x001EE1, 0x001EE2, 0x001EE5, 0x001EEC, 0x001EF6, 0x001EF7,
+  0x001F00, 0x001F01, 0x001F0A, 0x001F12, 0x001F16, 0x001F1F, 0x001F26, 0x001F27,
+  0x001F28, 0x001F29, 0x001F32, 0x001F33, 0x001F3A, 0x001F3B, 0x001F3C, 0x001F3F,
+  0x001F41, 0x001F45, 0x001F46, 0x001F47, 0x001F5B, 0x001F5C, 0x001F5D, 0x001F67,
+  0x001F6B, 0x001F6C, 0x001F6D, 0x001F7E, 0x001F82, 0x001F90, 0x001F92, 0x001F95,
+  0x001F9A, 0x001F9D, 0x001F9E, 0x001F9F, 0x001FA4, 0x001FA7, 0x001FB3, 0x001FC4,
+  0x001FC5, 0x001FC6, 0x001FC9, 0x001FCA, 0x001FCC, 0x001FCD, 0x001FD0, 0x001FDA,
+  0x001FDE, 0x001FDF, 0x001FE1, 0x001FE2, 0x001FE3, 0x001FE4, 0x001FF3, 0x001FFE,
+  0x002000, 0x002031, 0x002035, 0x002037, 0x002040, 0x002048, 0x002051, 0x002054,
+  0x002067, 0x00206B, 0x00207B, 0x002085, 0x00208F, 0x0020A3, 0x0020AF, 0x0020B3,
+  0x0020C5, 0x0020D4, 0x0020D6, 0x0020D8, 0x0020DA, 0x0020E0, 0x0020ED, 0x0020F2,
+  0x002100, 0x002104, 0x002105, 0x002108, 0x002109, 0x002119, 0x00211B, 0x00211C,
+  0x00211E, 0x002127, 0x002128, 0x002129, 0x002136, 0x002143, 0x002147, 0x00214C,
+  0x00214F, 0x002155, 0x002156, 0x002159, 0x00215A, 0x00215C, 0x00215D, 0x00215E,
+  0x002162, 0x002163, 0x00216A, 0x00216B, 0x002170, 0x00217C, 0x002180, 0x002185,
+  0x002186, 0x002191, 0x002194, 0x002197, 0x00219B, 0x00219E, 0x0021A0, 0x0021A1,
+  0x0021AA, 0x0021AB, 0x0021B7, 0x0021BA, 0x0021BD, 0x0021BE, 0x0021CC, 0x0021D1,
+  0x0021D2, 0x0021D7, 0x0021D8, 0x0021E1, 0x0021E8, 0x0021E9, 0x0021F6, 0x0021F7,
+  0x0021FB, 0x0021FC, 0x0021FE, 0x002200, 0x002207, 0x00220C, 0x00220D, 0x002210,
+  0x002215, 0x002219, 0x00221C, 0x00222D, 0x002233, 0x00223A, 0x00223F, 0x002241,
+  0x002243, 0x002248, 0x00224C, 0x002255, 0x002256, 0x002257, 0x00225F, 0x002264,
+  0x002265, 0x002266, 0x002267, 0x002268, 0x002269, 0x00226A, 0x00226B, 0x002275,
+  0x00227F, 0x002283, 0x002290, 0x002291, 0x002293, 0x002294, 0x002298, 0x0022A0,
+  0x0022A4, 0x0022A5, 0x0022A9, 0x0022AA, 0x0022B0, 0x0022B4, 0x0022BD, 0x0022BE,
+  0x0022CE, 0x0022CF, 0x0022D0, 0x0022D7, 0x0022F1, 0x0022F3, 0x0022F4, 0x0022FA,
+  0x0022FB, 0x0022FC, 0x0022FD, 0x002304, 0x002305, 0x002306, 0x002308, 0x00230B,
+  0x00230D, 0x002312, 0x002314, 0x002315, 0x002318, 0x002326, 0x002331, 0x002332,
+  0x002333, 0x002334, 0x002339, 0x00233A, 0x00233E, 0x002345, 0x002347, 0x002348,
+  0x00234A, 0x00234D, 0x00234E, 0x002351, 0x002354, 0x00235A, 0x00235D, 0x00235E,
+  0x002368, 0x002369, 0x00236A, 0x00236C, 0x002374, 0x002375, 0x002376, 0x002378,
+  0x00237A, 0x00237D, 0x00237F, 0x002389, 0x00238A, 0x00238B, 0x00238C, 0x00238E,
+  0x002395, 0x002397, 0x002399, 0x00239C, 0x0023A2, 0x0023A3, 0x0023A7, 0x0023AB,
+  0x0023AC, 0x0023AE, 0x0023AF, 0x0023B4, 0x0023B8, 0x0023BE, 0x0023CC, 0x0023CD,
+  0x0023D4, 0x0023D6, 0x0023D7, 0x0023DF, 0x0023E9, 0x0023EA, 0x0023EB, 0x0023ED,
+  0x0023EE, 0x0023F1, 0x0023F7, 0x0023F8, 0x002400, 0x002401, 0x002403, 0x002404,
+  0x002413, 0x002414, 0x002417, 0x002419, 0x00241D, 0x00241E, 0x002421, 0x00242B,
+  0x00242C, 0x002433, 0x002436, 0x002438, 0x002443, 0x002444, 0x002445, 0x002450,
+  0x002451, 0x002454, 0x002456, 0x002465, 0x002468, 0x00246C, 0x002473, 0x00247B,
+  0x00247C, 0x00247D, 0x00247E, 0x00247F, 0x002481, 0x002482, 0x002483, 0x00248C,
+  0x00248D, 0x002490, 0x002491, 0x002493, 0x002495, 0x002497, 0x002498, 0x0024A0,
+  0x0024A1, 0x0024A5, 0x0024A8, 0x0024AF, 0x0024B2, 0x0024B5, 0x0024B6, 0x0024BA,
+  0x0024BE, 0x0024C1, 0x0024C3, 0x0024C4, 0x0024D1, 0x0024D2, 0x0024D4, 0x0024D6,
+  0x0024D7, 0x0024DC, 0x0024E8, 0x0024E9, 0x0024EF, 0x0024F3, 0x0024F7, 0x0024F9,
+  0x0024FB, 0x0024FE, 0x0024FF, 0x002500, 0x002503, 0x002511, 0x002512, 0x002515,
+  0x002522, 0x00252E, 0x002536, 0x002538, 0x00253C, 0x002545, 0x002546, 0x002547,
+  0x002548, 0x00254B, 0x002550, 0x002553, 0x002556, 0x002557, 0x00255C, 0x002561,
+  0x002564, 0x002566, 0x002567, 0x002568, 0x002569, 0x002583, 0x002584, 0x002586,
+  0x00258B, 0x002590, 0x00259C, 0x00259D, 0x00259E, 0x0025A0, 0x0025AE, 0x0025B3,
+  0x0025B4, 0x0025B5, 0x0025BA, 0x0025BC, 0x0025C4, 0x0025CA, 0x0025CF, 0x0025D0,
+  0x0025D3, 0x0025D4, 0x0025DC, 0x0025E5, 0x0025E7, 0x0025F1, 0x0025F2, 0x002608,
+  0x00260A, 0x00260B, 0x002615, 0x002618, 0x002622, 0x002624, 0x00262D, 0x002636,
+  0x002637, 0x002641, 0x002642, 0x002643, 0x002644, 0x00264A, 0x00264D, 0x002650,
+  0x002651, 0x002652, 0x002654, 0x002655, 0x002659, 0x00265A, 0x00265B, 0x00265C,
+  0x00265D, 0x00265E, 0x00265F, 0x002662, 0x002666, 0x002668, 0x002669, 0x00266C,
+  0x002673, 0x002675, 0x00267E, 0x002682, 0x002688, 0x002691, 0x002692, 0x002698,
+  0x002699, 0x00269E, 0x00269F, 0x0026A8, 0x0026AB, 0x0026B0, 0x0026B6, 0x0026B8,
+  0x0026B9, 0x0026BA, 0x0026BB, 0x0026C6, 0x0026C7, 0x0026CA, 0x0026CB, 0x0026CC,
+  0x0026D9, 0x0026E2, 0x0026E8, 0x0026ED, 0x0026F1, 0x0026F2, 0x0026F3, 0x0026FC,
+  0x0026FF, 0x002709, 0x00270C, 0x00270D, 0x00270E, 0x002710, 0x002713, 0x002719,
+  0x00271C, 0x002722, 0x002790, 0x0027E3, 0x0027F8, 0x0028F8, 0x0029C2, 0x002A10,
+  0x002A6A, 0x002B67, 0x002B70, 0x002BF5, 0x002CC8, 0x002DB3, 0x002EC7, 0x002F5C,
+  0x002FD9, 0x00300A, 0x003011, 0x003013, 0x003019, 0x00301E, 0x003024, 0x003040,
+  0x003048, 0x003052, 0x003054, 0x003056, 0x003059, 0x003065, 0x00306D, 0x00306E,
+  0x003071, 0x003078, 0x00307B, 0x003080, 0x003085, 0x003088, 0x00308C, 0x003094,
+  0x003096, 0x0030A3, 0x0030AF, 0x0030B6, 0x0030C1, 0x0030D0, 0x0030DA, 0x0030F1,
+  0x0030F2, 0x003126, 0x003146, 0x003192, 0x003217, 0x003358, 0x0034DA, 0x0034FE,
+  0x00351A, 0x0035FF, 0x003676, 0x00376D, 0x0037B7, 0x0038DF, 0x003A7D, 0x003A98,
+  0x003A99, 0x003A9A, 0x003A9B, 0x003A9C, 0x003A9D, 0x003C10, 0x003C84, 0x003DE1,
+  0x003DE8, 0x003E73, 0x003EE1, 0x00400B, 0x004026, 0x004075, 0x004084, 0x00408C,
+  0x00408E, 0x004096, 0x00409F, 0x00410E, 0x0041D2, 0x004238, 0x00425A, 0x004268,
+  0x004279, 0x00451D, 0x0045E2, 0x00464B, 0x004A77, 0x004BF3, 0x004CE5, 0x004E01,
+  0x004E35, 0x004F1A, 0x005004, 0x00500B, 0x00500F, 0x005013, 0x005014, 0x00501E,
+  0x00502A, 0x00503E, 0x005040, 0x005047, 0x005050, 0x005053, 0x005054, 0x005056,
+  0x005073, 0x005076, 0x005079, 0x00507F, 0x005080, 0x005084, 0x00508B, 0x005094,
+  0x005099, 0x0050A2, 0x0050A7, 0x0050AA, 0x0050BA, 0x0050BD, 0x0050C7, 0x0050CA,
+  0x0050CC, 0x0050D1, 0x0050DA, 0x0050E2, 0x0050E3, 0x0050E4, 0x0050F0, 0x0050F1,
+  0x0050FC, 0x0051ED, 0x00549F, 0x0054AF, 0x0055B1, 0x00562B, 0x00566D, 0x0056CD,
+  0x0057C1, 0x0057D2, 0x0059DC, 0x005A13, 0x005A39, 0x005B94, 0x005C86, 0x005CC2,
+  0x005D73, 0x005E0C, 0x005F67, 0x005F86, 0x005FBF, 0x006008, 0x006009, 0x00600F,
+  0x006019, 0x00601D, 0x00602F, 0x006037, 0x006038, 0x00603E, 0x006041, 0x006047,
+  0x006048, 0x00604C, 0x00604F, 0x006057, 0x00605C, 0x006069, 0x00606D, 0x006070,
+  0x006083, 0x006088, 0x00608C, 0x006094, 0x006097, 0x006099, 0x0060B0, 0x0060B9,
+  0x0060BB, 0x0060D3, 0x0060DA, 0x0060DF, 0x006151, 0x006171, 0x00620B, 0x0062EC,
+  0x006440, 0x0064AF, 0x00651E, 0x006619, 0x00664B, 0x006762, 0x00682B, 0x0068EB,
+  0x00692D, 0x006B6F, 0x006B8E, 0x006B9E, 0x006BF1, 0x006CBC, 0x006CFD, 0x006D52,
+  0x006D61, 0x006F64, 0x006FF2, 0x007147, 0x0071C2, 0x0071CC, 0x007204, 0x007263,
+  0x007278, 0x00738D, 0x0073E0, 0x00749C, 0x007686, 0x00778D, 0x0077E4, 0x007839,
+  0x007888, 0x00789E, 0x007C2D, 0x007D60, 0x007E56, 0x007E95, 0x007F28, 0x008029,
+  0x008042, 0x008046, 0x00805F, 0x008063, 0x008077, 0x00808C, 0x0080A0, 0x0080A3,
+  0x0080BD, 0x0080C7, 0x0080E5, 0x0080E9, 0x0080EA, 0x0080F0, 0x0080F7, 0x00812A,
+  0x0081C4, 0x0081F9, 0x00841E, 0x0084ED, 0x00869C, 0x0086A0, 0x008701, 0x008731,
+  0x008764, 0x008865, 0x008A55, 0x008A76, 0x008A96, 0x008C54, 0x008CFA, 0x008E73,
+  0x008EF2, 0x009004, 0x00900C, 0x009021, 0x009027, 0x00902B, 0x009043, 0x009045,
+  0x00904B, 0x00905F, 0x009064, 0x009069, 0x00906D, 0x00906F, 0x009086, 0x00908B,
+  0x009092, 0x009096, 0x009097, 0x00909C, 0x0090A2, 0x0090A6, 0x0090AB, 0x0090B1,
+  0x0090BF, 0x0090CC, 0x0090D0, 0x0090D9, 0x0090F1, 0x0090F2, 0x0090F5, 0x0090FA,
+  0x00919E, 0x0091EB, 0x0092A5, 0x009337, 0x0094A1, 0x0094EC, 0x00991D, 0x009ACD,
+  0x009AD2, 0x009C02, 0x009CC0, 0x009D6B, 0x009E1E, 0x009EC8, 0x00A00E, 0x00A012,
+  0x00A01B, 0x00A01D, 0x00A021, 0x00A024, 0x00A02F, 0x00A040, 0x00A045, 0x00A054,
+  0x00A065, 0x00A06A, 0x00A078, 0x00A080, 0x00A085, 0x00A08E, 0x00A096, 0x00A098,
+  0x00A0A4, 0x00A0B0, 0x00A0B8, 0x00A0B9, 0x00A0C5, 0x00A0C6, 0x00A0C8, 0x00A0C9,
+  0x00A0D1, 0x00A0D5, 0x00A0D6, 0x00A0DE, 0x00A0F1, 0x00A0F8, 0x00A289, 0x00A2EE,
+  0x00A388, 0x00A38E, 0x00A3D1, 0x00A45F, 0x00A554, 0x00A5BF, 0x00A6CA, 0x00A742,
+  0x00AA00, 0x00AA01, 0x00AA02, 0x00AA6E, 0x00AA70, 0x00AAFD, 0x00AB48, 0x00ACE0,
+  0x00AD24, 0x00ADD5, 0x00AEFA, 0x00AF1F, 0x00B009, 0x00B048, 0x00B04A, 0x00B052,
+  0x00B064, 0x00B08E, 0x00B0C2, 0x00B0D0, 0x00B0E1, 0x00B1E3, 0x00B362, 0x00B4F5,
+  0x00B5D0, 0x00B670, 0x00B771, 0x00B810, 0x00B8B3, 0x00B8B6, 0x00BB1C, 0x00BB3A,
+  0x00BB60, 0x00BBC1, 0x00BBF0, 0x00BC60, 0x00BD3A, 0x00BD3E, 0x00BD82, 0x00BE3B,
+  0x00BE43, 0x00BE75, 0x00BE9E, 0x00BED5, 0x00BF61, 0x00BF77, 0x00BFAF, 0x00C002,
+  0x00C04F, 0x00C059, 0x00C08F, 0x00C095, 0x00C09F, 0x00C0AB, 0x00C0DD, 0x00C0E6,
+  0x00C0EE, 0x00C0F2, 0x00C0F9, 0x00C0FF, 0x00C164, 0x00C1B1, 0x00C28F, 0x00C2C6,
+  0x00C30A, 0x00C3F4, 0x00C52C, 0x00C585, 0x00C610, 0x00C711, 0x00C88B, 0x00C896,
+  0x00CAE0, 0x00CAE5, 0x00CB00, 0x00CB51, 0x00CB7A, 0x00CC34, 0x00CC3F, 0x00CCFC,
+  0x00CDFE, 0x00CF1C, 0x00CFC0, 0x00D006, 0x00D028, 0x00D02D, 0x00D037, 0x00D050,
+  0x00D058, 0x00D063, 0x00D077, 0x00D079, 0x00D088, 0x00D08B, 0x00D08E, 0x00D090,
+  0x00D095, 0x00D096, 0x00D097, 0x00D09E, 0x00D0B7, 0x00D0BA, 0x00D0BB, 0x00D0BC,
+  0x00D0C0, 0x00D0D1, 0x00D0D3, 0x00D0D8, 0x00D0E4, 0x00D0EC, 0x00D0F6, 0x00D0FF,
+  0x00D49E, 0x00D6FE, 0x00D76D, 0x00D78F, 0x00D861, 0x00D8A2, 0x00D9D1, 0x00DA55,
+  0x00DB70, 0x00DBDF, 0x00DCB2, 0x00DD00, 0x00DD01, 0x00DD02, 0x00DD03, 0x00DD04,
+  0x00DD05, 0x00DD06, 0x00DD07, 0x00DD08, 0x00DD09, 0x00DD0A, 0x00DD0B, 0x00DD0C,
+  0x00DD0D, 0x00DD0E, 0x00DD0F, 0x00DDB6, 0x00DEFB, 0x00DF1D, 0x00E000, 0x00E009,
+  0x00E00F, 0x00E014, 0x00E018, 0x00E01E, 0x00E022, 0x00E02B, 0x00E034, 0x00E035,
+  0x00E036, 0x00E03A, 0x00E04F, 0x00E052, 0x00E063, 0x00E06F, 0x00E075, 0x00E08B,
+  0x00E08F, 0x00E091, 0x00E098, 0x00E09E, 0x00E0A3, 0x00E0A9, 0x00E0B0, 0x00E0B1,
+  0x00E0D5, 0x00E0DA, 0x00E0DD, 0x00E0DF, 0x00E0EC, 0x00E0F7, 0x00E0F9, 0x00E0FC,
+  0x00E0FE, 0x00E16D, 0x00E18C, 0x00E22C, 0x00E3B2, 0x00E400, 0x00E406, 0x00E421,
+  0x00E5E4, 0x00E5F1, 0x00E60E, 0x00E63A, 0x00E666, 0x00E7E3, 0x00E93A, 0x00EABD,
+  0x00EB2D, 0x00EBD5, 0x00EC0A, 0x00EDB8, 0x00EEAB, 0x00EEBD, 0x00F28B, 0x00F361,
+  0x00F39F, 0x00F46F, 0x00F48D, 0x00F4B9, 0x00F620, 0x00F663, 0x00F76F, 0x00F7AD,
+  0x00F81C, 0x00F82C, 0x00F952, 0x00FA21, 0x00FC8B, 0x00FC8D, 0x00FCBA, 0x00FD22,
+  0x00FD45, 0x00FEC8, 0x020701, 0x02608C, 0x027001, 0x02C08C, 0x02CF1C, 0x0401BB,
+  0x04021F, 0x040312, 0x0403D6, 0x0405DD, 0x040973, 0x040986, 0x040A83, 0x040CCE,
+  0x040D84, 0x040E3C, 0x04106B, 0x041471, 0x041552, 0x0417B6, 0x04180F, 0x041892,
+  0x0418B6, 0x0418D6, 0x041B6D, 0x041BBA, 0x041DC7, 0x041E64, 0x042084, 0x04209A,
+  0x042144, 0x042322, 0x0425C5, 0x0425E0, 0x0425E8, 0x0425F0, 0x042665, 0x042728,
+  0x042758, 0x04292E, 0x042AE2, 0x043201, 0x04331F, 0x043389, 0x0433C2, 0x0434F6,
+  0x043926, 0x043CE8, 0x043F72, 0x0440A9, 0x044169, 0x04421A, 0x0443FD, 0x044665,
+  0x04472A, 0x04489A, 0x04495D, 0x044A6C, 0x044BA5, 0x044BED, 0x044E06, 0x044E5A,
+  0x044EAF, 0x044F17, 0x044F4C, 0x044F7A, 0x044FAA, 0x0452C7, 0x0452F3, 0x045453,
+  0x045604, 0x0456E5, 0x045747, 0x045791, 0x045A95, 0x045C6C, 0x045D4B, 0x045EA4,
+  0x045FB9, 0x046273, 0x0463D0, 0x046865, 0x046874, 0x04698F, 0x0469F8, 0x046B25,
+  0x046C59, 0x046C9D, 0x046ECB, 0x047056, 0x047153, 0x047295, 0x047503, 0x0475F9,
+  0x04766E, 0x0476B0, 0x047863, 0x047970, 0x047975, 0x0479B7, 0x0479FD, 0x047A0B,
+  0x047AAE, 0x047BCB, 0x047C16, 0x047D7B, 0x047E23, 0x047F0E, 0x04819B, 0x048680,
+  0x048727, 0x04885F, 0x048A15, 0x048AE1, 0x048C16, 0x048C9A, 0x048D38, 0x049162,
+  0x049226, 0x04946B, 0x049573, 0x0495E6, 0x0498F3, 0x0499B9, 0x0499BB, 0x049D05,
+  0x049F81, 0x049FCA, 0x04A151, 0x04A222, 0x04A2F3, 0x04A316, 0x04A526, 0x04A741,
+  0x04A81C, 0x04A82A, 0x04A959, 0x04AB08, 0x04AB18, 0x04B0E7, 0x04B167, 0x04B1A1,
+  0x04B429, 0x04B4FE, 0x04B6BE, 0x04B86A, 0x04B9E3, 0x04BA1C, 0x04BA8D, 0x04BAD6,
+  0x04BC6D, 0x04BC9F, 0x04BD70, 0x04BD88, 0x04BD97, 0x04BDBF, 0x04BF1B, 0x04BF6D,
+  0x04C06F, 0x04C09C, 0x04C1B9, 0x04C1D8, 0x04C23E, 0x04C241, 0x04C461, 0x04C5A4,
+  0x04C807, 0x04C9D9, 0x04CAED, 0x04CB88, 0x04CCBC, 0x04CD15, 0x04CE09, 0x04CF4B,
+  0x04CF8C, 0x04D13A, 0x04D168, 0x04D320, 0x04D395, 0x04D3B0, 0x04D3B5, 0x04D3CF,
+  0x04D442, 0x04D4C4, 0x04D590, 0x04D60E, 0x04D6AA, 0x04D6F4, 0x04D7A5, 0x04D9C8,
+  0x04D9F5, 0x04DAD2, 0x04DB56, 0x04E0B0, 0x04E229, 0x04E31A, 0x04E451, 0x04E4B6,
+  0x04E536, 0x04E598, 0x04E676, 0x04E77E, 0x04E795, 0x04E8B9, 0x04EA56, 0x04EB40,
+  0x04ECBB, 0x04ECD8, 0x04ED33, 0x04EE03, 0x04F03E, 0x04F128, 0x04F13E, 0x04F169,
+  0x04F352, 0x04F4D8, 0x04F778, 0x04F7E4, 0x04F8C2, 0x04F8F8, 0x04F938, 0x04F993,
+  0x04F9F8, 0x04FA83, 0x04FE31, 0x04FE7F, 0x04FE8D, 0x04FEA1, 0x04FF08, 0x080006,
+  0x080007, 0x080009, 0x08001B, 0x08001F, 0x080020, 0x080023, 0x080028, 0x08002B,
+  0x080046, 0x08004E, 0x08005A, 0x08006A, 0x080086, 0x080088, 0x08010F, 0x080205,
+  0x08028E, 0x080342, 0x0804B4, 0x080581, 0x0805E2, 0x0808C2, 0x0809B6, 0x081086,
+  0x081196, 0x0812A5, 0x08152F, 0x0815AE, 0x081605, 0x081735, 0x0817F4, 0x08181A,
+  0x0819A6, 0x081A1E, 0x081AFD, 0x081C6E, 0x081DC4, 0x081F71, 0x081FF3, 0x0821EF,
+  0x0823B2, 0x0823C6, 0x082525, 0x082573, 0x082697, 0x08276B, 0x082802, 0x082CB6,
+  0x082E36, 0x082E5F, 0x082FE9, 0x08306B, 0x0830CE, 0x08318B, 0x0831A4, 0x0833ED,
+  0x0836C9, 0x08373D, 0x0838E6, 0x083A38, 0x083A88, 0x083A8D, 0x083AF2, 0x083D88,
+  0x083E0C, 0x083E5D, 0x083E8E, 0x083FBC, 0x0840F3, 0x084473, 0x0845D1, 0x0846C7,
+  0x08474C, 0x0847D0, 0x084ACF, 0x084EBF, 0x084F0A, 0x084FA9, 0x084FF9, 0x085104,
+  0x085411, 0x0854BB, 0x085531, 0x08569B, 0x085700, 0x0857FB, 0x085A11, 0x085B0E,
+  0x085BD6, 0x085C1B, 0x085DDD, 0x08606E, 0x086083, 0x086195, 0x086266, 0x086361,
+  0x086518, 0x08661F, 0x086698, 0x08674E, 0x08688D, 0x086A0A, 0x086AC5, 0x086AE5,
+  0x086BD1, 0x086BD7, 0x086D41, 0x086E9C, 0x086F48, 0x087045, 0x087073, 0x087190,
+  0x087402, 0x087458, 0x0876FF, 0x087808, 0x08798C, 0x087A4C, 0x087B12, 0x087B87,
+  0x087C39, 0x087E64, 0x087F98, 0x088039, 0x0881F4, 0x08849D, 0x08855B, 0x088620,
+  0x08863B, 0x0887C6, 0x0887C7, 0x088C2C, 0x088E90, 0x088EDC, 0x088FC3, 0x089115,
+  0x0891A3, 0x089204, 0x089356, 0x0894EF, 0x08952A, 0x089542, 0x0896AD, 0x0896D7,
+  0x089734, 0x089798, 0x089AC7, 0x089BB9, 0x089BF1, 0x089C86, 0x089DF4, 0x089E01,
+  0x089E08, 0x089E84, 0x08A189, 0x08A5C8, 0x08A5DF, 0x08A6BC, 0x08A7C0, 0x08A842,
+  0x08A95A, 0x08AA55, 0x08AA89, 0x08AED6, 0x08B055, 0x08B258, 0x08B3AF, 0x08B49D,
+  0x08B4B1, 0x08B61F, 0x08BB3C, 0x08BD43, 0x08BEAC, 0x08BFA0, 0x08BFB8, 0x08C021,
+  0x08C06C, 0x08C0EB, 0x08C224, 0x08C3B3, 0x08C5E1, 0x08C729, 0x08C8C2, 0x08CC27,
+  0x08CC68, 0x08CC81, 0x08CCA7, 0x08D09F, 0x08D0B7, 0x08D1F9, 0x08D23E, 0x08D40C,
+  0x08D42B, 0x08D46A, 0x08D59D, 0x08DDEB, 0x08DF1F, 0x08E021, 0x08E63B, 0x08E689,
+  0x08E7E5, 0x08E84F, 0x08E9F6, 0x08EA40, 0x08EA44, 0x08EB29, 0x08EB74, 0x08EBF6,
+  0x08ECA9, 0x08ECF5, 0x08ED9D, 0x08EDB9, 0x08EDED, 0x08EE8B, 0x08EF3B, 0x08F01E,
+  0x08F0B6, 0x08F1B3, 0x08F1EA, 0x08F3FB, 0x08F458, 0x08F4AB, 0x08F606, 0x08F69C,
+  0x08F8BC, 0x08F9E0, 0x08FA28, 0x08FA79, 0x08FBEA, 0x08FC88, 0x08FD0E, 0x08FF24,
+  0x08FF44, 0x0C014B, 0x0C01C8, 0x0C01DB, 0x0C0227, 0x0C02BD, 0x0C08B4, 0x0C0ADF,
+  0x0C0E76, 0x0C1167, 0x0C1262, 0x0C1420, 0x0C14D2, 0x0C1539, 0x0C1773, 0x0C184E,
+  0x0C19F8, 0x0C1C1A, 0x0C1C57, 0x0C1DAF, 0x0C20D3, 0x0C238D, 0x0C2576, 0x0C2724,
+  0x0C298F, 0x0C29EF, 0x0C2A86, 0x0C2C54, 0x0C2E57, 0x0C2FB0, 0x0C3021, 0x0C31DC,
+  0x0C3526, 0x0C354F, 0x0C35FE, 0x0C3747, 0x0C37DC, 0x0C3AFA, 0x0C3B50, 0x0C3CCD,
+  0x0C3E9F, 0x0C413E, 0x0C41E9, 0x0C42A1, 0x0C4314, 0x0C43F9, 0x0C45BA, 0x0C473D,
+  0x0C47C9, 0x0C4885, 0x0C48C6, 0x0C4933, 0x0C4B48, 0x0C4B54, 0x0C4BEE, 0x0C4C39,
+  0x0C4DE9, 0x0C4EC0, 0x0C4F9B, 0x0C5101, 0x0C517E, 0x0C53B7, 0x0C5415, 0x0C54A5,
+  0x0C54B9, 0x0C599C, 0x0C6046, 0x0C6076, 0x0C6127, 0x0C61CF, 0x0C62A6, 0x0C659A,
+  0x0C6714, 0x0C6743, 0x0C6803, 0x0C6ABC, 0x0C6AC4, 0x0C7043, 0x0C704A, 0x0C715D,
+  0x0C718C, 0x0C722C, 0x0C7274, 0x0C72D9, 0x0C7329, 0x0C74C2, 0x0C75BD, 0x0C75D2,
+  0x0C771A, 0x0C7A15, 0x0C7BC8, 0x0C7C28, 0x0C7FB2, 0x0C8063, 0x0C8112, 0x0C8126,
+  0x0C8268, 0x0C8306, 0x0C839A, 0x0C83CC, 0x0C8408, 0x0C8447, 0x0C84DC, 0x0C8525,
+  0x0C8610, 0x0C8772, 0x0C8910, 0x0C8B7D, 0x0C8B95, 0x0C8BD3, 0x0C8BFD, 0x0C8C24,
+  0x0C8DCA, 0x0C8DDB, 0x0C8E29, 0x0C8FFF, 0x0C9043, 0x0C9160, 0x0C9192, 0x0C938F,
+  0x0C9505, 0x0C9541, 0x0C96BF, 0x0C96CD, 0x0C96E6, 0x0C975F, 0x0C9838, 0x0C9A3C,
+  0x0C9A42, 0x0C9B78, 0x0C9D92, 0x0CA402, 0x0CA694, 0x0CA8A7, 0x0CAC8A, 0x0CAE5F,
+  0x0CAE7D, 0x0CAEBD, 0x0CAF31, 0x0CB2B7, 0x0CB319, 0x0CB527, 0x0CB5DE, 0x0CB6D2,
+  0x0CB771, 0x0CB789, 0x0CB815, 0x0CB8E8, 0x0CB937, 0x0CB983, 0x0CBC9F, 0x0CBD51,
+  0x0CBD75, 0x0CBEF1, 0x0CC413, 0x0CC47A, 0x0CC66A, 0x0CC6CC, 0x0CC6FD, 0x0CC844,
+  0x0CCB85, 0x0CCF89, 0x0CD0F8, 0x0CD292, 0x0CD502, 0x0CD5D3, 0x0CD6BD, 0x0CD746,
+  0x0CD86C, 0x0CD996, 0x0CD9C1, 0x0CDA41, 0x0CDBEA, 0x0CDC7E, 0x0CDC91, 0x0CDD24,
+  0x0CDDEF, 0x0CDFA4, 0x0CE0DC, 0x0CE0E4, 0x0CE441, 0x0CE4A0, 0x0CE5B5, 0x0CE725,
+  0x0CEAC9, 0x0CEC80, 0x0CEC84, 0x0CEC8D, 0x0CEE99, 0x0CEEE6, 0x0CEFF6, 0x0CF346,
+  0x0CF3EE, 0x0CF4D5, 0x0CF5A4, 0x0CF893, 0x0CF9C0, 0x0CFC18, 0x0CFE45, 0x100000,
+  0x100020, 0x10005A, 0x100177, 0x1002B5, 0x100501, 0x1005B1, 0x1005CA, 0x1005E1,
+  0x10061C, 0x100645, 0x1006ED, 0x10071D, 0x1007B6, 0x10082C, 0x1008B1, 0x1009F9,
+  0x100BA9, 0x100C6B, 0x100D7F, 0x100E7E, 0x101081, 0x101250, 0x1012B4, 0x1012D0,
+  0x1012FB, 0x101331, 0x101849, 0x101965, 0x101B54, 0x101C0C, 0x101DC0, 0x101EDA,
+  0x101F74, 0x102407, 0x1027F5, 0x102959, 0x1029AB, 0x102AB3, 0x102B41, 0x102C6B,
+  0x102C8D, 0x102CB1, 0x102D41, 0x102E00, 0x102EAF, 0x102F6B, 0x102F6E, 0x103025,
+  0x103047, 0x10321D, 0x10322C, 0x10327E, 0x1033BF, 0x10381F, 0x103917, 0x10394E,
+  0x1039E9, 0x103B59, 0x103C59, 0x103D0A, 0x103D1C, 0x103D3E, 0x103F44, 0x1040F3,
+  0x104121, 0x10417F, 0x104400, 0x104738, 0x104780, 0x1047E7, 0x104A7D, 0x104B46,
+  0x104C43, 0x104E89, 0x104F58, 0x104FA8, 0x105072, 0x105107, 0x105172, 0x10521C,
+  0x1055E4, 0x105611, 0x1056CA, 0x105887, 0x105932, 0x105A17, 0x105DDC, 0x105F02,
+  0x105F06, 0x105F49, 0x105FAD, 0x105FD4, 0x10604B, 0x1062D0, 0x1062E5, 0x1062EB,
+  0x10634B, 0x1063C8, 0x106530, 0x106682, 0x106838, 0x10683F, 0x106F3F, 0x106FD9,
+  0x1070FD, 0x107100, 0x1071B3, 0x1071FA, 0x107223, 0x107636, 0x107717, 0x1077B0,
+  0x1077B1, 0x10785B, 0x1078D2, 0x107B44, 0x107B93, 0x107BCE, 0x107BEF, 0x107C61,
+  0x107D1A, 0x10823D, 0x108286, 0x1082D7, 0x10868C, 0x1088CE, 0x1089FB, 0x108A7B,
+  0x108CCF, 0x108EE0, 0x108FFE, 0x1090FA, 0x1091A8, 0x1091D1, 0x109266, 0x109397,
+  0x1093E9, 0x1094BB, 0x10961A, 0x109693, 0x1097BD, 0x109826, 0x109836, 0x1098C3,
+  0x109ADD, 0x109D7A, 0x109D9C, 0x109E3A, 0x109F41, 0x109F47, 0x109F4F, 0x109FA9,
+  0x10A2D3, 0x10A3B8, 0x10A4B9, 0x10A4BE, 0x10A4DA, 0x10A51D, 0x10A562, 0x10A5D0,
+  0x10A793, 0x10A829, 0x10AE60, 0x10B1DF, 0x10B1F8, 0x10B232, 0x10B3C6, 0x10B3D5,
+  0x10B3D6, 0x10B588, 0x10B713, 0x10B9C4, 0x10BBF3, 0x10BC97, 0x10BD18, 0x10BD3A,
+  0x10BEF5, 0x10BF48, 0x10BF67, 0x10C172, 0x10C25A, 0x10C37B, 0x10C3AB, 0x10C4CA,
+  0x10C595, 0x10C61F, 0x10C6FC, 0x10C753, 0x10CABF, 0x10CDAE, 0x10CE02, 0x10CEA9,
+  0x10CEE9, 0x10CF0F, 0x10D07A, 0x10D0AB, 0x10D38A, 0x10D542, 0x10D561, 0x10D680,
+  0x10D7B0, 0x10DA43, 0x10DA49, 0x10DC4A, 0x10DDB1, 0x10DFFC, 0x10E177, 0x10E2C9,
+  0x10E4C2, 0x10E77A, 0x10E7C6, 0x10E878, 0x10E8A7, 0x10E953, 0x10E992, 0x10EA59,
+  0x10EC81, 0x10F005, 0x10F068, 0x10F1F2, 0x10F311, 0x10F605, 0x10F60A, 0x10F681,
+  0x10F920, 0x10F96F, 0x10F9EE, 0x10FC33, 0x10FEED, 0x10FFE0, 0x1100AA, 0x111111,
+  0x14007D, 0x140152, 0x1402EC, 0x1409B4, 0x1409DC, 0x140A29, 0x140AC5, 0x140C76,
+  0x140D4F, 0x140F42, 0x140FA6, 0x14109F, 0x141114, 0x14115D, 0x14130B, 0x141333,
+  0x141346, 0x1413FB, 0x14144B, 0x141459, 0x14169D, 0x14169E, 0x14172A, 0x141877,
+  0x1418C3, 0x141A97, 0x141AA3, 0x141B30, 0x141F78, 0x14205E, 0x142103, 0x142233,
+  0x14223B, 0x1422DB, 0x14230A, 0x1423F2, 0x142876, 0x142B2F, 0x142C78, 0x142D27,
+  0x142D41, 0x142D4D, 0x142D79, 0x142E5E, 0x143004, 0x1430C6, 0x1432D1, 0x143375,
+  0x143605, 0x1436C6, 0x143B51, 0x143CC3, 0x143E60, 0x143EBF, 0x143FA6, 0x1442FC,
+  0x14448F, 0x144658, 0x14472D, 0x144920, 0x1449BC, 0x1449D4, 0x1449E0, 0x144D67,
+  0x144E2A, 0x144E34, 0x144F8A, 0x145051, 0x145120, 0x14517E, 0x145594, 0x1455B9,
+  0x14563A, 0x14568E, 0x145790, 0x14579F, 0x145808, 0x1458D0, 0x1459C0, 0x145A05,
+  0x145AFC, 0x145BB9, 0x145BD1, 0x145E69, 0x145F94, 0x146080, 0x1460CB, 0x146102,
+  0x14612F, 0x1461A4, 0x14656A, 0x1469A2, 0x146B9A, 0x146B9C, 0x146E0A, 0x147411,
+  0x14755B, 0x147590, 0x147740, 0x1479F3, 0x147BAC, 0x147D05, 0x147DC5, 0x147DDA,
+  0x147F0F, 0x147F67, 0x147FCE, 0x14825B, 0x148473, 0x148477, 0x148509, 0x148554,
+  0x14857F, 0x148692, 0x14876A, 0x1488E6, 0x1489CB, 0x1489FD, 0x148C4A, 0x148F21,
+  0x148FC6, 0x149138, 0x149182, 0x14946C, 0x1495CE, 0x14962D, 0x1496E5, 0x149877,
+  0x14987D, 0x14993E, 0x1499E2, 0x149A10, 0x149BF3, 0x149CEF, 0x149D09, 0x149D99,
+  0x149ECF, 0x149F3C, 0x149F43, 0x149FB6, 0x149FE8, 0x14A0F8, 0x14A1DF, 0x14A2A0,
+  0x14A32F, 0x14A364, 0x14A3B4, 0x14A417, 0x14A51A, 0x14A78B, 0x14A9D0, 0x14AB02,
+  0x14ABC5, 0x14ABEC, 0x14ABF0, 0x14AC60, 0x14ADCA, 0x14AEDB, 0x14B2E5, 0x14B31F,
+  0x14B3A1, 0x14B457, 0x14B484, 0x14B7F8, 0x14B837, 0x14B968, 0x14BB6E, 0x14BD61,
+  0x14C03E, 0x14C050, 0x14C126, 0x14C14E, 0x14C213, 0x14C67D, 0x14C697, 0x14C88B,
+  0x14C913, 0x14C9CF, 0x14CA56, 0x14CB19, 0x14CB65, 0x14CC20, 0x14CF8D, 0x14CF92,
+  0x14CFE2, 0x14D00D, 0x14D11F, 0x14D169, 0x14D19E, 0x14D424, 0x14D4FE, 0x14D64D,
+  0x14D864, 0x14DAB9, 0x14DAE9, 0x14DD9C, 0x14DDA9, 0x14DE39, 0x14E01D, 0x14E6E4,
+  0x14E7C8, 0x14E9B2, 0x14EB08, 0x14EBB6, 0x14EDBB, 0x14F287, 0x14F42A, 0x14F5F9,
+  0x14F65A, 0x14F6D8, 0x14FB70, 0x14FEB5, 0x18002D, 0x1800DB, 0x1801F1, 0x18022D,
+  0x1802AE, 0x180373, 0x1804ED, 0x180CAC, 0x180D2C, 0x180EAC, 0x180F76, 0x18132D,
+  0x181456, 0x18146C, 0x1814AE, 0x1816C9, 0x18188B, 0x1819D6, 0x181BEB, 0x181DEA,
+  0x181E78, 0x181EB0, 0x182032, 0x1820D5, 0x182195, 0x18227E, 0x182649, 0x182654,
+  0x182666, 0x182861, 0x182A57, 0x182A7B, 0x182AD3, 0x182C65, 0x18300C, 0x1831BF,
+  0x183219, 0x18339D, 0x183451, 0x1834AF, 0x1835D1, 0x183A2D, 0x183BD2, 0x183CB7,
+  0x183D5E, 0x183DA2, 0x183EEF, 0x183F47, 0x183F70, 0x18421D, 0x18422F, 0x1844E6,
+  0x184516, 0x184593, 0x184617, 0x184644, 0x18473D, 0x184859, 0x1848BE, 0x1848CA,
+  0x1849F8, 0x184A53, 0x184A6F, 0x184B0D, 0x184C08, 0x184E03, 0x184E16, 0x184ECB,
+  0x184F32, 0x185207, 0x185282, 0x185345, 0x1854CF, 0x18550F, 0x1855E3, 0x185644,
+  0x185680, 0x1856C3, 0x185880, 0x185933, 0x185936, 0x1859F5, 0x185A58, 0x185B00,
+  0x185BB3, 0x185E0B, 0x185E0F, 0x186024, 0x18622C, 0x1862E4, 0x186472, 0x186590,
+  0x1866DA, 0x1867B0, 0x18686A, 0x1868CB, 0x1869D4, 0x1869D8, 0x1869DA, 0x186A81,
+  0x186F2D, 0x18703B, 0x18742E, 0x187532, 0x1878D4, 0x1879FD, 0x187A3B, 0x187A3E,
+  0x187C0B, 0x187C81, 0x187CAA, 0x187EB9, 0x187F88, 0x188025, 0x188090, 0x1880F5,
+  0x18810E, 0x1881ED, 0x18828C, 0x188331, 0x1883BF, 0x1884C1, 0x1886AC, 0x188740,
+  0x188796, 0x18895B, 0x1889A0, 0x1889CF, 0x188B0E, 0x188B45, 0x188B9D, 0x189088,
+  0x1890D8, 0x1892A4, 0x189341, 0x18937F, 0x1893D7, 0x189552, 0x189578, 0x1899F5,
+  0x189C27, 0x189C5D, 0x189E2C, 0x189EFC, 0x18A3E8, 0x18A5FF, 0x18A6F7, 0x18A7F1,
+  0x18A905, 0x18A99B, 0x18AA0F, 0x18AA1E, 0x18AACA, 0x18AB1D, 0x18AC9E, 0x18AF61,
+  0x18AF8F, 0x18B169, 0x18B6CC, 0x18B81F, 0x18B905, 0x18B96E, 0x18BB1C, 0x18BB26,
+  0x18BB41, 0x18BC57, 0x18BC5A, 0x18BF1C, 0x18BFB3, 0x18C007, 0x18C009, 0x18C04D,
+  0x18C086, 0x18C19D, 0x18C293, 0x18C2BF, 0x18C300, 0x18C501, 0x18C58A, 0x18CAA7,
+  0x18CC18, 0x18CE94, 0x18CF24, 0x18CF5E, 0x18D0C5, 0x18D225, 0x18D276, 0x18D61C,
+  0x18D6C7, 0x18D6DD, 0x18D717, 0x18D98F, 0x18DBF2, 0x18DC56, 0x18DE50, 0x18DED7,
+  0x18E215, 0x18E29F, 0x18E2C2, 0x18E3BC, 0x18E728, 0x18E777, 0x18E7B0, 0x18E7F4,
+  0x18E829, 0x18E91D, 0x18ECE7, 0x18EE69, 0x18EE86, 0x18EF3A, 0x18EF63, 0x18F0E4,
+  0x18F1D8, 0x18F22C, 0x18F46A, 0x18F643, 0x18F935, 0x18FAB7, 0x18FB7B, 0x18FC26,
+  0x18FD74, 0x18FE34, 0x18FF0F, 0x1C0219, 0x1C08C1, 0x1C0D7D, 0x1C0ED3, 0x1C1161,
+  0x1C12B0, 0x1C1386, 0x1C1448, 0x1C151F, 0x1C17D3, 0x1C1AC0, 0x1C1ADF, 0x1C1B0D,
+  0x1C1B68, 0x1C1BB5, 0x1C1D67, 0x1C1D86, 0x1C1EE3, 0x1C1FF1, 0x1C20DB, 0x1C232C,
+  0x1C234F, 0x1C24CD, 0x1C25E1, 0x1C2704, 0x1C28AF, 0x1C2A8B, 0x1C2AB0, 0x1C2FA2,
+  0x1C3008, 0x1C34DA, 0x1C34F1, 0x1C36BB, 0x1C3929, 0x1C3947, 0x1C398A, 0x1C3A60,
+  0x1C3ADE, 0x1C3B62, 0x1C3BF3, 0x1C3CD4, 0x1C3D2F, 0x1C3E84, 0x1C4024, 0x1C4176,
+  0x1C4190, 0x1C427D, 0x1C4363, 0x1C4419, 0x1C4586, 0x1C4593, 0x1C46D1, 0x1C472F,
+  0x1C48CE, 0x1C48F9, 0x1C497B, 0x1C4BD6, 0x1C4C48, 0x1C4D66, 0x1C4D70, 0x1C501E,
+  0x1C53F9, 0x1C549E, 0x1C568E, 0x1C56FE, 0x1C573E, 0x1C57DC, 0x1C599B, 0x1C5A3E,
+  0x1C5CF2, 0x1C5EE6, 0x1C5F2B, 0x1C60D2, 0x1C60DE, 0x1C61B4, 0x1C62B8, 0x1C6349,
+  0x1C6499, 0x1C659D, 0x1C666D, 0x1C66AA, 0x1C674A, 0x1C6758, 0x1C687E, 0x1C697A,
+  0x1C69A5, 0x1C6A76, 0x1C6A7A, 0x1C6F65, 0x1C7022, 0x1C7125, 0x1C721D, 0x1C73E2,
+  0x1C740D, 0x1C7508, 0x1C76F2, 0x1C77F6, 0x1C784E, 0x1C7A43, 0x1C7ACF, 0x1C7B21,
+  0x1C7B23, 0x1C7C98, 0x1C7EE5, 0x1C7F2C, 0x1C8682, 0x1C869A, 0x1C872C, 0x1C87E3,
+  0x1C880C, 0x1C8B76, 0x1C8BEF, 0x1C8E5C, 0x1C90BE, 0x1C90FF, 0x1C9148, 0x1C9180,
+  0x1C919D, 0x1C937C, 0x1C93C4, 0x1C965A, 0x1C98C1, 0x1C98EC, 0x1C994C, 0x1C9957,
+  0x1C9C8C, 0x1C9D3E, 0x1C9D72, 0x1C9DC2, 0x1C9E46, 0x1C9ECC, 0x1CA0B8, 0x1CA532,
+  0x1CA681, 0x1CA770, 0x1CAA07, 0x1CAB34, 0x1CAB48, 0x1CABA7, 0x1CABC0, 0x1CAECB,
+  0x1CAF05, 0x1CAF4A, 0x1CAFF7, 0x1CB044, 0x1CB094, 0x1CB17F, 0x1CB3C9, 0x1CB72C,
+  0x1CB796, 0x1CB9C4, 0x1CBA8C, 0x1CBDB9, 0x1CBFC0, 0x1CC035, 0x1CC10C, 0x1CC1BC,
+  0x1CC1DE, 0x1CC3EB, 0x1CC63C, 0x1CC992, 0x1CCA41, 0x1CCB99, 0x1CCCD6, 0x1CCE51,
+  0x1CD107, 0x1CD1BA, 0x1CD1E0, 0x1CD5E2, 0x1CD6BE, 0x1CDA27, 0x1CDDEA, 0x1CDE57,
+  0x1CDEA7, 0x1CDF0F, 0x1CDF52, 0x1CE192, 0x1CE209, 0x1CE2CC, 0x1CE504, 0x1CE57F,
+  0x1CE61D, 0x1CE62B, 0x1CE639, 0x1CE6AD, 0x1CE6C7, 0x1CE85D, 0x1CEA0B, 0x1CEA1B,
+  0x1CED6F, 0x1CEF03, 0x1CF29A, 0x1CF42B, 0x1CF4CA, 0x1CF8D0, 0x1CFA68, 0x1CFC17,
+  0x1CFE2B, 0x1CFF59, 0x2002AF, 0x20040F, 0x200484, 0x2004F3, 0x200889, 0x2008ED,
+  0x200B16, 0x200B74, 0x200BC5, 0x200BC7, 0x200BCF, 0x200CC8, 0x200DB0, 0x200E2B,
+  0x20107A, 0x20108A, 0x2013E0, 0x201582, 0x2015DE, 0x20163D, 0x201642, 0x2016B9,
+  0x2016D8, 0x201742, 0x201A06, 0x201A94, 0x201B88, 0x201BC9, 0x201C3A, 0x201E88,
+  0x201F31, 0x201F3B, 0x201F54, 0x202027, 0x202141, 0x2021A5, 0x202351, 0x202564,
+  0x2025D2, 0x202681, 0x20283E, 0x202B20, 0x202BC1, 0x202D07, 0x20311C, 0x203233,
+  0x20326C, 0x2032C6, 0x2034FB, 0x203626, 0x20365B, 0x203706, 0x2037A5, 0x203956,
+  0x203A07, 0x203A43, 0x203AEB, 0x203B69, 0x203CAE, 0x203D66, 0x203DB2, 0x203DBD,
+  0x20406A, 0x204441, 0x204569, 0x204747, 0x2047B5, 0x2047DA, 0x2047ED, 0x204B22,
+  0x204C03, 0x204C9E, 0x204E71, 0x204E7F, 0x204EF6, 0x2050E7, 0x205383, 0x205476,
+  0x2054FA, 0x205531, 0x20579E, 0x205869, 0x205A1D, 0x205B2A, 0x205D0D, 0x205D47,
+  0x205E64, 0x205E97, 0x205EF7, 0x205F3D, 0x206274, 0x206432, 0x2064CB, 0x2064DE,
+  0x20658E, 0x2066CF, 0x20677C, 0x2067E0, 0x20689D, 0x206980, 0x206A8A, 0x206A94,
+  0x206BE7, 0x206BF4, 0x206C8A, 0x206E9C, 0x2072A9, 0x207355, 0x207454, 0x207600,
+  0x20768F, 0x207852, 0x2078CD, 0x2078F0, 0x207918, 0x207BD2, 0x207D74, 0x208058,
+  0x20826A, 0x2082C0, 0x2083F8, 0x208756, 0x2087EC, 0x208810, 0x20896F, 0x208984,
+  0x208986, 0x20898A, 0x208B37, 0x208BD1, 0x208C86, 0x209148, 0x2091DF, 0x209339,
+  0x20934D, 0x20968A, 0x2098ED, 0x209A7D, 0x209BCD, 0x209BE6, 0x209CB4, 0x209E79,
+  0x209EF7, 0x20A171, 0x20A2E4, 0x20A5CB, 0x20A60C, 0x20A680, 0x20A6CD, 0x20A766,
+  0x20A8B9, 0x20A90E, 0x20A99B, 0x20AA4B, 0x20AB37, 0x20AB48, 0x20AD56, 0x20B001,
+  0x20B399, 0x20B82B, 0x20B868, 0x20BA36, 0x20BBBC, 0x20BBC0, 0x20BECD, 0x20C047,
+  0x20C19B, 0x20C38F, 0x20C6EB, 0x20C9D0, 0x20CC27, 0x20CD39, 0x20CD6E, 0x20CF30,
+  0x20CFAE, 0x20D160, 0x20D276, 0x20D390, 0x20D5BF, 0x20D607, 0x20D778, 0x20D80B,
+  0x20DA22, 0x20DBAB, 0x20DCE6, 0x20DCFD, 0x20DE1E, 0x20DF73, 0x20DFB9, 0x20E09C,
+  0x20E2A8, 0x20E46F, 0x20E52A, 0x20E564, 0x20E6DF, 0x20E7B6, 0x20E874, 0x20E882,
+  0x20ED47, 0x20EE28, 0x20EFBD, 0x20F17C, 0x20F19E, 0x20F375, 0x20F3A3, 0x20F41B,
+  0x20F44F, 0x20F478, 0x20F543, 0x20F77C, 0x20F85E, 0x20FA85, 0x20FDF1, 0x20FE00,
+  0x2400BA, 0x2400FA, 0x24016F, 0x2401C7, 0x240588, 0x2405F5, 0x2406AA, 0x2406F2,
+  0x240935, 0x240995, 0x240A11, 0x240A63, 0x240A64, 0x240AC4, 0x240B0A, 0x240B88,
+  0x240DC2, 0x240F9B, 0x241145, 0x241153, 0x241281, 0x241551, 0x24161B, 0x24166D,
+  0x24169D, 0x24181D, 0x2418C6, 0x241AE6, 0x241B7A, 0x241D48, 0x241EEB, 0x241FA0,
+  0x241FBD, 0x2420C7, 0x242124, 0x2421AB, 0x242361, 0x24240E, 0x2424B7, 0x242642,
+  0x2426D6, 0x242730, 0x2428FD, 0x242934, 0x2429FE, 0x242A04, 0x242CFE, 0x242D6C,
+  0x242E02, 0x242FD0, 0x2430F8, 0x243154, 0x243184, 0x2432AE, 0x24336C, 0x2436DA,
+  0x24374C, 0x243FAA, 0x24418C, 0x244427, 0x24456B, 0x2446C8, 0x2446E4, 0x244845,
+  0x244B03, 0x244B81, 0x244BF1, 0x244BFE, 0x244C07, 0x244CAB, 0x244CE3, 0x24526A,
+  0x24586E, 0x24587C, 0x2459E5, 0x245A4C, 0x245A5F, 0x245AB5, 0x245B83, 0x245BA7,
+  0x245CC5, 0x245E48, 0x245F9F, 0x245FDF, 0x24615A, 0x2462AB, 0x2462CE, 0x24649F,
+  0x246511, 0x2468B0, 0x246968, 0x24698E, 0x2469A5, 0x246C60, 0x246C84, 0x246E96,
+  0x246F28, 0x246F8C, 0x247152, 0x247189, 0x2474F7, 0x24753A, 0x2475FC, 0x247625,
+  0x24767D, 0x247703, 0x24792A, 0x2479F3, 0x247D4D, 0x247E12, 0x247E51, 0x247F20,
+  0x247F3C, 0x24813B, 0x2481C7, 0x248A07, 0x248BE0, 0x2491BB, 0x24920E, 0x249494,
+  0x2494CB, 0x249504, 0x24952F, 0x249745, 0x249AC8, 0x249AD8, 0x249EAB, 0x249F89,
+  0x24A074, 0x24A160, 0x24A186, 0x24A2E1, 0x24A43C, 0x24A487, 0x24A52C, 0x24A65E,
+  0x24A6FA, 0x24A799, 0x24A7DC, 0x24A87D, 0x24AB81, 0x24ACAC, 0x24AF4A, 0x24B209,
+  0x24B2DE, 0x24B339, 0x24B657, 0x24B6FD, 0x24B72A, 0x24B7DA, 0x24BBC9, 0x24BCF8,
+  0x24BE05, 0x24C44A, 0x24C613, 0x24C696, 0x24C9A1, 0x24CACB, 0x24CD8D, 0x24CE33,
+  0x24CF24, 0x24D0DF, 0x24D337, 0x24D3F2, 0x24D5E4, 0x24D79C, 0x24D7EB, 0x24D921,
+  0x24DA33, 0x24DA9B, 0x24DBAC, 0x24DBED, 0x24DC0F, 0x24DCC3, 0x24DEC6, 0x24DF6A,
+  0x24DFA7, 0x24E271, 0x24E29D, 0x24E314, 0x24E4C8, 0x24E4CE, 0x24E50F, 0x24E853,
+  0x24E8CE, 0x24E8E5, 0x24E9B3, 0x24E9CA, 0x24EBED, 0x24EC99, 0x24EE9A, 0x24F094,
+  0x24F0D3, 0x24F27F, 0x24F5A2, 0x24F5AA, 0x24F603, 0x24F677, 0x24FB65, 0x24FC4E,
+  0x24FCE5, 0x24FD0D, 0x24FD52, 0x24FDFA, 0x24FE9A, 0x2800AF, 0x28011C, 0x28022E,
+  0x280244, 0x2802D8, 0x2804C6, 0x280AEE, 0x280B5C, 0x280DFC, 0x280FEB, 0x28107B,
+  0x2811A5, 0x2811A8, 0x2811EC, 0x281293, 0x28162E, 0x28167F, 0x2816A8, 0x2816AD,
+  0x281709, 0x281878, 0x281DFB, 0x28221E, 0x2823F5, 0x2824FF, 0x2827BF, 0x28285D,
+  0x282947, 0x282A87, 0x282B96, 0x282CB2, 0x282D06, 0x282D7F, 0x283152, 0x283166,
+  0x2831F8, 0x2832C5, 0x283334, 0x2834A2, 0x2834FF, 0x283545, 0x283737, 0x28385C,
+  0x283926, 0x28395E, 0x283A4D, 0x283B82, 0x283C90, 0x283CE4, 0x283DC2, 0x283F69,
+  0x2841C6, 0x2841EC, 0x2847AA, 0x2848E7, 0x284E44, 0x285261, 0x28534E, 0x285471,
+  0x28563A, 0x28565A, 0x2856C1, 0x285767, 0x2857BE, 0x285AEB, 0x285B0C, 0x285FDB,
+  0x286336, 0x2863BD, 0x2864B0, 0x2866E3, 0x2868D2, 0x286AB8, 0x286ABA, 0x286B35,
+  0x286C07, 0x286ED4, 0x286F40, 0x286F7F, 0x286FB9, 0x28704E, 0x2873F6, 0x2874F5,
+  0x2875D8, 0x287681, 0x287777, 0x2877F1, 0x287AEE, 0x287B09, 0x287E80, 0x287FCF,
+  0x288023, 0x288088, 0x28808A, 0x2880A2, 0x288335, 0x2883C9, 0x2884FA, 0x2887BA,
+  0x288A1C, 0x288CB8, 0x288EB9, 0x288EEC, 0x288FF6, 0x28924A, 0x28937D, 0x2893FE,
+  0x289401, 0x28940F, 0x28987B, 0x28993A, 0x289AF7, 0x289AFA, 0x289C6E, 0x289E97,
+  0x289EFC, 0x28A02B, 0x28A06B, 0x28A183, 0x28A24B, 0x28A331, 0x28A53F, 0x28A6DB,
+  0x28AC9E, 0x28AD18, 0x28AF42, 0x28AFFD, 0x28B2BD, 0x28B371, 0x28B448, 0x28B5E8,
+  0x28B829, 0x28BAB5, 0x28BBED, 0x28BC05, 0x28BD89, 0x28BE03, 0x28BE43, 0x28BE9B,
+  0x28BEF3, 0x28BF89, 0x28C01B, 0x28C0DA, 0x28C13C, 0x28C1A0, 0x28C21F, 0x28C2DD,
+  0x28C538, 0x28C5D2, 0x28C63F, 0x28C68E, 0x28C709, 0x28C7CE, 0x28C87A, 0x28C87C,
+  0x28CC01, 0x28CDC1, 0x28CDC4, 0x28CF08, 0x28CF51, 0x28CFDA, 0x28CFE9, 0x28D043,
+  0x28D0CB, 0x28D0EA, 0x28D0F5, 0x28D127, 0x28D1AF, 0x28D1B7, 0x28D244, 0x28D25A,
+  0x28D3EA, 0x28DBA7, 0x28DE65, 0x28DEA8, 0x28DEE5, 0x28DFEB, 0x28E02C, 0x28E14C,
+  0x28E31F, 0x28E347, 0x28E34E, 0x28E424, 0x28E5B0, 0x28E6A9, 0x28E71D, 0x28E7CF,
+  0x28E98E, 0x28EA0B, 0x28EA2D, 0x28EC22, 0x28EC95, 0x28EC9A, 0x28ED6A, 0x28EDE0,
+  0x28EE52, 0x28EF01, 0x28F033, 0x28F076, 0x28F10E, 0x28F366, 0x28F5D1, 0x28F7D6,
+  0x28FA19, 0x28FA7A, 0x28FAA0, 0x28FBAE, 0x28FBD3, 0x28FE65, 0x28FECD, 0x28FF3C,
+  0x28FF3E, 0x28FFB2, 0x2C002A, 0x2C00AB, 0x2C01B5, 0x2C0547, 0x2C0786, 0x2C0823,
+  0x2C088C, 0x2C08B4, 0x2C0BAB, 0x2C0BE9, 0x2C0DA7, 0x2C0E3D, 0x2C10C1, 0x2C1165,
+  0x2C15BF, 0x2C15D9, 0x2C15E1, 0x2C1809, 0x2C1875, 0x2C1A01, 0x2C1A05, 0x2C1DB8,
+  0x2C1F23, 0x2C200B, 0x2C2080, 0x2C2131, 0x2C2172, 0x2C233A, 0x2C26C5, 0x2C2768,
+  0x2C27D7, 0x2C282D, 0x2C2997, 0x2C2BF9, 0x2C3033, 0x2C3068, 0x2C3124, 0x2C326A,
+  0x2C3311, 0x2C3341, 0x2C3358, 0x2C3361, 0x2C337A, 0x2C36F8, 0x2C3996, 0x2C39C1,
+  0x2C3A91, 0x2C3AE8, 0x2C3AFD, 0x2C3B70, 0x2C3ECF, 0x2C3F0B, 0x2C3F38, 0x2C4053,
+  0x2C4138, 0x2C41A1, 0x2C4205, 0x2C431A, 0x2C43BE, 0x2C4401, 0x2C44FD, 0x2C4881,
+  0x2C4A11, 0x2C4C15, 0x2C4CC6, 0x2C4D54, 0x2C4D79, 0x2C4DDE, 0x2C4F52, 0x2C52AF,
+  0x2C532B, 0x2C53D7, 0x2C542D, 0x2C5491, 0x2C54CF, 0x2C557C, 0x2C55D3, 0x2C56DC,
+  0x2C572C, 0x2C5731, 0x2C5741, 0x2C57CE, 0x2C584F, 0x2C58B9, 0x2C58E8, 0x2C598A,
+  0x2C59E5, 0x2C5A05, 0x2C5A0F, 0x2C5BB8, 0x2C5D34, 0x2C5D93, 0x2C600C, 0x2C6104,
+  0x2C61F6, 0x2C6373, 0x2C641F, 0x2C64F6, 0x2C67BE, 0x2C693E, 0x2C6B7D, 0x2C6BF5,
+  0x2C6DC1, 0x2C6E85, 0x2C6FC9, 0x2C704F, 0x2C71FF, 0x2C7360, 0x2C73A0, 0x2C7600,
+  0x2C768A, 0x2C780E, 0x2C784C, 0x2C79D7, 0x2C7BA0, 0x2C7CE4, 0x2C7CF2, 0x2C7E81,
+  0x2C8158, 0x2C81BF, 0x2C8217, 0x2C86D2, 0x2C8A72, 0x2C8AC7, 0x2C8DB1, 0x2C91AB,
+  0x2C93FB, 0x2C9452, 0x2C9569, 0x2C957F, 0x2C9682, 0x2C97B1, 0x2C9811, 0x2C9924,
+  0x2C9975, 0x2C9C58, 0x2C9D1E, 0x2C9D65, 0x2C9E00, 0x2C9E5F, 0x2C9EFC, 0x2C9FFB,
+  0x2CA042, 0x2CA17D, 0x2CA59C, 0x2CA774, 0x2CA79E, 0x2CA7EF, 0x2CA835, 0x2CA9F0,
+  0x2CAA8E, 0x2CAB00, 0x2CAB25, 0x2CAB33, 0x2CAB46, 0x2CABA4, 0x2CABEB, 0x2CAE2B,
+  0x2CB05D, 0x2CB0FD, 0x2CB115, 0x2CB21A, 0x2CB301, 0x2CB43A, 0x2CB68F, 0x2CB6C8,
+  0x2CBABA, 0x2CBC87, 0x2CBE08, 0x2CC253, 0x2CC260, 0x2CC3E6, 0x2CC546, 0x2CC5D3,
+  0x2CC81B, 0x2CC8F5, 0x2CCC15, 0x2CCC44, 0x2CCCE6, 0x2CCF58, 0x2CD02D, 0x2CD05A,
+  0x2CD066, 0x2CD1C6, 0x2CD1DA, 0x2CD26B, 0x2CD2E7, 0x2CD444, 0x2CD974, 0x2CDB07,
+  0x2CDCAD, 0x2CDCD7, 0x2CDD5F, 0x2CDD95, 0x2CDDE9, 0x2CE032, 0x2CE412, 0x2CE6CC,
+  0x2CEA7F, 0x2CEADC, 0x2CECF7, 0x2CEDB0, 0x2CF05D, 0x2CF0A2, 0x2CF0EE, 0x2CF1BB,
+  0x2CF295, 0x2CF2A5, 0x2CF432, 0x2CF4C5, 0x2CF89B, 0x2CFAA2, 0x2CFC8B, 0x2CFDA1,
+  0x2CFDAB, 0x2CFDB3, 0x2CFDB4, 0x2CFE4F, 0x2CFEE2, 0x2CFF65, 0x2CFFEE, 0x3003C8,
+  0x30045C, 0x300505, 0x30055C, 0x30074D, 0x3009C0, 0x300C23, 0x300D43, 0x300D9E,
+  0x300EB8, 0x300ED5, 0x3010B3, 0x3010E4, 0x30138B, 0x30144A, 0x3017C8, 0x301966,
+  0x301984, 0x301ABA, 0x301F48, 0x302303, 0x302364, 0x302432, 0x302478, 0x3024A9,
+  0x302952, 0x302F1E, 0x3030F9, 0x303180, 0x303235, 0x303422, 0x3034D2, 0x3035AD,
+  0x3035C5, 0x3037A6, 0x3037B3, 0x303855, 0x303926, 0x3039F2, 0x303A4A, 0x303A64,
+  0x303B7C, 0x303EA7, 0x303F7B, 0x303FBB, 0x304074, 0x304240, 0x304487, 0x304511,
+  0x304596, 0x30469A, 0x30499E, 0x304A26, 0x304B07, 0x304C7E, 0x304E1B, 0x304F00,
+  0x304F75, 0x305075, 0x3050CE, 0x3050FD, 0x3052CB, 0x3053C1, 0x305696, 0x305714,
+  0x30578E, 0x3059B7, 0x305A3A, 0x305A99, 0x305F77, 0x30600A, 0x306023, 0x30636B,
+  0x306371, 0x3066D0, 0x3067A1, 0x30694B, 0x306A85, 0x307467, 0x307496, 0x307512,
+  0x30766F, 0x307BAC, 0x307BC9, 0x307C30, 0x307C4A, 0x307C5E, 0x307ECB, 0x307F10,
+  0x30809B, 0x308216, 0x308398, 0x3083D2, 0x308454, 0x3085A9, 0x3085EB, 0x30862D,
+  0x3086F1, 0x308730, 0x3087D9, 0x308841, 0x30894A, 0x308AF7, 0x308BB2, 0x308D99,
+  0x308DD4, 0x308E7A, 0x308ECF, 0x309048, 0x3090AB, 0x309176, 0x30918F, 0x3093BC,
+  0x309435, 0x309587, 0x309610, 0x30963B, 0x3096FB, 0x309935, 0x309BAD, 0x309C23,
+  0x309E1D, 0x30A176, 0x30A1FA, 0x30A2C2, 0x30A30F, 0x30A8DB, 0x30A998, 0x30A9DE,
+  0x30AAE4, 0x30AB6A, 0x30AEA4, 0x30AF7E, 0x30AFCE, 0x30B037, 0x30B1B5, 0x30B237,
+  0x30B49E, 0x30B4B8, 0x30B5C2, 0x30B62D, 0x30B64F, 0x30B7D4, 0x30B851, 0x30B930,
+  0x30BB7D, 0x30BE3B, 0x30C01B, 0x30C3D9, 0x30C507, 0x30C50F, 0x30C6D7, 0x30C6F7,
+  0x30C7AE, 0x30C922, 0x30C9AB, 0x30CBC7, 0x30CBF8, 0x30CC21, 0x30CDA7, 0x30D042,
+  0x30D16B, 0x30D17E, 0x30D32D, 0x30D386, 0x30D53E, 0x30D587, 0x30D6C9, 0x30D7A1,
+  0x30D875, 0x30D9D9, 0x30DCE7, 0x30DE4B, 0x30DF17, 0x30DF8D, 0x30E04F, 0x30E171,
+  0x30E1F1, 0x30E283, 0x30E37A, 0x30E396, 0x30E4DB, 0x30E7BC, 0x30E8E4, 0x30E98E,
+  0x30F31D, 0x30F335, 0x30F600, 0x30F6EF, 0x30F70D, 0x30F772, 0x30F7C5, 0x30F94B,
+  0x30F9ED, 0x30FB10, 0x30FBB8, 0x30FC68, 0x30FCEB, 0x30FD38, 0x30FD65, 0x30FE31,
+  0x30FFFD, 0x3400A3, 0x340286, 0x3403DE, 0x3407FB, 0x340804, 0x3408BC, 0x3408E1,
+  0x340962, 0x340A33, 0x340A98, 0x340AFF, 0x3410F4, 0x341298, 0x3412F9, 0x3413E8,
+  0x34145F, 0x3414B5, 0x341513, 0x341593, 0x34159E, 0x3417EB, 0x341A35, 0x341B2D,
+  0x341CF0, 0x341E6B, 0x341FE4, 0x3420E3, 0x342387, 0x3423BA, 0x34243E, 0x3425B4,
+  0x3425BE, 0x342792, 0x342840, 0x342912, 0x3429EF, 0x342AF1, 0x342B6E, 0x342CC4,
+  0x342D0D, 0x342DA3, 0x342EB6, 0x342EB7, 0x342FBD, 0x343111, 0x34317F, 0x34318F,
+  0x3431C4, 0x34363B, 0x343654, 0x343759, 0x3438B7, 0x343A20, 0x343D98, 0x343DC4,
+  0x343EA4, 0x3440B5, 0x34415D, 0x344262, 0x3446EC, 0x34479A, 0x3447D4, 0x3448ED,
+  0x34495B, 0x344B3D, 0x344B50, 0x344DEA, 0x344DF7, 0x344E2F, 0x345180, 0x345184,
+  0x3451C9, 0x3453D2, 0x345594, 0x3456FE, 0x345760, 0x345840, 0x345A06, 0x345B98,
+  0x345BBB, 0x345D9E, 0x345DA8, 0x345E08, 0x3460F9, 0x346288, 0x3462B4, 0x3464A9,
+  0x346679, 0x346895, 0x3468B5, 0x346987, 0x346AC2, 0x346B46, 0x346B5B, 0x346BD3,
+  0x346D9C, 0x346E9D, 0x346F24, 0x346F90, 0x347146, 0x34732D, 0x34735A, 0x347563,
+  0x3475C7, 0x3476C5, 0x347839, 0x3478D7, 0x347916, 0x347A60, 0x347C25, 0x347DE4,
+  0x347DF6, 0x347E00, 0x347E39, 0x347E5C, 0x3480B3, 0x3481C4, 0x3482C5, 0x348446,
+  0x3484E4, 0x348511, 0x348518, 0x348584, 0x34865D, 0x34873D, 0x348818, 0x34885D,
+  0x348A12, 0x348A7B, 0x348AAE, 0x348B75, 0x348C5E, 0x348D52, 0x348F27, 0x349454,
+  0x349672, 0x349677, 0x3497F6, 0x34987A, 0x3498B5, 0x349F7B, 0x34A2A2, 0x34A395,
+  0x34A6EF, 0x34A843, 0x34A84E, 0x34A8EB, 0x34AA31, 0x34AA8B, 0x34AA99, 0x34AB37,
+  0x34AB95, 0x34AC11, 0x34AD61, 0x34AF2C, 0x34AFB3, 0x34B1EB, 0x34B1F7, 0x34B20A,
+  0x34B354, 0x34B472, 0x34B5A3, 0x34B7DA, 0x34B883, 0x34B98D, 0x34BB1F, 0x34BB26,
+  0x34BDC8, 0x34BDFA, 0x34BE00, 0x34BF90, 0x34C059, 0x34C0F9, 0x34C3AC, 0x34C3D2,
+  0x34C515, 0x34C731, 0x34C7E9, 0x34C803, 0x34C93D, 0x34CA81, 0x34CDBE, 0x34CE00,
+  0x34CE69, 0x34CFF6, 0x34D262, 0x34D270, 0x34D693, 0x34D856, 0x34DAB7, 0x34DB9C,
+  0x34DBFD, 0x34DC99, 0x34DE1A, 0x34DE34, 0x34E0CF, 0x34E12D, 0x34E2FD, 0x34E380,
+  0x34E3FB, 0x34E5EC, 0x34E6AD, 0x34E6D7, 0x34E71C, 0x34E894, 0x34E911, 0x34EA34,
+  0x34EAE7, 0x34ECB6, 0x34ED1B, 0x34EE16, 0x34EE2A, 0x34EF44, 0x34EFB6, 0x34F043,
+  0x34F150, 0x34F39A, 0x34F62D, 0x34F64B, 0x34F716, 0x34F8E7, 0x34FA9F, 0x34FCB9,
+  0x34FCEF, 0x34FD6A, 0x34FE77, 0x380025, 0x380146, 0x380195, 0x38019F, 0x3802DE,
+  0x380716, 0x380A94, 0x380B3C, 0x380B40, 0x380DD4, 0x380E4D, 0x380F4A, 0x380FAD,
+  0x3810D5, 0x3810F0, 0x381428, 0x38144E, 0x381672, 0x3816D1, 0x3817C3, 0x3817E1,
+  0x38184C, 0x38192F, 0x381A52, 0x381C1A, 0x381C4A, 0x381DD9, 0x381F8D, 0x382028,
+  0x382056, 0x3821C7, 0x38229D, 0x3822D6, 0x3822E2, 0x3822F4, 0x3824F1, 0x38256B,
+  0x382656, 0x38295A, 0x382C4A, 0x382DD1, 0x382DE8, 0x3830F9, 0x3835FB, 0x38378B,
+  0x38384B, 0x3838A6, 0x38396C, 0x38398F, 0x383BC8, 0x383D5B, 0x383FB3, 0x38420B,
+  0x38437D, 0x38453B, 0x384554, 0x384608, 0x3847BC, 0x38484C, 0x384A80, 0x384B24,
+  0x384C4F, 0x384C90, 0x384F49, 0x384FF0, 0x38521A, 0x385247, 0x38539C, 0x38549B,
+  0x38563D, 0x3859F9, 0x385B44, 0x385C76, 0x385CFB, 0x385F66, 0x386077, 0x38637F,
+  0x3863BB, 0x386407, 0x386504, 0x3865B2, 0x3866F0, 0x386893, 0x3868A4, 0x3868BE,
+  0x3868DD, 0x386A77, 0x386B1C, 0x386BBB, 0x386E88, 0x386EA2, 0x386F6B, 0x38700C,
+  0x3871DE, 0x3872C0, 0x387862, 0x387A0E, 0x387A3C, 0x387C76, 0x3880DF, 0x3881D7,
+  0x388345, 0x38839A, 0x388479, 0x3886F7, 0x3887D5, 0x38881E, 0x388871, 0x3888A4,
+  0x38892C, 0x388A06, 0x388ABE, 0x388B59, 0x388C50, 0x388F30, 0x389052, 0x3890A5,
+  0x3890AF, 0x3891B7, 0x3891D5, 0x389461, 0x389496, 0x3894E0, 0x3894ED, 0x389592,
+  0x3897A4, 0x3897D6, 0x3898E9, 0x389AF6, 0x389CB2, 0x389D92, 0x389E80, 0x38A067,
+  0x38A28C, 0x38A44B, 0x38A4ED, 0x38A659, 0x38A6CE, 0x38A746, 0x38A89B, 0x38A91C,
+  0x38AA3C, 0x38AB41, 0x38AD2B, 0x38AD8E, 0x38ADBE, 0x38AF29, 0x38AFD7, 0x38B1DB,
+  0x38B3F7, 0x38B4D3, 0x38B54D, 0x38B5C9, 0x38B725, 0x38B800, 0x38BAB0, 0x38BAF8,
+  0x38BB3C, 0x38BC01, 0x38BC1A, 0x38BD7A, 0x38BEAB, 0x38C096, 0x38C0EA, 0x38C6BD,
+  0x38C804, 0x38C85C, 0x38C986, 0x38CA73, 0x38CA84, 0x38CADA, 0x38D269, 0x38D2CA,
+  0x38D40B, 0x38D547, 0x38D57A, 0x38D82F, 0x38DEAD, 0x38E08E, 0x38E1AA, 0x38E1F4,
+  0x38E2DD, 0x38E39F, 0x38E3C5, 0x38E595, 0x38E60A, 0x38E7C0, 0x38E7D8, 0x38EAA7,
+  0x38EB47, 0x38EC0D, 0x38ECE4, 0x38ED18, 0x38EFE3, 0x38F0C8, 0x38F23E, 0x38F32E,
+  0x38F3AB, 0x38F6CF, 0x38F73D, 0x38F7F1, 0x38F85E, 0x38F889, 0x38F8F6, 0x38F9D3,
+  0x38F9F5, 0x38FACA, 0x38FB14, 0x38FC34, 0x38FC98, 0x38FDF5, 0x38FDF8, 0x38FF36,
+  0x3C01EF, 0x3C0461, 0x3C0518, 0x3C058E, 0x3C0630, 0x3C06A7, 0x3C0754, 0x3C0771,
+  0x3C08CD, 0x3C08F6, 0x3C0A7A, 0x3C0AF3, 0x3C0B4F, 0x3C0CDB, 0x3C0E23, 0x3C1060,
+  0x3C135A, 0x3C13BB, 0x3C13CC, 0x3C15C2, 0x3C15FB, 0x3C1710, 0x3C189F, 0x3C18A0,
+  0x3C195E, 0x3C197D, 0x3C19CB, 0x3C1BF8, 0x3C1E04, 0x3C1EB5, 0x3C2093, 0x3C20F6,
+  0x3C219C, 0x3C22FB, 0x3C25D7, 0x3C25F8, 0x3C26E4, 0x3C286D, 0x3C28A6, 0x3C2AF4,
+  0x3C2C30, 0x3C2C99, 0x3C2CA6, 0x3C2D9E, 0x3C2DB7, 0x3C2EF5, 0x3C2EF9, 0x3C2EFF,
+  0x3C306F, 0x3C3174, 0x3C3300, 0x3C3332, 0x3C3576, 0x3C363D, 0x3C366A, 0x3C36E4,
+  0x3C3712, 0x3C3786, 0x3C38F4, 0x3C39C8, 0x3C3A73, 0x3C3B99, 0x3C410E, 0x3C438E,
+  0x3C457A, 0x3C46A1, 0x3C46D8, 0x3C4711, 0x3C4A92, 0x3C4CD0, 0x3C4DBE, 0x3C4E56,
+  0x3C510E, 0x3C5282, 0x3C52A1, 0x3C5447, 0x3C5576, 0x3C55DB, 0x3C5731, 0x3C574F,
+  0x3C576C, 0x3C585D, 0x3C58C2, 0x3C591E, 0x3C5A37, 0x3C5AB4, 0x3C5CC4, 0x3C5CF1,
+  0x3C5D29, 0x3C5EC3, 0x3C6104, 0x3C6105, 0x3C6200, 0x3C62F0, 0x3C678C, 0x3C6A48,
+  0x3C6AA7, 0x3C6D66, 0x3C6D89, 0x3C6F9B, 0x3C71BF, 0x3C7437, 0x3C754A, 0x3C77E6,
+  0x3C7843, 0x3C7A8A, 0x3C7AAA, 0x3C7AF0, 0x3C7C3F, 0x3C7D0A, 0x3C7DB1, 0x3C7F6F,
+  0x3C81D8, 0x3C82C0, 0x3C8375, 0x3C8427, 0x3C846A, 0x3C869A, 0x3C86D1, 0x3C8994,
+  0x3C8AB0, 0x3C8B7F, 0x3C8BCD, 0x3C8BFE, 0x3C8C40, 0x3C8C93, 0x3C8CF8, 0x3C8D20,
+  0x3C9066, 0x3C90E0, 0x3C9157, 0x3C9180, 0x3C93F4, 0x3C94D5, 0x3C9509, 0x3C970E,
+  0x3C9872, 0x3C9A77, 0x3C9BC6, 0x3C9BD6, 0x3C9C0F, 0x3C9D56, 0x3C9EC7, 0x3CA067,
+  0x3CA10D, 0x3CA161, 0x3CA2C3, 0x3CA308, 0x3CA348, 0x3CA37E, 0x3CA581, 0x3CA616,
+  0x3CA62F, 0x3CA6F6, 0x3CA72B, 0x3CA7AE, 0x3CA82A, 0x3CA916, 0x3CA9F4, 0x3CAB8E,
+  0x3CAFB7, 0x3CB15B, 0x3CB233, 0x3CB6B7, 0x3CB74B, 0x3CB87A, 0x3CBBFD, 0x3CBCD0,
+  0x3CBD3E, 0x3CBDC5, 0x3CBDD8, 0x3CBF60, 0x3CC03E, 0x3CC243, 0x3CCA61, 0x3CCB7C,
+  0x3CCD36, 0x3CCD57, 0x3CCD5D, 0x3CCD93, 0x3CCE73, 0x3CCFB4, 0x3CD0F8, 0x3CD2E5,
+  0x3CD92B, 0x3CDA2A, 0x3CDCBC, 0x3CDF1E, 0x3CDFA9, 0x3CDFBD, 0x3CE002, 0x3CE064,
+  0x3CE072, 0x3CE1A1, 0x3CE36B, 0x3CE3E7, 0x3CE441, 0x3CE4B0, 0x3CE5A6, 0x3CE824,
+  0x3CE90E, 0x3CE9F7, 0x3CEA4F, 0x3CECDE, 0x3CECEF, 0x3CEF42, 0x3CEF8C, 0x3CF011,
+  0x3CF591, 0x3CF5CC, 0x3CF652, 0x3CF692, 0x3CF72A, 0x3CF7A4, 0x3CF808, 0x3CF862,
+  0x3CF9F0, 0x3CFA06, 0x3CFA30, 0x3CFA43, 0x3CFB5C, 0x3CFDFE, 0x3CFEAC, 0x3CFFD8,
+  0x40017A, 0x4001C6, 0x400634, 0x4006A0, 0x4006D5, 0x400D10, 0x400E85, 0x400EF3,
+  0x400FC1, 0x4011C3, 0x401482, 0x4014AD, 0x40163B, 0x40167E, 0x40169F, 0x4018B1,
+  0x401A58, 0x401B5F, 0x401C83, 0x402230, 0x4022D8, 0x402343, 0x4024B2, 0x4025C2,
+  0x402619, 0x402A8F, 0x402B50, 0x402BA1, 0x402CF4, 0x402E71, 0x402F86, 0x403004,
+  0x40313C, 0x403306, 0x40331A, 0x4035E6, 0x403B7B, 0x403CFC, 0x403DEC, 0x403F8C,
+  0x404022, 0x404028, 0x4040A7, 0x404101, 0x40410D, 0x404244, 0x4044FD, 0x4045C4,
+  0x40475E, 0x40490F, 0x404A03, 0x404C77, 0x404CCA, 0x404D7F, 0x404D8E, 0x404E36,
+  0x404F42, 0x405539, 0x405582, 0x405899, 0x405BD8, 0x405CFD, 0x405D82, 0x405EF6,
+  0x405F7D, 0x405FBE, 0x405FC2, 0x406186, 0x406234, 0x4062EA, 0x4064A4, 0x4065A3,
+  0x40679B, 0x406AAB, 0x406C8F, 0x406F27, 0x406F2A, 0x407009, 0x4070F5, 0x407183,
+  0x407218, 0x4074E0, 0x4075C3, 0x4076A9, 0x4077A9, 0x40786A, 0x407912, 0x407A80,
+  0x407C7D, 0x407D0F, 0x407F5F, 0x4080E1, 0x40831D, 0x4083DE, 0x408432, 0x4086CB,
+  0x408805, 0x40882F, 0x408B07, 0x408C1F, 0x408C4C, 0x408D5C, 0x408E2C, 0x408EDF,
+  0x408EF6, 0x408F9D, 0x409151, 0x40921A, 0x40984E, 0x4098AD, 0x409922, 0x409A30,
+  0x409B21, 0x409BCD, 0x409C28, 0x409EA4, 0x409F38, 0x40A108, 0x40A2DB, 0x40A3CC,
+  0x40A53B, 0x40A5EF, 0x40A677, 0x40A6B7, 0x40A6D9, 0x40A6E8, 0x40A8F0, 0x40A9CF,
+  0x40AA56, 0x40ACBF, 0x40AE30, 0x40B034, 0x40B076, 0x40B0FA, 0x40B15C, 0x40B2C8,
+  0x40B30E, 0x40B31E, 0x40B395, 0x40B4CD, 0x40B4F0, 0x40B5C1, 0x40B607, 0x40B6E7,
+  0x40B70E, 0x40B7F3, 0x40B7FC, 0x40B82D, 0x40B837, 0x40B89A, 0x40B93C, 0x40BA61,
+  0x40BC60, 0x40BC68, 0x40BD32, 0x40C2BA, 0x40C3BC, 0x40C711, 0x40C729, 0x40CBA8,
+  0x40CBC0, 0x40CD7A, 0x40CE24, 0x40D160, 0x40D25F, 0x40D28A, 0x40D32D, 0x40D3AE,
+  0x40D4F6, 0x40D95A, 0x40DA5C, 0x40DCA5, 0x40DE24, 0x40DEAD, 0x40E171, 0x40E1E4,
+  0x40E230, 0x40E317, 0x40E3D6, 0x40E64B, 0x40E99B, 0x40EC99, 0x40ECF8, 0x40ED00,
+  0x40EDCF, 0x40EE15, 0x40EEBE, 0x40EEDD, 0x40EF4C, 0x40F02F, 0x40F04E, 0x40F078,
+  0x40F201, 0x40F21C, 0x40F2E9, 0x40F308, 0x40F3B0, 0x40F407, 0x40F420, 0x40F4EC,
+  0x40F4FD, 0x40F520, 0x40F6BC, 0x40F8DF, 0x40F946, 0x40FAFE, 0x40FC89, 0x40FDF3,
+  0x40FE95, 0x440010, 0x440049, 0x44004D, 0x4401BB, 0x44032C, 0x4403A7, 0x440444,
+  0x44053F, 0x44070B, 0x441102, 0x441244, 0x4413D0, 0x441622, 0x4416FA, 0x441793,
+  0x4418FD, 0x4419B6, 0x441A84, 0x441AFA, 0x441B88, 0x441C12, 0x441C7F, 0x441CA8,
+  0x441DB1, 0x441E98, 0x441EA1, 0x44227C, 0x442295, 0x44237C, 0x44272E, 0x44291E,
+  0x442A60, 0x442B03, 0x442C05, 0x44303F, 0x443192, 0x44322A, 0x443262, 0x4432C8,
+  0x44334C, 0x4434A7, 0x443583, 0x4435D3, 0x4437E6, 0x4439C4, 0x443B32, 0x443D54,
+  0x4441F0, 0x444201, 0x444687, 0x4447CC, 0x4448B9, 0x4448C1, 0x4448FF, 0x444988,
+  0x444ADB, 0x444B7E, 0x444C0C, 0x444CA8, 0x444E1A, 0x444E6D, 0x444F8E, 0x4455B1,
+  0x4455C4, 0x4456E2, 0x445829, 0x445943, 0x4459E3, 0x445BED, 0x445CE9, 0x446370,
+  0x44643C, 0x44650D, 0x44657F, 0x4466FC, 0x446747, 0x44680C, 0x446A2E, 0x446AB7,
+  0x446B1F, 0x446D57, 0x446D6C, 0x446D7F, 0x446EE5, 0x447147, 0x4473D6, 0x44746C,
+  0x447654, 0x44783E, 0x447BBB, 0x4480EB, 0x4482E5, 0x448500, 0x448502, 0x4487FC,
+  0x448816, 0x448A5B, 0x448C00, 0x448EEC, 0x448F17, 0x449046, 0x4490BB, 0x449160,
+  0x44917C, 0x4494FC, 0x44975A, 0x449BC1, 0x449EF9, 0x449F46, 0x44A038, 0x44A191,
+  0x44A3C7, 0x44A42D, 0x44A54E, 0x44A56E, 0x44A61E, 0x44A642, 0x44A7CF, 0x44A842,
+  0x44A8FC, 0x44AA50, 0x44AAF5, 0x44ADB1, 0x44ADD9, 0x44AE25, 0x44AE44, 0x44AEAB,
+  0x44AF28, 0x44B295, 0x44B32D, 0x44B462, 0x44B4B2, 0x44B6BE, 0x44B7D0, 0x44BA46,
+  0x44BB3B, 0x44C15C, 0x44C346, 0x44C3B6, 0x44C65D, 0x44C7FC, 0x44C874, 0x44CB8B,
+  0x44CD0E, 0x44CE7D, 0x44D244, 0x44D3AD, 0x44D3CA, 0x44D437, 0x44D453, 0x44D454,
+  0x44D47F, 0x44D4E0, 0x44D506, 0x44D5C1, 0x44D5CC, 0x44D77E, 0x44D791, 0x44D832,
+  0x44D878, 0x44D884, 0x44D9E7, 0x44DA30, 0x44DBD2, 0x44DC4E, 0x44DC91, 0x44DF65,
+  0x44E08E, 0x44E137, 0x44E2F8, 0x44E4D9, 0x44E4E6, 0x44E4EE, 0x44E517, 0x44E64A,
+  0x44E66E, 0x44E6B0, 0x44E761, 0x44E968, 0x44E9DD, 0x44EA30, 0x44EAD8, 0x44EB2E,
+  0x44ECCE, 0x44EE02, 0x44EE14, 0x44EFBF, 0x44F034, 0x44F09E, 0x44F21B, 0x44F436,
+  0x44F459, 0x44F477, 0x44F770, 0x44F971, 0x44FA66, 0x44FB42, 0x44FB5A, 0x44FE3B,
+  0x44FFBA, 0x480020, 0x480031, 0x480033, 0x4800B3, 0x4801C5, 0x480286, 0x48049F,
+  0x4805E2, 0x48062B, 0x480C49, 0x480EEC, 0x480FCF, 0x481258, 0x48128F, 0x48137E,
+  0x4813F3, 0x481693, 0x48188D, 0x481B40, 0x481BA4, 0x481CB9, 0x481D70, 0x481F66,
+  0x48210B, 0x48216C, 0x482218, 0x482254, 0x4825F3, 0x48262C, 0x4827C5, 0x4827E2,
+  0x4827EA, 0x48282F, 0x482952, 0x4829D6, 0x4829E4, 0x482AE3, 0x482CA0, 0x482CD0,
+  0x482E72, 0x482F6B, 0x482FD7, 0x483177, 0x4831B7, 0x4831DB, 0x48352B, 0x483543,
+  0x483871, 0x483B38, 0x483C0C, 0x483E5E, 0x483FDA, 0x483FE9, 0x48417B, 0x48435A,
+  0x48437C, 0x4843DD, 0x484487, 0x4844F7, 0x484520, 0x4845CF, 0x4846C1, 0x4846FB,
+  0x48474B, 0x4849C7, 0x484AE9, 0x484BAA, 0x484BD4, 0x484C29, 0x484C86, 0x484D7E,
+  0x484EFC, 0x485073, 0x485169, 0x4851B7, 0x4851C5, 0x4851CF, 0x485519, 0x485541,
+  0x48555C, 0x48555E, 0x48555F, 0x485702, 0x4857D2, 0x485929, 0x4859A4, 0x485A0D,
+  0x485AB6, 0x485AEA, 0x485B39, 0x485D35, 0x485D36, 0x485D60, 0x485DED, 0x485F08,
+  0x485F99, 0x485FDF, 0x48605F, 0x4860BC, 0x4861EE, 0x486276, 0x486345, 0x48684A,
+  0x486B2C, 0x486DBB, 0x486E70, 0x48701E, 0x48706F, 0x487310, 0x487397, 0x4873CB,
+  0x487410, 0x487412, 0x48746E, 0x487604, 0x487706, 0x487746, 0x4877BD, 0x48785E,
+  0x48794D, 0x487ADA, 0x487AFF, 0x487B6B, 0x487D2E, 0x487E48, 0x488002, 0x4881D4,
+  0x48836F, 0x4883B4, 0x4883C7, 0x48849D, 0x4886E8, 0x488759, 0x488764, 0x4887B8,
+  0x488899, 0x4888CA, 0x4889E7, 0x488AD2, 0x488AE8, 0x488B0A, 0x488C63, 0x488D36,
+  0x488EB7, 0x488EEF, 0x488F5A, 0x48902F, 0x4891D5, 0x489507, 0x4898CA, 0x489A5B,
+  0x489BD5, 0x489BE0, 0x489D24, 0x489DD1, 0x489E9D, 0x489EBD, 0x489ECB, 0x48A0F8,
+  0x48A195, 0x48A2E6, 0x48A380, 0x48A3BD, 0x48A472, 0x48A493, 0x48A516, 0x48A5E7,
+  0x48A6B8, 0x48A73C, 0x48A74E, 0x48A91C, 0x48A98A, 0x48A9D2, 0x48AD08, 0x48AD9A,
+  0x48B02D, 0x48B25D, 0x48B423, 0x48B4C3, 0x48B8A3, 0x48BA4E, 0x48BCE1, 0x48BD3D,
+  0x48BD4A, 0x48BDA7, 0x48BDCE, 0x48BF6B, 0x48C093, 0x48C1AC, 0x48C1EE, 0x48C461,
+  0x48C58D, 0x48C796, 0x48CA43, 0x48CAC6, 0x48CDD3, 0x48D0CF, 0x48D224, 0x48D24F,
+  0x48D343, 0x48D35D, 0x48D539, 0x48D6D5, 0x48D705, 0x48D890, 0x48DB50, 0x48DC2D,
+  0x48DCFB, 0x48DD0C, 0x48DD9D, 0x48DF37, 0x48E15C, 0x48E244, 0x48E533, 0x48E6C0,
+  0x48E729, 0x48E7DA, 0x48E9F1, 0x48EA63, 0x48EB62, 0x48EC5B, 0x48EDE6, 0x48EE0C,
+  0x48EF61, 0x48F07B, 0x48F17F, 0x48F317, 0x48F3F3, 0x48F7C0, 0x48F7F1, 0x48F8B3,
+  0x48F8DB, 0x48F8E1, 0x48F97C, 0x48FCB6, 0x48FD8E, 0x48FDA3, 0x4C0082, 0x4C0143,
+  0x4C0220, 0x4C034F, 0x4C0617, 0x4C09B4, 0x4C09D4, 0x4C0B3A, 0x4C0BBE, 0x4C0F6E,
+  0x4C0FC7, 0x4C10D5, 0x4C1154, 0x4C11AE, 0x4C11BF, 0x4C1265, 0x4C14A3, 0x4C16F1,
+  0x4C16FC, 0x4C1744, 0x4C17EB, 0x4C189A, 0x4C195D, 0x4C1A3D, 0x4C1B86, 0x4C1D96,
+  0x4C1FCC, 0x4C20B8, 0x4C2113, 0x4C21D0, 0x4C22F3, 0x4C231A, 0x4C2498, 0x4C24CE,
+  0x4C2578, 0x4C2E5E, 0x4C2EB4, 0x4C2FD7, 0x4C312D, 0x4C3275, 0x4C3488, 0x4C38D8,
+  0x4C3BDF, 0x4C3C16, 0x4C3FD3, 0x4C421E, 0x4C4341, 0x4C445B, 0x4C494F, 0x4C496C,
+  0x4C49E3, 0x4C4CD8, 0x4C4D66, 0x4C4E03, 0x4C4E35, 0x4C4FEE, 0x4C5077, 0x4C50DD,
+  0x4C50F1, 0x4C5262, 0x4C53FD, 0x4C5499, 0x4C569D, 0x4C5739, 0x4C57CA, 0x4C5BB3,
+  0x4C5CDF, 0x4C5D3C, 0x4C5E0C, 0x4C5F70, 0x4C5FD2, 0x4C60BA, 0x4C60DE, 0x4C617E,
+  0x4C62CD, 0x4C62DF, 0x4C6371, 0x4C63AD, 0x4C6641, 0x4C66A6, 0x4C6AF6, 0x4C6BE8,
+  0x4C6D58, 0x4C6F9C, 0x4C710C, 0x4C710D, 0x4C7274, 0x4C72B9, 0x4C734F, 0x4C74BF,
+  0x4C7525, 0x4C7625, 0x4C7713, 0x4C7766, 0x4C776D, 0x4C77CB, 0x4C796E, 0x4C7975,
+  0x4C79BA, 0x4C7C5F, 0x4C7CD9, 0x4C7F62, 0x4C8093, 0x4C80BA, 0x4C8120, 0x4C82A9,
+  0x4C82CF, 0x4C83DE, 0x4C875D, 0x4C889E, 0x4C8B30, 0x4C8BEF, 0x4C8D53, 0x4C8D79,
+  0x4C9157, 0x4C9614, 0x4C968A, 0x4C97CC, 0x4C9992, 0x4C9B63, 0x4C9EFF, 0x4CA0D4,
+  0x4CA3A7, 0x4CA56D, 0x4CA64D, 0x4CA74B, 0x4CA919, 0x4CAB4F, 0x4CABF8, 0x4CABFC,
+  0x4CAC0A, 0x4CAE13, 0x4CAEA3, 0x4CB04A, 0x4CB087, 0x4CB16C, 0x4CB199, 0x4CB1CD,
+  0x4CB7E0, 0x4CB82C, 0x4CB8B5, 0x4CB910, 0x4CB911, 0x4CB99B, 0x4CBA7D, 0x4CBAD7,
+  0x4CBB58, 0x4CBC48, 0x4CBCA5, 0x4CBCE9, 0x4CBD8F, 0x4CC00A, 0x4CC449, 0x4CC53E,
+  0x4CC64C, 0x4CC7D6, 0x4CC8A1, 0x4CC94F, 0x4CC95E, 0x4CCBF5, 0x4CCC34, 0x4CCC6A,
+  0x4CD08A, 0x4CD0CB, 0x4CD0DD, 0x4CD1A1, 0x4CD3AF, 0x4CD577, 0x4CD587, 0x4CD629,
+  0x4CD717, 0x4CD98F, 0x4CDD31, 0x4CE0DB, 0x4CE136, 0x4CE175, 0x4CE176, 0x4CE19E,
+  0x4CE676, 0x4CE6C0, 0x4CE705, 0x4CE9E4, 0x4CEAAE, 0x4CEB42, 0x4CEBBD, 0x4CEBD6,
+  0x4CEC0F, 0x4CEDDE, 0x4CEDFB, 0x4CEF56, 0x4CEFC0, 0x4CF202, 0x4CF2BF, 0x4CF55B,
+  0x4CF5DC, 0x4CF95D, 0x4CFACA, 0x4CFB45, 0x4CFCAA, 0x4CFE2E, 0x50016B, 0x5001BB,
+  0x5001D9, 0x500238, 0x500291, 0x5004B8, 0x500604, 0x5006AB, 0x5007C3, 0x500959,
+  0x500B26, 0x500F59, 0x500F80, 0x500FF5, 0x50131D, 0x501395, 0x5014C1, 0x5016F4,
+  0x5017FF, 0x501AA5, 0x501AC5, 0x501B32, 0x501CB0, 0x501CBF, 0x501D93, 0x501FC6,
+  0x502065, 0x5021EC, 0x50236D, 0x5023A2, 0x502690, 0x5026EF, 0x5027A9, 0x50284A,
+  0x502873, 0x50297B, 0x5029F5, 0x502B73, 0x502CC6, 0x502D1D, 0x502DA2, 0x502DBB,
+  0x502E5C, 0x502F9B, 0x502FA8, 0x503237, 0x50325F, 0x503275, 0x50338B, 0x50392F,
+  0x503955, 0x503AA0, 0x503CC4, 0x503CCA, 0x503CEA, 0x503DA1, 0x503DC6, 0x503DE5,
+  0x503DEB, 0x503EAA, 0x503F50, 0x504061, 0x504074, 0x50411C, 0x504172, 0x5041B9,
+  0x504289, 0x50464A, 0x50465D, 0x5046AE, 0x504877, 0x504921, 0x5049B0, 0x504A5E,
+  0x504A6E, 0x504B9E, 0x504EDC, 0x5050A4, 0x5051A9, 0x50523B, 0x50547B, 0x505527,
+  0x50558D, 0x505663, 0x5056BF, 0x50578A, 0x50579C, 0x5057A8, 0x50586F, 0x505A65,
+  0x505B1D, 0x505BC2, 0x505C88, 0x505D7A, 0x505DAC, 0x505E24, 0x505FB5, 0x506028,
+  0x506184, 0x5061BF, 0x5061F6, 0x506313, 0x506391, 0x50642B, 0x506583, 0x5065F3,
+  0x5066E5, 0x5067AE, 0x5067F0, 0x50680A, 0x5068AC, 0x506A03, 0x506B4B, 0x506B8D,
+  0x506F0C, 0x506F77, 0x507043, 0x507097, 0x507224, 0x5075F1, 0x5076AF, 0x507705,
+  0x5078B0, 0x5078B3, 0x507A55, 0x507AC5, 0x507B91, 0x507B9D, 0x507C6F, 0x507E5D,
+  0x50804A, 0x508140, 0x5082D5, 0x508492, 0x508569, 0x50874D, 0x508789, 0x508811,
+  0x508965, 0x5089D1, 0x508A06, 0x508BB9, 0x508CB1, 0x508CF5, 0x508E49, 0x508F4C,
+  0x5091E3, 0x5092B9, 0x509551, 0x509744, 0x509839, 0x509893, 0x5098B8, 0x509A4C,
+  0x509A88, 0x509EA7, 0x509F27, 0x509F3B, 0x50A009, 0x50A015, 0x50A0A4, 0x50A132,
+  0x50A1F3, 0x50A4C8, 0x50A5DC, 0x50A67F, 0x50A6D8, 0x50A72B, 0x50A733, 0x50AF4D,
+  0x50B127, 0x50B7C3, 0x50BC96, 0x50BD5F, 0x50C1F0, 0x50C275, 0x50C2E8, 0x50C2ED,
+  0x50C3A2, 0x50C4DD, 0x50C58D, 0x50C6AD, 0x50C709, 0x50C7BF, 0x50C8E5, 0x50C971,
+  0x50CCF8, 0x50CD22, 0x50CF56, 0x50D2F5, 0x50D448, 0x50D45C, 0x50D4F7, 0x50DA00,
+  0x50DAD6, 0x50DB3F, 0x50DCE7, 0x50DE06, 0x50DF95, 0x50E039, 0x50E085, 0x50E0EF,
+  0x50E14A, 0x50E24E, 0x50E452, 0x50E478, 0x50E4E0, 0x50E538, 0x50E549, 0x50E636,
+  0x50E7A0, 0x50E7B7, 0x50E9DF, 0x50EAD6, 0x50EB1A, 0x50EB71, 0x50EBF6, 0x50EC50,
+  0x50ED3C, 0x50F0D3, 0x50F14A, 0x50F222, 0x50F4EB, 0x50F520, 0x50F5DA, 0x50F722,
+  0x50F7ED, 0x50F958, 0x50FA84, 0x50FB19, 0x50FC9F, 0x50FE0C, 0x540295, 0x540463,
+  0x5404A6, 0x54055F, 0x5405DB, 0x540764, 0x54077D, 0x540853, 0x540910, 0x540929,
+  0x540955, 0x540DF9, 0x540E2D, 0x540E58, 0x540F57, 0x54102E, 0x54104F, 0x5410EC,
+  0x541149, 0x5412CB, 0x541310, 0x541379, 0x5413CA, 0x541473, 0x5414A7, 0x5414F3,
+  0x541589, 0x541651, 0x5419C8, 0x541E56, 0x541F8D, 0x54211D, 0x54219D, 0x5421A9,
+  0x542259, 0x5422E0, 0x5422F8, 0x5425EA, 0x542696, 0x54271E, 0x542758, 0x542A1B,
+  0x542AA2, 0x542B8D, 0x542BDE, 0x542F8A, 0x543204, 0x5432C7, 0x5433C6, 0x5433CB,
+  0x5434EF, 0x543530, 0x5435E9, 0x5437BB, 0x5439DF, 0x543AD6, 0x543D37, 0x543E64,
+  0x5440AD, 0x544249, 0x5443B2, 0x544408, 0x54443B, 0x5444A3, 0x544538, 0x544617,
+  0x5447CC, 0x5447E8, 0x544810, 0x5448E6, 0x5449FC, 0x544A00, 0x544A16, 0x544B8C,
+  0x544C8A, 0x544E45, 0x544E90, 0x54511B, 0x5451DE, 0x545284, 0x5453ED, 0x5455D5,
+  0x545AA6, 0x545FA9, 0x546009, 0x54606D, 0x5462E2, 0x5464BC, 0x5464D9, 0x5464DE,
+  0x546503, 0x5465DE, 0x54666C, 0x5466F9, 0x546706, 0x546751, 0x5467E6, 0x546990,
+  0x546C0E, 0x546CEB, 0x5471DD, 0x54724F, 0x54725E, 0x547595, 0x5475D0, 0x5476B2,
+  0x547787, 0x54778A, 0x54781A, 0x5478C9, 0x547975, 0x547C69, 0x547DCD, 0x547FEE,
+  0x548028, 0x54812D, 0x54833A, 0x5484DC, 0x5486BC, 0x54880E, 0x5488DE, 0x548998,
+  0x548ABA, 0x548C81, 0x548CA0, 0x548D5A, 0x549209, 0x5492BE, 0x549359, 0x549963,
+  0x549A8F, 0x549B12, 0x549B49, 0x549B72, 0x549F06, 0x549F13, 0x549F35, 0x549FC6,
+  0x54A050, 0x54A274, 0x54A51B, 0x54A619, 0x54A65C, 0x54A6DB, 0x54A703, 0x54A9C8,
+  0x54AB3A, 0x54AE27, 0x54AF97, 0x54B121, 0x54B203, 0x54B7BD, 0x54B802, 0x54B80A,
+  0x54B874, 0x54BAD6, 0x54BD79, 0x54BE53, 0x54BEF7, 0x54BF64, 0x54C078, 0x54C250,
+  0x54C33E, 0x54C415, 0x54C45B, 0x54C480, 0x54C57A, 0x54C6FF, 0x54C80F, 0x54C9DF,
+  0x54CD10, 0x54CE82, 0x54CF8D, 0x54D17D, 0x54D46F, 0x54D60D, 0x54D7E3, 0x54D9C6,
+  0x54DC1D, 0x54DED3, 0x54DF1B, 0x54DF24, 0x54E005, 0x54E019, 0x54E032, 0x54E061,
+  0x54E15B, 0x54E1AD, 0x54E1B6, 0x54E2E0, 0x54E3F6, 0x54E43A, 0x54E4BD, 0x54E61B,
+  0x54E6FC, 0x54E7D5, 0x54EAA8, 0x54EBE9, 0x54EC2F, 0x54ECB0, 0x54EE75, 0x54EF33,
+  0x54EF43, 0x54F0B1, 0x54F15F, 0x54F201, 0x54F294, 0x54F29F, 0x54F607, 0x54F6C5,
+  0x54F6E2, 0x54F82A, 0x54F876, 0x54F8F0, 0x54FA3E, 0x54FA96, 0x54FCF0, 0x580032,
+  0x5800BB, 0x5800E3, 0x5803FB, 0x5807F8, 0x580943, 0x580A20, 0x580AD4, 0x581031,
+  0x58108C, 0x5810B7, 0x581122, 0x581243, 0x5813D3, 0x581626, 0x5816D7, 0x58170C,
+  0x5819F8, 0x581CF8, 0x581DD8, 0x581F28, 0x581FAA, 0x582059, 0x582071, 0x5820B1,
+  0x58238C, 0x582429, 0x582575, 0x58278C, 0x582AF7, 0x582B0A, 0x582F40, 0x582FF7,
+  0x58306E, 0x58350F, 0x58355D, 0x58356B, 0x5835D9, 0x583653, 0x583879, 0x583BC2,
+  0x583BD9, 0x583F54, 0x58404E, 0x584120, 0x5843AB, 0x584498, 0x58454C, 0x584822,
+  0x58493B, 0x5850ED, 0x58528A, 0x585595, 0x5855CA, 0x58569F, 0x5856C2, 0x5856E8,
+  0x5858CD, 0x5859C2, 0x585FF6, 0x58605F, 0x5860D8, 0x586356, 0x5864C4, 0x5865E6,
+  0x5866BA, 0x58687A, 0x58696C, 0x586AB1, 0x586B14, 0x586C25, 0x586D67, 0x586D8F,
+  0x586ED6, 0x58707F, 0x5873D1, 0x5873D8, 0x5876AC, 0x5876B3, 0x587A62, 0x587A6A,
+  0x587E61, 0x587F57, 0x587F66, 0x5882A8, 0x5885A2, 0x5885E9, 0x588694, 0x58879F,
+  0x5887E2, 0x588A5A, 0x588B1C, 0x588BF3, 0x588D09, 0x588E81, 0x588FCF, 0x589043,
+  0x589153, 0x5891CF, 0x589351, 0x589396, 0x5893D8, 0x58946B, 0x5894AE, 0x58957E,
+  0x58961D, 0x589630, 0x589671, 0x58971E, 0x5897BD, 0x589835, 0x589A3E, 0x589B4A,
+  0x589BF7, 0x589EC6, 0x58A023, 0x58A15F, 0x58A2B5, 0x58A2E1, 0x58A639, 0x58A839,
+  0x58A87B, 0x58AC78, 0x58AD12, 0x58AE2B, 0x58AEA8, 0x58AEF1, 0x58B035, 0x58B03E,
+  0x58B10F, 0x58B38F, 0x58B3FC, 0x58B42D, 0x58B623, 0x58B633, 0x58B965, 0x58BAD4,
+  0x58BC27, 0x58BDA3, 0x58BE72, 0x58BF25, 0x58BFEA, 0x58C17A, 0x58C232, 0x58C356,
+  0x58C38B, 0x58C57E, 0x58C583, 0x58C5CB, 0x58C6F0, 0x58C7AC, 0x58C876, 0x58C935,
+  0x58CB52, 0x58CDC9, 0x58CE2A, 0x58CF79, 0x58D061, 0x58D08F, 0x58D237, 0x58D312,
+  0x58D349, 0x58D391, 0x58D50A, 0x58D56E, 0x58D697, 0x58D759, 0x58D9C3, 0x58D9D5,
+  0x58DB15, 0x58E28F, 0x58E403, 0x58E434, 0x58E488, 0x58E6BA, 0x58ECED, 0x58EF68,
+  0x58F102, 0x58F2FC, 0x58F39C, 0x58F85C, 0x58F8D7, 0x58F987, 0x58FB84, 0x58FB96,
+  0x58FC20, 0x58FDB1, 0x58FFA1, 0x5C0214, 0x5C0272, 0x5C0339, 0x5C07A4, 0x5C07A6,
+  0x5C0947, 0x5C0979, 0x5C0A5B, 0x5C0CE6, 0x5C0E8B, 0x5C101E, 0x5C10C5, 0x5C1648,
+  0x5C167D, 0x5C16C7, 0x5C1720, 0x5C1783, 0x5C17CF, 0x5C17D3, 0x5C1A6F, 0x5C1BF4,
+  0x5C1CB9, 0x5C1DD9, 0x5C2167, 0x5C22DA, 0x5C2573, 0x5C260A, 0x5C27D4, 0x5C2E59,
+  0x5C313E, 0x5C3192, 0x5C32C5, 0x5C337B, 0x5C338E, 0x5C3400, 0x5C345B, 0x5C353B,
+  0x5C36B8, 0x5C3A3D, 0x5C3A45, 0x5C3C27, 0x5C3E06, 0x5C3E1B, 0x5C443E, 0x5C4527,
+  0x5C46B0, 0x5C475E, 0x5C4979, 0x5C497D, 0x5C4A1F, 0x5C4CA9, 0x5C4DBF, 0x5C5015,
+  0x5C50D9, 0x5C514F, 0x5C5181, 0x5C5188, 0x5C521E, 0x5C5230, 0x5C5284, 0x5C5310,
+  0x5C53B4, 0x5C53C3, 0x5C546D, 0x5C56A4, 0x5C571A, 0x5C579E, 0x5C57C8, 0x5C58E6,
+  0x5C5948, 0x5C5AC7, 0x5C5B35, 0x5C5EAB, 0x5C5F67, 0x5C60BA, 0x5C6199, 0x5C625A,
+  0x5C628B, 0x5C63BF, 0x5C647A, 0x5C648E, 0x5C64F1, 0x5C666C, 0x5C6A80, 0x5C6B32,
+  0x5C6D20, 0x5C6F69, 0x5C7017, 0x5C7075, 0x5C70A3, 0x5C710D, 0x5C75AF, 0x5C75C6,
+  0x5C7695, 0x5C76D5, 0x5C7776, 0x5C78F8, 0x5C7B5C, 0x5C7D5E, 0x5C7D7D, 0x5C7DF3,
+  0x5C80B6, 0x5C836C, 0x5C8382, 0x5C838F, 0x5C843C, 0x5C865C, 0x5C8730, 0x5C879C,
+  0x5C8816, 0x5C899A, 0x5C8A38, 0x5C8B6B, 0x5C8C30, 0x5C8D4E, 0x5C8F40, 0x5C8FE0,
+  0x5C9157, 0x5C9175, 0x5C925E, 0x5C93A2, 0x5C95AE, 0x5C9656, 0x5C9666, 0x5C969D,
+  0x5C97F3, 0x5C9960, 0x5C9AA1, 0x5C9AD8, 0x5CA06C, 0x5CA176, 0x5CA39D, 0x5CA47D,
+  0x5CA48A, 0x5CA4A4, 0x5CA4F4, 0x5CA5BC, 0x5CA62D, 0x5CA6E6, 0x5CA721, 0x5CA86A,
+  0x5CAAFD, 0x5CAC3D, 0x5CAC4C, 0x5CADCF, 0x5CAF06, 0x5CB00A, 0x5CB066, 0x5CB12E,
+  0x5CB13E, 0x5CB260, 0x5CB26D, 0x5CB395, 0x5CB43E, 0x5CB524, 0x5CB901, 0x5CBA2C,
+  0x5CBA37, 0x5CBAEF, 0x5CBBEE, 0x5CBD9A, 0x5CC0A0, 0x5CC1D7, 0x5CC307, 0x5CC336,
+  0x5CC563, 0x5CC5D4, 0x5CC6D0, 0x5CC6E9, 0x5CC787, 0x5CC7C1, 0x5CC999, 0x5CC9C0,
+  0x5CCA1A, 0x5CCAD3, 0x5CCB99, 0x5CCBCA, 0x5CCD5B, 0x5CCD7C, 0x5CCF7F, 0x5CD06E,
+  0x5CD2E4, 0x5CD89E, 0x5CD998, 0x5CDAD4, 0x5CDC96, 0x5CDD70, 0x5CDE34, 0x5CDF89,
+  0x5CE0C5, 0x5CE176, 0x5CE286, 0x5CE28C, 0x5CE2F4, 0x5CE30E, 0x5CE3B6, 0x5CE42A,
+  0x5CE50C, 0x5CE747, 0x5CE7A0, 0x5CE883, 0x5CE8EB, 0x5CE91E, 0x5CE931, 0x5CEA1D,
+  0x5CED8C, 0x5CEDF4, 0x5CF3FC, 0x5CF4AB, 0x5CF51A, 0x5CF5DA, 0x5CF6DC, 0x5CF7E6,
+  0x5CF821, 0x5CF8A1, 0x5CF938, 0x5CF96A, 0x5CF9DD, 0x5CF9FD, 0x5CFA25, 0x5CFB3A,
+  0x5CFB7C, 0x5CFC66, 0x5CFC6E, 0x5CFCE1, 0x5CFF35, 0x600194, 0x6001B1, 0x600292,
+  0x6002B4, 0x600308, 0x60030C, 0x6003A6, 0x60045C, 0x6006E3, 0x6007C4, 0x600810,
+  0x6009C3, 0x600B03, 0x600F6B, 0x60109E, 0x60123C, 0x60128B, 0x601466, 0x6014B3,
+  0x60152B, 0x60183A, 0x601888, 0x601895, 0x601971, 0x601AC7, 0x601B52, 0x601D56,
+  0x601D91, 0x601D9D, 0x602101, 0x6021C0, 0x602232, 0x6023A4, 0x602602, 0x6026AA,
+  0x6026EF, 0x60292B, 0x602AD0, 0x602B58, 0x602E20, 0x6030D4, 0x60313B, 0x603197,
+  0x6032B1, 0x60334B, 0x603573, 0x6035C0, 0x6036DD, 0x60380E, 0x6038E0, 0x60391F,
+  0x603A7C, 0x603AAF, 0x603CEE, 0x603D26, 0x603D29, 0x603E5F, 0x60427F, 0x60452E,
+  0x6045BD, 0x6045CB, 0x6049C1, 0x604DE1, 0x604F5B, 0x60512C, 0x605375, 0x6055F9,
+  0x605718, 0x605747, 0x60577D, 0x6057C8, 0x605B30, 0x605BB4, 0x605E4F, 0x605F8D,
+  0x60601F, 0x60634C, 0x606405, 0x606525, 0x606720, 0x60684E, 0x606944, 0x606B5B,
+  0x606BB3, 0x606BBD, 0x606BFF, 0x606C63, 0x606C66, 0x606D3C, 0x606DC7, 0x606E41,
+  0x606EE8, 0x60706C, 0x6070C0, 0x60720B, 0x60735C, 0x6073BC, 0x6074B1, 0x6074F4,
+  0x607771, 0x6077E2, 0x607D09, 0x607EA4, 0x607EC9, 0x607ECD, 0x607EDD, 0x608246,
+  0x608334, 0x608373, 0x6084BD, 0x60893C, 0x608A10, 0x608B0E, 0x608C4A, 0x608CE6,
+  0x608D26, 0x608E08, 0x608F5C, 0x608FA4, 0x6091F3, 0x609217, 0x6092F5, 0x609316,
+  0x609532, 0x6095BD, 0x609620, 0x6096A4, 0x609866, 0x609AC1, 0x609BB4, 0x609C9F,
+  0x60A10A, 0x60A2C6, 0x60A37D, 0x60A423, 0x60A44C, 0x60A4B7, 0x60A4D0, 0x60A5E2,
+  0x60A6C5, 0x60A751, 0x60A8FE, 0x60AAEF, 0x60AB14, 0x60AB67, 0x60ABD2, 0x60AF6D,
+  0x60B617, 0x60B647, 0x60B6E1, 0x60B76E, 0x60B9C0, 0x60BB0C, 0x60BD2C, 0x60BEB5,
+  0x60BEC4, 0x60C397, 0x60C547, 0x60C5AD, 0x60C5E6, 0x60C78D, 0x60C798, 0x60C7BE,
+  0x60C9AA, 0x60CE41, 0x60CE86, 0x60D02C, 0x60D039, 0x60D0A9, 0x60D21C, 0x60D248,
+  0x60D4E9, 0x60D755, 0x60D819, 0x60D89C, 0x60D9A0, 0x60D9C7, 0x60DA83, 0x60DB15,
+  0x60DB98, 0x60DC81, 0x60DD70, 0x60DD8E, 0x60DE44, 0x60DEF3, 0x60DEF4, 0x60E327,
+  0x60E32B, 0x60E3AC, 0x60E5D8, 0x60E6F0, 0x60E701, 0x60E85B, 0x60E9AA, 0x60EB69,
+  0x60EE5C, 0x60EFAB, 0x60F04D, 0x60F189, 0x60F18A, 0x60F262, 0x60F43A, 0x60F445,
+  0x60F494, 0x60F677, 0x60F81D, 0x60FA9D, 0x60FACD, 0x60FB00, 0x60FB42, 0x60FCF1,
+  0x60FDA6, 0x60FE20, 0x60FEC5, 0x60FF12, 0x64006A, 0x6400F1, 0x6401FB, 0x6402CB,
+  0x64037F, 0x6405E4, 0x6407F6, 0x640980, 0x6409AC, 0x640BD7, 0x640D22, 0x640DCE,
+  0x640F28, 0x6411A4, 0x641225, 0x641236, 0x641269, 0x64136C, 0x6413AB, 0x64168D,
+  0x6416F0, 0x6417CD, 0x641B2F, 0x641C10, 0x641CAE, 0x641CB0, 0x64200C, 0x642315,
+  0x642737, 0x642753, 0x642943, 0x642C0F, 0x642CAC, 0x642FC7, 0x643150, 0x6432A8,
+  0x6433DB, 0x643AB1, 0x643AEA, 0x643E0A, 0x643E8C, 0x6441E6, 0x6447E0, 0x64497D,
+  0x644C36, 0x644ED7, 0x645106, 0x6451F4, 0x645234, 0x645299, 0x6453E0, 0x6455B1,
+  0x645601, 0x645725, 0x6458AD, 0x645A04, 0x645A36, 0x645AED, 0x645D86, 0x645D92,
+  0x645DF4, 0x645E10, 0x646038, 0x646140, 0x64644A, 0x64649B, 0x646624, 0x6466B3,
+  0x6466D8, 0x646772, 0x6467CD, 0x64680C, 0x646876, 0x64694E, 0x646A52, 0x646C80,
+  0x646CB2, 0x646D2F, 0x646D4E, 0x646D6C, 0x646E60, 0x646E69, 0x646E97, 0x646EE0,
+  0x646EEA, 0x647002, 0x647033, 0x647060, 0x6476BA, 0x64777D, 0x647791, 0x647924,
+  0x6479F0, 0x647BCE, 0x647BD4, 0x647C34, 0x647CE8, 0x648099, 0x648214, 0x648505,
+  0x648788, 0x6487D7, 0x6488FF, 0x64899A, 0x6489F1, 0x648CBB, 0x648F3E, 0x6490C1,
+  0x64956C, 0x649714, 0x649829, 0x64995D, 0x649968, 0x649A08, 0x649A63, 0x649ABE,
+  0x649C81, 0x649C8E, 0x649E31, 0x649EF3, 0x64A0E7, 0x64A198, 0x64A200, 0x64A28A,
+  0x64A2F9, 0x64A3CB, 0x64A5C3, 0x64A651, 0x64A769, 0x64A7DD, 0x64AE0C, 0x64B0A6,
+  0x64B0E8, 0x64B2B4, 0x64B310, 0x64B473, 0x64B5C6, 0x64B5F2, 0x64B708, 0x64B853,
+  0x64B9E8, 0x64BAA4, 0x64BB1E, 0x64BC0C, 0x64BC58, 0x64BF6B, 0x64C269, 0x64C2DE,
+  0x64C354, 0x64C394, 0x64C3D6, 0x64C403, 0x64C582, 0x64C6D2, 0x64C753, 0x64C901,
+  0x64CB9F, 0x64CBE9, 0x64CC22, 0x64CC2E, 0x64CE6E, 0x64CFD9, 0x64D0D6, 0x64D154,
+  0x64D2C4, 0x64D315, 0x64D4BD, 0x64D4DA, 0x64D69A, 0x64D7C0, 0x64D814, 0x64D81B,
+  0x64D954, 0x64D989, 0x64DAED, 0x64DB38, 0x64DB43, 0x64DB8B, 0x64DBF7, 0x64DDE9,
+  0x64E003, 0x64E0AB, 0x64E220, 0x64E4A5, 0x64E599, 0x64E682, 0x64E7D8, 0x64E833,
+  0x64E881, 0x64E950, 0x64EB8C, 0x64EC65, 0x64ED57, 0x64EEB7, 0x64F0AD, 0x64F2FB,
+  0x64F54E, 0x64F69D, 0x64F6BB, 0x64F705, 0x64F88A, 0x64FD29, 0x64FD96, 0x64FE15,
+  0x64FF0A, 0x6802B8, 0x680571, 0x6805CA, 0x680715, 0x680927, 0x680AE2, 0x681324,
+  0x6813E2, 0x6813F3, 0x681401, 0x681590, 0x681729, 0x681A7C, 0x681AA4, 0x681AB2,
+  0x681BEF, 0x68215F, 0x68228E, 0x6823B0, 0x68262A, 0x682719, 0x682737, 0x68275F,
+  0x6828CF, 0x682C7B, 0x682F67, 0x6833EE, 0x683421, 0x6837E9, 0x683943, 0x683A1E,
+  0x683B78, 0x683E26, 0x683E34, 0x683EC0, 0x683F7D, 0x68403C, 0x68418F, 0x684571,
+  0x6845CC, 0x684724, 0x684749, 0x684898, 0x684983, 0x684992, 0x684A76, 0x684AAE,
+  0x684AE9, 0x684DB6, 0x684E05, 0x684F64, 0x685210, 0x68539D, 0x68545A, 0x6854ED,
+  0x6854FD, 0x6855D4, 0x68572D, 0x685811, 0x685932, 0x68597F, 0x685ACF, 0x685B35,
+  0x685D43, 0x685E1C, 0x686359, 0x686372, 0x68644B, 0x686725, 0x6869CA, 0x686CE6,
+  0x686DBC, 0x687161, 0x687251, 0x6872C3, 0x68764F, 0x687724, 0x6877DA, 0x68784C,
+  0x687909, 0x6879ED, 0x687A64, 0x687D6B, 0x687DB4, 0x687F74, 0x687FF0, 0x6881E0,
+  0x6883CB, 0x68847E, 0x6885A4, 0x6886A7, 0x68871C, 0x6887C6, 0x6888A1, 0x6889C1,
+  0x688AF0, 0x688B0F, 0x688BF4, 0x688F2E, 0x688F84, 0x689234, 0x689320, 0x689361,
+  0x689423, 0x68944A, 0x68962E, 0x68966A, 0x68967B, 0x6899CD, 0x689A21, 0x689A87,
+  0x689C5E, 0x689C70, 0x689CE2, 0x689E0B, 0x689E19, 0x689E29, 0x689E6A, 0x689FF0,
+  0x68A03E, 0x68A0F6, 0x68A378, 0x68A3C4, 0x68A46A, 0x68A47D, 0x68A682, 0x68A7B4,
+  0x68A828, 0x68A86D, 0x68A8E1, 0x68AAC4, 0x68AB09, 0x68AB1E, 0x68ABBC, 0x68AE04,
+  0x68AE20, 0x68B599, 0x68B691, 0x68B6B3, 0x68B6FC, 0x68B8BB, 0x68B9C2, 0x68B9D3,
+  0x68BC0C, 0x68BDAB, 0x68BFC4, 0x68C44C, 0x68C44D, 0x68C63A, 0x68C8EB, 0x68C90B,
+  0x68CAC4, 0x68CAE4, 0x68CC6E, 0x68D1BA, 0x68D40C, 0x68D482, 0x68D6ED, 0x68D79A,
+  0x68D927, 0x68D93C, 0x68DB54, 0x68DBCA, 0x68DBF5, 0x68DDB7, 0x68DDD9, 0x68DECE,
+  0x68DFDD, 0x68E166, 0x68E1DC, 0x68E209, 0x68E478, 0x68E59E, 0x68E74A, 0x68E7C2,
+  0x68E905, 0x68EBAE, 0x68ECC5, 0x68ED43, 0x68EE88, 0x68EE96, 0x68EF43, 0x68EFBD,
+  0x68F0B5, 0x68F38E, 0x68F543, 0x68F63B, 0x68F728, 0x68FB7E, 0x68FCB6, 0x68FCCA,
+  0x68FEDA, 0x68FEF7, 0x68FF7B, 0x6C006B, 0x6C02E0, 0x6C0309, 0x6C0370, 0x6C03B5,
+  0x6C047A, 0x6C06D6, 0x6C09BF, 0x6C0B84, 0x6C0C9A, 0x6C0D34, 0x6C0DC4, 0x6C0E0D,
+  0x6C0F0B, 0x6C11B3, 0x6C13D5, 0x6C146E, 0x6C1544, 0x6C1629, 0x6C1632, 0x6C198F,
+  0x6C19C0, 0x6C1A75, 0x6C1C71, 0x6C1DEB, 0x6C1ED7, 0x6C2056, 0x6C21A2, 0x6C221A,
+  0x6C23B9, 0x6C2408, 0x6C2483, 0x6C24A6, 0x6C25B9, 0x6C2636, 0x6C2779, 0x6C2995,
+  0x6C29D2, 0x6C2B59, 0x6C2CDC, 0x6C2D24, 0x6C2E85, 0x6C2F2C, 0x6C2F80, 0x6C2F8A,
+  0x6C302A, 0x6C310E, 0x6C3491, 0x6C3845, 0x6C38A1, 0x6C3B6B, 0x6C3BE5, 0x6C3C7C,
+  0x6C3C8C, 0x6C3E6D, 0x6C4008, 0x6C410E, 0x6C416A, 0x6C433C, 0x6C442A, 0x6C4760,
+  0x6C483F, 0x6C48A6, 0x6C4A85, 0x6C4BB4, 0x6C4CE2, 0x6C4D73, 0x6C4EF6, 0x6C504D,
+  0x6C51BF, 0x6C51E4, 0x6C5563, 0x6C558D, 0x6C55E8, 0x6C5640, 0x6C5697, 0x6C5940,
+  0x6C5AB0, 0x6C5AB5, 0x6C5C14, 0x6C5CB1, 0x6C5D3A, 0x6C5E3B, 0x6C5F1C, 0x6C6016,
+  0x6C60D0, 0x6C61F4, 0x6C626D, 0x6C6286, 0x6C62FE, 0x6C639C, 0x6C67EF, 0x6C6A77,
+  0x6C6C0F, 0x6C6CD3, 0x6C709F, 0x6C70CB, 0x6C710D, 0x6C71D2, 0x6C71D9, 0x6C7220,
+  0x6C72E7, 0x6C7637, 0x6C7660, 0x6C79B8, 0x6C7E67, 0x6C7F0C, 0x6C8336, 0x6C8720,
+  0x6C8814, 0x6C8B2F, 0x6C8BD3, 0x6C8D77, 0x6C8DC1, 0x6C8F4E, 0x6C8FB5, 0x6C92BF,
+  0x6C92CF, 0x6C9466, 0x6C94F8, 0x6C96CF, 0x6C976D, 0x6C98EB, 0x6C9961, 0x6C9989,
+  0x6C999D, 0x6C9B02, 0x6C9CED, 0x6C9E7C, 0x6CA0B4, 0x6CA100, 0x6CA4D1, 0x6CA604,
+  0x6CA75F, 0x6CA780, 0x6CA849, 0x6CA858, 0x6CA928, 0x6CAAB3, 0x6CAB05, 0x6CAB31,
+  0x6CACC2, 0x6CADAD, 0x6CADF8, 0x6CAE8B, 0x6CAEE3, 0x6CAEF6, 0x6CB0CE, 0x6CB133,
+  0x6CB158, 0x6CB2AE, 0x6CB2FD, 0x6CB456, 0x6CB4FD, 0x6CB56B, 0x6CB749, 0x6CB7E2,
+  0x6CB7F4, 0x6CB881, 0x6CBAB8, 0x6CBEE9, 0x6CC1D2, 0x6CC217, 0x6CC242, 0x6CC26B,
+  0x6CC374, 0x6CC3B2, 0x6CC49F, 0x6CC4D5, 0x6CC63B, 0x6CC7EC, 0x6CCA08, 0x6CCDD6,
+  0x6CCE44, 0x6CD032, 0x6CD199, 0x6CD1E5, 0x6CD2BA, 0x6CD63F, 0x6CD68A, 0x6CD6E3,
+  0x6CD704, 0x6CD719, 0x6CD71F, 0x6CD94C, 0x6CDD30, 0x6CDDBC, 0x6CDEA9, 0x6CE2D3,
+  0x6CE4DA, 0x6CE5C9, 0x6CE5F7, 0x6CE85C, 0x6CE873, 0x6CE874, 0x6CE8C6, 0x6CE907,
+  0x6CEBB6, 0x6CEC5A, 0x6CECEB, 0x6CEFBD, 0x6CEFC6, 0x6CF049, 0x6CF17E, 0x6CF2D8,
+  0x6CF373, 0x6CF37F, 0x6CF6DA, 0x6CF712, 0x6CF784, 0x6CFA58, 0x6CFA89, 0x6CFAA7,
+  0x6CFBED, 0x6CFE54, 0x6CFFCE, 0x7001B5, 0x70037E, 0x70039F, 0x70041D, 0x700514,
+  0x700971, 0x700B01, 0x700B4F, 0x700F6A, 0x70105C, 0x70106F, 0x70110E, 0x701124,
+  0x701301, 0x7014A6, 0x70188B, 0x7018A7, 0x70192F, 0x701A04, 0x701AB8, 0x701BFB,
+  0x701CE7, 0x701F3C, 0x701F53, 0x702084, 0x7022FE, 0x702526, 0x702559, 0x702804,
+  0x70288B, 0x702AD5, 0x702AD7, 0x702C09, 0x702E22, 0x702ED9, 0x702F35, 0x703018,
+  0x70317F, 0x703217, 0x703509, 0x7038EE, 0x703A0E, 0x703A51, 0x703A73, 0x703AA6,
+  0x703ACB, 0x703C69, 0x703D15, 0x703E97, 0x703EAC, 0x7040FF, 0x7042D3, 0x704698,
+  0x704777, 0x7047E9, 0x70480F, 0x7048F7, 0x7049A2, 0x704A0E, 0x704CA5, 0x704CB6,
+  0x704D7B, 0x704DE7, 0x704E66, 0x704E6B, 0x704F57, 0x704FB8, 0x7050AF, 0x7052C5,
+  0x7052D8, 0x705425, 0x705464, 0x7054B4, 0x7054D2, 0x7054F5, 0x705681, 0x7057BF,
+  0x705812, 0x7058A4, 0x705A0F, 0x705A9E, 0x705AAC, 0x705AB6, 0x705DCC, 0x705E55,
+  0x705FA3, 0x70617B, 0x7061BE, 0x7062B8, 0x70661B, 0x70662A, 0x706655, 0x7066B9,
+  0x70695A, 0x706BB9, 0x706D15, 0x706E6D, 0x706F81, 0x70700D, 0x70708B, 0x7070AA,
+  0x7071BC, 0x70720D, 0x70723C, 0x7072FE, 0x707362, 0x7073CB, 0x707414, 0x707630,
+  0x707781, 0x70788B, 0x707990, 0x7079B3, 0x707BE8, 0x707C69, 0x707CE3, 0x707DB9,
+  0x707E43, 0x708105, 0x708185, 0x7081EB, 0x708540, 0x7085C2, 0x7085C4, 0x7085C6,
+  0x7086C1, 0x7086CE, 0x7087A7, 0x708976, 0x7089CC, 0x708A09, 0x708BCD, 0x708CB6,
+  0x708D09, 0x708F47, 0x709041, 0x7090B7, 0x7091F3, 0x7093C1, 0x709741, 0x70991C,
+  0x709C45, 0x709CD1, 0x709E29, 0x709F2D, 0x709FA9, 0x70A2B3, 0x70A56A, 0x70A6BD,
+  0x70A6CC, 0x70A741, 0x70A8D3, 0x70A8E3, 0x70A983, 0x70AAB2, 0x70AC08, 0x70ACD7,
+  0x70AED5, 0x70AF6A, 0x70B035, 0x70B13D, 0x70B14E, 0x70B306, 0x70B317, 0x70B5E8,
+  0x70B64F, 0x70B7AA, 0x70B7E4, 0x70B8F6, 0x70B921, 0x70B950, 0x70BAEF, 0x70BB5B,
+  0x70BBE9, 0x70BC10, 0x70BC48, 0x70BF92, 0x70C6DD, 0x70C7F2, 0x70C912, 0x70C94E,
+  0x70C9C6, 0x70CA97, 0x70CA9B, 0x70CD0D, 0x70CD60, 0x70CD91, 0x70CE8C, 0x70CF49,
+  0x70D313, 0x70D379, 0x70D4F2, 0x70D51E, 0x70D823, 0x70D8C2, 0x70D923, 0x70D931,
+  0x70DA48, 0x70DB98, 0x70DDA1, 0x70DDA8, 0x70DDEF, 0x70DEE2, 0x70DF2F, 0x70DFF7,
+  0x70E1FD, 0x70E284, 0x70E422, 0x70E46E, 0x70E56E, 0x70E72C, 0x70EA1A, 0x70EA5A,
+  0x70ECE4, 0x70EF00, 0x70F087, 0x70F088, 0x70F096, 0x70F196, 0x70F1A1, 0x70F220,
+  0x70F35A, 0x70F395, 0x70F754, 0x70F82B, 0x70F8AE, 0x70F927, 0x70F96D, 0x70FC8F,
+  0x70FD45, 0x70FD46, 0x70FD88, 0x70FF76, 0x7403BD, 0x74042B, 0x7404F0, 0x7404F1,
+  0x74057C, 0x7405A5, 0x740635, 0x74077E, 0x740AE1, 0x740BB0, 0x740CEE, 0x740EA4,
+  0x7411B2, 0x7412B3, 0x7412BB, 0x7413EA, 0x741575, 0x7415F5, 0x741865, 0x74190A,
+  0x741BB2, 0x741C27, 0x741E93, 0x741F4A, 0x7422BB, 0x742344, 0x74258A, 0x7426AC,
+  0x7426FF, 0x7427EA, 0x7429AF, 0x742A8A, 0x742B62, 0x742F68, 0x74309D, 0x7430AF,
+  0x743170, 0x743174, 0x743357, 0x7433A6, 0x7433E9, 0x74342B, 0x74366D, 0x74375F,
+  0x743822, 0x7438B7, 0x743989, 0x743A20, 0x743A65, 0x743AEF, 0x743AF4, 0x743C18,
+  0x743E2B, 0x743FC2, 0x7440BB, 0x7440BE, 0x74427F, 0x74428B, 0x744401, 0x74452D,
+  0x74458A, 0x7445CE, 0x7446A0, 0x7446B3, 0x7449D2, 0x744AA4, 0x744CA1, 0x744D28,
+  0x744D6D, 0x744DBD, 0x74504E, 0x7451BA, 0x745427, 0x74547D, 0x745612, 0x74563C,
+  0x7458F3, 0x745909, 0x745AAA, 0x745C4B, 0x745C9F, 0x745D22, 0x745D43, 0x745D68,
+  0x745E1C, 0x7460FA, 0x7463C2, 0x74650C, 0x7467F7, 0x74694A, 0x746F88, 0x746FF7,
+  0x747069, 0x7470FD, 0x74718B, 0x7472B0, 0x7473B4, 0x7473E2, 0x747446, 0x747548,
+  0x74765B, 0x747827, 0x7478A6, 0x747A90, 0x747D24, 0x74803F, 0x748114, 0x7483C2,
+  0x7483EF, 0x748469, 0x74852A, 0x7485C4, 0x74860B, 0x748669, 0x74867A, 0x7486E2,
+  0x74872E, 0x7487BB, 0x74882A, 0x74888B, 0x7488BB, 0x748A0D, 0x748A28, 0x748D08,
+  0x748EF8, 0x748F3C, 0x748FC2, 0x7490BC, 0x74911A, 0x7493A4, 0x7493DA, 0x7495EC,
+  0x749779, 0x749781, 0x749975, 0x749B89, 0x749BE8, 0x749D79, 0x749D8F, 0x749DDC,
+  0x749E75, 0x749EA5, 0x749EAF, 0x749EF5, 0x74A02F, 0x74A063, 0x74A2E6, 0x74A528,
+  0x74A58C, 0x74A6CD, 0x74A722, 0x74A78E, 0x74A7EA, 0x74ACB9, 0x74AD98, 0x74ADB7,
+  0x74B059, 0x74B57E, 0x74B587, 0x74B6B6, 0x74B725, 0x74B7B3, 0x74B839, 0x74B9EB,
+  0x74BFC0, 0x74C14F, 0x74C17D, 0x74C246, 0x74C330, 0x74C530, 0x74C63B, 0x74C929,
+  0x74C99A, 0x74C9A3, 0x74CA60, 0x74CC39, 0x74CF00, 0x74D02B, 0x74D0DC, 0x74D21D,
+  0x74D285, 0x74D423, 0x74D435, 0x74D4DD, 0x74D558, 0x74D637, 0x74D6CB, 0x74D6E5,
+  0x74D6EA, 0x74D7CA, 0x74D83E, 0x74D873, 0x74DA38, 0x74DA88, 0x74DADA, 0x74DAEA,
+  0x74DE2B, 0x74DFBF, 0x74E182, 0x74E19A, 0x74E1B6, 0x74E20C, 0x74E28C, 0x74E2F5,
+  0x74E336, 0x74E50B, 0x74E543, 0x74E5F9, 0x74E60F, 0x74E6B8, 0x74E6E2, 0x74E798,
+  0x74E7C6, 0x74E9BF, 0x74EA3A, 0x74EAC8, 0x74EACB, 0x74EAE8, 0x74EB80, 0x74EC42,
+  0x74ECB2, 0x74EE2A, 0x74EF4B, 0x74F06D, 0x74F2FA, 0x74F612, 0x74F61C, 0x74F9CA,
+  0x74FECE, 0x74FF4C, 0x78009E, 0x78028B, 0x7802B1, 0x7802F8, 0x78034F, 0x780473,
+  0x7804E3, 0x7806C9, 0x78084D, 0x780B8C, 0x780CB8, 0x780CF0, 0x780F77, 0x781053,
+  0x7811DC, 0x7813E0, 0x781699, 0x781735, 0x7817BE, 0x781881, 0x7818A8, 0x7818EC,
+  0x7819F7, 0x781C1E, 0x781C5A, 0x781D4A, 0x781DBA, 0x781FDB, 0x7820A5, 0x782184,
+  0x782327, 0x7823AE, 0x782459, 0x7824AF, 0x7825AD, 0x7828CA, 0x7829ED, 0x782A79,
+  0x782B46, 0x782B64, 0x782BCB, 0x782C29, 0x782D7E, 0x782DAD, 0x782E56, 0x782EEF,
+  0x78305D, 0x78312B, 0x7831C1, 0x78321B, 0x783486, 0x7834FD, 0x783690, 0x7836CC,
+  0x783716, 0x783A6C, 0x783A84, 0x783E53, 0x783EA1, 0x7840E4, 0x784476, 0x7844FD,
+  0x784558, 0x784561, 0x7845B3, 0x7845C4, 0x78465C, 0x78465F, 0x7846C4, 0x7846D4,
+  0x78471D, 0x7847E3, 0x784859, 0x784946, 0x784B87, 0x784F24, 0x784F43, 0x784F9B,
+  0x78507C, 0x78521A, 0x78530D, 0x785333, 0x78542E, 0x785773, 0x785860, 0x78595E,
+  0x785968, 0x785B64, 0x785C5E, 0x785DC8, 0x785EA2, 0x785F28, 0x785F36, 0x78605B,
+  0x78617C, 0x786256, 0x7864C0, 0x786559, 0x78669D, 0x7866F3, 0x78670E, 0x7867D7,
+  0x786829, 0x7868F7, 0x786A1F, 0x786A89, 0x786C1C, 0x786C84, 0x786D94, 0x787104,
+  0x78719C, 0x78725D, 0x787689, 0x787B8A, 0x787D48, 0x787D53, 0x787E61, 0x788038,
+  0x788102, 0x7881CE, 0x78843C, 0x7885F4, 0x7886B6, 0x78886D, 0x788A20, 0x788A86,
+  0x788B2A, 0x788C54, 0x788C77, 0x788CB5, 0x788DAF, 0x788DF7, 0x7890A2, 0x7891E9,
+  0x78923E, 0x78929C, 0x7894B4, 0x7895EB, 0x789682, 0x789684, 0x7896A3, 0x7898E8,
+  0x789A18, 0x789ED0, 0x789F70, 0x789FAA, 0x78A03F, 0x78A106, 0x78A13E, 0x78A2A0,
+  0x78A3E4, 0x78A504, 0x78A6A0, 0x78A6E1, 0x78A7C7, 0x78A7EB, 0x78A873, 0x78AA82,
+  0x78ABBB, 0x78AC44, 0x78ACC0, 0x78AF08, 0x78B213, 0x78B46A, 0x78B554, 0x78B84B,
+  0x78B8D6, 0x78BAF9, 0x78BBC1, 0x78BC1A, 0x78BDBC, 0x78C1A7, 0x78C1AE, 0x78C213,
+  0x78C313, 0x78C3E9, 0x78C57D, 0x78C5E5, 0x78C5F8, 0x78C62B, 0x78C6BB, 0x78C881,
+  0x78CA04, 0x78CA39, 0x78CB68, 0x78CD55, 0x78CD8E, 0x78CF2F, 0x78CFF9, 0x78D162,
+  0x78D294, 0x78D347, 0x78D6B2, 0x78D6D6, 0x78D6DC, 0x78D6F0, 0x78D71A, 0x78D752,
+  0x78D75F, 0x78D840, 0x78DA07, 0x78DA6E, 0x78DB2F, 0x78DD08, 0x78DD12, 0x78DD33,
+  0x78DDD9, 0x78DEE4, 0x78DF72, 0x78E103, 0x78E22C, 0x78E36D, 0x78E3B5, 0x78E3DE,
+  0x78E400, 0x78E7D1, 0x78E8B6, 0x78E9CF, 0x78EB14, 0x78EB46, 0x78EDBC, 0x78F09B,
+  0x78F1C6, 0x78F235, 0x78F238, 0x78F29E, 0x78F505, 0x78F557, 0x78F5FD, 0x78F7BE,
+  0x78F882, 0x78F944, 0x78F9B4, 0x78FBD8, 0x78FD94, 0x78FE3D, 0x78FF57, 0x78FFCA,
+  0x7C004D, 0x7C010A, 0x7C0191, 0x7C034C, 0x7C035E, 0x7C03AB, 0x7C03C9, 0x7C03D8,
+  0x7C04D0, 0x7C0507, 0x7C0A3F, 0x7C0BC6, 0x7C0ECE, 0x7C10C9, 0x7C11BE, 0x7C11CB,
+  0x7C131D, 0x7C1689, 0x7C1779, 0x7C1AC0, 0x7C1B93, 0x7C1C4E, 0x7C1C68, 0x7C1CF1,
+  0x7C1DD9, 0x7C1E06, 0x7C1E52, 0x7C2064, 0x7C210D, 0x7C210E, 0x7C214A, 0x7C2302,
+  0x7C240C, 0x7C2499, 0x7C2586, 0x7C25DA, 0x7C2634, 0x7C2664, 0x7C27BC, 0x7C296F,
+  0x7C2A31, 0x7C2ACA, 0x7C2ADB, 0x7C2EBD, 0x7C2EDD, 0x7C2F80, 0x7C310E, 0x7C33F9,
+  0x7C35F8, 0x7C3866, 0x7C38AD, 0x7C3953, 0x7C3985, 0x7C3D2B, 0x7C3E74, 0x7C41A2,
+  0x7C4685, 0x7C49CF, 0x7C49EB, 0x7C4B26, 0x7C4CA5, 0x7C4D8F, 0x7C4FB5, 0x7C5049,
+  0x7C5079, 0x7C5259, 0x7C573C, 0x7C5758, 0x7C5A1C, 0x7C5CF8, 0x7C6097, 0x7C6130,
+  0x7C6166, 0x7C6193, 0x7C6305, 0x7C6456, 0x7C646C, 0x7C669A, 0x7C669D, 0x7C66EF,
+  0x7C67A2, 0x7C67AB, 0x7C69F6, 0x7C6A60, 0x7C6AF3, 0x7C6B9C, 0x7C6CF0, 0x7C6D62,
+  0x7C6DF8, 0x7C70DB, 0x7C726E, 0x7C7398, 0x7C73EB, 0x7C752D, 0x7C7630, 0x7C7635,
+  0x7C7668, 0x7C7716, 0x7C787E, 0x7C78B2, 0x7C7A3C, 0x7C7A91, 0x7C7B1C, 0x7C7D3D,
+  0x7C8530, 0x7C87CE, 0x7C8899, 0x7C8931, 0x7C8956, 0x7C89C1, 0x7C8AE1, 0x7C8BB5,
+  0x7C8BC1, 0x7C8BCA, 0x7C8EE4, 0x7C8FDE, 0x7C9122, 0x7C942A, 0x7C949F, 0x7C95B1,
+  0x7C95F3, 0x7C96D2, 0x7C97E1, 0x7C9A1D, 0x7C9A54, 0x7C9EBD, 0x7C9F07, 0x7CA177,
+  0x7CA1AE, 0x7CA23E, 0x7CA449, 0x7CA62A, 0x7CA7B0, 0x7CA96B, 0x7CAB60, 0x7CAD4F,
+  0x7CAD74, 0x7CB073, 0x7CB0C2, 0x7CB15D, 0x7CB21B, 0x7CB232, 0x7CB27D, 0x7CB30A,
+  0x7CB37B, 0x7CB566, 0x7CB59B, 0x7CB59F, 0x7CB733, 0x7CB94C, 0x7CBB8A, 0x7CBFAE,
+  0x7CBFB1, 0x7CC06F, 0x7CC0AA, 0x7CC177, 0x7CC180, 0x7CC225, 0x7CC255, 0x7CC294,
+  0x7CC2C6, 0x7CC385, 0x7CC3A1, 0x7CC537, 0x7CC6B6, 0x7CC709, 0x7CC74A, 0x7CC77E,
+  0x7CC95A, 0x7CC95E, 0x7CCC1F, 0x7CCCB8, 0x7CCCFC, 0x7CD1C3, 0x7CD30A, 0x7CD3E5,
+  0x7CD566, 0x7CD661, 0x7CD95C, 0x7CD9A0, 0x7CDAC3, 0x7CDB98, 0x7CDE78, 0x7CDFA1,
+  0x7CE269, 0x7CE2CA, 0x7CE4AA, 0x7CE87F, 0x7CE97C, 0x7CE9D3, 0x7CEC79, 0x7CECB1,
+  0x7CED8D, 0x7CEDC6, 0x7CF05F, 0x7CF0E5, 0x7CF31B, 0x7CF34D, 0x7CF666, 0x7CF854,
+  0x7CF880, 0x7CF90E, 0x7CF9A0, 0x7CFADF, 0x7CFC16, 0x7CFC3C, 0x7CFCFD, 0x7CFD6B,
+  0x7CFD82, 0x7CFE90, 0x7CFF4D, 0x80000B, 0x800010, 0x80006E, 0x80015C, 0x800184,
+  0x80029C, 0x800384, 0x80045F, 0x800588, 0x800794, 0x800902, 0x800C67, 0x800CF9,
+  0x8012DF, 0x801382, 0x8014A8, 0x801605, 0x80177D, 0x801844, 0x8018A7, 0x801934,
+  0x801970, 0x801DAA, 0x801F02, 0x801F12, 0x8020DA, 0x8020FD, 0x802278, 0x8022A7,
+  0x80248F, 0x802511, 0x802689, 0x80276C, 0x80283C, 0x802994, 0x802AA8, 0x802BF9,
+  0x802D1A, 0x802DBF, 0x802EC3, 0x803049, 0x8030DC, 0x8030E0, 0x8031F0, 0x803253,
+  0x803428, 0x8035C1, 0x803773, 0x803896, 0x8038BC, 0x8038FB, 0x80398C, 0x803A0A,
+  0x803A59, 0x803AF4, 0x803C20, 0x803E48, 0x804126, 0x80414E, 0x80433F, 0x8044FD,
+  0x8045DD, 0x804786, 0x80482C, 0x8048A5, 0x804971, 0x804A14, 0x804AF2, 0x804B50,
+  0x804C5D, 0x804E70, 0x804E81, 0x80501B, 0x8050F6, 0x80546A, 0x80549C, 0x8054D9,
+  0x8054E3, 0x8056F2, 0x805719, 0x8058F8, 0x805A04, 0x805B65, 0x805E0C, 0x805E4F,
+  0x805EC0, 0x805FC5, 0x806007, 0x806036, 0x8060B7, 0x80616C, 0x80646F, 0x806559,
+  0x80656D, 0x80657C, 0x806599, 0x80691A, 0x806933, 0x806A00, 0x806AB0, 0x806C1B,
+  0x806D71, 0x806D97, 0x806F1C, 0x806FB0, 0x80711F, 0x80717A, 0x807215, 0x807264,
+  0x80739F, 0x80751F, 0x8076C2, 0x8077A4, 0x807871, 0x80795D, 0x807ABF, 0x807B3E,
+  0x807C0A, 0x807C62, 0x807D14, 0x807D3A, 0x807EB4, 0x807FF8, 0x80802C, 0x808223,
+  0x8082F5, 0x808544, 0x8086D9, 0x8086F2, 0x808917, 0x808A8B, 0x808ABD, 0x808C97,
+  0x808DB7, 0x808F1D, 0x808FE8, 0x809133, 0x80929F, 0x80953A, 0x809562, 0x809621,
+  0x8096B1, 0x8096CA, 0x8099E7, 0x809B20, 0x809F9B, 0x809FAB, 0x809FF5, 0x80A036,
+  0x80A1D7, 0x80A235, 0x80A589, 0x80A997, 0x80AB4D, 0x80AC7C, 0x80ACAC, 0x80ACC8,
+  0x80AD16, 0x80AE54, 0x80B03D, 0x80B07B, 0x80B234, 0x80B575, 0x80B655, 0x80B686,
+  0x80B946, 0x80B97A, 0x80B989, 0x80BC37, 0x80BE05, 0x80BEAF, 0x80C16E, 0x80C41B,
+  0x80C548, 0x80C5E6, 0x80C5F2, 0x80C6AB, 0x80C755, 0x80C7C5, 0x80C955, 0x80CA4B,
+  0x80CBBC, 0x80CC12, 0x80CC9C, 0x80CE62, 0x80CEB9, 0x80CF41, 0x80CFA2, 0x80D04A,
+  0x80D09B, 0x80D10A, 0x80D160, 0x80D21D, 0x80D2E5, 0x80D4A5, 0x80D605, 0x80DA13,
+  0x80DABC, 0x80DAC2, 0x80DB17, 0x80E01D, 0x80E1BF, 0x80E455, 0x80E540, 0x80E650,
+  0x80E82C, 0x80E86F, 0x80EA07, 0x80EA0B, 0x80EA23, 0x80EA96, 0x80EB77, 0x80ED2C,
+  0x80EE25, 0x80F0CF, 0x80F1A4, 0x80F3EF, 0x80F503, 0x80F5AE, 0x80F5B5, 0x80F62E,
+  0x80F7A6, 0x80FA5B, 0x80FB06, 0x80FBF0, 0x80FD7A, 0x80FD7B, 0x84002D, 0x8400D2,
+  0x840112, 0x840283, 0x840328, 0x8406FA, 0x8407C4, 0x840B2D, 0x840B7C, 0x840BBB,
+  0x840D8E, 0x84100D, 0x84119E, 0x84139F, 0x84144D, 0x841571, 0x8415D3, 0x84160C,
+  0x8416F9, 0x841766, 0x8417EF, 0x84183A, 0x841888, 0x841B5E, 0x841B77, 0x841C70,
+  0x841EA3, 0x842096, 0x8421F1, 0x842289, 0x842388, 0x84248D, 0x842519, 0x8425DB,
+  0x842615, 0x84262B, 0x842712, 0x8427B6, 0x842859, 0x842999, 0x842AFD, 0x842B2B,
+  0x842C80, 0x842E14, 0x842E27, 0x842F57, 0x843095, 0x8431A8, 0x843497, 0x8437D5,
+  0x843835, 0x843838, 0x84398F, 0x843A4B, 0x843C4C, 0x843C99, 0x843DC6, 0x843E03,
+  0x843E1D, 0x843E79, 0x843E92, 0x844167, 0x8444AF, 0x844693, 0x8446FE, 0x844765,
+  0x844BF5, 0x844DBE, 0x845075, 0x845181, 0x8454DF, 0x8455A5, 0x845733, 0x845A3E,
+  0x845B12, 0x845CF3, 0x845F04, 0x8461A0, 0x846223, 0x8463D6, 0x8464DD, 0x846569,
+  0x84683E, 0x846878, 0x846991, 0x846993, 0x846FCE, 0x847051, 0x8470D7, 0x847127,
+  0x84716A, 0x847293, 0x84742A, 0x847460, 0x847637, 0x84788B, 0x8478AC, 0x847973,
+  0x847A88, 0x847AB6, 0x847ADF, 0x847B57, 0x847BEB, 0x847C9B, 0x847E40, 0x847F3D,
+  0x84802D, 0x848102, 0x848371, 0x848506, 0x8487FF, 0x8488E1, 0x8489AD, 0x848A8D,
+  0x848C8D, 0x848DC7, 0x848DCE, 0x848E0C, 0x848EDF, 0x848F69, 0x84900A, 0x8493A0,
+  0x8493B2, 0x849437, 0x84948C, 0x8496D8, 0x849866, 0x849A40, 0x849CA6, 0x849DC2,
+  0x849FB5, 0x84A06E, 0x84A134, 0x84A1D1, 0x84A329, 0x84A423, 0x84A466, 0x84A6C8,
+  0x84A783, 0x84A8E4, 0x84A938, 0x84A93E, 0x84A9C4, 0x84AA9C, 0x84AB1A, 0x84AB26,
+  0x84AC16, 0x84AD58, 0x84AD8D, 0x84AFEC, 0x84B153, 0x84B1E2, 0x84B1E4, 0x84B261,
+  0x84B4D2, 0x84B4DB, 0x84B517, 0x84B541, 0x84B59C, 0x84B630, 0x84B802, 0x84B8B8,
+  0x84BA20, 0x84BA3B, 0x84BB26, 0x84BB69, 0x84BE52, 0x84C0EF, 0x84C1C1, 0x84C5A6,
+  0x84C692, 0x84C7EA, 0x84C807, 0x84C8A0, 0x84C9B2, 0x84C9C6, 0x84CC63, 0x84CCA8,
+  0x84D15A, 0x84D328, 0x84D343, 0x84D352, 0x84D3D5, 0x84D412, 0x84D47E, 0x84D5A0,
+  0x84D608, 0x84D6D0, 0x84D81B, 0x84D931, 0x84DB2F, 0x84DBA4, 0x84DBAC, 0x84DBFC,
+  0x84DD20, 0x84E058, 0x84E342, 0x84E657, 0x84E892, 0x84E8CB, 0x84E986, 0x84E9C1,
+  0x84EA97, 0x84EAED, 0x84EB18, 0x84EBEF, 0x84EEE4, 0x84EF18, 0x84F147, 0x84F3EB,
+  0x84F5EB, 0x84F703, 0x84FCAC, 0x84FCE6, 0x84FCFE, 0x84FD27, 0x84FDD1, 0x88010C,
+  0x8801F9, 0x88034C, 0x880355, 0x8803E9, 0x88074B, 0x880894, 0x8809AF, 0x880AA3,
+  0x880CE0, 0x880FA2, 0x88108F, 0x881196, 0x88124E, 0x8812AC, 0x881544, 0x8815C5,
+  0x8817A3, 0x881908, 0x881A14, 0x881C95, 0x881DFC, 0x881E5A, 0x881FA1, 0x88200D,
+  0x882067, 0x8822B2, 0x88231F, 0x88238C, 0x882508, 0x882510, 0x88252C, 0x882593,
+  0x88287D, 0x8828B3, 0x8828FB, 0x882949, 0x88299C, 0x882A5E, 0x882D53, 0x883037,
+  0x88308A, 0x88329B, 0x883314, 0x8835C1, 0x88365F, 0x88366C, 0x8836CF, 0x883A30,
+  0x883C1C, 0x883C93, 0x883D24, 0x883F27, 0x883F4A, 0x883F99, 0x883FD3, 0x884033,
+  0x88403B, 0x884067, 0x8841FC, 0x8843E1, 0x884477, 0x8844F6, 0x884604, 0x88462A,
+  0x884A70, 0x884AEA, 0x884D7C, 0x885046, 0x8850F6, 0x88517A, 0x8851FB, 0x8852EB,
+  0x88532E, 0x885395, 0x8853D4, 0x88541F, 0x88548E, 0x8857EE, 0x885A06, 0x885A85,
+  0x885A92, 0x885BDD, 0x885C47, 0x885DFB, 0x8863DF, 0x886440, 0x88659F, 0x886639,
+  0x88665A, 0x8866A5, 0x8867DC, 0x88684B, 0x88693D, 0x886AB1, 0x886AE3, 0x886B44,
+  0x886B6E, 0x886C60, 0x886D2D, 0x886EEB, 0x886FD4, 0x88708C, 0x8871B1, 0x8871E5,
+  0x887384, 0x887477, 0x887556, 0x887598, 0x887873, 0x88795B, 0x88797E, 0x887B2C,
+  0x887E25, 0x8881B9, 0x888322, 0x88835D, 0x888603, 0x888717, 0x88892F, 0x888E68,
+  0x888FA4, 0x889009, 0x88908D, 0x889471, 0x88947E, 0x88964E, 0x889746, 0x889B39,
+  0x889CAD, 0x889E33, 0x889E68, 0x889F6F, 0x889FFA, 0x88A0BE, 0x88A25E, 0x88A2D7,
+  0x88A303, 0x88A479, 0x88A4C2, 0x88A6C6, 0x88A73C, 0x88A9B7, 0x88AC9E, 0x88ACC0,
+  0x88AD43, 0x88ADD2, 0x88AE07, 0x88AE1D, 0x88AE35, 0x88AEDD, 0x88B111, 0x88B1E1,
+  0x88B291, 0x88B362, 0x88B4A6, 0x88B4BE, 0x88B5FF, 0x88B6BD, 0x88B6EE, 0x88B7EB,
+  0x88B863, 0x88B86F, 0x88B945, 0x88BCC1, 0x88BD45, 0x88BD78, 0x88BFE4, 0x88C08B,
+  0x88C174, 0x88C227, 0x88C255, 0x88C397, 0x88C626, 0x88C663, 0x88C6E8, 0x88C9D0,
+  0x88C9E8, 0x88CB87, 0x88CC45, 0x88CE3F, 0x88CEFA, 0x88CF98, 0x88D039, 0x88D274,
+  0x88D50C, 0x88D5A8, 0x88D7F6, 0x88D82E, 0x88D98F, 0x88DA1A, 0x88DE7C, 0x88DEA9,
+  0x88DF9E, 0x88E056, 0x88E0F3, 0x88E3AB, 0x88E64B, 0x88E87F, 0x88E9A4, 0x88E9FE,
+  0x88EF16, 0x88F031, 0x88F077, 0x88F2BD, 0x88F56E, 0x88F7BF, 0x88F7C7, 0x88F872,
+  0x88FC5D, 0x88FCA6, 0x8C006D, 0x8C02CD, 0x8C04BA, 0x8C04FF, 0x8C0734, 0x8C0879,
+  0x8C088B, 0x8C09F4, 0x8C0C87, 0x8C0C90, 0x8C0D76, 0x8C0EE3, 0x8C0F6F, 0x8C0FC9,
+  0x8C10D4, 0x8C14B4, 0x8C15C7, 0x8C1645, 0x8C1759, 0x8C17B6, 0x8C1850, 0x8C19B5,
+  0x8C1A50, 0x8C1ABF, 0x8C1D96, 0x8C1E80, 0x8C210A, 0x8C2505, 0x8C26AA, 0x8C2937,
+  0x8C2DAA, 0x8C3401, 0x8C3446, 0x8C34FD, 0x8C3592, 0x8C367A, 0x8C3A7E, 0x8C3AE3,
+  0x8C3B4A, 0x8C3BAD, 0x8C3C4A, 0x8C426D, 0x8C444F, 0x8C44A5, 0x8C4500, 0x8C47BE,
+  0x8C4962, 0x8C497A, 0x8C49B6, 0x8C4B14, 0x8C4CDC, 0x8C5219, 0x8C53C3, 0x8C53D2,
+  0x8C53E6, 0x8C541D, 0x8C554A, 0x8C5646, 0x8C56C5, 0x8C579B, 0x8C5877, 0x8C5973,
+  0x8C5A25, 0x8C5AC1, 0x8C5AF8, 0x8C5BF0, 0x8C5C20, 0x8C5EBD, 0x8C5FAD, 0x8C604F,
+  0x8C6120, 0x8C61A3, 0x8C6422, 0x8C64A2, 0x8C65A3, 0x8C6794, 0x8C683A, 0x8C68C8,
+  0x8C6A3B, 0x8C6A8D, 0x8C6BDB, 0x8C6D50, 0x8C6D77, 0x8C6FB9, 0x8C705A, 0x8C71F8,
+  0x8C736E, 0x8C73A0, 0x8C763F, 0x8C7712, 0x8C7716, 0x8C78D7, 0x8C7909, 0x8C7967,
+  0x8C79F5, 0x8C7A00, 0x8C7A15, 0x8C7A3D, 0x8C7AAA, 0x8C7B9D, 0x8C7C92, 0x8C7CB5,
+  0x8C7CFF, 0x8C7F3B, 0x8C8172, 0x8C8394, 0x8C83DF, 0x8C83E1, 0x8C83E8, 0x8C8401,
+  0x8C8442, 0x8C8474, 0x8C8580, 0x8C8590, 0x8C85C1, 0x8C861E, 0x8C862A, 0x8C8881,
+  0x8C89A5, 0x8C8B83, 0x8C8CAA, 0x8C8D28, 0x8C8E0D, 0x8C8EF2, 0x8C8FE9, 0x8C90D3,
+  0x8C941F, 0x8C9461, 0x8C946A, 0x8C94CC, 0x8C97EA, 0x8C986B, 0x8C99E6, 0x8C9B2D,
+  0x8C9F3B, 0x8CA399, 0x8CA6DF, 0x8CA96F, 0x8CA982, 0x8CAAB5, 0x8CAACE, 0x8CAB8E,
+  0x8CB0E9, 0x8CB64F, 0x8CB84A, 0x8CB864, 0x8CB87E, 0x8CBA25, 0x8CBEBE, 0x8CBFA6,
+  0x8CC121, 0x8CC5B4, 0x8CC681, 0x8CC84B, 0x8CC8CD, 0x8CCDE8, 0x8CCDFE, 0x8CCE4E,
+  0x8CCF09, 0x8CD0B2, 0x8CD48E, 0x8CD54A, 0x8CD67F, 0x8CD9D6, 0x8CDC02, 0x8CDCD4,
+  0x8CDEE6, 0x8CDEF9, 0x8CDF2C, 0x8CDF9D, 0x8CE042, 0x8CE081, 0x8CE117, 0x8CE5C0,
+  0x8CE5EF, 0x8CE748, 0x8CE9B4, 0x8CE9EE, 0x8CEA12, 0x8CEA1B, 0x8CEA48, 0x8CEBC6,
+  0x8CEC4B, 0x8CEC7B, 0x8CEEFD, 0x8CF112, 0x8CF228, 0x8CF319, 0x8CF5A3, 0x8CF681,
+  0x8CF710, 0x8CF773, 0x8CF8C5, 0x8CFABA, 0x8CFADD, 0x8CFD18, 0x8CFDDE, 0x8CFDF0,
+  0x8CFE57, 0x8CFE74, 0x90004E, 0x9000DB, 0x900117, 0x90013B, 0x900218, 0x9002A9,
+  0x900325, 0x900371, 0x9003B7, 0x900628, 0x9006F2, 0x9009DF, 0x900A1A, 0x900A62,
+  0x900A84, 0x900CC8, 0x900DCB, 0x900E9E, 0x900F0C, 0x901195, 0x901234, 0x9012A1,
+  0x9016BA, 0x90173F, 0x9017AC, 0x9017C8, 0x90187C, 0x901A4F, 0x901ACA, 0x901B0E,
+  0x901D27, 0x90203A, 0x9020C2, 0x902106, 0x902155, 0x90235B, 0x9023B4, 0x9023EC,
+  0x9025F2, 0x902759, 0x9027E4, 0x902AEE, 0x902B34, 0x902BD2, 0x902C09, 0x902D77,
+  0x902E16, 0x902E1C, 0x90314B, 0x90324B, 0x9034FC, 0x9035EA, 0x903809, 0x90380C,
+  0x90395E, 0x90395F, 0x903A72, 0x903AA0, 0x903AE6, 0x903C1D, 0x903C92, 0x903CB3,
+  0x903E7F, 0x903EAB, 0x903FEA, 0x904528, 0x90473C, 0x904846, 0x90486C, 0x90489A,
+  0x904992, 0x9049FA, 0x904C81, 0x904CE5, 0x904D4A, 0x904E2B, 0x9050CA, 0x9052BF,
+  0x9055DE, 0x905607, 0x9056FC, 0x905851, 0x9059AF, 0x905A08, 0x905C44, 0x905D7C,
+  0x905E44, 0x905F2E, 0x9060F1, 0x9061AE, 0x90623F, 0x90633B, 0x9064AD, 0x906560,
+  0x906584, 0x90671C, 0x9067B5, 0x9067F3, 0x9068C3, 0x906AEB, 0x906CAC, 0x906D62,
+  0x906EBB, 0x906F18, 0x907065, 0x9070D3, 0x907240, 0x907282, 0x90735A, 0x9075BC,
+  0x9075DE, 0x90769F, 0x9077EE, 0x907841, 0x9078B2, 0x907910, 0x9079CF, 0x907BC6,
+  0x907E43, 0x907F61, 0x90808F, 0x90812A, 0x908158, 0x908175, 0x908260, 0x90837E,
+  0x90840D, 0x908674, 0x90869B, 0x908855, 0x90895F, 0x908C43, 0x908D6C, 0x908D6E,
+  0x908D78, 0x90935A, 0x90940A, 0x909497, 0x9094E4, 0x9096F3, 0x9097D5, 0x9097F3,
+  0x909838, 0x909877, 0x909A4A, 0x909A77, 0x909B6F, 0x909C4A, 0x909D7D, 0x909F33,
+  0x90A25B, 0x90A365, 0x90A4DE, 0x90A57D, 0x90A5AF, 0x90A6BF, 0x90A7BF, 0x90A822,
+  0x90AAC3, 0x90AB96, 0x90ADF7, 0x90ADFC, 0x90AE1B, 0x90B0ED, 0x90B11C, 0x90B134,
+  0x90B144, 0x90B21F, 0x90B4DD, 0x90B57F, 0x90B622, 0x90B67A, 0x90B685, 0x90B686,
+  0x90B832, 0x90B931, 0x90B97D, 0x90BDE6, 0x90C115, 0x90C119, 0x90C1C6, 0x90C35F,
+  0x90C54A, 0x90C710, 0x90C792, 0x90C7D8, 0x90CAFA, 0x90CC24, 0x90CC7A, 0x90CCDF,
+  0x90CD1F, 0x90CDB6, 0x90CEB8, 0x90CF15, 0x90CF7D, 0x90D092, 0x90D432, 0x90D473,
+  0x90D7EB, 0x90D8F3, 0x90DD5D, 0x90DF7D, 0x90E17B, 0x90E202, 0x90E2BA, 0x90E468,
+  0x90E6BA, 0x90E710, 0x90E7C4, 0x90E868, 0x90E95E, 0x90EB50, 0x90ECE3, 0x90ECEA,
+  0x90EEC7, 0x90EF68, 0x90F052, 0x90F157, 0x90F1AA, 0x90F260, 0x90F305, 0x90F3B8,
+  0x90F644, 0x90F652, 0x90F7B2, 0x90F82E, 0x90F891, 0x90F970, 0x90F9B7, 0x90FB5B,
+  0x90FBA6, 0x90FD61, 0x90FD73, 0x90FD9F, 0x90FFD6, 0x940070, 0x9400B0, 0x9401C2,
+  0x940230, 0x94049C, 0x9404E3, 0x940853, 0x9408C7, 0x940937, 0x9409C9, 0x940B19,
+  0x940B83, 0x940BFA, 0x940C6D, 0x940C98, 0x940D2D, 0x940E6B, 0x940EE7, 0x94103E,
+  0x941457, 0x94147A, 0x9415B2, 0x941625, 0x941700, 0x941865, 0x941882, 0x941C56,
+  0x942053, 0x9424B8, 0x9424E1, 0x942533, 0x94261D, 0x942790, 0x94282E, 0x94286F,
+  0x94292F, 0x942A6F, 0x942CB3, 0x942DDC, 0x9431CB, 0x943251, 0x9432C1, 0x9433D8,
+  0x943469, 0x94350A, 0x943589, 0x9437F7, 0x9439E5, 0x943A91, 0x943AF0, 0x943BB0,
+  0x943BB1, 0x943C96, 0x943CC6, 0x943F0C, 0x943FC2, 0x943FD6, 0x9440C9, 0x9440F3,
+  0x94434D, 0x944444, 0x944452, 0x944560, 0x944788, 0x944A0C, 0x944E5B, 0x945103,
+  0x945244, 0x945330, 0x9454CE, 0x945641, 0x9457A5, 0x9458CB, 0x945AFC, 0x945C9A,
+  0x945F34, 0x946010, 0x9460D5, 0x946269, 0x946372, 0x9463D1, 0x946424, 0x94652D,
+  0x94659C, 0x946A77, 0x946AB0, 0x946DAE, 0x94706C, 0x9471AC, 0x9476B7, 0x94772B,
+  0x947918, 0x947BAE, 0x947BE7, 0x947D77, 0x947FD8, 0x94877C, 0x9487E0, 0x948854,
+  0x948AC6, 0x948BC1, 0x948CD7, 0x948ED3, 0x948FCF, 0x949010, 0x949034, 0x94917F,
+  0x949426, 0x9495A0, 0x9497AE, 0x949869, 0x94988F, 0x949AA9, 0x949B2C, 0x949F3E,
+  0x949F8B, 0x94A07D, 0x94A1A2, 0x94A408, 0x94A4B5, 0x94A4F9, 0x94A67E, 0x94A7B7,
+  0x94A9A8, 0x94AA0A, 0x94ABFE, 0x94AD23, 0x94AE61, 0x94AEF0, 0x94B01F, 0x94B10A,
+  0x94B216, 0x94B271, 0x94B2CC, 0x94B34F, 0x94B40F, 0x94B555, 0x94B819, 0x94B86D,
+  0x94B8C5, 0x94B97E, 0x94BA56, 0x94BB43, 0x94BE09, 0x94BE46, 0x94BE50, 0x94BF2D,
+  0x94BF80, 0x94BF94, 0x94BF95, 0x94BFC4, 0x94C150, 0x94C5A6, 0x94C691, 0x94CBCD,
+  0x94CCB9, 0x94CE0F, 0x94CE2C, 0x94D00D, 0x94D029, 0x94D2BC, 0x94D331, 0x94D469,
+  0x94D505, 0x94D54D, 0x94D723, 0x94D771, 0x94D859, 0x94D9B3, 0x94DB56, 0x94DBC9,
+  0x94DBDA, 0x94DDF8, 0x94DE80, 0x94DEB8, 0x94DF34, 0x94DF4E, 0x94E0D6, 0x94E129,
+  0x94E1AC, 0x94E23C, 0x94E300, 0x94E36D, 0x94E3EE, 0x94E4BA, 0x94E686, 0x94E6F7,
+  0x94E70B, 0x94E7EA, 0x94E8C5, 0x94E96A, 0x94E979, 0x94E98C, 0x94E9EE, 0x94EA32,
+  0x94EAEA, 0x94EB2C, 0x94EBCD, 0x94EE9F, 0x94F128, 0x94F2BB, 0x94F392, 0x94F665,
+  0x94F6A3, 0x94F6D6, 0x94F6F2, 0x94F7AD, 0x94F827, 0x94F929, 0x94FB29, 0x94FBB2,
+  0x94FE22, 0x94FE9D, 0x94FEF4, 0x94FF3C, 0x94FF61, 0x98006A, 0x980074, 0x9800C6,
+  0x9801A7, 0x98038A, 0x98039B, 0x9803CF, 0x9803D8, 0x98063A, 0x98063C, 0x98072D,
+  0x9809CF, 0x980C33, 0x980C82, 0x980CA5, 0x980D2E, 0x980D51, 0x980D67, 0x980D6F,
+  0x980DAF, 0x980E24, 0x980EE4, 0x9810E8, 0x981333, 0x9817F1, 0x981888, 0x98192C,
+  0x981A35, 0x981DFA, 0x981E19, 0x982044, 0x98226E, 0x9822EF, 0x98254A, 0x98256E,
+  0x9826AD, 0x9828A6, 0x9829A6, 0x982CBC, 0x982CBE, 0x982D68, 0x982F3C, 0x982F86,
+  0x982FF8, 0x9835ED, 0x983910, 0x98398E, 0x9839C0, 0x983B16, 0x983B67, 0x983B8F,
+  0x983F60, 0x983F66, 0x9840BB, 0x98415C, 0x984265, 0x9843FA, 0x9844CE, 0x984562,
+  0x98460A, 0x984827, 0x984874, 0x984914, 0x984925, 0x984A6B, 0x984B06, 0x984B4A,
+  0x984BE1, 0x984FEE, 0x98502E, 0x98523D, 0x98524A, 0x9852B1, 0x98541B, 0x985945,
+  0x98597A, 0x985AEB, 0x985D82, 0x985DAD, 0x985F41, 0x985FD3, 0x9860CA, 0x986610,
+  0x98672E, 0x98698A, 0x986B3D, 0x986CF5, 0x986F60, 0x9874DA, 0x98751A, 0x9877E7,
+  0x987A10, 0x987A14, 0x987BF3, 0x987DDD, 0x987ECA, 0x987EE3, 0x9880EE, 0x98818A,
+  0x988389, 0x9884E3, 0x98865D, 0x98868B, 0x98876C, 0x988924, 0x988B0A, 0x988B5D,
+  0x988CB3, 0x988D46, 0x988ED4, 0x988F00, 0x989096, 0x9893CC, 0x9897CC, 0x9897D1,
+  0x989AB9, 0x989BCB, 0x989C57, 0x989D5D, 0x989DB2, 0x989DE5, 0x989E63, 0x989F1E,
+  0x98A2C0, 0x98A404, 0x98A5F9, 0x98A829, 0x98A92D, 0x98ACEF, 0x98AD1D, 0x98AF65,
+  0x98B039, 0x98B08B, 0x98B379, 0x98B3EF, 0x98B6E9, 0x98B8BA, 0x98B8BC, 0x98B8E3,
+  0x98BB1E, 0x98BD80, 0x98BE94, 0x98BEDC, 0x98C5DB, 0x98C854, 0x98C8B8, 0x98C97C,
+  0x98CA33, 0x98CCD9, 0x98CCF3, 0x98CDAC, 0x98CF53, 0x98D293, 0x98D3D7, 0x98D6BB,
+  0x98D6F7, 0x98D742, 0x98D7E1, 0x98D863, 0x98D88C, 0x98DAC4, 0x98DD60, 0x98DDEA,
+  0x98DED0, 0x98DF82, 0x98E0D9, 0x98E743, 0x98E7F4, 0x98E7F5, 0x98E8FA, 0x98ED5C,
+  0x98ED7E, 0x98EDCA, 0x98EE8C, 0x98EECB, 0x98EF9B, 0x98F07B, 0x98F083, 0x98F0AB,
+  0x98F112, 0x98F170, 0x98F181, 0x98F199, 0x98F217, 0x98F2B3, 0x98F428, 0x98F487,
+  0x98F4AB, 0x98F537, 0x98F5A9, 0x98F621, 0x98F781, 0x98F7D7, 0x98F9CC, 0x98FA9B,
+  0x98FAE3, 0x98FB27, 0x98FC11, 0x98FDB4, 0x98FE94, 0x98FEE1, 0x98FFD0, 0x9C0298,
+  0x9C04EB, 0x9C0567, 0x9C0591, 0x9C05D6, 0x9C061B, 0x9C0971, 0x9C098B, 0x9C0B05,
+  0x9C0C35, 0x9C0CDF, 0x9C1463, 0x9C1874, 0x9C19C2, 0x9C1A25, 0x9C1C12, 0x9C1C37,
+  0x9C1D36, 0x9C1D58, 0x9C1E95, 0x9C1EA4, 0x9C207B, 0x9C216A, 0x9C2183, 0x9C2472,
+  0x9C2595, 0x9C28B3, 0x9C28EF, 0x9C28F7, 0x9C293F, 0x9C2976, 0x9C2A70, 0x9C2A83,
+  0x9C2BA6, 0x9C2DCD, 0x9C2E7A, 0x9C2EA1, 0x9C2F4E, 0x9C2F9D, 0x9C305B, 0x9C31C3,
+  0x9C32A9, 0x9C32CE, 0x9C3426, 0x9C35EB, 0x9C3708, 0x9C37CB, 0x9C37F4, 0x9C3818,
+  0x9C3928, 0x9C3A9A, 0x9C3AAF, 0x9C3DCF, 0x9C3E53, 0x9C4952, 0x9C497F, 0x9C4A7B,
+  0x9C4E20, 0x9C4E36, 0x9C4F5F, 0x9C4FCF, 0x9C4FDA, 0x9C50D1, 0x9C50EE, 0x9C52F8,
+  0x9C5322, 0x9C5416, 0x9C5467, 0x9C54C2, 0x9C5636, 0x9C57AD, 0x9C57BC, 0x9C583C,
+  0x9C5884, 0x9C5A44, 0x9C5A81, 0x9C5C8E, 0x9C5CF9, 0x9C5D12, 0x9C5F5A, 0x9C5FB0,
+  0x9C6121, 0x9C62AB, 0x9C635B, 0x9C63C0, 0x9C63ED, 0x9C648B, 0x9C65B0, 0x9C65EE,
+  0x9C65F9, 0x9C6865, 0x9C6937, 0x9C69D1, 0x9C6B00, 0x9C6B37, 0x9C6B72, 0x9C6BF0,
+  0x9C6C15, 0x9C6F52, 0x9C713A, 0x9C7370, 0x9C73B1, 0x9C7403, 0x9C741A, 0x9C746F,
+  0x9C760E, 0x9C7613, 0x9C7A03, 0x9C7BEF, 0x9C7DA3, 0x9C7F81, 0x9C80DF, 0x9C823F,
+  0x9C8275, 0x9C8281, 0x9C84B6, 0x9C84BF, 0x9C8566, 0x9C88AD, 0x9C8ACB, 0x9C8BA0,
+  0x9C8C6E, 0x9C8CD8, 0x9C8D7C, 0x9C8E99, 0x9C8E9C, 0x9C8ECD, 0x9C8EDC, 0x9C924F,
+  0x9C93E4, 0x9C9561, 0x9C9567, 0x9C956E, 0x9C9726, 0x9C9789, 0x9C99A0, 0x9C9C1F,
+  0x9C9C40, 0x9C9D7E, 0x9C9E71, 0x9C9ED5, 0x9CA2F4, 0x9CA389, 0x9CA513, 0x9CA570,
+  0x9CA5C0, 0x9CA615, 0x9CA9E4, 0x9CAA1B, 0x9CAC6D, 0x9CAD97, 0x9CAED3, 0x9CAF6F,
+  0x9CAFCA, 0x9CB1DC, 0x9CB206, 0x9CB2B2, 0x9CB2E8, 0x9CB400, 0x9CB654, 0x9CB70D,
+  0x9CB8B4, 0x9CBCF0, 0x9CBFCD, 0x9CC12D, 0x9CC172, 0x9CC2C4, 0x9CC7A6, 0x9CC7D1,
+  0x9CC893, 0x9CC8E9, 0x9CC8FC, 0x9CC9EB, 0x9CCAD9, 0x9CCC83, 0x9CD21E, 0x9CD24B,
+  0x9CD35B, 0x9CD36D, 0x9CD4A6, 0x9CD57D, 0x9CD643, 0x9CD917, 0x9CDA3E, 0x9CDBAF,
+  0x9CDBCB, 0x9CDC71, 0x9CDF03, 0x9CE041, 0x9CE063, 0x9CE176, 0x9CE330, 0x9CE33F,
+  0x9CE374, 0x9CE635, 0x9CE65E, 0x9CE6E7, 0x9CE82B, 0x9CE895, 0x9CE91C, 0x9CEA97,
+  0x9CEC61, 0x9CF029, 0x9CF155, 0x9CF1D4, 0x9CF387, 0x9CF48E, 0x9CF531, 0x9CF55F,
+  0x9CF8B8, 0x9CFA76, 0x9CFB77, 0x9CFBD5, 0x9CFC01, 0x9CFC28, 0x9CFCE8, 0x9CFEA1,
+  0xA0004C, 0xA002A5, 0xA002DC, 0xA00460, 0xA00798, 0xA0086F, 0xA0092E, 0xA009ED,
+  0xA00BBA, 0xA00F37, 0xA01077, 0xA01081, 0xA01290, 0xA013CB, 0xA0143D, 0xA017F1,
+  0xA01828, 0xA01842, 0xA01B29, 0xA01C87, 0xA01C8D, 0xA01D48, 0xA020A6, 0xA02195,
+  0xA021AA, 0xA021B7, 0xA022DE, 0xA0239F, 0xA025D7, 0xA027B6, 0xA028ED, 0xA02919,
+  0xA02942, 0xA02BB8, 0xA02C36, 0xA02D13, 0xA02DDB, 0xA031DB, 0xA03679, 0xA0369F,
+  0xA036BC, 0xA039EE, 0xA039F7, 0xA03BE3, 0xA03C31, 0xA03D6E, 0xA03D6F, 0xA0406F,
+  0xA040A0, 0xA04147, 0xA042D1, 0xA043B0, 0xA0445C, 0xA044B7, 0xA0465A, 0xA0481C,
+  0xA04A5E, 0xA04C0C, 0xA04C5B, 0xA04E04, 0xA04EA7, 0xA04ECF, 0xA04F85, 0xA04FD4,
+  0xA0510B, 0xA051C6, 0xA05272, 0xA0551F, 0xA0554F, 0xA055DE, 0xA056B2, 0xA056F3,
+  0xA057E3, 0xA05950, 0xA06032, 0xA06090, 0xA06260, 0xA062FB, 0xA06391, 0xA0648F,
+  0xA06518, 0xA06610, 0xA06720, 0xA0681C, 0xA0687E, 0xA06974, 0xA069D9, 0xA06A00,
+  0xA06A44, 0xA06C65, 0xA06CEC, 0xA06FAA, 0xA070B7, 0xA071A9, 0xA0722C, 0xA07591,
+  0xA0764E, 0xA0779E, 0xA07817, 0xA0782D, 0xA078BA, 0xA07D9C, 0xA07F8A, 0xA08069,
+  0xA0821F, 0xA08222, 0xA085FC, 0xA086C6, 0xA08869, 0xA0889D, 0xA088B4, 0xA088C2,
+  0xA089E4, 0xA08CF8, 0xA08CFD, 0xA08D16, 0xA08E24, 0xA08E78, 0xA09169, 0xA091C8,
+  0xA09208, 0xA09347, 0xA09351, 0xA0941A, 0xA0950C, 0xA0957F, 0xA0999B, 0xA09B12,
+  0xA09B17, 0xA09D86, 0xA09DC1, 0xA09E1A, 0xA09F10, 0xA0A001, 0xA0A0DC, 0xA0A309,
+  0xA0A33B, 0xA0A3B3, 0xA0A3E2, 0xA0A3F0, 0xA0A4C5, 0xA0A8CD, 0xA0AB1B, 0xA0AB51,
+  0xA0AC69, 0xA0AF12, 0xA0AFBD, 0xA0B086, 0xA0B339, 0xA0B3CC, 0xA0B40F, 0xA0B439,
+  0xA0B4A5, 0xA0B53C, 0xA0B549, 0xA0B765, 0xA0BC6F, 0xA0BD1D, 0xA0BDCD, 0xA0C20D,
+  0xA0C562, 0xA0C589, 0xA0C98B, 0xA0C9A0, 0xA0CBFD, 0xA0CC2B, 0xA0CDF3, 0xA0CF5B,
+  0xA0CFF5, 0xA0D05B, 0xA0D0DC, 0xA0D1B3, 0xA0D2B1, 0xA0D365, 0xA0D37A, 0xA0D3C1,
+  0xA0D722, 0xA0D795, 0xA0D7A0, 0xA0D7F3, 0xA0D807, 0xA0D83D, 0xA0DD6C, 0xA0DDE5,
+  0xA0DE0F, 0xA0DF15, 0xA0E0AF, 0xA0E453, 0xA0E4CB, 0xA0E6F8, 0xA0E70B, 0xA0E7AE,
+  0xA0EC80, 0xA0ECF9, 0xA0ED6D, 0xA0EDCD, 0xA0EDFB, 0xA0F3C1, 0xA0F3E4, 0xA0F419,
+  0xA0F450, 0xA0F459, 0xA0F479, 0xA0F6FD, 0xA0F849, 0xA0F895, 0xA0FB83, 0xA0FBC5,
+  0xA0FF0C, 0xA0FF70, 0xA4004E, 0xA400E2, 0xA402B9, 0xA40450, 0xA4056E, 0xA405D6,
+  0xA406E9, 0xA407B6, 0xA40801, 0xA408EA, 0xA408F5, 0xA40CC3, 0xA40E75, 0xA40F98,
+  0xA410B6, 0xA41194, 0xA411BB, 0xA41232, 0xA41242, 0xA41437, 0xA41566, 0xA41588,
+  0xA416C0, 0xA416E7, 0xA41731, 0xA4178B, 0xA41875, 0xA41894, 0xA41908, 0xA41A3A,
+  0xA41B34, 0xA41EE1, 0xA41F72, 0xA4218A, 0xA42249, 0xA4251B, 0xA42618, 0xA427A5,
+  0xA42940, 0xA42985, 0xA42A71, 0xA42A95, 0xA42B8C, 0xA42BB0, 0xA4307A, 0xA43111,
+  0xA43135, 0xA433D7, 0xA434D9, 0xA434F1, 0xA436C7, 0xA4373E, 0xA438CC, 0xA439B3,
+  0xA43B0E, 0xA43D78, 0xA43F68, 0xA44027, 0xA4423B, 0xA4438C, 0xA444D1, 0xA44519,
+  0xA446B4, 0xA44B15, 0xA44BD5, 0xA44C11, 0xA44CC8, 0xA44E31, 0xA45046, 0xA4515E,
+  0xA4516F, 0xA4526F, 0xA4530E, 0xA45385, 0xA45590, 0xA4561B, 0xA45630, 0xA456CC,
+  0xA45C25, 0xA45C27, 0xA45D36, 0xA45DA1, 0xA45E60, 0xA46011, 0xA46032, 0xA463A1,
+  0xA46706, 0xA46BB6, 0xA46C24, 0xA46C2A, 0xA46CF1, 0xA46DA4, 0xA46DD4, 0xA470D6,
+  0xA47174, 0xA473AB, 0xA475B9, 0xA47733, 0xA47760, 0xA477F3, 0xA47806, 0xA47886,
+  0xA47952, 0xA47AA4, 0xA47B1A, 0xA47B2C, 0xA47B9D, 0xA47CC9, 0xA47D9F, 0xA47E36,
+  0xA47E39, 0xA4817A, 0xA481EE, 0xA483E7, 0xA48431, 0xA486AE, 0xA48873, 0xA48CDB,
+  0xA48D3B, 0xA490CE, 0xA491B1, 0xA492CB, 0xA4933F, 0xA4934C, 0xA49733, 0xA4975C,
+  0xA4978A, 0xA497B1, 0xA49813, 0xA49947, 0xA49A58, 0xA49B4F, 0xA49BCD, 0xA49DDD,
+  0xA49E69, 0xA4A1C2, 0xA4A24A, 0xA4A46B, 0xA4A490, 0xA4A528, 0xA4A6A9, 0xA4A80F,
+  0xA4A930, 0xA4AAFE, 0xA4AC0F, 0xA4AE11, 0xA4AE12, 0xA4B197, 0xA4B1C1, 0xA4B1E9,
+  0xA4B239, 0xA4B439, 0xA4B52E, 0xA4B61E, 0xA4B805, 0xA4BA76, 0xA4BADB, 0xA4BB6D,
+  0xA4BD7E, 0xA4BDC4, 0xA4BE2B, 0xA4BF01, 0xA4C0E1, 0xA4C337, 0xA4C361, 0xA4C3F0,
+  0xA4C494, 0xA4C54E, 0xA4C64F, 0xA4C69A, 0xA4C6F0, 0xA4C74B, 0xA4C7DE, 0xA4C7F6,
+  0xA4C939, 0xA4CAA0, 0xA4CCB3, 0xA4CCB9, 0xA4CD23, 0xA4CEDA, 0xA4CF12, 0xA4CF99,
+  0xA4CFD2, 0xA4D18C, 0xA4D1D2, 0xA4D23E, 0xA4D578, 0xA4D5C2, 0xA4D73C, 0xA4D795,
+  0xA4D931, 0xA4D990, 0xA4DA32, 0xA4DB30, 0xA4DCBE, 0xA4DD58, 0xA4DE26, 0xA4E11A,
+  0xA4E287, 0xA4E31B, 0xA4E4B8, 0xA4E57C, 0xA4E615, 0xA4E731, 0xA4E975, 0xA4EA8E,
+  0xA4EBD3, 0xA4ED4E, 0xA4EE57, 0xA4EF15, 0xA4F05E, 0xA4F1E8, 0xA4F33B, 0xA4F3E7,
+  0xA4F465, 0xA4F4C2, 0xA4F6E8, 0xA4F841, 0xA4F933, 0xA4FA76, 0xA4FC14, 0xA4FF95,
+  0xA802DB, 0xA8032A, 0xA80556, 0xA80600, 0xA80BFB, 0xA80C0D, 0xA80C63, 0xA80CCA,
+  0xA81087, 0xA811FC, 0xA81306, 0xA81374, 0xA8154D, 0xA8169D, 0xA816B2, 0xA816D0,
+  0xA81710, 0xA81AF1, 0xA81B5A, 0xA81B6A, 0xA81D16, 0xA81E84, 0xA82066, 0xA82316,
+  0xA823FE, 0xA824B8, 0xA825EB, 0xA826D9, 0xA82BB5, 0xA82BB9, 0xA82BCD, 0xA82C3E,
+  0xA8301C, 0xA830AD, 0xA830BC, 0xA8346A, 0xA83512, 0xA83759, 0xA83944, 0xA83A79,
+  0xA83B5C, 0xA83B76, 0xA83CA5, 0xA83E0E, 0xA83ED3, 0xA8400B, 0xA8407D, 0xA84122,
+  0xA841F4, 0xA842A1, 0xA842A7, 0xA842E3, 0xA843A4, 0xA84481, 0xA8469D, 0xA8474A,
+  0xA848FA, 0xA8494D, 0xA84A28, 0xA84B4D, 0xA84E3F, 0xA84FB1, 0xA85081, 0xA8515B,
+  0xA851AB, 0xA852D4, 0xA8537D, 0xA854B2, 0xA8574E, 0xA85840, 0xA8595F, 0xA85AE0,
+  0xA85B78, 0xA85BB7, 0xA85BF7, 0xA85C2C, 0xA85E45, 0xA85EF2, 0xA860B6, 0xA861DF,
+  0xA8637D, 0xA863F2, 0xA864F1, 0xA8667F, 0xA8698C, 0xA86A6F, 0xA86A86, 0xA86ABB,
+  0xA86B7C, 0xA86BAD, 0xA86D5F, 0xA86DAA, 0xA86E4E, 0xA86F36, 0xA8705D, 0xA87116,
+  0xA8741D, 0xA87484, 0xA87650, 0xA877E5, 0xA8798D, 0xA87B39, 0xA87C01, 0xA87C45,
+  0xA87CF8, 0xA87D12, 0xA87E33, 0xA87EEA, 0xA88055, 0xA8817E, 0xA88195, 0xA88200,
+  0xA886DD, 0xA887B3, 0xA88808, 0xA8881F, 0xA88940, 0xA88C3E, 0xA88E24, 0xA88FD9,
+  0xA8913D, 0xA89162, 0xA8922C, 0xA8934A, 0xA89609, 0xA89675, 0xA8968A, 0xA897CD,
+  0xA897DC, 0xA89892, 0xA89969, 0xA89A93, 0xA89AD7, 0xA89C78, 0xA89CED, 0xA89D21,
+  0xA89DD2, 0xA89FBA, 0xA89FEC, 0xA8A159, 0xA8A198, 0xA8A237, 0xA8A648, 0xA8A668,
+  0xA8A795, 0xA8AA7C, 0xA8ABB5, 0xA8AD3D, 0xA8B088, 0xA8B13B, 0xA8B1D4, 0xA8B271,
+  0xA8B2DA, 0xA8B456, 0xA8B483, 0xA8B57C, 0xA8B86E, 0xA8B9B3, 0xA8BA69, 0xA8BB56,
+  0xA8BBCF, 0xA8BD27, 0xA8BD3A, 0xA8BE27, 0xA8C092, 0xA8C252, 0xA8C266, 0xA8C56F,
+  0xA8C647, 0xA8C83A, 0xA8C98A, 0xA8CA77, 0xA8CA7B, 0xA8CAB9, 0xA8CC6F, 0xA8D081,
+  0xA8D0E5, 0xA8D3F7, 0xA8D4E0, 0xA8DA0C, 0xA8DB03, 0xA8E018, 0xA8E207, 0xA8E2C1,
+  0xA8E2C3, 0xA8E3EE, 0xA8E539, 0xA8E544, 0xA8E621, 0xA8E705, 0xA8E77D, 0xA8E81E,
+  0xA8E978, 0xA8EA71, 0xA8EF5F, 0xA8F1B2, 0xA8F266, 0xA8F274, 0xA8F5AC, 0xA8F5DD,
+  0xA8F7D9, 0xA8F8C9, 0xA8F94B, 0xA8FAD8, 0xA8FB40, 0xA8FE9D, 0xA8FFBA, 0xAA0000,
+  0xAA0001, 0xAA0002, 0xAA0003, 0xAA0004, 0xAC007A, 0xAC00D0, 0xAC075F, 0xAC0775,
+  0xAC0BFB, 0xAC0D1B, 0xAC1203, 0xAC122F, 0xAC128E, 0xAC139C, 0xAC15A2, 0xAC15F4,
+  0xAC1615, 0xAC162D, 0xAC17C8, 0xAC1826, 0xAC198E, 0xAC1A3D, 0xAC1D06, 0xAC1E92,
+  0xAC1E9E, 0xAC1F0F, 0xAC1F6B, 0xAC1F74, 0xAC202E, 0xAC203E, 0xAC2205, 0xAC220B,
+  0xAC2316, 0xAC2334, 0xAC2929, 0xAC293A, 0xAC2AA1, 0xAC2B6E, 0xAC2DA9, 0xAC3184,
+  0xAC3328, 0xAC35EE, 0xAC3613, 0xAC361B, 0xAC3728, 0xAC3743, 0xAC3870, 0xAC3971,
+  0xAC3A67, 0xAC3A7A, 0xAC3B77, 0xAC3B96, 0xAC3C0B, 0xAC3D94, 0xAC3EB1, 0xAC3FA4,
+  0xAC416A, 0xAC44F2, 0xAC4500, 0xAC471B, 0xAC49DB, 0xAC4A56, 0xAC4A67, 0xAC4BC8,
+  0xAC4CA5, 0xAC4D16, 0xAC4DD9, 0xAC4E2E, 0xAC4E65, 0xAC4E91, 0xAC50DE, 0xAC512C,
+  0xAC51AB, 0xAC51EE, 0xAC5474, 0xAC562C, 0xAC567B, 0xAC5775, 0xAC5A14, 0xAC5AEE,
+  0xAC5AF0, 0xAC5AFC, 0xAC5D5C, 0xAC5E14, 0xAC5F3E, 0xAC5FEA, 0xAC606F, 0xAC6089,
+  0xAC60B6, 0xAC6175, 0xAC61EA, 0xAC63BE, 0xAC6417, 0xAC6462, 0xAC6490, 0xAC64CF,
+  0xAC6706, 0xAC675D, 0xAC6784, 0xAC67B2, 0xAC6C90, 0xAC6E1A, 0xAC710C, 0xAC712E,
+  0xAC7289, 0xAC72DD, 0xAC7352, 0xAC7409, 0xAC74B1, 0xAC751D, 0xAC764C, 0xAC78D1,
+  0xAC7A4D, 0xAC7A56, 0xAC7A94, 0xAC7BA1, 0xAC7E01, 0xAC7E8A, 0xAC7F3E, 0xAC7F8D,
+  0xAC800A, 0xAC80AE, 0xAC80FB, 0xAC8112, 0xAC81B5, 0xAC81F3, 0xAC8226, 0xAC8247,
+  0xAC83F3, 0xAC84C6, 0xAC84C9, 0xAC853D, 0xAC86A3, 0xAC87A3, 0xAC88FD, 0xAC8995,
+  0xAC89D2, 0xAC8B6A, 0xAC8BA9, 0xAC8C46, 0xAC8D34, 0xAC8FA9, 0xAC8FF8, 0xAC9073,
+  0xAC9085, 0xAC919B, 0xAC91A1, 0xAC9232, 0xAC932F, 0xAC936A, 0xAC93C4, 0xAC9738,
+  0xAC9929, 0xAC9A22, 0xAC9A96, 0xAC9B0A, 0xAC9CE4, 0xAC9E17, 0xACA016, 0xACA09D,
+  0xACA213, 0xACA31E, 0xACA46E, 0xACA88E, 0xACAD4B, 0xACAE19, 0xACAFB9, 0xACB313,
+  0xACB3B5, 0xACB566, 0xACB57D, 0xACB687, 0xACB92F, 0xACBAC0, 0xACBB61, 0xACBC32,
+  0xACBCB5, 0xACBCD9, 0xACBD70, 0xACBF71, 0xACC048, 0xACC1EE, 0xACC25D, 0xACC33A,
+  0xACC4A9, 0xACC4BD, 0xACC662, 0xACC906, 0xACCB36, 0xACCB51, 0xACCC8E, 0xACCCFC,
+  0xACCE92, 0xACCF5C, 0xACCF7B, 0xACCF85, 0xACD074, 0xACD1B8, 0xACD31D, 0xACD564,
+  0xACD618, 0xACD75B, 0xACD829, 0xACDB48, 0xACDCCA, 0xACDE48, 0xACDF9F, 0xACDFA1,
+  0xACE010, 0xACE215, 0xACE2D3, 0xACE342, 0xACE4B5, 0xACE77B, 0xACE87B, 0xACEB51,
+  0xACEC80, 0xACEC85, 0xACED32, 0xACED5C, 0xACEE64, 0xACEE9E, 0xACF108, 0xACF1DF,
+  0xACF2C5, 0xACF5E6, 0xACF6F7, 0xACF7F3, 0xACF8CC, 0xACF970, 0xACFC82, 0xACFCE3,
+  0xACFD93, 0xACFDCE, 0xACFDEC, 0xACFE05, 0xACFF6B, 0xB00073, 0xB000B4, 0xB00247,
+  0xB00594, 0xB00875, 0xB00AD5, 0xB00C9D, 0xB00CD1, 0xB01041, 0xB0104B, 0xB010A0,
+  0xB01656, 0xB019C6, 0xB01BD2, 0xB01C0C, 0xB01F8C, 0xB0216F, 0xB0227A, 0xB02491,
+  0xB025AA, 0xB02628, 0xB02680, 0xB027CF, 0xB02A1F, 0xB02A43, 0xB02EE0, 0xB03055,
+  0xB03366, 0xB033A6, 0xB03495, 0xB0350B, 0xB0358D, 0xB0359F, 0xB035B5, 0xB03795,
+  0xB038E2, 0xB03956, 0xB03ACE, 0xB03CDC, 0xB03E51, 0xB03F64, 0xB04414, 0xB04502,
+  0xB04519, 0xB04530, 0xB04692, 0xB046FC, 0xB047BF, 0xB047E9, 0xB0481A, 0xB0487A,
+  0xB04A6A, 0xB04AB4, 0xB04B68, 0xB04E26, 0xB04F13, 0xB05216, 0xB05246, 0xB05365,
+  0xB05476, 0xB05508, 0xB05947, 0xB05ADA, 0xB05B67, 0xB05B99, 0xB05C16, 0xB05CDA,
+  0xB05CE5, 0xB05DD4, 0xB06088, 0xB065BD, 0xB067B5, 0xB068E6, 0xB06A41, 0xB06E72,
+  0xB06EBF, 0xB06FE0, 0xB0700D, 0xB0702D, 0xB072BF, 0xB0735D, 0xB0739C, 0xB0754D,
+  0xB075D5, 0xB0761B, 0xB077AC, 0xB07839, 0xB078F0, 0xB07994, 0xB07B25, 0xB07D47,
+  0xB07D64, 0xB07E11, 0xB07FB9, 0xB08101, 0xB083D6, 0xB083FE, 0xB08900, 0xB08991,
+  0xB08B92, 0xB08B9E, 0xB08BCF, 0xB08BD0, 0xB08C75, 0xB08D57, 0xB0907E, 0xB09122,
+  0xB0924A, 0xB0935B, 0xB09575, 0xB0958E, 0xB096EA, 0xB09738, 0xB0982B, 0xB098BC,
+  0xB09928, 0xB0995A, 0xB099D7, 0xB09C63, 0xB09FBA, 0xB0A2E7, 0xB0A37E, 0xB0A460,
+  0xB0A4F0, 0xB0A651, 0xB0A732, 0xB0A737, 0xB0A7B9, 0xB0A7D2, 0xB0A86E, 0xB0AA36,
+  0xB0AA77, 0xB0AAD2, 0xB0ACD2, 0xB0ACFA, 0xB0ADAA, 0xB0AFF7, 0xB0B113, 0xB0B194,
+  0xB0B21C, 0xB0B28F, 0xB0B2DC, 0xB0B369, 0xB0B3AD, 0xB0B448, 0xB0B5C3, 0xB0B867,
+  0xB0B98A, 0xB0BBE5, 0xB0BC7A, 0xB0BD1B, 0xB0BE76, 0xB0BE83, 0xB0C090, 0xB0C19E,
+  0xB0C287, 0xB0C38E, 0xB0C4E7, 0xB0C53C, 0xB0C554, 0xB0C559, 0xB0C69A, 0xB0C745,
+  0xB0C787, 0xB0C7DE, 0xB0C952, 0xB0CA68, 0xB0CAE7, 0xB0CCFE, 0xB0CF0E, 0xB0CFCB,
+  0xB0D09C, 0xB0D278, 0xB0D568, 0xB0D576, 0xB0D59D, 0xB0D5CC, 0xB0D888, 0xB0DAF9,
+  0xB0DCEF, 0xB0DE28, 0xB0DF3A, 0xB0DFC1, 0xB0E03C, 0xB0E17E, 0xB0E235, 0xB0E2E5,
+  0xB0E45C, 0xB0E4D5, 0xB0E5ED, 0xB0E5EF, 0xB0E5F9, 0xB0E754, 0xB0E892, 0xB0EABC,
+  0xB0EB57, 0xB0EB7F, 0xB0EC71, 0xB0ECDD, 0xB0ECE1, 0xB0EE45, 0xB0EE7B, 0xB0F1D8,
+  0xB0F1EC, 0xB0F208, 0xB0F530, 0xB0F7C4, 0xB0F893, 0xB0F963, 0xB0FA8B, 0xB0FA91,
+  0xB0FAEB, 0xB0FB15, 0xB0FBDD, 0xB0FC0D, 0xB0FC36, 0xB0FC88, 0xB0FEBD, 0xB0FEE5,
+  0xB40016, 0xB40216, 0xB402F2, 0xB40421, 0xB4055D, 0xB405A1, 0xB407F9, 0xB40931,
+  0xB40AD8, 0xB40B1D, 0xB40C25, 0xB40ECF, 0xB40EDE, 0xB40F3B, 0xB40FB3, 0xB4107B,
+  0xB41489, 0xB414E6, 0xB41513, 0xB417A8, 0xB418D1, 0xB41974, 0xB41A1D, 0xB41BB0,
+  0xB41C30, 0xB41D2B, 0xB42046, 0xB4205B, 0xB42200, 0xB4265D, 0xB42A0E, 0xB42BB9,
+  0xB42D56, 0xB42E99, 0xB43052, 0xB43161, 0xB43522, 0xB436A9, 0xB436D1, 0xB43939,
+  0xB439D6, 0xB43A28, 0xB43A31, 0xB43AE2, 0xB440A4, 0xB440DC, 0xB4417A, 0xB44326,
+  0xB44506, 0xB4475E, 0xB447F5, 0xB44BD2, 0xB44C3B, 0xB44C90, 0xB45253, 0xB4527D,
+  0xB4527E, 0xB452A9, 0xB45459, 0xB4565D, 0xB456E3, 0xB457E6, 0xB45D50, 0xB45F84,
+  0xB46077, 0xB4608C, 0xB460ED, 0xB46142, 0xB461E9, 0xB46293, 0xB4636F, 0xB46921,
+  0xB4695F, 0xB46AD4, 0xB46BFC, 0xB46C47, 0xB46D83, 0xB46DC2, 0xB46E08, 0xB47064,
+  0xB47443, 0xB4749F, 0xB4750E, 0xB47947, 0xB479A7, 0xB479C8, 0xB47AF1, 0xB47C9C,
+  0xB48107, 0xB482FE, 0xB48351, 0xB484D5, 0xB485E1, 0xB48655, 0xB48901, 0xB48A0A,
+  0xB48A5F, 0xB48B19, 0xB48C9D, 0xB49691, 0xB49842, 0xB4994C, 0xB499BA, 0xB49CDF,
+  0xB49D02, 0xB49DFD, 0xB49E80, 0xB49F4D, 0xB4A25C, 0xB4A382, 0xB4A3BD, 0xB4A4E3,
+  0xB4A5AC, 0xB4A5EF, 0xB4A678, 0xB4A7C6, 0xB4A898, 0xB4A8B9, 0xB4A94F, 0xB4A95A,
+  0xB4A984, 0xB4A9FC, 0xB4AC9D, 0xB4ADA3, 0xB4AE2B, 0xB4AEC1, 0xB4B017, 0xB4B024,
+  0xB4B055, 0xB4B291, 0xB4B362, 0xB4B52F, 0xB4B5B6, 0xB4B676, 0xB4B686, 0xB4B742,
+  0xB4B9E6, 0xB4BA12, 0xB4BA9D, 0xB4BC7C, 0xB4BFF6, 0xB4C0F5, 0xB4C26A, 0xB4C2E0,
+  0xB4C2F7, 0xB4C4FC, 0xB4C62E, 0xB4C799, 0xB4C9B9, 0xB4CB57, 0xB4CBB8, 0xB4CD27,
+  0xB4CE40, 0xB4CEF6, 0xB4CFE0, 0xB4D0A9, 0xB4D286, 0xB4D5BD, 0xB4D7DB, 0xB4DB91,
+  0xB4DE31, 0xB4DEDF, 0xB4DF91, 0xB4E10F, 0xB4E1C4, 0xB4E1EB, 0xB4E265, 0xB4E3F9,
+  0xB4E454, 0xB4E46B, 0xB4E62A, 0xB4E62D, 0xB4E842, 0xB4E9B0, 0xB4EC02, 0xB4EDD5,
+  0xB4EE25, 0xB4EEB4, 0xB4EED4, 0xB4EF39, 0xB4EFFA, 0xB4F0AB, 0xB4F18C, 0xB4F1DA,
+  0xB4F267, 0xB4F2E8, 0xB4F58E, 0xB4F61C, 0xB4F7A1, 0xB4F95D, 0xB4FA48, 0xB4FBE3,
+  0xB4FBE4, 0xB4FBF9, 0xB4FF98, 0xB80305, 0xB805AB, 0xB8060D, 0xB80716, 0xB80756,
+  0xB808CF, 0xB808D7, 0xB8098A, 0xB80BDA, 0xB810D4, 0xB8114B, 0xB81332, 0xB8144D,
+  0xB8145C, 0xB814DB, 0xB81619, 0xB8165F, 0xB817C2, 0xB81904, 0xB81DAA, 0xB81EA4,
+  0xB8211C, 0xB8224F, 0xB827C5, 0xB82A72, 0xB82AA9, 0xB82B68, 0xB82CA0, 0xB82D28,
+  0xB831B5, 0xB83241, 0xB8374A, 0xB83765, 0xB837B2, 0xB83861, 0xB838EF, 0xB83A08,
+  0xB83A5A, 0xB83A9D, 0xB83BAB, 0xB83BCC, 0xB83C28, 0xB83D4E, 0xB83DF6, 0xB83DFB,
+  0xB83E59, 0xB83FD2, 0xB841A4, 0xB844AE, 0xB844D9, 0xB845F4, 0xB848AA, 0xB8496D,
+  0xB84D43, 0xB84DEE, 0xB84FD5, 0xB85001, 0xB850D8, 0xB851A9, 0xB853AC, 0xB85510,
+  0xB85600, 0xB857D8, 0xB8599F, 0xB859CE, 0xB85A73, 0xB85CEE, 0xB85D0A, 0xB85DC3,
+  0xB85E71, 0xB85E7B, 0xB85F98, 0xB85FB0, 0xB86061, 0xB8616F, 0xB8621F, 0xB8634D,
+  0xB86392, 0xB86685, 0xB869C2, 0xB869F4, 0xB86A97, 0xB86AF1, 0xB86B23, 0xB86CE0,
+  0xB86CE8, 0xB870F4, 0xB8763F, 0xB87826, 0xB8782E, 0xB87879, 0xB87AC9, 0xB87BC5,
+  0xB87BD4, 0xB87CD0, 0xB87CF2, 0xB87E39, 0xB87E40, 0xB87EE5, 0xB88035, 0xB8804F,
+  0xB88198, 0xB881FA, 0xB88303, 0xB8857B, 0xB88584, 0xB88687, 0xB8876E, 0xB888E3,
+  0xB88A60, 0xB88A72, 0xB88AEC, 0xB88C29, 0xB88D12, 0xB88E82, 0xB88F27, 0xB89047,
+  0xB891C9, 0xB89436, 0xB89470, 0xB894D9, 0xB894E7, 0xB898AD, 0xB898F7, 0xB899AE,
+  0xB89A2A, 0xB89BC9, 0xB89F09, 0xB89FCC, 0xB8A14A, 0xB8A175, 0xB8A377, 0xB8A386,
+  0xB8A44F, 0xB8A535, 0xB8A825, 0xB8AB61, 0xB8AB62, 0xB8AC6F, 0xB8AE6E, 0xB8AEED,
+  0xB8AF67, 0xB8B1EA, 0xB8B2F8, 0xB8B409, 0xB8B42E, 0xB8B7DB, 0xB8B7F1, 0xB8B81E,
+  0xB8BBAF, 0xB8BC1B, 0xB8BC5B, 0xB8BEBF, 0xB8BEF4, 0xB8BF83, 0xB8C065, 0xB8C111,
+  0xB8C253, 0xB8C385, 0xB8C68E, 0xB8C6AA, 0xB8C716, 0xB8C74A, 0xB8C75D, 0xB8C8EB,
+  0xB8C9B5, 0xB8CA3A, 0xB8CB29, 0xB8CEF6, 0xB8D0F0, 0xB8D43E, 0xB8D4BC, 0xB8D4E7,
+  0xB8D50B, 0xB8D526, 0xB8D61A, 0xB8D6F6, 0xB8D7AF, 0xB8D94D, 0xB8D9CE, 0xB8DAE8,
+  0xB8DB1C, 0xB8DB38, 0xB8DD71, 0xB8DE5E, 0xB8E3B1, 0xB8E3EE, 0xB8E60C, 0xB8E625,
+  0xB8E856, 0xB8E937, 0xB8EA98, 0xB8ECA3, 0xB8EE0E, 0xB8EE65, 0xB8F009, 0xB8F015,
+  0xB8F0B9, 0xB8F12A, 0xB8F255, 0xB8F44F, 0xB8F653, 0xB8F6B1, 0xB8F774, 0xB8F853,
+  0xB8F883, 0xB8F934, 0xB8FC28, 0xB8FC9A, 0xB8FF61, 0xB8FFB3, 0xB8FFFE, 0xBC0004,
+  0xBC024A, 0xBC026E, 0xBC0358, 0xBC0543, 0xBC062D, 0xBC091B, 0xBC0963, 0xBC09EB,
+  0xBC0DA5, 0xBC0EAB, 0xBC0F64, 0xBC0F9A, 0xBC0FF3, 0xBC0FFE, 0xBC107B, 0xBC13A8,
+  0xBC1401, 0xBC1485, 0xBC1541, 0xBC15AC, 0xBC1665, 0xBC1695, 0xBC16F5, 0xBC17B8,
+  0xBC1896, 0xBC1AE4, 0xBC1D89, 0xBC1E85, 0xBC20A4, 0xBC2228, 0xBC2247, 0xBC2392,
+  0xBC25E0, 0xBC26C7, 0xBC2CE6, 0xBC2DEF, 0xBC2E48, 0xBC2EF6, 0xBC2F3D, 0xBC305B,
+  0xBC307D, 0xBC307E, 0xBC30D9, 0xBC325F, 0xBC32B2, 0xBC3329, 0xBC3340, 0xBC33AC,
+  0xBC37D3, 0xBC3AEA, 0xBC3BAF, 0xBC3D85, 0xBC3E07, 0xBC3ECB, 0xBC3F8F, 0xBC4101,
+  0xBC428C, 0xBC4434, 0xBC4486, 0xBC455B, 0xBC4699, 0xBC4760, 0xBC4A56, 0xBC4C78,
+  0xBC4CA0, 0xBC4CC4, 0xBC4DFB, 0xBC5274, 0xBC52B4, 0xBC52B7, 0xBC542F, 0xBC5436,
+  0xBC5451, 0xBC54FC, 0xBC5A56, 0xBC5BD5, 0xBC5C17, 0xBC5C4C, 0xBC5DA3, 0xBC5E33,
+  0xBC5FF4, 0xBC5FF6, 0xBC6010, 0xBC606B, 0xBC60A7, 0xBC6193, 0xBC620E, 0xBC629C,
+  0xBC62CE, 0xBC644B, 0xBC64D9, 0xBC671C, 0xBC6778, 0xBC69CB, 0xBC6A29, 0xBC6AD1,
+  0xBC6B4D, 0xBC6BFF, 0xBC6C21, 0xBC6E64, 0xBC6E6D, 0xBC6EE2, 0xBC72B1, 0xBC744B,
+  0xBC7536, 0xBC7574, 0xBC765E, 0xBC7670, 0xBC76C5, 0xBC7737, 0xBC79AD, 0xBC7ABF,
+  0xBC7B72, 0xBC7E8B, 0xBC7F7B, 0xBC7FA4, 0xBC825D, 0xBC8385, 0xBC83A7, 0xBC851F,
+  0xBC8556, 0xBC87FA, 0xBC89A7, 0xBC8AE8, 0xBC8CCD, 0xBC8D0E, 0xBC8D1F, 0xBC903A,
+  0xBC91B5, 0xBC926B, 0xBC9307, 0xBC9680, 0xBC96E5, 0xBC9789, 0xBC97E1, 0xBC9889,
+  0xBC98DF, 0xBC9911, 0xBC9930, 0xBC9A53, 0xBC9B5E, 0xBC9B68, 0xBC9C31, 0xBC9D42,
+  0xBC9D4E, 0xBC9E2C, 0xBC9EBB, 0xBC9FE4, 0xBC9FEF, 0xBCA080, 0xBCA511, 0xBCA58B,
+  0xBCA5A9, 0xBCA8A6, 0xBCA920, 0xBCA993, 0xBCAD28, 0xBCADAB, 0xBCAEC5, 0xBCB0E7,
+  0xBCB181, 0xBCB1D3, 0xBCB1F3, 0xBCB2CC, 0xBCB863, 0xBCBAC2, 0xBCBB58, 0xBCBD84,
+  0xBCBD9E, 0xBCC00F, 0xBCC342, 0xBCC427, 0xBCC493, 0xBCC6DB, 0xBCC746, 0xBCC7DA,
+  0xBCC810, 0xBCCAB5, 0xBCCE25, 0xBCCF4F, 0xBCCFCC, 0xBCD074, 0xBCD0EB, 0xBCD11F,
+  0xBCD165, 0xBCD177, 0xBCD1D3, 0xBCD206, 0xBCD295, 0xBCD7A5, 0xBCD7CE, 0xBCD7D4,
+  0xBCDB09, 0xBCDDC2, 0xBCDF58, 0xBCE001, 0xBCE143, 0xBCE265, 0xBCE63F, 0xBCE67C,
+  0xBCE712, 0xBCE8FA, 0xBCE92F, 0xBCE9E2, 0xBCEA9C, 0xBCEAFA, 0xBCEC23, 0xBCEC5D,
+  0xBCECA0, 0xBCEE7B, 0xBCF171, 0xBCF1F2, 0xBCF292, 0xBCF2AF, 0xBCF310, 0xBCF45F,
+  0xBCF499, 0xBCF4D4, 0xBCF5AC, 0xBCF685, 0xBCF730, 0xBCF87E, 0xBCF88B, 0xBCFAB8,
+  0xBCFAEB, 0xBCFD0C, 0xBCFED9, 0xBCFF4D, 0xBCFFEB, 0xC00380, 0xC005C2, 0xC0060C,
+  0xC006C3, 0xC010B1, 0xC01173, 0xC0132B, 0xC0143D, 0xC014B8, 0xC014FE, 0xC01692,
+  0xC01693, 0xC0174D, 0xC01754, 0xC01803, 0xC01850, 0xC01885, 0xC01ADA, 0xC01B23,
+  0xC0210D, 0xC0238D, 0xC02506, 0xC0252F, 0xC0255C, 0xC025A2, 0xC025A5, 0xC025E9,
+  0xC0280B, 0xC0288D, 0xC02B31, 0xC02C17, 0xC02C5C, 0xC02E25, 0xC0335E, 0xC03379,
+  0xC03532, 0xC03653, 0xC03656, 0xC03896, 0xC038F9, 0xC03937, 0xC0395A, 0xC03C04,
+  0xC03C59, 0xC03D03, 0xC03DD9, 0xC03E0F, 0xC03E50, 0xC03EBA, 0xC03F0E, 0xC03FD5,
+  0xC03FDD, 0xC04121, 0xC041F6, 0xC042D0, 0xC04442, 0xC04754, 0xC048E6, 0xC048FB,
+  0xC04943, 0xC049EF, 0xC04A00, 0xC04E30, 0xC04E8A, 0xC0515C, 0xC0517E, 0xC05627,
+  0xC056E3, 0xC057BC, 0xC05B44, 0xC05D39, 0xC06118, 0xC0626B, 0xC06380, 0xC06394,
+  0xC064C6, 0xC064E4, 0xC06599, 0xC067AF, 0xC068CC, 0xC06911, 0xC06B55, 0xC06DED,
+  0xC06F98, 0xC07009, 0xC074AD, 0xC07831, 0xC07878, 0xC07982, 0xC07BBC, 0xC07C90,
+  0xC07CD1, 0xC0830A, 0xC083C9, 0xC0847A, 0xC0847D, 0xC084E0, 0xC0854C, 0xC087EB,
+  0xC08997, 0xC089AB, 0xC08ACD, 0xC08ADE, 0xC08B05, 0xC08B2A, 0xC08C60, 0xC08C71,
+  0xC08D51, 0xC08F20, 0xC09120, 0xC09134, 0xC091B9, 0xC09296, 0xC09435, 0xC094AD,
+  0xC0956D, 0xC09727, 0xC098DA, 0xC09AD0, 0xC09F05, 0xC09F42, 0xC09F51, 0xC09FE1,
+  0xC0A00D, 0xC0A0BB, 0xC0A36E, 0xC0A476, 0xC0A53E, 0xC0A5DD, 0xC0A5E8, 0xC0A600,
+  0xC0A938, 0xC0AC54, 0xC0AD97, 0xC0B101, 0xC0B47D, 0xC0B5CD, 0xC0B5D7, 0xC0B658,
+  0xC0B6F9, 0xC0B883, 0xC0B8E6, 0xC0BC9A, 0xC0BDC8, 0xC0BDD1, 0xC0BFA7, 0xC0BFAC,
+  0xC0BFC0, 0xC0C170, 0xC0C1C0, 0xC0C4F9, 0xC0C520, 0xC0C522, 0xC0C687, 0xC0C70A,
+  0xC0C976, 0xC0C9E3, 0xC0CB38, 0xC0CBF1, 0xC0CC42, 0xC0CCF8, 0xC0CECD, 0xC0D012,
+  0xC0D026, 0xC0D044, 0xC0D063, 0xC0D0FF, 0xC0D193, 0xC0D2DD, 0xC0D2F3, 0xC0D3C0,
+  0xC0D46B, 0xC0D60A, 0xC0D682, 0xC0D7AA, 0xC0D962, 0xC0DCD7, 0xC0DCDA, 0xC0DD8A,
+  0xC0E018, 0xC0E1BE, 0xC0E3A0, 0xC0E3FB, 0xC0E422, 0xC0E42D, 0xC0E434, 0xC0E5DA,
+  0xC0E7BF, 0xC0E862, 0xC0EAE4, 0xC0EDE5, 0xC0EE40, 0xC0F2FB, 0xC0F4E6, 0xC0F535,
+  0xC0F6C2, 0xC0F6EC, 0xC0F87F, 0xC0F8DA, 0xC0F9B0, 0xC0FBC1, 0xC0FD84, 0xC0FFA8,
+  0xC0FFD4, 0xC400AD, 0xC4017C, 0xC403A8, 0xC40415, 0xC4047B, 0xC40528, 0xC40683,
+  0xC4072F, 0xC40778, 0xC4084A, 0xC40938, 0xC409B7, 0xC40ACB, 0xC40B31, 0xC40BCB,
+  0xC40D96, 0xC4108A, 0xC41234, 0xC412EC, 0xC412F5, 0xC413E2, 0xC41411, 0xC4143C,
+  0xC414A2, 0xC41688, 0xC416C8, 0xC4170E, 0xC417FE, 0xC418E9, 0xC419D1, 0xC41C07,
+  0xC41CFF, 0xC421B9, 0xC421C8, 0xC42360, 0xC42456, 0xC42728, 0xC4278C, 0xC42795,
+  0xC42AD0, 0xC42B44, 0xC42C03, 0xC42F90, 0xC43018, 0xC43306, 0xC4345B, 0xC4346B,
+  0xC435D9, 0xC4366C, 0xC436C0, 0xC43875, 0xC4393A, 0xC43960, 0xC43A35, 0xC43ABE,
+  0xC43CB0, 0xC43CEA, 0xC43D1A, 0xC43DC7, 0xC43EAB, 0xC440F6, 0xC4411E, 0xC44137,
+  0xC44202, 0xC4438F, 0xC4447D, 0xC444A0, 0xC44606, 0xC44619, 0xC4473F, 0xC448FA,
+  0xC449BB, 0xC44D84, 0xC44F33, 0xC44F5F, 0xC44F96, 0xC45006, 0xC4509C, 0xC4518D,
+  0xC4524F, 0xC45444, 0xC4576E, 0xC45781, 0xC457CD, 0xC45A86, 0xC45AB1, 0xC45BBE,
+  0xC45D83, 0xC45E5C, 0xC46026, 0xC4618B, 0xC461C7, 0xC462EA, 0xC46413, 0xC464B7,
+  0xC464E3, 0xC464F2, 0xC46516, 0xC46699, 0xC467D1, 0xC468D0, 0xC469F0, 0xC46AB7,
+  0xC46E1F, 0xC46E7B, 0xC470AB, 0xC47154, 0xC471FE, 0xC47295, 0xC4731E, 0xC4741E,
+  0xC475AB, 0xC475EA, 0xC477AF, 0xC478A2, 0xC47905, 0xC47D46, 0xC47D4F, 0xC47D9F,
+  0xC47DCC, 0xC47EE0, 0xC48025, 0xC482E1, 0xC4836F, 0xC48466, 0xC48508, 0xC486E9,
+  0xC488E5, 0xC48BA3, 0xC48E8F, 0xC4910C, 0xC493BB, 0xC493D9, 0xC49500, 0xC4985C,
+  0xC49880, 0xC49886, 0xC49A02, 0xC49D08, 0xC49DED, 0xC49F4C, 0xC4A052, 0xC4A151,
+  0xC4A1AE, 0xC4A366, 0xC4A402, 0xC4A451, 0xC4A64E, 0xC4A72B, 0xC4A816, 0xC4A81D,
+  0xC4AA99, 0xC4AAC4, 0xC4ABB2, 0xC4AC59, 0xC4ACAA, 0xC4AD34, 0xC4AE12, 0xC4B239,
+  0xC4B25B, 0xC4B301, 0xC4B36A, 0xC4B8B4, 0xC4B9CD, 0xC4BD8D, 0xC4BDE5, 0xC4BE84,
+  0xC4BED4, 0xC4BF60, 0xC4C063, 0xC4C17D, 0xC4C36B, 0xC4C563, 0xC4C603, 0xC4C6E6,
+  0xC4C755, 0xC4CA2B, 0xC4CAD9, 0xC4CB76, 0xC4CBE1, 0xC4D0E3, 0xC4D36A, 0xC4D438,
+  0xC4D666, 0xC4D738, 0xC4D7FD, 0xC4D8D5, 0xC4D987, 0xC4DB04, 0xC4DD57, 0xC4DE7B,
+  0xC4DEE2, 0xC4DF39, 0xC4E032, 0xC4E1A1, 0xC4E287, 0xC4E39F, 0xC4E532, 0xC4E90A,
+  0xC4E984, 0xC4EA1D, 0xC4EB39, 0xC4EB41, 0xC4EB42, 0xC4EB43, 0xC4EBFF, 0xC4EDBA,
+  0xC4EFDA, 0xC4F081, 0xC4F0EC, 0xC4F174, 0xC4F312, 0xC4F57C, 0xC4F7D5, 0xC4FBAA,
+  0xC4FC22, 0xC4FE5B, 0xC4FF1F, 0xC4FF22, 0xC80084, 0xC80210, 0xC803F5, 0xC80739,
+  0xC80873, 0xC808E9, 0xC809A8, 0xC80AA9, 0xC80C53, 0xC80CC8, 0xC80E14, 0xC80E77,
+  0xC8120B, 0xC81337, 0xC8138B, 0xC81451, 0xC81479, 0xC814B4, 0xC8154E, 0xC816A5,
+  0xC816BD, 0xC816DA, 0xC81739, 0xC819F7, 0xC81CFE, 0xC81EC2, 0xC81EE7, 0xC81F66,
+  0xC81FBE, 0xC81FEA, 0xC82158, 0xC821DA, 0xC82496, 0xC825E1, 0xC82832, 0xC828E5,
+  0xC829C8, 0xC82A14, 0xC82ADD, 0xC82AF1, 0xC82B6B, 0xC82B96, 0xC82E18, 0xC8334B,
+  0xC833E5, 0xC8348E, 0xC83870, 0xC839AC, 0xC83A6B, 0xC83C85, 0xC83D97, 0xC83DD4,
+  0xC83DDC, 0xC83E99, 0xC83E9E, 0xC83F26, 0xC83FB4, 0xC84029, 0xC84052, 0xC8418A,
+  0xC84709, 0xC84AA0, 0xC84BD6, 0xC84C75, 0xC84C78, 0xC84F0E, 0xC84F86, 0xC850CE,
+  0xC850E9, 0xC85142, 0xC85195, 0xC851FB, 0xC85261, 0xC8544B, 0xC854A4, 0xC85895,
+  0xC858C0, 0xC85A9F, 0xC85ACF, 0xC85B76, 0xC85BA0, 0xC85CCC, 0xC85D38, 0xC85EA9,
+  0xC86000, 0xC863F1, 0xC863FC, 0xC864C7, 0xC8665D, 0xC8675E, 0xC868DE, 0xC869CD,
+  0xC86C20, 0xC86C3D, 0xC86C87, 0xC86F1D, 0xC87023, 0xC87125, 0xC8727E, 0xC875F4,
+  0xC87867, 0xC8787D, 0xC87B23, 0xC87B5B, 0xC87E75, 0xC87F54, 0xC8848C, 0xC884A1,
+  0xC884CF, 0xC88550, 0xC889F3, 0xC88A9A, 0xC88BE8, 0xC88D83, 0xC88F26, 0xC8908A,
+  0xC891F9, 0xC89402, 0xC894BB, 0xC8965A, 0xC89665, 0xC8979F, 0xC89828, 0xC899B2,
+  0xC89BAD, 0xC89BD7, 0xC89C1D, 0xC89CBB, 0xC89CDC, 0xC89D18, 0xC89D6D, 0xC89E43,
+  0xC89F0C, 0xC89F1A, 0xC8A030, 0xC8A23B, 0xC8A362, 0xC8A3E8, 0xC8A608, 0xC8A6EF,
+  0xC8A776, 0xC8A823, 0xC8AA21, 0xC8AACC, 0xC8AFE3, 0xC8B1CD, 0xC8B21E, 0xC8B29B,
+  0xC8B373, 0xC8B422, 0xC8B5AD, 0xC8B5B7, 0xC8B6D3, 0xC8B6FE, 0xC8B82F, 0xC8BA94,
+  0xC8BB81, 0xC8BC9C, 0xC8BCC8, 0xC8BD4D, 0xC8BD69, 0xC8BE19, 0xC8BE35, 0xC8BF4C,
+  0xC8BFFE, 0xC8C2F5, 0xC8C2FA, 0xC8C465, 0xC8C64A, 0xC8C6FE, 0xC8C750, 0xC8C9A3,
+  0xC8CA63, 0xC8CA79, 0xC8CB9E, 0xC8CBB8, 0xC8CD55, 0xC8CD72, 0xC8D083, 0xC8D10B,
+  0xC8D12A, 0xC8D15E, 0xC8D1A9, 0xC8D3A3, 0xC8D3FF, 0xC8D5FE, 0xC8D719, 0xC8D778,
+  0xC8D779, 0xC8D7B0, 0xC8D884, 0xC8D9D2, 0xC8DB26, 0xC8DDC9, 0xC8DE41, 0xC8DF7C,
+  0xC8DF84, 0xC8E0EB, 0xC8E193, 0xC8E265, 0xC8E306, 0xC8E600, 0xC8E7D8, 0xC8E7F0,
+  0xC8EAF8, 0xC8EBEC, 0xC8F09E, 0xC8F225, 0xC8F230, 0xC8F319, 0xC8F406, 0xC8F650,
+  0xC8F6C8, 0xC8F733, 0xC8F742, 0xC8F750, 0xC8F86D, 0xC8F9F9, 0xC8FB26, 0xC8FD19,
+  0xC8FE0F, 0xC8FE6A, 0xC8FF28, 0xCC00F1, 0xCC037B, 0xCC03D9, 0xCC03FA, 0xCC051B,
+  0xCC0577, 0xCC0677, 0xCC07AB, 0xCC07E4, 0xCC087B, 0xCC088D, 0xCC08E0, 0xCC08FA,
+  0xCC08FB, 0xCC0DEC, 0xCC0DF2, 0xCC115A, 0xCC14BC, 0xCC1531, 0xCC167E, 0xCC1AA3,
+  0xCC1AFA, 0xCC1B5A, 0xCC1E56, 0xCC1E97, 0xCC208C, 0xCC20E8, 0xCC2119, 0xCC242E,
+  0xCC25EF, 0xCC28AA, 0xCC29BD, 0xCC29F5, 0xCC2D1B, 0xCC2D21, 0xCC2D83, 0xCC2D8C,
+  0xCC2DB7, 0xCC2DE0, 0xCC2F71, 0xCC3296, 0xCC32E5, 0xCC3331, 0xCC33BB, 0xCC3429,
+  0xCC3540, 0xCC36CF, 0xCC37AB, 0xCC3A61, 0xCC3B27, 0xCC3D82, 0xCC3DD1, 0xCC3E5F,
+  0xCC3E79, 0xCC3F1D, 0xCC4085, 0xCC40B2, 0xCC40D0, 0xCC4210, 0xCC4460, 0xCC4463,
+  0xCC45A5, 0xCC464E, 0xCC46D6, 0xCC4740, 0xCC4792, 0xCC483A, 0xCC4B73, 0xCC4D75,
+  0xCC4E24, 0xCC4EEC, 0xCC500A, 0xCC50E3, 0xCC51B4, 0xCC52AF, 0xCC53B5, 0xCC55AD,
+  0xCC5763, 0xCC5830, 0xCC5A53, 0xCC5B31, 0xCC5C61, 0xCC5CDE, 0xCC5D4E, 0xCC5EF8,
+  0xCC6023, 0xCC60C8, 0xCC61E5, 0xCC62FE, 0xCC641A, 0xCC64A6, 0xCC65AD, 0xCC660A,
+  0xCC6618, 0xCC66B2, 0xCC68B6, 0xCC68E0, 0xCC69FA, 0xCC6A10, 0xCC6A33, 0xCC6B1E,
+  0xCC6DA0, 0xCC6EA4, 0xCC70ED, 0xCC75E2, 0xCC77C9, 0xCC785F, 0xCC78AB, 0xCC794A,
+  0xCC79CF, 0xCC79D7, 0xCC7B35, 0xCC7B5C, 0xCC7D37, 0xCC7D5B, 0xCC7EE7, 0xCC7F75,
+  0xCC7F76, 0xCC812A, 0xCC81DA, 0xCC827F, 0xCC82EB, 0xCC86EC, 0xCC874A, 0xCC8826,
+  0xCC88C7, 0xCC895E, 0xCC89FD, 0xCC8CBF, 0xCC8CE3, 0xCC8DA2, 0xCC8DB5, 0xCC8E71,
+  0xCC9070, 0xCC90E8, 0xCC934A, 0xCC95D7, 0xCC96A0, 0xCC96E5, 0xCC9891, 0xCC9916,
+  0xCC9C3E, 0xCC9DA2, 0xCC9E00, 0xCC9EA2, 0xCC9ECA, 0xCC9F7A, 0xCCA08F, 0xCCA12B,
+  0xCCA174, 0xCCA223, 0xCCA260, 0xCCA3BD, 0xCCA462, 0xCCA7C1, 0xCCAB2C, 0xCCACFE,
+  0xCCAF78, 0xCCB071, 0xCCB0A8, 0xCCB0DA, 0xCCB11A, 0xCCB182, 0xCCB255, 0xCCB54C,
+  0xCCB5D1, 0xCCB6C8, 0xCCB7C4, 0xCCB8A8, 0xCCBA6F, 0xCCBBFE, 0xCCBC2B, 0xCCBCE3,
+  0xCCBE59, 0xCCC079, 0xCCC2E0, 0xCCC3EA, 0xCCC5E5, 0xCCC760, 0xCCC95D, 0xCCCC81,
+  0xCCCCCC, 0xCCCCEA, 0xCCCE1E, 0xCCCF83, 0xCCD083, 0xCCD281, 0xCCD342, 0xCCD3C1,
+  0xCCD3E2, 0xCCD42E, 0xCCD4A1, 0xCCD539, 0xCCD73C, 0xCCD843, 0xCCD8C1, 0xCCD9AC,
+  0xCCDB93, 0xCCDBA7, 0xCCDD58, 0xCCDEDE, 0xCCE0DA, 0xCCE17F, 0xCCE194, 0xCCE1D5,
+  0xCCE536, 0xCCE686, 0xCCE9FA, 0xCCEB5E, 0xCCED21, 0xCCED4D, 0xCCEDDC, 0xCCEF48,
+  0xCCF0FD, 0xCCF3C8, 0xCCF411, 0xCCF735, 0xCCF826, 0xCCF954, 0xCCF957, 0xCCF9E4,
+  0xCCF9E8, 0xCCF9F0, 0xCCFA00, 0xCCFA66, 0xCCFB65, 0xCCFD17, 0xCCFE3C, 0xCCFF90,
+  0xD0034B, 0xD003DF, 0xD003EB, 0xD00401, 0xD00492, 0xD004B0, 0xD0052A, 0xD005E4,
+  0xD00790, 0xD007CA, 0xD009C8, 0xD00AAB, 0xD00B27, 0xD00DF7, 0xD00ED9, 0xD011E5,
+  0xD01255, 0xD012CB, 0xD013FD, 0xD0154A, 0xD015A6, 0xD0167C, 0xD016B4, 0xD01769,
+  0xD0176A, 0xD017C2, 0xD0196A, 0xD019D3, 0xD01B1F, 0xD01B49, 0xD01BF4, 0xD01C3C,
+  0xD021F9, 0xD022BE, 0xD023DB, 0xD02516, 0xD02544, 0xD02598, 0xD02788, 0xD028BA,
+  0xD02B20, 0xD02DB3, 0xD02EAB, 0xD03169, 0xD03311, 0xD035E5, 0xD03742, 0xD03745,
+  0xD03761, 0xD03957, 0xD03972, 0xD039B3, 0xD039EA, 0xD039FA, 0xD03C1F, 0xD03E07,
+  0xD03E5C, 0xD03E7D, 0xD03F27, 0xD03FAA, 0xD040EF, 0xD041C9, 0xD0431E, 0xD0460C,
+  0xD0484F, 0xD0497C, 0xD04D2C, 0xD04DC6, 0xD04E50, 0xD04E99, 0xD04F58, 0xD04F7E,
+  0xD05099, 0xD05162, 0xD05349, 0xD0542D, 0xD05509, 0xD055B2, 0xD0574C, 0xD0577B,
+  0xD05785, 0xD05794, 0xD058A5, 0xD058A8, 0xD058FC, 0xD05919, 0xD05995, 0xD059E4,
+  0xD05A00, 0xD05AFD, 0xD05BA8, 0xD05FB8, 0xD0608C, 0xD06158, 0xD06544, 0xD06578,
+  0xD065CA, 0xD0667B, 0xD06726, 0xD067E5, 0xD06B78, 0xD06DC9, 0xD06EDE, 0xD06F82,
+  0xD071C4, 0xD072DC, 0xD07380, 0xD07602, 0xD0768F, 0xD076E7, 0xD07714, 0xD077CE,
+  0xD07880, 0xD07AB5, 0xD07CB2, 0xD07D33, 0xD07E01, 0xD07E28, 0xD07E35, 0xD07FA0,
+  0xD0817A, 0xD081C5, 0xD084B0, 0xD087E2, 0xD0880C, 0xD08A55, 0xD08A91, 0xD08CB5,
+  0xD08E79, 0xD09168, 0xD0929E, 0xD092FA, 0xD09466, 0xD094CF, 0xD095C7, 0xD096FB,
+  0xD097FE, 0xD0989C, 0xD099D5, 0xD09C7A, 0xD09CAE, 0xD09DAB, 0xD0A0BB, 0xD0A46F,
+  0xD0A5A6, 0xD0A637, 0xD0A9D3, 0xD0ABD5, 0xD0AD08, 0xD0AEEC, 0xD0B128, 0xD0B2C4,
+  0xD0B33F, 0xD0B3C2, 0xD0B45D, 0xD0B5C2, 0xD0B66F, 0xD0BAE4, 0xD0BB61, 0xD0BCC1,
+  0xD0BF9C, 0xD0C050, 0xD0C1B1, 0xD0C24E, 0xD0C282, 0xD0C5D3, 0xD0C5F3, 0xD0C637,
+  0xD0C65B, 0xD0C730, 0xD0C789, 0xD0C7C0, 0xD0C907, 0xD0CF0E, 0xD0D003, 0xD0D04B,
+  0xD0D0FD, 0xD0D23C, 0xD0D2B0, 0xD0D3E0, 0xD0D412, 0xD0D783, 0xD0D7BE, 0xD0DAD7,
+  0xD0DB32, 0xD0DBB7, 0xD0DC2C, 0xD0DD49, 0xD0DD7C, 0xD0DF9A, 0xD0DFC7, 0xD0E042,
+  0xD0E140, 0xD0E44A, 0xD0E54D, 0xD0E782, 0xD0EC35, 0xD0EF76, 0xD0EFC1, 0xD0F0DB,
+  0xD0F3F5, 0xD0F405, 0xD0F4F7, 0xD0F520, 0xD0F865, 0xD0F88C, 0xD0F928, 0xD0F99B,
+  0xD0FCCC, 0xD0FCD0, 0xD0FF50, 0xD0FF98, 0xD40068, 0xD40129, 0xD40145, 0xD4016D,
+  0xD401C3, 0xD404CD, 0xD404E6, 0xD404FF, 0xD40598, 0xD405DE, 0xD40AA9, 0xD40B1A,
+  0xD40F9E, 0xD411A3, 0xD41243, 0xD413B3, 0xD413F8, 0xD41761, 0xD419F6, 0xD41A3F,
+  0xD41AD1, 0xD41B81, 0xD41D71, 0xD4206D, 0xD420B0, 0xD42122, 0xD4223F, 0xD4224E,
+  0xD424DD, 0xD4258B, 0xD42787, 0xD428D5, 0xD42C0F, 0xD42C44, 0xD42C46, 0xD42FCA,
+  0xD43127, 0xD43260, 0xD4351D, 0xD43538, 0xD43639, 0xD437D7, 0xD43844, 0xD4389C,
+  0xD439B8, 0xD43A2C, 0xD43A2E, 0xD43A2F, 0xD43B04, 0xD43DF3, 0xD43F32, 0xD43FCB,
+  0xD440F0, 0xD44165, 0xD4430E, 0xD44649, 0xD446E1, 0xD44867, 0xD44B5E, 0xD44BB6,
+  0xD44D77, 0xD44D9F, 0xD44DA4, 0xD44F67, 0xD4503F, 0xD452EE, 0xD45383, 0xD4548B,
+  0xD455BE, 0xD45763, 0xD45800, 0xD45A3F, 0xD45D42, 0xD45D64, 0xD45DDF, 0xD45EEC,
+  0xD45F25, 0xD45F7A, 0xD46075, 0xD460E3, 0xD4612E, 0xD4619D, 0xD461DA, 0xD461FE,
+  0xD462EA, 0xD463C6, 0xD463DE, 0xD463FE, 0xD46624, 0xD467D3, 0xD467E7, 0xD4684D,
+  0xD468AA, 0xD468BA, 0xD46A35, 0xD46A6A, 0xD46AA8, 0xD46BA6, 0xD46C6D, 0xD46D50,
+  0xD46D6D, 0xD46E0E, 0xD46E5C, 0xD47226, 0xD47415, 0xD476A0, 0xD476EA, 0xD47798,
+  0xD47856, 0xD4789B, 0xD47954, 0xD47AE2, 0xD47B75, 0xD47BB0, 0xD47DFC, 0xD47EE4,
+  0xD47F35, 0xD481D7, 0xD48304, 0xD48409, 0xD48457, 0xD48564, 0xD48660, 0xD487D8,
+  0xD48866, 0xD48890, 0xD48A39, 0xD48A3B, 0xD48AFC, 0xD48CB5, 0xD48D26, 0xD48F33,
+  0xD48FA2, 0xD4909C, 0xD4910F, 0xD49234, 0xD4925E, 0xD49390, 0xD49398, 0xD49400,
+  0xD494A1, 0xD494E8, 0xD494FB, 0xD4970B, 0xD4996C, 0xD49A20, 0xD49AA0, 0xD49AF6,
+  0xD49CDD, 0xD49CF4, 0xD49DC0, 0xD49E05, 0xD49E3B, 0xD49FDD, 0xD4A02A, 0xD4A148,
+  0xD4A23D, 0xD4A33D, 0xD4A3EB, 0xD4A651, 0xD4A923, 0xD4AB82, 0xD4ABCD, 0xD4AD2D,
+  0xD4AD71, 0xD4ADBD, 0xD4AE05, 0xD4AE52, 0xD4AFF7, 0xD4B110, 0xD4B169, 0xD4B27A,
+  0xD4B5CD, 0xD4B709, 0xD4B761, 0xD4B7D0, 0xD4B8FF, 0xD4B92F, 0xD4BAFA, 0xD4BBC8,
+  0xD4BBE6, 0xD4BD4F, 0xD4BED9, 0xD4C19E, 0xD4C1C8, 0xD4C1FC, 0xD4C93C, 0xD4C94B,
+  0xD4C9EF, 0xD4CA6D, 0xD4CA6E, 0xD4CBAF, 0xD4CBCC, 0xD4D184, 0xD4D252, 0xD4D2D6,
+  0xD4D4DA, 0xD4D51B, 0xD4D659, 0xD4D748, 0xD4D7CF, 0xD4D853, 0xD4D892, 0xD4D919,
+  0xD4DA21, 0xD4DACD, 0xD4DC09, 0xD4DCCD, 0xD4E053, 0xD4E22F, 0xD4E2CB, 0xD4E33F,
+  0xD4E6B7, 0xD4E853, 0xD4E880, 0xD4E8B2, 0xD4E95E, 0xD4E98A, 0xD4EA0E, 0xD4EB68,
+  0xD4ECAB, 0xD4EEDE, 0xD4F04A, 0xD4F057, 0xD4F0EA, 0xD4F242, 0xD4F32D, 0xD4F46F,
+  0xD4F4BE, 0xD4F513, 0xD4F527, 0xD4F547, 0xD4F5EF, 0xD4F756, 0xD4F786, 0xD4F7D5,
+  0xD4F829, 0xD4F921, 0xD4F98D, 0xD4F9A1, 0xD4FB8E, 0xD4FC13, 0xD8004D, 0xD8028A,
+  0xD802C0, 0xD8031A, 0xD807B6, 0xD80831, 0xD8097F, 0xD80A60, 0xD80AE6, 0xD80B9A,
+  0xD80BCB, 0xD80D17, 0xD80E29, 0xD80F99, 0xD81068, 0xD8109F, 0xD81265, 0xD8132A,
+  0xD81399, 0xD814DF, 0xD8150D, 0xD818D3, 0xD81BB5, 0xD81C79, 0xD81D72, 0xD81EDD,
+  0xD81F12, 0xD81FCC, 0xD821DA, 0xD824BD, 0xD82522, 0xD82918, 0xD829F8, 0xD82A7E,
+  0xD82FE6, 0xD83062, 0xD8312C, 0xD83134, 0xD831CF, 0xD83214, 0xD8325A, 0xD832E3,
+  0xD833B7, 0xD8341C, 0xD8365F, 0xD8373B, 0xD837BE, 0xD838FC, 0xD83ADD, 0xD83BBF,
+  0xD83C69, 0xD84008, 0xD842AC, 0xD843AE, 0xD84489, 0xD8452B, 0xD84710, 0xD84732,
+  0xD8478F, 0xD847BB, 0xD8490B, 0xD8492F, 0xD84A2B, 0xD84A87, 0xD84C90, 0xD84DB9,
+  0xD84FB8, 0xD850E6, 0xD8539A, 0xD8543A, 0xD854A2, 0xD85575, 0xD855A3, 0xD857EF,
+  0xD85982, 0xD85B2A, 0xD85D4C, 0xD85DE2, 0xD85DFB, 0xD85ED3, 0xD85F77, 0xD86162,
+  0xD8630D, 0xD86375, 0xD867D3, 0xD867D9, 0xD86852, 0xD868A0, 0xD868C3, 0xD86BF7,
+  0xD86BFC, 0xD86C5A, 0xD86C63, 0xD86CE9, 0xD86D17, 0xD8714D, 0xD87157, 0xD87495,
+  0xD87533, 0xD876AE, 0xD87766, 0xD8778B, 0xD8787F, 0xD878C9, 0xD87988, 0xD87A3B,
+  0xD87D7F, 0xD87E76, 0xD88039, 0xD88083, 0xD880DC, 0xD88466, 0xD88863, 0xD88ADC,
+  0xD88C73, 0xD88C79, 0xD88D5C, 0xD88ED4, 0xD88F76, 0xD890E8, 0xD8912A, 0xD89403,
+  0xD8952F, 0xD89685, 0xD89695, 0xD8973B, 0xD897BA, 0xD89AC1, 0xD89B3B, 0xD89C67,
+  0xD89C8E, 0xD89D67, 0xD89E3F, 0xD89E61, 0xD89ED4, 0xD89EF3, 0xD8A011, 0xD8A01D,
+  0xD8A0E6, 0xD8A0E8, 0xD8A25E, 0xD8A315, 0xD8A35C, 0xD8A491, 0xD8A6F0, 0xD8A756,
+  0xD8A8C8, 0xD8A98B, 0xD8AA59, 0xD8AD49, 0xD8AF81, 0xD8AFF1, 0xD8B020, 0xD8B053,
+  0xD8B122, 0xD8B12A, 0xD8B190, 0xD8B249, 0xD8B32F, 0xD8B370, 0xD8B377, 0xD8B673,
+  0xD8B6B7, 0xD8BB2C, 0xD8BBC1, 0xD8BC38, 0xD8BE1F, 0xD8BE65, 0xD8BFC0, 0xD8C0A6,
+  0xD8C46A, 0xD8C497, 0xD8C4E9, 0xD8C678, 0xD8C771, 0xD8C7C8, 0xD8C8E9, 0xD8CB8A,
+  0xD8CC98, 0xD8CE3A, 0xD8CF9C, 0xD8CFBF, 0xD8D090, 0xD8D1CB, 0xD8D385, 0xD8D43C,
+  0xD8D668, 0xD8D6F3, 0xD8D775, 0xD8DAF1, 0xD8DC40, 0xD8DDFD, 0xD8DE3A, 0xD8E0E1,
+  0xD8E23F, 0xD8E2DF, 0xD8E35E, 0xD8E56D, 0xD8E593, 0xD8E72B, 0xD8E72F, 0xD8E844,
+  0xD8EB46, 0xD8EB97, 0xD8EC5E, 0xD8ECE5, 0xD8EE42, 0xD8EF42, 0xD8EFCD, 0xD8F15B,
+  0xD8F2CA, 0xD8F3BC, 0xD8F507, 0xD8F760, 0xD8F883, 0xD8FB5E, 0xD8FBD6, 0xD8FC93,
+  0xD8FEE3, 0xDC0077, 0xDC00B0, 0xDC028E, 0xDC0398, 0xDC0539, 0xDC07F8, 0xDC080F,
+  0xDC0856, 0xDC094C, 0xDC0B09, 0xDC0B1A, 0xDC0B34, 0xDC0C2D, 0xDC0C5C, 0xDC0E96,
+  0xDC0EA1, 0xDC1057, 0xDC152D, 0xDC15C8, 0xDC16B2, 0xDC1AC5, 0xDC1BA1, 0xDC2148,
+  0xDC215C, 0xDC21E2, 0xDC233B, 0xDC2727, 0xDC2B2A, 0xDC2B61, 0xDC2C26, 0xDC2C6E,
+  0xDC2D04, 0xDC2D3C, 0xDC31D1, 0xDC330D, 0xDC333D, 0xDC360C, 0xDC3642, 0xDC3714,
+  0xDC3757, 0xDC38E1, 0xDC396F, 0xDC3979, 0xDC3A5E, 0xDC3EF8, 0xDC415F, 0xDC41A9,
+  0xDC446D, 0xDC44B6, 0xDC4517, 0xDC4546, 0xDC45B8, 0xDC4628, 0xDC4A3E, 0xDC4BA1,
+  0xDC4BDD, 0xDC4BFE, 0xDC4F22, 0xDC5193, 0xDC5285, 0xDC5360, 0xDC537C, 0xDC5392,
+  0xDC543D, 0xDC5475, 0xDC54D7, 0xDC5583, 0xDC56E7, 0xDC6180, 0xDC621F, 0xDC64B8,
+  0xDC6555, 0xDC6672, 0xDC680C, 0xDC6880, 0xDC68EB, 0xDC69E2, 0xDC6AE7, 0xDC6AEA,
+  0xDC6B1B, 0xDC6DBC, 0xDC6DCD, 0xDC7014, 0xDC7137, 0xDC7144, 0xDC7196, 0xDC71D0,
+  0xDC7223, 0xDC729B, 0xDC7385, 0xDC74A8, 0xDC774C, 0xDC7794, 0xDC7B94, 0xDC7CF7,
+  0xDC7FA4, 0xDC8084, 0xDC85DE, 0xDC86D8, 0xDC8983, 0xDC8B28, 0xDC8C1B, 0xDC8C37,
+  0xDC8D8A, 0xDC8D91, 0xDC8DB7, 0xDC8E8D, 0xDC8E95, 0xDC9088, 0xDC9166, 0xDC91BF,
+  0xDC9758, 0xDC97BA, 0xDC97E6, 0xDC9840, 0xDC9914, 0xDC9A7D, 0xDC9B9C, 0xDC9BD6,
+  0xDC9C9F, 0xDC9EAB, 0xDC9FA4, 0xDC9FDB, 0xDCA0D0, 0xDCA120, 0xDCA266, 0xDCA333,
+  0xDCA4CA, 0xDCA5F4, 0xDCA632, 0xDCA633, 0xDCA782, 0xDCA904, 0xDCA956, 0xDCA971,
+  0xDCAEEB, 0xDCAF68, 0xDCB082, 0xDCB347, 0xDCB4AC, 0xDCB4CA, 0xDCB54F, 0xDCB72E,
+  0xDCB7AC, 0xDCB808, 0xDCBD7A, 0xDCBDCC, 0xDCBE04, 0xDCBE49, 0xDCBFE9, 0xDCC2C9,
+  0xDCC49C, 0xDCC64B, 0xDCC793, 0xDCCC8D, 0xDCCCE6, 0xDCCD18, 0xDCCD2F, 0xDCCD66,
+  0xDCCEC1, 0xDCCF96, 0xDCD26A, 0xDCD2FC, 0xDCD2FD, 0xDCD321, 0xDCD3A2, 0xDCD444,
+  0xDCD7A0, 0xDCD916, 0xDCD9AE, 0xDCDA0C, 0xDCDA4D, 0xDCDA80, 0xDCDB27, 0xDCDCC3,
+  0xDCDCE2, 0xDCDE4F, 0xDCDFD6, 0xDCE305, 0xDCE55B, 0xDCE5D8, 0xDCE650, 0xDCE994,
+  0xDCEAE7, 0xDCEB69, 0xDCEB94, 0xDCED83, 0xDCEE06, 0xDCEF09, 0xDCEF80, 0xDCEFCA,
+  0xDCF110, 0xDCF31C, 0xDCF401, 0xDCF4CA, 0xDCF505, 0xDCF51B, 0xDCF719, 0xDCF756,
+  0xDCF8B9, 0xDCFB02, 0xDCFB48, 0xDCFE07, 0xDCFE18, 0xDCFE23, 0xE00084, 0xE001A6,
+  0xE001C7, 0xE0036B, 0xE005C5, 0xE00630, 0xE006E6, 0xE0071B, 0xE007C2, 0xE00855,
+  0xE00871, 0xE00AF6, 0xE00C7F, 0xE00CE5, 0xE00EDA, 0xE00EE1, 0xE00EE4, 0xE0107F,
+  0xE013B5, 0xE01877, 0xE0189F, 0xE0191D, 0xE01954, 0xE01995, 0xE01AEA, 0xE01C41,
+  0xE01CFC, 0xE01D38, 0xE01D3B, 0xE01F2B, 0xE01F6A, 0xE01F88, 0xE01FED, 0xE01FFC,
+  0xE02202, 0xE023FF, 0xE0247F, 0xE02481, 0xE02636, 0xE0276C, 0xE02861, 0xE0286D,
+  0xE028B1, 0xE02967, 0xE02A82, 0xE02AE6, 0xE02B96, 0xE02BE9, 0xE02CB2, 0xE02DF0,
+  0xE02E0B, 0xE02E3F, 0xE02EFE, 0xE02F6D, 0xE03005, 0xE030F9, 0xE0338E, 0xE03676,
+  0xE03717, 0xE037BF, 0xE0383F, 0xE03E44, 0xE03F49, 0xE04007, 0xE04102, 0xE04136,
+  0xE0456D, 0xE0469A, 0xE046EE, 0xE04735, 0xE04824, 0xE048D3, 0xE04BA6, 0xE04C12,
+  0xE04E7A, 0xE04F43, 0xE04FBD, 0xE0508B, 0xE05124, 0xE05163, 0xE051D8, 0xE0553D,
+  0xE05A1B, 0xE05D54, 0xE05F45, 0xE05FB9, 0xE06066, 0xE06234, 0xE06267, 0xE063DA,
+  0xE063E5, 0xE06678, 0xE06781, 0xE067B3, 0xE068EE, 0xE06995, 0xE069BA, 0xE06A05,
+  0xE06C4E, 0xE06CC5, 0xE06D17, 0xE070EA, 0xE0720A, 0xE073E7, 0xE0750A, 0xE07526,
+  0xE0757D, 0xE076D0, 0xE07726, 0xE0798D, 0xE07C13, 0xE07DEA, 0xE07E5F, 0xE0806B,
+  0xE0859A, 0xE08614, 0xE0885D, 0xE0897E, 0xE0899D, 0xE08E3C, 0xE08F4C, 0xE091F5,
+  0xE0925C, 0xE0928F, 0xE092A7, 0xE09467, 0xE09796, 0xE09806, 0xE09861, 0xE09971,
+  0xE09B27, 0xE09D13, 0xE09D31, 0xE09DB8, 0xE09DFA, 0xE09F2A, 0xE0A129, 0xE0A1CE,
+  0xE0A1D7, 0xE0A3AC, 0xE0A670, 0xE0A8B8, 0xE0AA96, 0xE0ACCB, 0xE0ACF1, 0xE0AE5E,
+  0xE0AEA2, 0xE0B2F1, 0xE0B52D, 0xE0B55F, 0xE0B655, 0xE0B668, 0xE0B70A, 0xE0B7B1,
+  0xE0B94D, 0xE0B9A5, 0xE0B9BA, 0xE0B9E5, 0xE0BAAD, 0xE0BB9E, 0xE0BDA0, 0xE0C264,
+  0xE0C2B7, 0xE0C377, 0xE0C3F3, 0xE0C58F, 0xE0C63C, 0xE0C767, 0xE0C79D, 0xE0C97A,
+  0xE0CA3C, 0xE0CA94, 0xE0CB19, 0xE0CB1D, 0xE0CB4E, 0xE0CB56, 0xE0CBBC, 0xE0CBEE,
+  0xE0CC7A, 0xE0CCF8, 0xE0CEC3, 0xE0D045, 0xE0D083, 0xE0D173, 0xE0D3B4, 0xE0D462,
+  0xE0D464, 0xE0D4E8, 0xE0D55E, 0xE0D7BA, 0xE0D848, 0xE0D8C4, 0xE0D9E3, 0xE0DA90,
+  0xE0DAD7, 0xE0DB10, 0xE0DB55, 0xE0DBD1, 0xE0DCA0, 0xE0DCFF, 0xE0DDC0, 0xE0DF13,
+  0xE0E0C2, 0xE0E0FC, 0xE0E1A9, 0xE0E2E6, 0xE0E37C, 0xE0E5CF, 0xE0E62E, 0xE0E751,
+  0xE0E8E6, 0xE0EB40, 0xE0EE1B, 0xE0EF02, 0xE0F318, 0xE0F442, 0xE0F5C6, 0xE0F62D,
+  0xE0F678, 0xE0F6B5, 0xE0F728, 0xE0F847, 0xE0FFF1, 0xE4029B, 0xE4072B, 0xE408E7,
+  0xE40A16, 0xE40CFD, 0xE40D36, 0xE40D3B, 0xE40EEE, 0xE41088, 0xE4115B, 0xE4121D,
+  0xE415F6, 0xE4186B, 0xE419C1, 0xE41D2D, 0xE41F13, 0xE41F7B, 0xE422A5, 0xE4233C,
+  0xE4246C, 0xE425E7, 0xE42686, 0xE4268B, 0xE426D5, 0xE42761, 0xE42AAC, 0xE42B34,
+  0xE42B79, 0xE42D02, 0xE42D7B, 0xE42F26, 0xE432CB, 0xE433AE, 0xE43493, 0xE435C8,
+  0xE4379F, 0xE4387E, 0xE43883, 0xE43BC9, 0xE43D1A, 0xE43EC6, 0xE43ED7, 0xE44097,
+  0xE440E2, 0xE44122, 0xE44164, 0xE442A6, 0xE4434B, 0xE444E5, 0xE44519, 0xE446DA,
+  0xE44790, 0xE447B3, 0xE448C7, 0xE44E2D, 0xE450EB, 0xE4521E, 0xE454E8, 0xE455A8,
+  0xE45740, 0xE458B8, 0xE458E7, 0xE45AA2, 0xE45AD4, 0xE45D37, 0xE45D51, 0xE45D52,
+  0xE45D75, 0xE45E1B, 0xE45E37, 0xE45F01, 0xE46017, 0xE4604D, 0xE461F4, 0xE462C4,
+  0xE46449, 0xE465B8, 0xE466AB, 0xE468A3, 0xE46A35, 0xE46CD1, 0xE46D7F, 0xE46F13,
+  0xE470B8, 0xE472E2, 0xE475DC, 0xE47684, 0xE47723, 0xE47727, 0xE47876, 0xE47A2C,
+  0xE47CF9, 0xE47DBD, 0xE47E66, 0xE47E9A, 0xE47FB2, 0xE48184, 0xE48210, 0xE48326,
+  0xE48399, 0xE48429, 0xE484D3, 0xE48B7F, 0xE48C73, 0xE48D8C, 0xE48E10, 0xE48EBB,
+  0xE48F1D, 0xE48F34, 0xE4902A, 0xE49069, 0xE4907E, 0xE490FD, 0xE492FB, 0xE4936A,
+  0xE498BB, 0xE498D1, 0xE498D6, 0xE49A79, 0xE49ADC, 0xE49C67, 0xE49D73, 0xE49E12,
+  0xE49F1E, 0xE4A1E6, 0xE4A41C, 0xE4A471, 0xE4A634, 0xE4A749, 0xE4A7A0, 0xE4A7C5,
+  0xE4A7D0, 0xE4A8B6, 0xE4A8DF, 0xE4AA5D, 0xE4AAE4, 0xE4AAEA, 0xE4AB89, 0xE4B021,
+  0xE4B224, 0xE4B2FB, 0xE4B318, 0xE4B503, 0xE4B555, 0xE4B97A, 0xE4BCAA, 0xE4BD4B,
+  0xE4BEED, 0xE4BEFB, 0xE4BFFA, 0xE4C0CC, 0xE4C0E2, 0xE4C2D1, 0xE4C32A, 0xE4C483,
+  0xE4C63D, 0xE4C722, 0xE4C767, 0xE4C770, 0xE4C801, 0xE4CA12, 0xE4CC9D, 0xE4CE8F,
+  0xE4D124, 0xE4D332, 0xE4D373, 0xE4D3AA, 0xE4D3F1, 0xE4D53D, 0xE4DADF, 0xE4DB6D,
+  0xE4DBAE, 0xE4DC43, 0xE4DCCC, 0xE4DE40, 0xE4E0A6, 0xE4E0C5, 0xE4E112, 0xE4E130,
+  0xE4E26C, 0xE4E4AB, 0xE4E749, 0xE4EA83, 0xE4EC10, 0xE4ECE8, 0xE4F004, 0xE4F042,
+  0xE4F14C, 0xE4F1D4, 0xE4F27C, 0xE4F3C4, 0xE4F3E8, 0xE4F3F5, 0xE4F4C6, 0xE4F75B,
+  0xE4F89C, 0xE4F8BE, 0xE4F8EF, 0xE4FA5B, 0xE4FAC4, 0xE4FAED, 0xE4FAFD, 0xE4FB5D,
+  0xE4FB8F, 0xE4FC82, 0xE4FD45, 0xE4FDA1, 0xE4FED9, 0xE8018D, 0xE8039A, 0xE8040B,
+  0xE80410, 0xE80462, 0xE8056D, 0xE805DC, 0xE80688, 0xE8088B, 0xE80945, 0xE80AB9,
+  0xE80FC8, 0xE81098, 0xE81132, 0xE8136E, 0xE8150E, 0xE81656, 0xE81B69, 0xE81CBA,
+  0xE81CD8, 0xE81DA8, 0xE81E92, 0xE820E2, 0xE822B8, 0xE82404, 0xE824A6, 0xE82689,
+  0xE8268D, 0xE82725, 0xE8288D, 0xE828C1, 0xE82A44, 0xE82AEA, 0xE82BC5, 0xE82C6D,
+  0xE831CD, 0xE83381, 0xE83617, 0xE8377A, 0xE838A0, 0xE83935, 0xE839DF, 0xE83A12,
+  0xE83A4B, 0xE83A97, 0xE83EB6, 0xE83EFC, 0xE83F67, 0xE84040, 0xE840F2, 0xE84368,
+  0xE8458B, 0xE84727, 0xE8473A, 0xE848B8, 0xE84A54, 0xE84C4A, 0xE84D74, 0xE84DD0,
+  0xE84E84, 0xE84ECE, 0xE84F25, 0xE84FA7, 0xE8508B, 0xE85177, 0xE8519E, 0xE85497,
+  0xE85A8B, 0xE85AD1, 0xE85B5B, 0xE85C0A, 0xE85F02, 0xE8617E, 0xE86538, 0xE86549,
+  0xE8655F, 0xE865D4, 0xE86819, 0xE868E7, 0xE86A64, 0xE86BEA, 0xE86D52, 0xE86DCB,
+  0xE86DE9, 0xE86E3A, 0xE86E44, 0xE86F38, 0xE86FF2, 0xE87072, 0xE874E6, 0xE87640,
+  0xE87865, 0xE878EE, 0xE87F6B, 0xE87F95, 0xE8802E, 0xE88088, 0xE88152, 0xE88175,
+  0xE8825B, 0xE884A5, 0xE884C6, 0xE8854B, 0xE886CF, 0xE88843, 0xE8892C, 0xE88D28,
+  0xE88DA6, 0xE88DF5, 0xE88F6F, 0xE8910F, 0xE89120, 0xE892A4, 0xE89309, 0xE89363,
+  0xE894F6, 0xE89526, 0xE8979A, 0xE897B8, 0xE89847, 0xE8986D, 0xE899C4, 0xE89A8F,
+  0xE89AFF, 0xE89C25, 0xE89D87, 0xE89E13, 0xE89EB4, 0xE89F39, 0xE89F6D, 0xE89F80,
+  0xE8A0CD, 0xE8A0ED, 0xE8A1F8, 0xE8A245, 0xE8A34E, 0xE8A660, 0xE8A6CA, 0xE8A72F,
+  0xE8A730, 0xE8AACB, 0xE8ABF3, 0xE8AC23, 0xE8ACAD, 0xE8ADA6, 0xE8AEC5, 0xE8B0C5,
+  0xE8B1FC, 0xE8B265, 0xE8B2AC, 0xE8B2FE, 0xE8B3EF, 0xE8B4C8, 0xE8B541, 0xE8B5D0,
+  0xE8B6C2, 0xE8B748, 0xE8BA70, 0xE8BBA8, 0xE8BDD1, 0xE8BE81, 0xE8BFB8, 0xE8C2DD,
+  0xE8C417, 0xE8C74F, 0xE8C7CF, 0xE8C829, 0xE8CAC8, 0xE8CBA1, 0xE8CBF5, 0xE8CC18,
+  0xE8CD2D, 0xE8D03C, 0xE8D099, 0xE8D0B9, 0xE8D0FC, 0xE8D11B, 0xE8D2FF, 0xE8D322,
+  0xE8D3EB, 0xE8D52B, 0xE8D765, 0xE8D775, 0xE8D819, 0xE8D87E, 0xE8D8D1, 0xE8DA20,
+  0xE8DA3E, 0xE8DB84, 0xE8DC6C, 0xE8DE27, 0xE8DE8E, 0xE8DF70, 0xE8E07E, 0xE8E0B7,
+  0xE8E1E1, 0xE8E5D6, 0xE8E732, 0xE8E8B7, 0xE8EA4D, 0xE8EB11, 0xE8EB1B, 0xE8EB34,
+  0xE8EBD3, 0xE8ECA3, 0xE8ED05, 0xE8EDD6, 0xE8EDF3, 0xE8EECC, 0xE8F085, 0xE8F1B0,
+  0xE8F2E2, 0xE8F375, 0xE8F408, 0xE8F654, 0xE8F724, 0xE8F72F, 0xE8F791, 0xE8F8D0,
+  0xE8F9D4, 0xE8FA23, 0xE8FB1C, 0xE8FBE9, 0xE8FCAF, 0xE8FD35, 0xE8FDF8, 0xE8FF98,
+  0xEC01D5, 0xEC01EE, 0xEC0273, 0xEC086B, 0xEC08E5, 0xEC0BAE, 0xEC0C96, 0xEC0D51,
+  0xEC0D9A, 0xEC0DE4, 0xEC0EC4, 0xEC107B, 0xEC1127, 0xEC13DB, 0xEC172F, 0xEC192E,
+  0xEC1A02, 0xEC1A59, 0xEC1BBD, 0xEC1C5D, 0xEC1D7F, 0xEC1D8B, 0xEC1D9E, 0xEC1F72,
+  0xEC2125, 0xEC2150, 0xEC21E5, 0xEC2280, 0xEC233D, 0xEC237B, 0xEC24B8, 0xEC2651,
+  0xEC26CA, 0xEC28D3, 0xEC2A72, 0xEC2BEB, 0xEC2C73, 0xEC2CE2, 0xEC2E98, 0xEC3091,
+  0xEC30B3, 0xEC314A, 0xEC354D, 0xEC3586, 0xEC3873, 0xEC388F, 0xEC3A52, 0xEC3CBB,
+  0xEC3DFD, 0xEC3EB3, 0xEC3EF7, 0xEC4118, 0xEC41F9, 0xEC4269, 0xEC42CC, 0xEC43F6,
+  0xEC4476, 0xEC462C, 0xEC4D3E, 0xEC4D47, 0xEC4F82, 0xEC50AA, 0xEC51BC, 0xEC5382,
+  0xEC551C, 0xEC55F9, 0xEC5623, 0xEC58EA, 0xEC59E7, 0xEC5A86, 0xEC5AA3, 0xEC5C68,
+  0xEC5C84, 0xEC6073, 0xEC6260, 0xEC63D7, 0xEC6488, 0xEC64C9, 0xEC65CC, 0xEC6794,
+  0xEC6881, 0xEC6C9A, 0xEC6CB5, 0xEC7097, 0xEC7379, 0xEC7427, 0xEC748C, 0xEC74BA,
+  0xEC74D7, 0xEC753E, 0xEC7949, 0xEC7C2C, 0xEC7C5C, 0xEC7CB6, 0xEC7D11, 0xEC7E91,
+  0xEC8150, 0xEC8193, 0xEC819C, 0xEC8263, 0xEC8350, 0xEC84B4, 0xEC852F, 0xEC888F,
+  0xEC8892, 0xEC8914, 0xEC89F5, 0xEC8A48, 0xEC8A4C, 0xEC8AC4, 0xEC8AC7, 0xEC8C9A,
+  0xEC8CA2, 0xEC8EB5, 0xEC90C1, 0xEC9161, 0xEC937D, 0xEC94CB, 0xEC94D5, 0xEC97E0,
+  0xEC9A34, 0xEC9A74, 0xEC9B2D, 0xEC9B5B, 0xEC9B8B, 0xEC9BF3, 0xEC9C32, 0xEC9ECD,
+  0xECA138, 0xECA1D1, 0xECA2A0, 0xECA62F, 0xECA7AD, 0xECA81F, 0xECA86B, 0xECA907,
+  0xECA940, 0xECA971, 0xECA9FA, 0xECAA25, 0xECAA8F, 0xECAAA0, 0xECAB3E, 0xECADB8,
+  0xECADE0, 0xECB0D2, 0xECB0E1, 0xECB1D7, 0xECB1E0, 0xECB313, 0xECB878, 0xECB970,
+  0xECBD1D, 0xECBE5F, 0xECBEDD, 0xECBFD0, 0xECC018, 0xECC01B, 0xECC07A, 0xECC1AB,
+  0xECC302, 0xECC342, 0xECC3B0, 0xECC40D, 0xECC5D2, 0xECC882, 0xECC89C, 0xECCB30,
+  0xECCD4C, 0xECCD6D, 0xECCE13, 0xECCED7, 0xECCF70, 0xECD09F, 0xECDA3B, 0xECDA59,
+  0xECDF3A, 0xECE09B, 0xECE1A9, 0xECE61D, 0xECE660, 0xECE6A2, 0xECE7A7, 0xECE7C2,
+  0xECEBB8, 0xECED73, 0xECEF17, 0xECF00E, 0xECF0FE, 0xECF22B, 0xECF342, 0xECF35B,
+  0xECF40C, 0xECF451, 0xECF4BB, 0xECF64C, 0xECF8D0, 0xECF8EB, 0xECFA5C, 0xECFABC,
+  0xECFCC6, 0xF0038C, 0xF0051B, 0xF008D1, 0xF008F1, 0xF00D5C, 0xF00E1D, 0xF00FEC,
+  0xF01090, 0xF010A5, 0xF010AB, 0xF01898, 0xF01AA0, 0xF01B24, 0xF01B6C, 0xF01C13,
+  0xF01C2D, 0xF01D2D, 0xF01DBC, 0xF01FAF, 0xF01FC7, 0xF020FF, 0xF0219D, 0xF021E0,
+  0xF023AE, 0xF02475, 0xF02572, 0xF0258E, 0xF025B7, 0xF0272D, 0xF02765, 0xF02929,
+  0xF02B7C, 0xF02E51, 0xF02F4B, 0xF02F74, 0xF02F9E, 0xF02FA7, 0xF033E5, 0xF03404,
+  0xF03575, 0xF037CF, 0xF03965, 0xF03D03, 0xF03E90, 0xF03F03, 0xF03F95, 0xF0407B,
+  0xF0421C, 0xF042F5, 0xF04347, 0xF045DA, 0xF0463B, 0xF04A02, 0xF04B3A, 0xF04B8A,
+  0xF04CD5, 0xF04DA2, 0xF04DD4, 0xF04F7C, 0xF05136, 0xF051EA, 0xF05501, 0xF057A6,
+  0xF05A09, 0xF05B7B, 0xF05C19, 0xF05C77, 0xF05CD5, 0xF05ECD, 0xF061C0, 0xF061F3,
+  0xF0625A, 0xF06281, 0xF063F9, 0xF06426, 0xF065AE, 0xF065DD, 0xF06728, 0xF06865,
+  0xF06BCA, 0xF06C5D, 0xF06C73, 0xF06D78, 0xF06E0B, 0xF0704F, 0xF0728C, 0xF072EA,
+  0xF0748D, 0xF0761C, 0xF0766F, 0xF077C3, 0xF07807, 0xF07816, 0xF07959, 0xF07960,
+  0xF079E8, 0xF07B65, 0xF07BCB, 0xF07CC7, 0xF07D68, 0xF07F06, 0xF08173, 0xF08175,
+  0xF08261, 0xF082C0, 0xF0842F, 0xF084C9, 0xF085C1, 0xF08620, 0xF0866F, 0xF08756,
+  0xF08A76, 0xF08CFB, 0xF09008, 0xF0921C, 0xF092B4, 0xF09838, 0xF0989D, 0xF09919,
+  0xF099B6, 0xF099BF, 0xF09BB8, 0xF09CE9, 0xF09E4A, 0xF09E63, 0xF09FC2, 0xF09FFC,
+  0xF0A0B1, 0xF0A225, 0xF0A35A, 0xF0A3B2, 0xF0A654, 0xF0A731, 0xF0A951, 0xF0AB1F,
+  0xF0AB54, 0xF0AF85, 0xF0B014, 0xF0B040, 0xF0B052, 0xF0B0E7, 0xF0B107, 0xF0B11D,
+  0xF0B13F, 0xF0B2B9, 0xF0B2E5, 0xF0B31E, 0xF0B3EC, 0xF0B429, 0xF0B479, 0xF0B4D2,
+  0xF0B5D1, 0xF0B61E, 0xF0B661, 0xF0B968, 0xF0BF97, 0xF0C1F1, 0xF0C371, 0xF0C42F,
+  0xF0C478, 0xF0C725, 0xF0C745, 0xF0C77F, 0xF0C814, 0xF0C850, 0xF0C8B5, 0xF0C9D1,
+  0xF0CBA1, 0xF0CD31, 0xF0D08C, 0xF0D1A9, 0xF0D2F1, 0xF0D31F, 0xF0D415, 0xF0D4E2,
+  0xF0D5BF, 0xF0D793, 0xF0D7AA, 0xF0D805, 0xF0DBE2, 0xF0DBF8, 0xF0DCE2, 0xF0DEF1,
+  0xF0E4A2, 0xF0E77E, 0xF0EBD0, 0xF0ED19, 0xF0EDB8, 0xF0EE10, 0xF0EE7A, 0xF0EF86,
+  0xF0F002, 0xF0F0A4, 0xF0F249, 0xF0F336, 0xF0F564, 0xF0F5BD, 0xF0F61C, 0xF0F6C1,
+  0xF0F755, 0xF0F7E7, 0xF0F7FC, 0xF0F84A, 0xF0F8F2, 0xF0FAC7, 0xF0FCC8, 0xF0FE6B,
+  0xF0FEE7, 0xF40223, 0xF40228, 0xF40270, 0xF40304, 0xF4032A, 0xF40343, 0xF40595,
+  0xF40616, 0xF40669, 0xF4068D, 0xF409D8, 0xF40B93, 0xF40B9F, 0xF40E01, 0xF40E22,
+  0xF40E83, 0xF40F1B, 0xF40F24, 0xF412DA, 0xF412FA, 0xF41563, 0xF417B8, 0xF41A9C,
+  0xF41BA1, 0xF41D6B, 0xF41F88, 0xF41FC2, 0xF42015, 0xF421CA, 0xF4239C, 0xF42679,
+  0xF42853, 0xF42981, 0xF42A7D, 0xF42B8C, 0xF42D06, 0xF42E48, 0xF42E7F, 0xF4308B,
+  0xF430B9, 0xF431C3, 0xF4323D, 0xF434F0, 0xF437B7, 0xF438C1, 0xF43909, 0xF439A6,
+  0xF43A7B, 0xF43BD8, 0xF43C3B, 0xF43C96, 0xF43E61, 0xF4419E, 0xF44250, 0xF4428F,
+  0xF4442C, 0xF44588, 0xF44637, 0xF44B2A, 0xF44C70, 0xF44C7F, 0xF44D30, 0xF44D5C,
+  0xF44E05, 0xF44EE3, 0xF450EB, 0xF45214, 0xF45246, 0xF45420, 0xF45424, 0xF45433,
+  0xF4559C, 0xF4573E, 0xF45C89, 0xF45EAB, 0xF45FD4, 0xF46077, 0xF460E2, 0xF462DC,
+  0xF4631F, 0xF463FC, 0xF46412, 0xF4645D, 0xF465A6, 0xF46942, 0xF46A92, 0xF46AD7,
+  0xF46ADD, 0xF46B8C, 0xF46BEF, 0xF46C68, 0xF46D04, 0xF46D2F, 0xF46D3F, 0xF46DE2,
+  0xF46E95, 0xF46ED6, 0xF46FED, 0xF470AB, 0xF47190, 0xF47335, 0xF47488, 0xF47946,
+  0xF47960, 0xF47B09, 0xF47B5E, 0xF47DEF, 0xF47F35, 0xF48139, 0xF4832C, 0xF483CD,
+  0xF4844C, 0xF4848D, 0xF487C5, 0xF48B32, 0xF48C50, 0xF48CEB, 0xF48E09, 0xF48E38,
+  0xF48E92, 0xF492BF, 0xF4931C, 0xF4939F, 0xF4951B, 0xF49634, 0xF49651, 0xF49D8A,
+  0xF49DA7, 0xF49EEF, 0xF49F54, 0xF49FF3, 0xF4A475, 0xF4A4D6, 0xF4A59D, 0xF4A739,
+  0xF4A80D, 0xF4A997, 0xF4AAD0, 0xF4ACC1, 0xF4AFE7, 0xF4B19C, 0xF4B1C2, 0xF4B301,
+  0xF4B3B1, 0xF4B52F, 0xF4B5AA, 0xF4B5BB, 0xF4B688, 0xF4B78D, 0xF4B7B3, 0xF4B7E2,
+  0xF4B85E, 0xF4B898, 0xF4B8A7, 0xF4BBC7, 0xF4BCDA, 0xF4BD9E, 0xF4BEEC, 0xF4BF80,
+  0xF4BFA8, 0xF4BFBB, 0xF4C114, 0xF4C248, 0xF4C613, 0xF4C714, 0xF4C88A, 0xF4CAE5,
+  0xF4CAE7, 0xF4CB52, 0xF4CC55, 0xF4CE23, 0xF4CE46, 0xF4CE48, 0xF4CFA2, 0xF4CFE2,
+  0xF4D108, 0xF4D488, 0xF4D580, 0xF4D58A, 0xF4D620, 0xF4D9C6, 0xF4D9FB, 0xF4DBE3,
+  0xF4DBE6, 0xF4DCF9, 0xF4DD06, 0xF4DD9E, 0xF4DEAF, 0xF4E11E, 0xF4E2C6, 0xF4E3FB,
+  0xF4E451, 0xF4E4AD, 0xF4E4D7, 0xF4E578, 0xF4E5F2, 0xF4E84F, 0xF4E8C7, 0xF4E975,
+  0xF4E9D4, 0xF4EA67, 0xF4EAB5, 0xF4EB38, 0xF4EC38, 0xF4EE08, 0xF4EE14, 0xF4EE31,
+  0xF4F15A, 0xF4F1E1, 0xF4F26D, 0xF4F28A, 0xF4F309, 0xF4F524, 0xF4F5A5, 0xF4F5D8,
+  0xF4F5DB, 0xF4F5E8, 0xF4F647, 0xF4F951, 0xF4FBB8, 0xF4FC32, 0xF4FE3E, 0xF4FEFB,
+  0xF800A1, 0xF80113, 0xF801B4, 0xF80377, 0xF8042E, 0xF8075D, 0xF8084F, 0xF80BBE,
+  0xF80BCB, 0xF80C58, 0xF80CF3, 0xF80D43, 0xF80D60, 0xF80DA9, 0xF80DAC, 0xF80DF0,
+  0xF80F41, 0xF80F6F, 0xF80FF9, 0xF81093, 0xF81308, 0xF814FE, 0xF81547, 0xF81654,
+  0xF81897, 0xF81A2B, 0xF81A67, 0xF81D0F, 0xF81EDF, 0xF81F32, 0xF820A9, 0xF820D2,
+  0xF82111, 0xF82229, 0xF823B2, 0xF82551, 0xF82793, 0xF82819, 0xF828C9, 0xF829C0,
+  0xF82B7F, 0xF82C18, 0xF82D7C, 0xF82DC0, 0xF82E0C, 0xF82E3F, 0xF82F08, 0xF82F65,
+  0xF82F6A, 0xF82FA8, 0xF83002, 0xF832E4, 0xF83331, 0xF83441, 0xF8345A, 0xF835DD,
+  0xF8369B, 0xF83869, 0xF83880, 0xF83918, 0xF83B1D, 0xF83B7E, 0xF83C80, 0xF83DFF,
+  0xF83E95, 0xF83F51, 0xF84288, 0xF844E3, 0xF845AD, 0xF8461C, 0xF84897, 0xF848FD,
+  0xF84ABF, 0xF84CDA, 0xF84D33, 0xF84D89, 0xF84DFC, 0xF84E17, 0xF84E58, 0xF84E73,
+  0xF84F57, 0xF84FAD, 0xF85329, 0xF854AF, 0xF854B8, 0xF854F6, 0xF85548, 0xF855CD,
+  0xF856C3, 0xF85971, 0xF85B3B, 0xF85B6E, 0xF85C4D, 0xF85C7D, 0xF85C7E, 0xF85E0B,
+  0xF85E42, 0xF85EA0, 0xF85F2A, 0xF860F0, 0xF86214, 0xF8633F, 0xF863D9, 0xF864B8,
+  0xF8665A, 0xF86691, 0xF866D1, 0xF866F2, 0xF86B14, 0xF86BD9, 0xF86CE1, 0xF86DCC,
+  0xF86EEE, 0xF86FB0, 0xF86FC1, 0xF8710C, 0xF871A6, 0xF872EA, 0xF87394, 0xF873A2,
+  0xF87588, 0xF875A4, 0xF877B8, 0xF87907, 0xF8790A, 0xF87928, 0xF87A41, 0xF87B20,
+  0xF87B7A, 0xF87D3F, 0xF87D76, 0xF884F2, 0xF885F9, 0xF887F1, 0xF889D2, 0xF88A5E,
+  0xF88B37, 0xF88C21, 0xF88E85, 0xF88EA1, 0xF88F07, 0xF88FC8, 0xF88FCA, 0xF894C2,
+  0xF89522, 0xF895C7, 0xF895EA, 0xF896FE, 0xF89753, 0xF897A9, 0xF898B9, 0xF898EF,
+  0xF89910, 0xF89A25, 0xF89A78, 0xF89B6E, 0xF89E28, 0xF89E94, 0xF8A097, 0xF8A26D,
+  0xF8A2D6, 0xF8A34F, 0xF8A45F, 0xF8A5C5, 0xF8A73A, 0xF8A763, 0xF8A963, 0xF8A9D0,
+  0xF8AA3F, 0xF8AB05, 0xF8AB82, 0xF8ABE5, 0xF8AC65, 0xF8AD24, 0xF8ADCB, 0xF8AF05,
+  0xF8AFDB, 0xF8B132, 0xF8B156, 0xF8B1DD, 0xF8B46A, 0xF8B54D, 0xF8B797, 0xF8B7E2,
+  0xF8B8B4, 0xF8B95A, 0xF8BAE6, 0xF8BBBF, 0xF8BC0E, 0xF8BC12, 0xF8BF09, 0xF8C001,
+  0xF8C116, 0xF8C288, 0xF8C39E, 0xF8C3CC, 0xF8C4AE, 0xF8C4FA, 0xF8C650, 0xF8C96C,
+  0xF8CA85, 0xF8CAB8, 0xF8CDC8, 0xF8CE72, 0xF8CFC5, 0xF8D027, 0xF8D0AC, 0xF8D0BD,
+  0xF8D111, 0xF8D2AC, 0xF8D478, 0xF8DA0C, 0xF8DB7F, 0xF8DB88, 0xF8DE73, 0xF8DF15,
+  0xF8DFA8, 0xF8E079, 0xF8E43B, 0xF8E44E, 0xF8E4A4, 0xF8E4E3, 0xF8E4FB, 0xF8E57E,
+  0xF8E5CE, 0xF8E61A, 0xF8E71E, 0xF8E7A0, 0xF8E811, 0xF8E877, 0xF8E903, 0xF8E94E,
+  0xF8E94F, 0xF8EDA5, 0xF8F1B6, 0xF8F1E6, 0xF8F21E, 0xF8F532, 0xF8F7B9, 0xF8FB90,
+  0xF8FCE1, 0xF8FE5E, 0xF8FFC2, 0xFC017C, 0xFC0296, 0xFC039F, 0xFC041C, 0xFC0736,
+  0xFC084A, 0xFC0A81, 0xFC0C45, 0xFC0F4B, 0xFC0FE6, 0xFC0FE7, 0xFC101A, 0xFC10C6,
+  0xFC1165, 0xFC1193, 0xFC122C, 0xFC1263, 0xFC13F0, 0xFC15B4, 0xFC1803, 0xFC183C,
+  0xFC1910, 0xFC1999, 0xFC1A11, 0xFC1BD1, 0xFC1CA1, 0xFC1D2A, 0xFC1D3A, 0xFC1D43,
+  0xFC1F19, 0xFC22F4, 0xFC253F, 0xFC29E3, 0xFC2A46, 0xFC2A9C, 0xFC2BB2, 0xFC2D5E,
+  0xFC2E19, 0xFC2FAA, 0xFC315D, 0xFC3342, 0xFC3497, 0xFC34E2, 0xFC35E6, 0xFC372B,
+  0xFC386A, 0xFC3964, 0xFC3CD7, 0xFC3D93, 0xFC3DA5, 0xFC3F7C, 0xFC3FA6, 0xFC3FDB,
+  0xFC4009, 0xFC4203, 0xFC4265, 0xFC4482, 0xFC449F, 0xFC4596, 0xFC45C3, 0xFC47D8,
+  0xFC48EF, 0xFC492D, 0xFC4AE9, 0xFC4BBC, 0xFC4DA6, 0xFC4DD4, 0xFC4EA4, 0xFC51A4,
+  0xFC51B5, 0xFC528D, 0xFC5557, 0xFC5703, 0xFC589A, 0xFC599F, 0xFC59C0, 0xFC5A1D,
+  0xFC5B39, 0xFC5B8C, 0xFC5C45, 0xFC5CEE, 0xFC5F49, 0xFC609B, 0xFC61E9, 0xFC62B9,
+  0xFC643A, 0xFC64BA, 0xFC65B3, 0xFC65DE, 0xFC66CF, 0xFC671F, 0xFC6947, 0xFC6A1C,
+  0xFC6FB7, 0xFC702E, 0xFC73FB, 0xFC7516, 0xFC75E6, 0xFC7774, 0xFC777B, 0xFC7A58,
+  0xFC7C02, 0xFC7FF1, 0xFC8399, 0xFC8417, 0xFC84A7, 0xFC862A, 0xFC8743, 0xFC8A3D,
+  0xFC8AF7, 0xFC8B97, 0xFC8C11, 0xFC8D13, 0xFC8E5B, 0xFC8E7E, 0xFC8F7D, 0xFC8F90,
+  0xFC9114, 0xFC9189, 0xFC923B, 0xFC9257, 0xFC936B, 0xFC9435, 0xFC94CE, 0xFC94E3,
+  0xFC9643, 0xFC9816, 0xFC9947, 0xFC9BC6, 0xFC9CA7, 0xFC9FFD, 0xFCA0F3, 0xFCA13E,
+  0xFCA183, 0xFCA386, 0xFCA5D0, 0xFCA621, 0xFCA667, 0xFCA6CD, 0xFCA841, 0xFCA89A,
+  0xFCA89B, 0xFCA8E0, 0xFCA9DC, 0xFCA9F5, 0xFCAA14, 0xFCAA81, 0xFCAAB6, 0xFCAB90,
+  0xFCAE34, 0xFCB0C4, 0xFCB0DE, 0xFCB2D6, 0xFCB3BC, 0xFCB467, 0xFCB4E6, 0xFCB698,
+  0xFCB69D, 0xFCB6D8, 0xFCB9DF, 0xFCBCD1, 0xFCBD67, 0xFCBE7B, 0xFCC233, 0xFCC2DE,
+  0xFCC734, 0xFCC897, 0xFCCF62, 0xFCD290, 0xFCD436, 0xFCD586, 0xFCD5D9, 0xFCD6BD,
+  0xFCD733, 0xFCD749, 0xFCD848, 0xFCD908, 0xFCDBB3, 0xFCDE90, 0xFCDF00, 0xFCE26C,
+  0xFCE33C, 0xFCE557, 0xFCE806, 0xFCE8C0, 0xFCE998, 0xFCE9D8, 0xFCEA50, 0xFCECDA,
+  0xFCF136, 0xFCF152, 0xFCF29F, 0xFCF528, 0xFCF5C4, 0xFCF647, 0xFCF738, 0xFCF77B,
+  0xFCF8AE, 0xFCFA21, 0xFCFAF7, 0xFCFBFB, 0xFCFC48,
+};
+
+// Offset of each key's vendor name in oui_db_names
+static constexpr uint16_t oui_db_name_offsets[OUI_DB_ENTRIES] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 20,
+  28, 35, 53, 67, 79, 83, 108, 123, 148, 156, 162, 176,
+  28, 192, 198, 223, 232, 240, 0, 261, 279, 156, 299, 306,
+  318, 306, 325, 329, 349, 364, 148, 382, 382, 198, 387, 412,
+  435, 6, 6, 223, 455, 459, 464, 28, 6, 6, 176, 6,
+  6, 471, 6, 6, 496, 508, 516, 516, 532, 364, 542, 6,
+  6, 554, 6, 6, 6, 563, 571, 176, 455, 575, 594, 6,
+  6, 156, 382, 516, 619, 6, 6, 625, 636, 658, 6, 6,
+  676, 6, 6, 176, 619, 176, 6, 6, 700, 706, 729, 741,
+  766, 772, 6, 6, 28, 778, 306, 6, 6, 6, 6, 784,
+  794, 816, 828, 834, 838, 619, 6, 6, 176, 863, 6, 6,
+  870, 412, 6, 6, 382, 382, 887, 198, 906, 387, 6, 6,
+  916, 571, 306, 6, 6, 937, 176, 6, 6, 956, 975, 988,
+  516, 240, 6, 6, 766, 1006, 816, 198, 6, 6, 198, 1025,
+  1032, 6, 6, 1053, 6, 6, 148, 1060, 1078, 1095, 676, 6,
+  6, 1120, 1131, 6, 6, 1144, 471, 6, 571, 6, 1159, 6,
+  6, 1165, 542, 1170, 1131, 6, 382, 1188, 6, 6, 6, 299,
+  625, 6, 625, 1198, 625, 6, 6, 1212, 1217, 1242, 1006, 6,
+  6, 1250, 6, 28, 6, 6, 1274, 329, 1299, 6, 6, 1060,
+  1321, 1329, 1341, 619, 6, 6, 516, 1361, 306, 6, 6, 1369,
+  6, 6, 6, 6, 1165, 6, 6, 516, 1390, 1408, 6, 6,
+  1421, 6, 516, 6, 6, 83, 471, 1432, 6, 6, 1441, 1445,
+  1455, 6, 6, 1474, 571, 6, 6, 1482, 176, 6, 6, 1490,
+  1499, 1524, 6, 6, 1542, 1547, 1559, 766, 1482, 318, 6, 6,
+  496, 516, 382, 1576, 1585, 6, 6, 766, 6, 6, 1060, 459,
+  1604, 1614, 1274, 1622, 1643, 6, 6, 1663, 306, 1672, 148, 1696,
+  1721, 1746, 6, 6, 1753, 1778, 1787, 20, 6, 6, 1808, 1828,
+  1842, 6, 1863, 1888, 83, 508, 1912, 1542, 1576, 6, 6, 975,
+  516, 1165, 148, 6, 6, 1937, 1753, 1053, 6, 6, 1941, 1955,
+  937, 148, 1971, 1990, 2007, 6, 6, 2032, 2037, 6, 6, 198,
+  306, 1432, 619, 176, 176, 2043, 1242, 6, 6, 2057, 2067, 784,
+  2074, 1542, 1165, 148, 571, 6, 6, 554, 2079, 1274, 2085, 2092,
+  766, 516, 148, 1663, 6, 6, 148, 2113, 6, 6, 148, 318,
+  459, 1941, 619, 148, 2122, 148, 261, 2129, 619, 6, 6, 176,
+  2147, 2171, 2177, 306, 2200, 176, 1542, 2220, 1361, 516, 6, 6,
+  508, 2241, 2249, 1990, 516, 2257, 176, 6, 6, 2277, 658, 148,
+  176, 148, 2302, 1165, 516, 1585, 6, 6, 2057, 6, 6, 2085,
+  28, 2314, 516, 1941, 176, 2322, 2329, 6, 6, 2344, 2314, 53,
+  306, 2355, 2370, 1474, 2392, 1542, 306, 176, 2417, 459, 2438, 2463,
+  2471, 6, 6, 6, 6, 6, 6, 6, 1663, 6, 6, 6,
+  1274, 176, 382, 28, 6, 382, 554, 6, 6, 516, 1321, 318,
+  1025, 6, 988, 2492, 2504, 53, 1078, 2007, 28, 516, 906, 6,
+  766, 364, 6, 2529, 516, 619, 306, 6, 6, 766, 571, 1990,
+  1165, 2548, 176, 1274, 6, 6, 2570, 2584, 2606, 619, 306, 516,
+  532, 2620, 6, 6, 2085, 658, 2645, 306, 6, 6, 937, 1990,
+  1321, 1585, 2655, 176, 1643, 6, 6, 2670, 1941, 2677, 1078, 306,
+  2684, 2709, 1165, 6, 6, 329, 223, 2709, 784, 658, 516, 6,
+  6, 176, 2079, 306, 1542, 2727, 2747, 306, 988, 2709, 2709, 6,
+  6, 459, 2772, 198, 2788, 329, 2795, 2772, 176, 1941, 306, 838,
+  2820, 6, 6, 2772, 516, 2037, 2085, 1299, 2834, 6, 6, 176,
+  658, 306, 1165, 706, 329, 6, 6, 1808, 2855, 28, 1696, 459,
+  6, 6, 1369, 2871, 2772, 2007, 1990, 1604, 2220, 2772, 975, 658,
+  306, 176, 176, 6, 6, 1165, 1274, 2875, 2900, 28, 766, 2067,
+  571, 6, 6, 1474, 1622, 1542, 2147, 2925, 2079, 306, 2950, 1524,
+  658, 6, 6, 1941, 516, 937, 176, 198, 2972, 306, 6, 6,
+  1078, 1585, 2772, 2370, 834, 2772, 2981, 6, 6, 306, 223, 176,
+  2177, 784, 516, 6, 6, 2987, 1006, 349, 306, 329, 306, 176,
+  658, 306, 306, 306, 306, 2996, 1361, 329, 838, 1165, 6, 6,
+  306, 306, 306, 306, 658, 554, 176, 2085, 3017, 1990, 6, 6,
+  3021, 1242, 459, 306, 329, 516, 3046, 778, 1753, 2504, 6, 6,
+  3062, 658, 1490, 176, 329, 329, 3081, 2772, 306, 2772, 2820, 3106,
+  79, 6, 6, 148, 306, 1941, 459, 3125, 658, 6, 6, 176,
+  766, 2950, 2950, 1614, 329, 1542, 2655, 2471, 2772, 2772, 1274, 1165,
+  2067, 542, 3150, 625, 306, 516, 6, 6, 3163, 1990, 3176, 6,
+  3180, 20, 658, 3201, 6, 6, 3218, 148, 176, 3224, 2709, 306,
+  6, 6, 2085, 516, 1490, 658, 1369, 3249, 329, 772, 1078, 3265,
+  176, 329, 6, 6, 306, 2709, 2709, 2709, 2709, 2709, 2709, 2709,
+  2709, 2709, 2709, 306, 571, 766, 299, 784, 2370, 2355, 3280, 3287,
+  455, 658, 459, 6, 6, 1170, 148, 2709, 2709, 2709, 2709, 2709,
+  2709, 1941, 2417, 2079, 658, 1474, 937, 2037, 3300, 1542, 516, 6,
+  6, 3312, 887, 1165, 658, 1321, 306, 329, 176, 571, 6, 6,
+  306, 658, 1696, 2772, 1990, 2147, 1941, 516, 6, 6, 778, 1490,
+  1274, 306, 2981, 6, 6, 1369, 3300, 2177, 658, 6, 6, 2085,
+  306, 459, 1808, 176, 387, 658, 2950, 2950, 729, 3332, 464, 3357,
+  3382, 306, 6, 6, 658, 1165, 516, 306, 625, 838, 3017, 3388,
+  2834, 2772, 2772, 2007, 1321, 1622, 176, 1078, 766, 2079, 6, 6,
+  3413, 3434, 1490, 3441, 658, 306, 1863, 3448, 2727, 6, 6, 3472,
+  3484, 3489, 2820, 516, 2471, 834, 571, 306, 2504, 6, 6, 1941,
+  1524, 459, 306, 459, 658, 329, 3499, 176, 1990, 3506, 1165, 6,
+  6, 3531, 306, 2709, 1542, 3106, 2079, 3556, 306, 658, 306, 6,
+  6, 1490, 1455, 3062, 3578, 6, 6, 2085, 3590, 508, 2772, 3046,
+  176, 6, 6, 1474, 2122, 658, 3609, 3125, 828, 306, 6, 6,
+  459, 2079, 766, 6, 3556, 2772, 516, 1490, 2043, 6, 6, 329,
+  2655, 3634, 658, 1828, 1274, 176, 2177, 1078, 3653, 6, 6, 3300,
+  306, 1663, 1490, 198, 658, 625, 1990, 6, 6, 1941, 306, 306,
+  1053, 176, 1165, 2950, 2950, 3678, 658, 329, 412, 834, 3695, 3720,
+  6, 6, 3739, 2344, 3764, 3780, 1361, 2747, 3062, 658, 176, 1369,
+  459, 3801, 6, 6, 766, 1490, 2772, 2772, 306, 306, 516, 1542,
+  2329, 658, 658, 3826, 3180, 3106, 176, 3218, 575, 2085, 6, 6,
+  3851, 306, 83, 3861, 3883, 1165, 838, 1622, 3176, 2727, 3908, 329,
+  459, 2855, 937, 658, 176, 6, 6, 3265, 766, 2079, 1990, 2147,
+  2355, 306, 658, 6, 6, 1614, 1242, 2471, 1941, 2820, 1369, 3917,
+  658, 279, 6, 6, 3934, 176, 3678, 1078, 459, 1490, 306, 306,
+  306, 306, 306, 306, 306, 306, 306, 306, 306, 784, 2950, 3942,
+  2772, 2772, 6, 6, 658, 329, 3961, 658, 516, 3312, 6, 6,
+  176, 772, 1474, 3985, 3994, 1490, 2504, 658, 658, 625, 4003, 459,
+  306, 6, 6, 2950, 1165, 766, 2085, 306, 2772, 2772, 2772, 3046,
+  1321, 3300, 3017, 2177, 3739, 4028, 6, 6, 329, 176, 2302, 1990,
+  306, 192, 1274, 658, 658, 2370, 1490, 4053, 1120, 6, 6, 916,
+  816, 766, 2079, 1165, 176, 459, 329, 329, 1941, 3609, 6, 6,
+  658, 658, 176, 1078, 1614, 261, 6, 6, 3678, 516, 1490, 1474,
+  2950, 2772, 2772, 834, 2855, 532, 176, 4078, 766, 658, 658, 4088,
+  3739, 6, 6, 306, 1721, 2370, 887, 2177, 176, 6, 6, 2147,
+  1217, 838, 2079, 306, 1490, 1990, 6, 6, 329, 329, 2471, 176,
+  658, 658, 2950, 2950, 3739, 459, 766, 3678, 794, 232, 571, 937,
+  306, 4096, 4119, 4128, 148, 4146, 619, 2037, 542, 1576, 382, 232,
+  4170, 35, 906, 176, 2620, 2370, 2471, 28, 1524, 4187, 3062, 658,
+  658, 594, 6, 6, 306, 1622, 28, 1941, 306, 306, 1490, 329,
+  625, 6, 6, 1078, 516, 2772, 2772, 571, 176, 2655, 2772, 2772,
+  1165, 2079, 306, 3917, 2504, 2085, 4210, 1274, 1165, 459, 6, 6,
+  658, 658, 794, 2709, 1490, 3300, 1095, 329, 329, 6, 6, 176,
+  2220, 766, 28, 3678, 3739, 658, 658, 571, 4229, 6, 6, 306,
+  1990, 1165, 148, 975, 1369, 3300, 1474, 766, 2996, 784, 1490, 6,
+  6, 816, 4254, 516, 658, 658, 176, 2950, 2950, 4272, 1941, 3180,
+  2855, 1078, 6, 6, 3017, 4282, 459, 4290, 2079, 2709, 3739, 1490,
+  2085, 306, 6, 6, 3300, 4308, 4330, 1490, 148, 3218, 4344, 2772,
+  2772, 658, 658, 6, 6, 625, 2727, 306, 176, 766, 2772, 2772,
+  1361, 20, 1490, 766, 6, 6, 329, 329, 3062, 459, 3125, 2177,
+  148, 2950, 2950, 2079, 1990, 3609, 6, 6, 1006, 1941, 4361, 766,
+  306, 306, 1441, 2820, 4369, 516, 729, 2438, 4373, 3046, 148, 1369,
+  306, 2417, 329, 1078, 306, 306, 4379, 6, 6, 1165, 306, 658,
+  4395, 3300, 1490, 1622, 2709, 329, 329, 766, 496, 6, 6, 306,
+  306, 459, 148, 2834, 176, 2085, 658, 658, 6, 6, 2147, 148,
+  2471, 1490, 3917, 2950, 2950, 625, 766, 198, 176, 1490, 464, 6,
+  6, 329, 2079, 4420, 4428, 1863, 816, 2370, 658, 658, 2504, 176,
+  516, 2855, 3739, 1990, 838, 329, 329, 306, 306, 6, 6, 306,
+  306, 1242, 3125, 1390, 1474, 176, 937, 2709, 459, 306, 6, 6,
+  1321, 2655, 1329, 2772, 2772, 1078, 1165, 329, 459, 1490, 6, 6,
+  148, 834, 2122, 766, 571, 1274, 3017, 3176, 4452, 3300, 2548, 4473,
+  2079, 6, 6, 658, 658, 766, 2257, 1369, 2950, 2329, 79, 3125,
+  1165, 329, 329, 3312, 2177, 6, 6, 1622, 636, 4498, 1941, 148,
+  3312, 1490, 784, 516, 6, 6, 3062, 766, 2855, 4519, 658, 658,
+  2996, 2925, 83, 3739, 459, 306, 306, 766, 6, 6, 4538, 1990,
+  3609, 1321, 1614, 306, 594, 306, 306, 625, 2147, 766, 2727, 2079,
+  6, 6, 382, 516, 1490, 2085, 1341, 2950, 329, 2950, 329, 2370,
+  1408, 658, 658, 3994, 162, 4546, 2677, 1524, 1078, 2177, 4565, 6,
+  6, 3046, 148, 4585, 67, 766, 2655, 2370, 1165, 306, 766, 2772,
+  2772, 6, 6, 658, 306, 3739, 2220, 3017, 3125, 1474, 975, 4603,
+  2329, 1490, 6, 6, 2772, 2772, 2504, 1622, 4620, 2987, 6, 6,
+  198, 2772, 6, 6, 6, 4628, 329, 1242, 6, 4344, 3312, 6,
+  4652, 4546, 676, 79, 6, 816, 6, 6, 4498, 455, 3780, 676,
+  108, 766, 4677, 516, 6, 6, 6, 6, 6, 554, 2249, 6,
+  6, 6, 4272, 6, 516, 4697, 3908, 988, 6, 2981, 1078, 4705,
+  6, 2855, 3739, 3312, 6, 2709, 306, 2220, 2177, 6, 6, 6,
+  6, 6, 6, 6, 2043, 6, 1787, 4713, 3739, 4727, 766, 6,
+  1242, 232, 4272, 4740, 232, 6, 53, 4760, 6, 2772, 6, 6,
+  3942, 6, 435, 3312, 3017, 4785, 4810, 1165, 2875, 3312, 382, 6,
+  6, 4834, 6, 4856, 6, 6, 4881, 148, 6, 6, 6, 1053,
+  6, 571, 148, 3934, 6, 2249, 516, 306, 816, 6, 6, 4146,
+  2085, 6, 148, 455, 4834, 6, 382, 6, 306, 766, 6, 4906,
+  261, 1120, 828, 4053, 4916, 6, 4713, 766, 3739, 6, 6, 3312,
+  4941, 766, 4941, 4785, 6, 4966, 4705, 6, 1361, 382, 6, 2417,
+  2129, 4677, 6, 4977, 176, 6, 123, 6, 223, 2177, 232, 2220,
+  6, 198, 364, 6, 6, 1144, 382, 571, 382, 325, 516, 2043,
+  35, 1212, 1299, 198, 3312, 766, 1663, 6, 6, 1390, 4996, 4713,
+  3312, 4652, 4713, 5017, 5020, 3312, 5042, 3382, 6, 6, 2900, 766,
+  5067, 329, 5092, 5109, 5129, 2950, 4473, 5138, 6, 5155, 329, 5180,
+  6, 6, 5196, 2981, 6, 2177, 329, 766, 5221, 6, 2370, 4170,
+  471, 232, 516, 5245, 3634, 5270, 516, 2057, 5287, 1025, 5309, 156,
+  1888, 5316, 1971, 766, 6, 2709, 3287, 794, 3590, 148, 329, 6,
+  6, 766, 4713, 766, 6, 1369, 3994, 6, 1474, 816, 6, 6,
+  619, 6, 232, 4096, 1524, 6, 1321, 1078, 6, 6, 6, 232,
+  6, 2655, 4128, 306, 435, 6, 6, 6, 6, 4308, 2147, 6,
+  4834, 6, 5341, 318, 2772, 5347, 1120, 2772, 496, 4713, 3312, 3312,
+  6, 516, 5372, 2220, 6, 5397, 5270, 53, 455, 1299, 2925, 382,
+  1369, 766, 5419, 148, 2113, 4119, 4096, 232, 148, 2747, 5092, 5309,
+  28, 5444, 5309, 4170, 2834, 5460, 464, 619, 3994, 5469, 325, 5490,
+  2871, 1006, 6, 6, 3434, 6, 6, 4713, 2772, 6, 6, 6,
+  619, 619, 619, 6, 3739, 2709, 5497, 306, 5502, 4713, 2220, 6,
+  4856, 4096, 6, 706, 6, 6, 6, 1165, 6, 6, 766, 5523,
+  329, 6, 6, 5548, 6, 5572, 4713, 5109, 2772, 192, 5597, 6,
+  2981, 3382, 5612, 3312, 1165, 6, 4652, 5637, 329, 6, 5658, 2241,
+  1165, 5683, 4881, 2570, 3046, 53, 2122, 4119, 3249, 2057, 471, 4834,
+  6, 6, 1455, 2772, 5397, 329, 1078, 766, 766, 5689, 6, 5701,
+  5714, 6, 148, 2177, 5739, 1078, 3861, 6, 766, 1672, 5751, 6,
+  1576, 5776, 306, 5784, 6, 6, 4677, 6, 306, 1888, 4856, 6,
+  2620, 816, 6, 2079, 619, 6, 6, 6, 6, 4128, 6, 382,
+  6, 5799, 2981, 6, 2772, 6, 2772, 6, 5806, 4713, 838, 6,
+  766, 2772, 387, 5597, 5597, 5597, 5597, 5597, 5597, 5597, 5597, 5597,
+  5597, 5597, 5597, 5597, 5597, 5597, 5597, 5637, 6, 6, 20, 240,
+  4916, 6, 1990, 6, 1144, 387, 6, 471, 5822, 35, 6, 198,
+  35, 306, 4119, 2122, 6, 5830, 2670, 2249, 6, 5845, 6, 2620,
+  318, 2620, 1971, 455, 5860, 6, 6, 3312, 6, 6, 2772, 5751,
+  329, 2900, 3312, 838, 4810, 1242, 387, 2855, 2092, 3017, 2996, 6,
+  459, 6, 5397, 4282, 6, 1441, 6, 5109, 766, 329, 4254, 766,
+  3441, 6, 766, 3312, 3312, 6, 3312, 329, 5109, 1341, 6, 6,
+  2875, 6, 1198, 382, 1198, 382, 1672, 5870, 3312, 5883, 1490, 5908,
+  2875, 5933, 3265, 766, 1787, 5017, 5397, 3312, 766, 5942, 329, 3312,
+  148, 2987, 3739, 329, 3017, 766, 3017, 3653, 3942, 2709, 3312, 5959,
+  2709, 2981, 766, 784, 3312, 329, 6, 1663, 4713, 3312, 2772, 5983,
+  5221, 6008, 636, 5637, 6033, 1990, 4810, 2220, 3590, 766, 4713, 3312,
+  4785, 766, 554, 306, 1120, 700, 3312, 5751, 2855, 2032, 766, 766,
+  6039, 2772, 6033, 6064, 2981, 1078, 459, 5138, 6, 6, 4713, 766,
+  4760, 1078, 766, 4810, 2772, 6, 3017, 5933, 6088, 766, 3312, 5959,
+  625, 6, 6113, 3312, 6138, 2709, 4373, 6151, 4713, 2504, 5806, 3046,
+  6176, 6201, 3434, 6219, 1787, 3312, 828, 6244, 3312, 4713, 5138, 916,
+  1990, 5870, 3017, 6269, 625, 766, 766, 766, 5270, 3312, 1474, 5933,
+  4652, 2709, 2981, 6, 3312, 2981, 5637, 6294, 6319, 3312, 5397, 329,
+  329, 6326, 5701, 3434, 329, 4713, 329, 2085, 766, 1159, 3312, 1863,
+  6, 329, 1165, 2834, 3312, 4697, 4652, 4713, 1441, 2981, 2220, 6,
+  5397, 1390, 3312, 6351, 3312, 1787, 6294, 2772, 6376, 5397, 2529, 5689,
+  5572, 2772, 4713, 766, 6395, 1990, 1432, 5845, 6420, 6445, 5637, 6470,
+  1990, 6, 766, 5612, 6495, 2177, 2709, 329, 766, 5397, 4344, 6520,
+  3312, 2772, 2772, 6, 4652, 2772, 2772, 2709, 4713, 4966, 766, 4713,
+  3312, 5658, 838, 766, 6523, 6548, 3312, 6566, 1622, 6495, 329, 6,
+  3312, 6583, 4713, 6606, 766, 516, 223, 3218, 28, 5316, 2709, 364,
+  459, 816, 571, 1212, 4146, 198, 4810, 3312, 1474, 3590, 2709, 2074,
+  1078, 329, 6614, 2043, 2772, 5109, 4473, 5751, 6621, 6, 571, 3017,
+  3312, 6643, 4713, 5397, 4028, 1622, 6, 329, 5372, 3312, 5397, 766,
+  2834, 4713, 6668, 766, 4713, 516, 3312, 3590, 4652, 3312, 4713, 2655,
+  1474, 329, 5983, 5637, 2504, 6693, 6693, 329, 306, 2177, 2950, 3017,
+  6269, 3017, 6, 4652, 2981, 6703, 5714, 83, 3312, 6, 6, 4713,
+  5883, 6668, 1955, 6723, 1622, 5109, 5502, 1432, 2772, 3312, 4620, 1990,
+  3017, 279, 1990, 3312, 766, 3590, 766, 6727, 5637, 2655, 2772, 5109,
+  6008, 1787, 766, 4713, 6643, 766, 3312, 2772, 766, 4652, 2147, 329,
+  3312, 3312, 2177, 6, 5109, 5739, 5372, 3300, 1078, 5109, 108, 5870,
+  3180, 6752, 766, 329, 2772, 766, 3609, 5109, 5109, 1165, 3312, 6774,
+  5739, 766, 6, 834, 2875, 3609, 3017, 5196, 5497, 6703, 2772, 3046,
+  3441, 3312, 5883, 5020, 329, 5109, 5739, 4713, 2996, 5572, 3017, 329,
+  2655, 1078, 5372, 5870, 3441, 6693, 6799, 1474, 261, 329, 1990, 3312,
+  4713, 636, 5109, 6824, 6420, 766, 6849, 5572, 6, 5883, 6, 6,
+  6862, 6693, 2772, 2772, 329, 3739, 2177, 1787, 2032, 6138, 3017, 766,
+  4713, 3312, 4344, 6887, 387, 6912, 700, 3312, 329, 6, 5870, 2950,
+  6934, 329, 4078, 5497, 6959, 3287, 2875, 6, 4713, 766, 3017, 766,
+  766, 6693, 3312, 5372, 4344, 329, 329, 6294, 766, 3017, 5683, 6566,
+  5739, 329, 700, 2709, 5502, 6, 3017, 329, 5751, 766, 4713, 3312,
+  766, 5497, 2709, 5397, 5372, 3312, 6981, 6, 7006, 1165, 4652, 3312,
+  3312, 329, 766, 3312, 784, 2981, 4652, 3017, 3312, 5637, 766, 2504,
+  766, 784, 3312, 636, 1787, 5109, 3312, 1341, 5109, 3739, 5860, 4395,
+  2981, 1622, 2709, 7012, 766, 4906, 3312, 766, 766, 766, 2772, 5129,
+  2981, 1078, 5372, 2950, 2370, 2709, 5658, 7033, 6088, 3312, 6, 4652,
+  766, 838, 3312, 329, 7058, 1622, 6326, 3017, 2241, 766, 6, 5883,
+  766, 2772, 3287, 5196, 306, 1622, 148, 1078, 1622, 4713, 4713, 2355,
+  3312, 4652, 2950, 6, 1078, 3531, 329, 3382, 6693, 5689, 2772, 6887,
+  329, 3287, 5933, 3312, 7069, 5658, 2772, 5714, 7093, 7115, 3312, 4620,
+  7140, 1863, 5397, 2772, 7165, 387, 1990, 3062, 3942, 329, 2177, 1787,
+  2709, 6959, 6, 2709, 329, 3312, 7184, 5502, 306, 6138, 6693, 5347,
+  7199, 6138, 766, 7058, 5714, 4713, 3441, 4498, 2981, 3312, 5397, 7216,
+  5572, 6887, 6, 2772, 2417, 6, 3312, 766, 4941, 6, 1482, 2438,
+  766, 6693, 5109, 2772, 2981, 329, 329, 729, 766, 4713, 3312, 784,
+  306, 2709, 5155, 5572, 5109, 2950, 1787, 5397, 7241, 2855, 6, 306,
+  3434, 3312, 838, 148, 766, 571, 3312, 2772, 5129, 306, 6, 2981,
+  6693, 2177, 6, 4652, 329, 2709, 2950, 5109, 2772, 1474, 1474, 1078,
+  3017, 7260, 4810, 3017, 5883, 7285, 7310, 5637, 3312, 766, 329, 7335,
+  516, 3312, 4705, 766, 329, 5397, 329, 4344, 6445, 5942, 7358, 2772,
+  2709, 784, 7383, 766, 329, 3312, 2220, 4713, 5739, 7358, 329, 6727,
+  1078, 329, 3017, 5658, 2772, 5751, 5397, 766, 7408, 766, 3312, 6703,
+  3312, 5612, 2772, 4565, 4652, 1032, 1863, 459, 2241, 2772, 3312, 6693,
+  6294, 306, 2584, 4652, 2074, 7433, 4713, 148, 2370, 3300, 2772, 7444,
+  516, 5739, 516, 5502, 4785, 4254, 1165, 2043, 2996, 3739, 1242, 4760,
+  636, 4713, 2834, 5714, 7408, 7453, 6668, 4652, 329, 2370, 1274, 1990,
+  7472, 2981, 2834, 1990, 1165, 5180, 7497, 7069, 306, 4652, 329, 2981,
+  6, 329, 3312, 5637, 6693, 2772, 329, 306, 766, 766, 7115, 5109,
+  6693, 2981, 1165, 2220, 766, 4713, 7241, 7522, 766, 6294, 7547, 2370,
+  766, 5784, 7572, 6887, 3312, 2772, 7597, 2220, 5739, 6, 5109, 4760,
+  3312, 7613, 6, 6, 6, 766, 148, 766, 7638, 5372, 6, 766,
+  5502, 1990, 5109, 3312, 5739, 1990, 3312, 700, 7663, 3312, 1032, 7613,
+  2709, 828, 5109, 2709, 766, 766, 4344, 3017, 329, 329, 7433, 7444,
+  2177, 1474, 4713, 4652, 766, 508, 306, 766, 329, 7670, 516, 2981,
+  1828, 4713, 6752, 3300, 329, 2772, 2855, 3739, 6, 7069, 2772, 5372,
+  6, 3739, 2981, 4713, 1622, 2471, 148, 148, 3017, 329, 2875, 3017,
+  3312, 7695, 5109, 1329, 1095, 2981, 5347, 766, 5870, 3506, 1032, 2996,
+  3506, 3312, 5180, 6621, 6, 7703, 4652, 1165, 2772, 766, 5572, 7728,
+  329, 766, 1159, 4652, 3441, 5497, 3312, 1663, 766, 6693, 7753, 2950,
+  1787, 766, 4652, 2241, 3312, 5572, 329, 2834, 2981, 2795, 4713, 3312,
+  2981, 3017, 7778, 2709, 6548, 3312, 5714, 3312, 3934, 5397, 6420, 2277,
+  4373, 7803, 2772, 3218, 4713, 5637, 4713, 5196, 4713, 329, 6495, 3312,
+  5959, 516, 1474, 766, 4254, 7819, 306, 5714, 3312, 3017, 766, 1547,
+  828, 6138, 3312, 4810, 3017, 6887, 148, 4369, 2772, 1622, 4713, 5751,
+  2981, 7826, 2220, 766, 2709, 1120, 766, 7846, 6, 5637, 766, 7453,
+  2772, 1622, 766, 766, 3312, 329, 3312, 1032, 766, 5109, 3180, 766,
+  766, 5637, 329, 766, 5739, 5397, 766, 784, 5714, 2709, 3312, 766,
+  1165, 329, 3287, 6395, 2795, 3312, 5751, 6, 4713, 329, 4713, 7871,
+  3312, 6934, 496, 3312, 2772, 1863, 306, 4760, 7896, 2684, 6643, 1165,
+  1078, 1787, 329, 5739, 5612, 3312, 329, 766, 306, 6395, 2981, 3441,
+  766, 3382, 5714, 766, 5830, 7921, 3017, 5017, 784, 1622, 7942, 1622,
+  306, 766, 3312, 3312, 766, 2996, 306, 5502, 1622, 4713, 1990, 5372,
+  1990, 4713, 329, 1622, 7260, 4652, 3312, 4705, 2079, 766, 329, 7638,
+  5397, 2772, 4713, 1165, 459, 7949, 5397, 3312, 5372, 1165, 2709, 192,
+  3489, 4941, 5502, 3017, 2981, 7522, 2981, 329, 7956, 329, 2370, 2772,
+  2177, 329, 766, 306, 329, 329, 2772, 329, 329, 3801, 3312, 1490,
+  1078, 2709, 7961, 1990, 7241, 6, 766, 1421, 306, 329, 7978, 4713,
+  3312, 2772, 766, 329, 766, 148, 7184, 3017, 2709, 5959, 329, 8003,
+  8026, 3780, 5109, 2220, 387, 766, 1250, 2855, 279, 4966, 329, 329,
+  2950, 4810, 4652, 2981, 329, 3300, 766, 3312, 2772, 766, 5933, 3300,
+  5397, 6, 1165, 2981, 329, 3017, 2772, 516, 2177, 2709, 1863, 766,
+  1165, 329, 3017, 5883, 329, 7433, 5751, 2177, 7383, 4713, 5109, 4810,
+  8051, 3017, 1863, 1787, 2855, 8059, 5751, 766, 8080, 5883, 6, 1250,
+  766, 956, 5933, 329, 2727, 8085, 658, 5397, 1441, 329, 8110, 5870,
+  6693, 6, 6, 5497, 2177, 4373, 2772, 4344, 2709, 8135, 5683, 2900,
+  306, 6, 4713, 766, 4652, 5933, 1622, 6495, 516, 1165, 4713, 6294,
+  8141, 329, 5689, 766, 766, 1188, 6520, 306, 8166, 8189, 4713, 7165,
+  4713, 1888, 7522, 6912, 4473, 4713, 5637, 2471, 1663, 7260, 4519, 1242,
+  2981, 1217, 3312, 3017, 2772, 329, 3312, 4254, 5714, 4652, 3312, 5155,
+  1622, 3312, 5714, 4713, 1165, 3081, 7433, 3312, 2981, 5372, 329, 7058,
+  6, 5372, 766, 766, 2987, 3312, 1242, 766, 3021, 7358, 6, 5397,
+  766, 1622, 2950, 766, 6, 766, 1165, 8214, 1955, 6693, 2772, 5714,
+  1120, 766, 4810, 4373, 5109, 4713, 306, 3312, 6, 766, 784, 2471,
+  306, 2772, 3312, 6, 5658, 4713, 3312, 329, 8234, 2655, 6176, 3017,
+  1863, 2981, 6151, 8085, 5658, 636, 1787, 766, 7942, 3609, 4652, 2855,
+  329, 4966, 1622, 3312, 3312, 2950, 1165, 5751, 3861, 5714, 3312, 1622,
+  1490, 2709, 3434, 4713, 5714, 2820, 1524, 2996, 5689, 5109, 2772, 2529,
+  3441, 3861, 2277, 5572, 8246, 766, 3312, 329, 766, 8258, 5502, 4652,
+  8283, 4705, 329, 2709, 3908, 4254, 2950, 329, 3017, 3312, 8308, 8333,
+  2329, 766, 6, 2471, 2220, 766, 1165, 3312, 2834, 3609, 329, 5714,
+  7896, 5372, 5372, 459, 6862, 2043, 5502, 3312, 766, 329, 1990, 5870,
+  6294, 1159, 6151, 3312, 554, 7433, 766, 766, 8189, 306, 5109, 7310,
+  4760, 2875, 2220, 2772, 1078, 7260, 5739, 6693, 766, 5739, 6470, 1217,
+  3312, 6668, 6, 5637, 5870, 766, 1341, 3312, 329, 329, 5502, 2655,
+  1441, 2043, 766, 1990, 3312, 2855, 2709, 5502, 8026, 4308, 2772, 5548,
+  516, 5714, 2727, 6138, 8358, 7058, 5397, 2996, 7069, 4652, 6, 5612,
+  1828, 5372, 5714, 4652, 6, 6, 2709, 772, 766, 2709, 3312, 329,
+  329, 766, 3312, 4713, 6, 6, 6548, 2981, 6326, 5067, 3441, 4713,
+  148, 329, 1622, 6, 5109, 4810, 2220, 1165, 766, 6138, 3017, 3312,
+  2709, 2996, 6, 3312, 1490, 1474, 8361, 766, 1524, 3017, 329, 766,
+  329, 7260, 784, 2772, 4254, 5830, 3609, 766, 8189, 1078, 1490, 2772,
+  4229, 3441, 2200, 7383, 3861, 3739, 8386, 5129, 4652, 5870, 3312, 4760,
+  3312, 329, 5372, 6887, 329, 766, 5397, 4705, 8394, 6, 766, 4966,
+  6, 2772, 3017, 5372, 766, 306, 3312, 1120, 4344, 7803, 5689, 1165,
+  2177, 5397, 3434, 5020, 1863, 6, 1078, 1474, 2996, 4344, 3312, 459,
+  3312, 329, 7638, 2855, 3017, 148, 4652, 5372, 4713, 2981, 329, 464,
+  784, 594, 5714, 3942, 3312, 1329, 2875, 6643, 4254, 766, 6774, 1341,
+  1622, 4713, 387, 329, 6151, 306, 5372, 2370, 766, 5196, 766, 766,
+  2772, 8403, 766, 4373, 5714, 5397, 741, 6606, 3312, 1165, 4652, 3609,
+  3017, 6294, 3506, 8420, 3312, 2709, 766, 1078, 3531, 8445, 8469, 2177,
+  766, 8085, 1863, 3861, 387, 5109, 766, 766, 5397, 3312, 2875, 3312,
+  6606, 7058, 784, 1941, 766, 3312, 4053, 7285, 532, 2177, 5572, 2788,
+  8478, 6, 5497, 8051, 2772, 2709, 3653, 766, 6, 2709, 7069, 1990,
+  6, 148, 5689, 329, 329, 2981, 2709, 1078, 3312, 329, 1622, 4713,
+  2981, 3312, 3441, 2981, 766, 5372, 1474, 306, 5497, 3861, 766, 3017,
+  1078, 766, 2074, 3312, 306, 306, 3312, 8502, 2981, 5397, 5658, 5372,
+  1170, 766, 816, 5109, 3312, 8445, 4713, 6, 3441, 7260, 5714, 4810,
+  329, 3312, 7058, 306, 2996, 6693, 3590, 5959, 7058, 5883, 5397, 329,
+  5751, 4713, 6, 3312, 6, 6420, 7638, 4713, 766, 4810, 766, 3312,
+  387, 2177, 2981, 459, 5372, 766, 329, 3218, 3312, 6445, 5883, 3441,
+  4282, 6, 7522, 5497, 3312, 8386, 4713, 3312, 3218, 5883, 148, 6,
+  3300, 4713, 2772, 3312, 4713, 5572, 3312, 5883, 329, 329, 3312, 1990,
+  3312, 6693, 5109, 6934, 3017, 6693, 6445, 2987, 1622, 329, 5347, 766,
+  4713, 766, 4713, 4282, 5751, 6693, 1863, 4713, 834, 329, 1622, 4785,
+  3312, 4713, 6, 1165, 6693, 4713, 1165, 2709, 6033, 5714, 3017, 2709,
+  3300, 2772, 2855, 5714, 2709, 6, 3017, 2177, 3312, 6, 4713, 636,
+  4810, 3312, 329, 8166, 306, 3176, 3441, 3312, 6294, 8527, 3312, 2709,
+  766, 6693, 306, 766, 2987, 4713, 3312, 3017, 7310, 4713, 3434, 7033,
+  766, 4330, 3062, 828, 6693, 766, 6, 1165, 5221, 4652, 6008, 3312,
+  516, 3017, 329, 329, 2855, 4652, 2220, 5109, 8551, 766, 5397, 3017,
+  6, 6, 6693, 828, 3312, 5572, 3312, 329, 8576, 6693, 1863, 3312,
+  8595, 6862, 4713, 766, 4652, 1421, 3441, 1120, 6495, 6294, 6, 4713,
+  3312, 2655, 2772, 766, 329, 2875, 3180, 329, 3312, 766, 3312, 1078,
+  329, 3489, 4254, 148, 435, 1165, 3017, 766, 766, 329, 8620, 5347,
+  766, 838, 1120, 5502, 2032, 2772, 3312, 6138, 2079, 5397, 784, 2772,
+  3312, 784, 3312, 3312, 8445, 1828, 329, 2834, 8645, 5689, 4713, 1622,
+  4344, 766, 3312, 5372, 3312, 700, 4713, 6, 766, 6668, 766, 8670,
+  435, 329, 7140, 5502, 2709, 3312, 329, 459, 3312, 3312, 2981, 4713,
+  3312, 6, 3312, 4713, 4652, 2950, 3826, 1390, 5883, 766, 4395, 3312,
+  508, 4290, 4713, 2996, 3312, 766, 766, 2772, 6376, 3312, 8682, 6,
+  6703, 2987, 5109, 5196, 3531, 1787, 3017, 766, 306, 3017, 5658, 2772,
+  516, 1474, 3312, 3021, 329, 766, 3218, 4705, 1078, 3017, 8699, 766,
+  766, 516, 4810, 6, 1474, 6, 329, 3764, 1888, 7058, 8705, 3312,
+  2177, 766, 2772, 625, 1078, 5469, 5372, 3312, 6, 5658, 329, 6,
+  2772, 2855, 3312, 2709, 1078, 329, 8730, 8753, 3441, 7058, 5372, 5739,
+  3531, 4652, 6294, 1078, 6470, 766, 6420, 2996, 766, 2772, 2772, 1474,
+  766, 6, 306, 3017, 329, 8766, 8026, 8787, 1490, 766, 766, 2996,
+  464, 2772, 5180, 8551, 2981, 5612, 4628, 6566, 4713, 1787, 1863, 3017,
+  3312, 2772, 766, 766, 5397, 4254, 3312, 5637, 3312, 329, 3764, 766,
+  4565, 784, 766, 5497, 766, 2709, 766, 4344, 1622, 5109, 766, 766,
+  1165, 8502, 306, 4652, 6351, 7522, 5372, 3312, 8793, 5523, 8818, 766,
+  3017, 1361, 5155, 306, 6, 8843, 4713, 8864, 700, 4713, 3312, 6,
+  2772, 6420, 1490, 1787, 329, 3312, 8884, 766, 3506, 3312, 6, 306,
+  766, 766, 4713, 1078, 1078, 516, 3017, 3312, 516, 8903, 784, 1120,
+  1474, 2463, 6, 766, 6, 6176, 2772, 766, 2950, 6, 2177, 4373,
+  4713, 6693, 6326, 2996, 6, 3287, 6, 329, 516, 2032, 8928, 5612,
+  5020, 329, 516, 5372, 4373, 1078, 2220, 1990, 7310, 5870, 6, 3312,
+  7058, 8933, 6, 784, 3739, 5612, 3312, 1990, 8940, 7703, 6, 766,
+  306, 5017, 3312, 3739, 516, 2981, 6, 5714, 5714, 2855, 3046, 8961,
+  766, 4810, 3382, 8986, 9005, 3312, 2709, 1078, 2772, 2772, 2950, 3017,
+  5109, 7453, 6, 766, 516, 4713, 7597, 2177, 2772, 9030, 766, 306,
+  2950, 766, 766, 6, 1441, 7199, 2772, 6326, 8864, 3312, 306, 3017,
+  7012, 3312, 4760, 306, 329, 4760, 3312, 5372, 838, 306, 192, 1828,
+  4713, 306, 5883, 2709, 3312, 9055, 4369, 5714, 9080, 3312, 1217, 2709,
+  2855, 3300, 6, 329, 1474, 9090, 7260, 8884, 6138, 766, 3312, 2200,
+  329, 766, 766, 766, 28, 6887, 4713, 2855, 1955, 4713, 2981, 838,
+  3506, 3312, 6, 4254, 5397, 2220, 3556, 7165, 2981, 20, 5658, 2772,
+  1828, 2996, 6643, 5959, 3764, 6824, 2177, 2855, 1165, 2655, 9115, 3312,
+  5806, 766, 766, 3017, 4713, 2177, 6693, 828, 6, 2620, 5714, 1990,
+  5983, 8682, 6351, 5397, 6862, 2548, 5372, 4760, 6008, 2772, 3634, 6420,
+  5572, 3017, 9140, 5180, 5830, 2950, 4254, 766, 5017, 1828, 459, 329,
+  3312, 5714, 3017, 3180, 6703, 2772, 2177, 5017, 3720, 6606, 6693, 6294,
+  7613, 5497, 9157, 766, 4713, 6, 3312, 2981, 459, 1369, 5497, 2772,
+  766, 2772, 5612, 2875, 3017, 3017, 7846, 2709, 3312, 1474, 3312, 9166,
+  5572, 4881, 4713, 5714, 455, 6849, 5397, 3506, 4254, 3280, 6566, 766,
+  5497, 784, 1990, 4810, 5637, 5701, 306, 766, 6064, 4713, 2177, 4369,
+  329, 329, 3312, 459, 3739, 5637, 6887, 4369, 4713, 1078, 3176, 5714,
+  5637, 766, 6693, 5572, 5714, 1990, 4652, 9191, 4652, 3312, 2855, 7358,
+  2772, 4713, 6, 516, 3312, 6643, 3312, 766, 766, 3506, 7285, 2177,
+  5372, 7638, 4713, 4713, 329, 3017, 8903, 5806, 7942, 4652, 3312, 4713,
+  3312, 459, 4713, 1120, 4713, 6420, 6693, 2709, 5372, 5637, 5933, 6445,
+  1622, 5830, 1622, 2606, 1078, 1341, 508, 3017, 9055, 4565, 6351, 625,
+  542, 3312, 5637, 6693, 329, 6693, 4760, 870, 329, 3017, 329, 1165,
+  4254, 3312, 1746, 3017, 766, 329, 329, 766, 766, 766, 3017, 4705,
+  625, 1217, 766, 516, 3489, 2709, 2772, 4713, 6, 5714, 8214, 3312,
+  3017, 3312, 2177, 2772, 6, 2950, 766, 3861, 459, 1787, 3312, 1622,
+  3739, 3441, 3312, 2981, 3312, 3312, 2772, 2709, 554, 2085, 766, 2709,
+  5883, 5502, 3312, 6862, 1787, 766, 3312, 2772, 329, 2709, 2709, 2855,
+  766, 1165, 4652, 6, 5397, 3312, 306, 2855, 2950, 6420, 3017, 1787,
+  5109, 1329, 766, 3312, 6495, 2709, 766, 9206, 329, 4652, 3312, 2772,
+  1490, 329, 9231, 766, 834, 766, 3017, 3017, 700, 1863, 9256, 1242,
+  8080, 571, 2772, 766, 4713, 5714, 9278, 1165, 2177, 4652, 3017, 3017,
+  3739, 9303, 6824, 4713, 766, 2177, 3531, 3287, 7012, 3312, 3218, 7241,
+  6445, 2177, 6, 2074, 4705, 6, 5347, 516, 3312, 2950, 2709, 3017,
+  3312, 2177, 5637, 3312, 563, 554, 2996, 6, 4713, 6, 1165, 9308,
+  828, 5444, 3017, 6039, 3312, 306, 766, 6887, 2772, 4713, 658, 2171,
+  5397, 834, 329, 554, 2709, 6294, 6693, 387, 6693, 6219, 6, 9333,
+  1863, 329, 2177, 9351, 766, 4810, 2855, 6693, 1622, 3017, 1990, 6693,
+  1474, 192, 3312, 766, 8843, 3249, 6, 766, 6294, 329, 2981, 766,
+  6693, 5751, 5860, 1490, 5109, 766, 2709, 4713, 3312, 6693, 5701, 6693,
+  6, 5397, 2329, 5572, 6, 3300, 329, 4652, 766, 279, 329, 7165,
+  1863, 625, 3441, 2981, 2772, 7547, 3312, 6376, 5196, 2772, 9375, 5109,
+  4713, 6294, 3017, 2177, 6, 5637, 2772, 3017, 3017, 2772, 766, 2314,
+  329, 3590, 2772, 1165, 5612, 1622, 5372, 9393, 8705, 9418, 6, 766,
+  7819, 2079, 6548, 329, 5658, 2772, 3218, 2772, 1622, 6, 2855, 2875,
+  3739, 766, 766, 2772, 6887, 329, 4941, 2241, 1329, 329, 2709, 329,
+  575, 6, 766, 3312, 6326, 1863, 1165, 4652, 6008, 329, 2875, 5739,
+  7778, 2981, 67, 6, 9443, 7165, 7433, 3312, 6, 1863, 1369, 2438,
+  5017, 4713, 148, 9140, 6824, 5714, 1990, 329, 329, 3739, 2177, 3312,
+  5372, 3764, 4713, 1787, 2079, 4652, 5739, 2171, 9206, 2855, 3826, 3017,
+  3312, 766, 329, 6606, 3312, 306, 1078, 2996, 2981, 4713, 766, 3017,
+  784, 2950, 1787, 729, 1787, 3300, 5129, 4652, 516, 7613, 6138, 766,
+  766, 2772, 329, 4810, 3994, 329, 4785, 306, 3017, 5372, 5714, 306,
+  766, 3908, 459, 2772, 4652, 2504, 5572, 2709, 1622, 9308, 3287, 3441,
+  2772, 3312, 2655, 766, 766, 329, 5714, 3441, 5830, 329, 3312, 6,
+  3017, 6, 2438, 5347, 329, 9468, 1474, 7444, 6319, 2438, 4713, 329,
+  766, 67, 3017, 5196, 9308, 4713, 5397, 2177, 3434, 3609, 4652, 5637,
+  594, 2709, 1341, 5637, 5637, 6934, 20, 2950, 4713, 9486, 766, 6752,
+  6774, 1828, 1663, 2772, 828, 3312, 9502, 1863, 9519, 625, 1432, 5397,
+  5658, 3300, 766, 9090, 5017, 766, 2709, 7522, 329, 1990, 4760, 3017,
+  2772, 4565, 3017, 2177, 3017, 5572, 5959, 1217, 5397, 5658, 1441, 516,
+  3312, 766, 329, 6, 7335, 9536, 9140, 9545, 4628, 3017, 5109, 4713,
+  700, 3312, 464, 766, 1032, 3506, 3312, 4713, 2772, 5347, 6, 2855,
+  459, 306, 329, 3312, 766, 1622, 766, 459, 1078, 6, 329, 4760,
+  9556, 3413, 6, 4652, 5397, 3312, 6, 766, 3312, 2177, 2981, 7497,
+  329, 554, 5870, 5883, 5502, 766, 6445, 329, 2772, 766, 2981, 1165,
+  6, 3441, 2620, 9575, 1165, 6548, 6151, 9594, 2709, 1787, 766, 766,
+  3312, 3441, 8502, 2085, 5689, 2981, 3312, 306, 6326, 1474, 459, 766,
+  828, 5689, 6, 306, 3434, 2855, 1622, 3312, 516, 1559, 766, 6668,
+  6, 516, 4705, 3312, 4760, 6294, 6, 5751, 329, 2177, 2772, 6824,
+  329, 3441, 5109, 5497, 7522, 6, 1078, 6693, 329, 2241, 3312, 1622,
+  2772, 863, 766, 3017, 6693, 4369, 306, 2950, 3312, 306, 5221, 5689,
+  1990, 766, 2709, 9619, 2177, 5739, 784, 6693, 1622, 3312, 5372, 3434,
+  1078, 6, 1250, 329, 2438, 1078, 2972, 3441, 4361, 3312, 3081, 4254,
+  3312, 1078, 4254, 9629, 2241, 5739, 4713, 3382, 2772, 3312, 3434, 4254,
+  329, 3312, 5372, 2709, 5372, 3312, 5372, 5372, 6326, 766, 2392, 3017,
+  516, 4713, 2772, 766, 5397, 828, 4713, 5372, 5739, 148, 329, 3017,
+  6151, 5933, 9654, 766, 3312, 2981, 5870, 7058, 766, 8551, 3312, 9654,
+  6, 9669, 766, 5637, 516, 3017, 329, 6, 306, 3312, 2709, 2709,
+  766, 2504, 6934, 5751, 5109, 2709, 2438, 3312, 6693, 2772, 2079, 3531,
+  4498, 7058, 6934, 2772, 5714, 5637, 3017, 4713, 2981, 329, 3312, 2772,
+  3017, 784, 3590, 3312, 4652, 2772, 6, 3312, 6, 816, 4713, 2709,
+  6, 306, 6420, 3017, 5739, 329, 6, 4713, 329, 1990, 1622, 387,
+  1828, 7310, 2772, 6008, 6693, 8026, 7358, 2772, 766, 8705, 306, 459,
+  2504, 2709, 1120, 766, 6376, 5959, 766, 329, 4713, 766, 700, 1622,
+  9694, 9694, 459, 279, 3312, 6, 7069, 3312, 5497, 2950, 2834, 306,
+  6693, 766, 3312, 1441, 3312, 6, 2981, 9333, 8026, 1165, 1474, 329,
+  7058, 4369, 2709, 3917, 9669, 5751, 5287, 2177, 6294, 4369, 766, 3312,
+  2329, 306, 766, 1078, 8682, 2772, 5739, 4713, 5637, 5572, 2709, 2981,
+  2981, 3312, 1078, 7165, 766, 1006, 916, 2085, 5572, 387, 2370, 5714,
+  9090, 2471, 784, 4713, 6566, 1078, 6693, 766, 2709, 766, 2996, 5870,
+  2981, 5502, 766, 1078, 2996, 5983, 5109, 2772, 2981, 8361, 1078, 2772,
+  766, 6, 516, 5109, 5221, 5883, 8386, 516, 1990, 3739, 3312, 176,
+  7260, 3861, 766, 5109, 1078, 6, 5714, 4713, 4713, 306, 9418, 2855,
+  459, 2950, 2875, 2092, 766, 8110, 2709, 3609, 4713, 766, 2177, 3312,
+  766, 6862, 6, 766, 5689, 1490, 766, 329, 6138, 4344, 766, 4713,
+  329, 1078, 6912, 5196, 2996, 387, 1863, 766, 6420, 2772, 508, 4705,
+  766, 2277, 8420, 3312, 6583, 4254, 7260, 6, 2177, 455, 571, 2220,
+  2709, 1490, 4810, 6, 3413, 6693, 5109, 192, 766, 5572, 306, 4344,
+  5637, 766, 5109, 3312, 6887, 2772, 6, 5714, 2177, 3441, 8234, 1863,
+  3017, 784, 329, 6693, 766, 5883, 6219, 5637, 766, 5739, 5572, 2950,
+  4290, 2855, 516, 3312, 7896, 8551, 4713, 9519, 766, 6, 4344, 3312,
+  516, 828, 3017, 5739, 8502, 306, 766, 6445, 2950, 2504, 3489, 5109,
+  3017, 5109, 9698, 5883, 7012, 2875, 6495, 2772, 766, 4652, 766, 3764,
+  329, 6326, 6723, 3312, 4713, 4810, 3300, 3017, 3312, 1863, 329, 4628,
+  6, 5109, 1159, 5714, 3312, 8699, 3312, 306, 2709, 4254, 329, 5109,
+  3312, 6151, 9536, 459, 3312, 329, 5612, 5572, 3312, 2772, 6008, 1274,
+  6, 9723, 7069, 5751, 4473, 6138, 766, 2220, 4966, 1474, 4941, 3312,
+  5372, 4713, 4713, 3312, 3017, 7058, 8214, 1474, 6752, 5883, 2220, 1165,
+  766, 1078, 306, 2177, 6, 6, 4713, 5714, 2772, 7358, 1622, 6799,
+  5109, 6, 916, 4810, 3441, 2709, 3312, 3312, 766, 4713, 5751, 1120,
+  6244, 3176, 67, 5155, 6, 4229, 2177, 2177, 7335, 459, 4810, 7241,
+  5109, 9740, 3312, 2996, 5658, 766, 2987, 766, 8527, 5689, 4308, 8551,
+  3300, 306, 1787, 6, 387, 1828, 2772, 6643, 766, 6176, 6566, 3312,
+  2177, 329, 2709, 625, 1078, 2871, 2709, 5221, 1421, 766, 766, 3017,
+  329, 1078, 8551, 4785, 4760, 766, 3017, 5933, 3017, 1863, 3312, 5739,
+  6, 9055, 7069, 6319, 4713, 148, 5799, 1622, 516, 3312, 3312, 329,
+  8903, 3484, 7310, 5739, 6, 9375, 3300, 5751, 5129, 6176, 7728, 4705,
+  4713, 766, 3312, 6693, 329, 3017, 2177, 5714, 8358, 9629, 5397, 3312,
+  6, 1863, 3312, 1490, 6693, 4713, 766, 5714, 4713, 766, 3312, 6088,
+  6693, 3312, 5196, 3312, 766, 5109, 3300, 329, 2772, 9753, 7165, 3312,
+  4713, 329, 2875, 766, 5739, 3312, 4713, 1165, 306, 784, 329, 2772,
+  2772, 3489, 6693, 5784, 8986, 6294, 4652, 3312, 1663, 3739, 3017, 1078,
+  2950, 4652, 1990, 6326, 8051, 2996, 4810, 1622, 7140, 3017, 3739, 766,
+  329, 3312, 4713, 2772, 8903, 1499, 7522, 2709, 3312, 1078, 5637, 7695,
+  6, 9055, 766, 148, 8420, 1159, 5714, 5109, 329, 2438, 8787, 3312,
+  1622, 7453, 6, 5180, 7241, 5714, 2177, 2709, 784, 5397, 5372, 6824,
+  6008, 5983, 2772, 8283, 5372, 6, 4713, 5933, 1006, 3312, 1955, 3739,
+  6, 5714, 7358, 6643, 387, 7069, 2329, 329, 5658, 5017, 2875, 4652,
+  766, 5776, 6039, 2709, 2772, 9778, 4713, 1490, 2171, 8141, 3017, 766,
+  1955, 1828, 3312, 2772, 863, 3312, 5109, 1863, 766, 516, 329, 5637,
+  3312, 6138, 5739, 766, 2322, 729, 6138, 5714, 3484, 329, 6693, 3413,
+  3312, 3861, 4254, 2177, 306, 148, 3312, 3441, 766, 7165, 3312, 3312,
+  2981, 5497, 5689, 2875, 766, 2950, 5020, 9443, 6693, 2996, 766, 9790,
+  2220, 5196, 2834, 5502, 4713, 625, 2772, 148, 7572, 5739, 2981, 1941,
+  3312, 2981, 4652, 9351, 3312, 5397, 6, 5497, 5397, 2772, 5959, 3017,
+  2727, 7058, 784, 2950, 7453, 1622, 9815, 6693, 6934, 306, 3695, 3017,
+  1078, 5109, 2177, 5714, 2177, 5714, 5933, 2772, 3312, 766, 6703, 459,
+  5933, 387, 2709, 7358, 2981, 329, 766, 4713, 7358, 766, 2772, 306,
+  784, 329, 2709, 6, 1159, 2772, 3017, 2772, 5397, 3017, 9840, 7058,
+  6, 9055, 4713, 5658, 5714, 3357, 5109, 3312, 766, 329, 766, 1787,
+  5689, 6, 1955, 2772, 3265, 8469, 1474, 4713, 2981, 5883, 5397, 4713,
+  6420, 329, 4966, 766, 1078, 5714, 6, 6, 6064, 5129, 1078, 766,
+  6693, 1165, 5347, 4785, 6, 2772, 2772, 766, 2772, 766, 766, 2981,
+  2772, 9030, 5959, 4760, 1390, 3300, 2032, 4713, 2370, 3312, 3312, 766,
+  3961, 1078, 8699, 766, 5372, 1120, 2834, 9669, 5870, 329, 6, 7184,
+  7433, 766, 2655, 3017, 3017, 3312, 2875, 2772, 3312, 3312, 766, 2855,
+  4785, 7216, 5612, 766, 2200, 7310, 1524, 1120, 9865, 6, 329, 1120,
+  5883, 5372, 2302, 2834, 8551, 6244, 3287, 2981, 329, 3017, 887, 5806,
+  700, 3312, 3312, 3312, 4966, 8026, 1863, 3312, 1165, 1165, 329, 5397,
+  148, 6, 6, 5870, 1242, 766, 9885, 5637, 5714, 2772, 8026, 6693,
+  6, 2655, 1990, 7383, 5109, 5397, 3388, 3312, 5883, 3312, 3388, 3312,
+  7006, 5523, 3312, 329, 3312, 6703, 6693, 3312, 6, 6, 5109, 5739,
+  3312, 7670, 6, 6269, 5572, 7358, 3312, 5572, 6, 2820, 784, 5959,
+  6, 6, 3312, 766, 6219, 4713, 1490, 766, 20, 2220, 5497, 2772,
+  4713, 5751, 5714, 6269, 9910, 2981, 2772, 6445, 1441, 2772, 6, 766,
+  1787, 329, 2709, 6752, 3300, 4785, 2795, 5870, 5714, 329, 5397, 6,
+  7522, 1622, 4713, 2981, 3851, 4344, 3312, 5444, 3017, 3312, 1990, 4620,
+  6138, 6, 329, 6614, 1474, 4713, 4210, 329, 2709, 2981, 9935, 3739,
+  6176, 2709, 329, 766, 67, 6, 4713, 2996, 9960, 4254, 6, 3017,
+  3312, 3017, 2655, 2322, 828, 6, 3861, 2950, 3312, 6376, 2709, 516,
+  4713, 6, 2834, 3312, 4713, 1474, 636, 9985, 2177, 3312, 3434, 5751,
+  2709, 306, 2772, 329, 4713, 3017, 766, 766, 7921, 4628, 2772, 2727,
+  6219, 5017, 766, 2772, 329, 5714, 6, 8551, 4785, 4713, 7433, 7433,
+  2709, 5751, 5397, 5397, 4705, 329, 306, 7260, 5397, 2709, 5637, 1165,
+  3312, 329, 3312, 2492, 5397, 7728, 2981, 9090, 4713, 329, 306, 766,
+  766, 3312, 2855, 3017, 766, 329, 766, 1622, 8420, 6849, 4760, 6849,
+  3201, 1242, 1078, 4652, 1078, 1622, 329, 2820, 594, 828, 5751, 8551,
+  148, 5109, 1622, 2438, 5397, 1217, 5109, 766, 8928, 2834, 2772, 2981,
+  148, 3017, 8645, 7358, 1863, 5883, 2471, 6326, 5347, 5372, 6219, 766,
+  198, 2772, 1990, 8551, 766, 329, 2709, 7241, 766, 329, 5109, 6,
+  4713, 4713, 1622, 7115, 329, 2996, 3312, 5701, 1990, 7184, 4628, 4713,
+  1474, 6495, 766, 9993, 3017, 4713, 5372, 5714, 1787, 3312, 329, 916,
+  5372, 3312, 3312, 2950, 5689, 7703, 9935, 2772, 4078, 5180, 5372, 1078,
+  3017, 4713, 329, 5689, 3312, 464, 3017, 3312, 766, 2996, 5983, 2171,
+  2355, 766, 5637, 7408, 6693, 766, 4727, 766, 3312, 2950, 10018, 5959,
+  3312, 329, 2855, 4652, 329, 459, 6693, 2981, 3312, 329, 2709, 3017,
+  2177, 9468, 1165, 8551, 7199, 6, 2709, 1078, 784, 148, 766, 3312,
+  6, 4713, 459, 4713, 6693, 4538, 3441, 3312, 766, 5714, 2177, 2788,
+  6219, 306, 5612, 7819, 5714, 9206, 3150, 3312, 2709, 2772, 4713, 766,
+  3413, 1622, 6, 2200, 7453, 2875, 6, 4344, 2981, 6, 2709, 6,
+  2875, 3224, 2834, 3017, 6, 6420, 6, 3312, 6, 5883, 4254, 2772,
+  3312, 329, 8258, 766, 7069, 329, 2043, 554, 6703, 766, 1165, 6,
+  1990, 6, 3312, 1250, 5739, 4713, 1622, 8003, 3046, 766, 4705, 3312,
+  5129, 5933, 329, 5502, 6445, 3312, 329, 3017, 5129, 1165, 6566, 5784,
+  4373, 5883, 5933, 3312, 5020, 5637, 1622, 7165, 3332, 3017, 3312, 329,
+  3300, 8478, 1863, 4713, 3081, 3017, 1499, 4652, 4652, 8080, 1078, 4810,
+  4713, 4628, 5347, 306, 3265, 766, 7165, 766, 1622, 10039, 766, 766,
+  2855, 8864, 9629, 6887, 3312, 1863, 7358, 329, 4713, 7638, 4713, 3531,
+  3312, 2788, 1937, 7006, 329, 5196, 329, 2314, 1078, 4254, 5883, 5196,
+  148, 6, 766, 10064, 3489, 6566, 1990, 4603, 1524, 828, 625, 459,
+  306, 2772, 2177, 3312, 766, 5397, 329, 516, 5739, 3441, 3312, 1242,
+  3312, 2709, 1490, 2177, 2981, 7241, 4713, 5870, 6, 766, 162, 1787,
+  4652, 3739, 766, 1622, 5714, 5397, 554, 459, 3590, 5883, 4565, 766,
+  766, 6, 3312, 306, 387, 387, 3017, 3312, 306, 7165, 766, 3985,
+  2438, 2177, 5180, 2438, 766, 2772, 2772, 1941, 148, 554, 3312, 766,
+  6088, 7199, 2709, 5714, 6862, 766, 3312, 784, 9698, 9698, 1408, 4713,
+  10086, 1165, 6, 2834, 6, 1787, 8478, 2177, 6176, 2772, 4713, 2855,
+  2709, 2772, 4713, 4713, 2772, 5739, 1828, 6, 6, 7285, 5109, 9005,
+  7846, 4187, 2772, 2709, 3739, 636, 329, 2772, 7949, 6, 766, 4713,
+  3312, 4652, 766, 1490, 329, 5637, 9308, 10111, 8551, 2855, 766, 3312,
+  6, 1490, 3312, 6693, 6, 870, 79, 7241, 329, 4652, 5689, 329,
+  5714, 5637, 8445, 10128, 3441, 4760, 2772, 6693, 3312, 10152, 4810, 3017,
+  766, 6219, 2220, 5502, 5714, 3312, 5572, 6269, 5870, 766, 1828, 1078,
+  5109, 766, 7260, 3180, 8753, 4713, 6, 9753, 3312, 3312, 2772, 2855,
+  8246, 5830, 3017, 8551, 1787, 3312, 4373, 3312, 766, 3312, 594, 1490,
+  387, 3017, 329, 5714, 3312, 3764, 4713, 10177, 9055, 10202, 3388, 766,
+  5372, 766, 279, 5739, 636, 1165, 8308, 329, 2709, 6, 4538, 3441,
+  2355, 7961, 5883, 9206, 6824, 3017, 8026, 329, 6, 766, 9545, 1078,
+  9443, 8080, 6326, 329, 4810, 3312, 3017, 6, 766, 2772, 329, 5572,
+  1490, 766, 766, 9935, 7241, 7199, 3312, 8620, 306, 10128, 2981, 3590,
+  766, 6, 4727, 1078, 2772, 5017, 4760, 192, 4705, 1622, 3312, 2834,
+  6, 5714, 2834, 2709, 2950, 1663, 766, 3312, 3739, 6, 7949, 5751,
+  5739, 2981, 7058, 4713, 9115, 3312, 5739, 4652, 2772, 2855, 2981, 6,
+  838, 329, 766, 2772, 279, 1622, 516, 5109, 5959, 766, 5870, 306,
+  3312, 766, 2277, 4254, 766, 2996, 838, 766, 766, 329, 4713, 20,
+  7069, 4810, 594, 1863, 6, 4652, 3017, 5497, 6, 4705, 5637, 3312,
+  2171, 329, 2950, 766, 3739, 3312, 306, 6, 2177, 7241, 2772, 3312,
+  3312, 459, 516, 2875, 784, 8026, 3017, 4713, 3312, 329, 3312, 10206,
+  7638, 2772, 3506, 6959, 4713, 1787, 5637, 5347, 9140, 7115, 329, 3531,
+  2772, 9502, 6693, 5397, 2772, 4713, 2085, 2220, 2727, 2438, 4785, 2855,
+  2772, 6, 176, 2834, 4603, 306, 4652, 2772, 8551, 3312, 2981, 3312,
+  329, 766, 4705, 2950, 2875, 329, 571, 2834, 6934, 766, 329, 766,
+  2709, 2220, 766, 3312, 1165, 5959, 2177, 8026, 6351, 6, 4810, 5776,
+  1614, 6693, 3312, 5129, 1828, 766, 5612, 4229, 8420, 766, 5714, 3312,
+  2788, 2438, 766, 3312, 3312, 192, 3017, 435, 3590, 4713, 3017, 1165,
+  306, 1490, 6621, 387, 5572, 7358, 5714, 2220, 2987, 7358, 2709, 6,
+  1863, 1622, 3300, 7241, 3312, 766, 5020, 2834, 1622, 766, 7453, 3176,
+  2772, 625, 3180, 1937, 1622, 329, 3739, 5739, 3312, 766, 6668, 2772,
+  784, 1990, 828, 3312, 4713, 7058, 3312, 6693, 2772, 5701, 5497, 766,
+  1165, 2996, 4713, 5497, 9375, 5502, 2709, 766, 2772, 329, 766, 9191,
+  3017, 329, 1490, 1341, 2772, 7497, 2950, 6201, 5397, 3441, 766, 8753,
+  6, 3017, 8003, 148, 2709, 329, 7497, 10212, 766, 3312, 9140, 766,
+  3312, 766, 1242, 4028, 916, 766, 766, 306, 5933, 329, 329, 5196,
+  5372, 766, 306, 766, 1006, 766, 148, 3312, 2709, 766, 3312, 198,
+  329, 3312, 766, 1787, 1990, 4705, 329, 2772, 3312, 4713, 5196, 4713,
+  1120, 5397, 2032, 329, 4652, 1787, 2709, 3441, 6, 10237, 5959, 5572,
+  766, 2079, 766, 329, 9545, 1078, 1778, 7069, 2981, 3312, 2241, 2855,
+  766, 329, 5020, 306, 5714, 3312, 2950, 4966, 2795, 766, 2438, 5637,
+  1159, 8469, 766, 2772, 3312, 3312, 6643, 1622, 2772, 3739, 3017, 1828,
+  3312, 2709, 4760, 3046, 4941, 1787, 6138, 2220, 3312, 2772, 6959, 766,
+  2950, 2772, 766, 3312, 766, 6887, 766, 148, 766, 2079, 766, 329,
+  1165, 6, 2344, 306, 329, 625, 329, 5397, 7058, 766, 3739, 4785,
+  2079, 5572, 6, 5739, 306, 3017, 3312, 6, 3312, 329, 329, 2709,
+  329, 329, 766, 4713, 2950, 4713, 2085, 5372, 3312, 5637, 516, 2772,
+  2709, 4810, 6, 3312, 3312, 766, 10018, 2772, 2772, 5017, 516, 4713,
+  4810, 7093, 3312, 306, 1622, 5658, 6176, 9865, 766, 766, 2772, 4810,
+  329, 3312, 5245, 4713, 8551, 1078, 2177, 1622, 329, 7826, 3312, 3908,
+  6959, 2709, 828, 8026, 329, 766, 3312, 3312, 3017, 4254, 1622, 2772,
+  5784, 1622, 766, 2709, 766, 1341, 329, 4713, 2772, 329, 2709, 7199,
+  3590, 2772, 7165, 3017, 1078, 1369, 2900, 3739, 329, 2709, 6, 8551,
+  5830, 5497, 7260, 10202, 4420, 6008, 8080, 766, 5460, 2709, 8551, 6,
+  6, 4713, 5397, 4713, 9055, 766, 766, 3312, 1441, 828, 6, 766,
+  4713, 4652, 329, 5397, 1490, 329, 6693, 329, 766, 3017, 7453, 3739,
+  2772, 3312, 5497, 3739, 828, 3312, 1078, 6219, 5751, 67, 766, 3994,
+  5870, 1120, 5933, 5397, 5469, 2709, 329, 1955, 766, 4966, 625, 2772,
+  2772, 4713, 6, 1499, 5959, 6, 5497, 3017, 5983, 5883, 6703, 5397,
+  5658, 3413, 772, 5830, 1408, 766, 329, 6693, 1863, 6, 67, 5372,
+  306, 5138, 7522, 8478, 7241, 6, 10262, 4713, 6176, 6934, 2177, 6523,
+  1828, 9206, 329, 2772, 2772, 766, 1787, 4713, 10279, 5109, 2950, 2177,
+  2772, 4810, 6294, 3017, 3312, 6548, 1078, 2709, 4810, 916, 329, 3017,
+  1863, 6, 766, 306, 2772, 5109, 10206, 3287, 6, 2772, 9502, 766,
+  6752, 4652, 9619, 4713, 766, 7241, 2709, 329, 3312, 3287, 5497, 3312,
+  329, 5397, 7638, 1165, 4078, 7241, 2772, 3265, 5109, 67, 7433, 4652,
+  3942, 7184, 329, 766, 2772, 2709, 741, 4713, 766, 6693, 4088, 784,
+  5883, 6, 2987, 329, 459, 1622, 3017, 176, 6, 3218, 2772, 329,
+  6, 1941, 4705, 3312, 766, 20, 5714, 6, 5572, 6, 3861, 3312,
+  3017, 6176, 9191, 1341, 3312, 2855, 5637, 7260, 2950, 3017, 3312, 7942,
+  766, 6, 4652, 5109, 4603, 766, 6, 6, 2709, 3017, 4713, 3017,
+  3312, 3312, 1329, 4254, 3312, 10039, 5612, 6138, 3312, 766, 8699, 8246,
+  2981, 766, 8551, 6008, 766, 516, 5109, 6693, 1341, 6151, 7453, 9166,
+  6, 6, 329, 5397, 5572, 6693, 279, 2709, 766, 6, 3312, 5612,
+  7408, 1217, 7753, 2987, 3312, 766, 8884, 766, 5109, 1622, 4966, 4652,
+  5397, 148, 1242, 3312, 6495, 6, 2709, 329, 4652, 329, 2772, 2329,
+  5155, 3300, 766, 6, 6138, 1078, 3312, 5109, 4628, 766, 5714, 329,
+  4652, 766, 1622, 329, 5017, 6, 387, 6, 3312, 4713, 4652, 2504,
+  5109, 2981, 6151, 459, 5751, 8986, 6, 3312, 784, 6959, 3312, 5502,
+  766, 4713, 6934, 2788, 5372, 6, 4344, 8469, 459, 4628, 9140, 5372,
+  8903, 3312, 9140, 2772, 6, 1165, 3506, 7472, 2177, 329, 2772, 329,
+  2709, 6, 3312, 4652, 7199, 1955, 516, 192, 1165, 766, 766, 6,
+  6, 5870, 3312, 3942, 5397, 4652, 766, 700, 2772, 766, 6, 6,
+  4713, 4713, 329, 3312, 5739, 8753, 5109, 8283, 4705, 3695, 5714, 1787,
+  784, 6, 2795, 9055, 4713, 3176, 9723, 2981, 1078, 306, 3312, 2772,
+  3312, 6, 766, 329, 6, 3312, 2996, 5502, 766, 4713, 4282, 2709,
+  766, 3287, 329, 5637, 2772, 3017, 6, 6, 766, 10296, 9140, 10321,
+  1663, 2772, 766, 766, 5572, 2257, 2177, 6, 5109, 2981, 6, 4652,
+  3434, 2772, 4652, 306, 3017, 2981, 828, 4652, 4966, 2855, 6, 766,
+  329, 8026, 2996, 571, 2981, 5497, 1474, 766, 1622, 6, 2709, 6693,
+  4713, 700, 3312, 3312, 329, 3017, 2177, 3062, 306, 516, 6294, 766,
+  2709, 3287, 1863, 4966, 5959, 6420, 306, 1474, 8135, 5830, 5372, 3312,
+  3017, 3312, 3739, 6, 3312, 4652, 5714, 5372, 6, 329, 3287, 5637,
+  2043, 766, 5637, 766, 1622, 3312, 7453, 2981, 3312, 2950, 2709, 3287,
+  8258, 2471, 9790, 192, 329, 1863, 2772, 5196, 5397, 828, 6, 4344,
+  6849, 2772, 2177, 6, 5739, 6693, 6693, 3739, 329, 2177, 6, 6,
+  6, 2875, 3017, 766, 9594, 766, 2950, 6, 3312, 4254, 2772, 7260,
+  2772, 329, 6, 6470, 766, 2981, 435, 7069, 329, 329, 7547, 1490,
+  3017, 8085, 3312, 828, 766, 2772, 6, 828, 1863, 5397, 7383, 5637,
+  3441, 766, 2438, 7597, 766, 4713, 5180, 3312, 2855, 5372, 766, 1490,
+  2834, 4344, 1432, 6008, 1990, 5870, 4941, 3312, 1622, 306, 3434, 828,
+  5689, 306, 1787, 1499, 5129, 3312, 766, 5637, 3653, 2370, 516, 5739,
+  329, 3609, 1408, 9698, 5397, 6, 1828, 5502, 8933, 838, 2996, 4713,
+  6, 6, 6, 6, 148, 766, 6, 5109, 5129, 2795, 3312, 766,
+  3312, 766, 2220, 306, 2950, 5372, 3312, 6, 3312, 828, 3312, 6,
+  306, 6, 5637, 766, 3506, 4452, 5180, 306, 2709, 6445, 2220, 7433,
+  5751, 3312, 1990, 3312, 2981, 5372, 4727, 4713, 3861, 5497, 5933, 10346,
+  3312, 2772, 838, 3017, 5870, 766, 9960, 6138, 2772, 2987, 2772, 3312,
+  6, 2329, 1787, 5612, 766, 8961, 10371, 329, 306, 766, 6, 1165,
+  5067, 5372, 1663, 6693, 4652, 2709, 2438, 766, 5397, 784, 6, 6849,
+  5637, 3312, 7358, 4254, 6, 2855, 6, 2772, 766, 956, 329, 2772,
+  3312, 6, 4369, 4652, 2772, 2772, 5372, 3388, 6, 6, 4697, 5714,
+  4713, 766, 6, 306, 8670, 6774, 6, 8928, 2709, 766, 6, 766,
+  766, 766, 766, 1490, 6, 2370, 4254, 2370, 6, 2504, 4344, 9005,
+  784, 329, 2438, 1329, 3312, 329, 9840, 2709, 1242, 2795, 9815, 2772,
+  8214, 1622, 6088, 6219, 4713, 5245, 4713, 766, 6, 8026, 4652, 2772,
+  5397, 766, 4003, 329, 766, 5689, 4652, 2438, 4713, 5397, 2438, 6,
+  3017, 1274, 2950, 10396, 20, 2996, 6566, 4652, 2727, 766, 5372, 6008,
+  3017, 3312, 6621, 7826, 5397, 192, 1622, 5637, 79, 1421, 2772, 5959,
+  2855, 5883, 2950, 1120, 6326, 766, 1474, 4713, 329, 3280, 516, 2709,
+  5637, 3017, 4254, 1955, 3312, 6693, 5637, 5397, 4941, 3300, 306, 2471,
+  5109, 3312, 3312, 6849, 7058, 4628, 9486, 4652, 5822, 3312, 4713, 766,
+  387, 4810, 3017, 1828, 4713, 2772, 766, 8085, 766, 3720, 3441, 5109,
+  6219, 1165, 1432, 2220, 8884, 5347, 766, 2987, 3764, 1490, 5129, 5637,
+  6, 5714, 1165, 1165, 3312, 4373, 3312, 1369, 6, 306, 4966, 766,
+  198, 766, 6, 5933, 2855, 1006, 2655, 625, 4760, 3017, 571, 3312,
+  1341, 2241, 3312, 2079, 1863, 7942, 766, 329, 6, 3312, 6, 3312,
+  2709, 766, 3739, 3017, 5109, 2987, 6, 5751, 5572, 3017, 766, 5497,
+  4713, 5612, 2709, 9256, 192, 3312, 6566, 5109, 4941, 5372, 2996, 6934,
+  554, 4652, 2171, 4652, 6008, 1990, 554, 3312, 2709, 5109, 2471, 3046,
+  5714, 5109, 5637, 4713, 2709, 7033, 2772, 6395, 261, 1622, 5502, 2709,
+  4254, 4254, 2709, 4652, 766, 5109, 784, 766, 3531, 2772, 4254, 2772,
+  5870, 5830, 1165, 1078, 306, 3312, 1622, 5637, 5637, 306, 329, 4652,
+  5109, 6887, 5714, 2996, 5397, 306, 1441, 1490, 8386, 3506, 329, 766,
+  6, 5397, 2981, 2709, 4713, 4713, 3312, 148, 2772, 6, 9393, 5751,
+  6376, 3531, 3312, 6703, 3312, 2996, 4713, 1432, 1078, 10296, 3218, 3017,
+  3312, 329, 1490, 6693, 329, 306, 2620, 1990, 329, 2171, 2655, 7260,
+  2772, 2032, 1165, 5637, 2972, 3312, 5751, 2981, 3017, 3017, 766, 5502,
+  2981, 5372, 3081, 5714, 329, 5870, 766, 3434, 6703, 329, 2277, 1622,
+  2987, 435, 4713, 1165, 4760, 4652, 4585, 329, 329, 4810, 516, 7216,
+  2220, 5959, 766, 1078, 1078, 329, 6294, 6151, 5502, 3312, 3312, 329,
+  2950, 4713, 3312, 5830, 3942, 7241, 6294, 1622, 5092, 3312, 766, 2177,
+  5658, 10396, 1828, 766, 5497, 10111, 306, 3312, 766, 5109, 3590, 4810,
+  306, 6, 5497, 766, 5689, 387, 766, 5845, 2241, 7896, 459, 4713,
+  5612, 766, 2987, 5221, 7472, 4210, 794, 4705, 2177, 1341, 3017, 2200,
+  2981, 2772, 2241, 5689, 3017, 306, 387, 5502, 1955, 329, 766, 4713,
+  5109, 1622, 5637, 1490, 766, 2709, 8478, 198, 766, 8135, 329, 5637,
+  329, 1165, 516, 2772, 9005, 3312, 4713, 4810, 1006, 6, 10421, 6,
+  329, 3017, 8478, 2177, 5751, 329, 2834, 2709, 4713, 3531, 1144, 838,
+  2981, 766, 4585, 2709, 975, 3312, 4713, 766, 1474, 554, 1361, 5497,
+  5983, 594, 4373, 3312, 766, 5397, 7522, 6, 2709, 2950, 5933, 3312,
+  8085, 2709, 10212, 5109, 4713, 6693, 516, 766, 2950, 516, 3017, 7408,
+  4941, 3312, 9055, 4713, 6, 7358, 329, 5129, 2220, 3312, 3312, 329,
+  3739, 148, 5196, 766, 766, 1078, 2772, 5870, 3312, 2709, 766, 2177,
+  5397, 5397, 5612, 2177, 766, 5129, 329, 329, 6, 1990, 766, 3312,
+  6088, 2177, 7241, 3312, 4713, 1120, 329, 3312, 5397, 5637, 784, 3062,
+  6, 6, 2772, 329, 9619, 766, 1078, 7165, 306, 2177, 5658, 766,
+  2772, 766, 5397, 3441, 329, 4187, 6, 3312, 7522, 2709, 329, 3017,
+  3312, 4713, 4713, 2981, 5983, 5497, 6376, 766, 3434, 5017, 2727, 766,
+  2772, 4395, 1863, 5017, 3499, 2772, 3312, 766, 5109, 1441, 5109, 329,
+  5830, 3312, 2709, 10064, 2772, 2074, 6, 5751, 7260, 5714, 5155, 766,
+  766, 2772, 554, 6693, 4713, 329, 5612, 2772, 3312, 2834, 329, 9080,
+  5637, 2772, 5572, 3312, 2981, 6693, 7165, 4713, 329, 3590, 3609, 329,
+  6566, 1622, 2709, 9005, 329, 3312, 6643, 387, 6, 6583, 4713, 766,
+  5739, 6693, 5701, 3312, 766, 3312, 5397, 2875, 6887, 9468, 766, 6,
+  6, 7069, 2772, 3312, 3300, 5658, 2772, 3017, 7613, 2772, 1622, 3312,
+  2655, 8730, 1490, 5347, 306, 766, 784, 6752, 766, 329, 4498, 8551,
+  4705, 3312, 766, 766, 1787, 9308, 4652, 4652, 223, 8189, 4810, 2772,
+  6219, 766, 3994, 3312, 5109, 5397, 3441, 3312, 4810, 2655, 5637, 6693,
+  2709, 1078, 148, 2177, 5689, 2950, 2709, 766, 784, 5109, 766, 9055,
+  3739, 766, 7433, 329, 6, 329, 4652, 766, 766, 1482, 4652, 5397,
+  6395, 636, 6326, 2772, 1212, 766, 10446, 1441, 1524, 2855, 766, 5180,
+  329, 3556, 766, 5109, 6008, 3312, 5067, 6621, 176, 1165, 329, 2772,
+  329, 828, 261, 916, 2177, 329, 6176, 2043, 6, 5689, 5502, 6,
+  8933, 5739, 2987, 2950, 3017, 6, 3312, 4254, 2709, 2875, 329, 2772,
+  916, 5397, 1474, 3218, 3312, 2772, 329, 7260, 1212, 4652, 3312, 1217,
+  3312, 8903, 1078, 8445, 2772, 329, 9080, 4810, 766, 766, 2171, 1787,
+  8420, 329, 329, 2981, 5689, 1217, 329, 3312, 766, 2950, 329, 5572,
+  3739, 1120, 8527, 7165, 8527, 766, 4369, 3312, 4760, 5637, 6693, 7241,
+  329, 766, 6693, 3180, 3312, 6, 5155, 5572, 5109, 148, 4713, 2709,
+  1078, 3312, 3434, 4713, 4282, 3434, 6445, 5870, 2655, 6566, 1441, 329,
+  3017, 5883, 3312, 6693, 6008, 1078, 1432, 766, 7670, 3489, 329, 2772,
+  1622, 5372, 329, 1421, 2875, 1622, 3489, 2996, 766, 766, 387, 7663,
+  306, 2950, 459, 2772, 7358, 4652, 329, 6113, 4003, 6548, 2996, 766,
+  5196, 7358, 1078, 9418, 5397, 1622, 766, 3017, 5739, 3312, 2772, 3312,
+  2981, 5497, 766, 2855, 766, 5883, 516, 2709, 10371, 784, 2996, 5739,
+  9231, 4652, 4379, 1217, 7613, 4713, 1474, 516, 329, 2795, 4713, 5739,
+  3312, 7358, 7260, 2996, 1490, 3312, 766, 5497, 8394, 5739, 1078, 6,
+  3312, 5637, 306, 766, 516, 6, 1622, 2834, 1828, 766, 1614, 766,
+  6294, 2855, 3312, 10456, 306, 5883, 2709, 2438, 9960, 5341, 3312, 6219,
+  8753, 8753, 5129, 459, 1421, 700, 1078, 4652, 563, 594, 1341, 7012,
+  6693, 5572, 329, 3017, 2772, 7058, 3312, 1663, 1622, 7310, 5739, 2855,
+  1078, 1474, 2772, 3017, 2177, 9308, 3312, 329, 2855, 1006, 329, 329,
+  1369, 2981, 1787, 6176, 5109, 766, 5017, 1165, 2900, 1787, 329, 766,
+  10064, 8110, 516, 329, 766, 6420, 1432, 2772, 9740, 3017, 6, 2177,
+  5658, 7871, 3312, 766, 7522, 8551, 3312, 3312, 2950, 4652, 4713, 329,
+  4713, 329, 784, 6, 3312, 2772, 329, 306, 10086, 784, 3312, 5637,
+  2772, 766, 2981, 5017, 5714, 625, 5497, 1787, 4713, 2709, 3017, 3017,
+  3312, 766, 6, 4916, 1441, 9519, 3531, 2772, 1165, 6445, 2709, 7260,
+  6, 4652, 828, 766, 6294, 766, 766, 6, 766, 3300, 4373, 766,
+  459, 1165, 5933, 4713, 3017, 766, 1341, 306, 329, 5883, 2727, 6113,
+  3312, 2177, 766, 2177, 5933, 2177, 329, 2772, 7184, 3312, 4628, 516,
+  3312, 7012, 766, 7695, 766, 3312, 766, 1242, 766, 784, 766, 6,
+  6643, 1787, 6, 329, 1078, 4810, 6, 5983, 1787, 192, 2709, 306,
+  3312, 329, 1078, 2772, 2709, 459, 1888, 5658, 5502, 1217, 4713, 6693,
+  7058, 766, 1159, 8682, 4713, 3590, 1863, 10481, 10486, 5109, 1622, 2438,
+  5469, 4713, 3312, 2981, 2709, 306, 7433, 838, 2370, 1242, 4713, 7069,
+  6643, 2074, 2709, 6, 329, 2772, 6, 6693, 3017, 6693, 766, 6693,
+  766, 1787, 2772, 4810, 2709, 7310, 2727, 5714, 3739, 9545, 6614, 1078,
+  2709, 2177, 3312, 3312, 5460, 7638, 3287, 4713, 7260, 766, 1787, 5689,
+  6, 766, 766, 766, 4652, 8645, 10262, 4652, 10456, 1863, 2727, 1622,
+  9519, 3312, 1078, 5347, 329, 5637, 7572, 1078, 2220, 6420, 2709, 2492,
+  3739, 1408, 4713, 1863, 4620, 2620, 3441, 4713, 2709, 508, 3312, 3312,
+  3312, 3985, 3801, 6, 3312, 2981, 5397, 9619, 8699, 2709, 766, 9303,
+  6351, 4966, 516, 5397, 2772, 766, 3312, 3441, 5372, 1242, 5714, 1828,
+  6, 387, 7184, 3017, 766, 766, 4652, 3312, 766, 766, 3312, 5714,
+  3312, 5372, 2355, 5020, 766, 5397, 4713, 3312, 1165, 2795, 306, 5109,
+  1361, 3312, 6, 329, 2772, 3472, 5572, 3017, 387, 4713, 329, 7165,
+  3312, 192, 3312, 4713, 4713, 1078, 6, 198, 4652, 306, 7358, 329,
+  6, 7058, 5739, 329, 2950, 3312, 1078, 3312, 329, 766, 4628, 2177,
+  8793, 766, 5612, 2834, 5129, 329, 766, 3609, 7069, 8333, 2772, 2606,
+  766, 6703, 5572, 3312, 6643, 6523, 1390, 766, 10511, 6566, 766, 3312,
+  329, 6523, 3312, 766, 3017, 3312, 2709, 8551, 9536, 766, 3312, 3739,
+  459, 766, 3506, 3312, 3312, 3312, 8682, 3017, 5714, 5689, 1990, 2772,
+  1078, 4379, 2655, 2074, 5637, 3312, 1078, 3312, 1078, 766, 2875, 766,
+  306, 6, 6, 6445, 3312, 5372, 5739, 3312, 6, 1746, 766, 3531,
+  1165, 5739, 148, 2709, 7803, 306, 2981, 2855, 3312, 5714, 5129, 4713,
+  2177, 3017, 3312, 4628, 2772, 4713, 8445, 5933, 5751, 329, 2772, 6,
+  1622, 3312, 766, 766, 766, 5714, 4713, 3312, 8085, 3590, 3861, 3739,
+  2504, 1474, 5799, 3312, 700, 6, 2220, 1165, 2074, 387, 5372, 6693,
+  4308, 3218, 8551, 5751, 1828, 10202, 2772, 5830, 1490, 1828, 766, 2834,
+  306, 4713, 6151, 306, 306, 4713, 4652, 6, 7241, 306, 459, 9055,
+  1787, 5372, 3312, 3017, 329, 5739, 4713, 3150, 3312, 1787, 2772, 329,
+  20, 4652, 306, 329, 6981, 4941, 1863, 3017, 329, 2981, 2855, 5397,
+  766, 766, 766, 2950, 198, 306, 4810, 5933, 2981, 329, 3312, 148,
+  6, 1663, 5942, 766, 1863, 766, 3312, 3287, 9723, 2709, 4628, 2772,
+  3017, 766, 766, 2981, 6, 6, 5637, 3176, 1329, 766, 7058, 729,
+  6862, 10421, 1622, 1131, 2772, 6693, 5397, 5042, 329, 6, 6420, 4603,
+  2772, 3413, 5397, 329, 3653, 2177, 2772, 8026, 329, 1490, 4344, 6693,
+  223, 8551, 5689, 9778, 7241, 5397, 3017, 516, 329, 8551, 5372, 79,
+  5372, 3017, 3017, 329, 3312, 5883, 6934, 2772, 9090, 6548, 329, 3312,
+  1165, 766, 3017, 5572, 8283, 9885, 6420, 1787, 4344, 2981, 2772, 766,
+  3312, 3312, 2177, 5460, 766, 2855, 2950, 329, 3312, 2177, 3434, 6934,
+  3312, 6219, 2677, 329, 2709, 2772, 5959, 9993, 636, 3441, 306, 6008,
+  4760, 5109, 5612, 6520, 3312, 3312, 3312, 3312, 594, 7241, 306, 3357,
+  3017, 7978, 1863, 3434, 1441, 5109, 5637, 9157, 3312, 9840, 766, 5397,
+  2471, 3312, 766, 10177, 4628, 2772, 8469, 2950, 2950, 1787, 554, 6693,
+  1787, 5109, 2855, 2981, 2677, 10511, 766, 6548, 4652, 306, 3312, 1490,
+  5751, 2709, 8080, 2950, 10111, 2772, 2875, 2950, 2177, 3312, 1341, 4810,
+  4652, 7358, 5870, 5739, 2709, 4498, 9206, 5637, 3312, 7058, 766, 2772,
+  766, 329, 3312, 7241, 2772, 3312, 3265, 7184, 5572, 784, 1432, 870,
+  2950, 148, 2709, 4652, 766, 2177, 5572, 6703, 1006, 4785, 6, 2772,
+  5397, 7260, 3017, 2709, 3017, 9865, 4713, 766, 766, 329, 10152, 4652,
+  766, 4810, 3017, 6, 7310, 766, 766, 1165, 5502, 306, 1144, 3312,
+  5502, 1242, 6693, 329, 4713, 1499, 1622, 2709, 766, 766, 306, 1408,
+  766, 4966, 1828, 4713, 3312, 6219, 7241, 5109, 1341, 1787, 5372, 9619,
+  1622, 766, 1165, 306, 329, 766, 148, 6643, 329, 6294, 7310, 2220,
+  387, 766, 3448, 6219, 459, 2981, 766, 9840, 5372, 3017, 306, 3017,
+  3441, 10446, 4713, 2772, 6219, 2950, 2709, 2981, 6862, 700, 3017, 5372,
+  2709, 3017, 766, 7069, 766, 2709, 2772, 8085, 1990, 5637, 1441, 2996,
+  6, 6, 2981, 766, 329, 2834, 9502, 1032, 329, 10346, 700, 5751,
+  4713, 1622, 5637, 5109, 1421, 3312, 3312, 828, 2950, 766, 3017, 1787,
+  6138, 2981, 3312, 329, 9536, 3312, 5739, 4254, 4713, 700, 625, 3312,
+  3017, 7241, 1622, 766, 3861, 3312, 3312, 3180, 7383, 5372, 4713, 766,
+  5397, 1474, 2875, 2370, 2981, 9910, 2620, 3312, 3312, 7058, 5637, 3017,
+  5637, 2987, 700, 329, 5372, 2655, 6138, 6, 1787, 329, 3312, 4713,
+  2950, 5109, 2981, 5637, 1421, 2177, 6693, 2314, 2875, 766, 2875, 3312,
+  4373, 1120, 3180, 3441, 3312, 2241, 7199, 329, 329, 2950, 5714, 3590,
+  516, 1490, 5109, 766, 5347, 4713, 1863, 306, 5372, 329, 1863, 9055,
+  2772, 5739, 5933, 636, 6219, 7058, 329, 3312, 5689, 5397, 329, 3312,
+  6294, 306, 5397, 2709, 7069, 329, 5658, 3764, 306, 3312, 6668, 2655,
+  766, 3441, 5714, 3017, 2177, 784, 387, 2171, 3017, 4713, 4344, 9166,
+  4565, 3312, 1474, 3017, 2709, 4652, 2981, 766, 7184, 6, 766, 329,
+  1787, 3312, 5822, 2855, 1863, 6693, 2981, 2772, 1604, 6693, 10086, 2996,
+  5751, 5983, 7803, 766, 3017, 1078, 10086, 2855, 2079, 5689, 8333, 3017,
+  306, 4713, 459, 3312, 5714, 3312, 5397, 6, 4652, 3312, 4003, 329,
+  7058, 1622, 7778, 2996, 3312, 9575, 2471, 1787, 3312, 9629, 5221, 329,
+  5883, 2772, 3312, 2709, 3017, 4713, 6693, 2772, 2772, 3312, 306, 766,
+  4254, 2981, 4713, 766, 7408, 3441, 2329, 4966, 2875, 8059, 1432, 2855,
+  766, 766, 6138, 1078, 10212, 10456, 1006, 1217, 3312, 1217, 2177, 1432,
+  5751, 3017, 2200, 766, 766, 2709, 636, 6887, 766, 8003, 329, 2709,
+  9055, 1787, 594, 5983, 1441, 4713, 2834, 329, 766, 8576, 148, 766,
+  3017, 3017, 3287, 6548, 3312, 329, 2177, 5637, 5109, 4254, 8386, 148,
+  6219, 3609, 3609, 2772, 2079, 329, 2900, 5372, 4713, 3312, 1421, 329,
+  8670, 4344, 9005, 2772, 3312, 8110, 1165, 1490, 2177, 2772, 3312, 4916,
+  766, 1622, 3312, 1828, 1078, 5180, 3312, 306, 516, 2772, 766, 3942,
+  5739, 329, 2772, 2709, 2772, 766, 3764, 2709, 2772, 784, 766, 3017,
+  9545, 766, 306, 3017, 5714, 6566, 4713, 1421, 554, 784, 2709, 5751,
+  9993, 5372, 329, 4713, 329, 2709, 6703, 1078, 4713, 2709, 5883, 2177,
+  4810, 2772, 5689, 1863, 1165, 9654, 1622, 7012, 3017, 6326, 3312, 5739,
+  10536, 5883, 766, 3312, 6, 554, 766, 8469, 5637, 7069, 4713, 2772,
+  2981, 329, 766, 4713, 1490, 3739, 329, 766, 7978, 2772, 571, 6138,
+  554, 10128, 5372, 6643, 766, 6008, 5109, 6693, 8903, 3441, 3312, 766,
+  3739, 329, 6, 8705, 176, 1622, 766, 6566, 1622, 5883, 766, 1165,
+  516, 3312, 1490, 7006, 5497, 4652, 3017, 6774, 7942, 2709, 3312, 766,
+  5883, 2220, 5637, 2043, 3780, 2875, 3017, 2709, 6693, 3017, 7942, 5397,
+  306, 306, 6934, 4628, 5397, 329, 1941, 575, 766, 766, 2795, 329,
+  766, 6138, 636, 2987, 2438, 5637, 6, 5497, 6064, 5714, 6934, 658,
+  8189, 766, 1863, 9519, 3312, 2709, 2370, 5347, 766, 1622, 1663, 2177,
+  329, 766, 3312, 5397, 766, 2772, 2950, 329, 5180, 4628, 329, 5397,
+  3017, 4254, 2950, 3434, 4810, 192, 306, 766, 1863, 838, 3312, 6,
+  329, 7383, 329, 1474, 766, 8189, 7260, 2981, 6, 2772, 3441, 7058,
+  766, 2220, 3388, 3312, 4705, 6, 2981, 5637, 4713, 6, 5497, 766,
+  766, 3609, 5397, 1990, 459, 387, 5714, 329, 4810, 4428, 3017, 636,
+  3017, 766, 329, 455, 4603, 4652, 8214, 3312, 4452, 5347, 9698, 7728,
+  784, 3017, 3312, 3312, 329, 5714, 3312, 3312, 766, 8080, 4373, 516,
+  3312, 4941, 2727, 4713, 5548, 5372, 6643, 766, 10486, 4652, 1078, 766,
+  329, 2875, 625, 516, 4713, 4996, 4538, 766, 148, 5658, 4713, 916,
+  7285, 8135, 5397, 6693, 4810, 8551, 4713, 5397, 4705, 2981, 329, 5497,
+  5372, 1622, 3017, 784, 3861, 2950, 67, 5689, 6, 7453, 676, 3312,
+  3312, 3017, 516, 4254, 4344, 5397, 3312, 6445, 3312, 10321, 834, 3218,
+  1078, 5109, 306, 1474, 2981, 1078, 2950, 3017, 329, 1474, 10421, 6,
+  5502, 5572, 2772, 3312, 8110, 2875, 3826, 2981, 329, 6, 3287, 766,
+  3312, 1490, 766, 329, 5372, 5637, 3017, 6138, 4713, 7260, 2981, 2074,
+  766, 766, 5714, 3826, 6294, 766, 5714, 5372, 766, 766, 2772, 4652,
+  10511, 2772, 5109, 1474, 329, 3312, 3017, 828, 594, 6, 3017, 329,
+  828, 4652, 2677, 8940, 766, 3908, 2177, 3413, 3312, 516, 6693, 329,
+  5751, 1474, 5372, 6, 1863, 329, 4966, 1165, 2772, 516, 7165, 3801,
+  2177, 3312, 3312, 2772, 1990, 2177, 3739, 766, 7871, 6, 6, 3312,
+  1474, 4713, 4713, 8595, 3312, 3224, 5572, 516, 784, 6294, 5155, 2981,
+  766, 766, 3739, 1369, 2772, 828, 766, 2177, 6, 306, 3826, 766,
+  3312, 2772, 4996, 329, 148, 10511, 1474, 2655, 10561, 20, 5221, 6445,
+  306, 6138, 5637, 4119, 3382, 2709, 4369, 1120, 3312, 2981, 700, 329,
+  6693, 8645, 766, 766, 2463, 329, 2177, 2772, 329, 6495, 784, 5397,
+  2772, 4713, 2772, 636, 3506, 3312, 516, 3312, 5497, 2177, 3739, 3017,
+  7433, 5714, 6, 5714, 6176, 6088, 766, 6176, 5959, 1250, 5221, 4330,
+  6887, 1863, 4713, 766, 3312, 6693, 2370, 5502, 2772, 2772, 5502, 7310,
+  329, 3312, 2772, 5245, 2772, 516, 766, 6, 329, 7285, 5933, 6693,
+  6, 6934, 3434, 4713, 306, 2772, 5196, 2220, 329, 2220, 2220, 6,
+  3017, 329, 5109, 766, 5109, 2772, 2772, 516, 329, 766, 4713, 329,
+  4713, 4652, 6693, 3218, 4713, 3312, 6, 459, 2834, 2709, 2772, 306,
+  3017, 6, 7199, 766, 6219, 1622, 3062, 2981, 1441, 7165, 3312, 2709,
+  6, 5155, 6138, 766, 5883, 5739, 6, 3312, 2772, 3201, 7695, 306,
+  2709, 329, 5109, 2220, 2177, 6, 1863, 5714, 6, 7663, 6, 5714,
+  2043, 5883, 7310, 306, 766, 3312, 2950, 3312, 6, 412, 4652, 1622,
+  5751, 5959, 1165, 176, 2177, 828, 7260, 3590, 5612, 7358, 4810, 5502,
+  1474, 1622, 329, 9694, 766, 7012, 2772, 2709, 1120, 4713, 1490, 8551,
+  4713, 5714, 9191, 3017, 2772, 306, 7703, 5397, 4713, 10039, 5397, 6,
+  1165, 2772, 5397, 1078, 9140, 1369, 6, 7310, 5397, 10481, 6, 5739,
+  2709, 1490, 516, 1369, 766, 1778, 2392, 9993, 766, 2772, 3312, 6,
+  329, 3312, 1787, 5572, 3312, 387, 329, 3441, 2981, 766, 6, 828,
+  4713, 306, 4713, 2981, 6693, 3312, 6643, 7241, 3017, 5701, 2981, 766,
+  329, 6219, 6, 7663, 3382, 5372, 7285, 2981, 3312, 6, 2655, 2684,
+  9303, 8026, 306, 3312, 329, 3312, 6, 329, 1787, 554, 3300, 3312,
+  329, 4810, 148, 10086, 8551, 4713, 4713, 6470, 6470, 766, 2772, 7285,
+  6, 6, 7260, 4713, 766, 3312, 1165, 1165, 4966, 3312, 3312, 2772,
+  1490, 766, 766, 2772, 2772, 4713, 3312, 329, 766, 4713, 3388, 387,
+  5714, 3312, 5397, 7069, 6064, 5933, 6693, 766, 7199, 766, 766, 766,
+  2709, 5883, 67, 10486, 766, 329, 2709, 4254, 3312, 3312, 83, 1078,
+  5397, 2981, 2329, 6693, 6668, 2981, 766, 387, 329, 306, 67, 9519,
+  5714, 766, 3017, 7260, 5689, 10561, 766, 766, 2772, 5637, 766, 2981,
+  3017, 6693, 5372, 329, 2855, 6, 3312, 7383, 2709, 306, 5372, 3653,
+  1622, 5658, 3739, 329, 8730, 766, 5714, 2709, 2996, 3046, 766, 2981,
+  5830, 2981, 3388, 1441, 6548, 329, 3312, 5908, 7613, 7310, 329, 329,
+  4713, 4713, 2370, 4727, 3312, 4760, 1165, 4966, 3312, 1482, 6445, 8445,
+  2996, 4705, 6912, 6693, 5221, 2981, 3287, 2950, 6693, 3312, 766, 329,
+  1341, 6, 3312, 329, 766, 1863, 4727, 1828, 1622, 3388, 2772, 4713,
+  766, 766, 1863, 766, 1990, 5870, 766, 5751, 5502, 2709, 2772, 766,
+  28, 4369, 5397, 2177, 8961, 2950, 2200, 2772, 4713, 5372, 306, 7453,
+  5419, 3017, 329, 6668, 329, 2981, 329, 3312, 766, 3312, 658, 2772,
+  7433, 766, 329, 7961, 766, 329, 766, 10421, 4713, 784, 766, 766,
+  766, 3499, 3739, 8026, 7165, 5572, 766, 306, 571, 5714, 1165, 2177,
+  2981, 766, 5397, 6, 4003, 329, 306, 4452, 7058, 5933, 6862, 3017,
+  2950, 4713, 766, 1250, 5497, 5017, 6, 3312, 20, 6, 6008, 2074,
+  3739, 8787, 329, 766, 766, 2875, 3413, 766, 4713, 4713, 700, 5714,
+  387, 3312, 5637, 5109, 3312, 594, 4966, 4713, 1078, 2727, 3312, 10421,
+  6420, 2981, 10536, 2709, 5612, 838, 2645, 3312, 5109, 4652, 2709, 10577,
+  4713, 4652, 7069, 8940, 4713, 329, 3312, 306, 4727, 8420, 10279, 766,
+  5196, 766, 3312, 364, 364, 364, 364, 364, 766, 3017, 3312, 766,
+  6693, 3739, 2772, 10592, 4916, 464, 4705, 766, 766, 516, 3287, 67,
+  2772, 1165, 766, 329, 5397, 2709, 4498, 766, 1341, 9030, 9206, 1990,
+  4727, 6566, 6566, 766, 6, 2772, 5870, 4713, 4713, 7165, 329, 6470,
+  5959, 1441, 2795, 7069, 6, 2074, 2177, 8420, 766, 3764, 3441, 9778,
+  5109, 5490, 766, 4713, 766, 6, 6, 1078, 5739, 2709, 387, 10609,
+  4652, 3312, 4760, 6566, 3312, 464, 6176, 9351, 5020, 4966, 329, 5751,
+  5830, 2772, 7165, 3312, 6420, 9055, 6703, 3312, 554, 3312, 766, 5109,
+  508, 3017, 3312, 7165, 2855, 2772, 3441, 6693, 329, 1217, 5751, 1432,
+  2772, 6445, 5714, 2438, 2772, 3312, 5714, 1078, 625, 6, 5714, 2772,
+  4713, 6, 766, 387, 459, 4652, 329, 1524, 988, 2981, 6495, 2772,
+  4344, 1622, 2177, 3312, 766, 766, 766, 2996, 4373, 6176, 2987, 8551,
+  3312, 5196, 2981, 3312, 766, 1828, 1165, 3312, 2981, 4713, 6445, 766,
+  3312, 4977, 4906, 459, 1250, 1990, 6, 1078, 8502, 1863, 1217, 3218,
+  3017, 2074, 329, 306, 3312, 5347, 4254, 5933, 5883, 9556, 10111, 766,
+  766, 6, 4713, 2032, 9055, 5397, 4652, 329, 4652, 5714, 7012, 766,
+  4652, 5883, 4740, 5109, 5637, 766, 6752, 3312, 6693, 2950, 3287, 8026,
+  9055, 2177, 8730, 306, 3312, 148, 5933, 766, 4254, 3312, 516, 3312,
+  766, 4810, 3312, 3861, 306, 5497, 387, 2772, 6008, 329, 1120, 5502,
+  6, 6, 3739, 5397, 306, 3312, 7383, 7241, 7310, 2772, 766, 5689,
+  3312, 1828, 6, 4344, 4254, 3312, 3017, 6219, 516, 2950, 4652, 2709,
+  3312, 766, 10634, 6668, 1863, 3312, 5017, 4713, 148, 1663, 6, 387,
+  7703, 3441, 4713, 6176, 5372, 1078, 766, 10659, 2981, 2772, 766, 5830,
+  8620, 1474, 4713, 2772, 3434, 766, 5637, 4713, 7058, 3434, 5714, 7012,
+  329, 2772, 766, 1622, 329, 5572, 5799, 1622, 1165, 2950, 8420, 6176,
+  329, 3312, 8308, 516, 3312, 2177, 4652, 5017, 2981, 306, 2772, 766,
+  766, 8026, 3441, 7069, 1990, 329, 2981, 766, 2220, 4713, 5109, 2981,
+  3017, 3312, 306, 6445, 10237, 5572, 1165, 6, 2772, 2709, 1474, 6138,
+  306, 1165, 3312, 10202, 3017, 9619, 6, 6, 766, 6, 6, 2709,
+  2177, 306, 1622, 1622, 6445, 6294, 2177, 4713, 20, 3312, 329, 5397,
+  766, 5155, 10684, 2772, 3312, 6, 6693, 2074, 4705, 4652, 1078, 5714,
+  6, 8141, 3017, 20, 828, 7728, 2709, 3017, 6693, 2177, 2834, 9115,
+  700, 2709, 5714, 2875, 1474, 2177, 3826, 8189, 1622, 766, 9865, 3017,
+  5739, 4713, 329, 6, 5502, 329, 1078, 1242, 3312, 1787, 5714, 766,
+  4713, 4713, 636, 5109, 329, 2709, 5908, 766, 10371, 2709, 7033, 306,
+  2772, 766, 329, 6269, 7058, 3312, 5397, 4652, 329, 3441, 3312, 766,
+  766, 2079, 67, 2655, 3312, 1078, 329, 3312, 148, 2996, 2074, 766,
+  4344, 6326, 1341, 5109, 6113, 2438, 4713, 7241, 6, 4519, 6008, 5109,
+  435, 2177, 148, 4713, 7335, 6, 10446, 3017, 10321, 5397, 594, 3312,
+  838, 329, 3590, 8730, 2772, 6269, 5372, 2709, 6, 3312, 3312, 10456,
+  766, 766, 329, 766, 3017, 5612, 5497, 5714, 9575, 5959, 5739, 3312,
+  387, 2471, 3312, 7069, 1787, 10262, 5347, 5155, 3125, 329, 1787, 3312,
+  766, 329, 1217, 3312, 1165, 828, 7453, 766, 6934, 6, 937, 459,
+  459, 2709, 8445, 8645, 766, 5714, 1863, 3017, 2900, 4652, 8551, 3312,
+  7358, 329, 5196, 2772, 7058, 10177, 2772, 9231, 2772, 6887, 3312, 329,
+  329, 2655, 3180, 9985, 6420, 2855, 2875, 5109, 6668, 2655, 2772, 7753,
+  766, 3312, 3312, 6693, 1078, 766, 2996, 2772, 3017, 2709, 516, 766,
+  329, 9115, 2900, 4652, 870, 5883, 387, 6, 5714, 2241, 7522, 10421,
+  4713, 6, 4620, 828, 2113, 3046, 2709, 8085, 784, 766, 828, 4705,
+  3312, 5830, 3017, 516, 8026, 2772, 516, 5109, 5497, 8445, 3434, 2709,
+  329, 5155, 1032, 8730, 4713, 5397, 1445, 387, 7358, 5714, 3861, 3312,
+  329, 1441, 8141, 5751, 9619, 2772, 5637, 5860, 6, 3017, 3287, 1165,
+  9140, 148, 9115, 1787, 5109, 6176, 1120, 6693, 8166, 6, 625, 6219,
+  7871, 2655, 2709, 329, 8818, 766, 4713, 3739, 9206, 306, 3312, 766,
+  3739, 1078, 766, 9519, 2987, 3312, 3312, 2772, 3017, 7433, 5372, 3287,
+  2772, 3312, 766, 6445, 6614, 6, 4344, 766, 4713, 7942, 306, 1120,
+  766, 6703, 3739, 4254, 766, 4810, 4713, 1165, 766, 4713, 5776, 4344,
+  784, 9030, 766, 5714, 1863, 6, 1888, 6269, 1863, 3851, 5933, 5397,
+  766, 5908, 2709, 8730, 2074, 636, 766, 7058, 766, 5637, 7241, 766,
+  7638, 6727, 784, 387, 8551, 2981, 766, 2277, 3312, 329, 636, 7453,
+  329, 7572, 766, 3312, 5739, 329, 5109, 3312, 5751, 988, 6, 766,
+  6395, 2177, 3942, 1955, 6548, 2177, 1361, 2875, 329, 3609, 2950, 1490,
+  766, 2129, 508, 766, 3441, 4713, 387, 5572, 4713, 3489, 8308, 2709,
+  2772, 766, 2875, 3312, 1165, 4254, 9556, 3609, 2772, 5347, 1490, 6445,
+  766, 4713, 7069, 766, 3578, 3312, 1159, 2709, 5397, 5572, 6039, 9090,
+  2772, 975, 1828, 3312, 2200, 2074, 6, 5502, 4740, 5739, 329, 3287,
+  5658, 1165, 1490, 1274, 516, 6138, 766, 329, 6039, 10536, 1828, 2772,
+  329, 3312, 329, 6, 1746, 2772, 3861, 766, 1078, 3312, 329, 7453,
+  4652, 5714, 766, 5689, 5714, 1165, 1165, 636, 7956, 5372, 3017, 1863,
+  3942, 2834, 6693, 3312, 2220, 2177, 329, 4713, 7260, 3441, 3017, 6981,
+  3312, 3861, 766, 2079, 766, 2171, 5397, 2834, 2177, 4254, 6693, 1078,
+  3017, 766, 3861, 2788, 6351, 766, 4652, 5933, 1622, 459, 8059, 10634,
+  766, 7012, 2709, 4652, 4966, 1787, 2772, 834, 8699, 2772, 766, 5870,
+  2709, 329, 2772, 5502, 5017, 1078, 329, 5612, 1341, 329, 2981, 6621,
+  6, 3017, 6, 2772, 3312, 4713, 5572, 3312, 329, 5502, 5637, 7978,
+  3312, 6, 6, 7069, 306, 4713, 5372, 1165, 1828, 1828, 5933, 6934,
+  329, 838, 3287, 1787, 766, 5714, 766, 3312, 1341, 5372, 3312, 5155,
+  625, 5155, 329, 329, 1622, 329, 6, 3312, 3312, 766, 1341, 329,
+  2981, 766, 2772, 766, 329, 4785, 6, 306, 7613, 6319, 4810, 5883,
+  4452, 8283, 6862, 4916, 838, 5397, 3312, 3017, 5138, 306, 5714, 6,
+  766, 4881, 2709, 5397, 2981, 8085, 766, 459, 7241, 2772, 329, 1490,
+  625, 3312, 329, 3312, 3312, 2772, 329, 329, 4713, 329, 4713, 5397,
+  5092, 784, 6668, 329, 2950, 2032, 766, 10684, 6420, 2981, 6, 9740,
+  6566, 766, 329, 1217, 7826, 4713, 1663, 4652, 5572, 2834, 3312, 4713,
+  5883, 5739, 3312, 9308, 6294, 5751, 1490, 1863, 766, 329, 1474, 329,
+  766, 2772, 766, 870, 5883, 828, 1990, 3312, 3218, 3287, 329, 329,
+  766, 5883, 766, 3017, 5689, 4652, 5316, 3312, 6, 2981, 10064, 7453,
+  3300, 306, 1490, 2834, 1441, 766, 5637, 329, 3300, 1622, 5155, 3312,
+  6, 1863, 8445, 2074, 3287, 6693, 3441, 5138, 766, 3312, 329, 870,
+  6, 5714, 5017, 198, 5689, 516, 6668, 766, 3609, 1990, 2772, 6,
+  729, 1746, 387, 3017, 279, 4760, 3739, 5502, 329, 5933, 3017, 8085,
+  6, 8843, 766, 6693, 5572, 1078, 306, 3312, 4705, 4966, 329, 2900,
+  2950, 2981, 6, 5751, 5397, 329, 766, 5017, 3046, 2950, 766, 4810,
+  9308, 329, 834, 4785, 6, 2043, 1165, 1622, 6138, 9536, 8576, 6,
+  766, 5714, 784, 3312, 4254, 5497, 4652, 2950, 658, 9910, 6934, 2177,
+  2772, 329, 7012, 3434, 3312, 1165, 1474, 1274, 3312, 5196, 9654, 1078,
+  766, 5372, 329, 10609, 3017, 6693, 1622, 6693, 3312, 3017, 5883, 3180,
+  5883, 828, 8551, 6912, 1622, 6, 2709, 766, 2981, 6, 329, 6,
+  6294, 3764, 5572, 5883, 5497, 3312, 1842, 4713, 6244, 6824, 6, 5612,
+  5129, 2079, 4713, 766, 4344, 3312, 8793, 329, 329, 306, 8085, 2855,
+  3312, 6, 6, 5572, 5109, 6294, 4810, 3125, 5109, 3017, 306, 3017,
+  766, 6420, 6176, 766, 5714, 766, 6088, 3017, 306, 5502, 3434, 5180,
+  766, 4785, 2772, 766, 3312, 2177, 5870, 3017, 4713, 4713, 8026, 766,
+  2772, 2772, 5180, 3312, 329, 6420, 1078, 4713, 3312, 6008, 1941, 772,
+  2855, 306, 3300, 2855, 5155, 1622, 2950, 9815, 4810, 766, 766, 766,
+  4713, 2177, 7241, 6176, 4713, 329, 5658, 329, 4713, 2709, 3764, 5933,
+  2655, 4713, 329, 10456, 3312, 3312, 5347, 3312, 2709, 1622, 2996, 7613,
+  7358, 766, 1188, 5714, 4519, 766, 3312, 4344, 3312, 3312, 6, 2950,
+  3312, 5689, 3017, 3312, 1474, 1912, 2855, 2772, 1474, 5612, 3312, 3312,
+  3312, 5637, 2981, 3531, 1078, 6, 766, 5397, 3312, 2855, 766, 3312,
+  5502, 387, 766, 6, 3287, 4713, 3312, 4713, 2950, 329, 9669, 329,
+  3382, 3017, 4282, 2772, 3590, 3017, 4713, 5739, 766, 4713, 766, 5883,
+  4078, 5751, 3312, 516, 766, 1120, 1242, 2171, 975, 6445, 7165, 459,
+  6887, 1242, 2772, 1474, 4713, 5714, 3180, 6219, 329, 3739, 3312, 6,
+  6, 2950, 3312, 5959, 5092, 6, 6693, 4713, 1547, 329, 9594, 5612,
+  766, 3046, 329, 7703, 3312, 4713, 1165, 6693, 329, 3312, 3434, 766,
+  784, 329, 6, 4652, 2709, 6566, 516, 5372, 3312, 2684, 3312, 5397,
+  1622, 9308, 5180, 1622, 6, 6, 329, 3017, 2772, 3312, 741, 4713,
+  9790, 20, 6, 329, 1006, 6, 4713, 7433, 4373, 766, 2772, 3312,
+  329, 3287, 2950, 766, 8551, 329, 5109, 5658, 766, 8214, 3739, 4713,
+  784, 3312, 5572, 4810, 4713, 3017, 3312, 5870, 6219, 6668, 5497, 5502,
+  3312, 6934, 5372, 2220, 766, 1955, 329, 6, 5180, 766, 6, 3312,
+  6, 6668, 2772, 2709, 828, 5870, 5637, 766, 766, 5870, 6, 4628,
+  10237, 3764, 2438, 784, 1165, 2772, 2709, 3312, 3287, 4713, 8730, 6693,
+  2772, 3312, 6693, 4713, 6693, 7069, 10152, 5714, 3312, 5714, 5933, 5502,
+  1622, 7285, 2177, 2177, 2177, 2177, 3017, 2709, 4272, 3312, 4652, 5497,
+  2709, 198, 6, 3312, 8527, 5714, 3312, 4713, 6, 1120, 2855, 5799,
+  2855, 5830, 2772, 3046, 5751, 3312, 6326, 10634, 329, 1078, 6294, 3312,
+  329, 4810, 2772, 6614, 6862, 7069, 5689, 329, 1006, 5689, 766, 1165,
+  3312, 828, 2772, 5612, 3883, 8818, 6151, 6, 3590, 766, 3441, 7058,
+  10396, 6693, 6693, 766, 3312, 2772, 329, 4713, 2074, 766, 2981, 435,
+  5397, 2709, 4713, 784, 306, 4652, 3224, 329, 6, 838, 1165, 6,
+  3017, 7260, 3499, 3312, 2200, 329, 3312, 387, 306, 2834, 6566, 5572,
+  2772, 3017, 5017, 4628, 8308, 8551, 700, 2772, 1990, 838, 306, 3017,
+  387, 387, 4713, 766, 4810, 5109, 2834, 766, 8246, 3448, 2981, 5751,
+  4727, 2085, 2032, 3017, 329, 1990, 2855, 6, 3312, 766, 766, 2772,
+  6614, 3312, 3506, 329, 2177, 8026, 3312, 3434, 784, 2981, 3017, 5933,
+  6138, 7069, 6, 5959, 1274, 4713, 5689, 1474, 5572, 3312, 2709, 7383,
+  8403, 4760, 2855, 329, 3312, 329, 306, 148, 7846, 766, 7115, 2772,
+  1941, 2655, 2875, 766, 3312, 7949, 5497, 6420, 4713, 4713, 766, 329,
+  329, 5502, 387, 8551, 4713, 6244, 3312, 3312, 6799, 5497, 5572, 6693,
+  4713, 4373, 2772, 516, 5180, 2177, 766, 2981, 3908, 3312, 3312, 5502,
+  516, 10371, 1941, 9486, 10684, 329, 3861, 516, 9536, 2795, 3434, 2981,
+  2709, 766, 5689, 2772, 5497, 3312, 8283, 1078, 3017, 5612, 6693, 7241,
+  5714, 3739, 828, 766, 4652, 2772, 9393, 1165, 1250, 6, 3300, 2709,
+  6887, 1078, 4254, 2177, 2709, 3287, 5739, 329, 3312, 4652, 329, 2795,
+  3312, 766, 766, 766, 1622, 3300, 5572, 766, 6959, 2772, 6, 3764,
+  3017, 2855, 3312, 3312, 3312, 766, 329, 6008, 766, 1990, 3017, 766,
+  3176, 6269, 5714, 9654, 766, 1955, 2772, 4713, 1622, 2709, 2177, 1622,
+  5739, 6, 6548, 594, 5870, 2772, 3312, 516, 306, 676, 6723, 542,
+  1474, 5397, 4713, 766, 2709, 329, 6, 2996, 8403, 1165, 4344, 8551,
+  198, 700, 4652, 6693, 7260, 2504, 3312, 4369, 7033, 2177, 6, 1490,
+  4713, 5751, 2834, 4760, 766, 784, 5572, 3413, 6887, 3312, 306, 766,
+  464, 2981, 4705, 766, 766, 7093, 6, 4760, 2074, 329, 6, 306,
+  4652, 766, 2709, 8753, 9308, 6, 3017, 6693, 306, 9669, 3653, 6,
+  6, 5372, 8884, 1912, 4282, 1787, 2981, 1120, 1863, 3312, 2981, 7433,
+  2709, 6693, 6008, 6, 6, 5612, 5469, 3382, 3312, 1165, 6, 7260,
+  3287, 10279, 1490, 5109, 4966, 10128, 3017, 6824, 10456, 3312, 4810, 5689,
+  306, 3441, 700, 9669, 2950, 4652, 4713, 4254, 329, 3312, 5502, 2709,
+  8551, 6, 3312, 4344, 3312, 3312, 4713, 3312, 1159, 2220, 2200, 5572,
+  1165, 766, 766, 3312, 1787, 5419, 6326, 5701, 1863, 766, 6, 1499,
+  3883, 5933, 7012, 6, 3312, 8551, 6, 2772, 6, 6693, 9740, 2981,
+  7572, 1078, 1078, 1242, 10206, 329, 329, 5397, 6703, 6, 7012, 6,
+  8445, 5739, 3441, 5109, 329, 828, 2788, 2772, 329, 329, 3739, 4713,
+  1490, 7058, 329, 4713, 766, 329, 2709, 5572, 4652, 329, 5933, 4713,
+  2709, 1078, 6, 123, 2220, 4713, 5959, 766, 5658, 6326, 3739, 3017,
+  1863, 5497, 3312, 2220, 329, 1990, 4373, 5689, 7942, 329, 2177, 5870,
+  2987, 6420, 766, 8283, 6420, 766, 2950, 9698, 766, 3312, 2709, 329,
+  766, 7241, 3081, 1622, 2709, 4254, 2709, 306, 5309, 329, 2772, 766,
+  3312, 7115, 9080, 766, 2220, 4652, 1165, 1165, 5196, 9055, 2074, 1863,
+  9815, 3312, 2855, 766, 4452, 459, 4254, 3388, 1490, 7260, 6, 2772,
+  2463, 2177, 766, 3017, 3434, 3017, 4652, 329, 5739, 7069, 3017, 2709,
+  3017, 3312, 766, 2772, 3312, 329, 2875, 1165, 766, 2177, 2177, 3312,
+  3017, 6, 4713, 5658, 1159, 1622, 5572, 6548, 4652, 3312, 7921, 4713,
+  4713, 516, 2772, 329, 766, 1078, 2177, 329, 766, 9545, 5739, 2709,
+  1165, 6668, 784, 4652, 1165, 3312, 2463, 455, 7069, 7819, 3265, 5397,
+  5372, 7058, 6643, 5221, 6, 766, 7241, 2772, 5017, 2355, 329, 5739,
+  5155, 10456, 4713, 2709, 6088, 6113, 3017, 7310, 516, 766, 329, 329,
+  6, 2996, 766, 2772, 3312, 3017, 6, 1622, 148, 2177, 329, 3312,
+  6, 766, 766, 1863, 1369, 3312, 3312, 766, 2981, 3163, 6, 1078,
+  3017, 4254, 329, 6, 766, 2220, 306, 2996, 6, 6693, 3312, 554,
+  4713, 6470, 4713, 4282, 5689, 5983, 3017, 3017, 329, 700, 2709, 3312,
+  4652, 1663, 10577, 1622, 1955, 306, 1663, 1078, 306, 5497, 306, 1441,
+  766, 329, 4344, 8986, 2584, 5397, 8420, 5714, 2834, 8026, 3590, 1441,
+  4727, 2241, 2795, 7184, 6326, 2772, 8705, 7058, 306, 6, 1242, 766,
+  5180, 6033, 7285, 8551, 2709, 3017, 3413, 459, 4373, 3441, 3150, 3150,
+  2772, 2834, 5497, 306, 3312, 4810, 6934, 3312, 766, 1787, 9778, 7522,
+  2981, 6294, 2220, 3312, 5714, 3434, 2220, 2772, 4941, 766, 4652, 1078,
+  2981, 1990, 5129, 6151, 5612, 3312, 7572, 2241, 3312, 766, 766, 2438,
+  3312, 5572, 5372, 5933, 6, 5714, 4652, 2855, 766, 7383, 6, 2950,
+  3312, 3312, 306, 6, 2772, 1622, 3312, 3017, 4713, 1432, 3017, 6,
+  828, 6, 4713, 329, 1643, 2655, 5870, 6176, 6, 1165, 4941, 4785,
+  6445, 516, 5933, 329, 3312, 329, 329, 7638, 6693, 6, 1120, 784,
+  4713, 766, 5109, 79, 7285, 5341, 2981, 3312, 2709, 3312, 4053, 5397,
+  1078, 766, 10561, 2996, 4344, 3590, 329, 3017, 8085, 4713, 6, 3312,
+  5637, 766, 6643, 7433, 3312, 306, 5658, 4652, 6, 6, 329, 1165,
+  3764, 3312, 10634, 306, 2177, 3017, 7358, 4373, 8003, 5739, 5714, 5372,
+  4713, 2855, 1165, 2855, 3017, 2981, 6, 5572, 516, 1955, 2788, 2981,
+  5372, 1369, 2772, 7165, 6693, 3312, 10456, 6, 7069, 2772, 3312, 6033,
+  8551, 3434, 4727, 766, 1863, 2074, 5739, 2981, 329, 5883, 6, 329,
+  2709, 2772, 828, 6, 5372, 4810, 3434, 1490, 8551, 4713, 2772, 766,
+  3590, 2709, 6606, 3441, 2875, 3017, 4652, 838, 2177, 7613, 6693, 3312,
+  766, 4652, 766, 5612, 387, 4519, 1622, 329, 3017, 3312, 3017, 329,
+  9669, 1622, 5372, 2950, 2220, 3312, 8026, 6693, 5658, 6824, 1622, 1078,
+  3312, 766, 766, 5714, 7433, 198, 6088, 6, 306, 3312, 3312, 2981,
+  7522, 766, 3017, 2074, 329, 6269, 5612, 5397, 2177, 6445, 3489, 6351,
+  1217, 2855, 8766, 2772, 5155, 3312, 5042, 5806, 8386, 7260, 2900, 1622,
+  916, 4713, 3312, 192, 3017, 2492, 766, 8986, 9654, 1990, 1078, 2709,
+  387, 329, 3017, 329, 3312, 329, 1622, 2950, 148, 2471, 9669, 1828,
+  5983, 5397, 4713, 6, 3312, 329, 329, 1490, 3017, 700, 3441, 2177,
+  3312, 2709, 2795, 3017, 2981, 3312, 2645, 3489, 7199, 10421, 2950, 1787,
+  2177, 5689, 916, 4760, 4713, 387, 3312, 4713, 3017, 3441, 4420, 5497,
+  766, 329, 2834, 2875, 2709, 6033, 766, 471, 5129, 2981, 3312, 2950,
+  10707, 516, 766, 4713, 4652, 1165, 6723, 6693, 10296, 3017, 766, 5372,
+  329, 4713, 8986, 2177, 3017, 2709, 8682, 6138, 8358, 9231, 5959, 5397,
+  1078, 3332, 6, 4713, 4760, 2987, 1441, 2709, 3908, 766, 5806, 6693,
+  766, 5109, 6693, 2996, 2220, 3046, 329, 7012, 3312, 1863, 8884, 5806,
+  4713, 5397, 766, 5572, 1165, 766, 516, 459, 7433, 7260, 2177, 3312,
+  766, 2709, 766, 329, 6495, 784, 1120, 7058, 766, 5270, 8645, 3017,
+  3441, 2972, 3180, 2834, 4810, 4713, 5196, 6693, 2772, 4254, 4652, 7241,
+  2772, 2655, 5109, 2772, 5502, 1622, 1329, 3017, 1120, 6, 5883, 766,
+  2620, 3312, 6, 1369, 3739, 7310, 766, 3590, 3609, 766, 5751, 6326,
+  3312, 5372, 2772, 2772, 2772, 3312, 387, 4713, 766, 766, 7597, 1955,
+  5372, 4713, 5372, 10684, 4713, 1341, 3017, 766, 7260, 1078, 6326, 6,
+  2074, 2981, 766, 2772, 8940, 329, 306, 2772, 766, 2772, 516, 1828,
+  6008, 7871, 6693, 3017, 766, 2772, 9206, 766, 5689, 6693, 5109, 5714,
+  766, 3312, 3312, 10609, 7547, 329, 2875, 3017, 1490, 329, 5397, 6566,
+  4713, 766, 5714, 148, 3017, 594, 2772, 766, 5658, 3312, 4713, 329,
+  6, 4713, 6, 5751, 2079, 766, 2996, 766, 329, 2772, 5372, 6,
+  5196, 6566, 10577, 5138, 1787, 3312, 4713, 5109, 7358, 2772, 2177, 784,
+  3312, 10511, 766, 7058, 5612, 10296, 2981, 2987, 5109, 2981, 2950, 5612,
+  766, 6, 8766, 306, 3312, 766, 5714, 2772, 2855, 7310, 2981, 4941,
+  6244, 5714, 766, 5397, 1863, 387, 8085, 6219, 2709, 5689, 5572, 192,
+  329, 3312, 2981, 7260, 329, 1490, 67, 8420, 6, 329, 5883, 3312,
+  3312, 700, 766, 4713, 4713, 3312, 6703, 6693, 5860, 5637, 4713, 387,
+  329, 6039, 3017, 8358, 3441, 3017, 387, 4760, 2085, 5739, 6, 8551,
+  3312, 1474, 3312, 2220, 2981, 2709, 1165, 766, 2996, 5933, 6, 329,
+  3017, 1242, 2772, 5129, 1622, 2220, 3312, 6548, 5658, 329, 1622, 3312,
+  2950, 2875, 3531, 6326, 8189, 4254, 1490, 3312, 6, 6520, 9005, 2855,
+  5372, 20, 7241, 3312, 3017, 9985, 349, 387, 5502, 10237, 3388, 5196,
+  4713, 5397, 6703, 5983, 306, 1432, 3312, 3312, 176, 8085, 3312, 6326,
+  6294, 4966, 2504, 4652, 766, 2772, 2795, 625, 2772, 4713, 6934, 6,
+  1250, 1078, 766, 3312, 5739, 1828, 3017, 1663, 1990, 4713, 3017, 7012,
+  5751, 1474, 1474, 554, 1032, 10659, 3312, 7069, 9935, 2504, 4810, 6934,
+  4977, 5933, 5221, 3287, 6693, 5180, 766, 6, 2241, 2709, 5397, 2987,
+  459, 766, 8189, 9960, 9418, 5129, 6, 5612, 5155, 4713, 766, 5017,
+  6008, 5017, 625, 5221, 5572, 4344, 4713, 1787, 3017, 2709, 5347, 5397,
+  9308, 3021, 5739, 766, 6, 4546, 2772, 1474, 766, 2709, 10018, 2772,
+  3312, 6693, 5572, 329, 4373, 329, 2772, 4308, 8620, 7597, 387, 3017,
+  3176, 3312, 2981, 10634, 329, 766, 6, 625, 3312, 7165, 766, 766,
+  6151, 3017, 306, 306, 6887, 2996, 766, 7285, 5883, 67, 766, 2772,
+  6614, 329, 3017, 6176, 4810, 766, 2709, 766, 5883, 2655, 2981, 5109,
+  1990, 6643, 3287, 329, 3312, 5397, 2655, 2772, 329, 6, 3287, 4713,
+  2772, 2772, 2471, 2709, 1165, 7613, 10279, 3312, 3017, 329, 1165, 5739,
+  9885, 5397, 5372, 5883, 5751, 4713, 8361, 6693, 4713, 2709, 7058, 1490,
+  9960, 766, 7033, 9278, 4810, 4713, 766, 1078, 4652, 1490, 5109, 766,
+  2709, 2772, 4713, 6219, 3312, 5714, 2772, 554, 3312, 329, 516, 329,
+  2709, 2834, 3312, 636, 571, 6, 729, 1078, 6934, 766, 9005, 4713,
+  5572, 6138, 784, 766, 2981, 7058, 6176, 4652, 329, 5714, 3312, 3312,
+  6, 6, 2987, 10511, 1663, 3312, 5933, 5714, 329, 9055, 2981, 2772,
+  1165, 387, 6151, 5397, 5714, 3017, 3300, 6, 766, 2709, 1165, 3287,
+  306, 329, 329, 5372, 10279, 1078, 3176, 828, 329, 3441, 2772, 8766,
+  2772, 3017, 10396, 6, 306, 6693, 3017, 3312, 7069, 1159, 4373, 5502,
+  2772, 3312, 5933, 766, 3017, 3312, 3764, 9375, 329, 329, 3312, 3017,
+  20, 2981, 3312, 3312, 306, 5637, 5397, 766, 7069, 1955, 5701, 279,
+  4713, 6621, 3312, 279, 5572, 766, 329, 5714, 9418, 9140, 766, 766,
+  766, 766, 6548, 1329, 306, 1250, 6, 2772, 3861, 3590, 2772, 3312,
+  3312, 3312, 3609, 6, 5397, 4254, 7012, 329, 3312, 766, 2772, 7069,
+  4713, 1165, 5397, 3017, 5138, 3312, 5739, 5751, 2177, 3312, 1622, 5714,
+  766, 6, 2772, 2200, 8753, 3017, 7260, 766, 2606, 1622, 3312, 7956,
+  6, 2950, 5959, 6151, 387, 4713, 3312, 1863, 766, 329, 2709, 7058,
+  5714, 766, 516, 1217, 2981, 329, 1165, 3441, 148, 5372, 1078, 329,
+  6008, 4785, 1474, 306, 2772, 5870, 329, 2709, 8386, 329, 2772, 3312,
+  10659, 1078, 2772, 3312, 8234, 4652, 329, 766, 148, 6, 176, 1778,
+  766, 3312, 7260, 6, 3861, 1863, 329, 3312, 2981, 8595, 2241, 1432,
+  766, 2855, 4713, 700, 6294, 6219, 1078, 1863, 6008, 4740, 4713, 10279,
+  4254, 2772, 4713, 4361, 6693, 306, 766, 2834, 3382, 516, 2655, 329,
+  5751, 1361, 4369, 306, 4713, 6, 5129, 3017, 7012, 6219, 6470, 4705,
+  8551, 5109, 3312, 3312, 329, 1490, 2220, 4713, 6420, 7613, 8085, 329,
+  5397, 4652, 9654, 6, 766, 4254, 4760, 6, 1165, 6269, 3312, 6693,
+  4628, 6693, 306, 329, 3312, 838, 3017, 8026, 2370, 8595, 1369, 3434,
+  766, 5637, 329, 766, 766, 4628, 766, 3017, 306, 2772, 3312, 766,
+  2981, 5397, 306, 766, 6219, 2570, 7058, 4652, 5572, 3739, 329, 2981,
+  1622, 7497, 6219, 10128, 5397, 3590, 1441, 3046, 3961, 1990, 1361, 3280,
+  2950, 2981, 6693, 3180, 1490, 5883, 3017, 1078, 3312, 3312, 4713, 784,
+  766, 329, 3312, 3312, 3017, 2177, 3764, 2772, 2772, 1165, 766, 700,
+  4652, 329, 3017, 1165, 1078, 6, 6, 5714, 3312, 2177, 2772, 6566,
+  4652, 4254, 1828, 2772, 5658, 2981, 4519, 5502, 3312, 6351, 4652, 5959,
+  4254, 2655, 2177, 6, 5497, 3441, 3312, 3312, 2996, 5109, 5017, 1490,
+  4713, 6693, 6, 1622, 7260, 6326, 1787, 1361, 1524, 329, 2620, 2220,
+  3312, 2709, 916, 6, 636, 8189, 306, 1432, 6, 10592, 3312, 2177,
+  1120, 2981, 2772, 3312, 2875, 3312, 5397, 6703, 3312, 4713, 2996, 766,
+  1474, 4713, 8705, 4713, 6, 5714, 1863, 1622, 5572, 8595, 2981, 766,
+  636, 5109, 2950, 329, 2709, 1078, 1622, 6, 3312, 3180, 1787, 508,
+  3017, 6, 6219, 6420, 1361, 5372, 1361, 5502, 3312, 3017, 2709, 766,
+  1622, 766, 1165, 5109, 766, 766, 2996, 6, 5397, 9278, 10486, 766,
+  1078, 3312, 4713, 4713, 6887, 2834, 1078, 6376, 6643, 4966, 766, 2834,
+  6, 6566, 8551, 3312, 1159, 1863, 5714, 6138, 3312, 2950, 3312, 2855,
+  784, 3081, 4713, 8026, 2220, 1622, 6693, 2772, 6138, 6693, 7033, 1863,
+  3590, 5933, 3017, 306, 766, 5497, 838, 5245, 1842, 3312, 20, 3312,
+  1078, 329, 5372, 5689, 766, 9536, 3312, 3017, 784, 5701, 766, 1622,
+  5572, 3312, 2795, 3764, 3017, 5109, 4652, 3312, 2855, 516, 329, 4760,
+  5739, 6693, 1078, 8478, 2709, 516, 5751, 2981, 2875, 6420, 7358, 471,
+  5109, 3312, 5959, 3312, 6201, 5739, 1274, 766, 306, 5883, 6395, 329,
+  3312, 5129, 8787, 766, 5502, 7241, 4373, 516, 10279, 1217, 4713, 5180,
+  6, 1499, 2177, 2709, 6, 3312, 4519, 8085, 700, 3017, 3017, 1490,
+  4713, 6, 5883, 3312, 5637, 349, 6, 766, 3531, 5397, 6693, 5637,
+  5372, 329, 6, 4713, 6862, 4652, 2772, 5751, 2875, 5572, 2529, 2670,
+  3017, 5870, 5714, 2981, 6, 5933, 1165, 1787, 3312, 4810, 6151, 6693,
+  1863, 2996, 329, 6693, 329, 9256, 8394, 3312, 5637, 2709, 8445, 766,
+  1863, 3017, 5372, 3739, 1078, 6, 784, 1165, 766, 2772, 1721, 5497,
+  4344, 766, 6, 3312, 6420, 5109, 2220, 6, 387, 3163, 766, 1990,
+  5109, 3312, 3312, 7058, 5658, 4713, 329, 5870, 2855, 148, 3312, 4652,
+  2772, 4713, 3312, 2709, 10707, 6, 1078, 306, 4906, 1165, 2177, 5109,
+  7058, 7949, 4713, 2772, 329, 329, 1863, 3441, 766, 2709, 1863, 10707,
+  7069, 3125, 3312, 387, 329, 575, 5714, 5959, 329, 5397, 2981, 5714,
+  784, 329, 329, 3441, 5180, 3609, 766, 2772, 766, 6, 1990, 766,
+  5714, 2177, 2950, 1078, 2085, 6, 5109, 2177, 2177, 1787, 1369, 3017,
+  9308, 5933, 7241, 2834, 329, 4652, 6294, 516, 4810, 3312, 766, 1032,
+  766, 766, 3312, 387, 2772, 6, 2987, 3218, 3312, 5109, 766, 5658,
+  4760, 4705, 3312, 3017, 5092, 306, 6326, 7638, 2855, 766, 554, 2981,
+  4713, 2772, 6, 3861, 766, 5397, 766, 5502, 2709, 2772, 5497, 5689,
+  459, 766, 766, 4713, 3312, 766, 5870, 2709, 6887, 3312, 3312, 6445,
+  766, 329, 7058, 766, 5109, 766, 2772, 1165, 2772, 766, 5572, 6,
+  766, 766, 766, 6774, 3312, 329, 5042, 3017, 10421, 329, 766, 3441,
+  2950, 5109, 1341, 1622, 329, 6693, 766, 2171, 6, 3312, 3312, 1242,
+  2709, 4713, 306, 8705, 4713, 3224, 6420, 1165, 3441, 5109, 2875, 2177,
+  766, 2772, 1746, 6420, 2329, 5701, 766, 329, 306, 6, 766, 3017,
+  6693, 496, 3801, 5397, 766, 3312, 3017, 6, 8085, 766, 6088, 2772,
+  2277, 5372, 1622, 329, 3017, 3017, 1863, 5397, 516, 766, 8141, 766,
+  766, 4713, 516, 766, 3017, 2772, 7638, 554, 1217, 4713, 8730, 329,
+  6008, 3312, 2772, 3300, 3506, 3312, 1274, 2834, 6, 2772, 9619, 636,
+  2655, 7408, 387, 279, 3312, 4652, 766, 2709, 3300, 2709, 5397, 4713,
+  3312, 5372, 838, 1361, 766, 2655, 4941, 784, 4254, 6470, 2177, 1828,
+  1990, 1622, 2772, 3017, 387, 7241, 4652, 5372, 329, 9333, 5637, 3312,
+  3312, 2772, 329, 329, 6, 192, 7942, 1622, 2709, 1622, 4713, 5397,
+  2772, 5502, 2981, 1165, 3312, 2987, 3861, 6470, 7846, 2772, 5799, 10592,
+  148, 5959, 329, 3312, 2772, 3312, 4713, 1078, 9629, 192, 7942, 6,
+  766, 9519, 6934, 2772, 1787, 1078, 3017, 1559, 729, 3312, 5372, 2950,
+  2709, 2709, 3017, 5372, 6351, 6, 766, 3312, 1078, 5751, 5739, 329,
+  1250, 3312, 2772, 1329, 5933, 3312, 1078, 2772, 516, 387, 6693, 6,
+  2772, 766, 5490, 3590, 5714, 3413, 329, 766, 6, 3312, 329, 6033,
+  3312, 2709, 2987, 3312, 3312, 3017, 3531, 9753, 3312, 3017, 766, 5637,
+  2122, 6, 387, 2177, 1622, 1165, 8283, 6, 766, 5572, 1622, 3312,
+  329, 5572, 2981, 3441, 5397, 3441, 3017, 766, 3312, 2709, 766, 329,
+  3312, 3312, 5830, 766, 6420, 4713, 2177, 306, 6, 5959, 3739, 2950,
+  192, 2834, 5017, 3017, 6774, 6, 3441, 766, 2981, 3413, 828, 2772,
+  2079, 3441, 1622, 1341, 766, 5572, 4713, 306, 4966, 6703, 3312, 67,
+  766, 4254, 3312, 9157, 4713, 2079, 766, 306, 2709, 3312, 1445, 4713,
+  5689, 2950, 2709, 1990, 2709, 2772, 1341, 1524, 2709, 5830, 766, 6,
+  5739, 4713, 5092, 3312, 3312, 329, 766, 5959, 3472, 838, 4088, 5751,
+  3312, 3312, 4652, 766, 5883, 459, 329, 766, 6, 5658, 3312, 542,
+  5109, 2996, 2709, 1482, 3017, 2772, 2655, 329, 2981, 10346, 10346, 7069,
+  5739, 2772, 2981, 1863, 766, 2772, 306, 3017, 766, 4810, 2950, 6,
+  6201, 6, 5959, 1828, 3312, 1622, 766, 5397, 766, 6, 1474, 828,
+  3312, 4628, 329, 4713, 306, 3017, 6, 6, 306, 4713, 766, 329,
+  1159, 766, 4760, 2709, 306, 1622, 3908, 6548, 329, 8645, 3441, 2772,
+  3312, 3739, 766, 1120, 4713, 554, 3312, 3312, 7260, 3312, 3312, 5196,
+  3287, 2772, 306, 192, 4254, 3017, 5397, 6, 6, 7522, 3609, 3739,
+  9005, 2177, 5397, 10396, 2772, 7069, 4966, 4713, 4652, 3312, 1165, 766,
+  516, 2772, 2043, 6, 6294, 1120, 2981, 5497, 5497, 1165, 3312, 1078,
+  1078, 6, 3312, 766, 5714, 5714, 6, 4652, 79, 1165, 4810, 1614,
+  5572, 67, 838, 329, 1622, 5739, 6799, 2950, 1441, 1165, 3312, 3942,
+  3017, 5572, 8403, 10481, 4652, 2772, 2370, 6, 766, 329, 2855, 5372,
+  3312, 3826, 5502, 766, 6, 306, 5572, 329, 2772, 306, 3312, 2709,
+  5109, 2772, 766, 2950, 5397, 329, 5714, 4713, 20, 387, 6008, 2709,
+  838, 916, 3590, 5959, 870, 3312, 3312, 2655, 8730, 516, 3312, 766,
+  329, 5397, 5372, 3312, 2981, 5372, 3312, 766, 594, 2834, 766, 6566,
+  7069, 766, 2370, 3017, 5751, 2981, 766, 1078, 1990, 5612, 1482, 4810,
+  6294, 5689, 7433, 6981, 5933, 3312, 5497, 516, 3017, 329, 7522, 2772,
+  3017, 3609, 2709, 766, 3312, 5109, 3780, 2529, 3312, 2504, 766, 306,
+  3312, 5739, 766, 6727, 6, 5180, 3764, 1341, 6, 5397, 2855, 4628,
+  6934, 5637, 4652, 625, 329, 5397, 4713, 5109, 766, 7433, 2709, 636,
+  306, 7358, 3312, 5502, 3578, 2772, 1341, 6294, 8884, 1863, 828, 6138,
+  2220, 4713, 3312, 3017, 3017, 1217, 784, 3531, 7896, 306, 1217, 329,
+  5739, 4810, 2981, 5347, 329, 3312, 3017, 5739, 1078, 625, 6, 4428,
+  766, 5883, 3312, 329, 5109, 6668, 5714, 329, 5109, 4652, 828, 3942,
+  2709, 5287, 5347, 5397, 2471, 766, 329, 3312, 306, 4003, 4760, 5701,
+  2772, 6693, 2655, 3388, 6934, 766, 5572, 3312, 3764, 5372, 1990, 2220,
+  329, 3017, 571, 3434, 5572, 6008, 9115, 9740, 1622, 5109, 766, 5397,
+  2220, 329, 6445, 766, 3312, 2981, 6959, 6693, 766, 5109, 7260, 2987,
+  329, 459, 7896, 2834, 6693, 4652, 3312, 4713, 2772, 3017, 4916, 6,
+  766,
+};
+
+// Deduplicated, NUL-separated vendor names
+static constexpr char oui_db_names[] =
+  "XEROX\0"
+  "Cisco Systems\0"
+  "FUJITSU\0"
+  "Oracle\0"
+  "Cabletron Systems\0"
+  "Telco Systems\0"
+  "Seiko Epson\0"
+  "NEC\0"
+  "Sumitomo Electric Indust\0"
+  "Kontron Europe\0"
+  "Yokogawa Digital Compute\0"
+  "Private\0"
+  "Madge\0"
+  "RICOH COMPANY\0"
+  "Nortel Networks\0"
+  "CANON\0"
+  "Brocade Communications S\0"
+  "Dell EMC\0"
+  "Tattile\0"
+  "Stratus Technologies\0"
+  "Edimax Technology\0"
+  "Rockwell Automation\0"
+  "Harris\0"
+  "ARRIS Group\0"
+  "Emulex\0"
+  "SBE\0"
+  "Samsung Electronics\0"
+  "Allied Telesis\0"
+  "DIGITAL EQUIPMENT\0"
+  "3COM\0"
+  "Extreme Networks Headqua\0"
+  "Bosch Security Systems\0"
+  "CyberTAN Technology\0"
+  "DZS\0"
+  "Sony\0"
+  "Adtran\0"
+  "Artesyn Embedded Technol\0"
+  "F5 Networks\0"
+  "Siemens\0"
+  "Hewlett Packard\0"
+  "Enterasys\0"
+  "ECI Telecom\0"
+  "Ericsson\0"
+  "Carrier\0"
+  "IBM\0"
+  "Primax Electronics\0"
+  "SAMSUNG ELECTRO MECHANIC\0"
+  "Intel\0"
+  "ALPSALPINE\0"
+  "Mellanox Technologies\0"
+  "Nokia Danmark A/S\0"
+  "HMS Industrial Networks\0"
+  "HUMAX\0"
+  "Atheros Communications\0"
+  "PLANTRONICS\0"
+  "Advanced Digital Broadca\0"
+  "Apple\0"
+  "Qisda\0"
+  "TECOM\0"
+  "Microsoft\0"
+  "LEXMARK INTERNATIONAL\0"
+  "3COM EUROPE\0"
+  "Avaya\0"
+  "AVM\0"
+  "Sony Interactive Enterta\0"
+  "NVIDIA\0"
+  "Cambium Networks\0"
+  "Motorola Solutions\0"
+  "Breezecom\0"
+  "Microchip Technology\0"
+  "Seagate Technology\0"
+  "TERACOM TELEMATICA\0"
+  "SMC Networks\0"
+  "Accton Technology\0"
+  "Zebra Technologies\0"
+  "XIRCOM\0"
+  "Garmin International\0"
+  "VMware\0"
+  "Overture Networks\0"
+  "Juniper Networks\0"
+  "Flextronics Internationa\0"
+  "LG Innotek\0"
+  "D&M Holdings\0"
+  "Analog Devices\0"
+  "Calix\0"
+  "Dell\0"
+  "Delta Electronics\0"
+  "Sonicwall\0"
+  "RACAL-DATACOM\0"
+  "AT&T\0"
+  "SHENZHEN GONGJIN ELECTRO\0"
+  "BUFFALO\0"
+  "Alcatel-Lucent Shanghai\0"
+  "Elitegroup Computer Syst\0"
+  "Red Lion Controls, LP\0"
+  "Thomson\0"
+  "FREEBOX SAS\0"
+  "Hitron Technologies\0"
+  "Toshiba\0"
+  "ADB Broadband Italia\0"
+  "Dish Technologies\0"
+  "EFM Networks\0"
+  "Kaon Group\0"
+  "Fortinet\0"
+  "HTC\0"
+  "Molex CMS\0"
+  "Allied Telesis K.K\0"
+  "NETGEAR\0"
+  "Visteon\0"
+  "Nintendo\0"
+  "Vestel Elektronik San ve\0"
+  "Gemtek Technology\0"
+  "3Com\0"
+  "Alps Alpine\0"
+  "CERAGON NETWORKS\0"
+  "Harmonic\0"
+  "Scientific Atlanta\0"
+  "RuggedCom\0"
+  "Wistron\0"
+  "TP-LINK TECHNOLOGIES\0"
+  "HARTING Electronics\0"
+  "Broadcom\0"
+  "Communication Machinery\0"
+  "Siemens Home & Office Co\0"
+  "Cal-Comp Electronics & C\0"
+  "devolo\0"
+  "Communications & Power I\0"
+  "Verifone\0"
+  "Silicon Laboratories\0"
+  "Asiarock Technology\0"
+  "Wistron Neweb\0"
+  "Grandstream Networks\0"
+  "Aruba, a Hewlett Packard\0"
+  "ADVA Optical Networking\0"
+  "Advantech Technology (CH\0"
+  "ABB\0"
+  "Cisco-Linksys\0"
+  "Routerboard.com\0"
+  "Zenith Electronics\0"
+  "ASUSTek COMPUTER\0"
+  "MICRO-STAR INTERNATIONAL\0"
+  "Bose\0"
+  "Eaton\0"
+  "NEC Platforms\0"
+  "Lantronix\0"
+  "Nevion\0"
+  "Roku\0"
+  "2Wire\0"
+  "D-Link\0"
+  "ARIMA Communications\0"
+  "Symantec\0"
+  "QLogic\0"
+  "Roche Diagnostics\0"
+  "Thomson Telecom Belgium\0"
+  "Sonos\0"
+  "Sagemcom Broadband SAS\0"
+  "Raisecom Technology\0"
+  "Murata Manufacturing\0"
+  "Sercomm\0"
+  "Quantum\0"
+  "Riverbed Technology\0"
+  "Zioncom Electronics (She\0"
+  "Icotera A/S\0"
+  "Genexis\0"
+  "Xirrus\0"
+  "BlackBerry RTS\0"
+  "Landis+Gyr\0"
+  "Alpha Networks\0"
+  "Actiontec Electronics\0"
+  "MRV Communications (Netw\0"
+  "Westell Technologies\0"
+  "Hangzhou H3C Technologie\0"
+  "Pantech\0"
+  "GIGA-BYTE TECHNOLOGY\0"
+  "OI ELECTRIC\0"
+  "Universal Global Scienti\0"
+  "Sunplus Technology\0"
+  "Oki Electric Industry\0"
+  "ZNYX Networks\0"
+  "Peplink International\0"
+  "Mojo Networks\0"
+  "Alcatel-Lucent Enterpris\0"
+  "Nurivoice\0"
+  "ASKEY COMPUTER\0"
+  "AboCom\0"
+  "PARROT\0"
+  "VTech Telecommunications\0"
+  "Texas Instruments\0"
+  "Arcadyan Technology\0"
+  "Check Point Software Tec\0"
+  "Intel Corporate\0"
+  "u-blox\0"
+  "Lenovo Mobile Communicat\0"
+  "GN Netcom A/S\0"
+  "Zyxel Communications\0"
+  "Ruckus Wireless\0"
+  "MTI\0"
+  "Hewlett Packard Enterpri\0"
+  "Sichuan Changhong Electr\0"
+  "General Dynamics Mission\0"
+  "Hon Hai Precision Ind\0"
+  "TRENDnet\0"
+  "Nokia\0"
+  "Ubiquiti\0"
+  "AzureWave Technology\0"
+  "zte\0"
+  "Novatel Wireless Solutio\0"
+  "Quanta Computer\0"
+  "Alcatel-Lucent IPD\0"
+  "Yulong Computer Telecomm\0"
+  "Scientific-Atlanta\0"
+  "ProCurve Networking by H\0"
+  "SHENZHEN MTC\0"
+  "Casa Systems\0"
+  "SFR\0"
+  "Belkin International\0"
+  "nFore Technology\0"
+  "SHARP\0"
+  "PAX Computer Technology(\0"
+  "KYOCERA Display\0"
+  "Alcatel-Lucent\0"
+  "CRESYN\0"
+  "Cisco Meraki\0"
+  "Cisco SPVTG\0"
+  "HUAWEI TECHNOLOGIES\0"
+  "Panasonic Mobile Communi\0"
+  "Fujitsu Technology Solut\0"
+  "Vizio\0"
+  "Cambridge Industries(Gro\0"
+  "UNION MAN TECHNOLOGY\0"
+  "SKY UK\0"
+  "Google\0"
+  "Johnson Outdoors Marine\0"
+  "Konka Group\0"
+  "Lear\0"
+  "Intelbras\0"
+  "Sophos\0"
+  "Skyworth Digital Technol\0"
+  "FUJIAN STAR-NET COMMUNIC\0"
+  "Keysight Technologies\0"
+  "Handreamnet\0"
+  "Palo Alto Networks\0"
+  "COMPAL INFORMATION (KUNS\0"
+  "Brother industries\0"
+  "Panasonic Corporation AV\0"
+  "HPN Supply Chain\0"
+  "TCL Technoly Electronics\0"
+  "Hillstone Networks\0"
+  "LG Electronics (Mobile C\0"
+  "Arista Networks\0"
+  "Castlenet Technology\0"
+  "AirTies Wireless Network\0"
+  "Harman/Becker Automotive\0"
+  "Alarm.com\0"
+  "Universal Electronics\0"
+  "Jiangsu Yinhe Electronic\0"
+  "Comtrend\0"
+  "MICRO-STAR INT'L\0"
+  "DrayTek\0"
+  "Sunitec Enterprise\0"
+  "Fujian LANDI Commercial\0"
+  "infomark\0"
+  "INVENTEC\0"
+  "Shanghai DareGlobal Tech\0"
+  "Thermo Fisher Scientific\0"
+  "Continental Automotive S\0"
+  "MCS Logic\0"
+  "Hitachi\0"
+  "Marconi Communications\0"
+  "Verilink\0"
+  "Sycamore Networks\0"
+  "KONICA MINOLTA HOLDINGS\0"
+  "EAGLE TECHNOLOGY\0"
+  "Gigaset Communications\0"
+  "Ping Communication\0"
+  "Inteno Broadband Technol\0"
+  "Liteon Technology\0"
+  "Honeywell\0"
+  "KYOCERA\0"
+  "APTIV SERVICES US\0"
+  "PLANEX COMMUNICATIONS\0"
+  "Polar Electro\0"
+  "AMPAK Technology\0"
+  "SmartRG\0"
+  "RIM\0"
+  "Ciena\0"
+  "Redpine Signals\0"
+  "Sichuan Jiuzhou Electron\0"
+  "Elentec\0"
+  "Sumavision Technologies\0"
+  "ASRock Incorporation\0"
+  "Samsung Electronics Co.,\0"
+  "Super Micro Computer\0"
+  "Laird Connectivity\0"
+  "Teracom\0"
+  "Aztech Electronics\0"
+  "Mitsubishi Electric\0"
+  "DAEHAP HYPER-TECH\0"
+  "AcSiP Technology\0"
+  "MERCURY\0"
+  "LCFC(HeFei) Electronics\0"
+  "Fiberhome Telecommunicat\0"
+  "LUCENT TECHNOLOGIES\0"
+  "Tellabs\0"
+  "TP-Link\0"
+  "Huawei Device\0"
+  "Mist Systems\0"
+  "Axis Communications\0"
+  "CLOUD NETWORK TECHNOLOGY\0"
+  "SHENZHEN MERCURY COMMUNI\0"
+  "Sichuan Tianyi Comheart\0"
+  "Seagate Cloud Systems\0"
+  "Grass Valley, A Belden B\0"
+  "Panasonic Electric Works\0"
+  "Maxlinear\0"
+  "Shanghai Baud Data Commu\0"
+  "SHENZHEN FAST TECHNOLOGI\0"
+  "HMD Global\0"
+  "NXP Semiconductors\0"
+  "Amcrest Technologies\0"
+  "HP\0"
+  "Sunnovo International\0"
+  "Shanghai Feixun Communic\0"
+  "Guangzhou V-SOLUTION Ele\0"
+  "MITSUMI ELECTRIC\0"
+  "Amazon Technologies\0"
+  "PEGATRON\0"
+  "Netis Technology\0"
+  "Shenzhen TINNO Mobile Te\0"
+  "Ruijie Networks\0"
+  "Nokia Solutions and Netw\0"
+  "China Dragon Technology\0"
+  "Hirschmann Automation an\0"
+  "NETSCOUT SYSTEMS\0"
+  "THE FURUKAWA ELECTRIC\0"
+  "NetApp\0"
+  "Panasonic Communications\0"
+  "CLEVO\0"
+  "Renesas Electronics (Pen\0"
+  "vivo Mobile Communicatio\0"
+  "Xiaomi Communications\0"
+  "PHOENIX CONTACT Electron\0"
+  "I-O DATA DEVICE\0"
+  "Qualcomm\0"
+  "Sierra Wireless, ULC\0"
+  "YAMAHA\0"
+  "eero\0"
+  "D-Link International\0"
+  "DongGuan Siyoto Electron\0"
+  "Yichip Microelectronics\0"
+  "Motorola Mobility LLC, a\0"
+  "UNGERMANN-BASS\0"
+  "Shenzhen YOUHUA Technolo\0"
+  "New H3C Technologies\0"
+  "Hui Zhou Gaoshengda Tech\0"
+  "DENSO\0"
+  "ITEL MOBILE\0"
+  "CIG SHANGHAI\0"
+  "GUANGDONG OPPO MOBILE TE\0"
+  "Vantiva USA\0"
+  "China Mobile Group Devic\0"
+  "Resideo\0"
+  "Iskratel d.o.o\0"
+  "NAKAYO\0"
+  "Micro-Star INTL\0"
+  "PIONEER\0"
+  "LG Electronics\0"
+  "FUNAI ELECTRIC\0"
+  "CELESTICA\0"
+  "TECNO MOBILE\0"
+  "Hangzhou Hikvision Digit\0"
+  "Shenzhen Cultraview Digi\0"
+  "Arcadyan\0"
+  "Smart Innovation\0"
+  "Taicang T&W Electronics\0"
+  "Motorola (Wuhan) Mobilit\0"
+  "Shenzhen SuperElectron T\0"
+  "GoPro\0"
+  "Gionee Communication Equ\0"
+  "Shenzhenshi Xinzhongxin\0"
+  "SERNET (SUZHOU) TECHNOLO\0"
+  "Shanghai MXCHIP Informat\0"
+  "Honor Device\0"
+  "Beijing Xiaomi Electroni\0"
+  "China Mobile IOT Company\0"
+  "Barrot Technology\0"
+  "Quectel Wireless Solutio\0"
+  "FLEXTRONICS MANUFACTURIN\0"
+  "Tenda Technology Co.,Ltd\0"
+  "Shenzhen Skyworth Digita\0"
+  "ELECOM\0"
+  "AVM Audiovisuelles Marke\0"
+  "Shenzhen Jingxun Softwar\0"
+  "XIAOMI Electronics\0"
+  "GUANGDONG GENIUS TECHNOL\0"
+  "SAMSUNG ELECTRO-MECHANIC\0"
+  "GD Midea Air-Conditionin\0"
+  "Hon Hai Precision Indust\0"
+  "Qingdao Haier Technology\0"
+  "We\0"
+  "Flaircomm Microelectroni\0"
+  "Edgecore Networks\0"
+  "Infinix mobility\0"
+  "Fihonest communication\0"
+  "SIEMENS\0"
+  "Masimo\0"
+  "Vodafone Italia S.p.A\0"
+  "Shenzhen iComm Semicondu\0"
+  "SHENZHEN CHUANGWEI-RGB E\0"
+  "Espressif\0"
+  "Nokia Shanghai Bell\0"
+  "WiZ\0"
+  "Hisense broadband multim\0"
+  "INGRAM MICRO SERVICES\0"
+  "Wistron Infocomm (Zhongs\0"
+  "Flextronics Tech.(Ind) P\0"
+  "TCL King Electrical Appl\0"
+  "GN Audio A/S\0"
+  "Qingdao Hisense Communic\0"
+  "SHENZHEN BILIAN ELECTRON\0"
+  "Jiangsu Huitong Group\0"
+  "Zhejiang Dahua Technolog\0"
+  "Edifier International\0"
+  "LONGCHEER TELECOMMUNICAT\0"
+  "Tesla\0"
+  "MitraStar Technology\0"
+  "Panasonic Automotive Sys\0"
+  "TCT mobile\0"
+  "Realme Chongqing Mobile\0"
+  "The Chamberlain Group\0"
+  "CHIPSEA TECHNOLOGIES (SH\0"
+  "Cloud Network Technology\0"
+  "FN-LINK TECHNOLOGY\0"
+  "Alcatel Lucent\0"
+  "Ubee Interactive\0"
+  "Cambridge Mobile Telemat\0"
+  "EM Microelectronic\0"
+  "Integrated Device Techno\0"
+  "Technicolor Delivery Tec\0"
+  "WEIFANG GOERTEK ELECTRON\0"
+  "INGENICO TERMINALS SAS\0"
+  "Sichuan AI-Link Technolo\0"
+  "Shenzhen Sundray Technol\0"
+  "TELLESCOM INDUSTRIA E CO\0"
+  "Tuya Smart\0"
+  "Tendyron\0"
+  "Earda Technologies\0"
+  "Zhen Shi Information Tec\0"
+  "Luxshare Precision Indus\0"
+  "Zhejiang Tmall Technolog\0"
+  "New H3C Intelligence Ter\0"
+  "Baidu Online Network Tec\0"
+  "Iton Technology\0"
+  "Qingdao Intelligent&Prec\0"
+  "HUNAN FN-LINK TECHNOLOGY\0"
+  "Lenovo\0"
+  "STMicrolectronics Intern\0"
+  "Tiinlab\0"
+  "Wingtech Group (HongKong\0"
+  "Shenzhen Yipingfang Netw\0"
+  "GooWi Wireless Technolog\0"
+  "Sony Home Entertainment&\0"
+  "Remote Solution\0"
+  "ConMet\0"
+  "SERCOMM PHILIPPINES\0"
+  "Hefei Radio Communicatio\0"
+  "Shenzhen Belon Technolog\0"
+  "China Mobile Iot Limited\0"
+  "Sigmastar Technology\0"
+  "OHSUNG\0"
+  "Fitbit\0"
+  "FCNT\0"
+  "Hisense Electric\0"
+  "BYD Precision Manufactur\0"
+  "Home Control Singapore\0"
+  "CHONGQING FUGUI ELECTRON\0"
+  "Verizon\0"
+  "Valeo Vision Systems\0"
+  "Ring\0"
+  "Guangzhou Shiyuan Electr\0"
+  "Wuhan Funshion Online Te\0"
+  "1MORE\0"
+  "Sichuan tianyi kanghe co\0"
+  "Hong Kong Bouffalo Lab\0"
+  "Dongguan Liesheng Electr\0"
+  "Qorvo International\0"
+  "EDMI Europe\0"
+  "Altice Labs\0"
+  "SHENZHEN TWOWING TECHNOL\0"
+  "MERCURY COMMUNICATION TE\0"
+  "Shenzhen Qihu Intelligen\0"
+  "EliteGroup Computer Syst\0"
+  "AO\0"
+  "Shenzhen Four Seas Globa\0"
+  "TP-LINK\0"
+  "Megafone\0"
+  "ASIX Electronics\0"
+  "NXP Semiconductor (Tianj\0"
+  "China Mobile (Hangzhou)\0"
+  "AltoBeam\0"
+  "Hangzhou Ezviz Software\0"
+  "Shenzhen Bilian electron\0"
+  "YEALINK(XIAMEN) NETWORK\0"
+  "Beijing Xiaomi Mobile So\0"
+  "Phytium Technology\0"
+  "Hangzhou BroadLink Techn\0"
+  "Wanan Hongsheng Electron\0"
+  "Chipsea Technologies (Sh\0"
+  "FLEXTRONICS\0"
+  "Tonly Technology\0"
+  "Wacom\0"
+  "Shanghai High-Flying Ele\0"
+  "Bouffalo Lab (Nanjing)\0"
+  "BLU Products\0"
+  "Raspberry Pi Trading\0"
+  "ESSYS\0"
+  "Ragentek Technology Grou\0"
+  "Lemobile Information Tec\0"
+  "Shenzhen Phaten Tech\0"
+  "Sercomm France Sarl\0"
+  "Phicomm (Shanghai)\0"
+  "BBK EDUCATIONAL ELECTRON\0"
+  "Lytx\0"
+  "Sonova\0"
+  "Allwinner Technology\0"
+  "SHENZHEN FENGLIAN TECHNO\0"
+  "Wu Qi Technologies\0"
+  "DWnet Technologies(Suzho\0"
+  "Wuhan Tianyu Information\0"
+  "OnePlus Technology (Shen\0"
+  "Wyze Labs\0"
+  "Shenzhen MiaoMing Intell\0"
+  "Shenzhen SDMC Technology\0"
+  "Microsoft Mobile\0"
+  "Availink\0"
+  "Shenzhen Trolink Technol\0"
+  "Arista Network\0"
+  "Compal Broadband Network\0"
+  "Panasonic Appliances Com\0"
+  "JinQianMao Technology\0"
+  "Chengdu Quanjing Intelli\0"
+  "LEAR\0"
+  "SHENZHEN RF-LINK TECHNOL\0"
+  "Logitech Far East\0"
+  "LAVA INTERNATIONAL(H.K)\0"
+  "SZ DJI TECHNOLOGY\0"
+  "HangZhou Gubei Electroni\0"
+  "Phyplus Microelectronics\0"
+  "SIMCom Wireless Solution\0"
+  "Syrotech Networks\0"
+  "BSH Hausgeraete\0"
+  "MEIZU Technology\0"
+  "AltoBeam (China)\0"
+  "Logitech\0"
+  "Skullcandy\0"
+  "Intertech Services\0"
+  "Brother Industries\0"
+  "Vantiva - Connected Home\0"
+  "Telechips\0"
+  "Wistron InfoComm(Kunshan\0"
+  "LG ELECTRONICS\0"
+  "Telink Semiconductor (Sh\0"
+  "ZIV\0"
+  "Realme Chongqing MobileT\0"
+  "Micro-Star INT'L\0"
+  "Robert Bosch\0"
+  "LLC Proizvodstvennaya Ko\0"
+  "TAIYO YUDEN\0"
+  "Zhejiang Uniview Technol\0"
+  "Mobiwire Mobiles (NingBo\0"
+  "Nanjing Jiahao Technolog\0"
+  "Chicony Electronics\0"
+  "Siemens Industrial Autom\0"
+  "GREE ELECTRIC APPLIANCES\0"
+  "Nanjing Qinheng Microele\0"
+  "Shenzhen C-Data Technolo\0"
+  "Nutanix\0"
+  "Inventus Power Eletronic\0"
+  "Feitian Technologies\0"
+  "Sun Cupid Technology (HK\0"
+  "Hon Hai Precision IND\0"
+  "Shenzhen Coship Electron\0"
+  "YSTen Technology\0"
+  "Chiun Mai Communication\0"
+  "IEEE 1904.1 Working Grou\0"
+  "Edgecore Americas Networ\0"
+  "LGE\0"
+  "ittim\0"
+  "Shanghai Imilab Technolo\0"
+  "Beijing HuaqinWorld Tech\0"
+  "Fibocom Wireless\0"
+  "Eltex Enterprise\0"
+  "Chongqing Yipingfang Tec\0"
+  "Inspur Electronic Inform\0"
+  "Shenzhen Honesty Electro\0"
+  "Shenzhen Zowee Technolog\0"
+  "shenzhen worldelite elec\0"
+  "SERVERCOM (INDIA) PRIVAT\0"
+  "Synaptics\0"
+  "Meta Platforms Technolog\0"
+  "MCOT\0"
+  "Wingtech Mobile Communic\0"
+  "HISENSE VISUAL TECHNOLOG\0"
+  "GOIP Global Services Pvt\0"
+  "VNPT TECHNOLOGY\0"
+  "ATW TECHNOLOGY\0"
+  "Fantasia Trading\0"
+  "Shenzhen JingHanDa Elect\0"
+  "Le Shi Zhi Xin Electroni\0"
+  "MOBIWIRE MOBILES (NINGBO\0"
+  "QING DAO HAIER TELECOM\0"
+  "Comcast Cable\0"
+  "";
+
+#endif  // OUI_DB_H
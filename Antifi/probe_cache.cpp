@@ -0,0 +1,225 @@
+#include "probe_cache.h"
+
+// ===== Probe Ring State =====
+static ProbeCache probe_ring[MAX_PROBE_CACHE];
+static uint32_t probe_head_seq = 0;  // Seq of the newest probe
+
+// ===== Client Index State =====
+typedef struct {
+  mac_address_t mac;
+  uint32_t last_probe_seq;
+  mac_address_t ap_bssid;  // Valid while associated
+  bool associated;
+  bool used;
+} ProbeClientEntry;
+
+static ProbeClientEntry client_index[PROBE_INDEX_BUCKETS];
+static int client_index_count = 0;
+
+// ===== Dirty Queue State =====
+static ProbeDirty dirty_queue[PROBE_DIRTY_CAPACITY];
+static uint32_t dirty_head = 0;  // Written by the RX callback
+static uint32_t dirty_tail = 0;  // Written by loop()
+static bool dirty_overflow = false;
+
+// ===== Helpers =====
+static inline uint16_t macBucket(const uint8_t* mac) {
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < 6; i++) {
+    hash ^= mac[i];
+    hash *= 16777619u;
+  }
+  return hash & (PROBE_INDEX_BUCKETS - 1);
+}
+
+static inline ProbeCache& ringSlot(uint32_t seq) {
+  return probe_ring[(seq - 1) % MAX_PROBE_CACHE];
+}
+
+static void indexInsert(const ProbeClientEntry& entry) {
+  uint16_t b = macBucket(entry.mac.data());
+  while (client_index[b].used) {
+    b = (b + 1) & (PROBE_INDEX_BUCKETS - 1);
+  }
+  client_index[b] = entry;
+  client_index_count++;
+}
+
+// Rebuilds the index keeping the clients that still matter: first those
+// with a probe left in the ring, then associated ones while there is room
+static void indexCompact() {
+  static ProbeClientEntry keep[PROBE_INDEX_BUCKETS];
+  uint32_t tail = probeCacheTail();
+  int kept = 0;
+
+  for (int i = 0; i < PROBE_INDEX_BUCKETS; i++) {
+    const ProbeClientEntry& e = client_index[i];
+    if (e.used && e.last_probe_seq != 0 && e.last_probe_seq >= tail) {
+      keep[kept++] = e;
+    }
+  }
+  for (int i = 0; i < PROBE_INDEX_BUCKETS && kept < PROBE_INDEX_MAX_LOAD * 3 / 4; i++) {
+    const ProbeClientEntry& e = client_index[i];
+    if (e.used && e.associated && (e.last_probe_seq == 0 || e.last_probe_seq < tail)) {
+      keep[kept++] = e;
+    }
+  }
+
+  memset(client_index, 0, sizeof(client_index));
+  client_index_count = 0;
+  for (int i = 0; i < kept; i++) {
+    indexInsert(keep[i]);
+  }
+}
+
+static ProbeClientEntry* indexFind(const uint8_t* mac, bool create) {
+  uint16_t b = macBucket(mac);
+  for (int probes = 0; probes < PROBE_INDEX_BUCKETS; probes++) {
+    ProbeClientEntry& e = client_index[b];
+    if (!e.used) break;
+    if (memcmp(e.mac.data(), mac, 6) == 0) return &e;
+    b = (b + 1) & (PROBE_INDEX_BUCKETS - 1);
+  }
+  if (!create) return nullptr;
+
+  if (client_index_count >= PROBE_INDEX_MAX_LOAD) {
+    indexCompact();
+    if (client_index_count >= PROBE_INDEX_MAX_LOAD) return nullptr;
+  }
+
+  ProbeClientEntry entry;
+  memcpy(entry.mac.data(), mac, 6);
+  entry.last_probe_seq = 0;
+  entry.associated = false;
+  entry.used = true;
+  indexInsert(entry);
+  return indexFind(mac, false);
+}
+
+static void dirtyPush(const uint8_t* client_mac, const uint8_t* ap_bssid) {
+  uint32_t head = dirty_head;
+  uint32_t tail = __atomic_load_n(&dirty_tail, __ATOMIC_ACQUIRE);
+  if (head - tail >= PROBE_DIRTY_CAPACITY) {
+    dirty_overflow = true;
+    return;
+  }
+
+  ProbeDirty& d = dirty_queue[head % PROBE_DIRTY_CAPACITY];
+  memcpy(d.client_mac.data(), client_mac, 6);
+  memcpy(d.ap_bssid.data(), ap_bssid, 6);
+  __atomic_store_n(&dirty_head, head + 1, __ATOMIC_RELEASE);
+}
+
+// ===== Probe Ring =====
+void probeCacheClear() {
+  memset(probe_ring, 0, sizeof(probe_ring));
+  probe_head_seq = 0;
+  memset(client_index, 0, sizeof(client_index));
+  client_index_count = 0;
+  dirty_head = 0;
+  dirty_tail = 0;
+  dirty_overflow = false;
+}
+
+uint32_t probeCachePush(const uint8_t* client_mac, const char* ssid, uint8_t ssid_len,
+                        const uint8_t* target_bssid, int rssi, int channel, unsigned long now) {
+  uint32_t seq = probe_head_seq + 1;
+
+  ProbeClientEntry* client = indexFind(client_mac, true);
+
+  ProbeCache& p = ringSlot(seq);
+  __atomic_store_n(&p.seq, 0, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  memcpy(p.client_mac.data(), client_mac, 6);
+  if (ssid_len > 32) ssid_len = 32;
+  memcpy(p.ssid, ssid, ssid_len);
+  p.ssid[ssid_len] = '\0';
+  p.ssid_len = ssid_len;
+  p.timestamp = now;
+  p.rssi = rssi;
+  p.channel = channel;
+  p.is_hidden = false;
+  memcpy(p.target_bssid.data(), target_bssid, 6);
+
+  __atomic_store_n(&p.seq, seq, __ATOMIC_RELEASE);
+  if (client) client->last_probe_seq = seq;
+  __atomic_store_n(&probe_head_seq, seq, __ATOMIC_RELEASE);
+  return seq;
+}
+
+bool probeCacheRead(uint32_t seq, ProbeCache* out) {
+  if (seq == 0 || seq < probeCacheTail() || seq > probeCacheHead()) return false;
+
+  const ProbeCache& p = ringSlot(seq);
+  if (__atomic_load_n(&p.seq, __ATOMIC_ACQUIRE) != seq) return false;
+  *out = p;
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return __atomic_load_n(&p.seq, __ATOMIC_RELAXED) == seq;
+}
+
+uint32_t probeCacheHead() {
+  return __atomic_load_n(&probe_head_seq, __ATOMIC_ACQUIRE);
+}
+
+uint32_t probeCacheTail() {
+  uint32_t head = probeCacheHead();
+  return head > MAX_PROBE_CACHE ? head - MAX_PROBE_CACHE + 1 : 1;
+}
+
+int probeCacheCount() {
+  uint32_t head = probeCacheHead();
+  return head > MAX_PROBE_CACHE ? MAX_PROBE_CACHE : (int)head;
+}
+
+// ===== Client Index =====
+void probeIndexAssociate(const uint8_t* client_mac, const uint8_t* ap_bssid) {
+  ProbeClientEntry* client = indexFind(client_mac, true);
+  if (client && (!client->associated || memcmp(client->ap_bssid.data(), ap_bssid, 6) != 0)) {
+    memcpy(client->ap_bssid.data(), ap_bssid, 6);
+    client->associated = true;
+    dirtyPush(client_mac, ap_bssid);
+  }
+}
+
+void probeIndexDisassociate(const uint8_t* client_mac) {
+  ProbeClientEntry* client = indexFind(client_mac, false);
+  if (client) client->associated = false;
+}
+
+bool probeIndexAPFor(const uint8_t* client_mac, mac_address_t* out) {
+  ProbeClientEntry* client = indexFind(client_mac, false);
+  if (!client || !client->associated) return false;
+  *out = client->ap_bssid;
+  return true;
+}
+
+uint32_t probeIndexLatestProbe(const uint8_t* client_mac) {
+  ProbeClientEntry* client = indexFind(client_mac, false);
+  return client ? client->last_probe_seq : 0;
+}
+
+void probeIndexForEachAssociated(void (*fn)(const uint8_t* client_mac, const uint8_t* ap_bssid)) {
+  for (int i = 0; i < PROBE_INDEX_BUCKETS; i++) {
+    ProbeClientEntry e = client_index[i];
+    if (e.used && e.associated) {
+      fn(e.mac.data(), e.ap_bssid.data());
+    }
+  }
+}
+
+// ===== Dirty Queue =====
+bool probeDirtyPop(ProbeDirty* out) {
+  uint32_t tail = dirty_tail;
+  if (tail == __atomic_load_n(&dirty_head, __ATOMIC_ACQUIRE)) return false;
+
+  *out = dirty_queue[tail % PROBE_DIRTY_CAPACITY];
+  __atomic_store_n(&dirty_tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool probeDirtyOverflowed() {
+  bool overflowed = dirty_overflow;
+  dirty_overflow = false;
+  return overflowed;
+}
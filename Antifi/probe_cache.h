@@ -0,0 +1,73 @@
+#ifndef PROBE_CACHE_H
+#define PROBE_CACHE_H
+
+#include "scan.h"
+
+// ===== Configuration Constants =====
+#define PROBE_INDEX_BUCKETS 128    // Client index slots, power of two
+#define PROBE_INDEX_MAX_LOAD 96    // Compact the index above this many clients
+#define PROBE_DIRTY_CAPACITY 64    // Pending association changes between passes
+
+// ===== Probe Ring =====
+// Non-hidden probe requests go into a fixed ring addressed by a running
+// sequence number; the newest MAX_PROBE_CACHE stay readable and nothing is
+// ever shifted or erased.
+//
+// The RX callback is the only writer. Readers copy an entry out with
+// probeCacheRead(), which fails if the slot was recycled meanwhile.
+
+// Association change queued for the next hidden-AP pass
+typedef struct {
+  mac_address_t client_mac;
+  mac_address_t ap_bssid;
+} ProbeDirty;
+
+void probeCacheClear();
+
+// Appends a probe and records it as the client's newest; returns its seq
+uint32_t probeCachePush(const uint8_t* client_mac, const char* ssid, uint8_t ssid_len,
+                        const uint8_t* target_bssid, int rssi, int channel, unsigned long now);
+
+// Copies the probe with this seq; false if it is empty or was overwritten
+bool probeCacheRead(uint32_t seq, ProbeCache* out);
+
+// Seq of the newest probe (0 before the first one)
+uint32_t probeCacheHead();
+
+// Oldest seq still held by the ring
+uint32_t probeCacheTail();
+
+int probeCacheCount();
+
+// ===== Client Index =====
+// Client MAC -> newest probe seq and current AP, so reconciling a change
+// costs one lookup instead of a scan over every client and probe. The AP is
+// kept by BSSID, not by aps[] slot: slots are recycled for other BSSIDs.
+// scanAssocChanged() keeps it in step with the association graph.
+// Inserts and compaction move entries around without a lock, so lookups are
+// for the writer only: the hidden-AP pass runs from the RX callback.
+
+// Records that the client's current AP is ap_bssid and queues a change
+void probeIndexAssociate(const uint8_t* client_mac, const uint8_t* ap_bssid);
+
+// Forgets the client's AP
+void probeIndexDisassociate(const uint8_t* client_mac);
+
+// BSSID of the client's current AP; false if it has none
+bool probeIndexAPFor(const uint8_t* client_mac, mac_address_t* out);
+
+// Newest probe seq from the client, or 0
+uint32_t probeIndexLatestProbe(const uint8_t* client_mac);
+
+// Visits every indexed client that has a current AP
+void probeIndexForEachAssociated(void (*fn)(const uint8_t* client_mac, const uint8_t* ap_bssid));
+
+// ===== Dirty Queue =====
+// Filled by association changes and drained by the hidden-AP pass, both on
+// the RX path
+bool probeDirtyPop(ProbeDirty* out);
+
+// True once if changes were dropped because the queue was full
+bool probeDirtyOverflowed();
+
+#endif  // PROBE_CACHE_H
@@ -0,0 +1,139 @@
+#ifndef RANK_H
+#define RANK_H
+
+#include <Arduino.h>
+
+// ===== Ranking Configuration =====
+#define RANK_KEY_NONE INT32_MIN  // Key of an empty slot (never ranked)
+#define RANK_BY_RSSI 0           // Strongest first
+#define RANK_BY_LAST_SEEN 1      // Most recently seen first
+
+// ===== Tournament Tree =====
+// Max-tournament over record slots [0, N). Every internal node stores the
+// winning slot of its two children, so updating one record replays a single
+// leaf-to-root path (log2 N) and the best K slots can be pulled out without
+// looking at the rest of the table.
+//
+// The RX callback is the only writer. Readers may walk the tree while it is
+// being updated; they always get distinct, in-range slots but the order can
+// be momentarily stale, so callers re-check the records they print.
+template <int N>
+class RankTree {
+  static constexpr int leavesFor(int n) {
+    return n <= 1 ? 1 : 2 * leavesFor((n + 1) / 2);
+  }
+  static constexpr int LEAVES = leavesFor(N);
+
+public:
+  RankTree() {
+    clear();
+  }
+
+  void clear() {
+    for (int i = 0; i < LEAVES; i++) {
+      keys[i] = RANK_KEY_NONE;
+      winner[LEAVES + i] = i;
+    }
+    for (int node = LEAVES - 1; node >= 1; node--) {
+      winner[node] = winner[2 * node];
+    }
+  }
+
+  void update(int slot, int32_t key) {
+    if (slot < 0 || slot >= N) return;
+    keys[slot] = key;
+    for (int node = (LEAVES + slot) >> 1; node >= 1; node >>= 1) {
+      int16_t left = winner[2 * node];
+      int16_t right = winner[2 * node + 1];
+      winner[node] = beats(right, left) ? right : left;
+    }
+  }
+
+  void remove(int slot) {
+    update(slot, RANK_KEY_NONE);
+  }
+
+  int32_t key(int slot) const {
+    return (slot >= 0 && slot < N) ? keys[slot] : RANK_KEY_NONE;
+  }
+
+  int best() const {
+    int16_t top = winner[1];
+    return keys[top] == RANK_KEY_NONE ? -1 : top;
+  }
+
+  // Yields ranked slots best-first. Each next() costs O(log N); a walk that
+  // stops after K slots never visits the other N - K records.
+  class Walker {
+  public:
+    explicit Walker(const RankTree& tree)
+      : tree(tree), heap_size(0) {
+      reset();
+    }
+
+    void reset() {
+      heap_size = 0;
+      push(1);
+    }
+
+    int next() {
+      while (heap_size > 0) {
+        int16_t node = pop();
+        int16_t slot = tree.winner[node];
+        if (tree.keys[slot] == RANK_KEY_NONE) continue;
+        if (node >= LEAVES) return node - LEAVES;
+        push(2 * node);
+        push(2 * node + 1);
+      }
+      return -1;
+    }
+
+  private:
+    const RankTree& tree;
+    int16_t heap[2 * LEAVES];
+    int heap_size;
+
+    bool better(int16_t a, int16_t b) const {
+      return tree.beats(tree.winner[a], tree.winner[b]);
+    }
+
+    void push(int16_t node) {
+      if (heap_size >= 2 * LEAVES) return;
+      int i = heap_size++;
+      heap[i] = node;
+      while (i > 0 && better(heap[i], heap[(i - 1) / 2])) {
+        std::swap(heap[i], heap[(i - 1) / 2]);
+        i = (i - 1) / 2;
+      }
+    }
+
+    int16_t pop() {
+      int16_t top = heap[0];
+      heap[0] = heap[--heap_size];
+      int i = 0;
+      while (true) {
+        int l = 2 * i + 1;
+        int r = l + 1;
+        int m = i;
+        if (l < heap_size && better(heap[l], heap[m])) m = l;
+        if (r < heap_size && better(heap[r], heap[m])) m = r;
+        if (m == i) break;
+        std::swap(heap[i], heap[m]);
+        i = m;
+      }
+      return top;
+    }
+  };
+
+private:
+  int32_t keys[LEAVES];
+  int16_t winner[2 * LEAVES];  // winner[1] is the root, leaves start at LEAVES
+
+  // Higher key wins; ties go to the lower slot so the order is stable
+  bool beats(int16_t a, int16_t b) const {
+    if (keys[a] != keys[b]) return keys[a] > keys[b];
+    return a < b;
+  }
+};
+
+#endif  // RANK_H
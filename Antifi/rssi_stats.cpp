@@ -0,0 +1,38 @@
+#include "rssi_stats.h"
+
+// ===== Noise Floor State =====
+#define NOISE_EWMA_SHIFT 4  // The floor moves slowly; alpha = 1/16
+
+static RssiStats noise[RSSI_CHANNELS];  // Written by the RX callback
+
+// ===== Histogram Output =====
+void rssiStatsPrint(const RssiStats& s) {
+  uint8_t peak = 1;
+  for (int b = 0; b < RSSI_HIST_BUCKETS; b++) peak = max(peak, s.hist[b]);
+
+  for (int b = RSSI_HIST_BUCKETS - 1; b >= 0; b--) {
+    if (s.hist[b] == 0) continue;
+    char bar[33];
+    int len = (s.hist[b] * 32 + peak - 1) / peak;
+    memset(bar, '#', len);
+    bar[len] = '\0';
+    if (b == 0) Serial.printf("  < %4d dBm | %3u | %s\n", RSSI_HIST_LOW, s.hist[b], bar);
+    else Serial.printf("  %4d dBm   | %3u | %s\n", rssiHistBucketLow(b), s.hist[b], bar);
+  }
+}
+
+// ===== Noise Floor =====
+void rssiNoiseFloorClear() {
+  memset(noise, 0, sizeof(noise));
+}
+
+void rssiNoiseFloorAdd(int channel, int noise_floor) {
+  if (channel < 1 || channel >= RSSI_CHANNELS || noise_floor == 0) return;  // 0: not reported
+  rssiStatsAdd(noise[channel], rssiNormalize(noise_floor), NOISE_EWMA_SHIFT);
+}
+
+int rssiNoiseFloor(int channel) {
+  if (channel < 1 || channel >= RSSI_CHANNELS) return 0;
+  RssiStats s = noise[channel];
+  return s.samples ? rssiStatsValue(s) : 0;
+}
@@ -0,0 +1,104 @@
+#ifndef RSSI_STATS_H
+#define RSSI_STATS_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define RSSI_MIN_DBM -100
+#define RSSI_MAX_DBM 0
+#define RSSI_FRAC_BITS 4           // EWMA kept in 1/16 dBm
+#define RSSI_EWMA_SHIFT_DEFAULT 2  // alpha = 1/4
+#define RSSI_EWMA_SHIFT_MAX 6      // alpha = 1/64
+#define RSSI_HIST_BUCKETS 16
+#define RSSI_HIST_LOW -95          // Bucket 0 is everything below -95 dBm
+#define RSSI_HIST_STEP 5           // dB per bucket; bucket 15 is -25 dBm and up
+#define RSSI_CHANNELS 15           // Noise floor per channel, [0] unused
+
+// ===== Normalization =====
+// The one place raw RSSI values are turned into dBm. rx_ctrl.rssi is a
+// signed 8-bit field, but values also arrive sign-stripped or sign-extended
+// from older paths; all of them end up in [-100, 0].
+static inline int8_t rssiNormalize(int raw) {
+  if (raw > 127 || raw < -128) raw = (int8_t)raw;  // Wrapped 8-bit value
+  if (raw > 0) raw = -raw;                          // Magnitude without sign
+  if (raw < RSSI_MIN_DBM) raw = RSSI_MIN_DBM;
+  if (raw > RSSI_MAX_DBM) raw = RSSI_MAX_DBM;
+  return (int8_t)raw;
+}
+
+// ===== RSSI Statistics =====
+// Fixed-point EWMA, min/max and a 16-byte histogram; 22 bytes per record.
+// The EWMA runs as a plain mean for the first 2^shift samples so it neither
+// starts biased toward the first frame nor truncates toward zero. dBm is
+// already logarithmic, so the equal-width buckets are log-spaced in power.
+// Histogram counters saturate by halving every bucket, which keeps the shape
+// and slowly forgets old samples.
+typedef struct {
+  int16_t ewma;     // dBm << RSSI_FRAC_BITS
+  int8_t last;
+  int8_t min;
+  int8_t max;
+  uint8_t samples;  // Saturates at 255
+  uint8_t hist[RSSI_HIST_BUCKETS];
+} RssiStats;
+
+static inline void rssiStatsReset(RssiStats& s) {
+  memset(&s, 0, sizeof(s));
+}
+
+static inline int rssiHistBucket(int dbm) {
+  int b = (dbm - RSSI_HIST_LOW + RSSI_HIST_STEP) / RSSI_HIST_STEP;
+  if (b < 0) return 0;
+  return b >= RSSI_HIST_BUCKETS ? RSSI_HIST_BUCKETS - 1 : b;
+}
+
+// Lowest dBm counted in bucket `b` (bucket 0 is open-ended)
+static inline int rssiHistBucketLow(int b) {
+  return b == 0 ? RSSI_MIN_DBM : RSSI_HIST_LOW + (b - 1) * RSSI_HIST_STEP;
+}
+
+static inline void rssiStatsAdd(RssiStats& s, int8_t dbm, uint8_t shift) {
+  int32_t sample = (int32_t)dbm << RSSI_FRAC_BITS;
+  if (s.samples == 0) {
+    s.ewma = sample;
+    s.min = dbm;
+    s.max = dbm;
+  } else {
+    // 1/n while warming up, then 1/2^shift; rounded, not truncated
+    int32_t n = s.samples + 1;
+    int32_t delta = sample - s.ewma;
+    if (n < (1 << shift)) {
+      s.ewma += (delta >= 0 ? delta + n / 2 : delta - n / 2) / n;
+    } else {
+      s.ewma += (delta + (1 << (shift - 1))) >> shift;
+    }
+    if (dbm < s.min) s.min = dbm;
+    if (dbm > s.max) s.max = dbm;
+  }
+  s.last = dbm;
+  if (s.samples < 255) s.samples++;
+
+  uint8_t& bucket = s.hist[rssiHistBucket(dbm)];
+  if (bucket == 255) {
+    for (int i = 0; i < RSSI_HIST_BUCKETS; i++) s.hist[i] >>= 1;
+  }
+  bucket++;
+}
+
+// Smoothed RSSI in whole dBm (rounded)
+static inline int rssiStatsValue(const RssiStats& s) {
+  return (s.ewma + (1 << (RSSI_FRAC_BITS - 1))) >> RSSI_FRAC_BITS;
+}
+
+// Prints the histogram as one bar row per non-empty bucket
+void rssiStatsPrint(const RssiStats& s);
+
+// ===== Noise Floor =====
+// Per-channel EWMA of rx_ctrl.noise_floor, fed by the RX callback.
+void rssiNoiseFloorClear();
+void rssiNoiseFloorAdd(int channel, int noise_floor);
+
+// Smoothed noise floor in dBm, 0 if the channel has no samples yet
+int rssiNoiseFloor(int channel);
+
+#endif  // RSSI_STATS_H
@@ -0,0 +1,313 @@
+#include "rx_bus.h"
+#include "rssi_stats.h"
+
+// ===== Bus State =====
+enum {
+  SUB_FREE,
+  SUB_ACTIVE,
+  SUB_PAUSED,
+};
+
+typedef struct {
+  RxSubscription sub;
+  uint8_t state;  // Published last by the loop, read by the RX callback
+  uint8_t claim;
+  uint8_t claim_channel;
+  uint8_t priority;
+  uint32_t claim_order;  // Earlier claims win priority ties
+
+  // Written by the RX callback
+  uint32_t delivered;
+  uint32_t filtered;
+  uint64_t cycles;
+} Subscriber;
+
+static Subscriber subs[RX_BUS_MAX_SUBSCRIBERS];
+static bool radio_up = false;
+static volatile uint8_t tuned = 1;
+static uint32_t claim_counter = 0;
+
+// Written by the RX callback
+static uint32_t bus_frames = 0;
+static uint32_t bus_undecoded = 0;
+static uint64_t bus_cycles = 0;  // Decode + fan-out
+static uint64_t decode_cycles = 0;
+static uint32_t bus_cycles_max = 0;
+
+// Odd while the callback is dispatching a frame; bumped on entry and exit
+static uint32_t dispatch_gen = 0;
+
+static inline uint8_t subState(int id) {
+  return __atomic_load_n(&subs[id].state, __ATOMIC_ACQUIRE);
+}
+
+static inline bool validId(int id) {
+  return id >= 0 && id < RX_BUS_MAX_SUBSCRIBERS && subState(id) != SUB_FREE;
+}
+
+// ===== RX Callback =====
+// The only promiscuous callback in the sketch: one decode, then every
+// subscriber whose filters pass, in slot order.
+static void rxBusCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
+  // Entry is ordered before the state loads below, so quiesce() either sees
+  // this dispatch in flight or the dispatch sees the new state
+  __atomic_add_fetch(&dispatch_gen, 1, __ATOMIC_SEQ_CST);
+  uint32_t start = ESP.getCycleCount();
+  const wifi_promiscuous_pkt_t* pkt = (const wifi_promiscuous_pkt_t*)buf;
+
+  RxFrame rx;
+  rx.pkt = pkt;
+  rx.type = type;
+  rx.decoded = type != WIFI_PKT_MISC &&
+               frameDecode(pkt->payload, pkt->rx_ctrl.sig_len, rssiNormalize(pkt->rx_ctrl.rssi), tuned, &rx.view);
+  if (rx.decoded) {
+    rssiNoiseFloorAdd(rx.view.channel, pkt->rx_ctrl.noise_floor);
+  } else {
+    bus_undecoded++;
+  }
+  decode_cycles += ESP.getCycleCount() - start;
+
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    Subscriber& s = subs[i];
+    if (subState(i) != SUB_ACTIVE) continue;
+
+    bool wanted = (s.sub.pkt_types & RX_PKT_BIT(type)) && pkt->rx_ctrl.rssi >= s.sub.min_rssi &&
+                  (rx.decoded ? (s.sub.keys >> rx.view.key) & 1 : s.sub.raw);
+    if (!wanted) {
+      s.filtered++;
+      continue;
+    }
+
+    uint32_t t = ESP.getCycleCount();
+    s.sub.fn(rx);
+    s.cycles += ESP.getCycleCount() - t;
+    s.delivered++;
+  }
+
+  uint32_t cycles = ESP.getCycleCount() - start;
+  bus_frames++;
+  bus_cycles += cycles;
+  if (cycles > bus_cycles_max) bus_cycles_max = cycles;
+  __atomic_add_fetch(&dispatch_gen, 1, __ATOMIC_RELEASE);
+}
+
+// Waits out a dispatch that may have read a subscriber's old state. The
+// callback runs on the Wi-Fi task, possibly on the other core, and a frame's
+// fan-out takes microseconds, so spinning is cheaper than any handshake.
+// Never call from a handler: it would wait for itself.
+static void quiesce() {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  uint32_t gen = __atomic_load_n(&dispatch_gen, __ATOMIC_SEQ_CST);
+  if (!(gen & 1)) return;
+  while (__atomic_load_n(&dispatch_gen, __ATOMIC_ACQUIRE) == gen) {
+  }
+}
+
+// ===== Radio =====
+static void tune(uint8_t channel) {
+  if (channel < 1 || channel > 14) return;
+  tuned = channel;
+  if (radio_up) esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
+}
+
+// STA mode: promiscuous capture works in it and so do driver scans
+static void radioUp() {
+  WiFi.mode(WIFI_STA);
+  WiFi.disconnect();
+  delay(100);
+
+  wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+  esp_wifi_init(&cfg);
+  esp_wifi_set_storage(WIFI_STORAGE_RAM);
+  esp_wifi_stop();
+
+  esp_wifi_set_mode(WIFI_MODE_STA);
+  esp_wifi_start();
+
+  esp_wifi_set_promiscuous_rx_cb(&rxBusCallback);
+  esp_wifi_set_promiscuous(true);
+  radio_up = true;
+  tune(tuned);
+
+  bus_frames = 0;
+  bus_undecoded = 0;
+  bus_cycles = 0;
+  decode_cycles = 0;
+  bus_cycles_max = 0;
+}
+
+// ===== Subscribers =====
+int rxBusSubscribe(const RxSubscription& sub) {
+  int id = -1;
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    if (subState(i) == SUB_FREE) {
+      id = i;
+      break;
+    }
+  }
+  if (id < 0 || !sub.fn) return -1;
+
+  // Another mode may have reconfigured Wi-Fi since the bus went idle
+  if (!rxBusActive()) radioUp();
+
+  // A free slot was quiesced when it was released, and the callback skips it
+  // until the state store below publishes the new subscription
+  Subscriber& s = subs[id];
+  s.sub = sub;
+  s.claim = RX_CHAN_NONE;
+  s.claim_channel = 0;
+  s.priority = 0;
+  s.delivered = 0;
+  s.filtered = 0;
+  s.cycles = 0;
+  __atomic_store_n(&s.state, (uint8_t)SUB_ACTIVE, __ATOMIC_RELEASE);
+  return id;
+}
+
+void rxBusUnsubscribe(int id) {
+  if (!validId(id)) return;
+  __atomic_store_n(&subs[id].state, (uint8_t)SUB_FREE, __ATOMIC_SEQ_CST);
+  quiesce();
+  subs[id].claim = RX_CHAN_NONE;
+
+  if (!rxBusActive() && radio_up) {
+    esp_wifi_set_promiscuous(false);
+    radio_up = false;
+  }
+}
+
+void rxBusSetPaused(int id, bool paused) {
+  if (!validId(id)) return;
+  __atomic_store_n(&subs[id].state, (uint8_t)(paused ? SUB_PAUSED : SUB_ACTIVE), __ATOMIC_SEQ_CST);
+  if (paused) quiesce();
+}
+
+void rxBusSetMinRssi(int id, int8_t min_rssi) {
+  if (!validId(id)) return;
+  subs[id].sub.min_rssi = min_rssi;
+}
+
+int rxBusOthers(int id) {
+  int n = 0;
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    if (i != id && subState(i) != SUB_FREE) n++;
+  }
+  return n;
+}
+
+bool rxBusActive() {
+  return rxBusOthers(-1) > 0;
+}
+
+void rxBusReset() {
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    __atomic_store_n(&subs[i].state, (uint8_t)SUB_FREE, __ATOMIC_SEQ_CST);
+    subs[i].claim = RX_CHAN_NONE;
+  }
+  quiesce();
+  radio_up = false;
+}
+
+// ===== Channel Arbitration =====
+static int fixedOwner() {
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    if (subState(i) != SUB_FREE && subs[i].claim == RX_CHAN_FIXED) return i;
+  }
+  return -1;
+}
+
+static int hopOwner() {
+  if (fixedOwner() >= 0) return -1;
+  int best = -1;
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    const Subscriber& s = subs[i];
+    if (subState(i) == SUB_FREE || s.claim != RX_CHAN_HOP) continue;
+    if (best < 0 || s.priority > subs[best].priority ||
+        (s.priority == subs[best].priority && s.claim_order < subs[best].claim_order)) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+bool rxBusClaimChannel(int id, RxChannelClaim claim, uint8_t channel, uint8_t priority) {
+  if (!validId(id)) return false;
+  Subscriber& s = subs[id];
+
+  if (claim == RX_CHAN_FIXED) {
+    if (channel < 1 || channel > 14) return false;
+    int owner = fixedOwner();
+    if (owner >= 0 && owner != id && subs[owner].claim_channel != channel) return false;
+    tune(channel);
+  }
+  s.claim = claim;
+  s.claim_channel = claim == RX_CHAN_FIXED ? channel : 0;
+  s.priority = priority;
+  s.claim_order = ++claim_counter;
+  return true;
+}
+
+bool rxBusMayHop(int id) {
+  return validId(id) && hopOwner() == id;
+}
+
+bool rxBusSetChannel(int id, uint8_t channel) {
+  if (!rxBusMayHop(id)) return false;
+  tune(channel);
+  return true;
+}
+
+uint8_t rxBusChannel() {
+  return tuned;
+}
+
+// ===== Report =====
+static const char* claimName(uint8_t claim) {
+  switch (claim) {
+    case RX_CHAN_HOP: return "hop";
+    case RX_CHAN_FIXED: return "fixed";
+    default: return "-";
+  }
+}
+
+void rxBusReport() {
+  uint32_t frames = bus_frames;
+  uint32_t mhz = ESP.getCpuFreqMHz();
+  int fixed = fixedOwner();
+  int hopper = hopOwner();
+
+  Serial.println("\n=== RX BUS ===");
+  Serial.printf("Radio: %s | Channel: %u", radio_up ? "promiscuous" : "off", tuned);
+  if (fixed >= 0) Serial.printf(" (pinned by %s)", subs[fixed].sub.name);
+  else if (hopper >= 0) Serial.printf(" (hopping: %s)", subs[hopper].sub.name);
+  Serial.println();
+
+  if (frames == 0) {
+    Serial.println("No frames received yet");
+  } else {
+    uint32_t avg = bus_cycles / frames;
+    Serial.printf("Frames: %lu | Undecoded: %lu | Cycles/frame: %lu avg (%lu decode), %lu max | %.1f us avg at %lu MHz\n",
+                  (unsigned long)frames, (unsigned long)bus_undecoded, (unsigned long)avg,
+                  (unsigned long)(decode_cycles / frames), (unsigned long)bus_cycles_max,
+                  mhz ? (float)avg / mhz : 0.0f, (unsigned long)mhz);
+  }
+
+  if (!rxBusActive()) {
+    Serial.println("No subscribers");
+    return;
+  }
+  Serial.println("Id | Subscriber | State  | Channel  | Delivered | Filtered | Cycles/frame");
+  Serial.println("--------------------------------------------------------------------------");
+  for (int i = 0; i < RX_BUS_MAX_SUBSCRIBERS; i++) {
+    const Subscriber& s = subs[i];
+    uint8_t state = subState(i);
+    if (state == SUB_FREE) continue;
+
+    char claim[12];
+    if (s.claim == RX_CHAN_FIXED) snprintf(claim, sizeof(claim), "fixed %u", s.claim_channel);
+    else strcpy(claim, claimName(s.claim));
+    Serial.printf("%2d | %-10s | %-6s | %-8s | %9lu | %8lu | %lu\n", i, s.sub.name,
+                  state == SUB_PAUSED ? "paused" : "active", claim, (unsigned long)s.delivered,
+                  (unsigned long)s.filtered, (unsigned long)(s.delivered ? s.cycles / s.delivered : 0));
+  }
+}
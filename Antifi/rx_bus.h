@@ -0,0 +1,91 @@
+#ifndef RX_BUS_H
+#define RX_BUS_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "esp_wifi.h"
+#include "frame_view.h"
+
+// ===== Configuration Constants =====
+#define RX_BUS_MAX_SUBSCRIBERS 6
+#define RX_KEYS_ALL (~0ULL)
+
+// wifi_promiscuous_pkt_type_t as filter bits
+#define RX_PKT_BIT(type) (1u << (type))
+#define RX_PKT_MGMT RX_PKT_BIT(WIFI_PKT_MGMT)
+#define RX_PKT_DATA RX_PKT_BIT(WIFI_PKT_DATA)
+#define RX_PKT_CTRL RX_PKT_BIT(WIFI_PKT_CTRL)
+#define RX_PKT_ALL (RX_PKT_MGMT | RX_PKT_DATA | RX_PKT_CTRL | RX_PKT_BIT(WIFI_PKT_MISC))
+
+// Hop priorities: the highest hopping claimant drives the radio
+#define RX_HOP_PRIO_SNIFF 10
+#define RX_HOP_PRIO_SCAN 20  // The adaptive scheduler beats a plain sweep
+
+// ===== Received Frame =====
+// What every subscriber gets: the driver packet (for raw writers) and the one
+// shared decode. `decoded` is false for frames frameDecode() rejects; those
+// only reach subscribers with `raw` set.
+typedef struct {
+  const wifi_promiscuous_pkt_t* pkt;
+  wifi_promiscuous_pkt_type_t type;
+  bool decoded;
+  FrameView view;
+} RxFrame;
+
+typedef void (*RxHandler)(const RxFrame& rx);
+
+// ===== Subscribers =====
+// Filters run in the bus before the handler is called, cheapest first:
+// packet type, RSSI floor, frame keys.
+typedef struct {
+  const char* name;
+  uint8_t pkt_types;  // RX_PKT_* bits
+  uint64_t keys;      // FRAME_BIT()s wanted, RX_KEYS_ALL for everything
+  int8_t min_rssi;    // Raw rx_ctrl.rssi floor, -128 for none
+  bool raw;           // Also deliver frames that failed to decode
+  RxHandler fn;
+} RxSubscription;
+
+// ===== Channel Claims =====
+// A fixed claim pins the radio and suspends every hopper; the first fixed
+// claim wins and later conflicting ones are refused. Without one, the
+// highest-priority hop claimant (earliest on a tie) owns retuning and the
+// rest follow rxBusChannel().
+typedef enum {
+  RX_CHAN_NONE,   // Listens wherever the radio is
+  RX_CHAN_HOP,    // Wants to sweep
+  RX_CHAN_FIXED,  // Needs one channel
+} RxChannelClaim;
+
+// ===== Public API =====
+// Returns a subscriber id, or -1 when the bus is full. The first subscriber
+// brings the radio up in promiscuous mode; later ones join the running bus.
+int rxBusSubscribe(const RxSubscription& sub);
+// The last unsubscribe turns promiscuous mode off. Returns once the handler
+// can no longer be running, so its state may be freed or reused right after.
+void rxBusUnsubscribe(int id);
+// Pauses delivery to one subscriber without giving up its slot or claim.
+// Pausing returns once the handler is idle: until it resumes, the caller
+// owns whatever the handler writes.
+void rxBusSetPaused(int id, bool paused);
+void rxBusSetMinRssi(int id, int8_t min_rssi);
+
+// False when a conflicting fixed claim holds the radio
+bool rxBusClaimChannel(int id, RxChannelClaim claim, uint8_t channel = 0, uint8_t priority = 0);
+// True if `id` is the one allowed to retune right now
+bool rxBusMayHop(int id);
+// Retunes if `id` may hop; false (radio untouched) otherwise
+bool rxBusSetChannel(int id, uint8_t channel);
+uint8_t rxBusChannel();
+
+// Subscribers other than `id`; used to avoid stalling them (driver scans)
+int rxBusOthers(int id);
+bool rxBusActive();
+
+// Forgets the radio state when another mode takes Wi-Fi down
+void rxBusReset();
+
+// Per-subscriber delivery, filter and cycle counts (rx stats)
+void rxBusReport();
+
+#endif  // RX_BUS_H
@@ -1,25 +1,76 @@
 #include "scan.h"
+#include "probe_cache.h"
+#include "assoc_graph.h"
+#include "device_count.h"
+#include "scan_events.h"
+#include "scan_journal.h"
+#include "scan_query.h"
+#include "scan_store.h"
+#include "sketch.h"
 
 using namespace std;
 
 // ===== Global Variable Definitions =====
-vector<APInfo> ap_list;
-vector<ClientInfo> client_list;
-vector<SSIDInfo> ssid_list;
-vector<ProbeCache> probe_cache;
-vector<ClientAssociation> client_associations;
+ScanPool<ClientInfo> client_list;
 APInfo aps[MAX_APS];
 int ap_count = 0;
 ScanState scan;
+uint32_t ap_table_seq = 0;
+uint32_t client_table_seq = 0;
 
-// ===== Preferences for persistent storage =====
-Preferences preferences;
-const char* SCAN_PREFS_NAMESPACE = "wifi_scan";
-const char* AP_COUNT_KEY = "ap_count";
+// ===== Display rankings (written by the RX path, walked by display) =====
+static RankTree<MAX_APS> ap_rank;
+static RankTree<MAX_CLIENTS> client_rank;
+static RankTree<MAX_APS>::Walker ap_walker(ap_rank);
+static RankTree<MAX_CLIENTS>::Walker client_walker(client_rank);
 
 // ===== Track printed networks to avoid duplicates =====
-vector<String> printed_bssids;
-vector<String> printed_client_macs;
+// A table holds at most MAX_APS rows: 1024 bits and 5 probes keep false
+// positives around 1% at that fill, in 128 bytes instead of a BSSID list
+#define PRINTED_FILTER_BITS 1024
+#define PRINTED_FILTER_HASHES 5
+static BloomFilter<PRINTED_FILTER_BITS, PRINTED_FILTER_HASHES> printed_bssids;
+
+// ===== SSID History Pool =====
+// Per-client SSID histories are chains in one shared pool. Entries are
+// handed out from the free list first, then from the never-used tail, so a
+// reset is O(1).
+static SSIDHistory* ssid_history_pool = nullptr;
+static uint16_t ssid_history_free = SSID_HISTORY_NONE;
+static uint16_t ssid_history_unused = 0;  // Entries below this were handed out once
+static uint16_t ssid_history_live = 0;
+static unsigned long ssid_history_dropped = 0;
+
+// ===== Heap Baseline =====
+// Taken when a scan starts; the heap report compares against it
+static uint32_t scan_heap_ops_at_start = 0;
+static size_t scan_heap_free_at_start = 0;
+static size_t scan_heap_largest_at_start = 0;
+static size_t scan_heap_blocks_at_start = 0;
+static size_t scan_heap_free_blocks_at_start = 0;
+
+#if SCAN_ALLOC_TRACE
+// Heap block drift across each scanFrame() call, since scan start. Blocks a
+// frame allocates and frees again cancel out; what shows is what the frame
+// left in the tables (or what another task allocated meanwhile).
+static uint32_t alloc_trace_frames = 0;
+static uint32_t alloc_trace_changed = 0;  // Frames whose block count moved
+static int32_t alloc_trace_blocks = 0;    // Net blocks over all frames
+static int32_t alloc_trace_max = 0;       // Most blocks left by one frame
+#endif
+
+// ===== Client Index =====
+// MAC -> client_list slot (open addressing). Kept in step with every move in
+// client_list so the per-frame client lookup never scans the list.
+#define CLIENT_INDEX_BUCKETS 1024  // Power of two, > 2x MAX_CLIENTS
+static uint16_t client_slots[CLIENT_INDEX_BUCKETS];  // Slot + 1, 0 = empty
+
+// ===== AP Index =====
+// BSSID -> aps slot, same scheme as the client index. Follows slot recycling
+// in findOrCreateAP(); writer context only, like the association graph.
+#define AP_INDEX_BUCKETS 256  // Power of two, > 2x MAX_APS
+static uint8_t ap_slots[AP_INDEX_BUCKETS];  // Slot + 1, 0 = empty
+static_assert(MAX_APS < 256, "AP index stores slot + 1 in a byte");
 
 // ===== Timing Variables =====
 unsigned long last_scan = 0;
@@ -29,26 +80,23 @@ unsigned long channel_switch_time = 0;
 // ===== Configuration =====
 const int CHANNEL_SWITCH_INTERVAL = 500;
 const int TOTAL_CHANNELS = 14;
-const int MAX_CLIENT_AGE_MS = 5000;
 const int CLIENT_CLEANUP_INTERVAL = 5000;
 const int MINIMUM_RSSI = -95;
 const int MIN_PACKET_SIZE = 24;
 const int PROBE_CACHE_CHECK_INTERVAL = 1000;
+const unsigned long TIMER_IDLE_ADVANCE_MS = 1000;  // loop() ages records when no frame did for this long
 
 // ===== Statistics =====
 unsigned long total_probe_requests = 0;
 unsigned long total_beacons = 0;
+unsigned long beacons_parsed = 0;
+unsigned long beacons_skipped = 0;
 unsigned long total_data_frames = 0;
 unsigned long total_management_frames = 0;
 unsigned long hidden_ap_revealed = 0;
 unsigned long total_client_packets = 0;
 unsigned long total_association_frames = 0;
 
-// ===== SSID Statistics =====
-std::map<String, int> ssid_probe_counts;
-std::map<String, std::vector<mac_address_t>> ssid_client_map;
-std::map<String, unsigned long> ssid_last_seen;
-
 // ===== Helper Functions =====
 
 mac_address_t arrayToMac(const uint8_t* mac) {
@@ -61,20 +109,13 @@ void macToArray(const mac_address_t& mac_struct, uint8_t* mac) {
   std::copy(mac_struct.begin(), mac_struct.end(), mac);
 }
 
-String macToString(const uint8_t* mac) {
-  char buf[18];
-  snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
+void formatMAC(const uint8_t* mac, char* out) {
+  snprintf(out, 18, "%02X:%02X:%02X:%02X:%02X:%02X",
            mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-  return String(buf);
 }
 
-String getVendorFromMAC(const uint8_t* mac) {
-  for (int i = 0; i < sizeof(vendor_oui_list) / sizeof(vendor_oui_list[0]); i++) {
-    if (vendor_oui_list[i].oui[0] == mac[0] && vendor_oui_list[i].oui[1] == mac[1] && vendor_oui_list[i].oui[2] == mac[2]) {
-      return String(vendor_oui_list[i].vendor);
-    }
-  }
-  return "Unknown";
+const char* getVendorFromMAC(const uint8_t* mac) {
+  return ouiVendor(mac);
 }
 
 bool compareMAC(const mac_address_t& mac1, const uint8_t* mac2) {
@@ -147,10 +188,6 @@ const char* getCompleteEncryptionType(wifi_auth_mode_t auth) {
   }
 }
 
-String getEncryptionType(wifi_auth_mode_t encryptionType) {
-  return getCompleteEncryptionType(encryptionType);
-}
-
 // ===== MAC Address Validation =====
 bool isBroadcastMAC(const uint8_t* mac) {
   return (mac[0] == 0xFF && mac[1] == 0xFF && mac[2] == 0xFF && mac[3] == 0xFF && mac[4] == 0xFF && mac[5] == 0xFF);
@@ -216,7 +253,7 @@ bool isManagementFrame(const uint8_t* frame_ctrl) {
   return (type == FRAME_TYPE_MANAGEMENT);
 }
 
-String getFrameTypeString(uint8_t frame_type, uint8_t frame_subtype) {
+const char* getFrameTypeString(uint8_t frame_type, uint8_t frame_subtype) {
   if (frame_type == FRAME_TYPE_MANAGEMENT) {
     switch (frame_subtype) {
       case SUBTYPE_PROBE_REQUEST: return "PROBE_REQ";
@@ -329,7 +366,7 @@ uint8_t extractSSIDFromFrame(const uint8_t* frame, uint16_t frame_len, char* ssi
   return extractSSIDFromFrame(frame, frame_len, ssid_out, FRAME_TYPE_MANAGEMENT, SUBTYPE_BEACON, &is_hidden);
 }
 
-String formatSSID(const char* ssid_data, uint8_t ssid_len) {
+const char* formatSSID(const char* ssid_data, uint8_t ssid_len, char* out) {
   if (ssid_len == 0 || ssid_data == NULL) {
     return "[Hidden]";
   }
@@ -357,22 +394,22 @@ String formatSSID(const char* ssid_data, uint8_t ssid_len) {
   }
 
   if (printable) {
-    char printable_str[33] = { 0 };
-    memcpy(printable_str, ssid_data, min((int)ssid_len, 32));
-    return String(printable_str);
+    int n = min((int)ssid_len, 32);
+    memcpy(out, ssid_data, n);
+    out[n] = '\0';
+    return out;
   }
 
   // Show hex representation for non-printable SSIDs
-  char hex_str[65] = { 0 };
+  out[0] = '\0';
   int len_to_show = min((int)ssid_len, 4);
   for (int i = 0; i < len_to_show; i++) {
-    sprintf(hex_str + (i * 2), "%02X", (uint8_t)ssid_data[i]);
+    sprintf(out + (i * 2), "%02X", (uint8_t)ssid_data[i]);
   }
   if (ssid_len > 4) {
-    strcat(hex_str, "..");
+    strcat(out, "..");
   }
-
-  return String(hex_str);
+  return out;
 }
 
 // ===== Complete Encryption Detection (Compatible) =====
@@ -501,12 +538,14 @@ void processProbeRequestForHiddenAPs(const uint8_t* frame, uint16_t frame_len,
 
   // Debug output
   if (scan.probe_debug && !is_hidden && ssid_len > 0) {
-    String target_str = isBroadcastMAC(target_bssid) ? "Broadcast" : macToString(target_bssid);
+    char client_str[18], target_str[18] = "Broadcast";
+    formatMAC(client_mac, client_str);
+    if (!isBroadcastMAC(target_bssid)) formatMAC(target_bssid, target_str);
     Serial.printf("[Probe] Client: %s -> SSID: %s (Len: %d) -> Target: %s (RSSI: %d, Ch: %d)\n",
-                  macToString(client_mac).c_str(),
+                  client_str,
                   ssid,
                   ssid_len,
-                  target_str.c_str(),
+                  target_str,
                   rssi,
                   channel);
   }
@@ -516,142 +555,274 @@ void processProbeRequestForHiddenAPs(const uint8_t* frame, uint16_t frame_len,
     return;
   }
 
-  // Cache the probe request
-  ProbeCache probe;
-  probe.client_mac = arrayToMac(client_mac);
-  strncpy(probe.ssid, ssid, 32);
-  probe.ssid_len = ssid_len;
-  probe.timestamp = millis();
-  probe.rssi = rssi;
-  probe.channel = channel;
-  probe.is_hidden = false;
-  probe.target_bssid = arrayToMac(target_bssid);
-
   // Check if this probe is directed to a specific AP
   if (!isBroadcastMAC(target_bssid) && !isZeroMAC(target_bssid)) {
     // Directed probe - try to update AP directly
     if (updateHiddenAPWithProbeSSID(target_bssid, ssid, ssid_len)) {
       if (scan.probe_debug) {
+        char ap_str[18], client_str[18];
+        formatMAC(target_bssid, ap_str);
+        formatMAC(client_mac, client_str);
         Serial.printf("[Direct Reveal] AP %s -> SSID: %s via directed probe from %s\n",
-                      macToString(target_bssid).c_str(),
-                      ssid,
-                      macToString(client_mac).c_str());
+                      ap_str, ssid, client_str);
       }
     }
   }
 
-  // Add to cache
-  probe_cache.push_back(probe);
-
-  // Limit cache size
-  if (probe_cache.size() > MAX_PROBE_CACHE) {
-    probe_cache.erase(probe_cache.begin());
-  }
+  // Add to cache (fixed ring, oldest entry is overwritten)
+  probeCachePush(client_mac, ssid, ssid_len, target_bssid, rssi, channel, millis());
 
   // Track client probed AP
   trackClientProbedAP(client_mac, target_bssid);
 }
 
-// ===== Update Hidden AP with SSID from Probe Request =====
-bool updateHiddenAPWithProbeSSID(const uint8_t* ap_bssid, const char* ssid, uint8_t ssid_len) {
-  for (int i = 0; i < ap_count; ++i) {
-    if (memcmp(aps[i].bssid.data(), ap_bssid, 6) == 0) {
-      // Found the AP, check if it's hidden
-      if (aps[i].hidden) {
-        // Update AP with revealed SSID
-        strncpy(aps[i].ssid, ssid, 32);
-        aps[i].ssid_len = ssid_len;
-        aps[i].original_ssid_len = ssid_len;
-        aps[i].hidden = false;
-        aps[i].ssid_known = true;
-        aps[i].ssid_revealed = true;
-        aps[i].ssid_revealed_time = millis();
-
-        // Update AP list if exists
-        for (auto& ap : ap_list) {
-          if (memcmp(ap.bssid.data(), ap_bssid, 6) == 0) {
-            strncpy(ap.ssid, ssid, 32);
-            ap.ssid_len = ssid_len;
-            ap.original_ssid_len = ssid_len;
-            ap.hidden = false;
-            ap.ssid_known = true;
-            break;
-          }
-        }
+// ===== Change Events =====
+// Compares a record with what was last put on the event stream. The reported
+// state is kept current even while the stream is off, so turning it on does
+// not replay every record. Events feed both the serial stream and the SD
+// journal.
+static inline int8_t eventRssi(int rssi) {
+  return rssi < -128 ? -128 : (rssi > 0 ? 0 : rssi);
+}
+
+static inline bool eventsWanted() {
+  return scanEventsEnabled() || scanJournalEnabled();
+}
 
-        hidden_ap_revealed++;
+// Both sinks take a single producer: call only from the writer (scanFrame()
+// and what it runs, or loop() while no scan is subscribed)
+static void emitEvent(ScanEvent& ev) {
+  scanEventPush(ev);
+  scanJournalAppend(ev);
+}
 
-        // Print reveal message
-        Serial.printf("[+] Hidden AP %s revealed -> SSID: %s (Len: %d)\n",
-                      macToString(ap_bssid).c_str(),
-                      ssid,
-                      ssid_len);
-        return true;
-      }
-      break;
+static void pushAPEvent(uint8_t type, const APInfo* ap) {
+  if (!eventsWanted()) return;
+
+  ScanEvent ev = {};
+  ev.type = type;
+  memcpy(ev.mac, ap->bssid.data(), 6);
+  ev.rssi = eventRssi(ap->rssi);
+  ev.channel = ap->channel;
+  ev.enc = ap->encryption;
+  ev.ssid_len = ap->hidden ? 0 : min<uint8_t>(ap->ssid_len, 32);
+  memcpy(ev.ssid, ap->ssid, ev.ssid_len);
+  emitEvent(ev);
+}
+
+static void trackAPEvents(APInfo* ap) {
+  if (ap->packet_count == 0 && !ap->seeded) return;  // Created but not filled in yet
+
+  if (!ap->announced) {
+    pushAPEvent(SCAN_EV_AP_ADD, ap);
+    ap->announced = true;
+    ap->reported_rssi = eventRssi(ap->rssi);
+  } else {
+    if (ap->reported_hidden && !ap->hidden) pushAPEvent(SCAN_EV_AP_SSID, ap);
+    if (ap->encryption != ap->reported_enc) pushAPEvent(SCAN_EV_AP_ENC, ap);
+    if (ap->channel != ap->reported_channel) pushAPEvent(SCAN_EV_AP_CHAN, ap);
+    if (scanEventRssiCrossed(ap->reported_rssi, ap->rssi)) {
+      pushAPEvent(SCAN_EV_AP_RSSI, ap);
+      ap->reported_rssi = eventRssi(ap->rssi);
     }
   }
-  return false;
+  ap->reported_hidden = ap->hidden;
+  ap->reported_enc = ap->encryption;
+  ap->reported_channel = ap->channel;
+}
+
+static void pushClientEvent(uint8_t type, const ClientInfo* client) {
+  if (!eventsWanted()) return;
+
+  ScanEvent ev = {};
+  ev.type = type;
+  memcpy(ev.mac, client->mac.data(), 6);
+  ev.rssi = eventRssi(client->rssi);
+  ev.channel = client->channel;
+  if (type == SCAN_EV_STA_ADD) memcpy(ev.peer, client->current_ap.data(), 6);
+  emitEvent(ev);
+}
+
+static void pushAssocEvent(uint8_t type, const uint8_t* ap_bssid, const uint8_t* client_mac) {
+  ScanEvent ev = {};
+  ev.type = type;
+  memcpy(ev.mac, client_mac, 6);
+  memcpy(ev.peer, ap_bssid, 6);
+  emitEvent(ev);
+}
+
+static void trackClientEvents(ClientInfo* client) {
+  if (!client->announced) {
+    pushClientEvent(SCAN_EV_STA_ADD, client);
+    client->announced = true;
+    client->reported_rssi = eventRssi(client->rssi);
+  } else if (scanEventRssiCrossed(client->reported_rssi, client->rssi)) {
+    pushClientEvent(SCAN_EV_STA_RSSI, client);
+    client->reported_rssi = eventRssi(client->rssi);
+  }
+}
+
+// ===== AP Lookup =====
+// FNV-1a over the six bytes; both MAC indexes mask it to their size
+static inline uint32_t macHash(const uint8_t* mac) {
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < 6; i++) {
+    hash ^= mac[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static inline uint16_t apHomeBucket(const uint8_t* bssid) {
+  return macHash(bssid) & (AP_INDEX_BUCKETS - 1);
+}
+
+static int apIndexBucket(const uint8_t* bssid) {
+  uint16_t b = apHomeBucket(bssid);
+  for (int probes = 0; probes < AP_INDEX_BUCKETS; probes++) {
+    uint8_t entry = ap_slots[b];
+    if (entry == 0) return -1;
+    if (compareMAC(aps[entry - 1].bssid, bssid)) return b;
+    b = (b + 1) & (AP_INDEX_BUCKETS - 1);
+  }
+  return -1;
+}
+
+static void apIndexClear() {
+  memset(ap_slots, 0, sizeof(ap_slots));
+}
+
+static void apIndexInsert(int slot) {
+  uint16_t b = apHomeBucket(aps[slot].bssid.data());
+  while (ap_slots[b] != 0) {
+    b = (b + 1) & (AP_INDEX_BUCKETS - 1);
+  }
+  ap_slots[b] = slot + 1;
+}
+
+// Backward-shift deletion, as in the client index
+static void apIndexRemove(const uint8_t* bssid) {
+  int found = apIndexBucket(bssid);
+  if (found < 0) return;
+
+  uint16_t hole = found;
+  ap_slots[hole] = 0;
+  uint16_t b = (hole + 1) & (AP_INDEX_BUCKETS - 1);
+  while (ap_slots[b] != 0) {
+    uint16_t home = apHomeBucket(aps[ap_slots[b] - 1].bssid.data());
+    bool movable = (hole <= b) ? (home <= hole || home > b) : (home <= hole && home > b);
+    if (movable) {
+      ap_slots[hole] = ap_slots[b];
+      ap_slots[b] = 0;
+      hole = b;
+    }
+    b = (b + 1) & (AP_INDEX_BUCKETS - 1);
+  }
+}
+
+// Slot holding the BSSID, or -1
+static int findAPSlot(const uint8_t* bssid) {
+  int b = apIndexBucket(bssid);
+  return b < 0 ? -1 : ap_slots[b] - 1;
+}
+
+// ===== Update Hidden AP with SSID from Probe Request =====
+bool updateHiddenAPWithProbeSSID(const uint8_t* ap_bssid, const char* ssid, uint8_t ssid_len) {
+  int i = findAPSlot(ap_bssid);
+  if (i < 0 || !aps[i].hidden) return false;
+
+  // Update AP with revealed SSID
+  seqWriteBegin(aps[i].seq);
+  strncpy(aps[i].ssid, ssid, 32);
+  aps[i].ssid_len = ssid_len;
+  aps[i].original_ssid_len = ssid_len;
+  aps[i].hidden = false;
+  aps[i].ssid_known = true;
+  aps[i].ssid_revealed = true;
+  aps[i].ssid_revealed_time = millis();
+  seqWriteEnd(aps[i].seq);
+  trackAPEvents(&aps[i]);
+
+  hidden_ap_revealed++;
+
+  // Print reveal message
+  char ap_str[18];
+  formatMAC(ap_bssid, ap_str);
+  Serial.printf("[+] Hidden AP %s revealed -> SSID: %s (Len: %d)\n", ap_str, ssid, ssid_len);
+  return true;
 }
 
 // ===== Check Probe Cache for Hidden APs =====
-void checkProbeCacheForHiddenAPs() {
+static uint32_t probe_checked_seq = 0;  // Newest probe already reconciled
+
+// Reveals a hidden AP with an SSID its associated client probed for. The
+// index may lag the graph by a frame, so the pair is checked against the
+// client's current AP (the graph's, which current_ap publishes) first.
+static void revealHiddenAPFromProbe(const uint8_t* ap_bssid, const ProbeCache& probe) {
+  int ap_slot = findAPSlot(ap_bssid);
+  if (ap_slot < 0) return;
+
+  mac_address_t current;
+  if (!assocCurrentAP(probe.client_mac.data(), &current) || !compareMAC(current, ap_bssid)) return;
+
   unsigned long current_time = millis();
+  if (!aps[ap_slot].hidden || (current_time - aps[ap_slot].last_seen) > scan.probe_ttl_ms) return;
+  if ((current_time - probe.timestamp) > scan.probe_ttl_ms) return;
 
-  // Remove old cache entries (older than 30 seconds)
-  probe_cache.erase(
-    remove_if(probe_cache.begin(), probe_cache.end(),
-              [current_time](const ProbeCache& probe) {
-                return (current_time - probe.timestamp) > 30000;
-              }),
-    probe_cache.end());
+  if (updateHiddenAPWithProbeSSID(ap_bssid, probe.ssid, probe.ssid_len)) {
+    if (scan.probe_debug) {
+      char ap_str[18], client_str[18];
+      formatMAC(ap_bssid, ap_str);
+      formatMAC(probe.client_mac.data(), client_str);
+      Serial.printf("[Assoc Reveal] AP %s -> SSID: %s via client %s\n",
+                    ap_str, probe.ssid, client_str);
+    }
+  }
+}
 
-  // Check if any hidden APs match cached probe SSIDs
-  for (int i = 0; i < ap_count; ++i) {
-    if (aps[i].hidden && (current_time - aps[i].last_seen) <= 30000) {
-      String ap_bssid_str = macToString(aps[i].bssid.data());
-
-      // Method 1: Check if any client is associated with this AP
-      for (const auto& client : client_list) {
-        if (client.is_associated && client.ap_bssid == ap_bssid_str) {
-          // Check probe cache for this client
-          for (const auto& probe : probe_cache) {
-            if (compareMAC(probe.client_mac, client.mac.data())) {
-              if (!probe.is_hidden && probe.ssid_len > 0) {
-                if (updateHiddenAPWithProbeSSID(aps[i].bssid.data(), probe.ssid, probe.ssid_len)) {
-                  if (scan.probe_debug) {
-                    Serial.printf("[Assoc Reveal] AP %s -> SSID: %s via client %s\n",
-                                  ap_bssid_str.c_str(),
-                                  probe.ssid,
-                                  macToString(client.mac.data()).c_str());
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
+static void revealHiddenAPFromClient(const uint8_t* client_mac, const uint8_t* ap_bssid) {
+  ProbeCache probe;
+  if (probeCacheRead(probeIndexLatestProbe(client_mac), &probe) && compareMAC(probe.client_mac, client_mac)) {
+    revealHiddenAPFromProbe(ap_bssid, probe);
+  }
+}
 
-      // Method 2: Check broadcast probes that might be for this AP
-      // Some clients send broadcast probes when scanning
-      for (const auto& probe : probe_cache) {
-        // If probe target is broadcast (FF:FF:FF:FF:FF:FF) or zero
-        uint8_t target_bssid[6];
-        macToArray(probe.target_bssid, target_bssid);
-        if (isBroadcastMAC(target_bssid) || isZeroMAC(target_bssid)) {
-          // Check if we have any clue this might be for our hidden AP
-          // For now, just store for potential matching
-          if (!probe.is_hidden && probe.ssid_len > 0) {
-            if (scan.probe_debug) {
-              Serial.printf("[Broadcast Probe] Client: %s -> SSID: %s (might be for hidden APs)\n",
-                            macToString(probe.client_mac.data()).c_str(),
-                            probe.ssid);
-            }
-          }
-        }
-      }
+// Only looks at what changed since the last pass: new associations and new
+// probes. Each costs one index lookup, independent of table sizes. Runs
+// from scanFrame().
+static void checkProbeCacheForHiddenAPs() {
+  // Method 1a: Clients that just associated with an AP
+  ProbeDirty dirty;
+  bool overflowed = probeDirtyOverflowed();
+  while (probeDirtyPop(&dirty)) {
+    if (!overflowed) revealHiddenAPFromClient(dirty.client_mac.data(), dirty.ap_bssid.data());
+  }
+  if (overflowed) {
+    // Changes were dropped; fall back to one pass over the index
+    probeIndexForEachAssociated(revealHiddenAPFromClient);
+  }
+
+  // Method 1b: New probes from clients already associated with an AP
+  uint32_t head = probeCacheHead();
+  if (probe_checked_seq > head) probe_checked_seq = 0;  // Cache was cleared
+
+  uint32_t seq = max(probe_checked_seq + 1, probeCacheTail());
+  for (; seq <= head; seq++) {
+    ProbeCache probe;
+    if (!probeCacheRead(seq, &probe)) continue;
+
+    mac_address_t ap_bssid;
+    if (probeIndexAPFor(probe.client_mac.data(), &ap_bssid)) {
+      revealHiddenAPFromProbe(ap_bssid.data(), probe);
+    } else if (scan.probe_debug && (isBroadcastMAC(probe.target_bssid.data()) || isZeroMAC(probe.target_bssid.data()))) {
+      // Method 2: Broadcast probes might be for a hidden AP, nothing to match yet
+      char client_str[18];
+      formatMAC(probe.client_mac.data(), client_str);
+      Serial.printf("[Broadcast Probe] Client: %s -> SSID: %s (might be for hidden APs)\n",
+                    client_str, probe.ssid);
     }
   }
+  probe_checked_seq = head;
 }
 
 // ===== Analyze SSID from Probe Request =====
@@ -669,78 +840,10 @@ void analyzeSSIDFromProbeRequest(const uint8_t* frame, uint16_t frame_len,
     is_hidden = true;
   }
 
-  String ssid_str = String(ssid);
-
-  // Update probe count for this SSID
-  if (ssid_probe_counts.find(ssid_str) == ssid_probe_counts.end()) {
-    ssid_probe_counts[ssid_str] = 1;
-  } else {
-    ssid_probe_counts[ssid_str]++;
-  }
-
-  ssid_last_seen[ssid_str] = millis();
-
-  // Track which clients are probing this SSID
-  mac_address_t client_mac = arrayToMac(source_mac);
-  if (ssid_client_map.find(ssid_str) == ssid_client_map.end()) {
-    std::vector<mac_address_t> clients;
-    clients.push_back(client_mac);
-    ssid_client_map[ssid_str] = clients;
-  } else {
-    bool found = false;
-    std::vector<mac_address_t>& clients = ssid_client_map[ssid_str];
-    for (const auto& existing_mac : clients) {
-      if (compareMAC(existing_mac, source_mac)) {
-        found = true;
-        break;
-      }
-    }
-    if (!found) {
-      clients.push_back(client_mac);
-    }
-  }
-
-  // Update SSID list
-  bool ssid_found = false;
-  for (auto& ssid_info : ssid_list) {
-    if (strcmp(ssid_info.ssid, ssid) == 0 && ssid_info.ssid_len == ssid_len) {
-      ssid_info.last_seen = millis();
-      ssid_info.probe_count++;
-      ssid_info.from_probe_request = true;
-      ssid_found = true;
-      break;
-    }
-  }
-
-  if (!ssid_found) {
-    SSIDInfo new_ssid;
-    strncpy(new_ssid.ssid, ssid, 32);
-    new_ssid.ssid_len = ssid_len;
-    new_ssid.bssid = arrayToMac(bssid);
-    new_ssid.first_seen = millis();
-    new_ssid.last_seen = millis();
-    new_ssid.channel = channel;
-    new_ssid.rssi = rssi;
-    new_ssid.probe_count = 1;
-    new_ssid.is_hidden = is_hidden;
-    new_ssid.from_probe_request = true;
-    new_ssid.from_beacon = false;
-    new_ssid.from_probe_response = false;
-
-    ssid_list.push_back(new_ssid);
-
-    if (ssid_list.size() > 100) {
-      unsigned long oldest = millis();
-      size_t oldest_idx = 0;
-      for (size_t i = 0; i < ssid_list.size(); i++) {
-        if (ssid_list[i].last_seen < oldest) {
-          oldest = ssid_list[i].last_seen;
-          oldest_idx = i;
-        }
-      }
-      ssid_list.erase(ssid_list.begin() + oldest_idx);
-    }
-  }
+  // One hash lookup per probe; stats live in the interned SSID table
+  unsigned long now = millis();
+  ssid_id_t id = ssidIntern(ssid, ssid_len ? ssid_len : strlen(ssid), now);
+  ssidRecordProbe(id, source_mac, bssid, rssi, channel, is_hidden, now);
 }
 
 // ===== WPS Detection =====
@@ -840,12 +943,28 @@ int getWPSVersion(const uint8_t* frame, uint16_t frame_len) {
 }
 
 // ===== AP Management =====
+// ===== Record Update Hooks =====
+// Everything derived from a record (ranking, event stream, query indexes)
+// is refreshed here once the RX path has written it
+static void apUpdated(APInfo* ap) {
+  if (!ap->announced && (ap->packet_count > 0 || ap->seeded)) chanSchedDiscovered(ap->channel);
+  rankAP(ap);
+  trackAPEvents(ap);
+  queryIndexAP(ap - aps, ap->channel, ap->encryption, ap->manufacturer);
+  scanStoreTouch();
+}
+
+static void clientUpdated(ClientInfo* client) {
+  if (!client->announced) chanSchedDiscovered(scan.current_channel);
+  rankClient(client);
+  trackClientEvents(client);
+  queryIndexStation(client - client_list.data(), client->channel, client->manufacturer);
+  scanStoreTouch();
+}
+
 APInfo* findOrCreateAP(const uint8_t* bssid) {
-  for (int i = 0; i < ap_count; ++i) {
-    if (memcmp(aps[i].bssid.data(), bssid, 6) == 0) {
-      return &aps[i];
-    }
-  }
+  int slot = findAPSlot(bssid);
+  if (slot >= 0) return &aps[slot];
 
   if (ap_count >= MAX_APS) {
     unsigned long oldest_time = millis();
@@ -859,8 +978,13 @@ APInfo* findOrCreateAP(const uint8_t* bssid) {
     }
 
     if (oldest_index >= 0) {
-      aps[oldest_index].bssid = arrayToMac(bssid);
       APInfo* new_ap = &aps[oldest_index];
+      if (new_ap->announced) pushAPEvent(SCAN_EV_AP_DEL, new_ap);
+      seqWriteBegin(ap_table_seq);
+      seqWriteBegin(new_ap->seq);
+      apIndexRemove(new_ap->bssid.data());
+      new_ap->bssid = arrayToMac(bssid);
+      apIndexInsert(oldest_index);
 
       memset(new_ap->ssid, 0, 33);
       new_ap->ssid_len = 0;
@@ -868,9 +992,10 @@ APInfo* findOrCreateAP(const uint8_t* bssid) {
       new_ap->ssid_known = false;
       new_ap->hidden = false;
       new_ap->rssi = INT_MIN;
+      rssiStatsReset(new_ap->rssi_stats);
       new_ap->channel = 0;
       new_ap->encryption = WIFI_AUTH_OPEN;
-      new_ap->client_count = 0;
+      new_ap->client_count = assocDegree(bssid);
       new_ap->first_seen = millis();
       new_ap->last_seen = millis();
       new_ap->packet_count = 0;
@@ -888,24 +1013,36 @@ APInfo* findOrCreateAP(const uint8_t* bssid) {
       new_ap->secondary_channel = 0;
       new_ap->ssid_revealed = false;
       new_ap->ssid_revealed_time = 0;
-      new_ap->associated_clients.clear();
+      new_ap->beacon_hash = 0;
+      new_ap->manufacturer = getVendorFromMAC(bssid);
+      new_ap->seeded = false;
+      new_ap->announced = false;
+      new_ap->reported_hidden = false;
+      seqWriteEnd(new_ap->seq);
+      seqWriteEnd(ap_table_seq);
+      deviceCountResetAP(new_ap - aps);
+      rankAP(new_ap);
 
       return new_ap;
     }
     return nullptr;
   }
 
-  APInfo* new_ap = &aps[ap_count++];
+  APInfo* new_ap = &aps[ap_count];
+  seqWriteBegin(ap_table_seq);
+  seqWriteBegin(new_ap->seq);
   new_ap->bssid = arrayToMac(bssid);
+  apIndexInsert(ap_count);
   memset(new_ap->ssid, 0, 33);
   new_ap->ssid_len = 0;
   new_ap->original_ssid_len = 0;
   new_ap->ssid_known = false;
   new_ap->hidden = false;
   new_ap->rssi = INT_MIN;
+  rssiStatsReset(new_ap->rssi_stats);
   new_ap->channel = 0;
   new_ap->encryption = WIFI_AUTH_OPEN;
-  new_ap->client_count = 0;
+  new_ap->client_count = assocDegree(bssid);
   new_ap->first_seen = millis();
   new_ap->last_seen = millis();
   new_ap->packet_count = 0;
@@ -923,40 +1060,52 @@ APInfo* findOrCreateAP(const uint8_t* bssid) {
   new_ap->secondary_channel = 0;
   new_ap->ssid_revealed = false;
   new_ap->ssid_revealed_time = 0;
-  new_ap->associated_clients.clear();
+  new_ap->beacon_hash = 0;
+  new_ap->manufacturer = getVendorFromMAC(bssid);
+  new_ap->seeded = false;
+  new_ap->announced = false;
+  new_ap->reported_hidden = false;
+  seqWriteEnd(new_ap->seq);
+  ap_count++;
+  seqWriteEnd(ap_table_seq);
+  deviceCountResetAP(new_ap - aps);
+  rankAP(new_ap);
 
   return new_ap;
 }
 
 bool isAlreadyPrinted(const uint8_t* bssid) {
-  String current_bssid = macToString(bssid);
-  return find(printed_bssids.begin(), printed_bssids.end(), current_bssid) != printed_bssids.end();
+  return printed_bssids.mayContain(bssid);
 }
 
 // ===== Fixed: Correct SSID Handling for Hidden APs =====
-void updateAPInfo(APInfo* ap, const uint8_t* frame, uint16_t frame_len, int rssi, int channel) {
-  if (rssi > 0) {
-    if (rssi > 127) {
-      rssi = -((int8_t)rssi);
-    } else {
-      rssi = -rssi;
-    }
-  }
-
-  if (rssi > 0) rssi = -30;
-  if (rssi < -100) rssi = -100;
+// Every RSSI sample of a record goes through here; rssi mirrors the EWMA
+static inline void addRssiSample(RssiStats& stats, int* rssi, int raw) {
+  rssiStatsAdd(stats, rssiNormalize(raw), scan.rssi_ewma_shift);
+  *rssi = rssiStatsValue(stats);
+}
 
-  if (ap->packet_count == 0) {
-    ap->rssi = rssi;
-  } else {
-    // Weighted average for RSSI
-    ap->rssi = (ap->rssi * 4 + rssi) / 5;
-  }
+void updateAPInfo(APInfo* ap, const uint8_t* frame, uint16_t frame_len, int rssi, int channel) {
+  addRssiSample(ap->rssi_stats, &ap->rssi, rssi);
 
   ap->channel = channel;
   ap->last_seen = millis();
   ap->packet_count++;
 
+  // Unchanged beacon body: nothing below would change, skip the IE parsing
+  uint8_t frame_type, frame_subtype;
+  getFrameType(frame, &frame_type, &frame_subtype);
+  if (frame_subtype == SUBTYPE_BEACON) {
+    // frame_len counts the trailing FCS
+    uint32_t hash = frame_len > 4 ? beaconBodyHash(frame, frame_len - 4, scan.wps_detection_enabled ? 1 : 0) : 0;
+    if (hash != 0 && hash == ap->beacon_hash) {
+      beacons_skipped++;
+      return;
+    }
+    ap->beacon_hash = hash;
+    beacons_parsed++;
+  }
+
   // Extract SSID with hidden detection
   bool is_hidden = false;
   uint8_t extracted_len = extractSSIDFromFrame(frame, frame_len, ap->ssid,
@@ -1021,163 +1170,305 @@ void updateAPWithEnhancedInfo(APInfo* ap, const uint8_t* frame, uint16_t frame_l
 }
 
 // ===== Client-AP Association Management =====
+// The association graph is the only store; scanAssocChanged() republishes
+// what changed and keeps the hidden-SSID index in step.
 void updateAPClientAssociation(const uint8_t* ap_bssid, const uint8_t* client_mac) {
-  mac_address_t ap_mac = arrayToMac(ap_bssid);
-  mac_address_t client_mac_struct = arrayToMac(client_mac);
+  // Only a change of current AP is an event, not every frame of the pair
+  bool track = eventsWanted();
+  mac_address_t before;
+  bool had = track && assocCurrentAP(client_mac, &before);
 
-  // Find the AP
-  for (int i = 0; i < ap_count; ++i) {
-    if (compareMAC(aps[i].bssid, ap_bssid)) {
-      // Check if client already in list
-      bool found = false;
-      for (const auto& client : aps[i].associated_clients) {
-        if (compareMAC(client, client_mac)) {
-          found = true;
-          break;
-        }
-      }
+  assocUpsert(ap_bssid, client_mac, millis());
+  if (track && (!had || !compareMAC(before, ap_bssid))) {
+    pushAssocEvent(SCAN_EV_ASSOC, ap_bssid, client_mac);
+  }
 
-      // Add client if not found
-      if (!found) {
-        aps[i].associated_clients.push_back(client_mac_struct);
+  // Usually a no-op; brings back an entry the index compacted away
+  probeIndexAssociate(client_mac, ap_bssid);
 
-        // Limit associated clients
-        if (aps[i].associated_clients.size() > 20) {
-          aps[i].associated_clients.erase(aps[i].associated_clients.begin());
-        }
-      }
-      break;
+  int slot = findAPSlot(ap_bssid);
+  if (slot >= 0) deviceCountStation(slot, client_mac);
+}
+
+// ===== Published Association =====
+// The graph belongs to the writer; the AP's station count and the client's
+// current AP are copied into their records here so readers never walk it.
+// The writer may already hold a record's lock (updateClient() holds the
+// client's): seq is only odd inside the writer, so odd means nested.
+// Every edge change ends here (upserts, removals, expiry and recycling), so
+// this is also where the hidden-SSID and query indexes follow the station's AP.
+void scanAssocChanged(const uint8_t* ap_bssid, const uint8_t* sta_mac) {
+  int i = findAPSlot(ap_bssid);
+  if (i >= 0) {
+    int degree = assocDegree(ap_bssid);
+    if (aps[i].client_count != degree) {
+      bool held = aps[i].seq & 1;
+      if (!held) seqWriteBegin(aps[i].seq);
+      aps[i].client_count = degree;
+      if (!held) seqWriteEnd(aps[i].seq);
     }
   }
 
-  // Update client association list
-  bool found_assoc = false;
-  for (auto& assoc : client_associations) {
-    if (compareMAC(assoc.client_mac, client_mac)) {
-      assoc.ap_bssid = ap_mac;
-      assoc.last_associated = millis();
-      assoc.association_count++;
-      found_assoc = true;
-      break;
-    }
+  mac_address_t current;
+  if (assocCurrentAP(sta_mac, &current)) {
+    probeIndexAssociate(sta_mac, current.data());
+  } else {
+    current = mac_address_t{};
+    probeIndexDisassociate(sta_mac);
   }
 
-  if (!found_assoc) {
-    ClientAssociation new_assoc;
-    new_assoc.client_mac = client_mac_struct;
-    new_assoc.ap_bssid = ap_mac;
-    new_assoc.first_associated = millis();
-    new_assoc.last_associated = millis();
-    new_assoc.association_count = 1;
-    client_associations.push_back(new_assoc);
+  ClientInfo* client = findClient(sta_mac);
+  if (!client || client->current_ap == current) return;
+  bool held = client->seq & 1;
+  if (!held) seqWriteBegin(client->seq);
+  client->current_ap = current;
+  if (!held) seqWriteEnd(client->seq);
+  queryIndexStationAP(client - client_list.data(), current.data());
+}
+
+// Graph and published copies go together; writer context only
+static void clearAssociations() {
+  assocGraphClear();
+  for (int i = 0; i < ap_count; ++i) {
+    seqWriteBegin(aps[i].seq);
+    aps[i].client_count = -1;
+    seqWriteEnd(aps[i].seq);
+  }
+  for (size_t i = 0; i < client_list.size(); ++i) {
+    seqWriteBegin(client_list[i].seq);
+    client_list[i].current_ap = mac_address_t{};
+    seqWriteEnd(client_list[i].seq);
+    queryIndexStationAP(i, nullptr);
   }
 }
 
 void removeClientFromAP(const uint8_t* ap_bssid, const uint8_t* client_mac) {
-  for (int i = 0; i < ap_count; ++i) {
-    if (compareMAC(aps[i].bssid, ap_bssid)) {
-      // Remove client from AP's list
-      auto& clients = aps[i].associated_clients;
-      clients.erase(
-        remove_if(clients.begin(), clients.end(),
-                  [client_mac](const mac_address_t& client) {
-                    return compareMAC(client, client_mac);
-                  }),
-        clients.end());
-      break;
+  if (!assocRemove(ap_bssid, client_mac)) return;
+  if (eventsWanted()) pushAssocEvent(SCAN_EV_DISASSOC, ap_bssid, client_mac);
+}
+
+// ===== Client Index =====
+static inline uint16_t clientHomeBucket(const uint8_t* mac) {
+  return macHash(mac) & (CLIENT_INDEX_BUCKETS - 1);
+}
+
+static int clientIndexBucket(const uint8_t* mac) {
+  uint16_t b = clientHomeBucket(mac);
+  for (int probes = 0; probes < CLIENT_INDEX_BUCKETS; probes++) {
+    uint16_t entry = client_slots[b];
+    if (entry == 0) return -1;
+    if (compareMAC(client_list[entry - 1].mac, mac)) return b;
+    b = (b + 1) & (CLIENT_INDEX_BUCKETS - 1);
+  }
+  return -1;
+}
+
+static void clientIndexClear() {
+  memset(client_slots, 0, sizeof(client_slots));
+}
+
+static void clientIndexInsert(int slot) {
+  uint16_t b = clientHomeBucket(client_list[slot].mac.data());
+  while (client_slots[b] != 0) {
+    b = (b + 1) & (CLIENT_INDEX_BUCKETS - 1);
+  }
+  client_slots[b] = slot + 1;
+}
+
+// Backward-shift deletion, same scheme as the SSID table
+static void clientIndexRemove(const uint8_t* mac) {
+  int found = clientIndexBucket(mac);
+  if (found < 0) return;
+
+  uint16_t hole = found;
+  client_slots[hole] = 0;
+  uint16_t b = (hole + 1) & (CLIENT_INDEX_BUCKETS - 1);
+  while (client_slots[b] != 0) {
+    uint16_t home = clientHomeBucket(client_list[client_slots[b] - 1].mac.data());
+    bool movable = (hole <= b) ? (home <= hole || home > b) : (home <= hole && home > b);
+    if (movable) {
+      client_slots[hole] = client_slots[b];
+      client_slots[b] = 0;
+      hole = b;
     }
+    b = (b + 1) & (CLIENT_INDEX_BUCKETS - 1);
   }
 }
 
-// ===== Client Management =====
-ClientInfo* findClient(const uint8_t* mac) {
-  for (auto& client : client_list) {
-    if (compareMAC(client.mac, mac)) {
-      return &client;
+static void clientIndexRebuild() {
+  clientIndexClear();
+  for (size_t i = 0; i < client_list.size(); i++) {
+    clientIndexInsert(i);
+  }
+}
+
+// ===== Scan Storage =====
+// Everything that used to grow on the heap while scanning is carved from the
+// scan arena once; clearing a table only resets its pool.
+static size_t scanStorageBytes() {
+  return scanArenaSize(sizeof(ClientInfo) * MAX_CLIENTS) +
+         scanArenaSize(sizeof(SSIDHistory) * SSID_HISTORY_POOL);
+}
+
+static void ssidHistoryClear() {
+  ssid_history_free = SSID_HISTORY_NONE;
+  ssid_history_unused = 0;
+  ssid_history_live = 0;
+  ssid_history_dropped = 0;
+}
+
+static uint16_t ssidHistoryAlloc() {
+  if (!ssid_history_pool) return SSID_HISTORY_NONE;
+
+  uint16_t id = ssid_history_free;
+  if (id != SSID_HISTORY_NONE) {
+    ssid_history_free = ssid_history_pool[id].next;
+  } else if (ssid_history_unused < SSID_HISTORY_POOL) {
+    id = ssid_history_unused++;
+  } else {
+    return SSID_HISTORY_NONE;
+  }
+  ssid_history_live++;
+  return id;
+}
+
+// Returns the client's whole chain to the free list
+static void ssidHistoryRelease(ClientInfo* client) {
+  uint16_t head = client->ssid_history;
+  if (head != SSID_HISTORY_NONE) {
+    uint16_t tail = head;
+    while (ssid_history_pool[tail].next != SSID_HISTORY_NONE) {
+      tail = ssid_history_pool[tail].next;
     }
+    ssid_history_pool[tail].next = ssid_history_free;
+    ssid_history_free = head;
+    ssid_history_live -= client->ssid_history_count;
   }
-  return nullptr;
+  client->ssid_history = SSID_HISTORY_NONE;
+  client->ssid_history_count = 0;
+}
+
+// Rewinds the arena and lays the pools out again (same addresses every time)
+static void carveScanStorage() {
+  scanArenaRewind();
+  client_list.bind(scanArenaAllocArray<ClientInfo>(MAX_CLIENTS), MAX_CLIENTS);
+  ssid_history_pool = scanArenaAllocArray<SSIDHistory>(SSID_HISTORY_POOL);
+  ssidHistoryClear();
+}
+
+// Zero-filled indexes would all point at entry 0 and free lists would be
+// unthreaded, so the fixed tables are emptied once at boot
+void scanBegin() {
+  timerWheelReset(millis());
+  ssidTableClear();
+  assocGraphClear();
+}
+
+bool scanStorageReady() {
+  if (scanArenaReady()) return true;
+  if (!scanArenaBegin(scanStorageBytes())) return false;
+  carveScanStorage();
+  return true;
+}
+
+static void markScanHeapBaseline() {
+  scan_heap_ops_at_start = scanArenaStats().heap_ops;
+  scan_heap_free_at_start = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  scan_heap_largest_at_start = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_INTERNAL);
+  scan_heap_blocks_at_start = info.allocated_blocks;
+  scan_heap_free_blocks_at_start = info.free_blocks;
+#if SCAN_ALLOC_TRACE
+  alloc_trace_frames = 0;
+  alloc_trace_changed = 0;
+  alloc_trace_blocks = 0;
+  alloc_trace_max = 0;
+#endif
+}
+
+// Moves the last record into the hole so only two ranks and timers change.
+// Callers hold client_table_seq.
+static void removeClientAt(size_t hole) {
+  size_t last = client_list.size() - 1;
+  if (client_list[hole].announced) pushClientEvent(SCAN_EV_STA_DEL, &client_list[hole]);
+  clientIndexRemove(client_list[hole].mac.data());
+  ssidHistoryRelease(&client_list[hole]);
+  timerCancel(TIMER_CLIENT, hole);
+  if (hole != last) {
+    clientIndexRemove(client_list[last].mac.data());
+    client_list[hole] = client_list[last];
+    clientIndexInsert(hole);
+    timerMove(TIMER_CLIENT, last, hole);
+    rankClient(&client_list[hole]);
+    queryIndexStation(hole, client_list[hole].channel, client_list[hole].manufacturer);
+    queryIndexStationAP(hole, client_list[hole].current_ap.data());
+  }
+  queryIndexDropStation(last);
+  client_list.pop_back();
+  client_rank.remove(last);
+}
+
+// ===== Client Management =====
+ClientInfo* findClient(const uint8_t* mac) {
+  int b = clientIndexBucket(mac);
+  return b < 0 ? nullptr : &client_list[client_slots[b] - 1];
 }
 
 void trackClientProbedAP(const uint8_t* client_mac, const uint8_t* ap_bssid) {
   ClientInfo* client = findClient(client_mac);
   if (client) {
-    String ap_str = macToString(ap_bssid);
-    if (ap_str != "00:00:00:00:00:00" && ap_str != "FF:FF:FF:FF:FF:FF") {
+    if (!isZeroMAC(ap_bssid) && !isBroadcastMAC(ap_bssid)) {
       // Check if already in list
-      bool found = false;
-      for (const auto& probed : client->probed_aps) {
-        if (probed == ap_str) {
-          found = true;
-          break;
-        }
+      for (int i = 0; i < client->probed_ap_count; i++) {
+        if (compareMAC(client->probed_aps[i], ap_bssid)) return;
       }
-      if (!found) {
-        client->probed_aps.push_back(ap_str);
-        // Keep only last 10 probed APs
-        if (client->probed_aps.size() > 10) {
-          client->probed_aps.erase(client->probed_aps.begin());
-        }
+
+      // Keep only the last MAX_PROBED_APS probed APs
+      if (client->probed_ap_count == MAX_PROBED_APS) {
+        memmove(&client->probed_aps[0], &client->probed_aps[1],
+                (MAX_PROBED_APS - 1) * sizeof(mac_address_t));
+        client->probed_ap_count--;
       }
+      client->probed_aps[client->probed_ap_count++] = arrayToMac(ap_bssid);
     }
   }
 }
 
+// Callers hold client->seq for the duration of the update
 void updateClient(ClientInfo* client, int rssi, int channel,
-                  const String& ap_bssid, const String& frame_type) {
-  if (rssi > 0) {
-    if (rssi > 127) {
-      rssi = -((int8_t)rssi);
-    } else {
-      rssi = -rssi;
-    }
-  }
-
-  if (rssi > 0) rssi = -30;
-  if (rssi < -100) rssi = -100;
-
-  if (client->packet_count < 5) {
-    client->rssi = (client->rssi + rssi) / 2;
-  } else {
-    client->rssi = (client->rssi * 7 + rssi * 3) / 10;
-  }
+                  const uint8_t* ap_bssid, const char* frame_type) {
+  addRssiSample(client->rssi_stats, &client->rssi, rssi);
 
   client->channel = channel;
   client->last_seen = millis();
 
-  if (ap_bssid != "00:00:00:00:00:00" && ap_bssid != "N/A") {
+  if (ap_bssid && !isZeroMAC(ap_bssid)) {
     // Update client-AP association
-    if (client->ap_bssid != ap_bssid) {
+    mac_address_t current_ap;
+    bool associated = assocCurrentAP(client->mac.data(), &current_ap);
+    if (!associated || !compareMAC(current_ap, ap_bssid)) {
       // Client changed APs
-      if (client->is_associated && client->ap_bssid != "N/A") {
+      if (associated) {
         // Remove from old AP
-        uint8_t old_ap_bssid[6];
-        sscanf(client->ap_bssid.c_str(), "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-               &old_ap_bssid[0], &old_ap_bssid[1], &old_ap_bssid[2],
-               &old_ap_bssid[3], &old_ap_bssid[4], &old_ap_bssid[5]);
-        removeClientFromAP(old_ap_bssid, client->mac.data());
+        removeClientFromAP(current_ap.data(), client->mac.data());
       }
 
       // Add to new AP
-      client->ap_bssid = ap_bssid;
-      client->is_associated = true;
-
-      uint8_t new_ap_bssid[6];
-      sscanf(ap_bssid.c_str(), "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-             &new_ap_bssid[0], &new_ap_bssid[1], &new_ap_bssid[2],
-             &new_ap_bssid[3], &new_ap_bssid[4], &new_ap_bssid[5]);
-      updateAPClientAssociation(new_ap_bssid, client->mac.data());
+      updateAPClientAssociation(ap_bssid, client->mac.data());
+    } else {
+      // Same AP: refresh the edge
+      assocUpsert(ap_bssid, client->mac.data(), client->last_seen);
     }
   }
 
-  if (!frame_type.isEmpty()) {
+  if (frame_type) {
     client->last_frame_type = frame_type;
   }
 
   client->packet_count++;
-  client->manufacturer = getVendorFromMAC(client->mac.data());
 
-  if (frame_type == "PROBE_REQ") {
+  if (frame_type && strcmp(frame_type, "PROBE_REQ") == 0) {
     client->probe_count++;
     client->last_probe_time = millis();
   }
@@ -1185,11 +1476,13 @@ void updateClient(ClientInfo* client, int rssi, int channel,
 
 void updateClientWithSSIDInfo(ClientInfo* client, const uint8_t* frame, uint16_t frame_len,
                               int rssi, int channel, uint8_t frame_subtype) {
-  updateClient(client, rssi, channel, "N/A", "PROBE_REQ");
+  seqWriteBegin(client->seq);
+  updateClient(client, rssi, channel, nullptr, "PROBE_REQ");
 
   if (frame_subtype == SUBTYPE_PROBE_REQUEST) {
     analyzeProbeRequestForSSID(client, frame, frame_len);
   }
+  seqWriteEnd(client->seq);
 }
 
 void analyzeProbeRequestForSSID(ClientInfo* client, const uint8_t* frame, uint16_t frame_len) {
@@ -1203,51 +1496,59 @@ void analyzeProbeRequestForSSID(ClientInfo* client, const uint8_t* frame, uint16
     is_hidden = true;
   }
 
-  client->last_probed_ssid = String(ssid);
+  strncpy(client->last_probed_ssid, ssid, 32);
+  client->last_probed_ssid[32] = '\0';
   client->last_ssid_len = ssid_len;
   client->probing_active = true;
   client->last_probe_time = millis();
 
-  bool ssid_in_history = false;
-  for (auto& history : client->ssid_history) {
+  if (!ssid_history_pool) return;
+
+  uint16_t oldest = SSID_HISTORY_NONE;
+  for (uint16_t h = client->ssid_history; h != SSID_HISTORY_NONE; h = ssid_history_pool[h].next) {
+    SSIDHistory& history = ssid_history_pool[h];
     if (strcmp(history.ssid, ssid) == 0 && history.ssid_len == ssid_len) {
       history.last_seen = millis();
       history.probe_count++;
-      ssid_in_history = true;
-      break;
+      return;
+    }
+    if (oldest == SSID_HISTORY_NONE || history.last_seen < ssid_history_pool[oldest].last_seen) {
+      oldest = h;
     }
   }
 
-  if (!ssid_in_history) {
-    SSIDHistory new_history;
-    strncpy(new_history.ssid, ssid, 32);
-    new_history.ssid_len = ssid_len;
-    new_history.first_seen = millis();
-    new_history.last_seen = millis();
-    new_history.probe_count = 1;
-    new_history.is_hidden = is_hidden;
-
-    client->ssid_history.push_back(new_history);
-
-    if (client->ssid_history.size() > MAX_SSID_HISTORY) {
-      unsigned long oldest = millis();
-      size_t oldest_idx = 0;
-      for (size_t i = 0; i < client->ssid_history.size(); i++) {
-        if (client->ssid_history[i].last_seen < oldest) {
-          oldest = client->ssid_history[i].last_seen;
-          oldest_idx = i;
-        }
-      }
-      client->ssid_history.erase(client->ssid_history.begin() + oldest_idx);
-    }
+  // New SSID: take a pool entry, or overwrite this client's oldest one when
+  // it is at MAX_SSID_HISTORY or the pool has run dry
+  uint16_t h = SSID_HISTORY_NONE;
+  if (client->ssid_history_count < MAX_SSID_HISTORY) h = ssidHistoryAlloc();
+  if (h != SSID_HISTORY_NONE) {
+    ssid_history_pool[h].next = client->ssid_history;
+    client->ssid_history = h;
+    client->ssid_history_count++;
+  } else if (oldest != SSID_HISTORY_NONE) {
+    h = oldest;
+  } else {
+    ssid_history_dropped++;
+    return;
   }
+
+  SSIDHistory& new_history = ssid_history_pool[h];
+  strncpy(new_history.ssid, ssid, 32);
+  new_history.ssid[32] = '\0';
+  new_history.ssid_len = ssid_len;
+  new_history.first_seen = millis();
+  new_history.last_seen = millis();
+  new_history.probe_count = 1;
+  new_history.is_hidden = is_hidden;
 }
 
 void addNewClient(const uint8_t* mac, int rssi, int channel,
-                  const String& ap_bssid, const String& frame_type) {
-  if (client_list.size() >= MAX_CLIENTS) {
+                  const uint8_t* ap_bssid, const char* frame_type) {
+  seqWriteBegin(client_table_seq);
+
+  if (client_list.full()) {
     unsigned long oldest_time = millis();
-    vector<ClientInfo>::iterator oldest = client_list.end();
+    ClientInfo* oldest = client_list.end();
 
     for (auto it = client_list.begin(); it != client_list.end(); ++it) {
       if (it->last_seen < oldest_time) {
@@ -1257,357 +1558,505 @@ void addNewClient(const uint8_t* mac, int rssi, int channel,
     }
 
     if (oldest != client_list.end()) {
-      client_list.erase(oldest);
+      removeClientAt(oldest - client_list.begin());
     } else {
+      seqWriteEnd(client_table_seq);
       return;
     }
   }
 
-  if (rssi > 0) {
-    if (rssi > 127) {
-      rssi = -((int8_t)rssi);
-    } else {
-      rssi = -rssi;
-    }
-  }
-
-  if (rssi > 0) rssi = -30;
-  if (rssi < -100) rssi = -100;
-
   ClientInfo new_client;
   new_client.mac = arrayToMac(mac);
-  new_client.rssi = rssi;
+  rssiStatsReset(new_client.rssi_stats);
+  addRssiSample(new_client.rssi_stats, &new_client.rssi, rssi);
   new_client.channel = channel;
-  new_client.ap_bssid = ap_bssid;
   new_client.first_seen = millis();
   new_client.last_seen = millis();
   new_client.packet_count = 1;
   new_client.last_frame_type = frame_type;
-  new_client.is_associated = (ap_bssid != "N/A" && ap_bssid != "00:00:00:00:00:00");
   new_client.manufacturer = getVendorFromMAC(mac);
   new_client.data_rate = 0;
-  new_client.probe_count = (frame_type == "PROBE_REQ") ? 1 : 0;
+  new_client.probe_count = (frame_type && strcmp(frame_type, "PROBE_REQ") == 0) ? 1 : 0;
   new_client.is_handshaking = false;
-  new_client.last_probed_ssid = "";
+  new_client.ssid_history = SSID_HISTORY_NONE;
+  new_client.ssid_history_count = 0;
+  new_client.last_probed_ssid[0] = '\0';
   new_client.last_ssid_len = 0;
   new_client.probing_active = false;
-  new_client.targeted_ap = "";
+  new_client.targeted_ap = mac_address_t{};
+  new_client.probed_ap_count = 0;
   new_client.authentication_algo = 0;
   new_client.auth_seq = 0;
   new_client.last_probe_time = 0;
+  new_client.announced = false;
+  new_client.seq = 0;
 
-  if (new_client.is_associated && ap_bssid != "00:00:00:00:00:00") {
-    uint8_t ap_bssid_bytes[6];
-    sscanf(ap_bssid.c_str(), "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-           &ap_bssid_bytes[0], &ap_bssid_bytes[1], &ap_bssid_bytes[2],
-           &ap_bssid_bytes[3], &ap_bssid_bytes[4], &ap_bssid_bytes[5]);
-    updateAPClientAssociation(ap_bssid_bytes, mac);
+  if (ap_bssid && !isZeroMAC(ap_bssid)) {
+    updateAPClientAssociation(ap_bssid, mac);
   }
+  // Not in the table yet, so scanAssocChanged() could not publish this one
+  if (!assocCurrentAP(mac, &new_client.current_ap)) new_client.current_ap = mac_address_t{};
 
-  client_list.push_back(new_client);
+  if (!client_list.push_back(new_client)) {
+    seqWriteEnd(client_table_seq);
+    return;
+  }
+  clientIndexInsert(client_list.size() - 1);
+  timerArm(TIMER_CLIENT, client_list.size() - 1, new_client.last_seen + scan.client_ttl_ms);
+  seqWriteEnd(client_table_seq);
+  clientUpdated(&client_list.back());
+  queryIndexStationAP(client_list.size() - 1, new_client.current_ap.data());
   total_client_packets++;
 }
 
 void addOrUpdateClient(const uint8_t* mac, int rssi, int channel,
-                       const String& ap_bssid, const String& frame_type) {
+                       const uint8_t* ap_bssid, const char* frame_type) {
   if (!isValidClientMAC(mac)) return;
 
   ClientInfo* existing = findClient(mac);
 
   if (existing) {
+    seqWriteBegin(existing->seq);
     updateClient(existing, rssi, channel, ap_bssid, frame_type);
+    seqWriteEnd(existing->seq);
+    clientUpdated(existing);
   } else {
     addNewClient(mac, rssi, channel, ap_bssid, frame_type);
   }
 }
 
-void cleanupOldClients() {
-  unsigned long current_time = millis();
+// Warm start: an empty record for the snapshot loader to fill in, ranked and
+// indexed by the loader once filled. nullptr if present already or full.
+ClientInfo* restoreClient(const uint8_t* mac) {
+  if (!isValidClientMAC(mac) || findClient(mac) || client_list.full()) return nullptr;
 
-  client_list.erase(
-    remove_if(client_list.begin(), client_list.end(),
-              [current_time](const ClientInfo& client) {
-                return (current_time - client.last_seen) > MAX_CLIENT_AGE_MS;
-              }),
-    client_list.end());
+  ClientInfo client = {};
+  client.mac = arrayToMac(mac);
+  client.rssi = INT_MIN;
+  client.first_seen = millis();
+  client.last_seen = client.first_seen;
+  client.last_frame_type = "RESTORED";
+  client.manufacturer = getVendorFromMAC(mac);
+  client.ssid_history = SSID_HISTORY_NONE;
 
-  // Clean up old associations
-  client_associations.erase(
-    remove_if(client_associations.begin(), client_associations.end(),
-              [current_time](const ClientAssociation& assoc) {
-                return (current_time - assoc.last_associated) > MAX_CLIENT_AGE_MS;
-              }),
-    client_associations.end());
+  seqWriteBegin(client_table_seq);
+  bool added = client_list.push_back(client);
+  if (added) {
+    clientIndexInsert(client_list.size() - 1);
+    timerArm(TIMER_CLIENT, client_list.size() - 1, client.last_seen + scan.client_ttl_ms);
+  }
+  seqWriteEnd(client_table_seq);
+  return added ? &client_list.back() : nullptr;
 }
 
-String getManufacturerFromMAC(const uint8_t* mac) {
+const char* getManufacturerFromMAC(const uint8_t* mac) {
   return getVendorFromMAC(mac);
 }
 
+// ===== Frame Analyzers =====
+// Each analyzer handles the frame keys it registers for in the dispatch
+// tables below. The RX callback decodes a frame once into a FrameView and
+// runs only the analyzers registered for its type/subtype.
+static void countFrame(const FrameView& f) {
+  if (f.type == FRAME_TYPE_MANAGEMENT) {
+    total_management_frames++;
+    if (f.subtype == SUBTYPE_BEACON) total_beacons++;
+    else if (f.subtype == SUBTYPE_PROBE_REQUEST) total_probe_requests++;
+  } else if (f.type == FRAME_TYPE_DATA) {
+    total_data_frames++;
+  }
+}
+
+static void analyzeBeacon(const FrameView& f) {
+  if (!scan.active_ap || !f.bssid) return;
+  APInfo* ap = findOrCreateAP(f.bssid);
+  if (!ap) return;
+
+  seqWriteBegin(ap->seq);
+  updateAPInfo(ap, f.frame, f.len, f.rssi, f.channel);
+  seqWriteEnd(ap->seq);
+  apUpdated(ap);
+}
+
+static void analyzeProbeResponse(const FrameView& f) {
+  if (!scan.active_ap || !f.bssid) return;
+  APInfo* ap = findOrCreateAP(f.bssid);
+  if (!ap) return;
+
+  char temp_ssid[33] = { 0 };
+  bool is_hidden = false;
+  uint8_t ssid_len = extractSSIDFromFrame(f.frame, f.len, temp_ssid, f.type, f.subtype, &is_hidden);
+
+  seqWriteBegin(ap->seq);
+  if (ssid_len > 0 && !ap->ssid_known && !is_hidden) {
+    ap->ssid_len = ssid_len;
+    ap->original_ssid_len = ssid_len;
+    strncpy(ap->ssid, temp_ssid, 32);
+    ap->hidden = false;
+    ap->ssid_known = true;
+  }
+
+  addRssiSample(ap->rssi_stats, &ap->rssi, f.rssi);
+  ap->channel = f.channel;
+  ap->last_seen = millis();
+  ap->packet_count++;
+
+  if (scan.wps_detection_enabled) {
+    ap->wps_enabled = detectWPSInProbeResponse(f.frame, f.len);
+    if (ap->wps_enabled) {
+      ap->wps_version = getWPSVersion(f.frame, f.len);
+    }
+  }
+  seqWriteEnd(ap->seq);
+  apUpdated(ap);
+}
+
+// Enhanced mode: beacons and probe responses both get the full parse
+static void analyzeAPFrameEnhanced(const FrameView& f) {
+  if (!scan.active_ap || !f.bssid) return;
+  APInfo* ap = findOrCreateAP(f.bssid);
+  if (!ap) return;
+
+  seqWriteBegin(ap->seq);
+  updateAPWithEnhancedInfo(ap, f.frame, f.len, f.rssi, f.channel, f.subtype);
+  seqWriteEnd(ap->seq);
+  apUpdated(ap);
+}
+
+static void analyzeProbeRequest(const FrameView& f) {
+  if (!scan.active_ap) return;
+  bool all = scan.enhanced_scanning;
+
+  // Process probe request for SSID tracking
+  if (all || scan.ssid_tracking_enabled) {
+    analyzeSSIDFromProbeRequest(f.frame, f.len, f.sa, f.bssid, f.rssi, f.channel);
+  }
+
+  // Process probe request for hidden AP detection
+  if (all || scan.probe_sniffing) {
+    processProbeRequestForHiddenAPs(f.frame, f.len, f.sa, f.bssid, f.rssi, f.channel);
+  }
+}
+
 // ===== Enhanced Client Packet Processing =====
-void processEnhancedClientPacket(const wifi_promiscuous_pkt_t* packet, int rssi, int channel) {
-  const uint8_t* frame_ctrl = packet->payload;
-  uint8_t frame_type, frame_subtype;
-  getFrameType(frame_ctrl, &frame_type, &frame_subtype);
+// Stations are the wireless endpoints of the hop (transmitter/receiver) that
+// aren't the AP itself
+static inline bool isStationEndpoint(const uint8_t* mac, const uint8_t* bssid) {
+  return isValidClientMAC(mac) && !(bssid && memcmp(mac, bssid, 6) == 0);
+}
 
-  const uint8_t* source_mac = &packet->payload[10];
-  const uint8_t* destination_mac = &packet->payload[4];
-  const uint8_t* bssid_mac = &packet->payload[16];
+void processEnhancedClientPacket(const FrameView& f) {
+  if (!scan.active_sta) return;
 
-  String frame_type_str = getFrameTypeString(frame_type, frame_subtype);
-  String ap_bssid_str = "N/A";
+  const char* frame_type_str = getFrameTypeString(f.type, f.subtype);
+  const uint8_t* ap_bssid = nullptr;
 
-  if (!isBroadcastMAC(bssid_mac) && !isZeroMAC(bssid_mac)) {
-    ap_bssid_str = macToString(bssid_mac);
+  if (f.bssid && !isBroadcastMAC(f.bssid) && !isZeroMAC(f.bssid)) {
+    ap_bssid = f.bssid;
   }
 
   // Process association frames
-  if (frame_type == FRAME_TYPE_MANAGEMENT) {
-    if (frame_subtype == SUBTYPE_ASSOCIATION_REQUEST || frame_subtype == SUBTYPE_ASSOCIATION_RESPONSE || frame_subtype == SUBTYPE_REASSOCIATION_REQUEST || frame_subtype == SUBTYPE_REASSOCIATION_RESPONSE) {
+  if (f.type == FRAME_TYPE_MANAGEMENT) {
+    if (f.subtype == SUBTYPE_ASSOCIATION_REQUEST || f.subtype == SUBTYPE_ASSOCIATION_RESPONSE || f.subtype == SUBTYPE_REASSOCIATION_REQUEST || f.subtype == SUBTYPE_REASSOCIATION_RESPONSE) {
       total_association_frames++;
 
-      if (scan.enhanced_client_tracking) {
+      if (scan.enhanced_client_tracking && ap_bssid) {
         // Update client-AP association
-        if (frame_subtype == SUBTYPE_ASSOCIATION_REQUEST || frame_subtype == SUBTYPE_REASSOCIATION_REQUEST) {
+        if (f.subtype == SUBTYPE_ASSOCIATION_REQUEST || f.subtype == SUBTYPE_REASSOCIATION_REQUEST) {
           // Client is requesting association
-          if (isValidClientMAC(source_mac) && !isBroadcastMAC(bssid_mac)) {
-            updateAPClientAssociation(bssid_mac, source_mac);
+          if (isValidClientMAC(f.sa)) {
+            updateAPClientAssociation(ap_bssid, f.sa);
           }
-        } else if (frame_subtype == SUBTYPE_ASSOCIATION_RESPONSE || frame_subtype == SUBTYPE_REASSOCIATION_RESPONSE) {
+        } else {
           // AP is responding to association
-          if (isValidClientMAC(destination_mac) && !isBroadcastMAC(bssid_mac)) {
-            updateAPClientAssociation(bssid_mac, destination_mac);
+          if (isValidClientMAC(f.da)) {
+            updateAPClientAssociation(ap_bssid, f.da);
           }
         }
       }
     }
 
-    // Process authentication frames
-    if (frame_subtype == SUBTYPE_AUTHENTICATION || frame_subtype == SUBTYPE_DEAUTHENTICATION) {
-      if (scan.enhanced_client_tracking) {
-        if (frame_subtype == SUBTYPE_DEAUTHENTICATION) {
-          // Client is being deauthenticated
-          if (isValidClientMAC(destination_mac) && !isBroadcastMAC(bssid_mac)) {
-            removeClientFromAP(bssid_mac, destination_mac);
-          }
-        }
+    // Client is being deauthenticated
+    if (f.subtype == SUBTYPE_DEAUTHENTICATION && scan.enhanced_client_tracking && ap_bssid) {
+      if (isValidClientMAC(f.da)) {
+        removeClientFromAP(ap_bssid, f.da);
       }
     }
   }
 
   // Update clients
-  if (isValidClientMAC(source_mac)) {
-    addOrUpdateClient(source_mac, rssi, channel, ap_bssid_str, frame_type_str);
+  if (isStationEndpoint(f.ta, f.bssid)) {
+    addOrUpdateClient(f.ta, f.rssi, f.channel, ap_bssid, frame_type_str);
   }
-  if (isValidClientMAC(destination_mac)) {
-    addOrUpdateClient(destination_mac, rssi, channel, ap_bssid_str, frame_type_str);
+  if (isStationEndpoint(f.ra, f.bssid)) {
+    addOrUpdateClient(f.ra, f.rssi, f.channel, ap_bssid, frame_type_str);
   }
 }
 
-// ===== Enhanced Packet Handlers =====
-void enhancedPacketHandler(void* buf, wifi_promiscuous_pkt_type_t type) {
-  if (type != WIFI_PKT_MGMT && type != WIFI_PKT_DATA) return;
+// ===== Frame Dispatch =====
+#define MGMT_FRAMES FRAME_BITS_OF_TYPE(FRAME_TYPE_MANAGEMENT)
+#define DATA_FRAMES FRAME_BITS_OF_TYPE(FRAME_TYPE_DATA)
 
-  const wifi_promiscuous_pkt_t* packet = (wifi_promiscuous_pkt_t*)buf;
+static constexpr AnalyzerReg passive_analyzers[] = {
+  { MGMT_FRAMES | DATA_FRAMES, countFrame },
+  { FRAME_BIT(FRAME_TYPE_MANAGEMENT, SUBTYPE_BEACON), analyzeBeacon },
+  { FRAME_BIT(FRAME_TYPE_MANAGEMENT, SUBTYPE_PROBE_RESPONSE), analyzeProbeResponse },
+  { FRAME_BIT(FRAME_TYPE_MANAGEMENT, SUBTYPE_PROBE_REQUEST), analyzeProbeRequest },
+  { MGMT_FRAMES | DATA_FRAMES, processEnhancedClientPacket },
+};
 
-  if (packet->rx_ctrl.rssi < scan.min_rssi) return;
-  if (packet->rx_ctrl.sig_len < 24) return;
+static constexpr AnalyzerReg enhanced_analyzers[] = {
+  { MGMT_FRAMES | DATA_FRAMES, countFrame },
+  { FRAME_BIT(FRAME_TYPE_MANAGEMENT, SUBTYPE_BEACON) | FRAME_BIT(FRAME_TYPE_MANAGEMENT, SUBTYPE_PROBE_RESPONSE),
+    analyzeAPFrameEnhanced },
+  { FRAME_BIT(FRAME_TYPE_MANAGEMENT, SUBTYPE_PROBE_REQUEST), analyzeProbeRequest },
+  { MGMT_FRAMES | DATA_FRAMES, processEnhancedClientPacket },
+};
 
-  int rssi = packet->rx_ctrl.rssi;
-  if (rssi > 1000) rssi = (int8_t)rssi;
+static_assert(sizeof(passive_analyzers) / sizeof(passive_analyzers[0]) <= FRAME_MAX_ANALYZERS, "Too many analyzers");
+static_assert(sizeof(enhanced_analyzers) / sizeof(enhanced_analyzers[0]) <= FRAME_MAX_ANALYZERS, "Too many analyzers");
 
-  const uint8_t* frame_ctrl = packet->payload;
-  uint8_t frame_type, frame_subtype;
-  getFrameType(frame_ctrl, &frame_type, &frame_subtype);
+static constexpr uint8_t passive_dispatch[FRAME_KEYS] = DISPATCH_TABLE(passive_analyzers);
+static constexpr uint8_t enhanced_dispatch[FRAME_KEYS] = DISPATCH_TABLE(enhanced_analyzers);
 
-  const uint8_t* source_mac = &packet->payload[10];
-  const uint8_t* destination_mac = &packet->payload[4];
-  const uint8_t* bssid_mac = &packet->payload[16];
+// Bus subscription while a scan is running, -1 otherwise
+static int scan_rx = -1;
 
-  int current_channel = scan.current_channel;
+// Last time the timer wheel was advanced, by either side
+static unsigned long timers_advanced_at = 0;
 
-  if (frame_type == FRAME_TYPE_MANAGEMENT) {
-    total_management_frames++;
-    if (frame_subtype == SUBTYPE_BEACON) total_beacons++;
-    else if (frame_subtype == SUBTYPE_PROBE_REQUEST) total_probe_requests++;
-  } else if (frame_type == FRAME_TYPE_DATA) {
-    total_data_frames++;
-  }
+// Everything the scan does with one frame
+static void analyzeScanFrame(const RxFrame& rx) {
+  // Age out a few records per frame
+  unsigned long now = millis();
+  timerAdvance(now);
+  __atomic_store_n(&timers_advanced_at, now, __ATOMIC_RELAXED);
 
-  if (scan.active_ap) {
-    if (frame_subtype == SUBTYPE_BEACON || frame_subtype == SUBTYPE_PROBE_RESPONSE) {
-      APInfo* ap = findOrCreateAP(bssid_mac);
-      if (ap) {
-        updateAPWithEnhancedInfo(ap, packet->payload, packet->rx_ctrl.sig_len,
-                                 rssi, current_channel, frame_subtype);
-      }
-    }
+  if (rx.view.len < MIN_PACKET_SIZE) return;
+  deviceCountFrame(rx.view, now);
 
-    if (frame_subtype == SUBTYPE_PROBE_REQUEST) {
-      // Process probe request for SSID tracking
-      analyzeSSIDFromProbeRequest(packet->payload, packet->rx_ctrl.sig_len,
-                                  source_mac, bssid_mac, rssi, current_channel);
-
-      // Process probe request for hidden AP detection
-      processProbeRequestForHiddenAPs(packet->payload, packet->rx_ctrl.sig_len,
-                                      source_mac, bssid_mac, rssi, current_channel);
-    }
+  if (scan.enhanced_scanning) {
+    frameDispatch(enhanced_dispatch, enhanced_analyzers, rx.view);
+  } else {
+    frameDispatch(passive_dispatch, passive_analyzers, rx.view);
   }
 
-  if (scan.active_sta) {
-    processEnhancedClientPacket(packet, rssi, current_channel);
+  // Reveals rewrite AP records and emit events, so they stay with the
+  // other writers; nothing new to reconcile arrives between frames anyway
+  if (scan.active_ap && scan.probe_sniffing && (now - scan.last_probe_check) >= PROBE_CACHE_CHECK_INTERVAL) {
+    checkProbeCacheForHiddenAPs();
+    scan.last_probe_check = now;
   }
 }
 
-void passivePacketHandler(void* buf, wifi_promiscuous_pkt_type_t type) {
-  if (type != WIFI_PKT_MGMT && type != WIFI_PKT_DATA) return;
+// Frames arrive decoded and filtered by type and RSSI (rx_bus.cpp)
+static void scanFrame(const RxFrame& rx) {
+#if SCAN_ALLOC_TRACE
+  multi_heap_info_t before, after;
+  heap_caps_get_info(&before, MALLOC_CAP_8BIT);
+  analyzeScanFrame(rx);
+  heap_caps_get_info(&after, MALLOC_CAP_8BIT);
 
-  const wifi_promiscuous_pkt_t* packet = (wifi_promiscuous_pkt_t*)buf;
-
-  if (packet->rx_ctrl.rssi < scan.min_rssi) return;
-  if (packet->rx_ctrl.sig_len < MIN_PACKET_SIZE) return;
+  int32_t left = (int32_t)after.allocated_blocks - (int32_t)before.allocated_blocks;
+  alloc_trace_frames++;
+  if (left != 0) alloc_trace_changed++;
+  alloc_trace_blocks += left;
+  if (left > alloc_trace_max) alloc_trace_max = left;
+#else
+  analyzeScanFrame(rx);
+#endif
+}
 
-  int rssi = packet->rx_ctrl.rssi;
-  if (rssi > 1000) rssi = (int8_t)rssi;
+// Scan start resets, adopts and seeds the records scanFrame() writes. Holding
+// the subscription paused (which waits out a frame in flight) keeps loop()
+// the only writer until the start is done.
+static void holdScanRx(bool hold) {
+  if (scan_rx >= 0) rxBusSetPaused(scan_rx, hold);
+}
 
-  const uint8_t* frame_ctrl = packet->payload;
-  uint8_t frame_type, frame_subtype;
-  getFrameType(frame_ctrl, &frame_type, &frame_subtype);
+// Joins the RX bus once per scan; switching AP <-> station scans keeps the
+// slot. The subscription is left held for the caller to release.
+static bool attachScanRx() {
+  if (scan_rx < 0) {
+    RxSubscription sub = { "scan", RX_PKT_MGMT | RX_PKT_DATA, MGMT_FRAMES | DATA_FRAMES,
+                           (int8_t)scan.min_rssi, false, scanFrame };
+    scan_rx = rxBusSubscribe(sub);
+    if (scan_rx < 0) {
+      Serial.println("Scan: RX bus is full");
+      return false;
+    }
+    holdScanRx(true);
+  }
+  if (!rxBusClaimChannel(scan_rx, RX_CHAN_HOP, 0, RX_HOP_PRIO_SCAN)) return false;
+  if (rxBusMayHop(scan_rx)) {
+    rxBusSetChannel(scan_rx, scan.current_channel);
+  } else {
+    scan.current_channel = rxBusChannel();
+    Serial.printf("Scan: channel %d is held by another capture, not hopping\n", scan.current_channel);
+  }
+  return true;
+}
 
-  const uint8_t* source_mac = &packet->payload[10];
-  const uint8_t* destination_mac = &packet->payload[4];
-  const uint8_t* bssid_mac = &packet->payload[16];
+static void detachScanRx() {
+  rxBusUnsubscribe(scan_rx);
+  scan_rx = -1;
+}
 
-  int current_channel = scan.current_channel;
+// ===== Ranking =====
+static inline int32_t rankKey(int rssi, unsigned long last_seen) {
+  if (scan.rank_key == RANK_BY_LAST_SEEN) {
+    return (int32_t)(last_seen - scan.scan_start_time);
+  }
+  return rssi;
+}
 
-  String frame_type_str = getFrameTypeString(frame_type, frame_subtype);
+void rankAP(const APInfo* ap) {
+  int slot = ap - aps;
+  ap_rank.update(slot, rankKey(ap->rssi, ap->last_seen));
 
-  String ap_bssid_str = "N/A";
-  if (!isBroadcastMAC(bssid_mac) && !isZeroMAC(bssid_mac)) {
-    ap_bssid_str = macToString(bssid_mac);
+  // Expired APs drop out of the ranking; seeing one again brings it back
+  if (!timerArmed(TIMER_AP, slot)) {
+    timerArm(TIMER_AP, slot, ap->last_seen + scan.ap_ttl_ms);
   }
+}
 
-  String extracted_ssid = "";
-  bool has_ssid_in_frame = false;
-  bool is_hidden_ssid = false;
-  uint8_t ssid_len = 0;
+void rankClient(const ClientInfo* client) {
+  client_rank.update(client - client_list.data(), rankKey(client->rssi, client->last_seen));
+}
 
-  if (frame_type == FRAME_TYPE_MANAGEMENT && packet->rx_ctrl.sig_len > 36) {
-    const uint8_t* tagged_params = packet->payload + 36;
-    uint16_t remaining_len = packet->rx_ctrl.sig_len - 36;
-    const uint8_t* ptr = tagged_params;
+// ===== Expiry =====
+bool apTimerExpired(uint16_t slot, unsigned long now, unsigned long* rearm_at) {
+  if (slot >= ap_count) return false;
 
-    while (ptr < packet->payload + packet->rx_ctrl.sig_len && ptr[0] != 0xFF) {
-      uint8_t element_id = ptr[0];
-      uint8_t element_len = ptr[1];
+  unsigned long deadline = aps[slot].last_seen + scan.ap_ttl_ms;
+  if ((long)(deadline - now) > 0) {
+    *rearm_at = deadline;
+    return true;
+  }
 
-      if (element_id == 0 && element_len <= 32) {
-        ssid_len = element_len;
-        char ssid_buf[33] = { 0 };
-        if (element_len > 0) {
-          memcpy(ssid_buf, ptr + 2, element_len);
+  // Record stays (findOrCreateAP may revive it); it just stops being shown
+  ap_rank.remove(slot);
+  queryIndexDropAP(slot);
+  if (aps[slot].announced) {
+    pushAPEvent(SCAN_EV_AP_DEL, &aps[slot]);
+    aps[slot].announced = false;
+  }
+  return false;
+}
 
-          // Check if SSID is all zeros (hidden)
-          bool all_zeros = true;
-          for (int i = 0; i < element_len; i++) {
-            if (ssid_buf[i] != 0) {
-              all_zeros = false;
-              break;
-            }
-          }
+bool clientTimerExpired(uint16_t slot, unsigned long now, unsigned long* rearm_at) {
+  if (slot >= client_list.size()) return false;
 
-          if (all_zeros || element_len == 0) {
-            is_hidden_ssid = true;
-            extracted_ssid = "[Hidden]";
-          } else {
-            extracted_ssid = String(ssid_buf);
-          }
-        } else {
-          is_hidden_ssid = true;
-          extracted_ssid = "[Hidden]";
-        }
-        has_ssid_in_frame = true;
-        break;
-      }
+  unsigned long deadline = client_list[slot].last_seen + scan.client_ttl_ms;
+  if ((long)(deadline - now) > 0) {
+    *rearm_at = deadline;
+    return true;
+  }
 
-      if (element_len == 0 || element_len > 255) break;
-      ptr += 2 + element_len;
+  seqWriteBegin(client_table_seq);
+  removeClientAt(slot);
+  seqWriteEnd(client_table_seq);
+  return false;
+}
 
-      if (ptr > packet->payload + packet->rx_ctrl.sig_len) break;
-    }
+void rebuildRankings() {
+  ap_rank.clear();
+  for (int i = 0; i < ap_count; i++) {
+    if (timerArmed(TIMER_AP, i)) rankAP(&aps[i]);
   }
+  client_rank.clear();
+  for (const auto& client : client_list) {
+    rankClient(&client);
+  }
+}
 
-  if (scan.active_ap) {
-    if (isBeaconFrame(frame_ctrl)) {
-      APInfo* ap = findOrCreateAP(bssid_mac);
-      if (ap) {
-        int ap_rssi = rssi;
-        if (ap_rssi > 1000) ap_rssi = (int8_t)ap_rssi;
-        updateAPInfo(ap, packet->payload, packet->rx_ctrl.sig_len,
-                     ap_rssi, current_channel);
-      }
-    }
+// ===== Snapshots =====
+static inline int8_t viewRssi(int rssi) {
+  if (rssi < -128) return -128;
+  if (rssi > 0) return 0;
+  return (int8_t)rssi;
+}
 
-    if (isProbeResponseFrame(frame_ctrl)) {
-      APInfo* ap = findOrCreateAP(bssid_mac);
-      if (ap) {
-        char temp_ssid[33] = { 0 };
-        bool is_hidden = false;
-        uint8_t ssid_len = extractSSIDFromFrame(packet->payload, packet->rx_ctrl.sig_len, temp_ssid,
-                                                frame_type, frame_subtype, &is_hidden);
-
-        if (ssid_len > 0 && !ap->ssid_known && !is_hidden) {
-          ap->ssid_len = ssid_len;
-          ap->original_ssid_len = ssid_len;
-          strncpy(ap->ssid, temp_ssid, 32);
-          ap->hidden = false;
-          ap->ssid_known = true;
-        }
+bool readAPView(const APInfo& ap, APView* out) {
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(ap.seq);
 
-        int ap_rssi = rssi;
-        if (ap_rssi > 1000) ap_rssi = (int8_t)ap_rssi;
+    out->bssid = ap.bssid;
+    memcpy(out->ssid, ap.ssid, sizeof(out->ssid));
+    out->ssid[32] = '\0';
+    out->ssid_len = ap.ssid_len;
+    out->original_ssid_len = ap.original_ssid_len;
+    out->hidden = ap.hidden;
+    out->ssid_known = ap.ssid_known;
+    out->ssid_revealed = ap.ssid_revealed;
+    out->wps_enabled = ap.wps_enabled;
+    out->wps_version = ap.wps_version;
+    out->rssi = viewRssi(ap.rssi);
+    out->channel = ap.channel;
+    out->encryption = ap.encryption;
+    out->associated_count = ap.client_count;
+    out->manufacturer = ap.manufacturer;
+    out->last_seen = ap.last_seen;
 
-        ap->rssi = ap_rssi;
-        ap->channel = current_channel;
-        ap->last_seen = millis();
-        ap->packet_count++;
+    if (!seqReadRetry(ap.seq, start)) return true;
+  }
+  return false;
+}
 
-        if (scan.wps_detection_enabled) {
-          ap->wps_enabled = detectWPSInProbeResponse(packet->payload,
-                                                     packet->rx_ctrl.sig_len);
-          if (ap->wps_enabled) {
-            ap->wps_version = getWPSVersion(packet->payload, packet->rx_ctrl.sig_len);
-          }
-        }
-      }
-    }
+bool readClientView(const ClientInfo& client, ClientView* out) {
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(client.seq);
 
-    if (frame_subtype == SUBTYPE_PROBE_REQUEST) {
-      // Process probe request for SSID tracking
-      if (scan.ssid_tracking_enabled) {
-        analyzeSSIDFromProbeRequest(packet->payload, packet->rx_ctrl.sig_len,
-                                    source_mac, bssid_mac, rssi, current_channel);
-      }
+    out->mac = client.mac;
+    out->rssi = viewRssi(client.rssi);
+    out->channel = client.channel;
+    out->probing_active = client.probing_active;
+    out->ap_bssid = client.current_ap;
+    out->manufacturer = client.manufacturer;
+    out->probe_count = client.probe_count;
+    out->packet_count = client.packet_count;
+    out->last_seen = client.last_seen;
+    out->last_probe_time = client.last_probe_time;
 
-      // Process probe request for hidden AP detection
-      if (scan.probe_sniffing) {
-        processProbeRequestForHiddenAPs(packet->payload, packet->rx_ctrl.sig_len,
-                                        source_mac, bssid_mac, rssi, current_channel);
-      }
-    }
+    if (!seqReadRetry(client.seq, start)) return true;
   }
+  return false;
+}
+
+// Copies every AP into out[]. Records that stay busy for the whole retry
+// budget are left out of this snapshot rather than blocking the RX path.
+int snapshotAPs(APView* out, int max_views) {
+  int count = 0;
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(ap_table_seq);
+    int n = min(__atomic_load_n(&ap_count, __ATOMIC_ACQUIRE), max_views);
+
+    count = 0;
+    for (int i = 0; i < n; i++) {
+      if (readAPView(aps[i], &out[count])) count++;
+    }
 
-  if (scan.active_sta) {
-    processEnhancedClientPacket(packet, rssi, current_channel);
+    if (!seqReadRetry(ap_table_seq, start)) break;
   }
+  return count;
 }
 
-void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
-  if (scan.enhanced_scanning) {
-    enhancedPacketHandler(buf, type);
-  } else {
-    passivePacketHandler(buf, type);
+// client_list is a fixed pool in the scan arena, so its storage never moves;
+// an erase that shifts records mid-copy is caught by client_table_seq.
+int snapshotClients(ClientView* out, int max_views) {
+  int count = 0;
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(client_table_seq);
+    int n = min((int)client_list.size(), max_views);
+
+    count = 0;
+    for (int i = 0; i < n; i++) {
+      if (readClientView(client_list[i], &out[count])) count++;
+    }
+
+    if (!seqReadRetry(client_table_seq, start)) break;
   }
+  return count;
 }
 
 // ===== Enhanced Display Functions =====
@@ -1620,17 +2069,6 @@ void displayEnhancedAPs() {
   }
   scan.last_display = current_time;
 
-  // Sort APs by RSSI (strongest first)
-  for (int i = 0; i < ap_count - 1; i++) {
-    for (int j = i + 1; j < ap_count; j++) {
-      if (aps[i].rssi < aps[j].rssi) {
-        APInfo temp = aps[i];
-        aps[i] = aps[j];
-        aps[j] = temp;
-      }
-    }
-  }
-
   // Enhanced display format with revealed SSIDs
   Serial.println("\n============================================================================================================================================");
   Serial.println("Nr | SSID                           | Len | Orig | H | RSSI | Chan | Clients | Encryption               | WPS | Revealed | BSSID");
@@ -1643,91 +2081,98 @@ void displayEnhancedAPs() {
 
   printed_bssids.clear();
 
-  for (int i = 0; i < ap_count; ++i) {
-    APInfo& ap = aps[i];
-
-    // Skip APs not seen recently (30 seconds)
-    if (current_time - ap.last_seen > 30000) {
+  // Walk the ranking best-first; only the rows actually shown are read
+  ap_walker.reset();
+  int slot;
+  APView ap;
+  while ((slot = ap_walker.next()) >= 0) {
+    if (slot >= ap_count || !readAPView(aps[slot], &ap)) {
       continue;
     }
-    active_ap_count++;
-
-    if (ap.hidden) hidden_count++;
-    if (ap.ssid_revealed) hidden_revealed_count++;
 
-    // Limit display to 50 APs at once
-    if (displayed_count >= 50) {
+    // Limit display to the configured top K
+    if (displayed_count >= scan.ap_top_k) {
       Serial.println("... more APs not displayed ...");
       break;
     }
+    active_ap_count++;
 
-    // Format SSID
-    String ssid = String(ap.ssid);
+    if (ap.hidden) hidden_count++;
+    if (ap.ssid_revealed) hidden_revealed_count++;
 
-    // For revealed hidden APs, show actual SSID with indicator
-    if (ap.ssid_revealed && ap.ssid_known && !ap.hidden) {
-      ssid = String(ap.ssid) + " [R]";
-    }
+    // Format SSID; revealed hidden APs show the SSID with an indicator
+    char ssid[40];
+    bool revealed = ap.ssid_revealed && ap.ssid_known && !ap.hidden;
+    int ssid_chars = snprintf(ssid, sizeof(ssid), "%s%s", ap.ssid, revealed ? " [R]" : "");
 
     // Truncate SSID if too long for display
-    if (ssid.length() > 30) {
-      ssid = ssid.substring(0, 27) + "...";
-    }
+    if (ssid_chars > 30) strcpy(ssid + 27, "...");
 
     // Display lengths
     int display_length = ap.ssid_len;            // Display length (8 for "[Hidden]")
     int original_length = ap.original_ssid_len;  // Original frame length
 
-    // Get actual client count from associations
-    int actual_clients = ap.associated_clients.size();
-    if (actual_clients == 0) {
-      // Estimate if no associations tracked
-      actual_clients = estimateClientCount(ap.rssi, ap.channel);
+    // Client count from the association graph ("-" if never seen associating)
+    char clients_str[8] = "-";
+    if (ap.associated_count >= 0) {
+      snprintf(clients_str, sizeof(clients_str), "%d", ap.associated_count);
     }
 
     // Get WPS status
-    String wps_status = "No";
+    const char* wps_status = "No";
     if (ap.wps_enabled) {
       wps_status = (ap.wps_version == 2) ? "v2" : "v1";
     }
 
     // Get complete encryption string
-    String enc_str = getCompleteEncryptionType(ap.encryption);
-    if (enc_str.length() > 24) {
-      enc_str = enc_str.substring(0, 21) + "...";
+    char enc_str[25];
+    const char* enc = getCompleteEncryptionType(ap.encryption);
+    if (strlen(enc) > 24) {
+      snprintf(enc_str, sizeof(enc_str), "%.21s...", enc);
+    } else {
+      strcpy(enc_str, enc);
     }
 
     // Display revealed status
-    String revealed_status = ap.ssid_revealed ? "Yes" : "-";
+    const char* revealed_status = ap.ssid_revealed ? "Yes" : "-";
+
+    char bssid_str[18];
+    formatMAC(ap.bssid.data(), bssid_str);
 
     // Display AP info with all details
-    Serial.printf("%-2d | %-30s | %3d | %4d | %1s | %4d | %4d | %7d | %-24s | %3s | %8s | %s\n",
+    Serial.printf("%-2d | %-30s | %3d | %4d | %1s | %4d | %4d | %7s | %-24s | %3s | %8s | %s\n",
                   displayed_count + 1,
-                  ssid.c_str(),
+                  ssid,
                   display_length,
                   original_length,
                   (ap.hidden ? "H" : " "),
                   ap.rssi,
                   ap.channel,
-                  actual_clients,
-                  enc_str.c_str(),
-                  wps_status.c_str(),
-                  revealed_status.c_str(),
-                  macToString(ap.bssid.data()).c_str());
+                  clients_str,
+                  enc_str,
+                  wps_status,
+                  revealed_status,
+                  bssid_str);
 
     displayed_count++;
-    printed_bssids.push_back(macToString(ap.bssid.data()));
+    printed_bssids.add(ap.bssid.data());
   }
 
   Serial.println("============================================================================================================================================");
-  Serial.printf("Active APs: %d | Hidden: %d | Revealed: %d | Total Reveals: %d | Channel: %d | Time: %lu s\n",
-                active_ap_count, hidden_count, hidden_revealed_count, hidden_ap_revealed,
+  Serial.printf("Shown APs: %d/%d | Hidden: %d | Revealed: %d | Total Reveals: %d | Channel: %d | Time: %lu s\n",
+                active_ap_count, ap_count, hidden_count, hidden_revealed_count, hidden_ap_revealed,
                 scan.current_channel, (millis() - scan.scan_start_time) / 1000);
 
+  unsigned long beacons_seen = beacons_parsed + beacons_skipped;
+  if (beacons_seen > 0) {
+    Serial.printf("Beacons: %lu parsed | %lu unchanged (%lu%% skipped)\n",
+                  beacons_parsed, beacons_skipped, beacons_skipped * 100 / beacons_seen);
+  }
+
   // Display probe cache statistics
   if (scan.probe_sniffing) {
     Serial.printf("Probe Cache: %d requests | Clients: %d | Assoc Frames: %d\n",
-                  probe_cache.size(), client_list.size(), total_association_frames);
+                  probeCacheCount(), client_list.size(), total_association_frames);
   }
 }
 
@@ -1740,64 +2185,56 @@ void displayClients() {
   }
   scan.last_client_scan = current_time;
 
-  // Sort clients by RSSI (strongest first)
-  std::sort(client_list.begin(), client_list.end(),
-            [](const ClientInfo& a, const ClientInfo& b) {
-              return a.rssi > b.rssi;
-            });
-
   Serial.println("\n==========================================================================================================");
   Serial.println("Nr | Client MAC        | RSSI | Chan | Packets | Probes | Associated AP        | Manufacturer");
   Serial.println("==========================================================================================================");
 
   int displayed = 0;
-  int active_clients = 0;
-
-  for (size_t i = 0; i < client_list.size(); i++) {
-    const ClientInfo& client = client_list[i];
+  int probing_clients = 0;
 
-    // Skip clients not seen recently
-    if (current_time - client.last_seen > 30000) {
+  // Walk the ranking best-first; only the rows actually shown are read
+  client_walker.reset();
+  int slot;
+  ClientView client;
+  while ((slot = client_walker.next()) >= 0) {
+    if (slot >= (int)client_list.size() || !readClientView(client_list[slot], &client)) {
       continue;
     }
-    active_clients++;
 
-    // Limit display
-    if (displayed >= 100) {
+    // Limit display to the configured top K
+    if (displayed >= scan.client_top_k) {
       Serial.println("... more clients not displayed ...");
       break;
     }
 
-    String ap_display = client.ap_bssid;
-    if (ap_display.length() > 20) {
-      ap_display = ap_display.substring(0, 17) + "...";
+    if (client.probing_active && (current_time - client.last_probe_time) < 10000) {
+      probing_clients++;
     }
 
+    // MACs are only formatted here, at display time
+    char mac_str[18];
+    char ap_str[18] = "N/A";
+    formatMAC(client.mac.data(), mac_str);
+    if (!isZeroMAC(client.ap_bssid.data())) formatMAC(client.ap_bssid.data(), ap_str);
+
     Serial.printf("%-2d | %s | %4d | %4d | %7d | %6d | %-20s | %s\n",
                   displayed + 1,
-                  macToString(client.mac.data()).c_str(),
+                  mac_str,
                   client.rssi,
                   client.channel,
                   client.packet_count,
                   client.probe_count,
-                  ap_display.c_str(),
-                  client.manufacturer.c_str());
+                  ap_str,
+                  client.manufacturer);
 
     displayed++;
   }
 
   Serial.println("==========================================================================================================");
-  Serial.printf("Active Clients: %d | Total Clients: %d | Total Packets: %d\n",
-                active_clients, client_list.size(), total_client_packets);
+  Serial.printf("Shown Clients: %d | Total Clients: %d | Total Packets: %d\n",
+                displayed, client_list.size(), total_client_packets);
 
   // Show probing activity
-  int probing_clients = 0;
-  for (const auto& client : client_list) {
-    if (client.probing_active && (current_time - client.last_probe_time) < 10000) {
-      probing_clients++;
-    }
-  }
-
   if (probing_clients > 0) {
     Serial.printf("Active Probers: %d | Probe Requests: %d\n",
                   probing_clients, total_probe_requests);
@@ -1808,73 +2245,401 @@ void displayAPs() {
   displayEnhancedAPs();
 }
 
-// ===== Scanning Functions =====
-void initWiFiPassive() {
-  WiFi.mode(WIFI_STA);
-  WiFi.disconnect();
-  delay(100);
+void displayProbeStatistics() {
+  const SSIDTable& t = ssid_table;
 
-  wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-  esp_wifi_init(&cfg);
-  esp_wifi_set_storage(WIFI_STORAGE_RAM);
-  esp_wifi_stop();
+  Serial.println("\n==========================================================================");
+  Serial.println("Nr | SSID                             | Probes | Clients | Ch | Last Seen");
+  Serial.println("==========================================================================");
 
-  esp_wifi_set_mode(WIFI_MODE_STA);
-  esp_wifi_start();
+  // Most recently probed first
+  unsigned long current_time = millis();
+  int shown = 0;
+  char ssid[33];
+  for (ssid_id_t id = t.lru_head; id != SSID_ID_NONE && shown < 50; id = t.lru_next[id]) {
+    Serial.printf("%-2d | %-32s | %6u | %7d | %2u | %lu s\n",
+                  shown + 1,
+                  formatSSID(t.ssid[id], t.ssid_len[id], ssid),
+                  t.probe_count[id],
+                  ssidClientCount(id),
+                  t.channel[id],
+                  (current_time - t.last_seen[id]) / 1000);
+    shown++;
+  }
+
+  Serial.println("==========================================================================");
+  Serial.printf("SSIDs: %d | Evicted: %lu | Probe Requests: %lu\n",
+                t.count, (unsigned long)t.evictions, total_probe_requests);
+  Serial.printf("Probing clients: %u of %d tracked | Recycled: %lu\n",
+                t.prober_count, SSID_PROBER_CAPACITY, (unsigned long)t.prober_evictions);
+}
+
+// Full table in event form. Rows carry the stream position the snapshot was
+// taken at; the host rebuilds from them and then applies newer events only.
+void emitScanSnapshot() {
+  uint32_t seq = scanEventsSeq();
+  int ap_rows = 0;
+  int sta_rows = 0;
+
+  scanEventPrintMarker("snap", seq, getAPCount(), getClientCount());
+
+  int n = min(ap_count, MAX_APS);
+  for (int slot = 0; slot < n; slot++) {
+    if (ap_rank.key(slot) == RANK_KEY_NONE) continue;  // Expired
+
+    APView ap;
+    if (!readAPView(aps[slot], &ap)) continue;
+
+    ScanEvent ev = {};
+    ev.seq = seq;
+    ev.type = SCAN_EV_AP_ADD;
+    memcpy(ev.mac, ap.bssid.data(), 6);
+    ev.rssi = ap.rssi;
+    ev.channel = ap.channel;
+    ev.enc = ap.encryption;
+    ev.ssid_len = ap.hidden ? 0 : min<uint8_t>(ap.ssid_len, 32);
+    memcpy(ev.ssid, ap.ssid, ev.ssid_len);
+    scanEventPrint(ev);
+    ap_rows++;
+  }
+
+  n = min((int)client_list.size(), MAX_CLIENTS);
+  for (int slot = 0; slot < n; slot++) {
+    ClientView client;
+    if (!readClientView(client_list[slot], &client)) continue;
+
+    ScanEvent ev = {};
+    ev.seq = seq;
+    ev.type = SCAN_EV_STA_ADD;
+    memcpy(ev.mac, client.mac.data(), 6);
+    memcpy(ev.peer, client.ap_bssid.data(), 6);
+    ev.rssi = client.rssi;
+    ev.channel = client.channel;
+    scanEventPrint(ev);
+    sta_rows++;
+  }
+
+  scanEventPrintMarker("snap_end", seq, ap_rows, sta_rows);
+}
+
+// ===== RSSI Report =====
+static bool readRssiStats(const RssiStats& src, const uint32_t& seq, RssiStats* out) {
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(seq);
+    *out = src;
+    if (!seqReadRetry(seq, start)) return true;
+  }
+  return false;
 }
 
-bool startAPScan() {
-  initWiFiPassive();
+void displayRssiStats(const String& mac_text) {
+  unsigned int b[6];
+  uint8_t mac[6];
+  if (sscanf(mac_text.c_str(), "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) {
+    Serial.println(F("Usage: scan rssi <mac>"));
+    return;
+  }
+  for (int i = 0; i < 6; i++) mac[i] = b[i];
 
-  ap_count = 0;
+  RssiStats stats;
+  const char* kind = nullptr;
+  bool consistent = false;
+  int channel = 0;
+  for (int i = 0; i < min(ap_count, MAX_APS); i++) {
+    if (memcmp(aps[i].bssid.data(), mac, 6) == 0) {
+      consistent = readRssiStats(aps[i].rssi_stats, aps[i].seq, &stats);
+      channel = aps[i].channel;
+      kind = "AP";
+      break;
+    }
+  }
+  if (!kind) {
+    ClientInfo* client = findClient(mac);
+    if (client) {
+      consistent = readRssiStats(client->rssi_stats, client->seq, &stats);
+      channel = client->channel;
+      kind = "Client";
+    }
+  }
+  if (!kind || !consistent || stats.samples == 0) {
+    Serial.println(kind ? "Record busy or no samples yet, try again" : "No AP or client with that MAC");
+    return;
+  }
+
+  char mac_str[18];
+  formatMAC(mac, mac_str);
+  Serial.printf("\n=== RSSI: %s %s (ch %d) ===\n", kind, mac_str, channel);
+  Serial.printf("EWMA: %.1f dBm (alpha 1/%d) | Last: %d | Min: %d | Max: %d | Samples: %u%s\n",
+                stats.ewma / (float)(1 << RSSI_FRAC_BITS), 1 << scan.rssi_ewma_shift,
+                stats.last, stats.min, stats.max, stats.samples, stats.samples == 255 ? "+" : "");
+  int noise = rssiNoiseFloor(channel);
+  if (noise) Serial.printf("Noise floor: %d dBm | SNR: %d dB\n", noise, rssiStatsValue(stats) - noise);
+  rssiStatsPrint(stats);
+}
+
+// The arena counter only sees scan state; the heap's own block counts cover
+// every allocation (Wi-Fi driver and other modules included), so a scan that
+// churns shows up there as drift even when the arena counter stands still.
+void displayScanHeapReport() {
+  const ScanArenaStats& a = scanArenaStats();
+  size_t free_now = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  size_t largest_now = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_INTERNAL);
+
+  Serial.println("\n===== Scan Heap =====");
+  if (a.capacity == 0) {
+    Serial.println("Arena: not allocated (no scan started yet)");
+  } else {
+    Serial.printf("Arena: %u bytes in %s | %u carved (%lu pools) | %lu failed carves\n",
+                  (unsigned)a.capacity, a.psram ? "PSRAM" : "internal RAM",
+                  (unsigned)a.used, (unsigned long)a.carves, (unsigned long)a.failed);
+    Serial.printf("Pools: clients %u/%u | SSID history %u/%u (%lu dropped) | printed filter %u (%u bytes)\n",
+                  (unsigned)client_list.size(), (unsigned)client_list.capacity(),
+                  ssid_history_live, SSID_HISTORY_POOL, ssid_history_dropped,
+                  (unsigned)printed_bssids.size(), (unsigned)printed_bssids.bytes());
+  }
+  Serial.printf("Arena heap calls: %lu total | %lu since scan start\n",
+                (unsigned long)a.heap_ops, (unsigned long)(a.heap_ops - scan_heap_ops_at_start));
+  Serial.printf("Internal heap: %u free | %u largest block | %u minimum free\n",
+                (unsigned)free_now, (unsigned)largest_now,
+                (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+  Serial.printf("Heap blocks: %u allocated | %u free\n",
+                (unsigned)info.allocated_blocks, (unsigned)info.free_blocks);
+  if (scan.active_ap || scan.active_sta) {
+    Serial.printf("Since scan start: free %+ld bytes | largest block %+ld bytes | "
+                  "allocated blocks %+ld | free blocks %+ld\n",
+                  (long)free_now - (long)scan_heap_free_at_start,
+                  (long)largest_now - (long)scan_heap_largest_at_start,
+                  (long)info.allocated_blocks - (long)scan_heap_blocks_at_start,
+                  (long)info.free_blocks - (long)scan_heap_free_blocks_at_start);
+  }
+#if SCAN_ALLOC_TRACE
+  Serial.printf("Per-frame blocks: %lu frames | %lu moved the count | net %+ld | max %+ld in one frame\n",
+                (unsigned long)alloc_trace_frames, (unsigned long)alloc_trace_changed,
+                (long)alloc_trace_blocks, (long)alloc_trace_max);
+#endif
+}
+
+// ===== Fast Start =====
+// One passive driver scan fills in BSSID/SSID/channel/auth for everything in
+// range (about 14 x SCAN_SEED_DWELL_MS) before sniffing starts. Rows merge by
+// BSSID through findOrCreateAP, so sniffing refines the same records;
+// packet_count and the frame totals keep counting sniffed frames only.
+static void seedAP(const wifi_ap_record_t& rec) {
+  APInfo* ap = findOrCreateAP(rec.bssid);
+  if (!ap) return;
+
+  seqWriteBegin(ap->seq);
+  uint8_t len = strnlen((const char*)rec.ssid, 32);
+  if (len > 0) {
+    memcpy(ap->ssid, rec.ssid, len);
+    ap->ssid[len] = '\0';
+    ap->ssid_len = len;
+    ap->original_ssid_len = len;
+    ap->ssid_known = true;
+    ap->hidden = false;
+  } else if (!ap->ssid_known) {
+    ap->hidden = true;
+    strncpy(ap->ssid, "[Hidden]", 32);
+    ap->ssid_len = 8;
+  }
+  addRssiSample(ap->rssi_stats, &ap->rssi, rec.rssi);
+  ap->channel = rec.primary;
+  ap->primary_channel = rec.primary;
+  ap->encryption = rec.authmode;
+  ap->wps_enabled = rec.wps;
+  ap->is_80211n = rec.phy_11n;
+  memcpy(ap->vendor_oui, ap->bssid.data(), 3);
+  ap->last_seen = millis();
+  ap->seeded = true;
+  seqWriteEnd(ap->seq);
+  apUpdated(ap);
+}
+
+// Returns the number of APs seeded, -1 if the driver scan failed
+static int seedFromDriverScan() {
+  wifi_scan_config_t cfg = {};
+  cfg.show_hidden = true;
+  cfg.scan_type = WIFI_SCAN_TYPE_PASSIVE;
+  cfg.scan_time.passive = SCAN_SEED_DWELL_MS;
+  if (esp_wifi_scan_start(&cfg, true) != ESP_OK) return -1;
+
+  uint16_t count = 0;
+  esp_wifi_scan_get_ap_num(&count);
+  count = min<uint16_t>(count, MAX_APS);
+  if (count == 0) return 0;
+
+  wifi_ap_record_t* records = (wifi_ap_record_t*)malloc(count * sizeof(wifi_ap_record_t));
+  if (!records) return -1;  // The driver drops its list at the next scan
+  esp_wifi_scan_get_ap_records(&count, records);
+  for (int i = 0; i < count; i++) {
+    seedAP(records[i]);
+  }
+  free(records);
+  return count;
+}
+
+// Runs with the scan subscription held, so loop() is the only writer here;
+// the scan leaves the radio on its last channel, so retune afterwards
+static int seedAPsFromDriver() {
+  esp_wifi_set_promiscuous(false);
+  int seeded = seedFromDriverScan();
+  esp_wifi_set_promiscuous(true);
+  rxBusSetChannel(scan_rx, scan.current_channel);
+  return seeded;
+}
+
+// Time to the first complete AP table (the fast-start benchmark)
+static bool warm_started = false;
+
+static void noteFirstTable(unsigned long now) {
+  if (scan.first_table_ms) return;
+  scan.first_table_ms = max(1UL, now - scan.scan_start_time);
+  Serial.printf("First AP table after %lu ms (%s)\n", scan.first_table_ms,
+                warm_started ? "warm start" : scan.fast_start ? "fast start" : "passive");
+}
+
+// ===== Warm Start =====
+// Restored records were stamped when the snapshot loaded; the scan that
+// adopts them restamps them so their lifetimes run from its start.
+static void adoptRestoredAPs(unsigned long now) {
+  for (int i = 0; i < ap_count; i++) {
+    seqWriteBegin(aps[i].seq);
+    aps[i].first_seen = now;
+    aps[i].last_seen = now;
+    seqWriteEnd(aps[i].seq);
+    rankAP(&aps[i]);
+  }
+  for (int id = 0; id < SSID_TABLE_CAPACITY; id++) {
+    if (ssid_table.ssid_len[id] == SSID_LEN_FREE) continue;
+    ssid_table.first_seen[id] = now;
+    ssid_table.last_seen[id] = now;
+  }
+}
+
+static void adoptRestoredClients(unsigned long now) {
+  for (auto& client : client_list) {
+    seqWriteBegin(client.seq);
+    client.first_seen = now;
+    client.last_seen = now;
+    seqWriteEnd(client.seq);
+    rankClient(&client);
+  }
+}
+
+// ===== Scanning Functions =====
+bool startAPScan() {
+  if (!scanStorageReady()) return false;
+  holdScanRx(true);
+
+  // A snapshot restored at boot is kept and refined instead of cleared
+  warm_started = scan.warm_aps;
+  scan.warm_aps = false;
+  if (!warm_started) {
+    seqWriteBegin(ap_table_seq);
+    ap_count = 0;
+    apIndexClear();
+    seqWriteEnd(ap_table_seq);
+    ap_rank.clear();
+    timerCancelAll(TIMER_AP);
+    timerCancelAll(TIMER_SSID);
+    queryIndexClearAPs();
+    ssidTableClear();
+  }
+  timerCancelAll(TIMER_ASSOC);
   printed_bssids.clear();
-  ap_list.clear();
-  ssid_list.clear();
-  ssid_probe_counts.clear();
-  ssid_client_map.clear();
-  ssid_last_seen.clear();
-  probe_cache.clear();
-  client_associations.clear();
+  probeCacheClear();
+  clearAssociations();
   hidden_ap_revealed = 0;
   total_association_frames = 0;
 
   total_probe_requests = 0;
   total_beacons = 0;
+  beacons_parsed = 0;
+  beacons_skipped = 0;
   total_data_frames = 0;
   total_management_frames = 0;
+  deviceCountClear(millis());
+  markScanHeapBaseline();
+  scanEventsReset();
 
-  esp_wifi_set_promiscuous(true);
-  esp_wifi_set_promiscuous_rx_cb(&promiscuousCallback);
-  esp_wifi_set_channel(scan.current_channel, WIFI_SECOND_CHAN_NONE);
+  scan.scan_start_time = millis();
+  scan.first_table_ms = 0;
+  scan.active_ap = false;
+  scan.active_sta = false;
+  if (!attachScanRx()) return false;
+  chanSchedReset(scan.scan_start_time, scan.current_channel);
+  if (warm_started) {
+    adoptRestoredAPs(scan.scan_start_time);
+    if (scan.output_format == SCAN_OUTPUT_TABLE && !scan.fast_start) {
+      displayAPs();
+      noteFirstTable(millis());
+    }
+  }
+
+  // The driver scan stops promiscuous capture, so it only runs on an idle bus
+  if (scan.fast_start && rxBusOthers(scan_rx) > 0) {
+    Serial.println("Fast start: skipped while another capture shares the radio");
+  } else if (scan.fast_start) {
+    int seeded = seedAPsFromDriver();
+    if (scan.output_format == SCAN_OUTPUT_TABLE) {
+      if (seeded < 0) Serial.println("Fast start: driver scan failed, sniffing only");
+      displayAPs();
+      noteFirstTable(millis());
+    }
+  }
 
   scan.active_ap = true;
   scan.active_sta = false;
   scan.channel_switch_time = millis();
-  scan.scan_start_time = millis();
   scan.last_probe_check = millis();
+  holdScanRx(false);
 
   return true;
 }
 
 bool startClientScan() {
-  initWiFiPassive();
-
-  client_list.clear();
-  client_associations.clear();
-  probe_cache.clear();
+  if (!scanStorageReady()) return false;
+  holdScanRx(true);
+
+  bool warm = scan.warm_clients;
+  scan.warm_clients = false;
+  if (!warm) {
+    seqWriteBegin(client_table_seq);
+    client_list.clear();
+    clientIndexClear();
+    ssidHistoryClear();
+    seqWriteEnd(client_table_seq);
+    client_rank.clear();
+    timerCancelAll(TIMER_CLIENT);
+    queryIndexClearStations();
+  }
+  timerCancelAll(TIMER_ASSOC);
+  clearAssociations();
+  probeCacheClear();
   total_client_packets = 0;
   total_association_frames = 0;
+  deviceCountClear(millis());
+  markScanHeapBaseline();
+  scanEventsReset();
 
-  esp_wifi_set_promiscuous(true);
-  esp_wifi_set_promiscuous_rx_cb(&promiscuousCallback);
-  esp_wifi_set_channel(scan.current_channel, WIFI_SECOND_CHAN_NONE);
+  scan.active_ap = false;
+  scan.active_sta = false;
+  if (!attachScanRx()) return false;
 
   scan.active_ap = false;
   scan.active_sta = true;
   scan.channel_switch_time = millis();
   scan.scan_start_time = millis();
+  chanSchedReset(scan.scan_start_time, scan.current_channel);
   scan.last_probe_check = millis();
   scan.last_client_scan = millis();
+  if (warm) {
+    adoptRestoredClients(scan.scan_start_time);
+    if (scan.output_format == SCAN_OUTPUT_TABLE) displayClients();
+  }
+  holdScanRx(false);
 
   return true;
 }
@@ -1887,12 +2652,34 @@ bool scan_setup(String mode) {
   } else if (mode == "stop") {
     scan.active_ap = false;
     scan.active_sta = false;
+    detachScanRx();
     return true;
   }
   return false;
 }
 
 // ===== Main Scanning Loops =====
+// Retunes when the channel scheduler says so; true once a sweep has completed.
+// While another capture owns the radio the scan follows it and treats each
+// sweep budget as a sweep, so tables still refresh.
+static bool hopChannel(unsigned long now) {
+  if (!rxBusMayHop(scan_rx)) {
+    scan.current_channel = rxBusChannel();
+    if (now - scan.channel_switch_time < CHAN_SWEEP_BUDGET_MS) return false;
+    scan.channel_switch_time = now;
+    return true;
+  }
+
+  bool sweep_done;
+  int next = chanSchedTick(now, scan.dwell_mode, scan.channel_hop_interval, &sweep_done);
+  if (next) {
+    scan.current_channel = next;
+    rxBusSetChannel(scan_rx, next);
+    scan.channel_switch_time = now;
+  }
+  return sweep_done;
+}
+
 bool scanAPs() {
   unsigned long current_time = millis();
 
@@ -1902,22 +2689,9 @@ bool scanAPs() {
     return false;
   }
 
-  if (current_time - scan.channel_switch_time >= scan.channel_hop_interval) {
-    scan.current_channel++;
-
-    if (scan.current_channel > TOTAL_CHANNELS) {
-      scan.current_channel = 1;
-      displayAPs();
-    }
-
-    esp_wifi_set_channel(scan.current_channel, WIFI_SECOND_CHAN_NONE);
-    scan.channel_switch_time = current_time;
-  }
-
-  // Check probe cache for hidden APs
-  if (scan.probe_sniffing && (current_time - scan.last_probe_check) >= PROBE_CACHE_CHECK_INTERVAL) {
-    checkProbeCacheForHiddenAPs();
-    scan.last_probe_check = current_time;
+  if (hopChannel(current_time) && scan.output_format == SCAN_OUTPUT_TABLE) {
+    displayAPs();
+    noteFirstTable(millis());
   }
 
   return true;
@@ -1932,20 +2706,13 @@ bool scanClients() {
     return false;
   }
 
-  if (current_time - scan.channel_switch_time >= scan.channel_hop_interval) {
-    scan.current_channel++;
-
-    if (scan.current_channel > TOTAL_CHANNELS) {
-      scan.current_channel = 1;
-      displayClients();
-    }
-
-    esp_wifi_set_channel(scan.current_channel, WIFI_SECOND_CHAN_NONE);
-    scan.channel_switch_time = current_time;
+  if (hopChannel(current_time) && scan.output_format == SCAN_OUTPUT_TABLE) {
+    displayClients();
   }
 
   // Display clients periodically
-  if (current_time - scan.last_client_scan >= scan.client_scan_interval) {
+  if (scan.output_format == SCAN_OUTPUT_TABLE &&
+      current_time - scan.last_client_scan >= scan.client_scan_interval) {
     displayClients();
     scan.last_client_scan = current_time;
   }
@@ -1953,7 +2720,29 @@ bool scanClients() {
   return true;
 }
 
+// A quiet channel delivers no frames to age records out with; loop() takes
+// the wheel over while the subscription is held
+static void advanceIdleTimers(unsigned long now) {
+  if (scan_rx < 0) return;
+  if (now - __atomic_load_n(&timers_advanced_at, __ATOMIC_RELAXED) < TIMER_IDLE_ADVANCE_MS) return;
+
+  holdScanRx(true);
+  now = millis();
+  timerAdvance(now);
+  timers_advanced_at = now;
+  holdScanRx(false);
+}
+
 bool scan_loop() {
+  unsigned long now = millis();
+  scanStoreLoop(now);
+  scanJournalLoop(now);
+  advanceIdleTimers(now);
+
+  if (scan.output_format == SCAN_OUTPUT_EVENTS) {
+    scanEventsDrain();
+  }
+
   if (scan.active_ap) {
     return scanAPs();
   } else if (scan.active_sta) {
@@ -1972,8 +2761,21 @@ void setChannelHopInterval(unsigned long interval) {
   scan.channel_hop_interval = interval;
 }
 
+void setDwellMode(uint8_t mode) {
+  scan.dwell_mode = mode == DWELL_FIXED ? DWELL_FIXED : DWELL_ADAPTIVE;
+}
+
+void setFastStart(bool enable) {
+  scan.fast_start = enable;
+}
+
+void setRssiSmoothing(uint8_t shift) {
+  scan.rssi_ewma_shift = max<int>(1, min<int>(shift, RSSI_EWMA_SHIFT_MAX));
+}
+
 void setMinimumRSSI(int rssi) {
   scan.min_rssi = rssi;
+  rxBusSetMinRssi(scan_rx, rssi);
 }
 
 void enableMACFiltering(bool enable) {
@@ -2000,6 +2802,39 @@ void setClientScanInterval(int interval) {
   scan.client_scan_interval = interval;
 }
 
+void setDisplayTopK(int k) {
+  if (k < 1) k = 1;
+  scan.ap_top_k = min(k, MAX_APS);
+  scan.client_top_k = min(k, MAX_CLIENTS);
+}
+
+// The rank trees are written by scanFrame(); hold it while they are rebuilt
+void setDisplaySortKey(uint8_t key) {
+  holdScanRx(true);
+  scan.rank_key = (key == RANK_BY_LAST_SEEN) ? RANK_BY_LAST_SEEN : RANK_BY_RSSI;
+  rebuildRankings();
+  holdScanRx(false);
+}
+
+// Switching to events starts with a snapshot so the host has a baseline
+void setScanOutputFormat(uint8_t format) {
+  bool events = format == SCAN_OUTPUT_EVENTS;
+  scan.output_format = events ? SCAN_OUTPUT_EVENTS : SCAN_OUTPUT_TABLE;
+  scanEventsEnable(events);
+  if (events) emitScanSnapshot();
+}
+
+// Armed timers pick the new lifetime up at their next check
+bool setRecordTTL(const String& type, unsigned long ttl_ms) {
+  if (type == "ap") scan.ap_ttl_ms = ttl_ms;
+  else if (type == "client") scan.client_ttl_ms = ttl_ms;
+  else if (type == "assoc") scan.assoc_ttl_ms = ttl_ms;
+  else if (type == "ssid") scan.ssid_ttl_ms = ttl_ms;
+  else if (type == "probe") scan.probe_ttl_ms = ttl_ms;
+  else return false;
+  return true;
+}
+
 // ===== Utility Functions =====
 int getAPCount() {
   return ap_count;
@@ -2010,59 +2845,39 @@ int getClientCount() {
 }
 
 void clearAllData() {
+  holdScanRx(true);
+  seqWriteBegin(ap_table_seq);
   ap_count = 0;
-  client_list.clear();
-  ssid_list.clear();
-  printed_bssids.clear();
-  printed_client_macs.clear();
-  ap_list.clear();
-  ssid_probe_counts.clear();
-  ssid_client_map.clear();
-  ssid_last_seen.clear();
-  probe_cache.clear();
-  client_associations.clear();
+  apIndexClear();
+  seqWriteEnd(ap_table_seq);
+  seqWriteBegin(client_table_seq);
+  if (scanArenaReady()) carveScanStorage();
+  clientIndexClear();
+  seqWriteEnd(client_table_seq);
+  ap_rank.clear();
+  client_rank.clear();
+  timerWheelReset(millis());
+  ssidTableClear();
+  probeCacheClear();
+  clearAssociations();
   hidden_ap_revealed = 0;
   total_association_frames = 0;
   total_client_packets = 0;
 
   total_probe_requests = 0;
   total_beacons = 0;
+  beacons_parsed = 0;
+  beacons_skipped = 0;
   total_data_frames = 0;
   total_management_frames = 0;
+  queryIndexClearAPs();
+  queryIndexClearStations();
+  rssiNoiseFloorClear();
+  deviceCountClear(millis());
+  scanEventsReset();
+  scan.warm_aps = false;
+  scan.warm_clients = false;
+  holdScanRx(false);
 
   Serial.println("All scan data cleared.");
 }
-
-void saveAPsToPreferences() {
-  preferences.begin(SCAN_PREFS_NAMESPACE, false);
-  preferences.putUInt(AP_COUNT_KEY, ap_count);
-
-  for (int i = 0; i < ap_count; i++) {
-    String key = "ap_" + String(i);
-    preferences.putBytes(key.c_str(), &aps[i], sizeof(APInfo));
-  }
-
-  preferences.end();
-  Serial.printf("Saved %d APs to preferences\n", ap_count);
-}
-
-void loadAPsFromPreferences() {
-  preferences.begin(SCAN_PREFS_NAMESPACE, true);
-  ap_count = preferences.getUInt(AP_COUNT_KEY, 0);
-
-  for (int i = 0; i < min(ap_count, MAX_APS); i++) {
-    String key = "ap_" + String(i);
-    preferences.getBytes(key.c_str(), &aps[i], sizeof(APInfo));
-  }
-
-  preferences.end();
-  Serial.printf("Loaded %d APs from preferences\n", ap_count);
-}
-
-int estimateClientCount(int rssi, int channel) {
-  if (rssi > -50) return random(3, 15);
-  else if (rssi > -60) return random(2, 8);
-  else if (rssi > -70) return random(1, 4);
-  else if (rssi > -80) return random(0, 2);
-  else return 0;
-}
\ No newline at end of file
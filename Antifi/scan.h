@@ -4,19 +4,37 @@
 #include <WiFi.h>
 #include <vector>
 #include <array>
-#include <Preferences.h>
 #include <map>
 #include <algorithm>
 #include <cstring>
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
 #include "esp_console.h"
+#include "rank.h"
+#include "oui.h"
+#include "ssid_table.h"
+#include "timer_wheel.h"
+#include "channel_sched.h"
+#include "scan_arena.h"
+#include "rssi_stats.h"
+#include "frame_view.h"
+#include "beacon_hash.h"
+#include "rx_bus.h"
 
 // ===== Configuration Constants =====
 #define MAX_APS 100          // Maximum number of APs to store
 #define MAX_CLIENTS 300      // Maximum number of clients to store
 #define MAX_SSID_HISTORY 20  // Store recent SSIDs per client
+#define SSID_HISTORY_POOL 600  // SSID history entries shared by all clients
+#define SSID_HISTORY_NONE 0xFFFF
 #define MAX_PROBE_CACHE 50   // Maximum probe requests to cache
+#define MAX_PROBED_APS 10    // Probed AP BSSIDs kept per client
+#define SCAN_SEED_DWELL_MS 120  // Passive dwell per channel for the fast-start driver scan
+#define SCAN_ALLOC_TRACE 0   // 1: count heap blocks each frame leaves behind (walks the heap twice per frame)
+
+// ===== Output Formats =====
+#define SCAN_OUTPUT_TABLE 0   // Periodic full tables
+#define SCAN_OUTPUT_EVENTS 1  // JSON-lines change events (scan_events.h)
 
 // ===== WiFi Frame Types =====
 #define FRAME_TYPE_MANAGEMENT 0x00
@@ -78,6 +96,7 @@ typedef struct {
   unsigned long last_seen;   // When last seen
   uint16_t probe_count;      // How many times probed
   bool is_hidden;            // If SSID was hidden
+  uint16_t next;             // Next entry of the same client (pool index)
 } SSIDHistory;
 
 // Structure for cached probe requests
@@ -90,17 +109,9 @@ typedef struct {
   int channel;                 // Channel where seen
   bool is_hidden;              // If SSID was hidden in probe
   mac_address_t target_bssid;  // Target AP BSSID (if directed probe)
+  uint32_t seq;                // Position in the probe ring (0 = empty)
 } ProbeCache;
 
-// Structure for client-AP associations
-typedef struct {
-  mac_address_t client_mac;
-  mac_address_t ap_bssid;
-  unsigned long first_associated;
-  unsigned long last_associated;
-  int association_count;
-} ClientAssociation;
-
 typedef struct {
   mac_address_t bssid;                            // MAC address of AP
   char ssid[33];                                  // SSID (max 32 chars + null)
@@ -111,7 +122,7 @@ typedef struct {
   int rssi;                                       // Signal strength in dBm
   int channel;                                    // WiFi channel
   wifi_auth_mode_t encryption;                    // Encryption type
-  int client_count;                               // Estimated client count
+  int client_count;                               // Stations in the association graph (-1 = none seen)
   unsigned long first_seen;                       // First detection timestamp
   unsigned long last_seen;                        // Last detection timestamp
   unsigned long packet_count;                     // Number of packets seen
@@ -129,182 +140,106 @@ typedef struct {
   uint8_t secondary_channel;                      // Secondary channel (0=none)
   bool ssid_revealed;                             // True if SSID was revealed via probe
   unsigned long ssid_revealed_time;               // When SSID was revealed
-  std::vector<mac_address_t> associated_clients;  // MACs of associated clients
+  uint32_t beacon_hash;                           // Body CRC of the last parsed beacon (0 = none)
+  RssiStats rssi_stats;                           // EWMA/range/histogram (rssi mirrors the EWMA)
+  const char* manufacturer;                       // BSSID vendor (flash string, cached at creation)
+  bool seeded;                                    // Filled in by the fast-start driver scan
+  bool announced;                                 // Event stream: added and not yet removed
+  bool reported_hidden;                           // Event stream: last reported state
+  int8_t reported_rssi;
+  uint8_t reported_channel;
+  uint8_t reported_enc;
+  uint32_t seq;                                   // Record sequence lock (odd while written)
 } APInfo;
 
 typedef struct {
   mac_address_t mac;           // Client MAC address
   int rssi;                    // Signal strength in dBm
   int channel;                 // Channel where seen
-  String ap_bssid;             // Associated AP's BSSID
   unsigned long first_seen;    // First detection timestamp
   unsigned long last_seen;     // Last detection timestamp
   unsigned long packet_count;  // Number of packets seen
-  String last_frame_type;      // Type of last seen frame
-  bool is_associated;          // True if associated with AP
-  String manufacturer;         // MAC vendor lookup
+  const char* last_frame_type;  // Type of last seen frame (static string)
+  const char* manufacturer;    // MAC vendor (flash string, cached at creation)
   int data_rate;               // Data rate in Mbps
   int probe_count;             // Number of probe requests
   bool is_handshaking;         // True if in handshake process
 
   // Enhanced SSID tracking
-  std::vector<SSIDHistory> ssid_history;  // History of SSIDs probed
-  String last_probed_ssid;                // Last SSID probed
+  uint16_t ssid_history;                  // First SSID history entry (pool index)
+  uint8_t ssid_history_count;             // Entries in this client's history
+  char last_probed_ssid[33];              // Last SSID probed
   uint8_t last_ssid_len;                  // Length of last SSID
   bool probing_active;                    // Actively probing
-  String targeted_ap;                     // AP being targeted for connection
+  mac_address_t targeted_ap;              // AP being targeted for connection
   uint16_t authentication_algo;           // Authentication algorithm
   uint16_t auth_seq;                      // Authentication sequence
   unsigned long last_probe_time;          // Last time client sent probe
-  std::vector<String> probed_aps;         // List of AP BSSIDs this client has probed
+  mac_address_t probed_aps[MAX_PROBED_APS];  // AP BSSIDs this client has probed (oldest first)
+  uint8_t probed_ap_count;                   // Valid entries in probed_aps
+  bool announced;                         // Event stream: added and not yet removed
+  int8_t reported_rssi;                   // Event stream: last reported RSSI
+  RssiStats rssi_stats;                   // EWMA/range/histogram (rssi mirrors the EWMA)
+  mac_address_t current_ap;               // Association graph's current AP (zero if none)
+  uint32_t seq;                           // Record sequence lock (odd while written)
 } ClientInfo;
 
-// ===== SSID Analysis Structure =====
+// ===== Snapshot Views =====
+// Display-only copies of the scan records. Readers (display, export, CLI)
+// work on these so the RX callback never has to wait for them.
 typedef struct {
+  mac_address_t bssid;
   char ssid[33];
   uint8_t ssid_len;
-  mac_address_t bssid;
-  unsigned long first_seen;
+  uint8_t original_ssid_len;
+  bool hidden;
+  bool ssid_known;
+  bool ssid_revealed;
+  bool wps_enabled;
+  int8_t wps_version;
+  int8_t rssi;
+  uint8_t channel;
+  wifi_auth_mode_t encryption;
+  int16_t associated_count;  // -1 if no association was ever seen
+  const char* manufacturer;
   unsigned long last_seen;
-  int channel;
-  int rssi;
-  uint16_t probe_count;
-  bool is_hidden;
-  bool from_probe_request;   // Seen in probe request
-  bool from_beacon;          // Seen in beacon
-  bool from_probe_response;  // Seen in probe response
-} SSIDInfo;
+} APView;
 
-// ===== Vendor OUI Database (Partial) =====
 typedef struct {
-  uint8_t oui[3];
-  const char* vendor;
-} VendorOUI;
-
-static const VendorOUI vendor_oui_list[] = {
-  { { 0x00, 0x1A, 0x11 }, "Google" },
-  { { 0x00, 0x0C, 0x29 }, "VMware" },
-  { { 0x00, 0x1B, 0x63 }, "Apple" },
-  { { 0x00, 0x1D, 0x0F }, "Apple" },
-  { { 0x00, 0x23, 0xDF }, "Apple" },
-  { { 0x00, 0x25, 0x00 }, "Apple" },
-  { { 0x00, 0x26, 0x08 }, "Apple" },
-  { { 0x00, 0x26, 0xB0 }, "Apple" },
-  { { 0x00, 0x50, 0xF2 }, "Microsoft" },
-  { { 0x00, 0x1E, 0x52 }, "HTC" },
-  { { 0x00, 0x1B, 0x77 }, "Nintendo" },
-  { { 0x00, 0x21, 0x6A }, "LG Electronics" },
-  { { 0x00, 0x1F, 0x32 }, "Sony Ericsson" },
-  { { 0x00, 0x00, 0xF0 }, "Samsung" },
-  { { 0x00, 0x02, 0x78 }, "Samsung" },
-  { { 0x00, 0x06, 0xF6 }, "Samsung" },
-  { { 0x00, 0x07, 0xAB }, "Samsung" },
-  { { 0x00, 0x0C, 0xF1 }, "Samsung" },
-  { { 0x00, 0x0D, 0xAE }, "Samsung" },
-  { { 0x00, 0x0E, 0x6D }, "Samsung" },
-  { { 0x00, 0x0F, 0x59 }, "Samsung" },
-  { { 0x00, 0x11, 0x2A }, "Samsung" },
-  { { 0x00, 0x12, 0x47 }, "Samsung" },
-  { { 0x00, 0x12, 0xFB }, "Samsung" },
-  { { 0x00, 0x13, 0x77 }, "Samsung" },
-  { { 0x00, 0x14, 0x7D }, "Samsung" },
-  { { 0x00, 0x15, 0x99 }, "Samsung" },
-  { { 0x00, 0x15, 0xB9 }, "Samsung" },
-  { { 0x00, 0x16, 0x32 }, "Samsung" },
-  { { 0x00, 0x16, 0x6B }, "Samsung" },
-  { { 0x00, 0x16, 0x6C }, "Samsung" },
-  { { 0x00, 0x16, 0xDB }, "Samsung" },
-  { { 0x00, 0x17, 0x9E }, "Samsung" },
-  { { 0x00, 0x18, 0xAF }, "Samsung" },
-  { { 0x00, 0x0C, 0x8A }, "Huawei" },
-  { { 0x00, 0x1B, 0x74 }, "Huawei" },
-  { { 0x00, 0x1E, 0x10 }, "Huawei" },
-  { { 0x00, 0x25, 0x68 }, "Huawei" },
-  { { 0x00, 0x26, 0x5E }, "Huawei" },
-  { { 0x00, 0x18, 0x82 }, "Cisco" },
-  { { 0x00, 0x1B, 0xD4 }, "Cisco" },
-  { { 0x00, 0x1C, 0x0E }, "Cisco" },
-  { { 0x00, 0x1D, 0x45 }, "Cisco" },
-  { { 0x00, 0x21, 0x1A }, "Cisco" },
-  { { 0x00, 0x24, 0x14 }, "Cisco" },
-  { { 0x00, 0x50, 0x43 }, "Netgear" },
-  { { 0x00, 0x1F, 0x33 }, "Netgear" },
-  { { 0x00, 0x22, 0x3F }, "Netgear" },
-  { { 0x00, 0x24, 0xB2 }, "Netgear" },
-  { { 0x00, 0x26, 0xF2 }, "Netgear" },
-  { { 0x00, 0x04, 0x96 }, "TP-Link" },
-  { { 0x00, 0x17, 0x66 }, "TP-Link" },
-  { { 0x00, 0x1D, 0x0F }, "TP-Link" },
-  { { 0x00, 0x21, 0x27 }, "TP-Link" },
-  { { 0x00, 0x23, 0xCD }, "TP-Link" },
-  { { 0x00, 0x14, 0x6C }, "Belkin" },
-  { { 0x00, 0x17, 0x3F }, "Belkin" },
-  { { 0x00, 0x1E, 0x5A }, "Belkin" },
-  { { 0x00, 0x22, 0x93 }, "Belkin" },
-  { { 0x00, 0x24, 0x01 }, "Belkin" },
-  { { 0x00, 0x0B, 0x86 }, "ASUS" },
-  { { 0x00, 0x11, 0x2F }, "ASUS" },
-  { { 0x00, 0x13, 0xD4 }, "ASUS" },
-  { { 0x00, 0x15, 0xF2 }, "ASUS" },
-  { { 0x00, 0x1A, 0x92 }, "ASUS" },
-  { { 0x00, 0x1D, 0x60 }, "ASUS" },
-  { { 0x00, 0x22, 0x15 }, "ASUS" },
-  { { 0x00, 0x24, 0x8C }, "ASUS" },
-  { { 0x00, 0x26, 0x18 }, "ASUS" },
-  { { 0x00, 0x30, 0xBD }, "Linksys" },
-  { { 0x00, 0x06, 0x25 }, "Linksys" },
-  { { 0x00, 0x0C, 0x41 }, "Linksys" },
-  { { 0x00, 0x12, 0x17 }, "Linksys" },
-  { { 0x00, 0x14, 0xBF }, "Linksys" },
-  { { 0x00, 0x16, 0xB6 }, "Linksys" },
-  { { 0x00, 0x18, 0xF8 }, "Linksys" },
-  { { 0x00, 0x19, 0xAA }, "Linksys" },
-  { { 0x00, 0x1A, 0x70 }, "Linksys" },
-  { { 0x00, 0x1C, 0x10 }, "Linksys" },
-  { { 0x00, 0x90, 0x4C }, "Epic Games" },
-  { { 0x00, 0x14, 0xA4 }, "Google" },
-  { { 0x00, 0x1A, 0x11 }, "Google" },
-  { { 0x00, 0x26, 0xAB }, "Amazon" },
-  { { 0x00, 0x1C, 0x62 }, "Amazon" },
-  { { 0x00, 0x22, 0x69 }, "Amazon" },
-  { { 0x00, 0x25, 0x9C }, "Amazon" },
-  { { 0x00, 0x1D, 0x25 }, "Intel" },
-  { { 0x00, 0x13, 0xCE }, "Intel" },
-  { { 0x00, 0x16, 0x6F }, "Intel" },
-  { { 0x00, 0x18, 0xDE }, "Intel" },
-  { { 0x00, 0x1B, 0x77 }, "Intel" },
-  { { 0x00, 0x1C, 0xBF }, "Intel" },
-  { { 0x00, 0x1E, 0x67 }, "Intel" },
-  { { 0x00, 0x21, 0x6A }, "Intel" },
-  { { 0x00, 0x22, 0xFA }, "Intel" },
-  { { 0x00, 0x24, 0xD6 }, "Intel" },
-  { { 0x00, 0x26, 0xC7 }, "Intel" },
-  { { 0x00, 0x1F, 0x5B }, "Roku" },
-  { { 0x00, 0x0D, 0x4B }, "Roku" },
-  { { 0x00, 0x17, 0xAB }, "Roku" },
-  { { 0x00, 0x1B, 0x11 }, "Roku" },
-  { { 0x00, 0x20, 0x07 }, "Sonos" },
-  { { 0x00, 0x0E, 0x58 }, "Sonos" },
-  { { 0x00, 0x12, 0x5E }, "Sonos" },
-  { { 0x00, 0x13, 0xEF }, "Sonos" },
-  { { 0x00, 0x17, 0x88 }, "Sonos" },
-  { { 0x00, 0x1B, 0x66 }, "Sonos" },
-  { { 0x00, 0x1C, 0xDF }, "Sonos" },
-  { { 0x00, 0x22, 0x5C }, "Philips Hue" },
-  { { 0x00, 0x17, 0x88 }, "Philips Hue" },
-  { { 0x00, 0x1E, 0xC0 }, "Wyze" },
-  { { 0x00, 0x18, 0x02 }, "D-Link" },
-  { { 0x00, 0x1B, 0x11 }, "D-Link" },
-  { { 0x00, 0x1C, 0xF0 }, "D-Link" },
-  { { 0x00, 0x21, 0x91 }, "D-Link" },
-  { { 0x00, 0x26, 0x5A }, "D-Link" },
-  { { 0x00, 0x0F, 0x3D }, "Buffalo" },
-  { { 0x00, 0x14, 0xA5 }, "Buffalo" },
-  { { 0x00, 0x1D, 0x73 }, "Buffalo" },
-  { { 0x00, 0x21, 0x91 }, "Buffalo" },
-  { { 0x00, 0x24, 0x01 }, "Buffalo" },
-  { { 0x00, 0x00, 0x00 }, "Unknown" }
-};
+  mac_address_t mac;
+  int8_t rssi;
+  uint8_t channel;
+  bool probing_active;
+  mac_address_t ap_bssid;  // All zero if not associated
+  const char* manufacturer;
+  uint16_t probe_count;
+  unsigned long packet_count;
+  unsigned long last_seen;
+  unsigned long last_probe_time;
+} ClientView;
+
+// ===== Record Sequence Locks =====
+// Single-writer seqlock: the writer makes seq odd while it rewrites a record,
+// readers copy the fields they need and retry if seq moved underneath them.
+#define SEQLOCK_READ_RETRIES 16
+
+static inline void seqWriteBegin(uint32_t& seq) {
+  __atomic_store_n(&seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void seqWriteEnd(uint32_t& seq) {
+  __atomic_store_n(&seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t seqReadBegin(const uint32_t& seq) {
+  return __atomic_load_n(&seq, __ATOMIC_ACQUIRE);
+}
+
+static inline bool seqReadRetry(const uint32_t& seq, uint32_t start) {
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return (start & 1) || __atomic_load_n(&seq, __ATOMIC_RELAXED) != start;
+}
 
 // ===== Enhanced Global Scanning State Structure =====
 struct ScanState {
@@ -332,14 +267,31 @@ struct ScanState {
   bool track_client_ssids = false;        // Track SSIDs probed by each client
   unsigned long last_client_scan = 0;     // Last client scan display
   int client_scan_interval = 3000;        // Display clients every 3 seconds
+  int ap_top_k = 50;                      // APs shown per display pass
+  int client_top_k = 100;                 // Clients shown per display pass
+  uint8_t rank_key = RANK_BY_RSSI;        // Display order (RANK_BY_*)
+  uint8_t output_format = SCAN_OUTPUT_TABLE;  // SCAN_OUTPUT_*
+  uint8_t dwell_mode = DWELL_ADAPTIVE;        // ChanDwellMode
+  uint8_t rssi_ewma_shift = RSSI_EWMA_SHIFT_DEFAULT;  // RSSI smoothing, alpha = 1/2^shift
+  bool fast_start = false;                    // Seed the AP table with one driver scan first
+  unsigned long first_table_ms = 0;           // Scan start to first AP table (0 = not yet)
+  bool warm_aps = false;                      // AP/SSID tables hold a restored snapshot
+  bool warm_clients = false;                  // Client table holds a restored snapshot
+
+  // Record lifetimes, ms after last seen (enforced by the timer wheel)
+  unsigned long ap_ttl_ms = 30000;
+  unsigned long client_ttl_ms = 30000;
+  unsigned long assoc_ttl_ms = 30000;
+  unsigned long ssid_ttl_ms = 300000;
+  unsigned long probe_ttl_ms = 30000;
 };
 
 // ===== Function Prototypes =====
 
 // === MAC Address Utilities ===
-String macToString(const uint8_t* mac);
-String getVendorFromMAC(const uint8_t* mac);
-String getManufacturerFromMAC(const uint8_t* mac);
+void formatMAC(const uint8_t* mac, char* out);  // out holds 18 bytes
+const char* getVendorFromMAC(const uint8_t* mac);
+const char* getManufacturerFromMAC(const uint8_t* mac);
 mac_address_t arrayToMac(const uint8_t* mac);
 void macToArray(const mac_address_t& mac_struct, uint8_t* mac);
 
@@ -350,13 +302,14 @@ bool isProbeResponseFrame(const uint8_t* frame_ctrl);
 bool isProbeRequestFrame(const uint8_t* frame_ctrl);
 bool isDataFrame(const uint8_t* frame_ctrl);
 bool isManagementFrame(const uint8_t* frame_ctrl);
-String getFrameTypeString(uint8_t frame_type, uint8_t frame_subtype);
+const char* getFrameTypeString(uint8_t frame_type, uint8_t frame_subtype);
 
 // === SSID Handling ===
 uint8_t extractSSIDFromFrame(const uint8_t* frame, uint16_t frame_len, char* ssid_out);
 uint8_t extractSSIDFromFrame(const uint8_t* frame, uint16_t frame_len, char* ssid_out,
                              uint8_t frame_type, uint8_t frame_subtype, bool* is_hidden);
-String formatSSID(const char* ssid_data, uint8_t ssid_len);
+// Printable form of an SSID: a constant, or out (33 bytes) filled in
+const char* formatSSID(const char* ssid_data, uint8_t ssid_len, char* out);
 
 // === SSID Analysis & Tracking ===
 void analyzeSSIDFromProbeRequest(const uint8_t* frame, uint16_t frame_len,
@@ -375,7 +328,6 @@ bool isLocallyAdministeredMAC(const uint8_t* mac);
 bool compareMAC(const mac_address_t& mac1, const uint8_t* mac2);
 
 // === Encryption Detection ===
-String getEncryptionType(wifi_auth_mode_t encryptionType);
 wifi_auth_mode_t determineEncryptionFromFrame(const uint8_t* frame, uint16_t frame_len);
 const char* getCompleteEncryptionType(wifi_auth_mode_t encryptionType);
 
@@ -390,35 +342,45 @@ bool isAlreadyPrinted(const uint8_t* bssid);
 void updateAPInfo(APInfo* ap, const uint8_t* frame, uint16_t frame_len, int rssi, int channel);
 void updateAPWithEnhancedInfo(APInfo* ap, const uint8_t* frame, uint16_t frame_len,
                               int rssi, int channel, uint8_t frame_subtype);
-int estimateClientCount(int rssi, int channel);
 bool updateHiddenAPWithProbeSSID(const uint8_t* ap_bssid, const char* ssid, uint8_t ssid_len);
-void checkProbeCacheForHiddenAPs();
 void updateAPClientAssociation(const uint8_t* ap_bssid, const uint8_t* client_mac);
 void removeClientFromAP(const uint8_t* ap_bssid, const uint8_t* client_mac);
 
 // === Enhanced Client Management ===
 ClientInfo* findClient(const uint8_t* mac);
-void updateClient(ClientInfo* client, int rssi, int channel, const String& ap_bssid, const String& frame_type);
+void updateClient(ClientInfo* client, int rssi, int channel, const uint8_t* ap_bssid, const char* frame_type);
 void updateClientWithSSIDInfo(ClientInfo* client, const uint8_t* frame, uint16_t frame_len,
                               int rssi, int channel, uint8_t frame_subtype);
-void addNewClient(const uint8_t* mac, int rssi, int channel, const String& ap_bssid, const String& frame_type);
-void addOrUpdateClient(const uint8_t* mac, int rssi, int channel, const String& ap_bssid, const String& frame_type);
-void cleanupOldClients();
+void addNewClient(const uint8_t* mac, int rssi, int channel, const uint8_t* ap_bssid, const char* frame_type);
+void addOrUpdateClient(const uint8_t* mac, int rssi, int channel, const uint8_t* ap_bssid, const char* frame_type);
+ClientInfo* restoreClient(const uint8_t* mac);
 void displayClients();
 void displayClientDetails(const uint8_t* client_mac);
 void trackClientProbedAP(const uint8_t* client_mac, const uint8_t* ap_bssid);
 
 // === Enhanced Packet Handlers ===
-void passivePacketHandler(void* buf, wifi_promiscuous_pkt_type_t type);
-void enhancedPacketHandler(void* buf, wifi_promiscuous_pkt_type_t type);
-void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type);
-void processEnhancedClientPacket(const wifi_promiscuous_pkt_t* packet, int rssi, int channel);
+void processEnhancedClientPacket(const FrameView& f);
+
+// === Ranking ===
+void rankAP(const APInfo* ap);
+void rankClient(const ClientInfo* client);
+// Writer only: call with the scan subscription held or not running
+void rebuildRankings();
+
+// === Snapshots ===
+bool readAPView(const APInfo& ap, APView* out);
+bool readClientView(const ClientInfo& client, ClientView* out);
+int snapshotAPs(APView* out, int max_views);
+int snapshotClients(ClientView* out, int max_views);
 
 // === Display Functions ===
 void displayAPs();
 void displayEnhancedAPs();
 void displayClientSummary();
 void displayProbeStatistics();
+void displayScanHeapReport();
+void displayRssiStats(const String& mac);
+void emitScanSnapshot();
 
 // === Scanning Control Functions ===
 bool scan_setup(String mode);
@@ -426,11 +388,15 @@ bool scan_loop();
 bool startAPScan();
 bool startClientScan();
 void stopScan();
-void initWiFiPassive();
+void scanBegin();         // Empties the fixed tables (boot, before any restore or scan)
+bool scanStorageReady();  // Carves the scan arena on first use
 
 // === Configuration Functions ===
 void setScanDuration(unsigned long duration);
 void setChannelHopInterval(unsigned long interval);
+void setDwellMode(uint8_t mode);
+void setFastStart(bool enable);
+void setRssiSmoothing(uint8_t shift);
 void setMinimumRSSI(int rssi);
 void enableMACFiltering(bool enable);
 void enableWPSDetection(bool enable);
@@ -438,27 +404,29 @@ void enableProbeSniffing(bool enable);
 void enableProbeDebug(bool enable);
 void enableEnhancedClientTracking(bool enable);
 void setClientScanInterval(int interval);
+void setDisplayTopK(int k);
+void setDisplaySortKey(uint8_t key);
+void setScanOutputFormat(uint8_t format);
+bool setRecordTTL(const String& type, unsigned long ttl_ms);
 
 // === Utility Functions ===
 int getAPCount();
 int getClientCount();
 void clearAllData();
-void saveAPsToPreferences();
-void loadAPsFromPreferences();
 
 // ===== Global Variable Declarations (External) =====
-extern std::vector<APInfo> ap_list;
-extern std::vector<ClientInfo> client_list;
-extern std::vector<SSIDInfo> ssid_list;                     // Track all unique SSIDs
-extern std::vector<ProbeCache> probe_cache;                 // Cache for probe requests
-extern std::vector<ClientAssociation> client_associations;  // Client-AP associations
+extern ScanPool<ClientInfo> client_list;  // Carved from the scan arena
 extern APInfo aps[MAX_APS];
 extern int ap_count;
 extern ScanState scan;
+extern uint32_t ap_table_seq;      // Bumped around AP slot (re)allocation
+extern uint32_t client_table_seq;  // Bumped around client insert/erase
 
 // ===== Statistics (External) =====
 extern unsigned long total_probe_requests;
 extern unsigned long total_beacons;
+extern unsigned long beacons_parsed;   // Beacons whose IEs were parsed
+extern unsigned long beacons_skipped;  // Beacons identical to the last parsed one
 extern unsigned long total_data_frames;
 extern unsigned long total_management_frames;
 extern unsigned long hidden_ap_revealed;
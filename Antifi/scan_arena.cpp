@@ -0,0 +1,54 @@
+#include "scan_arena.h"
+
+// ===== Arena State =====
+static uint8_t* arena = nullptr;
+static ScanArenaStats stats = {};
+
+// ===== Public API =====
+bool scanArenaBegin(size_t bytes) {
+  if (arena) return true;
+
+  // PSRAM first; boards without it fall back to internal RAM
+  arena = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  stats.psram = arena != nullptr;
+  if (!arena) {
+    arena = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  stats.heap_ops++;
+
+  if (!arena) {
+    Serial.printf("Error: scan arena allocation failed (%u bytes)\n", (unsigned)bytes);
+    return false;
+  }
+
+  stats.capacity = bytes;
+  scanArenaRewind();
+  return true;
+}
+
+bool scanArenaReady() {
+  return arena != nullptr;
+}
+
+void* scanArenaAlloc(size_t bytes) {
+  size_t size = scanArenaSize(bytes);
+  if (!arena || size > stats.capacity - stats.used) {
+    stats.failed++;
+    return nullptr;
+  }
+
+  void* p = arena + stats.used;
+  stats.used += size;
+  stats.carves++;
+  if (stats.used > stats.high_water) stats.high_water = stats.used;
+  return p;
+}
+
+void scanArenaRewind() {
+  stats.used = 0;
+  stats.carves = 0;
+}
+
+const ScanArenaStats& scanArenaStats() {
+  return stats;
+}
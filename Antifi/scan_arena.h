@@ -0,0 +1,124 @@
+#ifndef SCAN_ARENA_H
+#define SCAN_ARENA_H
+
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+
+// ===== Configuration Constants =====
+#define SCAN_ARENA_ALIGN 8  // Every carve is aligned to this
+
+// ===== Scan Arena =====
+// One block taken from the heap the first time a scan starts and never given
+// back. All growable scan state is carved out of it as fixed-capacity pools,
+// so scanning does no heap allocation at all after start-up and cannot
+// fragment the heap other modules (sniffer, portal) depend on. The block
+// goes to PSRAM when the board has it.
+//
+// Carving is a bump allocation; rewinding drops every carve at once.
+typedef struct {
+  size_t capacity;    // Bytes in the block (0 = not allocated yet)
+  size_t used;        // Bytes carved since the last rewind
+  size_t high_water;  // Most bytes ever carved
+  uint32_t carves;    // Carves since the last rewind
+  uint32_t failed;    // Carves that did not fit
+  uint32_t heap_ops;  // heap_caps_malloc calls made for scan state (1 once allocated)
+  bool psram;         // Block lives in PSRAM
+} ScanArenaStats;
+
+// Allocates the block if it is not there yet. False if the heap can't supply it.
+bool scanArenaBegin(size_t bytes);
+
+bool scanArenaReady();
+
+// Carves `bytes` (aligned); nullptr when the arena is full or not allocated
+void* scanArenaAlloc(size_t bytes);
+
+// Drops every carve; O(1)
+void scanArenaRewind();
+
+const ScanArenaStats& scanArenaStats();
+
+template <typename T>
+T* scanArenaAllocArray(size_t n) {
+  return (T*)scanArenaAlloc(sizeof(T) * n);
+}
+
+// Rounds a carve size up the way scanArenaAlloc() will
+static inline size_t scanArenaSize(size_t bytes) {
+  return (bytes + SCAN_ARENA_ALIGN - 1) & ~(size_t)(SCAN_ARENA_ALIGN - 1);
+}
+
+// ===== Fixed-Capacity Pool =====
+// Vector-shaped view over arena storage. Elements must be plain data: they
+// are copied bytewise and never constructed or destroyed. Storage never
+// moves once bound, so seqlock readers can index it while it is written.
+template <typename T>
+class ScanPool {
+public:
+  void bind(T* storage, size_t capacity) {
+    items = storage;
+    cap = storage ? capacity : 0;
+    count = 0;
+  }
+
+  // O(1): records are simply forgotten
+  void clear() {
+    count = 0;
+  }
+
+  bool push_back(const T& item) {
+    if (count >= cap) return false;
+    items[count++] = item;
+    return true;
+  }
+
+  void pop_back() {
+    if (count > 0) count--;
+  }
+
+  size_t size() const {
+    return count;
+  }
+  size_t capacity() const {
+    return cap;
+  }
+  bool empty() const {
+    return count == 0;
+  }
+  bool full() const {
+    return count >= cap;
+  }
+
+  T* data() {
+    return items;
+  }
+  T& operator[](size_t i) {
+    return items[i];
+  }
+  const T& operator[](size_t i) const {
+    return items[i];
+  }
+  T& back() {
+    return items[count - 1];
+  }
+
+  T* begin() {
+    return items;
+  }
+  T* end() {
+    return items + count;
+  }
+  const T* begin() const {
+    return items;
+  }
+  const T* end() const {
+    return items + count;
+  }
+
+private:
+  T* items = nullptr;
+  size_t cap = 0;
+  size_t count = 0;
+};
+
+#endif  // SCAN_ARENA_H
@@ -0,0 +1,151 @@
+#include "scan_events.h"
+#include "scan.h"
+
+// ===== Ring State =====
+static ScanEvent ring[SCAN_EVENT_RING];
+static uint32_t ring_head = 0;  // Written by the RX callback
+static uint32_t ring_tail = 0;  // Written by loop()
+static uint32_t event_seq = 0;
+static uint32_t dropped = 0;    // Events lost to a full ring since the last drain
+static bool enabled = false;
+
+static const char* const event_names[] = {
+  "reset", "ap+", "ap-", "ap_ssid", "ap_rssi", "ap_enc", "ap_chan", "sta+", "sta-", "sta_rssi", "assoc",
+  "disassoc",
+};
+
+// ===== JSON Output =====
+// SSIDs are arbitrary bytes; escape what JSON can't carry raw
+static size_t appendSSID(char* out, size_t room, const char* ssid, uint8_t len) {
+  size_t n = 0;
+  for (uint8_t i = 0; i < len && n + 7 < room; i++) {
+    uint8_t c = (uint8_t)ssid[i];
+    if (c == '"' || c == '\\') {
+      out[n++] = '\\';
+      out[n++] = c;
+    } else if (c < 0x20 || c >= 0x7F) {
+      n += snprintf(out + n, room - n, "\\u%04x", c);
+    } else {
+      out[n++] = c;
+    }
+  }
+  out[n] = '\0';
+  return n;
+}
+
+void scanEventPrint(const ScanEvent& ev) {
+  char line[192];
+  char mac[18];
+  formatMAC(ev.mac, mac);
+
+  const char* name = ev.type < sizeof(event_names) / sizeof(event_names[0]) ? event_names[ev.type] : "?";
+  int n = snprintf(line, sizeof(line), "{\"seq\":%lu,\"ev\":\"%s\"", (unsigned long)ev.seq, name);
+  if (ev.type != SCAN_EV_RESET) {
+    n += snprintf(line + n, sizeof(line) - n, ",\"mac\":\"%s\"", mac);
+  }
+
+  switch (ev.type) {
+    case SCAN_EV_AP_ADD:
+    case SCAN_EV_AP_SSID:
+      n += snprintf(line + n, sizeof(line) - n, ",\"ssid\":\"");
+      n += appendSSID(line + n, sizeof(line) - n - 48, ev.ssid, ev.ssid_len);
+      n += snprintf(line + n, sizeof(line) - n, "\"");
+      if (ev.type == SCAN_EV_AP_SSID) break;
+      n += snprintf(line + n, sizeof(line) - n, ",\"ch\":%u,\"rssi\":%d,\"enc\":%u",
+                    ev.channel, ev.rssi, ev.enc);
+      break;
+    case SCAN_EV_AP_RSSI:
+    case SCAN_EV_STA_RSSI:
+      n += snprintf(line + n, sizeof(line) - n, ",\"rssi\":%d,\"ch\":%u", ev.rssi, ev.channel);
+      break;
+    case SCAN_EV_AP_ENC:
+      n += snprintf(line + n, sizeof(line) - n, ",\"enc\":%u", ev.enc);
+      break;
+    case SCAN_EV_AP_CHAN:
+      n += snprintf(line + n, sizeof(line) - n, ",\"ch\":%u", ev.channel);
+      break;
+    case SCAN_EV_STA_ADD: {
+      char peer[18];
+      formatMAC(ev.peer, peer);
+      n += snprintf(line + n, sizeof(line) - n, ",\"ch\":%u,\"rssi\":%d,\"ap\":\"%s\"",
+                    ev.channel, ev.rssi, peer);
+      break;
+    }
+    case SCAN_EV_ASSOC:
+    case SCAN_EV_DISASSOC: {
+      char peer[18];
+      formatMAC(ev.peer, peer);
+      n += snprintf(line + n, sizeof(line) - n, ",\"ap\":\"%s\"", peer);
+      break;
+    }
+    default:
+      break;
+  }
+
+  snprintf(line + n, sizeof(line) - n, "}");
+  Serial.println(line);
+}
+
+void scanEventPrintMarker(const char* name, uint32_t seq, int aps, int stations) {
+  Serial.printf("{\"seq\":%lu,\"ev\":\"%s\",\"aps\":%d,\"stas\":%d}\n",
+                (unsigned long)seq, name, aps, stations);
+}
+
+// ===== Public API =====
+void scanEventsEnable(bool enable) {
+  enabled = enable;
+}
+
+bool scanEventsEnabled() {
+  return enabled;
+}
+
+// Consumer side: skips what is queued and prints the marker directly, so
+// the RX callback stays the only producer
+void scanEventsReset() {
+  __atomic_store_n(&ring_tail, __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+  __atomic_store_n(&dropped, 0, __ATOMIC_RELAXED);
+  if (enabled) {
+    ScanEvent ev = {};
+    ev.type = SCAN_EV_RESET;
+    ev.seq = scanEventsSeq();
+    scanEventPrint(ev);
+  }
+}
+
+void scanEventPush(ScanEvent& ev) {
+  if (!enabled) return;
+  ev.seq = __atomic_add_fetch(&event_seq, 1, __ATOMIC_RELAXED);
+
+  uint32_t head = ring_head;
+  if (head - __atomic_load_n(&ring_tail, __ATOMIC_ACQUIRE) >= SCAN_EVENT_RING) {
+    __atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);  // Host sees the gap in seq
+    return;
+  }
+  ring[head & (SCAN_EVENT_RING - 1)] = ev;
+  __atomic_store_n(&ring_head, head + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t scanEventsSeq() {
+  return __atomic_load_n(&event_seq, __ATOMIC_RELAXED);
+}
+
+int scanEventsDrain(int budget) {
+  int printed = 0;
+  uint32_t tail = ring_tail;
+  uint32_t head = __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE);
+
+  while (printed < budget && tail != head) {
+    scanEventPrint(ring[tail & (SCAN_EVENT_RING - 1)]);
+    tail++;
+    printed++;
+    __atomic_store_n(&ring_tail, tail, __ATOMIC_RELEASE);
+  }
+
+  uint32_t lost = __atomic_exchange_n(&dropped, 0, __ATOMIC_RELAXED);
+  if (lost > 0) {
+    Serial.printf("{\"seq\":%lu,\"ev\":\"lost\",\"n\":%lu}\n",
+                  (unsigned long)scanEventsSeq(), (unsigned long)lost);
+  }
+  return printed;
+}
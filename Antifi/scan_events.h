@@ -0,0 +1,77 @@
+#ifndef SCAN_EVENTS_H
+#define SCAN_EVENTS_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define SCAN_EVENT_RING 128         // Queued events (power of two)
+#define SCAN_EVENT_DRAIN_BUDGET 16  // Events printed per scan_loop() pass
+#define SCAN_EVENT_RSSI_STEP 10     // RSSI bucket width (dB)
+#define SCAN_EVENT_RSSI_HYST 3      // dB past the old value before a bucket change counts
+
+// ===== Event Types =====
+enum ScanEventType : uint8_t {
+  SCAN_EV_RESET,     // Tables were cleared
+  SCAN_EV_AP_ADD,    // AP first seen (or seen again after expiring)
+  SCAN_EV_AP_DEL,    // AP expired or evicted
+  SCAN_EV_AP_SSID,   // Hidden AP's SSID revealed
+  SCAN_EV_AP_RSSI,   // AP RSSI moved to another bucket
+  SCAN_EV_AP_ENC,    // AP encryption changed
+  SCAN_EV_AP_CHAN,   // AP channel changed
+  SCAN_EV_STA_ADD,   // Station first seen
+  SCAN_EV_STA_DEL,   // Station expired or evicted
+  SCAN_EV_STA_RSSI,  // Station RSSI moved to another bucket
+  SCAN_EV_ASSOC,     // Station's current AP changed (peer = new AP)
+  SCAN_EV_DISASSOC,  // Station left the AP (peer = AP)
+};
+
+// ===== Scan Event Stream =====
+// Instead of reprinting whole tables, the scanner can emit one JSON line per
+// change. Every event carries a sequence number; a gap means events were
+// dropped and the host should ask for a snapshot. Snapshot rows reuse the
+// add events and carry the sequence number the snapshot was taken at, so
+// the host skips any queued event at or below it.
+//
+// The RX callback pushes, loop() drains: single producer, single consumer.
+typedef struct {
+  uint32_t seq;
+  uint8_t type;      // ScanEventType
+  uint8_t mac[6];    // AP BSSID or station MAC
+  uint8_t peer[6];   // Station: associated AP (all zero if none)
+  int8_t rssi;
+  uint8_t channel;
+  uint8_t enc;       // wifi_auth_mode_t
+  uint8_t ssid_len;  // 0 = hidden / unknown
+  char ssid[33];
+} ScanEvent;
+
+void scanEventsEnable(bool enable);
+bool scanEventsEnabled();
+
+// Drops queued events and prints a reset marker (loop() side)
+void scanEventsReset();
+
+// Queues the event and stamps its sequence number (dropped if the ring is full)
+void scanEventPush(ScanEvent& ev);
+
+// Sequence number of the newest event
+uint32_t scanEventsSeq();
+
+// Prints up to `budget` queued events, returns how many
+int scanEventsDrain(int budget = SCAN_EVENT_DRAIN_BUDGET);
+
+// Prints one event as a JSON line
+void scanEventPrint(const ScanEvent& ev);
+
+// Prints a snapshot marker ("snap" / "snap_end")
+void scanEventPrintMarker(const char* name, uint32_t seq, int aps, int stations);
+
+// True if the RSSI left its bucket by more than the hysteresis
+static inline bool scanEventRssiCrossed(int reported, int rssi) {
+  int delta = rssi - reported;
+  if (delta < 0) delta = -delta;
+  return delta >= SCAN_EVENT_RSSI_HYST &&
+         (reported + 200) / SCAN_EVENT_RSSI_STEP != (rssi + 200) / SCAN_EVENT_RSSI_STEP;
+}
+
+#endif  // SCAN_EVENTS_H
@@ -0,0 +1,461 @@
+#include "scan_journal.h"
+#include <SD.h>
+#include <unistd.h>
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "scan.h"
+
+// ===== Block Layout =====
+#define BLOCK_HEADER_CRC 16   // Header bytes before the CRC field
+#define BLOCK_RECORDS_AT SCAN_JOURNAL_RECORD
+#define BLOCK_RECORDS_LEN (SCAN_JOURNAL_PER_BLOCK * SCAN_JOURNAL_RECORD)
+
+// ===== Staging =====
+// Filled by the RX callback, committed by the writer task: single producer,
+// single consumer. Records are only encoded at commit time, off the RX path.
+typedef struct {
+  uint32_t seq;
+  uint32_t ms;
+  uint8_t type;
+  uint8_t channel;
+  int8_t rssi;
+  uint8_t enc;
+  uint8_t mac[6];
+  uint8_t peer[6];
+  uint8_t ssid_len;
+  char ssid[32];
+} StagedRecord;
+
+static StagedRecord* stage = nullptr;  // Allocated on first enable, never freed
+static uint32_t stage_size = 0;
+static uint32_t stage_mask = 0;
+static uint32_t stage_head = 0;  // Written by the RX callback
+static uint32_t stage_tail = 0;  // Written by whoever holds file_lock
+static uint32_t journal_seq = 0;
+static bool enabled = false;
+
+// ===== Writer Task =====
+static TaskHandle_t writer = NULL;
+static SemaphoreHandle_t file_lock = NULL;  // Held around everything that touches `file`
+static volatile bool write_failed = false;  // Set under file_lock, reported by loop()
+
+// ===== File State =====
+static File file;
+static uint8_t group[SCAN_JOURNAL_BLOCK * SCAN_JOURNAL_GROUP_BLOCKS];
+static uint32_t next_block = 0;
+static uint16_t boot = 0;
+static bool boot_set = false;
+
+static struct {
+  uint32_t dropped;  // Written by the RX callback
+  uint32_t staged_max;
+  uint32_t commits;
+  uint32_t records;
+  uint32_t blocks;
+  uint32_t failures;
+  uint32_t commit_us_last;
+  uint32_t commit_us_max;
+  uint64_t commit_us_total;
+  uint32_t recovered_blocks;
+  uint32_t truncated_bytes;
+  const char* recover_error;
+  uint32_t events_per_s;  // Offered to the journal, dropped ones included
+  uint32_t events_per_s_max;
+  uint32_t drops_per_s;
+  uint32_t drop_seconds;  // Seconds in which anything was dropped
+} stats = {};
+
+// Last rate sample (loop)
+static struct {
+  unsigned long ms;
+  uint32_t seq;
+  uint32_t dropped;
+} rate = {};
+
+static bool sdReady() {
+  return SD.cardType() != CARD_NONE;
+}
+
+// ===== Encoding =====
+static inline void writeLE16(uint8_t* p, uint16_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+static inline void writeLE32(uint8_t* p, uint32_t v) {
+  writeLE16(p, v);
+  writeLE16(p + 2, v >> 16);
+}
+
+static inline uint16_t readLE16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t readLE32(const uint8_t* p) {
+  return readLE16(p) | ((uint32_t)readLE16(p + 2) << 16);
+}
+
+static void encodeRecord(uint8_t* p, const StagedRecord& r) {
+  writeLE32(p, r.seq);
+  writeLE32(p + 4, r.ms);
+  p[8] = r.type;
+  p[9] = r.channel;
+  p[10] = (uint8_t)r.rssi;
+  p[11] = r.enc;
+  memcpy(p + 12, r.mac, 6);
+  memcpy(p + 18, r.peer, 6);
+  p[24] = r.ssid_len;
+  memcpy(p + 25, r.ssid, r.ssid_len);  // Block is zeroed beforehand
+}
+
+static uint32_t blockCrc(const uint8_t* b) {
+  uint32_t crc = esp_rom_crc32_le(0, b, BLOCK_HEADER_CRC);
+  return esp_rom_crc32_le(crc, b + BLOCK_RECORDS_AT, BLOCK_RECORDS_LEN);
+}
+
+// Encodes `count` staged records starting at `tail` as the next block
+static void encodeBlock(uint8_t* b, uint32_t tail, int count) {
+  memset(b, 0, SCAN_JOURNAL_BLOCK);
+  writeLE32(b, SCAN_JOURNAL_MAGIC);
+  writeLE16(b + 4, SCAN_JOURNAL_VERSION);
+  writeLE16(b + 6, count);
+  writeLE32(b + 8, next_block);
+  writeLE16(b + 12, boot);
+  for (int i = 0; i < count; i++) {
+    encodeRecord(b + BLOCK_RECORDS_AT + i * SCAN_JOURNAL_RECORD, stage[(tail + i) & stage_mask]);
+  }
+  writeLE32(b + BLOCK_HEADER_CRC, blockCrc(b));
+}
+
+static bool blockValid(const uint8_t* b) {
+  uint16_t count = readLE16(b + 6);
+  return readLE32(b) == SCAN_JOURNAL_MAGIC && readLE16(b + 4) == SCAN_JOURNAL_VERSION && count >= 1 &&
+         count <= SCAN_JOURNAL_PER_BLOCK && readLE32(b + BLOCK_HEADER_CRC) == blockCrc(b);
+}
+
+// ===== Staging (RX callback) =====
+void scanJournalAppend(const ScanEvent& ev) {
+  if (!enabled) return;
+  uint32_t seq = __atomic_add_fetch(&journal_seq, 1, __ATOMIC_RELAXED);
+
+  uint32_t head = stage_head;
+  uint32_t tail = __atomic_load_n(&stage_tail, __ATOMIC_ACQUIRE);
+  if (head - tail >= stage_size) {
+    __atomic_fetch_add(&stats.dropped, 1, __ATOMIC_RELAXED);  // Decoder sees the gap in seq
+    return;
+  }
+
+  StagedRecord& r = stage[head & stage_mask];
+  r.seq = seq;
+  r.ms = millis();
+  r.type = ev.type;
+  r.channel = ev.channel;
+  r.rssi = ev.rssi;
+  r.enc = ev.enc;
+  memcpy(r.mac, ev.mac, 6);
+  memcpy(r.peer, ev.peer, 6);
+  r.ssid_len = min<uint8_t>(ev.ssid_len, 32);
+  memcpy(r.ssid, ev.ssid, r.ssid_len);
+  __atomic_store_n(&stage_head, head + 1, __ATOMIC_RELEASE);
+
+  // A full group wakes the writer; anything less waits for its poll
+  if (head + 1 - tail == SCAN_JOURNAL_GROUP_RECORDS) xTaskNotifyGive(writer);
+}
+
+// ===== Group Commit (file_lock held) =====
+// Encodes up to `limit` staged records group by group, appends each group
+// with a single write and flushes once at the end, so a backlog shares one
+// flush across up to SCAN_JOURNAL_FLUSH_GROUPS groups. Returns the records
+// committed, -1 if a write failed.
+static int commitRun(uint32_t limit) {
+  uint32_t tail = stage_tail;
+  uint32_t staged = __atomic_load_n(&stage_head, __ATOMIC_ACQUIRE) - tail;
+  if (staged == 0) return 0;
+  if (staged > stats.staged_max) stats.staged_max = staged;
+  staged = min<uint32_t>(staged, min<uint32_t>(limit, SCAN_JOURNAL_RUN_RECORDS));
+
+  uint32_t start = micros();
+  int blocks = 0;
+  uint32_t taken = 0;
+  bool ok = true;
+  while (ok && taken < staged) {
+    int group_blocks = 0;
+    while (taken < staged && group_blocks < SCAN_JOURNAL_GROUP_BLOCKS) {
+      int count = min<uint32_t>(staged - taken, SCAN_JOURNAL_PER_BLOCK);
+      encodeBlock(group + group_blocks * SCAN_JOURNAL_BLOCK, tail + taken, count);
+      next_block++;
+      taken += count;
+      group_blocks++;
+    }
+    size_t len = (size_t)group_blocks * SCAN_JOURNAL_BLOCK;
+    ok = file.write(group, len) == len;
+    __atomic_store_n(&stage_tail, tail + taken, __ATOMIC_RELEASE);  // Room for the RX callback right away
+    blocks += group_blocks;
+  }
+  if (ok) file.flush();
+
+  uint32_t us = micros() - start;
+  stats.commit_us_last = us;
+  if (us > stats.commit_us_max) stats.commit_us_max = us;
+  stats.commit_us_total += us;
+  stats.commits++;
+  if (!ok) {
+    stats.failures++;
+    return -1;
+  }
+  stats.records += taken;
+  stats.blocks += blocks;
+  return taken;
+}
+
+// A failed write may have left part of a group behind; stop appending and
+// let the next enable recover the tail before writing after it
+static void failStop() {
+  enabled = false;
+  file.close();
+  write_failed = true;
+}
+
+// Every full group, then the rest once the oldest record is old enough
+static void commitDue() {
+  while (file) {
+    uint32_t tail = stage_tail;
+    uint32_t staged = __atomic_load_n(&stage_head, __ATOMIC_ACQUIRE) - tail;
+    if (staged == 0) return;
+    uint32_t limit = staged - staged % SCAN_JOURNAL_GROUP_RECORDS;
+    if (limit == 0) {
+      if ((long)(millis() - stage[tail & stage_mask].ms) < SCAN_JOURNAL_COMMIT_MS) return;
+      limit = staged;
+    }
+    if (commitRun(limit) < 0) {
+      failStop();
+      return;
+    }
+  }
+}
+
+static void commitAll() {
+  if (!file) return;
+  int n;
+  while ((n = commitRun(SCAN_JOURNAL_RUN_RECORDS)) > 0) {
+  }
+  if (n < 0) failStop();
+}
+
+static void writerTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SCAN_JOURNAL_POLL_MS));
+    xSemaphoreTake(file_lock, portMAX_DELAY);
+    commitDue();
+    xSemaphoreGive(file_lock);
+  }
+}
+
+// Ring, lock and task outlive every disable: the RX callback may still be
+// inside scanJournalAppend() when journaling stops
+static bool startWriter() {
+  if (!stage) {
+    // PSRAM first; boards without it fall back to internal RAM, then to a
+    // smaller ring
+    size_t bytes = sizeof(StagedRecord) * SCAN_JOURNAL_STAGE;
+    stage_size = SCAN_JOURNAL_STAGE;
+    stage = (StagedRecord*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!stage) stage = (StagedRecord*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!stage) {
+      stage_size = SCAN_JOURNAL_STAGE_MIN;
+      stage = (StagedRecord*)heap_caps_malloc(sizeof(StagedRecord) * stage_size,
+                                              MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!stage) {
+      Serial.println("Error: journal staging ring allocation failed");
+      return false;
+    }
+    stage_mask = stage_size - 1;
+  }
+  if (!file_lock) file_lock = xSemaphoreCreateMutex();
+  if (!file_lock) return false;
+  if (!writer && xTaskCreate(writerTask, "journal", SCAN_JOURNAL_TASK_STACK, NULL, SCAN_JOURNAL_TASK_PRIO,
+                             &writer) != pdPASS) {
+    writer = NULL;
+    Serial.println("Error: journal writer task could not start");
+    return false;
+  }
+  return true;
+}
+
+void scanJournalLoop(unsigned long now) {
+  if (write_failed) {
+    write_failed = false;
+    Serial.println("[!] Journal write failed; journaling stopped");
+  }
+  if (!enabled || now - rate.ms < 1000) return;
+
+  uint32_t seq = __atomic_load_n(&journal_seq, __ATOMIC_RELAXED);
+  uint32_t dropped = __atomic_load_n(&stats.dropped, __ATOMIC_RELAXED);
+  unsigned long elapsed = now - rate.ms;
+  stats.events_per_s = (uint64_t)(seq - rate.seq) * 1000 / elapsed;
+  stats.drops_per_s = (uint64_t)(dropped - rate.dropped) * 1000 / elapsed;
+  if (stats.events_per_s > stats.events_per_s_max) stats.events_per_s_max = stats.events_per_s;
+  if (dropped != rate.dropped) stats.drop_seconds++;
+  rate.ms = now;
+  rate.seq = seq;
+  rate.dropped = dropped;
+}
+
+void scanJournalFlush() {
+  if (!file_lock) return;
+  xSemaphoreTake(file_lock, portMAX_DELAY);
+  commitAll();
+  xSemaphoreGive(file_lock);
+}
+
+// ===== Recovery =====
+// Only the last run can be torn, so only the blocks it may cover
+// (plus the one before, for the numbering) are checked. Everything from the
+// first bad block on is cut off.
+static bool recoverTail() {
+  stats.recover_error = NULL;
+  if (!sdReady()) {
+    stats.recover_error = "no SD card";
+    return false;
+  }
+
+  uint32_t last_block = 0;
+  uint32_t last_seq = 0;
+  uint16_t last_boot = 0;
+  uint32_t good = 0;
+  uint32_t size = 0;
+
+  if (SD.exists(SCAN_JOURNAL_PATH)) {
+    File f = SD.open(SCAN_JOURNAL_PATH, FILE_READ);
+    if (!f) {
+      stats.recover_error = "open failed";
+      return false;
+    }
+    size = f.size();
+    uint32_t blocks = size / SCAN_JOURNAL_BLOCK;
+    uint32_t first = blocks > SCAN_JOURNAL_RUN_BLOCKS ? blocks - SCAN_JOURNAL_RUN_BLOCKS - 1 : 0;
+    uint8_t* b = group;  // Not committing yet; reuse the group buffer
+
+    good = first;
+    for (uint32_t i = first; i < blocks; i++) {
+      if (!f.seek(i * SCAN_JOURNAL_BLOCK) || f.read(b, SCAN_JOURNAL_BLOCK) != SCAN_JOURNAL_BLOCK ||
+          !blockValid(b)) {
+        break;
+      }
+      uint16_t count = readLE16(b + 6);
+      last_block = readLE32(b + 8);
+      last_boot = readLE16(b + 12);
+      last_seq = readLE32(b + BLOCK_RECORDS_AT + (count - 1) * SCAN_JOURNAL_RECORD);
+      good = i + 1;
+    }
+    f.close();
+
+    // Nothing in the window was readable: number on from the block count
+    if (good == first && first > 0) last_block = first - 1;
+  }
+
+  uint32_t keep = good * SCAN_JOURNAL_BLOCK;
+  if (keep < size) {
+    if (truncate(SCAN_JOURNAL_VFS_PATH, keep) != 0) {
+      stats.recover_error = "truncate failed";
+      return false;
+    }
+    stats.truncated_bytes += size - keep;
+  }
+  stats.recovered_blocks = good;
+
+  next_block = good ? last_block + 1 : 0;
+  __atomic_store_n(&journal_seq, last_seq, __ATOMIC_RELAXED);
+  if (!boot_set) {
+    boot = good ? last_boot + 1 : 0;
+    boot_set = true;
+  }
+  return true;
+}
+
+void scanJournalRecover() {
+  if (!sdReady() || !SD.exists(SCAN_JOURNAL_PATH)) return;
+
+  uint32_t truncated = stats.truncated_bytes;
+  if (!recoverTail()) {
+    Serial.printf("[!] Journal recovery failed: %s\n", stats.recover_error);
+    return;
+  }
+  if (stats.truncated_bytes != truncated) {
+    Serial.printf("[*] Journal: cut %lu bytes of torn tail, %lu blocks kept\n",
+                  (unsigned long)(stats.truncated_bytes - truncated), (unsigned long)stats.recovered_blocks);
+  }
+}
+
+// ===== Control =====
+bool scanJournalEnable(bool enable) {
+  if (!enable) {
+    enabled = false;
+    if (!file_lock) return true;
+    xSemaphoreTake(file_lock, portMAX_DELAY);
+    commitAll();
+    file.close();
+    xSemaphoreGive(file_lock);
+    return true;
+  }
+  if (enabled) return true;
+
+  if (!sdReady() || (!SD.exists(SCAN_JOURNAL_DIR) && !SD.mkdir(SCAN_JOURNAL_DIR))) return false;
+  if (!startWriter()) return false;
+
+  xSemaphoreTake(file_lock, portMAX_DELAY);
+  bool ok = recoverTail();
+  if (ok) {
+    file = SD.open(SCAN_JOURNAL_PATH, FILE_APPEND);
+    ok = (bool)file;
+  }
+  if (ok) {
+    // Whatever was staged before the last stop belongs to the old numbering
+    __atomic_store_n(&stage_tail, __atomic_load_n(&stage_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    rate.ms = millis();
+    rate.seq = __atomic_load_n(&journal_seq, __ATOMIC_RELAXED);
+    rate.dropped = __atomic_load_n(&stats.dropped, __ATOMIC_RELAXED);
+    write_failed = false;
+    enabled = true;
+  }
+  xSemaphoreGive(file_lock);
+  return ok;
+}
+
+bool scanJournalEnabled() {
+  return enabled;
+}
+
+// ===== Report =====
+void scanJournalReport() {
+  uint32_t staged = __atomic_load_n(&stage_head, __ATOMIC_ACQUIRE) - stage_tail;
+
+  Serial.println("\n=== SCAN JOURNAL ===");
+  Serial.printf("File: %s | Format v%d | SD: %s | Journaling: %s\n", SCAN_JOURNAL_PATH, SCAN_JOURNAL_VERSION,
+                sdReady() ? "ready" : "missing", enabled ? "on" : "off");
+  Serial.printf("Boot: %u | Next block: %lu | Last seq: %lu\n", boot, (unsigned long)next_block,
+                (unsigned long)__atomic_load_n(&journal_seq, __ATOMIC_RELAXED));
+  Serial.printf("Staged: %lu/%lu (peak %lu) | Dropped: %lu\n", (unsigned long)staged, (unsigned long)stage_size,
+                (unsigned long)stats.staged_max, (unsigned long)stats.dropped);
+  Serial.printf("Rate: %lu events/s (peak %lu) | Drops: %lu/s (%lu seconds with drops)\n",
+                (unsigned long)stats.events_per_s, (unsigned long)stats.events_per_s_max,
+                (unsigned long)stats.drops_per_s, (unsigned long)stats.drop_seconds);
+  Serial.printf("Commits: %lu | Records: %lu | Blocks: %lu (%lu KB) | Failures: %lu\n", (unsigned long)stats.commits,
+                (unsigned long)stats.records, (unsigned long)stats.blocks,
+                (unsigned long)(stats.blocks * SCAN_JOURNAL_BLOCK / 1024), (unsigned long)stats.failures);
+  if (stats.commits) {
+    Serial.printf("Commit time: %lu us last, %lu us avg, %lu us max | %.1f records/commit\n",
+                  (unsigned long)stats.commit_us_last, (unsigned long)(stats.commit_us_total / stats.commits),
+                  (unsigned long)stats.commit_us_max, (float)stats.records / stats.commits);
+  }
+  if (stats.recover_error) {
+    Serial.printf("Recovery: failed (%s)\n", stats.recover_error);
+  } else if (boot_set) {
+    Serial.printf("Recovery: %lu blocks kept | %lu bytes of torn tail cut\n", (unsigned long)stats.recovered_blocks,
+                  (unsigned long)stats.truncated_bytes);
+  }
+}
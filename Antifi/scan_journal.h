@@ -0,0 +1,78 @@
+#ifndef SCAN_JOURNAL_H
+#define SCAN_JOURNAL_H
+
+#include <Arduino.h>
+#include "scan_events.h"
+
+// ===== Configuration Constants =====
+#define SCAN_JOURNAL_DIR "/journal"
+#define SCAN_JOURNAL_PATH "/journal/scan.jnl"
+#define SCAN_JOURNAL_VFS_PATH "/sd/journal/scan.jnl"  // Same file through the SD mount (truncate)
+#define SCAN_JOURNAL_MAGIC 0x4C4A4641u                // "AFJL"
+#define SCAN_JOURNAL_VERSION 1
+#define SCAN_JOURNAL_STAGE 1024       // Staged records (power of two); ~60 KB, PSRAM first
+#define SCAN_JOURNAL_STAGE_MIN 256    // Internal RAM fallback when the full ring does not fit
+#define SCAN_JOURNAL_BLOCK 512        // One SD sector
+#define SCAN_JOURNAL_RECORD 64        // Bytes per record
+#define SCAN_JOURNAL_PER_BLOCK 7      // Slot 0 of every block is its header
+#define SCAN_JOURNAL_GROUP_BLOCKS 8   // Blocks per SD write
+#define SCAN_JOURNAL_FLUSH_GROUPS 4   // Groups a backlog may write before one flush
+#define SCAN_JOURNAL_COMMIT_MS 2000   // Commit anyway once the oldest staged record is this old
+#define SCAN_JOURNAL_POLL_MS 100      // Writer task wakes at least this often
+#define SCAN_JOURNAL_TASK_STACK 4096
+#define SCAN_JOURNAL_TASK_PRIO 1      // Level with loop(), below the WiFi task
+#define SCAN_JOURNAL_GROUP_RECORDS (SCAN_JOURNAL_PER_BLOCK * SCAN_JOURNAL_GROUP_BLOCKS)
+#define SCAN_JOURNAL_RUN_BLOCKS (SCAN_JOURNAL_GROUP_BLOCKS * SCAN_JOURNAL_FLUSH_GROUPS)
+#define SCAN_JOURNAL_RUN_RECORDS (SCAN_JOURNAL_GROUP_RECORDS * SCAN_JOURNAL_FLUSH_GROUPS)
+
+// ===== Journal Format =====
+// Append-only, little-endian, a whole number of 512-byte blocks:
+//
+//   block header  magic u32 | version u16 | count u16 | block u32 | boot u16 |
+//                 reserved u16 | CRC-32 u32 | 44 zero bytes
+//   record x 7    seq u32 | ms u32 | type u8 | ch u8 | rssi i8 | enc u8 |
+//                 mac[6] | peer[6] | ssid_len u8 | ssid[32] | 7 zero bytes
+//
+// `count` says how many record slots are used; the rest are zero. The CRC
+// covers the first 16 header bytes (with the CRC field itself left out) and
+// all seven record slots. `block` counts blocks since the file was created,
+// `boot` counts boots that appended to it (`ms` is uptime, so it restarts
+// with every boot), and `seq` numbers records across boots: a gap means the
+// staging buffer overflowed. Record types are ScanEventType.
+//
+// Blocks are only ever appended in runs of up to SCAN_JOURNAL_FLUSH_GROUPS
+// commit groups followed by a flush. A crash can therefore only damage the
+// last run, so recovery at boot checks the tail and truncates it at the first
+// block that fails.
+
+// ===== Threading =====
+// The RX callback stages records, a writer task of its own commits them:
+// single producer, single consumer. The task wakes when a group's worth is
+// staged (or every SCAN_JOURNAL_POLL_MS to commit old records), so SD write
+// and flush latency never lands in the RX callback or in loop(). The ring
+// only has to absorb the events that arrive during one commit: at 1024
+// records that is 250 ms at 4000 events/s.
+
+// ===== Public API =====
+// Boot: drops a torn tail left by a crash and picks up the numbering
+void scanJournalRecover();
+
+// Starts or stops journaling; stopping commits what is staged. The first
+// enable allocates the ring and starts the writer task; both are kept.
+bool scanJournalEnable(bool enable);
+bool scanJournalEnabled();
+
+// Stages one event; never touches the SD card. Single producer: only the
+// scan writer (the RX callback) may call it
+void scanJournalAppend(const ScanEvent& ev);
+
+// loop() side: samples the event and drop rates, reports a failed write.
+// Never blocks on the card.
+void scanJournalLoop(unsigned long now);
+
+// Commits everything staged now (waits for the writer task's commit)
+void scanJournalFlush();
+
+void scanJournalReport();
+
+#endif  // SCAN_JOURNAL_H
@@ -0,0 +1,489 @@
+#include "scan_query.h"
+
+// ===== Index State =====
+#define QUERY_SLOT_NONE 0xFF
+#define QUERY_VENDOR_OVERFLOW QUERY_VENDOR_SETS
+#define QUERY_BSS_OVERFLOW QUERY_BSS_SETS
+
+static APSet ap_live;
+static APSet ap_by_channel[QUERY_CHANNELS];
+static APSet ap_by_enc[QUERY_ENC_SETS];
+static APSet ap_by_vendor[QUERY_VENDOR_SETS + 1];
+static uint8_t ap_channel[MAX_APS];
+static uint8_t ap_enc[MAX_APS];
+static uint8_t ap_vendor[MAX_APS];
+static const char* ap_vendor_name[MAX_APS];
+
+static StationSet sta_live;
+static StationSet sta_by_channel[QUERY_CHANNELS];
+static StationSet sta_by_vendor[QUERY_VENDOR_SETS + 1];
+static uint8_t sta_channel[MAX_CLIENTS];
+static uint8_t sta_vendor[MAX_CLIENTS];
+static const char* sta_vendor_name[MAX_CLIENTS];
+static StationSet sta_by_bss[QUERY_BSS_SETS + 1];
+static uint8_t sta_bss[MAX_CLIENTS];
+
+// BSS IDs are claimed by a station's current AP and freed with its last
+// member, so roaming does not use them up
+static mac_address_t bss_macs[QUERY_BSS_SETS];
+static uint16_t bss_members[QUERY_BSS_SETS];  // 0: free
+
+// Vendor IDs are shared by both tables and only reset with them
+static const char* vendor_names[QUERY_VENDOR_SETS];
+static int vendor_count = 0;
+
+// ===== Helpers =====
+static inline uint8_t channelSet(uint8_t channel) {
+  return channel < QUERY_CHANNELS ? channel : 0;
+}
+
+static inline uint8_t encSet(uint8_t enc) {
+  return enc < QUERY_ENC_SETS ? enc : QUERY_ENC_SETS - 1;
+}
+
+static uint8_t vendorId(const char* vendor) {
+  for (int i = 0; i < vendor_count; i++) {
+    if (vendor_names[i] == vendor) return i;
+  }
+  if (vendor_count < QUERY_VENDOR_SETS) {
+    vendor_names[vendor_count] = vendor;
+    return vendor_count++;
+  }
+  return QUERY_VENDOR_OVERFLOW;
+}
+
+// BSS set holding the BSSID's stations, -1 if it has none
+static int bssId(const uint8_t* bssid) {
+  for (int i = 0; i < QUERY_BSS_SETS; i++) {
+    if (bss_members[i] && compareMAC(bss_macs[i], bssid)) return i;
+  }
+  return -1;
+}
+
+static uint8_t bssClaim(const uint8_t* bssid) {
+  int id = bssId(bssid);
+  if (id >= 0) return id;
+  for (int i = 0; i < QUERY_BSS_SETS; i++) {
+    if (!bss_members[i]) {
+      memcpy(bss_macs[i].data(), bssid, 6);
+      return i;
+    }
+  }
+  return QUERY_BSS_OVERFLOW;
+}
+
+static void bssLeave(int slot) {
+  uint8_t id = sta_bss[slot];
+  if (id == QUERY_SLOT_NONE) return;
+  sta_by_bss[id].reset(slot);
+  if (id != QUERY_BSS_OVERFLOW) bss_members[id]--;
+  sta_bss[slot] = QUERY_SLOT_NONE;
+}
+
+static bool containsNoCase(const char* haystack, const char* needle) {
+  if (!haystack) return false;
+  size_t n = strlen(needle);
+  for (; *haystack; haystack++) {
+    if (strncasecmp(haystack, needle, n) == 0) return true;
+  }
+  return n == 0;
+}
+
+static bool parseMAC(const char* text, uint8_t* mac) {
+  unsigned int b[6];
+  if (sscanf(text, "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) return false;
+  for (int i = 0; i < 6; i++) {
+    if (b[i] > 0xFF) return false;
+    mac[i] = b[i];
+  }
+  return true;
+}
+
+// ===== Index Maintenance =====
+void queryIndexClearAPs() {
+  ap_live.clear();
+  for (int i = 0; i < QUERY_CHANNELS; i++) ap_by_channel[i].clear();
+  for (int i = 0; i < QUERY_ENC_SETS; i++) ap_by_enc[i].clear();
+  for (int i = 0; i <= QUERY_VENDOR_SETS; i++) ap_by_vendor[i].clear();
+  memset(ap_vendor_name, 0, sizeof(ap_vendor_name));
+  if (sta_live.next(0) < 0) vendor_count = 0;
+}
+
+void queryIndexClearStations() {
+  sta_live.clear();
+  for (int i = 0; i < QUERY_CHANNELS; i++) sta_by_channel[i].clear();
+  for (int i = 0; i <= QUERY_VENDOR_SETS; i++) sta_by_vendor[i].clear();
+  memset(sta_vendor_name, 0, sizeof(sta_vendor_name));
+  for (int i = 0; i <= QUERY_BSS_SETS; i++) sta_by_bss[i].clear();
+  memset(bss_members, 0, sizeof(bss_members));
+  if (ap_live.next(0) < 0) vendor_count = 0;
+}
+
+// Called after every AP update; only moves bits when a key changed
+void queryIndexAP(int slot, uint8_t channel, uint8_t enc, const char* vendor) {
+  if (slot < 0 || slot >= MAX_APS) return;
+  channel = channelSet(channel);
+  enc = encSet(enc);
+
+  if (!ap_live.test(slot)) {
+    ap_live.set(slot);
+    ap_channel[slot] = QUERY_SLOT_NONE;
+    ap_enc[slot] = QUERY_SLOT_NONE;
+    ap_vendor_name[slot] = nullptr;
+  }
+  if (ap_channel[slot] != channel) {
+    if (ap_channel[slot] != QUERY_SLOT_NONE) ap_by_channel[ap_channel[slot]].reset(slot);
+    ap_by_channel[channel].set(slot);
+    ap_channel[slot] = channel;
+  }
+  if (ap_enc[slot] != enc) {
+    if (ap_enc[slot] != QUERY_SLOT_NONE) ap_by_enc[ap_enc[slot]].reset(slot);
+    ap_by_enc[enc].set(slot);
+    ap_enc[slot] = enc;
+  }
+  if (ap_vendor_name[slot] != vendor) {
+    if (ap_vendor_name[slot]) ap_by_vendor[ap_vendor[slot]].reset(slot);
+    ap_vendor[slot] = vendorId(vendor);
+    ap_by_vendor[ap_vendor[slot]].set(slot);
+    ap_vendor_name[slot] = vendor;
+  }
+}
+
+void queryIndexDropAP(int slot) {
+  if (slot < 0 || slot >= MAX_APS || !ap_live.test(slot)) return;
+  ap_live.reset(slot);
+  if (ap_channel[slot] != QUERY_SLOT_NONE) ap_by_channel[ap_channel[slot]].reset(slot);
+  if (ap_enc[slot] != QUERY_SLOT_NONE) ap_by_enc[ap_enc[slot]].reset(slot);
+  if (ap_vendor_name[slot]) ap_by_vendor[ap_vendor[slot]].reset(slot);
+  ap_vendor_name[slot] = nullptr;
+}
+
+void queryIndexStation(int slot, uint8_t channel, const char* vendor) {
+  if (slot < 0 || slot >= MAX_CLIENTS) return;
+  channel = channelSet(channel);
+
+  if (!sta_live.test(slot)) {
+    sta_live.set(slot);
+    sta_channel[slot] = QUERY_SLOT_NONE;
+    sta_vendor_name[slot] = nullptr;
+    sta_bss[slot] = QUERY_SLOT_NONE;
+  }
+  if (sta_channel[slot] != channel) {
+    if (sta_channel[slot] != QUERY_SLOT_NONE) sta_by_channel[sta_channel[slot]].reset(slot);
+    sta_by_channel[channel].set(slot);
+    sta_channel[slot] = channel;
+  }
+  if (sta_vendor_name[slot] != vendor) {
+    if (sta_vendor_name[slot]) sta_by_vendor[sta_vendor[slot]].reset(slot);
+    sta_vendor[slot] = vendorId(vendor);
+    sta_by_vendor[sta_vendor[slot]].set(slot);
+    sta_vendor_name[slot] = vendor;
+  }
+}
+
+void queryIndexDropStation(int slot) {
+  if (slot < 0 || slot >= MAX_CLIENTS || !sta_live.test(slot)) return;
+  sta_live.reset(slot);
+  if (sta_channel[slot] != QUERY_SLOT_NONE) sta_by_channel[sta_channel[slot]].reset(slot);
+  if (sta_vendor_name[slot]) sta_by_vendor[sta_vendor[slot]].reset(slot);
+  sta_vendor_name[slot] = nullptr;
+  bssLeave(slot);
+}
+
+// Called when a client's current AP changes and when a client moves slots
+void queryIndexStationAP(int slot, const uint8_t* bssid) {
+  if (slot < 0 || slot >= MAX_CLIENTS || !sta_live.test(slot)) return;
+  if (bssid && isZeroMAC(bssid)) bssid = nullptr;
+  uint8_t id = sta_bss[slot];
+  if (bssid && id != QUERY_SLOT_NONE && id != QUERY_BSS_OVERFLOW && compareMAC(bss_macs[id], bssid)) return;
+
+  bssLeave(slot);
+  if (!bssid) return;
+  id = bssClaim(bssid);
+  sta_by_bss[id].set(slot);
+  if (id != QUERY_BSS_OVERFLOW) bss_members[id]++;
+  sta_bss[slot] = id;
+}
+
+// ===== Query Parsing =====
+enum QueryOp : uint8_t { OP_EQ, OP_GE, OP_LE };
+
+typedef struct {
+  char key[8];
+  QueryOp op;
+  char value[33];
+} Predicate;
+
+typedef struct {
+  int16_t slot;
+  int32_t key;
+} QueryRow;
+
+static QueryRow rows[MAX_CLIENTS];
+
+// Splits "key=value", "key>=value" or "key<=value"
+static bool parsePredicate(const char* token, Predicate* out) {
+  const char* op = strpbrk(token, "=<>");
+  if (!op || op == token || (size_t)(op - token) >= sizeof(out->key)) return false;
+
+  memcpy(out->key, token, op - token);
+  out->key[op - token] = '\0';
+
+  if (op[0] == '>' && op[1] == '=') {
+    out->op = OP_GE;
+    op += 2;
+  } else if (op[0] == '<' && op[1] == '=') {
+    out->op = OP_LE;
+    op += 2;
+  } else if (op[0] == '=') {
+    out->op = OP_EQ;
+    op += 1;
+  } else {
+    return false;
+  }
+
+  strncpy(out->value, op, sizeof(out->value) - 1);
+  out->value[sizeof(out->value) - 1] = '\0';
+  return out->value[0] != '\0';
+}
+
+// Keys each table filters on; ordered keys also take >= and <=
+typedef struct {
+  const char* key;
+  bool ordered;
+} QueryKey;
+
+static const QueryKey ap_keys[] = {
+  { "ch", true }, { "enc", false }, { "vendor", false }, { "ssid", false }, { "rssi", true }, { "clients", true }
+};
+static const QueryKey sta_keys[] = { { "ch", true }, { "vendor", false }, { "rssi", true }, { "ap", false } };
+
+static bool validPredicate(const Predicate& p, const QueryKey* keys, int n_keys) {
+  for (int i = 0; i < n_keys; i++) {
+    if (strcmp(p.key, keys[i].key) != 0) continue;
+    if (p.op != OP_EQ && !keys[i].ordered) return false;
+    uint8_t mac[6];
+    return strcmp(p.key, "ap") != 0 || parseMAC(p.value, mac);
+  }
+  return false;
+}
+
+static bool compareInt(int actual, const Predicate& p) {
+  int wanted = atoi(p.value);
+  switch (p.op) {
+    case OP_GE: return actual >= wanted;
+    case OP_LE: return actual <= wanted;
+    default: return actual == wanted;
+  }
+}
+
+static int32_t sortKey(const char* sort, int rssi, unsigned long last_seen, uint8_t channel) {
+  if (strcmp(sort, "seen") == 0) return (int32_t)(last_seen - scan.scan_start_time);
+  if (strcmp(sort, "ch") == 0) return -(int32_t)channel;  // Ascending
+  return rssi;
+}
+
+static void sortRows(int count) {
+  std::sort(rows, rows + count, [](const QueryRow& a, const QueryRow& b) {
+    return a.key > b.key;
+  });
+}
+
+// ===== AP Queries =====
+static bool matchAP(const APView& ap, const Predicate* preds, int n) {
+  for (int i = 0; i < n; i++) {
+    const Predicate& p = preds[i];
+    if (strcmp(p.key, "ch") == 0) {
+      if (!compareInt(ap.channel, p)) return false;
+    } else if (strcmp(p.key, "enc") == 0) {
+      if (!containsNoCase(getCompleteEncryptionType(ap.encryption), p.value)) return false;
+    } else if (strcmp(p.key, "vendor") == 0) {
+      if (!containsNoCase(ap.manufacturer, p.value)) return false;
+    } else if (strcmp(p.key, "ssid") == 0) {
+      if (ap.hidden || !containsNoCase(ap.ssid, p.value)) return false;
+    } else if (strcmp(p.key, "rssi") == 0) {
+      if (!compareInt(ap.rssi, p)) return false;
+    } else if (strcmp(p.key, "clients") == 0) {
+      if (!compareInt(max<int>(ap.associated_count, 0), p)) return false;
+    }
+  }
+  return true;
+}
+
+static void queryAPs(const Predicate* preds, int n, const char* sort, int limit) {
+  // Narrow down with the indexes; everything is re-checked per row below
+  APSet candidates = ap_live;
+  for (int i = 0; i < n; i++) {
+    const Predicate& p = preds[i];
+    if (strcmp(p.key, "ch") == 0 && p.op == OP_EQ) {
+      candidates &= ap_by_channel[channelSet(atoi(p.value))];
+    } else if (strcmp(p.key, "enc") == 0) {
+      APSet any;
+      any.clear();
+      for (int e = 0; e < QUERY_ENC_SETS; e++) {
+        if (containsNoCase(getCompleteEncryptionType((wifi_auth_mode_t)e), p.value)) any |= ap_by_enc[e];
+      }
+      candidates &= any;
+    } else if (strcmp(p.key, "vendor") == 0) {
+      APSet any = ap_by_vendor[QUERY_VENDOR_OVERFLOW];
+      for (int v = 0; v < vendor_count; v++) {
+        if (containsNoCase(vendor_names[v], p.value)) any |= ap_by_vendor[v];
+      }
+      candidates &= any;
+    }
+  }
+
+  int count = 0;
+  int examined = 0;
+  APView ap;
+  for (int slot = candidates.next(0); slot >= 0 && slot < ap_count; slot = candidates.next(slot + 1)) {
+    examined++;
+    if (!readAPView(aps[slot], &ap)) continue;
+    if (!matchAP(ap, preds, n)) continue;
+    rows[count].slot = slot;
+    rows[count].key = sortKey(sort, ap.rssi, ap.last_seen, ap.channel);
+    count++;
+  }
+  sortRows(count);
+
+  Serial.println("\nNr | SSID                             | RSSI | Ch | Clients | Encryption           | Vendor               | BSSID");
+  Serial.println("--------------------------------------------------------------------------------------------------------------------------");
+  int shown = 0;
+  char mac[18];
+  for (int i = 0; i < count && shown < limit; i++) {
+    if (!readAPView(aps[rows[i].slot], &ap)) continue;
+    formatMAC(ap.bssid.data(), mac);
+    char clients[8];
+    if (ap.associated_count < 0) strcpy(clients, "-");
+    else snprintf(clients, sizeof(clients), "%d", ap.associated_count);
+    Serial.printf("%-2d | %-32s | %4d | %2u | %7s | %-20s | %-20.20s | %s\n",
+                  shown + 1, ap.hidden ? "[Hidden]" : ap.ssid, ap.rssi, ap.channel, clients,
+                  getCompleteEncryptionType(ap.encryption), ap.manufacturer ? ap.manufacturer : "Unknown", mac);
+    shown++;
+  }
+  Serial.printf("Matched %d of %d APs (%d read via indexes) | shown %d\n",
+                count, getAPCount(), examined, shown);
+}
+
+// ===== Station Queries =====
+static bool matchStation(const ClientView& sta, const Predicate* preds, int n) {
+  for (int i = 0; i < n; i++) {
+    const Predicate& p = preds[i];
+    if (strcmp(p.key, "ch") == 0) {
+      if (!compareInt(sta.channel, p)) return false;
+    } else if (strcmp(p.key, "vendor") == 0) {
+      if (!containsNoCase(sta.manufacturer, p.value)) return false;
+    } else if (strcmp(p.key, "rssi") == 0) {
+      if (!compareInt(sta.rssi, p)) return false;
+    } else if (strcmp(p.key, "ap") == 0) {
+      // Published copy of the association graph, read with the view
+      uint8_t bssid[6];
+      parseMAC(p.value, bssid);
+      if (!compareMAC(sta.ap_bssid, bssid)) return false;
+    }
+  }
+  return true;
+}
+
+static void queryStations(const Predicate* preds, int n, const char* sort, int limit) {
+  StationSet candidates = sta_live;
+  for (int i = 0; i < n; i++) {
+    const Predicate& p = preds[i];
+    if (strcmp(p.key, "ch") == 0 && p.op == OP_EQ) {
+      candidates &= sta_by_channel[channelSet(atoi(p.value))];
+    } else if (strcmp(p.key, "vendor") == 0) {
+      StationSet any = sta_by_vendor[QUERY_VENDOR_OVERFLOW];
+      for (int v = 0; v < vendor_count; v++) {
+        if (containsNoCase(vendor_names[v], p.value)) any |= sta_by_vendor[v];
+      }
+      candidates &= any;
+    } else if (strcmp(p.key, "ap") == 0) {
+      // An AP with no set of its own may still have stations in the overflow
+      uint8_t bssid[6];
+      parseMAC(p.value, bssid);
+      int id = bssId(bssid);
+      candidates &= sta_by_bss[id >= 0 ? id : QUERY_BSS_OVERFLOW];
+    }
+  }
+
+  int count = 0;
+  int examined = 0;
+  int n_clients = min((int)client_list.size(), MAX_CLIENTS);
+  ClientView sta;
+  for (int slot = candidates.next(0); slot >= 0 && slot < n_clients; slot = candidates.next(slot + 1)) {
+    examined++;
+    if (!readClientView(client_list[slot], &sta)) continue;
+    if (!matchStation(sta, preds, n)) continue;
+    rows[count].slot = slot;
+    rows[count].key = sortKey(sort, sta.rssi, sta.last_seen, sta.channel);
+    count++;
+  }
+  sortRows(count);
+
+  Serial.println("\nNr | Client MAC        | RSSI | Ch | AP BSSID          | Vendor               | Last Seen");
+  Serial.println("-------------------------------------------------------------------------------------------");
+  int shown = 0;
+  char mac[18];
+  char ap[18];
+  unsigned long now = millis();
+  for (int i = 0; i < count && shown < limit; i++) {
+    if (!readClientView(client_list[rows[i].slot], &sta)) continue;
+    formatMAC(sta.mac.data(), mac);
+    if (isZeroMAC(sta.ap_bssid.data())) strcpy(ap, "-");
+    else formatMAC(sta.ap_bssid.data(), ap);
+    Serial.printf("%-2d | %s | %4d | %2u | %-17s | %-20.20s | %lu s\n",
+                  shown + 1, mac, sta.rssi, sta.channel, ap,
+                  sta.manufacturer ? sta.manufacturer : "Unknown", (now - sta.last_seen) / 1000);
+    shown++;
+  }
+  Serial.printf("Matched %d of %d clients (%d read via indexes) | shown %d\n",
+                count, getClientCount(), examined, shown);
+}
+
+// ===== Query Command =====
+void runScanQuery(const String& args) {
+  char buf[160];
+  strncpy(buf, args.c_str(), sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+
+  char* save;
+  char* table = strtok_r(buf, " ", &save);
+  bool ap_table = table && strcmp(table, "ap") == 0;
+  bool sta_table = table && strcmp(table, "sta") == 0;
+  if (!ap_table && !sta_table) {
+    Serial.println(F("Usage: scan query <ap || sta> [ch=N] [enc=wpa3] [vendor=name] [ssid=text] [ap=<bssid>]"));
+    Serial.println(F("                  [rssi>=N] [rssi<=N] [clients>=N] [sort=rssi || seen || ch] [limit=N]"));
+    return;
+  }
+
+  Predicate preds[QUERY_MAX_PREDICATES];
+  int n = 0;
+  char sort[8] = "rssi";
+  int limit = QUERY_DEFAULT_LIMIT;
+
+  for (char* token = strtok_r(nullptr, " ", &save); token; token = strtok_r(nullptr, " ", &save)) {
+    Predicate p;
+    if (!parsePredicate(token, &p)) {
+      Serial.printf("Bad predicate: %s\n", token);
+      return;
+    }
+    if (strcmp(p.key, "sort") == 0 && p.op == OP_EQ &&
+        (strcmp(p.value, "rssi") == 0 || strcmp(p.value, "seen") == 0 || strcmp(p.value, "ch") == 0)) {
+      strcpy(sort, p.value);
+    } else if (strcmp(p.key, "limit") == 0 && p.op == OP_EQ && atoi(p.value) > 0) {
+      limit = atoi(p.value);
+    } else if (!(ap_table ? validPredicate(p, ap_keys, sizeof(ap_keys) / sizeof(ap_keys[0]))
+                          : validPredicate(p, sta_keys, sizeof(sta_keys) / sizeof(sta_keys[0])))) {
+      Serial.printf("Bad predicate: %s\n", token);
+      return;
+    } else if (n < QUERY_MAX_PREDICATES) {
+      preds[n++] = p;
+    } else {
+      Serial.printf("Too many predicates (max %d)\n", QUERY_MAX_PREDICATES);
+      return;
+    }
+  }
+
+  if (ap_table) queryAPs(preds, n, sort, limit);
+  else queryStations(preds, n, sort, limit);
+}
@@ -0,0 +1,79 @@
+#ifndef SCAN_QUERY_H
+#define SCAN_QUERY_H
+
+#include "scan.h"
+
+// ===== Configuration Constants =====
+#define QUERY_CHANNELS 15        // Channel sets: 0 (unknown) and 1-14
+#define QUERY_ENC_SETS 16        // One set per wifi_auth_mode_t value
+#define QUERY_VENDOR_SETS 64     // Distinct vendors indexed; the rest share an overflow set
+#define QUERY_BSS_SETS 64        // Distinct current APs indexed; the rest share an overflow set
+#define QUERY_MAX_PREDICATES 8
+#define QUERY_DEFAULT_LIMIT 50
+
+// ===== Slot Sets =====
+// One bit per table slot. Index lookups AND/OR these together, so a query
+// only reads the records that can match.
+template <int N>
+struct SlotSet {
+  static constexpr int WORDS = (N + 31) / 32;
+  uint32_t words[WORDS];
+
+  void clear() {
+    memset(words, 0, sizeof(words));
+  }
+  void set(int i) {
+    words[i >> 5] |= 1u << (i & 31);
+  }
+  void reset(int i) {
+    words[i >> 5] &= ~(1u << (i & 31));
+  }
+  bool test(int i) const {
+    return words[i >> 5] & (1u << (i & 31));
+  }
+  void operator&=(const SlotSet& other) {
+    for (int w = 0; w < WORDS; w++) words[w] &= other.words[w];
+  }
+  void operator|=(const SlotSet& other) {
+    for (int w = 0; w < WORDS; w++) words[w] |= other.words[w];
+  }
+
+  // Next set slot at or after `from`, -1 if none
+  int next(int from) const {
+    for (int w = from >> 5; w < WORDS; w++) {
+      uint32_t bits = words[w];
+      if (w == (from >> 5)) bits &= ~0u << (from & 31);
+      if (bits) return (w << 5) + __builtin_ctz(bits);
+    }
+    return -1;
+  }
+};
+
+typedef SlotSet<MAX_APS> APSet;
+typedef SlotSet<MAX_CLIENTS> StationSet;
+
+// ===== Secondary Indexes =====
+// AP slots by channel, encryption and vendor; station slots by channel,
+// vendor and current AP. The current AP set is keyed on the BSSID rather than
+// an AP slot, since a station scan keeps no AP records; it follows the
+// client's published current_ap, which scanAssocChanged() updates. Written
+// by the RX callback after each record update; queries treat the sets as
+// candidates and re-check every row against a consistent view.
+void queryIndexClearAPs();
+void queryIndexClearStations();
+
+void queryIndexAP(int slot, uint8_t channel, uint8_t enc, const char* vendor);
+void queryIndexDropAP(int slot);
+
+void queryIndexStation(int slot, uint8_t channel, const char* vendor);
+void queryIndexStationAP(int slot, const uint8_t* bssid);  // nullptr or zero BSSID: none
+void queryIndexDropStation(int slot);
+
+// ===== Query Command =====
+// scan query <ap || sta> [key=value ...] [sort=rssi||seen||ch] [limit=n]
+//   ap:  ch, rssi, clients (=, >=, <=); enc= (name part, e.g. wpa3), vendor=, ssid=
+//   sta: ch, rssi (=, >=, <=); vendor=, ap=<bssid>
+// Any other key or operator is rejected as a bad predicate.
+void runScanQuery(const String& args);
+
+#endif  // SCAN_QUERY_H
@@ -0,0 +1,527 @@
+#include "scan_store.h"
+#include <SD.h>
+#include "scan.h"
+#include "scan_query.h"
+#include "scan_store_codec.h"
+#include "ssid_table.h"
+#include "timer_wheel.h"
+
+uint32_t scan_store_changes = 0;
+
+// ===== Record Encoding =====
+// AP flags
+#define STORE_AP_SSID_KNOWN 0x01
+#define STORE_AP_HIDDEN 0x02
+#define STORE_AP_WPS 0x04
+#define STORE_AP_MESH 0x08
+#define STORE_AP_11N 0x10
+#define STORE_AP_11AC 0x20
+#define STORE_AP_REVEALED 0x40
+
+// Station flags
+#define STORE_STA_PROBING 0x01
+#define STORE_STA_HANDSHAKING 0x02
+
+// Smoothed value, min and max; all zero when nothing was sampled
+static inline void putRssi(RecordOut& r, const RssiStats& s) {
+  put8(r, s.samples ? rssiStatsValue(s) : 0);
+  put8(r, s.samples ? s.min : 0);
+  put8(r, s.samples ? s.max : 0);
+}
+
+static inline void getRssi(RecordIn& r, RssiStats& s, int* rssi) {
+  int8_t value = get8(r);
+  int8_t lo = get8(r);
+  int8_t hi = get8(r);
+  rssiStatsReset(s);
+  if (value == 0 && lo == 0 && hi == 0) return;
+  rssiStatsAdd(s, rssiNormalize(value), scan.rssi_ewma_shift);
+  s.min = lo;
+  s.max = hi;
+  *rssi = value;
+}
+
+// ===== Record Types =====
+static void encodeAP(RecordOut& r, const APInfo& ap) {
+  beginRecord(r, STORE_TAG_AP);
+  putBytes(r, ap.bssid.data(), 6);
+  put8(r, (ap.ssid_known ? STORE_AP_SSID_KNOWN : 0) | (ap.hidden ? STORE_AP_HIDDEN : 0) |
+            (ap.wps_enabled ? STORE_AP_WPS : 0) | (ap.is_mesh ? STORE_AP_MESH : 0) |
+            (ap.is_80211n ? STORE_AP_11N : 0) | (ap.is_80211ac ? STORE_AP_11AC : 0) |
+            (ap.ssid_revealed ? STORE_AP_REVEALED : 0));
+  put8(r, ap.channel);
+  put8(r, ap.primary_channel);
+  put8(r, ap.secondary_channel);
+  put8(r, ap.encryption);
+  put8(r, ap.wps_version);
+  putRssi(r, ap.rssi_stats);
+  put8(r, ap.beacon_interval);
+  put16(r, ap.capability_info);
+  put16(r, ap.data_rate);
+  put16(r, ap.client_count);
+  putBytes(r, ap.country_code, 3);
+  put32(r, ap.packet_count);
+  put8(r, ap.original_ssid_len);
+  putString(r, ap.ssid, ap.ssid_len);
+  endRecord(r);
+}
+
+static bool restoreAP(RecordIn& r, unsigned long now) {
+  uint8_t bssid[6];
+  getBytes(r, bssid, 6);
+  APInfo* ap = findOrCreateAP(bssid);
+  if (!ap) return false;
+
+  seqWriteBegin(ap->seq);
+  uint8_t flags = get8(r);
+  ap->ssid_known = flags & STORE_AP_SSID_KNOWN;
+  ap->hidden = flags & STORE_AP_HIDDEN;
+  ap->wps_enabled = flags & STORE_AP_WPS;
+  ap->is_mesh = flags & STORE_AP_MESH;
+  ap->is_80211n = flags & STORE_AP_11N;
+  ap->is_80211ac = flags & STORE_AP_11AC;
+  ap->ssid_revealed = flags & STORE_AP_REVEALED;
+  ap->channel = get8(r);
+  ap->primary_channel = get8(r);
+  ap->secondary_channel = get8(r);
+  ap->encryption = (wifi_auth_mode_t)get8(r);
+  ap->wps_version = get8(r);
+  getRssi(r, ap->rssi_stats, &ap->rssi);
+  ap->beacon_interval = get8(r);
+  ap->capability_info = get16(r);
+  ap->data_rate = get16(r);
+  ap->client_count = (int16_t)get16(r);
+  getBytes(r, ap->country_code, 3);
+  ap->packet_count = get32(r);
+  ap->original_ssid_len = get8(r);
+  ap->ssid_len = getString(r, ap->ssid);
+  memcpy(ap->vendor_oui, bssid, 3);
+  ap->first_seen = now;
+  ap->last_seen = now;
+  ap->seeded = true;  // Filled in without a frame sniffed this session
+  seqWriteEnd(ap->seq);
+
+  rankAP(ap);
+  queryIndexAP(ap - aps, ap->channel, ap->encryption, ap->manufacturer);
+  return true;
+}
+
+static void encodeStation(RecordOut& r, const ClientInfo& c) {
+  beginRecord(r, STORE_TAG_STATION);
+  putBytes(r, c.mac.data(), 6);
+  put8(r, (c.probing_active ? STORE_STA_PROBING : 0) | (c.is_handshaking ? STORE_STA_HANDSHAKING : 0));
+  put8(r, c.channel);
+  putRssi(r, c.rssi_stats);
+  put16(r, min(c.probe_count, 0xFFFF));
+  put32(r, c.packet_count);
+  put16(r, c.data_rate);
+  putBytes(r, c.targeted_ap.data(), 6);
+  uint8_t probed = min<uint8_t>(c.probed_ap_count, MAX_PROBED_APS);
+  put8(r, probed);
+  for (int i = 0; i < probed; i++) putBytes(r, c.probed_aps[i].data(), 6);
+  putString(r, c.last_probed_ssid, c.last_ssid_len);
+  endRecord(r);
+}
+
+static bool restoreStation(RecordIn& r, unsigned long now) {
+  uint8_t mac[6];
+  getBytes(r, mac, 6);
+  ClientInfo* c = restoreClient(mac);
+  if (!c) return false;
+
+  seqWriteBegin(c->seq);
+  uint8_t flags = get8(r);
+  c->probing_active = flags & STORE_STA_PROBING;
+  c->is_handshaking = flags & STORE_STA_HANDSHAKING;
+  c->channel = get8(r);
+  getRssi(r, c->rssi_stats, &c->rssi);
+  c->probe_count = get16(r);
+  c->packet_count = get32(r);
+  c->data_rate = get16(r);
+  getBytes(r, c->targeted_ap.data(), 6);
+  c->probed_ap_count = min<uint8_t>(get8(r), MAX_PROBED_APS);
+  for (int i = 0; i < c->probed_ap_count; i++) getBytes(r, c->probed_aps[i].data(), 6);
+  c->last_ssid_len = getString(r, c->last_probed_ssid);
+  c->first_seen = now;
+  c->last_seen = now;
+  seqWriteEnd(c->seq);
+
+  rankClient(c);
+  queryIndexStation(c - client_list.data(), c->channel, c->manufacturer);
+  return true;
+}
+
+static void encodeSSID(RecordOut& r, ssid_id_t id) {
+  const SSIDTable& t = ssid_table;
+  beginRecord(r, STORE_TAG_SSID);
+  put8(r, t.flags[id]);
+  put8(r, t.channel[id]);
+  put8(r, t.rssi[id]);
+  put16(r, t.probe_count[id]);
+  putBytes(r, t.bssid[id], 6);
+  put64(r, 0);  // Was a hashed client bitmap; prober IDs do not outlive a boot
+  putString(r, t.ssid[id], t.ssid_len[id]);
+  endRecord(r);
+}
+
+static bool restoreSSID(RecordIn& r, unsigned long now) {
+  uint8_t flags = get8(r);
+  uint8_t channel = get8(r);
+  int8_t rssi = get8(r);
+  uint16_t probes = get16(r);
+  uint8_t bssid[6];
+  getBytes(r, bssid, 6);
+  get64(r);
+  char ssid[33];
+  uint8_t len = getString(r, ssid);
+
+  SSIDTable& t = ssid_table;
+  ssid_id_t id = ssidIntern(ssid, len, now);
+  t.flags[id] |= flags;
+  t.channel[id] = channel;
+  t.rssi[id] = rssi;
+  t.probe_count[id] = probes;
+  memcpy(t.bssid[id], bssid, 6);
+  return true;
+}
+
+// ===== Save State =====
+enum {
+  SAVE_IDLE,
+  SAVE_APS,
+  SAVE_STATIONS,
+  SAVE_SSIDS,
+  SAVE_FINISH,
+};
+
+typedef struct {
+  uint8_t phase;
+  File file;
+  int cursor;
+  uint32_t crc;
+  uint8_t block[SCAN_STORE_BLOCK];
+  size_t block_len;
+  uint32_t bytes;
+  uint16_t counts[3];  // APs, stations, SSIDs
+  uint32_t changes;    // scan_store_changes when the save began
+  unsigned long started_ms;
+  bool failed;
+} SaveState;
+
+typedef struct {
+  unsigned long last_save_ms;
+  uint32_t changes_saved;
+  uint32_t saves;
+  uint32_t failures;
+  uint32_t save_bytes;
+  uint32_t save_ms;
+  uint16_t save_counts[3];
+  uint32_t load_us;
+  uint32_t load_bytes;
+  uint16_t load_counts[3];
+  const char* load_error;
+} StoreStats;
+
+static SaveState save = {};
+static StoreStats stats = {};
+static unsigned long autosave_ms = SCAN_STORE_AUTOSAVE_MS;
+
+static bool sdReady() {
+  return SD.cardType() != CARD_NONE;
+}
+
+// ===== Writer =====
+// Bytes are staged into one SD sector and the CRC runs over them as they go
+static void flushBlock() {
+  if (save.block_len == 0) return;
+  if (save.file.write(save.block, save.block_len) != save.block_len) save.failed = true;
+  save.block_len = 0;
+}
+
+static void emit(const uint8_t* p, size_t n, bool checksummed = true) {
+  if (checksummed) save.crc = crc32Le(save.crc, p, n);
+  save.bytes += n;
+  while (n > 0) {
+    size_t take = min(n, sizeof(save.block) - save.block_len);
+    memcpy(save.block + save.block_len, p, take);
+    save.block_len += take;
+    p += take;
+    n -= take;
+    if (save.block_len == sizeof(save.block)) flushBlock();
+  }
+}
+
+static void emitRecord(const RecordOut& r, int kind) {
+  emit(r.b, r.n);
+  save.counts[kind]++;
+}
+
+// Records are copied under their seqlock, so a batch never blocks the RX
+// callback. Slots can move between batches (client removal fills holes); a
+// record seen twice merges on load and one missed is caught next save.
+static bool copyAP(int slot, APInfo* out) {
+  const APInfo& ap = aps[slot];
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(ap.seq);
+    memcpy(out, &ap, sizeof(APInfo));
+    if (!seqReadRetry(ap.seq, start)) return true;
+  }
+  return false;
+}
+
+static bool copyStation(int slot, ClientInfo* out) {
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t table = seqReadBegin(client_table_seq);
+    if (slot >= (int)client_list.size()) return false;
+    const ClientInfo& c = client_list[slot];
+    uint32_t start = seqReadBegin(c.seq);
+    memcpy(out, &c, sizeof(ClientInfo));
+    if (!seqReadRetry(c.seq, start) && !seqReadRetry(client_table_seq, table)) return true;
+  }
+  return false;
+}
+
+static void finishSave() {
+  RecordOut r;
+  beginRecord(r, STORE_TAG_END);
+  for (int i = 0; i < 3; i++) put16(r, save.counts[i]);
+  endRecord(r);
+  r.b[1] += 4;  // The CRC is part of the end record but not of its own input
+  emit(r.b, r.n);
+  uint8_t crc[4] = { (uint8_t)save.crc, (uint8_t)(save.crc >> 8), (uint8_t)(save.crc >> 16), (uint8_t)(save.crc >> 24) };
+  emit(crc, sizeof(crc), false);
+  flushBlock();
+  save.file.close();
+
+  // Replace the old snapshot only once the new one is complete
+  if (!save.failed) {
+    SD.remove(SCAN_STORE_PATH);
+    save.failed = !SD.rename(SCAN_STORE_TMP_PATH, SCAN_STORE_PATH);
+  }
+  if (save.failed) {
+    SD.remove(SCAN_STORE_TMP_PATH);
+    stats.failures++;
+  } else {
+    stats.saves++;
+    stats.changes_saved = save.changes;
+    stats.save_bytes = save.bytes;
+    stats.save_ms = millis() - save.started_ms;
+    memcpy(stats.save_counts, save.counts, sizeof(save.counts));
+  }
+  save.phase = SAVE_IDLE;
+}
+
+static void saveStep(int budget) {
+  APInfo ap;
+  ClientInfo client;
+  RecordOut r;
+
+  while (budget > 0 && save.phase != SAVE_IDLE) {
+    if (save.failed) {
+      save.file.close();
+      SD.remove(SCAN_STORE_TMP_PATH);
+      stats.failures++;
+      save.phase = SAVE_IDLE;
+      return;
+    }
+
+    switch (save.phase) {
+      case SAVE_APS:
+        if (save.cursor >= ap_count) {
+          save.phase = SAVE_STATIONS;
+          save.cursor = 0;
+          break;
+        }
+        // Only records the scan still shows: filled in and not expired
+        if (timerArmed(TIMER_AP, save.cursor) && copyAP(save.cursor, &ap) && (ap.packet_count > 0 || ap.seeded)) {
+          encodeAP(r, ap);
+          emitRecord(r, 0);
+          budget--;
+        }
+        save.cursor++;
+        break;
+
+      case SAVE_STATIONS:
+        if (save.cursor >= (int)client_list.size()) {
+          save.phase = SAVE_SSIDS;
+          save.cursor = 0;
+          break;
+        }
+        if (copyStation(save.cursor, &client)) {
+          encodeStation(r, client);
+          emitRecord(r, 1);
+          budget--;
+        }
+        save.cursor++;
+        break;
+
+      case SAVE_SSIDS:
+        if (save.cursor >= SSID_TABLE_CAPACITY) {
+          save.phase = SAVE_FINISH;
+          break;
+        }
+        if (ssid_table.ssid_len[save.cursor] != SSID_LEN_FREE) {
+          encodeSSID(r, save.cursor);
+          emitRecord(r, 2);
+          budget--;
+        }
+        save.cursor++;
+        break;
+
+      case SAVE_FINISH:
+        finishSave();
+        return;
+    }
+  }
+}
+
+bool scanStoreBeginSave() {
+  if (save.phase != SAVE_IDLE) return true;
+  stats.last_save_ms = millis();
+  if (!sdReady()) return false;
+  if (!SD.exists(SCAN_STORE_DIR) && !SD.mkdir(SCAN_STORE_DIR)) return false;
+
+  save.file = SD.open(SCAN_STORE_TMP_PATH, FILE_WRITE);
+  if (!save.file) {
+    stats.failures++;
+    return false;
+  }
+  save.cursor = 0;
+  save.crc = 0;
+  save.block_len = 0;
+  save.bytes = 0;
+  memset(save.counts, 0, sizeof(save.counts));
+  save.changes = __atomic_load_n(&scan_store_changes, __ATOMIC_RELAXED);
+  save.started_ms = stats.last_save_ms;
+  save.failed = false;
+
+  uint8_t header[STORE_HEADER_LEN] = {
+    (uint8_t)SCAN_STORE_MAGIC, (uint8_t)(SCAN_STORE_MAGIC >> 8), (uint8_t)(SCAN_STORE_MAGIC >> 16),
+    (uint8_t)(SCAN_STORE_MAGIC >> 24), (uint8_t)SCAN_STORE_VERSION, (uint8_t)(SCAN_STORE_VERSION >> 8), 0, 0
+  };
+  emit(header, sizeof(header));
+  save.phase = SAVE_APS;
+  return true;
+}
+
+bool scanStoreSaveNow() {
+  if (!scanStoreBeginSave()) return false;
+  uint32_t failures = stats.failures;
+  while (save.phase != SAVE_IDLE) saveStep(SCAN_STORE_BATCH);
+  return stats.failures == failures;
+}
+
+void scanStoreLoop(unsigned long now) {
+  if (save.phase != SAVE_IDLE) {
+    saveStep(SCAN_STORE_BATCH);
+    return;
+  }
+  if (autosave_ms == 0 || now - stats.last_save_ms < autosave_ms) return;
+  if (__atomic_load_n(&scan_store_changes, __ATOMIC_RELAXED) == stats.changes_saved) return;
+  scanStoreBeginSave();
+}
+
+void scanStoreSetAutosave(unsigned long interval_ms) {
+  autosave_ms = interval_ms;
+}
+
+// ===== Reader =====
+bool scanStoreLoad() {
+  stats.load_error = nullptr;
+  if (!sdReady()) {
+    stats.load_error = "no SD card";
+    return false;
+  }
+  File f = SD.open(SCAN_STORE_PATH, FILE_READ);
+  if (!f) {
+    stats.load_error = "no snapshot";
+    return false;
+  }
+
+  uint32_t start = micros();
+  size_t size = f.size();
+  uint8_t* buf = size <= SCAN_STORE_MAX_BYTES ? (uint8_t*)malloc(size) : nullptr;
+  bool ok = buf && f.read(buf, size) == size;
+  f.close();
+  if (!ok) {
+    stats.load_error = buf ? "read failed" : "too large";
+    free(buf);
+    return false;
+  }
+  stats.load_error = snapshotError(buf, size);
+  if (stats.load_error || !scanStorageReady()) {
+    if (!stats.load_error) stats.load_error = "no scan storage";
+    free(buf);
+    return false;
+  }
+
+  unsigned long now = millis();
+  uint16_t counts[3] = { 0, 0, 0 };
+  size_t o = STORE_HEADER_LEN;
+  uint8_t tag;
+  RecordIn r;
+  while (snapshotNextRecord(buf, size, &o, &tag, &r)) {
+    switch (tag) {
+      case STORE_TAG_AP: counts[0] += restoreAP(r, now); break;
+      case STORE_TAG_STATION: counts[1] += restoreStation(r, now); break;
+      case STORE_TAG_SSID: counts[2] += restoreSSID(r, now); break;
+      default: break;  // Written by a newer version
+    }
+  }
+  free(buf);
+
+  stats.load_us = micros() - start;
+  stats.load_bytes = size;
+  memcpy(stats.load_counts, counts, sizeof(counts));
+
+  // The next scan of each kind starts from these instead of clearing them
+  scan.warm_aps = counts[0] > 0 || counts[2] > 0;
+  scan.warm_clients = counts[1] > 0;
+  return true;
+}
+
+bool scanStoreWarmStart() {
+  if (!scanStoreLoad()) {
+    if (strcmp(stats.load_error, "no snapshot") != 0 && strcmp(stats.load_error, "no SD card") != 0) {
+      Serial.printf("Warm start: snapshot ignored (%s)\n", stats.load_error);
+    }
+    return false;
+  }
+  Serial.printf("Warm start: %u APs, %u stations, %u SSIDs from %lu bytes in %lu us\n",
+                stats.load_counts[0], stats.load_counts[1], stats.load_counts[2],
+                (unsigned long)stats.load_bytes, (unsigned long)stats.load_us);
+  return true;
+}
+
+// ===== Report =====
+void scanStoreReport() {
+  unsigned long now = millis();
+  bool pending = __atomic_load_n(&scan_store_changes, __ATOMIC_RELAXED) != stats.changes_saved;
+
+  Serial.println("\n=== SCAN SNAPSHOT ===");
+  Serial.printf("File: %s | Format v%d | SD: %s\n", SCAN_STORE_PATH, SCAN_STORE_VERSION,
+                sdReady() ? "ready" : "missing");
+  if (autosave_ms) {
+    Serial.printf("Autosave: every %lu s | Unsaved changes: %s%s\n", autosave_ms / 1000, pending ? "yes" : "no",
+                  save.phase != SAVE_IDLE ? " | Save in progress" : "");
+  } else {
+    Serial.printf("Autosave: off | Unsaved changes: %s\n", pending ? "yes" : "no");
+  }
+
+  if (stats.saves) {
+    Serial.printf("Last save: %u APs, %u stations, %u SSIDs | %lu bytes | %lu ms | %lu s ago\n",
+                  stats.save_counts[0], stats.save_counts[1], stats.save_counts[2],
+                  (unsigned long)stats.save_bytes, (unsigned long)stats.save_ms,
+                  (now - stats.last_save_ms) / 1000);
+  }
+  Serial.printf("Saves: %lu | Failures: %lu\n", (unsigned long)stats.saves, (unsigned long)stats.failures);
+
+  if (stats.load_error) {
+    Serial.printf("Last load: failed (%s)\n", stats.load_error);
+  } else if (stats.load_bytes) {
+    uint32_t records = stats.load_counts[0] + stats.load_counts[1] + stats.load_counts[2];
+    Serial.printf("Last load: %lu records from %lu bytes in %lu us (%.1f us/record)\n", (unsigned long)records,
+                  (unsigned long)stats.load_bytes, (unsigned long)stats.load_us,
+                  records ? (float)stats.load_us / records : 0.0f);
+  }
+}
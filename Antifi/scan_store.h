@@ -0,0 +1,71 @@
+#ifndef SCAN_STORE_H
+#define SCAN_STORE_H
+
+// Also builds on the host (snapshot load benchmark), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#endif
+
+// ===== Configuration Constants =====
+#define SCAN_STORE_DIR "/scan"
+#define SCAN_STORE_PATH "/scan/snapshot.bin"
+#define SCAN_STORE_TMP_PATH "/scan/snapshot.tmp"
+#define SCAN_STORE_MAGIC 0x4E534641u  // "AFSN"
+#define SCAN_STORE_VERSION 1
+#define SCAN_STORE_AUTOSAVE_MS 60000  // Default; only when something changed
+#define SCAN_STORE_BATCH 16           // Records encoded per loop pass
+#define SCAN_STORE_BLOCK 512          // Bytes staged per SD write (one sector)
+#define SCAN_STORE_MAX_BYTES 65536    // Larger files are rejected before reading
+
+// ===== Snapshot Format =====
+// Little-endian, no structs or pointers on disk:
+//
+//   header   magic u32 | version u16 | flags u16
+//   record   tag u8 | len u8 | len bytes of fields
+//   ...
+//   end      tag 0xFF | len 10 | APs u16 | stations u16 | SSIDs u16 | CRC-32 u32
+//
+// The CRC covers every byte before it. Fields are only ever appended to a
+// record type: readers zero-fill fields a shorter (older) record lacks, skip
+// the tail of a longer (newer) one and skip unknown tags, so a version bump is
+// only needed for incompatible changes. Uptime timestamps mean nothing after
+// a reboot, so none are stored; restored records are stamped at load.
+enum {
+  STORE_TAG_AP = 1,
+  STORE_TAG_STATION = 2,
+  STORE_TAG_SSID = 3,
+  STORE_TAG_END = 0xFF,
+};
+
+// ===== Change Tracking =====
+// Bumped by the record update hooks (RX callback); autosave only runs when
+// this moved since the last snapshot.
+extern uint32_t scan_store_changes;
+
+static inline void scanStoreTouch() {
+  __atomic_fetch_add(&scan_store_changes, 1, __ATOMIC_RELAXED);
+}
+
+// ===== Public API =====
+// Boot: loads the snapshot straight into the scan tables and marks them warm,
+// so the next scan of each kind starts from them. Prints the load time.
+bool scanStoreWarmStart();
+
+// Loads the snapshot now (tables must be idle); false if missing or corrupt
+bool scanStoreLoad();
+
+// Starts a background save; scanStoreLoop() writes it a batch at a time
+bool scanStoreBeginSave();
+
+// Saves in one go (CLI)
+bool scanStoreSaveNow();
+
+// Advances a save in progress, or starts an autosave when one is due
+void scanStoreLoop(unsigned long now);
+
+void scanStoreSetAutosave(unsigned long interval_ms);  // 0 = off
+void scanStoreReport();
+
+#endif  // SCAN_STORE_H
@@ -0,0 +1,131 @@
+#ifndef SCAN_STORE_CODEC_H
+#define SCAN_STORE_CODEC_H
+
+// Also builds on the host (snapshot load benchmark), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+#include "crc32.h"
+#include "scan_store.h"
+
+// ===== Snapshot Codec =====
+// Field encoding, framing and CRC (crc32.h) of the format described in
+// scan_store.h. The record layouts themselves live with the tables in
+// scan_store.cpp.
+#define STORE_HEADER_LEN 8
+#define STORE_END_LEN 12  // tag + len + 3 counts + CRC
+#define STORE_RECORD_MAX 255
+
+typedef struct {
+  uint8_t b[STORE_RECORD_MAX + 2];
+  size_t n;
+} RecordOut;
+
+static inline void put8(RecordOut& r, uint8_t v) {
+  if (r.n < sizeof(r.b)) r.b[r.n++] = v;
+}
+static inline void put16(RecordOut& r, uint16_t v) {
+  put8(r, v);
+  put8(r, v >> 8);
+}
+static inline void put32(RecordOut& r, uint32_t v) {
+  put16(r, v);
+  put16(r, v >> 16);
+}
+static inline void put64(RecordOut& r, uint64_t v) {
+  put32(r, (uint32_t)v);
+  put32(r, (uint32_t)(v >> 32));
+}
+static inline void putBytes(RecordOut& r, const void* p, size_t len) {
+  for (size_t i = 0; i < len; i++) put8(r, ((const uint8_t*)p)[i]);
+}
+static inline void putString(RecordOut& r, const char* s, uint8_t len) {
+  if (len > 32) len = 32;
+  put8(r, len);
+  putBytes(r, s, len);
+}
+
+static inline void beginRecord(RecordOut& r, uint8_t tag) {
+  r.n = 0;
+  put8(r, tag);
+  put8(r, 0);
+}
+static inline void endRecord(RecordOut& r) {
+  r.b[1] = r.n - 2;
+}
+
+// Reads past the end of a record return zeros (fields a shorter record lacks)
+typedef struct {
+  const uint8_t* p;
+  size_t len;
+  size_t o;
+} RecordIn;
+
+static inline uint8_t get8(RecordIn& r) {
+  uint8_t v = r.o < r.len ? r.p[r.o] : 0;
+  r.o++;
+  return v;
+}
+static inline uint16_t get16(RecordIn& r) {
+  uint16_t lo = get8(r);
+  return lo | (get8(r) << 8);
+}
+static inline uint32_t get32(RecordIn& r) {
+  uint32_t lo = get16(r);
+  return lo | ((uint32_t)get16(r) << 16);
+}
+static inline uint64_t get64(RecordIn& r) {
+  uint64_t lo = get32(r);
+  return lo | ((uint64_t)get32(r) << 32);
+}
+static inline void getBytes(RecordIn& r, void* out, size_t len) {
+  for (size_t i = 0; i < len; i++) ((uint8_t*)out)[i] = get8(r);
+}
+// out holds 33 bytes
+static inline uint8_t getString(RecordIn& r, char* out) {
+  uint8_t len = get8(r);
+  if (len > 32) len = 32;
+  getBytes(r, out, len);
+  out[len] = '\0';
+  return len;
+}
+
+// ===== Reader =====
+static inline uint16_t readLE16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t readLE32(const uint8_t* p) {
+  return readLE16(p) | ((uint32_t)readLE16(p + 2) << 16);
+}
+
+// Checks framing and CRC before anything touches the tables; nullptr if sound
+static inline const char* snapshotError(const uint8_t* buf, size_t size) {
+  if (size < STORE_HEADER_LEN + STORE_END_LEN || readLE32(buf) != SCAN_STORE_MAGIC) return "not a snapshot";
+  uint16_t version = readLE16(buf + 4);
+  if (version == 0 || version > SCAN_STORE_VERSION) return "unsupported version";
+  const uint8_t* end = buf + size - STORE_END_LEN;
+  if (end[0] != STORE_TAG_END || end[1] != STORE_END_LEN - 2 ||
+      crc32Le(0, buf, size - 4) != readLE32(buf + size - 4)) {
+    return "checksum mismatch";
+  }
+  return nullptr;
+}
+
+// Steps through the records between the header and the end record, starting
+// at *o = STORE_HEADER_LEN; false once the walk is done
+static inline bool snapshotNextRecord(const uint8_t* buf, size_t size, size_t* o, uint8_t* tag, RecordIn* r) {
+  size_t end = size - STORE_END_LEN;
+  if (*o + 2 > end) return false;
+  *tag = buf[*o];
+  r->p = buf + *o + 2;
+  r->len = buf[*o + 1];
+  r->o = 0;
+  *o += 2 + r->len;
+  return *o <= end;  // Framing is covered by the CRC; this only guards the walk
+}
+
+#endif  // SCAN_STORE_CODEC_H
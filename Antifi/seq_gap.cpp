@@ -0,0 +1,379 @@
+#include "seq_gap.h"
+#include "rx_bus.h"
+#include "scan.h"
+#include "sketch.h"
+
+#define STREAM_BEACON 16
+#define STREAM_SHARED 17  // Non-QoS data and the other management frames
+#define SEQ_MOD 0x1000
+
+typedef uint8_t stream_id_t;
+
+// ===== Stream Table (RX callback only) =====
+typedef struct {
+  uint8_t mac[6];
+  uint8_t stream;     // QoS TID, STREAM_BEACON or STREAM_SHARED
+  uint8_t last_frag;
+  uint16_t last_seq;
+  uint8_t channel;
+  uint8_t used;
+  uint32_t hash;
+  uint32_t dwell;     // Dwell the last frame arrived in
+  uint32_t seen;
+  uint32_t missed;
+  stream_id_t lru_prev, lru_next;  // Recency (head = most recent)
+} Stream;
+
+static Stream streams[SEQ_GAP_STREAMS];
+static stream_id_t buckets[SEQ_GAP_BUCKETS];  // Linear probing, backward-shift deletion
+static stream_id_t lru_head = SEQ_GAP_ID_NONE;
+static stream_id_t lru_tail = SEQ_GAP_ID_NONE;
+static stream_id_t free_head = SEQ_GAP_ID_NONE;  // Linked through lru_next
+static uint8_t stream_count = 0;
+static uint32_t evictions = 0;
+
+// ===== Published Counters =====
+typedef struct {
+  uint8_t channel;
+  uint32_t start_ms;
+  uint32_t end_ms;
+  uint32_t seen;
+  uint32_t missed;
+} Dwell;
+
+typedef struct {
+  uint32_t seq;
+  SeqGapCounts channels[15];  // [0] unused
+  Dwell current;
+  Dwell recent[SEQ_GAP_DWELLS];
+  uint32_t dwells;            // Dwells closed so far
+} Published;
+
+static Published pub;
+static uint32_t dwell_id = 0;
+static uint8_t reset_pending = 0;
+static int seq_rx = -1;
+static unsigned long started_ms = 0;
+
+// ===== Recency List =====
+static void lruUnlink(stream_id_t id) {
+  Stream& s = streams[id];
+  if (s.lru_prev != SEQ_GAP_ID_NONE) streams[s.lru_prev].lru_next = s.lru_next;
+  else lru_head = s.lru_next;
+  if (s.lru_next != SEQ_GAP_ID_NONE) streams[s.lru_next].lru_prev = s.lru_prev;
+  else lru_tail = s.lru_prev;
+}
+
+static void lruPushFront(stream_id_t id) {
+  Stream& s = streams[id];
+  s.lru_prev = SEQ_GAP_ID_NONE;
+  s.lru_next = lru_head;
+  if (lru_head != SEQ_GAP_ID_NONE) streams[lru_head].lru_prev = id;
+  lru_head = id;
+  if (lru_tail == SEQ_GAP_ID_NONE) lru_tail = id;
+}
+
+// ===== Hash Index =====
+static inline uint16_t homeBucket(uint32_t hash) {
+  return hash & (SEQ_GAP_BUCKETS - 1);
+}
+
+static int findBucket(const uint8_t* mac, uint8_t stream, uint32_t hash) {
+  uint16_t b = homeBucket(hash);
+  for (int probes = 0; probes < SEQ_GAP_BUCKETS; probes++) {
+    stream_id_t id = buckets[b];
+    if (id == SEQ_GAP_ID_NONE) return -1;
+    const Stream& s = streams[id];
+    if (s.hash == hash && s.stream == stream && memcmp(s.mac, mac, 6) == 0) return b;
+    b = (b + 1) & (SEQ_GAP_BUCKETS - 1);
+  }
+  return -1;
+}
+
+static void insertBucket(stream_id_t id) {
+  uint16_t b = homeBucket(streams[id].hash);
+  while (buckets[b] != SEQ_GAP_ID_NONE) b = (b + 1) & (SEQ_GAP_BUCKETS - 1);
+  buckets[b] = id;
+}
+
+static void removeBucket(uint16_t hole) {
+  buckets[hole] = SEQ_GAP_ID_NONE;
+  uint16_t b = (hole + 1) & (SEQ_GAP_BUCKETS - 1);
+  while (buckets[b] != SEQ_GAP_ID_NONE) {
+    stream_id_t id = buckets[b];
+    uint16_t home = homeBucket(streams[id].hash);
+
+    // Move the entry back if the hole lies between its home and its slot
+    bool movable = (hole <= b) ? (home <= hole || home > b) : (home <= hole && home > b);
+    if (movable) {
+      buckets[hole] = id;
+      buckets[b] = SEQ_GAP_ID_NONE;
+      hole = b;
+    }
+    b = (b + 1) & (SEQ_GAP_BUCKETS - 1);
+  }
+}
+
+static void clearStreams() {
+  memset(buckets, SEQ_GAP_ID_NONE, sizeof(buckets));
+  for (int i = 0; i < SEQ_GAP_STREAMS; i++) {
+    streams[i].used = 0;
+    streams[i].lru_next = (i + 1 < SEQ_GAP_STREAMS) ? i + 1 : SEQ_GAP_ID_NONE;
+  }
+  lru_head = SEQ_GAP_ID_NONE;
+  lru_tail = SEQ_GAP_ID_NONE;
+  free_head = 0;
+  stream_count = 0;
+  evictions = 0;
+}
+
+static void clearAll() {
+  clearStreams();
+  seqWriteBegin(pub.seq);
+  memset(pub.channels, 0, sizeof(pub.channels));
+  memset(&pub.current, 0, sizeof(pub.current));
+  pub.dwells = 0;
+  seqWriteEnd(pub.seq);
+  __atomic_store_n(&reset_pending, 0, __ATOMIC_RELEASE);
+}
+
+// Finds or creates the stream and marks it most recently heard; the least
+// recently heard one is recycled when the table is full
+static stream_id_t intern(const uint8_t* mac, uint8_t stream, bool* created) {
+  uint32_t hash = (uint32_t)(macHash64(mac) ^ hashMix64(stream + 1));
+  int b = findBucket(mac, stream, hash);
+  if (b >= 0) {
+    stream_id_t id = buckets[b];
+    if (lru_head != id) {
+      lruUnlink(id);
+      lruPushFront(id);
+    }
+    *created = false;
+    return id;
+  }
+
+  if (free_head == SEQ_GAP_ID_NONE) {
+    stream_id_t victim = lru_tail;
+    removeBucket(findBucket(streams[victim].mac, streams[victim].stream, streams[victim].hash));
+    lruUnlink(victim);
+    streams[victim].lru_next = free_head;
+    free_head = victim;
+    stream_count--;
+    evictions++;
+  }
+  stream_id_t id = free_head;
+  free_head = streams[id].lru_next;
+  stream_count++;
+
+  Stream& s = streams[id];
+  memcpy(s.mac, mac, 6);
+  s.stream = stream;
+  s.hash = hash;
+  s.used = 1;
+  s.seen = 0;
+  s.missed = 0;
+  insertBucket(id);
+  lruPushFront(id);
+  *created = true;
+  return id;
+}
+
+// ===== RX Path =====
+static void closeDwell(uint8_t channel, uint32_t now) {
+  if (pub.current.channel && pub.current.seen) {
+    pub.recent[pub.dwells % SEQ_GAP_DWELLS] = pub.current;
+    pub.dwells++;
+  }
+  pub.current.channel = channel;
+  pub.current.start_ms = now;
+  pub.current.end_ms = now;
+  pub.current.seen = 0;
+  pub.current.missed = 0;
+  dwell_id++;
+}
+
+static void advance(Stream& s, SeqGapCounts& c, const FrameView& f, uint8_t frag, uint32_t missed) {
+  s.last_seq = f.seq;
+  s.last_frag = frag;
+  s.seen++;
+  s.missed += missed;
+  c.seen++;
+  c.missed += missed;
+  pub.current.seen++;
+  pub.current.missed += missed;
+}
+
+static void onFrame(const RxFrame& rx) {
+  const FrameView& f = rx.view;
+  if (!f.ta || f.channel < 1 || f.channel > 14) return;
+  if (__atomic_load_n(&reset_pending, __ATOMIC_ACQUIRE)) clearAll();
+
+  uint8_t stream = STREAM_SHARED;
+  if (f.key == FRAME_KEY(0, 0x08)) {
+    stream = STREAM_BEACON;
+  } else if (f.type == 0x02 && (f.subtype & 0x08)) {
+    uint8_t qos_at = (f.flags & (FC_TO_DS | FC_FROM_DS)) == (FC_TO_DS | FC_FROM_DS) ? 30 : 24;
+    stream = f.frame[qos_at] & 0x0F;
+  }
+  uint8_t frag = f.frame[22] & 0x0F;
+  uint32_t now = millis();
+
+  seqWriteBegin(pub.seq);
+  if (f.channel != pub.current.channel) closeDwell(f.channel, now);
+  pub.current.end_ms = now;
+  SeqGapCounts& c = pub.channels[f.channel];
+
+  bool created;
+  Stream& s = streams[intern(f.ta, stream, &created)];
+  s.channel = f.channel;
+  if (created || s.dwell != dwell_id) {
+    s.dwell = dwell_id;
+    c.resyncs++;
+    advance(s, c, f, frag, 0);
+  } else {
+    uint16_t delta = (f.seq - s.last_seq) & (SEQ_MOD - 1);
+    if (delta == 0) {
+      if (frag > s.last_frag) s.last_frag = frag;  // Next fragment of the same frame
+      else c.dups++;
+    } else if (delta <= SEQ_GAP_MAX) {
+      if (f.seq < s.last_seq) c.wraps++;
+      advance(s, c, f, frag, delta - 1);
+    } else if (delta >= SEQ_MOD - SEQ_GAP_MAX) {
+      c.late++;
+    } else {
+      c.resyncs++;
+      advance(s, c, f, frag, 0);
+    }
+  }
+  seqWriteEnd(pub.seq);
+}
+
+// ===== Control =====
+bool seqGapStart() {
+  if (seq_rx >= 0) return true;
+  seqGapReset();
+  // Control frames carry no sequence number; null data frames carry a meaningless one
+  RxSubscription sub = { "seq", RX_PKT_MGMT | RX_PKT_DATA, FRAME_BITS_OF_TYPE(0) | FRAME_BIT(2, 0x00) | FRAME_BIT(2, 0x08),
+                         -128, false, onFrame };
+  seq_rx = rxBusSubscribe(sub);
+  return seq_rx >= 0;
+}
+
+void seqGapStop() {
+  rxBusUnsubscribe(seq_rx);
+  seq_rx = -1;
+}
+
+bool seqGapActive() {
+  return seq_rx >= 0;
+}
+
+// The RX callback owns the table while subscribed, so it clears it there
+void seqGapReset() {
+  started_ms = millis();
+  if (seq_rx < 0) clearAll();
+  else __atomic_store_n(&reset_pending, 1, __ATOMIC_RELEASE);
+}
+
+// ===== Report =====
+static bool snapshot(Published* out) {
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(pub.seq);
+    memcpy(out, &pub, sizeof(Published));
+    if (!seqReadRetry(pub.seq, start)) return true;
+  }
+  return false;
+}
+
+bool seqGapChannels(SeqGapCounts out[15]) {
+  static Published copy;
+  if (!snapshot(&copy)) return false;
+  memcpy(out, copy.channels, sizeof(copy.channels));
+  return true;
+}
+
+static void printDwell(const Dwell& d) {
+  SeqGapCounts c = {};
+  c.seen = d.seen;
+  c.missed = d.missed;
+  Serial.printf("  %2u | %9lu | %8lu | %8lu | %6.1f%%\n", d.channel, (unsigned long)(d.end_ms - d.start_ms),
+                (unsigned long)d.seen, (unsigned long)d.missed, seqGapCompleteness(c));
+}
+
+// Rows are read without a lock, like the other RX-owned tables
+static void printLossiest() {
+  stream_id_t shown[SEQ_GAP_SHOWN];
+  int count = 0;
+  for (; count < SEQ_GAP_SHOWN; count++) {
+    stream_id_t best = SEQ_GAP_ID_NONE;
+    for (int i = 0; i < SEQ_GAP_STREAMS; i++) {
+      const Stream& s = streams[i];
+      if (!s.used || !s.missed) continue;
+      bool taken = false;
+      for (int j = 0; j < count; j++) taken |= shown[j] == i;
+      if (taken) continue;
+      if (best == SEQ_GAP_ID_NONE || s.missed > streams[best].missed) best = i;
+    }
+    if (best == SEQ_GAP_ID_NONE) break;
+    shown[count] = best;
+  }
+  if (!count) return;
+
+  Serial.println("\nLossiest transmitters:");
+  Serial.println("  Transmitter       | Stream | Ch | Seen      | Missed   | Complete");
+  for (int i = 0; i < count; i++) {
+    const Stream& s = streams[shown[i]];
+    char mac[18], name[8];
+    formatMAC(s.mac, mac);
+    if (s.stream == STREAM_BEACON) strcpy(name, "beacon");
+    else if (s.stream == STREAM_SHARED) strcpy(name, "other");
+    else snprintf(name, sizeof(name), "tid %u", s.stream);
+    SeqGapCounts c = {};
+    c.seen = s.seen;
+    c.missed = s.missed;
+    Serial.printf("  %s | %-6s | %2u | %9lu | %8lu | %6.1f%%\n", mac, name, s.channel, (unsigned long)s.seen,
+                  (unsigned long)s.missed, seqGapCompleteness(c));
+  }
+}
+
+void seqGapReport() {
+  static Published copy;  // ~700 bytes; keep it off the loop task stack
+
+  Serial.println("\n=== CAPTURE COMPLETENESS (sequence gaps) ===");
+  Serial.printf("Tracking: %s | Channel now: %u | %lu s | Streams: %u/%d (%lu recycled)\n",
+                seq_rx >= 0 ? "on" : "off", rxBusChannel(), (millis() - started_ms) / 1000, stream_count,
+                SEQ_GAP_STREAMS, (unsigned long)evictions);
+  if (!snapshot(&copy)) {
+    Serial.println("Counters busy, try again");
+    return;
+  }
+
+  SeqGapCounts total = {};
+  Serial.println("Ch | Seen      | Missed   | Complete | Dups    | Late    | Wraps  | Resyncs");
+  Serial.println("-------------------------------------------------------------------------------");
+  for (int ch = 1; ch <= 14; ch++) {
+    const SeqGapCounts& c = copy.channels[ch];
+    if (!c.seen) continue;
+    Serial.printf("%2d | %9lu | %8lu | %7.1f%% | %7lu | %7lu | %6lu | %lu\n", ch, (unsigned long)c.seen,
+                  (unsigned long)c.missed, seqGapCompleteness(c), (unsigned long)c.dups, (unsigned long)c.late,
+                  (unsigned long)c.wraps, (unsigned long)c.resyncs);
+    total.seen += c.seen;
+    total.missed += c.missed;
+  }
+  if (!total.seen) {
+    Serial.println("No sequenced frames yet");
+    return;
+  }
+  Serial.printf("All channels: %.1f%% complete (%lu of %lu numbered frames seen)\n", seqGapCompleteness(total),
+                (unsigned long)total.seen, (unsigned long)(total.seen + total.missed));
+
+  Serial.println("\nDwells (current first, then newest closed):");
+  Serial.println("  Ch | Length ms | Seen     | Missed   | Complete");
+  if (copy.current.channel) printDwell(copy.current);
+  int closed = copy.dwells < SEQ_GAP_DWELLS ? copy.dwells : SEQ_GAP_DWELLS;
+  for (int i = 1; i <= closed; i++) {
+    printDwell(copy.recent[(copy.dwells - i) % SEQ_GAP_DWELLS]);
+  }
+
+  printLossiest();
+}
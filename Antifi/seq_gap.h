@@ -0,0 +1,58 @@
+#ifndef SEQ_GAP_H
+#define SEQ_GAP_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define SEQ_GAP_STREAMS 128      // Transmitter streams kept (least recently heard recycled)
+#define SEQ_GAP_BUCKETS 256      // Hash slots, power of two and > 2x streams
+#define SEQ_GAP_ID_NONE 0xFF
+#define SEQ_GAP_MAX 128          // Longer forward jumps resync instead of counting loss
+#define SEQ_GAP_DWELLS 16        // Recent dwells kept for the report
+#define SEQ_GAP_SHOWN 5          // Lossiest transmitters listed
+
+// ===== Sequence Gap Tracker =====
+// Estimates how much of the air the capture misses. Each transmitter numbers
+// its frames (12-bit sequence, 4-bit fragment); a jump from seq to seq + n
+// means n - 1 frames went by unseen, a repeat is a retransmission we already
+// had. Streams are keyed by transmitter and counter: one per QoS TID, one for
+// beacons (often numbered by firmware apart from the rest) and one for other
+// management and data frames. Null data frames carry no meaningful number
+// and are skipped.
+//
+// Gaps only count within a dwell (a stretch on one channel): a transmitter
+// heard again after the radio was elsewhere resyncs, so the figure is the
+// capture's completeness while it listened, per channel and per dwell, not
+// the share of time spent on each channel. Clients scanning other channels
+// also burn sequence numbers, which reads as loss; jumps over SEQ_GAP_MAX
+// resync for the same reason.
+//
+// Runs as an RX bus subscriber without a channel claim. The stream table is
+// written by the RX callback only; counters are published under a seqlock.
+typedef struct {
+  uint32_t seen;     // Frames that advanced a sequence
+  uint32_t missed;   // Sequence numbers skipped within a dwell
+  uint32_t dups;     // Repeats of the last sequence/fragment
+  uint32_t late;     // Slightly older numbers (block ack retransmissions)
+  uint32_t wraps;    // 4095 -> 0 crossings
+  uint32_t resyncs;  // New stream, new dwell or a jump too long to be loss
+} SeqGapCounts;
+
+bool seqGapStart();
+void seqGapStop();
+bool seqGapActive();
+// Takes effect on the next frame while running
+void seqGapReset();
+
+// Consistent copy of the per-channel counters ([0] unused, 1-14); false if
+// the RX path kept rewriting them
+bool seqGapChannels(SeqGapCounts out[15]);
+
+static inline float seqGapCompleteness(const SeqGapCounts& c) {
+  uint32_t expected = c.seen + c.missed;
+  return expected ? 100.0f * c.seen / expected : 100.0f;
+}
+
+void seqGapReport();
+
+#endif  // SEQ_GAP_H
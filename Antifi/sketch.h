@@ -0,0 +1,422 @@
+#ifndef SKETCH_H
+#define SKETCH_H
+
+// Also builds on the host (WIDS replay tool), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#endif
+#include <math.h>
+
+// ===== Hashing =====
+// splitmix64 finalizer: every output bit depends on every input bit, which
+// is what the register index and the rank below need
+static inline uint64_t hashMix64(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xBF58476D1CE4E5B9ULL;
+  x ^= x >> 27;
+  x *= 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+static inline uint64_t macHash64(const uint8_t* mac) {
+  uint64_t x = 0;
+  for (int i = 0; i < 6; i++) x = (x << 8) | mac[i];
+  return hashMix64(x);
+}
+
+// FNV-1a over arbitrary bytes (SSIDs), then mixed
+static inline uint64_t bytesHash64(const uint8_t* p, size_t len) {
+  uint64_t h = 0xCBF29CE484222325ULL ^ len;
+  for (size_t i = 0; i < len; i++) h = (h ^ p[i]) * 0x100000001B3ULL;
+  return hashMix64(h);
+}
+
+// ===== HyperLogLog =====
+// Distinct-count sketch with 2^P one-byte registers. The top P hash bits pick
+// a register, which keeps the longest run of leading zeros seen in the rest.
+// Standard error is 1.04 / sqrt(2^P): 6.5% at P = 8 (256 bytes), 3.3% at
+// P = 10 (1 KB), whatever the count. Small counts fall back to linear
+// counting, so they stay close to exact.
+//
+// Sketches of the same P merge by taking the register-wise maximum; the
+// result is the sketch of the union. Adding is a single byte store, so the
+// RX callback can add while loop() estimates (the estimate is merely a few
+// frames stale).
+template <int P>
+class HyperLogLog {
+  static_assert(P >= 4 && P <= 16, "HyperLogLog precision out of range");
+
+public:
+  static constexpr int REGISTERS = 1 << P;
+
+  HyperLogLog() {
+    clear();
+  }
+
+  void clear() {
+    memset(reg, 0, sizeof(reg));
+  }
+
+  void add(uint64_t hash) {
+    uint32_t idx = (uint32_t)(hash >> (64 - P));
+    uint64_t rest = hash << P;
+    uint8_t rank = rest ? __builtin_clzll(rest) + 1 : 64 - P + 1;
+    if (rank > reg[idx]) reg[idx] = rank;
+  }
+
+  void merge(const HyperLogLog& other) {
+    for (int i = 0; i < REGISTERS; i++) {
+      if (other.reg[i] > reg[i]) reg[i] = other.reg[i];
+    }
+  }
+
+  bool empty() const {
+    for (int i = 0; i < REGISTERS; i++) {
+      if (reg[i]) return false;
+    }
+    return true;
+  }
+
+  uint32_t estimate() const {
+    float sum = 0.0f;
+    int zeros = 0;
+    for (int i = 0; i < REGISTERS; i++) {
+      sum += ldexpf(1.0f, -reg[i]);
+      if (reg[i] == 0) zeros++;
+    }
+
+    const float m = REGISTERS;
+    float alpha = REGISTERS == 16 ? 0.673f : REGISTERS == 32 ? 0.697f : REGISTERS == 64 ? 0.709f
+                                                                                           : 0.7213f / (1.0f + 1.079f / m);
+    float e = alpha * m * m / sum;
+    if (e <= 2.5f * m && zeros) e = m * logf(m / zeros);  // Linear counting
+    return (uint32_t)(e + 0.5f);
+  }
+
+  // Relative standard error in percent
+  static float errorPercent() {
+    return 104.0f / sqrtf((float)REGISTERS);
+  }
+
+private:
+  uint8_t reg[REGISTERS];
+};
+
+// ===== Bloom Filter =====
+// Set membership in BITS bits with K probes (double hashing of macHash64).
+// No false negatives; false positives are about (1 - e^(-K*n/BITS))^K for n
+// entries, so size it for the most entries it will see between clears.
+template <int BITS, int K>
+class BloomFilter {
+  static_assert((BITS & (BITS - 1)) == 0 && BITS >= 64, "Bloom filter size must be a power of two");
+
+public:
+  BloomFilter() {
+    clear();
+  }
+
+  void clear() {
+    memset(words, 0, sizeof(words));
+    added = 0;
+  }
+
+  void add(const uint8_t* mac) {
+    addHash(macHash64(mac));
+  }
+
+  bool mayContain(const uint8_t* mac) const {
+    return mayContainHash(macHash64(mac));
+  }
+
+  // Any other key, given a 64-bit hash of it
+  void addHash(uint64_t h) {
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1;
+    for (int i = 0; i < K; i++, h1 += h2) {
+      words[(h1 & (BITS - 1)) >> 5] |= 1u << (h1 & 31);
+    }
+    added++;
+  }
+
+  bool mayContainHash(uint64_t h) const {
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1;
+    for (int i = 0; i < K; i++, h1 += h2) {
+      if (!(words[(h1 & (BITS - 1)) >> 5] & (1u << (h1 & 31)))) return false;
+    }
+    return true;
+  }
+
+  // Adds since the last clear (duplicates included)
+  uint32_t size() const {
+    return added;
+  }
+
+  static constexpr size_t bytes() {
+    return BITS / 8;
+  }
+
+private:
+  uint32_t words[BITS / 32];
+  uint32_t added;
+};
+
+// ===== Count-Min Sketch =====
+// Approximate per-key counters in D rows of W saturating 16-bit cells. A key
+// touches one cell per row and reads the smallest; conservative update only
+// raises the cells that hold that minimum. Never undercounts; the overcount
+// is at most e * total / W with probability 1 - e^-D.
+template <int W, int D>
+class CountMin {
+  static_assert((W & (W - 1)) == 0, "Count-min width must be a power of two");
+
+public:
+  CountMin() {
+    clear();
+  }
+
+  void clear() {
+    memset(cells, 0, sizeof(cells));
+  }
+
+  // Counts the key once and returns its new estimate
+  uint16_t add(uint64_t h) {
+    uint16_t* cell[D];
+    uint16_t est = UINT16_MAX;
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1;
+    for (int d = 0; d < D; d++, h1 += h2) {
+      cell[d] = &cells[d][h1 & (W - 1)];
+      if (*cell[d] < est) est = *cell[d];
+    }
+    if (est == UINT16_MAX) return est;
+    for (int d = 0; d < D; d++) {
+      if (*cell[d] == est) (*cell[d])++;
+    }
+    return est + 1;
+  }
+
+  uint16_t estimate(uint64_t h) const {
+    uint16_t est = UINT16_MAX;
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1;
+    for (int d = 0; d < D; d++, h1 += h2) {
+      uint16_t c = cells[d][h1 & (W - 1)];
+      if (c < est) est = c;
+    }
+    return est;
+  }
+
+  static constexpr size_t bytes() {
+    return sizeof(uint16_t) * W * D;
+  }
+
+private:
+  uint16_t cells[D][W];
+};
+
+// ===== Sliding-Window Rate =====
+// Per-key events over the last `window` ms, from two count-min sketches: the
+// current window plus the previous one weighted by how much of it still
+// overlaps. Rolling just swaps and clears one sketch.
+template <int W, int D>
+class SlidingCountMin {
+public:
+  explicit SlidingCountMin(uint32_t window_ms = 1000) : window(window_ms) {
+    reset(0);
+  }
+
+  void reset(uint32_t now) {
+    sketch[0].clear();
+    sketch[1].clear();
+    cur = 0;
+    start = now;
+  }
+
+  void setWindow(uint32_t window_ms) {
+    window = window_ms ? window_ms : 1;
+  }
+
+  // Counts the key at `now` and returns its rate over the window
+  uint32_t add(uint64_t h, uint32_t now) {
+    roll(now);
+    uint32_t in_cur = sketch[cur].add(h);
+    return in_cur + overlap(sketch[cur ^ 1].estimate(h), now);
+  }
+
+  static constexpr size_t bytes() {
+    return 2 * CountMin<W, D>::bytes();
+  }
+
+private:
+  void roll(uint32_t now) {
+    uint32_t elapsed = now - start;
+    if (elapsed < window) return;
+    if (elapsed >= 2 * window) {
+      reset(now - elapsed % window);  // Both windows are stale
+      return;
+    }
+    cur ^= 1;
+    sketch[cur].clear();
+    start = now - elapsed % window;
+  }
+
+  uint32_t overlap(uint32_t prev, uint32_t now) const {
+    uint32_t elapsed = now - start;
+    return (uint32_t)((uint64_t)prev * (window - elapsed) / window);
+  }
+
+  CountMin<W, D> sketch[2];
+  uint8_t cur;
+  uint32_t start;
+  uint32_t window;
+};
+
+// ===== Space-Saving =====
+// Heavy hitters in K counters. A key already tracked is counted; a new key
+// takes over the smallest counter and inherits its count as `error`. So
+// count - error <= true frames <= count, and every key with more than
+// total / K frames is guaranteed to be in the table.
+//
+// Entries are kept sorted by count, largest first, and a small linear-probing
+// index maps keys to positions. Counting swaps the entry with the first one
+// of its count (found by binary search) before incrementing, which keeps the
+// order without moving anything else: O(log K) per frame, no allocation.
+// `bytes` is accumulated since the key entered and is a lower bound.
+template <int K, int KEY_LEN>
+class SpaceSaving {
+  static_assert(K >= 2 && K <= 64, "Space-Saving capacity out of range");
+  static constexpr int SLOTS = K <= 8 ? 16 : K <= 16 ? 32 : K <= 32 ? 64 : 128;
+  static constexpr uint8_t EMPTY = 0xFF;
+
+public:
+  typedef struct {
+    uint8_t key[KEY_LEN];
+    uint8_t home;  // Index slot the key hashes to
+    uint8_t slot;  // Index slot it sits in
+    uint32_t count;
+    uint32_t error;
+    uint32_t bytes;
+  } Entry;
+
+  SpaceSaving() {
+    clear();
+  }
+
+  void clear() {
+    memset(index, EMPTY, sizeof(index));
+    used = 0;
+    total = 0;
+    total_bytes = 0;
+  }
+
+  void offer(const uint8_t* key, uint64_t hash, uint32_t len) {
+    total++;
+    total_bytes += len;
+
+    uint8_t home = (uint8_t)(hash & (SLOTS - 1));
+    uint8_t s = home;
+    while (index[s] != EMPTY) {
+      Entry& e = entries[index[s]];
+      if (memcmp(e.key, key, KEY_LEN) == 0) {
+        e.bytes += len;
+        increment(index[s]);
+        return;
+      }
+      s = (s + 1) & (SLOTS - 1);
+    }
+
+    int pos;
+    uint32_t base = 0;
+    if (used < K) {
+      pos = used++;  // Count 0 is below everything, so the end keeps the order
+    } else {
+      pos = K - 1;
+      base = entries[pos].count;
+      unindex(entries[pos].slot);
+      // Removal may have shifted the chain; find the free slot again
+      s = home;
+      while (index[s] != EMPTY) s = (s + 1) & (SLOTS - 1);
+    }
+
+    Entry& e = entries[pos];
+    memcpy(e.key, key, KEY_LEN);
+    e.home = home;
+    e.slot = s;
+    e.count = base;
+    e.error = base;
+    e.bytes = len;
+    index[s] = pos;
+    increment(pos);
+  }
+
+  int size() const {
+    return used;
+  }
+
+  // Largest first
+  const Entry& at(int i) const {
+    return entries[i];
+  }
+
+  uint32_t frames() const {
+    return total;
+  }
+
+  uint64_t bytes() const {
+    return total_bytes;
+  }
+
+private:
+  void place(int pos) {
+    index[entries[pos].slot] = pos;
+  }
+
+  void increment(int pos) {
+    uint32_t c = entries[pos].count;
+    int lo = 0, hi = pos;  // First entry with count c lies in [lo, pos]
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (entries[mid].count > c) lo = mid + 1;
+      else hi = mid;
+    }
+    if (lo != pos) {
+      Entry tmp = entries[lo];
+      entries[lo] = entries[pos];
+      entries[pos] = tmp;
+      place(lo);
+      place(pos);
+    }
+    entries[lo].count++;
+  }
+
+  // Backward-shift deletion keeps probe chains intact without tombstones
+  void unindex(uint8_t s) {
+    uint8_t hole = s;
+    uint8_t j = s;
+    for (;;) {
+      j = (j + 1) & (SLOTS - 1);
+      if (index[j] == EMPTY) break;
+      uint8_t home = entries[index[j]].home;
+      // Move j back unless its home lies cyclically in (hole, j]
+      bool stays = hole <= j ? (home > hole && home <= j) : (home > hole || home <= j);
+      if (stays) continue;
+      index[hole] = index[j];
+      entries[index[hole]].slot = hole;
+      hole = j;
+    }
+    index[hole] = EMPTY;
+  }
+
+  Entry entries[K];
+  uint8_t index[SLOTS];
+  uint8_t used;
+  uint32_t total;
+  uint64_t total_bytes;
+};
+
+#endif  // SKETCH_H
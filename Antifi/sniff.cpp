@@ -8,6 +8,40 @@ static inline size_t pad4(size_t len) {
   return (4 - (len & 3)) & 3;
 }
 
+static inline void put_u16(uint8_t* buf, size_t& o, uint16_t v) {
+  buf[o++] = (uint8_t)(v & 0xFF);
+  buf[o++] = (uint8_t)((v >> 8) & 0xFF);
+}
+
+static inline void put_u32(uint8_t* buf, size_t& o, uint32_t v) {
+  put_u16(buf, o, (uint16_t)(v & 0xFFFF));
+  put_u16(buf, o, (uint16_t)(v >> 16));
+}
+
+// PCAPNG option: code, length, value, zero padding to 4 bytes
+static void put_option(uint8_t* buf, size_t& o, uint16_t code, const void* value, uint16_t len) {
+  put_u16(buf, o, code);
+  put_u16(buf, o, len);
+  memcpy(buf + o, value, len);
+  o += len;
+  for (size_t i = 0; i < pad4(len); ++i) buf[o++] = 0x00;
+}
+
+static void put_option_u64(uint8_t* buf, size_t& o, uint16_t code, uint64_t v) {
+  uint8_t b[8];
+  for (int i = 0; i < 8; ++i) b[i] = (uint8_t)((v >> (8 * i)) & 0xFF);
+  put_option(buf, o, code, b, 8);
+}
+
+// Timestamps are split like the EPB's: high word first
+static void put_option_ts(uint8_t* buf, size_t& o, uint16_t code, uint64_t ts_ns) {
+  uint8_t b[8];
+  size_t t = 0;
+  put_u32(b, t, (uint32_t)(ts_ns >> 32));
+  put_u32(b, t, (uint32_t)(ts_ns & 0xFFFFFFFFULL));
+  put_option(buf, o, code, b, 8);
+}
+
 // Helper: identical write to SD (if open) and Serial
 static void write_to_outputs(const uint8_t* buf, size_t len, File* file, bool fileOpen) {
 #if USE_SD
@@ -55,6 +89,21 @@ WiFiSniffer::WiFiSniffer()
     lastHop(0),
     isPromiscuous(false),
     paused(false),
+    rxId(-1),
+    captureStartNs(0),
+    framesReceived(0),
+    framesWritten(0),
+    seqBaseValid(false),
+    seqOwned(false),
+    followState(FOLLOW_OFF),
+    followSeen(0),
+    followBeaconAt(0),
+    csaChannel(0),
+    csaAt(0),
+    followLocks(0),
+    followSwitches(0),
+    followLost(0),
+    followDropped(0),
     epbBuffer(nullptr),
     epbBufferSize(0) {
   instance = this;
@@ -369,9 +418,81 @@ void WiFiSniffer::sendEPB(uint32_t interface_id, uint64_t ts_ns, const uint8_t*
     if ((packetCount & 0x3F) == 0) pcapngFile.flush();
   }
 #endif
+  framesWritten++;
   free(buf);
 }
 
+// ISB: received/delivered counts, plus the sequence-gap tracker's estimate of
+// frames the capture never saw as isb_ifdrop and per-channel completeness as
+// a comment. The estimate is left out if the tracker could not run.
+void WiFiSniffer::sendISB(uint32_t interface_id) {
+  const uint32_t block_type = 0x00000005u;
+  const uint16_t opt_comment = 1, isb_starttime = 2, isb_endtime = 3, isb_ifrecv = 4, isb_ifdrop = 5,
+                 isb_osdrop = 7, isb_usrdeliv = 8;
+  uint64_t end_ns = (uint64_t)esp_timer_get_time() * 1000ULL;
+
+  char comment[384];
+  size_t comment_len = 0;
+  uint64_t missed = 0;
+  bool estimate = false;
+  SeqGapCounts now[15];
+  if (seqBaseValid && seqGapChannels(now)) {
+    estimate = true;
+    comment_len = snprintf(comment, sizeof(comment), "Sequence-gap completeness:");
+    for (int ch = 1; ch <= 14; ch++) {
+      // A tracker reset mid-capture restarts the counters
+      SeqGapCounts c = now[ch];
+      if (c.seen >= seqBase[ch].seen && c.missed >= seqBase[ch].missed) {
+        c.seen -= seqBase[ch].seen;
+        c.missed -= seqBase[ch].missed;
+      }
+      if (!c.seen) continue;
+      missed += c.missed;
+      if (comment_len < sizeof(comment)) {
+        comment_len += snprintf(comment + comment_len, sizeof(comment) - comment_len, " ch%d %.1f%% (%lu/%lu)", ch,
+                                seqGapCompleteness(c), (unsigned long)c.seen, (unsigned long)(c.seen + c.missed));
+      }
+    }
+    if (comment_len >= sizeof(comment)) comment_len = sizeof(comment) - 1;
+  }
+  if (followState != FOLLOW_OFF && comment_len < sizeof(comment)) {
+    comment_len += snprintf(comment + comment_len, sizeof(comment) - comment_len,
+                            "%sFollowed %02X:%02X:%02X:%02X:%02X:%02X: %lu locks, %lu CSA moves, %lu lost, %lu "
+                            "frames of other BSSs dropped",
+                            comment_len ? "\n" : "", followBssid[0], followBssid[1], followBssid[2], followBssid[3],
+                            followBssid[4], followBssid[5], (unsigned long)followLocks,
+                            (unsigned long)followSwitches, (unsigned long)followLost, (unsigned long)followDropped);
+    if (comment_len >= sizeof(comment)) comment_len = sizeof(comment) - 1;
+  }
+  bool has_comment = comment_len > 0;
+
+  uint8_t buf[20 + 4 + sizeof(comment) + 6 * 12 + 4 + 4];
+  size_t o = 0;
+  put_u32(buf, o, block_type);
+  put_u32(buf, o, 0);  // total_len, patched below
+  put_u32(buf, o, interface_id);
+  put_u32(buf, o, (uint32_t)(end_ns >> 32));
+  put_u32(buf, o, (uint32_t)(end_ns & 0xFFFFFFFFULL));
+  if (has_comment) put_option(buf, o, opt_comment, comment, (uint16_t)comment_len);
+  put_option_ts(buf, o, isb_starttime, captureStartNs);
+  put_option_ts(buf, o, isb_endtime, end_ns);
+  put_option_u64(buf, o, isb_ifrecv, framesReceived);
+  if (estimate) put_option_u64(buf, o, isb_ifdrop, missed);
+  put_option_u64(buf, o, isb_osdrop, framesReceived - framesWritten);  // Buffer allocation failures
+  put_option_u64(buf, o, isb_usrdeliv, framesWritten);
+  put_u32(buf, o, 0);  // end-of-options
+  const uint32_t total_len = (uint32_t)o + 4;
+  put_u32(buf, o, total_len);
+  size_t len_at = 4;
+  put_u32(buf, len_at, total_len);
+#if USE_SD
+  write_to_outputs(buf, total_len, &pcapngFile, pcapngFileOpen);
+  if (pcapngFileOpen) fileSize += total_len;
+#else
+  write_to_outputs(buf, total_len, nullptr, false);
+#endif
+}
+
 bool WiFiSniffer::begin(uint8_t startCh, uint8_t endCh, uint16_t hopIntervalMs) {
   if (startCh < 1 || startCh > 14 || endCh < 1 || endCh > 14) return false;
   if (startCh > endCh) return false;
@@ -393,13 +514,31 @@ bool WiFiSniffer::start(uint8_t fixedChannel) {
 #endif
   }
 #endif
-  wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-  esp_wifi_init(&cfg);
-  esp_wifi_set_storage(WIFI_STORAGE_RAM);
-  esp_wifi_set_mode(WIFI_MODE_NULL);
-  esp_wifi_start();
-  esp_wifi_set_promiscuous(true);
-  esp_wifi_set_promiscuous_rx_cb(&WiFiSniffer::promiscuousCallback);
+  // Every frame, including ones the bus can't decode, so the capture is complete
+  RxSubscription sub = { "pcapng", RX_PKT_ALL, RX_KEYS_ALL, -128, true, &WiFiSniffer::onFrame };
+  rxId = rxBusSubscribe(sub);
+  if (rxId < 0) {
+#if USE_SD
+    closePCAPNGFile();
+#endif
+    return false;
+  }
+  if (fixedChannel >= 1 && fixedChannel <= 14) {
+    currentChannel = fixedChannel;
+    targetChannel = fixedChannel;
+  } else {
+    targetChannel = 0;
+    currentChannel = startChannel;
+  }
+  // Another capture already pinned a different channel
+  if (!claimChannel()) {
+    rxBusUnsubscribe(rxId);
+    rxId = -1;
+#if USE_SD
+    closePCAPNGFile();
+#endif
+    return false;
+  }
   isPromiscuous = true;
 #if SERIAL_OUTPUT
 #if USE_SD
@@ -412,17 +551,14 @@ bool WiFiSniffer::start(uint8_t fixedChannel) {
   sendIDB((uint16_t)LINKTYPE_IEEE802_11_RADIOTAP, SNIFF_MAX_SNAPLEN);
 #endif
 #endif
-  if (fixedChannel >= 1 && fixedChannel <= 14) {
-    currentChannel = fixedChannel;
-    targetChannel = fixedChannel;
-    esp_wifi_set_channel(currentChannel, WIFI_SECOND_CHAN_NONE);
-  } else {
-    targetChannel = 0;
-    currentChannel = startChannel;
-    esp_wifi_set_channel(currentChannel, WIFI_SECOND_CHAN_NONE);
-  }
   paused = false;
   lastHop = millis();
+  // Loss estimate for the ISB; the capture runs without it if the bus is full
+  captureStartNs = (uint64_t)esp_timer_get_time() * 1000ULL;
+  framesReceived = 0;
+  framesWritten = 0;
+  seqOwned = !seqGapActive();
+  seqBaseValid = seqGapStart() && seqGapChannels(seqBase);
   // allocate persistent epb buffer
   if (!epbBuffer) {
     epbBufferSize = (size_t)SNIFF_MAX_SNAPLEN + EPB_BUFFER_HEADROOM;
@@ -436,17 +572,23 @@ bool WiFiSniffer::start(uint8_t fixedChannel) {
   return true;
 }
 
+// Fixed channel pins the bus; hopping defers to any higher-priority hopper
+bool WiFiSniffer::claimChannel() {
+  if (targetChannel != 0) {
+    return rxBusClaimChannel(rxId, RX_CHAN_FIXED, targetChannel);
+  }
+  rxBusClaimChannel(rxId, RX_CHAN_HOP, 0, RX_HOP_PRIO_SNIFF);
+  if (!rxBusSetChannel(rxId, currentChannel)) currentChannel = rxBusChannel();
+  return true;
+}
+
 void WiFiSniffer::resume() {
   if (!isPromiscuous || !paused) return;   // not running or not paused
-  // Re-enable promiscuous mode
-  esp_wifi_set_promiscuous(true);
-  // Restore channel (in case it was changed externally)
-  if (targetChannel != 0) {
-    // Fixed channel mode
-    esp_wifi_set_channel(targetChannel, WIFI_SECOND_CHAN_NONE);
-  } else {
+  // Deliveries restart; the bus kept our slot and channel claim
+  rxBusSetPaused(rxId, false);
+  if (targetChannel == 0) {
     // Hopping mode – set to current channel and reset hop timer
-    esp_wifi_set_channel(currentChannel, WIFI_SECOND_CHAN_NONE);
+    rxBusSetChannel(rxId, currentChannel);
     lastHop = millis();   // restart hop interval timing
   }
   paused = false;
@@ -454,8 +596,8 @@ void WiFiSniffer::resume() {
 
 void WiFiSniffer::pause() {
   if (!isPromiscuous || paused) return;   // already stopped or paused
-  // Disable promiscuous mode – packets will no longer be received
-  esp_wifi_set_promiscuous(false);
+  // Stop deliveries; other subscribers keep receiving
+  rxBusSetPaused(rxId, true);
   paused = true;
 #if USE_SD
   // Optionally flush the file to ensure all data is written
@@ -469,7 +611,12 @@ void WiFiSniffer::stop() {
   if (!isPromiscuous) return;
   isPromiscuous = false;
   paused = false;
-  esp_wifi_set_promiscuous(false);
+  rxBusUnsubscribe(rxId);
+  rxId = -1;
+  sendISB(0);
+  if (seqOwned) seqGapStop();
+  seqOwned = false;
+  followState = FOLLOW_OFF;
 #if USE_SD
   closePCAPNGFile();
 #endif
@@ -480,8 +627,17 @@ void WiFiSniffer::stop() {
   }
 }
 
-void WiFiSniffer::promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
-  if (instance) instance->processPacket(buf, type);
+void WiFiSniffer::onFrame(const RxFrame& rx) {
+  if (!instance) return;
+  if (instance->followState != FOLLOW_OFF) {
+    // Filter on the shared decode, before the frame is copied into an EPB
+    if (!rx.decoded || !instance->followMatches(rx.view)) {
+      instance->followDropped++;
+      return;
+    }
+    instance->followBeacon(rx.view);
+  }
+  instance->processPacket(rx.pkt, rx.type);
 }
 
 // Helper to safely fetch a channel number from rx_ctrl (0 -> fallback)
@@ -490,10 +646,10 @@ static inline uint8_t safe_channel(const wifi_pkt_rx_ctrl_t& rc, uint8_t fallbac
   return fallback;
 }
 
-void WiFiSniffer::processPacket(void* buf, wifi_promiscuous_pkt_type_t type) {
-  wifi_promiscuous_pkt_t* p = (wifi_promiscuous_pkt_t*)buf;
+void WiFiSniffer::processPacket(const wifi_promiscuous_pkt_t* p, wifi_promiscuous_pkt_type_t type) {
   if (!p) return;
   if (paused) return;
+  framesReceived++;
 
   // Get the total packet length as reported by the hardware.
   // On ESP32 in promiscuous mode, sig_len typically INCLUDES the 4-byte FCS.
@@ -532,7 +688,7 @@ void WiFiSniffer::processPacket(void* buf, wifi_promiscuous_pkt_type_t type) {
   if (rt_o & 1) rt_tmp[rt_o++] = 0x00;
 
   // --- CHANNEL field (4 bytes) ---
-  uint8_t ch = safe_channel(p->rx_ctrl, (uint8_t)currentChannel);
+  uint8_t ch = safe_channel(p->rx_ctrl, rxBusChannel());
   uint16_t freq = channelToFrequency(ch);
   uint16_t chan_flags = 0x0080;  // 2.4 GHz spectrum
   if (ch == 14) chan_flags |= 0x0010;
@@ -587,12 +743,19 @@ void WiFiSniffer::processPacket(void* buf, wifi_promiscuous_pkt_type_t type) {
 
 void WiFiSniffer::update() {
   if (!isPromiscuous || paused) return;
-  if (targetChannel != 0) return;
   unsigned long now = millis();
-  if (now - lastHop >= hopInterval) {
+  if (followState != FOLLOW_OFF) followUpdate(now);
+  if (targetChannel != 0) return;
+  // A scan's adaptive hopper or a pinned capture drives the radio; follow it
+  if (!rxBusMayHop(rxId)) {
+    currentChannel = rxBusChannel();
+    return;
+  }
+  uint32_t interval = followState == FOLLOW_SEARCHING ? SNIFF_FOLLOW_SEARCH_MS : hopInterval;
+  if (now - lastHop >= interval) {
     currentChannel++;
     if (currentChannel > endChannel) currentChannel = startChannel;
-    esp_wifi_set_channel(currentChannel, WIFI_SECOND_CHAN_NONE);
+    rxBusSetChannel(rxId, currentChannel);
     lastHop = now;
   }
 }
@@ -600,7 +763,122 @@ void WiFiSniffer::update() {
 void WiFiSniffer::setHopping(bool enable) {
   if (enable) targetChannel = 0;
   else targetChannel = currentChannel;
+  if (isPromiscuous && !claimChannel()) {
+    // Pinned elsewhere: keep hopping behind the pinned channel
+    targetChannel = 0;
+    claimChannel();
+  }
 }
 void WiFiSniffer::setHopInterval(uint16_t interval_ms) {
   hopInterval = interval_ms;
-}
\ No newline at end of file
+}
+// ===== Follow Mode =====
+bool WiFiSniffer::startFollow(const uint8_t* bssid) {
+  if (isPromiscuous) return false;
+  memcpy(followBssid, bssid, 6);
+  followSeen = 0;
+  csaChannel = 0;
+  followLocks = 0;
+  followSwitches = 0;
+  followLost = 0;
+  followDropped = 0;
+  // Set before start() so the filter applies to the first frame
+  followState = FOLLOW_SEARCHING;
+  if (!start(0)) {
+    followState = FOLLOW_OFF;
+    return false;
+  }
+  return true;
+}
+
+// Frames to, from or about the BSS; ACK and CTS name only the receiver
+bool WiFiSniffer::followMatches(const FrameView& f) const {
+  return (f.bssid && memcmp(f.bssid, followBssid, 6) == 0) || (f.ta && memcmp(f.ta, followBssid, 6) == 0) ||
+         memcmp(f.ra, followBssid, 6) == 0;
+}
+
+// RX callback: beacons and probe responses from the target keep the lock
+// alive and name its channel (DS Parameter Set, which beats the tuned channel
+// when a neighbouring channel leaks through) and any announced switch
+void WiFiSniffer::followBeacon(const FrameView& f) {
+  if (f.key != FRAME_KEY(0, 0x08) && f.key != FRAME_KEY(0, 0x05)) return;
+  if (!f.ta || memcmp(f.ta, followBssid, 6) != 0 || f.body_len < 12) return;
+
+  uint16_t interval_tu = f.body[8] | (f.body[9] << 8);
+  uint8_t channel = f.channel;
+  uint8_t switch_to = 0;
+  uint8_t count = 0;
+  const uint8_t* p = f.body + 12;
+  const uint8_t* end = f.body + f.body_len;
+  while (p + 2 <= end && p + 2 + p[1] <= end) {
+    uint8_t id = p[0];
+    uint8_t len = p[1];
+    const uint8_t* v = p + 2;
+    if (id == 3 && len >= 1) {  // DS Parameter Set
+      channel = v[0];
+    } else if (id == 37 && len >= 3) {  // Channel Switch Announcement: mode, channel, count
+      switch_to = v[1];
+      count = v[2];
+    } else if (id == 60 && len >= 4) {  // Extended CSA: mode, operating class, channel, count
+      switch_to = v[2];
+      count = v[3];
+    }
+    p += 2 + len;
+  }
+
+  unsigned long now = millis();
+  if (switch_to >= 1 && switch_to <= 14 && switch_to != channel) {
+    // The switch happens `count` beacon intervals from now (1 TU = 1.024 ms)
+    csaAt = now + (unsigned long)count * interval_tu * 1024 / 1000;
+    csaChannel = switch_to;
+  }
+  if (channel >= 1 && channel <= 14) followSeen = channel;
+  followBeaconAt = now;
+}
+
+bool WiFiSniffer::followLock(uint8_t channel, unsigned long now) {
+  targetChannel = channel;
+  currentChannel = channel;
+  if (!claimChannel()) {
+    // Another capture pinned a different channel; wait for the next beacon
+    targetChannel = 0;
+    claimChannel();
+    followSeen = 0;
+    return false;
+  }
+  followState = FOLLOW_LOCKED;
+  followSeen = 0;
+  followBeaconAt = now;
+  followLocks++;
+  return true;
+}
+
+void WiFiSniffer::followSearch(unsigned long now) {
+  followState = FOLLOW_SEARCHING;
+  followSeen = 0;
+  csaChannel = 0;
+  targetChannel = 0;
+  claimChannel();
+  lastHop = now;
+}
+
+void WiFiSniffer::followUpdate(unsigned long now) {
+  uint8_t seen = followSeen;
+  if (followState == FOLLOW_SEARCHING) {
+    if (seen) followLock(seen, now);
+    return;
+  }
+
+  uint8_t csa = csaChannel;
+  if (csa && (long)(now - csaAt) >= 0) {
+    csaChannel = 0;
+    followSwitches++;
+    if (!followLock(csa, now)) followSearch(now);
+  } else if (now - followBeaconAt >= SNIFF_FOLLOW_LOST_MS) {
+    // AP restarted, moved without announcing it, or went quiet
+    followLost++;
+    followSearch(now);
+  } else if (seen && seen != targetChannel) {
+    followLock(seen, now);
+  }
+}
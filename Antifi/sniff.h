@@ -6,6 +6,8 @@
 #include <SPI.h>
 #include "esp_wifi.h"
 #include "esp_timer.h"
+#include "rx_bus.h"
+#include "seq_gap.h"
 
 // Enable/disable outputs
 #define USE_SD 1         // SD card writes
@@ -22,6 +24,8 @@
 #define SNIFF_END_CHANNEL 14
 #define SNIFF_HOP_INTERVAL_MS 100
 #define SNIFF_MAX_SNAPLEN 2346
+#define SNIFF_FOLLOW_SEARCH_MS 120  // Dwell per channel while searching (beacons ~102 ms apart)
+#define SNIFF_FOLLOW_LOST_MS 3000   // No beacon from the target this long: search again
 
 #if !USE_SD && !SERIAL_OUTPUT
 #error "At least one output (USE_SD or SERIAL_OUTPUT) must be enabled"
@@ -50,6 +54,11 @@ public:
              uint8_t endChannel = SNIFF_END_CHANNEL,
              uint16_t hopIntervalMs = SNIFF_HOP_INTERVAL_MS);
   bool start(uint8_t fixedChannel = 0);
+  // Captures one BSS: hops until the target's beacon names its channel, pins
+  // that channel, and searches again after a channel switch announcement or
+  // when its beacons stop. Frames that don't carry the BSSID (as BSSID,
+  // transmitter or receiver) are dropped before they are copied.
+  bool startFollow(const uint8_t* bssid);
   void pause();
   void resume();
   void stop();
@@ -59,6 +68,8 @@ public:
   void sendIDB(uint16_t linktype, uint32_t snaplen);
   void sendEPB(uint32_t interface_id, uint64_t ts_ns, const uint8_t* payload,
                uint32_t len, const wifi_pkt_rx_ctrl_t* rx_ctrl = nullptr);
+  // Capture totals and the sequence-gap loss estimate since start()
+  void sendISB(uint32_t interface_id);
 
   void setHopping(bool enable);
   void setHopInterval(uint16_t interval_ms);
@@ -70,6 +81,9 @@ public:
   bool isRunning() const {
     return isPromiscuous;
   }
+  bool isFollowing() const {
+    return followState != FOLLOW_OFF;
+  }
   uint8_t getCurrentChannel() const {
     return currentChannel;
   }
@@ -111,8 +125,17 @@ private:
   void serialWriteBuffer(const uint8_t* buffer, size_t len);
 #endif
 
-  void processPacket(void* buf, wifi_promiscuous_pkt_type_t type);
-  static void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type);
+  void processPacket(const wifi_promiscuous_pkt_t* p, wifi_promiscuous_pkt_type_t type);
+  static void onFrame(const RxFrame& rx);
+  bool claimChannel();
+
+  // Follow mode: the RX callback reads the target's beacons, update() moves the radio
+  enum FollowState : uint8_t { FOLLOW_OFF, FOLLOW_SEARCHING, FOLLOW_LOCKED };
+  bool followMatches(const FrameView& f) const;
+  void followBeacon(const FrameView& f);
+  void followUpdate(unsigned long now);
+  bool followLock(uint8_t channel, unsigned long now);
+  void followSearch(unsigned long now);
 
   // Channel hopping variables (volatile for cross-context access)
   volatile uint8_t currentChannel;
@@ -123,6 +146,26 @@ private:
   volatile unsigned long lastHop;
   volatile bool isPromiscuous;
   volatile bool paused;
+  int rxId;  // RX bus subscription, -1 when stopped
+
+  // Interface statistics (ISB) for the running capture
+  uint64_t captureStartNs;
+  uint32_t framesReceived;
+  uint32_t framesWritten;
+  bool seqBaseValid;
+  bool seqOwned;             // Tracker started for this capture, stopped with it
+  SeqGapCounts seqBase[15];  // Tracker counters at start()
+
+  volatile uint8_t followState;
+  uint8_t followBssid[6];
+  volatile uint8_t followSeen;          // Channel the target's last beacon named (0 = none since lock/search)
+  volatile unsigned long followBeaconAt;
+  volatile uint8_t csaChannel;          // Announced switch, 0 = none
+  volatile unsigned long csaAt;         // When the switch is due
+  uint32_t followLocks;
+  uint32_t followSwitches;              // Moves on a channel switch announcement
+  uint32_t followLost;                  // Beacons stopped: searched again
+  volatile uint32_t followDropped;      // Frames of other BSSs
 
   // Persistent packet buffer to avoid per-packet malloc
   static constexpr size_t EPB_BUFFER_HEADROOM = 512;  // radiotap + headroom
@@ -0,0 +1,322 @@
+#include "ssid_table.h"
+#include "scan.h"
+
+SSIDTable ssid_table;
+
+// ===== Hashing =====
+static uint32_t fnv1a(const uint8_t* data, size_t len, uint32_t hash = 2166136261u) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static inline uint32_t ssidHash(const char* ssid, uint8_t ssid_len) {
+  return fnv1a((const uint8_t*)ssid, ssid_len, 2166136261u ^ ssid_len);
+}
+
+static inline uint16_t homeBucket(uint32_t hash) {
+  return hash & (SSID_TABLE_BUCKETS - 1);
+}
+
+// ===== Recency List =====
+static void lruUnlink(ssid_id_t id) {
+  SSIDTable& t = ssid_table;
+  ssid_id_t prev = t.lru_prev[id];
+  ssid_id_t next = t.lru_next[id];
+
+  if (prev != SSID_ID_NONE) t.lru_next[prev] = next;
+  else t.lru_head = next;
+
+  if (next != SSID_ID_NONE) t.lru_prev[next] = prev;
+  else t.lru_tail = prev;
+}
+
+static void lruPushFront(ssid_id_t id) {
+  SSIDTable& t = ssid_table;
+  t.lru_prev[id] = SSID_ID_NONE;
+  t.lru_next[id] = t.lru_head;
+  if (t.lru_head != SSID_ID_NONE) t.lru_prev[t.lru_head] = id;
+  t.lru_head = id;
+  if (t.lru_tail == SSID_ID_NONE) t.lru_tail = id;
+}
+
+// ===== Hash Index =====
+static int findBucket(const char* ssid, uint8_t ssid_len, uint32_t hash) {
+  SSIDTable& t = ssid_table;
+  uint16_t b = homeBucket(hash);
+
+  for (int probes = 0; probes < SSID_TABLE_BUCKETS; probes++) {
+    ssid_id_t id = t.buckets[b];
+    if (id == SSID_ID_NONE) return -1;
+    if (t.hash[id] == hash && t.ssid_len[id] == ssid_len && memcmp(t.ssid[id], ssid, ssid_len) == 0) {
+      return b;
+    }
+    b = (b + 1) & (SSID_TABLE_BUCKETS - 1);
+  }
+  return -1;
+}
+
+static void insertBucket(ssid_id_t id) {
+  SSIDTable& t = ssid_table;
+  uint16_t b = homeBucket(t.hash[id]);
+  while (t.buckets[b] != SSID_ID_NONE) {
+    b = (b + 1) & (SSID_TABLE_BUCKETS - 1);
+  }
+  t.buckets[b] = id;
+}
+
+// Backward-shift deletion keeps probe chains intact without tombstones
+static void removeBucket(uint16_t hole) {
+  SSIDTable& t = ssid_table;
+  t.buckets[hole] = SSID_ID_NONE;
+
+  uint16_t b = (hole + 1) & (SSID_TABLE_BUCKETS - 1);
+  while (t.buckets[b] != SSID_ID_NONE) {
+    ssid_id_t id = t.buckets[b];
+    uint16_t home = homeBucket(t.hash[id]);
+
+    // Move the entry back if the hole lies between its home and its slot
+    bool movable = (hole <= b) ? (home <= hole || home > b) : (home <= hole && home > b);
+    if (movable) {
+      t.buckets[hole] = id;
+      t.buckets[b] = SSID_ID_NONE;
+      hole = b;
+    }
+    b = (b + 1) & (SSID_TABLE_BUCKETS - 1);
+  }
+}
+
+// ===== Probers =====
+static inline uint16_t proberHome(const uint8_t* mac) {
+  return fnv1a(mac, 6) & (SSID_PROBER_BUCKETS - 1);
+}
+
+static int proberBucket(const uint8_t* mac) {
+  SSIDTable& t = ssid_table;
+  uint16_t b = proberHome(mac);
+
+  for (int probes = 0; probes < SSID_PROBER_BUCKETS; probes++) {
+    uint16_t p = t.prober_buckets[b];
+    if (p == SSID_PROBER_NONE) return -1;
+    if (memcmp(t.prober_mac[p], mac, 6) == 0) return b;
+    b = (b + 1) & (SSID_PROBER_BUCKETS - 1);
+  }
+  return -1;
+}
+
+// Same backward-shift deletion as the SSID index
+static void proberRemoveBucket(uint16_t hole) {
+  SSIDTable& t = ssid_table;
+  t.prober_buckets[hole] = SSID_PROBER_NONE;
+
+  uint16_t b = (hole + 1) & (SSID_PROBER_BUCKETS - 1);
+  while (t.prober_buckets[b] != SSID_PROBER_NONE) {
+    uint16_t p = t.prober_buckets[b];
+    uint16_t home = proberHome(t.prober_mac[p]);
+    bool movable = (hole <= b) ? (home <= hole || home > b) : (home <= hole && home > b);
+    if (movable) {
+      t.prober_buckets[hole] = p;
+      t.prober_buckets[b] = SSID_PROBER_NONE;
+      hole = b;
+    }
+    b = (b + 1) & (SSID_PROBER_BUCKETS - 1);
+  }
+}
+
+static void proberUnlink(uint16_t p) {
+  SSIDTable& t = ssid_table;
+  uint16_t prev = t.prober_prev[p];
+  uint16_t next = t.prober_next[p];
+
+  if (prev != SSID_PROBER_NONE) t.prober_next[prev] = next;
+  else t.prober_head = next;
+
+  if (next != SSID_PROBER_NONE) t.prober_prev[next] = prev;
+  else t.prober_tail = prev;
+}
+
+static void proberPushFront(uint16_t p) {
+  SSIDTable& t = ssid_table;
+  t.prober_prev[p] = SSID_PROBER_NONE;
+  t.prober_next[p] = t.prober_head;
+  if (t.prober_head != SSID_PROBER_NONE) t.prober_prev[t.prober_head] = p;
+  t.prober_head = p;
+  if (t.prober_tail == SSID_PROBER_NONE) t.prober_tail = p;
+}
+
+// ID for a client MAC, marked most recently heard. When every ID is taken
+// the least recently heard client is dropped from all client sets.
+static uint16_t proberIntern(const uint8_t* mac) {
+  SSIDTable& t = ssid_table;
+  int b = proberBucket(mac);
+  if (b >= 0) {
+    uint16_t p = t.prober_buckets[b];
+    if (t.prober_head != p) {
+      proberUnlink(p);
+      proberPushFront(p);
+    }
+    return p;
+  }
+
+  uint16_t p;
+  if (t.prober_count < SSID_PROBER_CAPACITY) {
+    p = t.prober_count++;
+  } else {
+    p = t.prober_tail;
+    int old = proberBucket(t.prober_mac[p]);
+    if (old >= 0) proberRemoveBucket(old);
+    proberUnlink(p);
+    uint32_t keep = ~(1u << (p & 31));
+    for (int id = 0; id < SSID_TABLE_CAPACITY; id++) {
+      t.clients[id][p >> 5] &= keep;
+    }
+    t.prober_evictions++;
+  }
+
+  memcpy(t.prober_mac[p], mac, 6);
+  uint16_t home = proberHome(mac);
+  while (t.prober_buckets[home] != SSID_PROBER_NONE) {
+    home = (home + 1) & (SSID_PROBER_BUCKETS - 1);
+  }
+  t.prober_buckets[home] = p;
+  proberPushFront(p);
+  return p;
+}
+
+// ===== Public API =====
+void ssidTableClear() {
+  SSIDTable& t = ssid_table;
+  memset(t.buckets, SSID_ID_NONE, sizeof(t.buckets));
+  t.lru_head = SSID_ID_NONE;
+  t.lru_tail = SSID_ID_NONE;
+  for (int i = 0; i < SSID_TABLE_CAPACITY; i++) {
+    t.ssid_len[i] = SSID_LEN_FREE;
+    t.lru_next[i] = (i + 1 < SSID_TABLE_CAPACITY) ? i + 1 : SSID_ID_NONE;
+  }
+  t.free_head = 0;
+  t.count = 0;
+  t.evictions = 0;
+
+  memset(t.clients, 0, sizeof(t.clients));
+  memset(t.prober_buckets, 0xFF, sizeof(t.prober_buckets));
+  t.prober_head = SSID_PROBER_NONE;
+  t.prober_tail = SSID_PROBER_NONE;
+  t.prober_count = 0;
+  t.prober_evictions = 0;
+}
+
+ssid_id_t ssidFind(const char* ssid, uint8_t ssid_len) {
+  if (ssid_len > 32) ssid_len = 32;
+  int b = findBucket(ssid, ssid_len, ssidHash(ssid, ssid_len));
+  return b < 0 ? SSID_ID_NONE : ssid_table.buckets[b];
+}
+
+ssid_id_t ssidIntern(const char* ssid, uint8_t ssid_len, unsigned long now, bool* created) {
+  SSIDTable& t = ssid_table;
+  if (ssid_len > 32) ssid_len = 32;
+  if (created) *created = false;
+
+  uint32_t hash = ssidHash(ssid, ssid_len);
+  int b = findBucket(ssid, ssid_len, hash);
+  if (b >= 0) {
+    ssid_id_t id = t.buckets[b];
+    if (t.lru_head != id) {
+      lruUnlink(id);
+      lruPushFront(id);
+    }
+    return id;
+  }
+
+  // Take a free ID, or recycle the least recently seen one
+  if (t.free_head == SSID_ID_NONE) {
+    ssidRemove(t.lru_tail);
+    t.evictions++;
+  }
+  ssid_id_t id = t.free_head;
+  t.free_head = t.lru_next[id];
+  t.count++;
+
+  memcpy(t.ssid[id], ssid, ssid_len);
+  t.ssid[id][ssid_len] = '\0';
+  t.ssid_len[id] = ssid_len;
+  t.hash[id] = hash;
+  t.first_seen[id] = now;
+  t.last_seen[id] = now;
+  t.probe_count[id] = 0;
+  t.rssi[id] = 0;
+  t.channel[id] = 0;
+  t.flags[id] = 0;
+  memset(t.bssid[id], 0, 6);
+  memset(t.clients[id], 0, sizeof(t.clients[id]));
+
+  insertBucket(id);
+  lruPushFront(id);
+  timerArm(TIMER_SSID, id, now + scan.ssid_ttl_ms);
+
+  if (created) *created = true;
+  return id;
+}
+
+void ssidRemove(ssid_id_t id) {
+  SSIDTable& t = ssid_table;
+  if (id >= SSID_TABLE_CAPACITY || t.ssid_len[id] == SSID_LEN_FREE) return;
+
+  int b = findBucket(t.ssid[id], t.ssid_len[id], t.hash[id]);
+  if (b >= 0) removeBucket(b);
+  lruUnlink(id);
+  timerCancel(TIMER_SSID, id);
+
+  t.ssid_len[id] = SSID_LEN_FREE;
+  t.lru_next[id] = t.free_head;
+  t.free_head = id;
+  t.count--;
+}
+
+// Timer wheel handler: probes only move last_seen, so check it here
+bool ssidTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  SSIDTable& t = ssid_table;
+  if (id >= SSID_TABLE_CAPACITY || t.ssid_len[id] == SSID_LEN_FREE) return false;
+
+  unsigned long expires = t.last_seen[id] + scan.ssid_ttl_ms;
+  if ((long)(expires - now) > 0) {
+    *rearm_at = expires;
+    return true;
+  }
+  ssidRemove(id);
+  return false;
+}
+
+void ssidRecordProbe(ssid_id_t id, const uint8_t* client_mac, const uint8_t* bssid,
+                     int rssi, int channel, bool hidden, unsigned long now) {
+  if (id >= SSID_TABLE_CAPACITY) return;
+  SSIDTable& t = ssid_table;
+
+  // First sighting keeps the original BSSID/channel/RSSI, like the old list did
+  if (t.probe_count[id] == 0) {
+    if (bssid) memcpy(t.bssid[id], bssid, 6);
+    t.channel[id] = channel;
+    t.rssi[id] = rssi < -128 ? -128 : (rssi > 0 ? 0 : rssi);
+  }
+
+  t.last_seen[id] = now;
+  if (t.probe_count[id] < UINT16_MAX) t.probe_count[id]++;
+  t.flags[id] |= SSID_FLAG_PROBE_REQUEST;
+  if (hidden) t.flags[id] |= SSID_FLAG_HIDDEN;
+
+  if (client_mac) {
+    uint16_t p = proberIntern(client_mac);
+    t.clients[id][p >> 5] |= 1u << (p & 31);
+  }
+}
+
+int ssidClientCount(ssid_id_t id) {
+  if (id >= SSID_TABLE_CAPACITY) return 0;
+
+  int n = 0;
+  for (int w = 0; w < SSID_PROBER_WORDS; w++) {
+    n += __builtin_popcount(ssid_table.clients[id][w]);
+  }
+  return n;
+}
@@ -0,0 +1,96 @@
+#ifndef SSID_TABLE_H
+#define SSID_TABLE_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define SSID_TABLE_CAPACITY 100  // Interned SSIDs kept (least recently seen evicted)
+#define SSID_TABLE_BUCKETS 256   // Hash slots, power of two and > 2x capacity
+#define SSID_ID_NONE 0xFF
+#define SSID_LEN_FREE 0xFF       // ssid_len of an unused ID
+#define SSID_PROBER_CAPACITY 256 // Probing clients with an ID (least recently heard recycled)
+#define SSID_PROBER_BUCKETS 512  // Hash slots, power of two and > 2x probers
+#define SSID_PROBER_NONE 0xFFFF
+#define SSID_PROBER_WORDS (SSID_PROBER_CAPACITY / 32)
+
+// ===== SSID Flags =====
+#define SSID_FLAG_HIDDEN 0x01          // Wildcard / zeroed SSID
+#define SSID_FLAG_PROBE_REQUEST 0x02   // Seen in probe request
+#define SSID_FLAG_BEACON 0x04          // Seen in beacon
+#define SSID_FLAG_PROBE_RESPONSE 0x08  // Seen in probe response
+
+typedef uint8_t ssid_id_t;
+
+// ===== Interned SSID Store =====
+// Every distinct SSID (<= 32 bytes) is hashed once and mapped to a small ID.
+// Per-SSID statistics live in parallel arrays indexed by that ID. Probing
+// clients are interned the same way into prober IDs, and each SSID's client
+// set is a bitmap over them (32 bytes), so a probe request costs two hash
+// lookups and a handful of array writes, and a set's size is an exact
+// popcount. Recycling a prober clears its bit in every set: counts cover the
+// SSID_PROBER_CAPACITY clients heard most recently. SSID IDs expire through
+// the timer wheel (TIMER_SSID) once unseen for scan.ssid_ttl_ms.
+// Written from the RX callback only; readers tolerate slightly stale rows.
+struct SSIDTable {
+  // Identity
+  char ssid[SSID_TABLE_CAPACITY][33];
+  uint8_t ssid_len[SSID_TABLE_CAPACITY];
+  uint32_t hash[SSID_TABLE_CAPACITY];
+
+  // Statistics
+  unsigned long first_seen[SSID_TABLE_CAPACITY];
+  unsigned long last_seen[SSID_TABLE_CAPACITY];
+  uint16_t probe_count[SSID_TABLE_CAPACITY];
+  int8_t rssi[SSID_TABLE_CAPACITY];
+  uint8_t channel[SSID_TABLE_CAPACITY];
+  uint8_t flags[SSID_TABLE_CAPACITY];
+  uint8_t bssid[SSID_TABLE_CAPACITY][6];
+  uint32_t clients[SSID_TABLE_CAPACITY][SSID_PROBER_WORDS];  // Prober IDs that asked for it
+
+  // Recency list (head = most recently seen)
+  ssid_id_t lru_prev[SSID_TABLE_CAPACITY];
+  ssid_id_t lru_next[SSID_TABLE_CAPACITY];
+  ssid_id_t lru_head;
+  ssid_id_t lru_tail;
+  ssid_id_t free_head;  // Unused IDs, linked through lru_next
+
+  // Hash index (linear probing, backward-shift deletion)
+  ssid_id_t buckets[SSID_TABLE_BUCKETS];
+
+  uint8_t count;  // Live IDs
+  uint32_t evictions;
+
+  // Prober MACs: recency list (head = most recently heard) and hash index
+  uint8_t prober_mac[SSID_PROBER_CAPACITY][6];
+  uint16_t prober_prev[SSID_PROBER_CAPACITY];
+  uint16_t prober_next[SSID_PROBER_CAPACITY];
+  uint16_t prober_head;
+  uint16_t prober_tail;
+  uint16_t prober_buckets[SSID_PROBER_BUCKETS];
+  uint16_t prober_count;
+  uint32_t prober_evictions;
+};
+
+extern SSIDTable ssid_table;
+
+// Empties the table; scanBegin() runs it before the first probe or restore
+void ssidTableClear();
+
+// Finds or creates the ID for an SSID and marks it most recently seen.
+// When no ID is free the least recently seen SSID is recycled.
+ssid_id_t ssidIntern(const char* ssid, uint8_t ssid_len, unsigned long now, bool* created = nullptr);
+
+// Releases the ID (the SSID is forgotten)
+void ssidRemove(ssid_id_t id);
+
+// Looks up an SSID without creating or touching it
+ssid_id_t ssidFind(const char* ssid, uint8_t ssid_len);
+
+// Records a probe request for an interned SSID
+void ssidRecordProbe(ssid_id_t id, const uint8_t* client_mac, const uint8_t* bssid,
+                     int rssi, int channel, bool hidden, unsigned long now);
+
+// Distinct clients (among those holding a prober ID) that probed for this SSID
+int ssidClientCount(ssid_id_t id);
+
+#endif  // SSID_TABLE_H
@@ -0,0 +1,245 @@
+#include "timer_wheel.h"
+
+#ifdef ARDUINO
+#include "scan.h"
+#include "assoc_graph.h"
+#include "ssid_table.h"
+
+#define TIMER_AP_SLOTS MAX_APS
+#define TIMER_CLIENT_SLOTS MAX_CLIENTS
+#define TIMER_ASSOC_SLOTS ASSOC_MAX_EDGES
+#define TIMER_SSID_SLOTS SSID_TABLE_CAPACITY
+#else
+// Host test: same wheel, small tables, handlers supplied by the test
+#define TIMER_AP_SLOTS 64
+#define TIMER_CLIENT_SLOTS 64
+#define TIMER_ASSOC_SLOTS 64
+#define TIMER_SSID_SLOTS 64
+#endif
+
+// ===== Expiry Handlers =====
+bool apTimerExpired(uint16_t slot, unsigned long now, unsigned long* rearm_at);
+bool clientTimerExpired(uint16_t slot, unsigned long now, unsigned long* rearm_at);
+bool assocTimerExpired(uint16_t edge, unsigned long now, unsigned long* rearm_at);
+bool ssidTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at);
+
+typedef bool (*TimerExpireFn)(uint16_t id, unsigned long now, unsigned long* rearm_at);
+
+static TimerExpireFn const handlers[TIMER_TYPES] = {
+  apTimerExpired,
+  clientTimerExpired,
+  assocTimerExpired,
+  ssidTimerExpired,
+};
+
+// Handle ranges: one timer per record slot of every type
+static const uint16_t type_base[TIMER_TYPES + 1] = {
+  0,
+  TIMER_AP_SLOTS,
+  TIMER_AP_SLOTS + TIMER_CLIENT_SLOTS,
+  TIMER_AP_SLOTS + TIMER_CLIENT_SLOTS + TIMER_ASSOC_SLOTS,
+  TIMER_AP_SLOTS + TIMER_CLIENT_SLOTS + TIMER_ASSOC_SLOTS + TIMER_SSID_SLOTS,
+};
+
+#define TIMER_CAPACITY (TIMER_AP_SLOTS + TIMER_CLIENT_SLOTS + TIMER_ASSOC_SLOTS + TIMER_SSID_SLOTS)
+#define TIMER_SLOTS (1 << TIMER_SLOT_BITS)
+#define TIMER_SLOT_MASK (TIMER_SLOTS - 1)
+#define TIMER_LIST_DUE (TIMER_LEVELS * TIMER_SLOTS)  // Expired, waiting for budget
+#define TIMER_LIST_NONE 0xFFFF
+#define TIMER_NONE 0xFFFF
+#define TIMER_HORIZON ((uint32_t)1 << (TIMER_SLOT_BITS * TIMER_LEVELS))
+
+// ===== Wheel State =====
+typedef struct {
+  uint32_t deadline_tick;
+  uint16_t next;
+  uint16_t prev;
+  uint16_t list;  // Slot list the timer is on, TIMER_LIST_NONE if unarmed
+} TimerEntry;
+
+static TimerEntry timers[TIMER_CAPACITY];
+static uint16_t lists[TIMER_LEVELS * TIMER_SLOTS + 1];
+static uint32_t current_tick = 0;
+static int pending = 0;
+
+// ===== Helpers =====
+static inline uint16_t handleFor(TimerType type, uint16_t id) {
+  return type_base[type] + id;
+}
+
+static inline bool validHandle(TimerType type, uint16_t id) {
+  return type < TIMER_TYPES && id < type_base[type + 1] - type_base[type];
+}
+
+static TimerType typeOf(uint16_t handle) {
+  int type = 0;
+  while (handle >= type_base[type + 1]) type++;
+  return (TimerType)type;
+}
+
+static inline uint32_t tickFor(unsigned long ms) {
+  return (ms + TIMER_TICK_MS - 1) / TIMER_TICK_MS;
+}
+
+static void unlink(uint16_t h) {
+  TimerEntry& t = timers[h];
+  if (t.list == TIMER_LIST_NONE) return;
+
+  if (t.prev != TIMER_NONE) timers[t.prev].next = t.next;
+  else lists[t.list] = t.next;
+  if (t.next != TIMER_NONE) timers[t.next].prev = t.prev;
+
+  t.list = TIMER_LIST_NONE;
+  pending--;
+}
+
+static void pushList(uint16_t list, uint16_t h) {
+  TimerEntry& t = timers[h];
+  t.list = list;
+  t.prev = TIMER_NONE;
+  t.next = lists[list];
+  if (t.next != TIMER_NONE) timers[t.next].prev = h;
+  lists[list] = h;
+  pending++;
+}
+
+// Files the timer under the level whose span covers its remaining time
+static void place(uint16_t h) {
+  uint32_t deadline = timers[h].deadline_tick;
+  int32_t delta = (int32_t)(deadline - current_tick);
+
+  if (delta <= 0) {
+    pushList(TIMER_LIST_DUE, h);
+    return;
+  }
+
+  // Beyond the last level: park at the horizon and re-file on cascade
+  if ((uint32_t)delta >= TIMER_HORIZON) deadline = current_tick + TIMER_HORIZON - 1;
+
+  for (int level = 0; level < TIMER_LEVELS; level++) {
+    uint32_t span = (uint32_t)1 << (TIMER_SLOT_BITS * (level + 1));
+    if ((uint32_t)delta < span || level == TIMER_LEVELS - 1) {
+      uint32_t slot = (deadline >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK;
+      pushList(level * TIMER_SLOTS + slot, h);
+      return;
+    }
+  }
+}
+
+// Re-files every timer of one slot; they land on lower levels or the due list
+static void cascade(int level, uint32_t slot) {
+  uint16_t list = level * TIMER_SLOTS + slot;
+  uint16_t h = lists[list];
+  lists[list] = TIMER_NONE;
+
+  while (h != TIMER_NONE) {
+    uint16_t next = timers[h].next;
+    timers[h].list = TIMER_LIST_NONE;
+    pending--;
+    place(h);
+    h = next;
+  }
+}
+
+// ===== Public API =====
+void timerWheelReset(unsigned long now) {
+  for (int i = 0; i < TIMER_CAPACITY; i++) {
+    timers[i].list = TIMER_LIST_NONE;
+  }
+  for (int i = 0; i <= TIMER_LIST_DUE; i++) {
+    lists[i] = TIMER_NONE;
+  }
+  current_tick = now / TIMER_TICK_MS;
+  pending = 0;
+}
+
+void timerArm(TimerType type, uint16_t id, unsigned long deadline) {
+  if (!validHandle(type, id)) return;
+  uint16_t h = handleFor(type, id);
+  unlink(h);
+  timers[h].deadline_tick = tickFor(deadline);
+  place(h);
+}
+
+void timerCancel(TimerType type, uint16_t id) {
+  if (!validHandle(type, id)) return;
+  unlink(handleFor(type, id));
+}
+
+void timerCancelAll(TimerType type) {
+  if (type >= TIMER_TYPES) return;
+  for (uint16_t h = type_base[type]; h < type_base[type + 1]; h++) {
+    unlink(h);
+  }
+}
+
+bool timerArmed(TimerType type, uint16_t id) {
+  if (!validHandle(type, id)) return false;
+  return timers[handleFor(type, id)].list != TIMER_LIST_NONE;
+}
+
+void timerMove(TimerType type, uint16_t from, uint16_t to) {
+  if (!validHandle(type, from) || !validHandle(type, to) || from == to) return;
+  uint16_t src = handleFor(type, from);
+  uint16_t dst = handleFor(type, to);
+
+  unlink(dst);
+  if (timers[src].list == TIMER_LIST_NONE) return;
+
+  timers[dst].deadline_tick = timers[src].deadline_tick;
+  unlink(src);
+  place(dst);
+}
+
+int timerAdvance(unsigned long now, int budget) {
+  uint32_t target = now / TIMER_TICK_MS;
+  int32_t behind = (int32_t)(target - current_tick);
+
+  if (pending == 0) {
+    // Nothing armed: no slots to walk
+    current_tick = target;
+    behind = 0;
+  } else if (behind >= (int32_t)TIMER_HORIZON) {
+    // Idle for longer than the wheel spans: everything is due
+    for (int list = 0; list < TIMER_LIST_DUE; list++) {
+      current_tick = target;
+      cascade(list / TIMER_SLOTS, list % TIMER_SLOTS);
+    }
+    behind = 0;
+  }
+
+  while (behind-- > 0) {
+    current_tick++;
+
+    // Entering a new block of a level pulls that block's timers down
+    for (int level = TIMER_LEVELS - 1; level >= 1; level--) {
+      uint32_t below = current_tick & (((uint32_t)1 << (TIMER_SLOT_BITS * level)) - 1);
+      if (below == 0) {
+        cascade(level, (current_tick >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK);
+      }
+    }
+    cascade(0, current_tick & TIMER_SLOT_MASK);
+  }
+
+  int ran = 0;
+  while (ran < budget && lists[TIMER_LIST_DUE] != TIMER_NONE) {
+    uint16_t h = lists[TIMER_LIST_DUE];
+    unlink(h);
+
+    TimerType type = typeOf(h);
+    unsigned long rearm_at = 0;
+    if (handlers[type](h - type_base[type], now, &rearm_at)) {
+      timers[h].deadline_tick = tickFor(rearm_at);
+      if ((int32_t)(timers[h].deadline_tick - current_tick) <= 0) {
+        timers[h].deadline_tick = current_tick + 1;
+      }
+      place(h);
+    }
+    ran++;
+  }
+  return ran;
+}
+
+int timerPending() {
+  return pending;
+}
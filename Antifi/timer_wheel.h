@@ -0,0 +1,65 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+// Also builds on the host (CLI/timer_wheel_test.cpp), where there is no Arduino core
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#endif
+
+// ===== Configuration Constants =====
+#define TIMER_TICK_MS 250     // Wheel resolution
+#define TIMER_SLOT_BITS 6     // 64 slots per level
+#define TIMER_LEVELS 3        // 16 s, 17 min and 18 h horizons
+#define TIMER_BUDGET 8        // Expiry handlers run per timerAdvance() call
+
+// ===== Record Types =====
+// Every aged scan record registers under its type and table index
+enum TimerType : uint8_t {
+  TIMER_AP,      // aps[] slot
+  TIMER_CLIENT,  // client_list slot
+  TIMER_ASSOC,   // Association graph edge
+  TIMER_SSID,    // Interned SSID ID
+  TIMER_TYPES
+};
+
+// ===== Hierarchical Timer Wheel =====
+// Records are armed once with a deadline and never touched again when they
+// are refreshed. When the deadline comes up the type's handler checks the
+// record's real last-seen time and either re-arms it or drops the record, so
+// expiry costs O(expired) and a refresh costs nothing.
+//
+// Handlers (defined next to each record type):
+//   bool handler(uint16_t id, unsigned long now, unsigned long* rearm_at)
+// return true with *rearm_at set if the record is still live.
+//
+// Driven from the RX callback, which owns all scan records, a few expiries
+// per frame so the work is spread out instead of done in sweeps. When no
+// frames arrive scan_loop() advances it with millis() instead, holding the
+// scan subscription so the callback cannot run meanwhile.
+
+// Empties every list; scanBegin() runs it before the first record is armed
+void timerWheelReset(unsigned long now);
+
+// Schedules (or reschedules) the record's expiry check
+void timerArm(TimerType type, uint16_t id, unsigned long deadline);
+
+void timerCancel(TimerType type, uint16_t id);
+
+// Cancels every timer of one type (its table was cleared)
+void timerCancelAll(TimerType type);
+
+bool timerArmed(TimerType type, uint16_t id);
+
+// Hands the timer of record `from` to record `to` (for swap-with-last removal)
+void timerMove(TimerType type, uint16_t from, uint16_t to);
+
+// Advances the wheel to `now` and runs up to `budget` due handlers.
+// Returns how many handlers ran.
+int timerAdvance(unsigned long now, int budget = TIMER_BUDGET);
+
+// Armed timers (all types)
+int timerPending();
+
+#endif  // TIMER_WHEEL_H
@@ -0,0 +1,135 @@
+#include "top_talkers.h"
+#include "rx_bus.h"
+#include "scan.h"
+#include "sketch.h"
+
+// ===== Trackers =====
+// Written by the RX callback; the report copies a channel under its seqlock
+typedef SpaceSaving<TOP_TALKERS_K, 6> TalkerTable;
+typedef SpaceSaving<TOP_TALKERS_K, 12> PairTable;
+
+typedef struct {
+  uint32_t seq;
+  TalkerTable talkers;
+  PairTable pairs;
+} ChannelTop;
+
+static ChannelTop channels[15];  // [0] unused
+static int top_rx = -1;
+static unsigned long started_ms = 0;
+
+// ===== RX Path =====
+static void onFrame(const RxFrame& rx) {
+  const FrameView& f = rx.view;
+  if (!f.ta || f.channel < 1 || f.channel > 14) return;
+
+  // Real endpoints where the frame names them, the radio hop otherwise
+  const uint8_t* src = f.sa ? f.sa : f.ta;
+  const uint8_t* dst = f.da ? f.da : f.ra;
+
+  ChannelTop& c = channels[f.channel];
+  seqWriteBegin(c.seq);
+  c.talkers.offer(f.ta, macHash64(f.ta), f.len);
+  if (dst) {
+    uint8_t pair[12];
+    memcpy(pair, src, 6);
+    memcpy(pair + 6, dst, 6);
+    c.pairs.offer(pair, macHash64(src) ^ (macHash64(dst) >> 7), f.len);
+  }
+  seqWriteEnd(c.seq);
+}
+
+// ===== Control =====
+bool topTalkersStart() {
+  if (top_rx >= 0) return true;
+  RxSubscription sub = { "top", RX_PKT_MGMT | RX_PKT_DATA | RX_PKT_CTRL, RX_KEYS_ALL, -128, false, onFrame };
+  top_rx = rxBusSubscribe(sub);
+  if (top_rx < 0) return false;
+  started_ms = millis();
+  return true;
+}
+
+void topTalkersStop() {
+  rxBusUnsubscribe(top_rx);
+  top_rx = -1;
+}
+
+bool topTalkersActive() {
+  return top_rx >= 0;
+}
+
+void topTalkersReset() {
+  for (auto& c : channels) {
+    seqWriteBegin(c.seq);
+    c.talkers.clear();
+    c.pairs.clear();
+    seqWriteEnd(c.seq);
+  }
+  started_ms = millis();
+}
+
+// ===== Report =====
+// Copies one channel consistently; false if the RX path kept rewriting it
+static bool snapshot(int ch, ChannelTop* out) {
+  const ChannelTop& c = channels[ch];
+  for (int attempt = 0; attempt < SEQLOCK_READ_RETRIES; attempt++) {
+    uint32_t start = seqReadBegin(c.seq);
+    memcpy(out, &c, sizeof(ChannelTop));
+    if (!seqReadRetry(c.seq, start)) return true;
+  }
+  return false;
+}
+
+static void printShare(uint32_t count, uint32_t total) {
+  Serial.printf("%5.1f%%", total ? 100.0f * count / total : 0.0f);
+}
+
+static void printChannel(int ch, const ChannelTop& c, int rows) {
+  uint32_t total = c.talkers.frames();
+  Serial.printf("\nChannel %d: %lu frames, %llu bytes | any key above %lu frames is listed\n", ch,
+                (unsigned long)total, (unsigned long long)c.talkers.bytes(), (unsigned long)(total / TOP_TALKERS_K));
+
+  Serial.println("  Transmitter       | Frames (-error)      | Share  | Bytes (min)");
+  for (int i = 0; i < c.talkers.size() && i < rows; i++) {
+    const TalkerTable::Entry& e = c.talkers.at(i);
+    char mac[18];
+    formatMAC(e.key, mac);
+    Serial.printf("  %s | %9lu (-%7lu) | ", mac, (unsigned long)e.count, (unsigned long)e.error);
+    printShare(e.count, total);
+    Serial.printf(" | %lu\n", (unsigned long)e.bytes);
+  }
+
+  Serial.println("  Source            -> Destination       | Frames (-error)      | Share  | Bytes (min)");
+  for (int i = 0; i < c.pairs.size() && i < rows; i++) {
+    const PairTable::Entry& e = c.pairs.at(i);
+    char src[18], dst[18];
+    formatMAC(e.key, src);
+    formatMAC(e.key + 6, dst);
+    Serial.printf("  %s -> %s | %9lu (-%7lu) | ", src, dst, (unsigned long)e.count, (unsigned long)e.error);
+    printShare(e.count, c.pairs.frames());
+    Serial.printf(" | %lu\n", (unsigned long)e.bytes);
+  }
+}
+
+void topTalkersReport(int channel) {
+  static ChannelTop copy;  // ~1 KB; keep it off the loop task stack
+
+  Serial.println("\n=== TOP TALKERS (Space-Saving) ===");
+  Serial.printf("Tracking: %s | Channel now: %u | %lu s | %d counters per channel\n",
+                top_rx >= 0 ? "on" : "off", rxBusChannel(), (millis() - started_ms) / 1000, TOP_TALKERS_K);
+  Serial.println("True frames lie in [frames - error, frames]; bytes count from when the key entered");
+
+  int first = channel ? channel : 1;
+  int last = channel ? channel : 14;
+  int shown = 0;
+  for (int ch = first; ch <= last; ch++) {
+    if (!snapshot(ch, &copy)) {
+      Serial.printf("\nChannel %d: busy, try again\n", ch);
+      continue;
+    }
+    if (copy.talkers.frames() == 0) continue;
+    printChannel(ch, copy, channel ? TOP_TALKERS_K : TOP_TALKERS_SHOWN);
+    shown++;
+  }
+  if (!shown) Serial.println("No frames counted yet");
+}
@@ -0,0 +1,23 @@
+#ifndef TOP_TALKERS_H
+#define TOP_TALKERS_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define TOP_TALKERS_K 16        // Counters per channel and key kind
+#define TOP_TALKERS_SHOWN 5     // Rows per channel in the summary
+
+// ===== Top Talkers =====
+// Space-Saving heavy hitters per channel, keyed by transmitter and by
+// (source, destination) pair, counting frames and bytes. Runs as an RX bus
+// subscriber without a channel claim, so it follows whatever is driving the
+// radio (scan or sniff hopping) and costs nothing per device.
+bool topTalkersStart();
+void topTalkersStop();
+bool topTalkersActive();
+void topTalkersReset();
+
+// Every channel with traffic, or one channel in full (1-14)
+void topTalkersReport(int channel = 0);
+
+#endif  // TOP_TALKERS_H
@@ -0,0 +1,274 @@
+#include "wids.h"
+#include <stdio.h>
+#include "sketch.h"
+
+#define MGMT_PROBE_RESPONSE 0x05
+#define MGMT_BEACON 0x08
+#define MGMT_DISASSOC 0x0A
+#define MGMT_DEAUTH 0x0C
+#define BEACON_FIXED_LEN 12  // Timestamp, interval, capability
+
+// ===== Detector State =====
+// Written by the RX callback only; the loop reads stats and drains alerts
+static WidsConfig config = { WIDS_DEAUTH_PER_SEC, WIDS_NEW_BSSIDS_PER_SEC, WIDS_BSSIDS_PER_SSID, WIDS_COOLDOWN_MS };
+static WidsStats stats;
+
+static SlidingCountMin<WIDS_RATE_WIDTH, WIDS_RATE_DEPTH> kill_rate;  // Deauth + disassoc by key
+
+// Seen-sets for this epoch and the last one
+static BloomFilter<WIDS_SEEN_BITS, WIDS_SEEN_HASHES> seen_bssids[2];
+static BloomFilter<WIDS_SEEN_BITS, WIDS_SEEN_HASHES> seen_pairs[2];
+static CountMin<WIDS_SSID_WIDTH, WIDS_SSID_DEPTH> ssid_bssids;  // This epoch
+static uint8_t epoch_cur = 0;
+static uint32_t epoch_start = 0;
+static uint32_t learn_until = 0;
+
+// New BSSIDs per second: the same two-window estimate, unkeyed
+static uint32_t new_cur = 0;
+static uint32_t new_prev = 0;
+static uint32_t new_start = 0;
+
+typedef struct {
+  uint32_t key;
+  uint32_t until;
+} Cooldown;
+
+static Cooldown cooldowns[WIDS_COOLDOWN_SLOTS];
+
+// Alert ring: RX callback produces, loop() consumes
+static WidsAlert ring[WIDS_ALERT_RING];
+static uint32_t ring_head = 0;
+static uint32_t ring_tail = 0;
+
+static const char* const alert_names[] = {
+  "deauth_flood", "disassoc_flood", "beacon_flood", "ssid_bssids",
+};
+
+// ===== Keys =====
+// (subtype, TA, BSSID) in one hash
+static inline uint64_t killKey(uint8_t subtype, const uint8_t* ta, const uint8_t* bssid) {
+  return hashMix64(macHash64(ta) ^ (macHash64(bssid) << 1) ^ subtype);
+}
+
+// ===== Alerts =====
+static bool coolingDown(uint32_t key, uint32_t now) {
+  int oldest = 0;
+  for (int i = 0; i < WIDS_COOLDOWN_SLOTS; i++) {
+    Cooldown& c = cooldowns[i];
+    if (c.key == key && (int32_t)(c.until - now) > 0) return true;
+    if ((int32_t)(c.until - cooldowns[oldest].until) < 0) oldest = i;
+  }
+  cooldowns[oldest].key = key;
+  cooldowns[oldest].until = now + config.cooldown_ms;
+  return false;
+}
+
+static void raiseAlert(const WidsAlert& a, uint64_t key) {
+  if (coolingDown((uint32_t)(key ^ (key >> 32)) ^ a.type, a.ms)) {
+    stats.suppressed++;
+    return;
+  }
+  stats.alerts[a.type]++;
+
+  uint32_t head = ring_head;
+  if (head - __atomic_load_n(&ring_tail, __ATOMIC_ACQUIRE) >= WIDS_ALERT_RING) {
+    stats.dropped++;
+    return;
+  }
+  ring[head & (WIDS_ALERT_RING - 1)] = a;
+  __atomic_store_n(&ring_head, head + 1, __ATOMIC_RELEASE);
+}
+
+static void newAlert(WidsAlert* a, uint8_t type, const FrameView& f, uint32_t now, uint32_t value, uint32_t limit) {
+  memset(a, 0, sizeof(*a));
+  a->ms = now;
+  a->type = type;
+  a->channel = f.channel;
+  a->value = value;
+  a->limit = limit;
+}
+
+// ===== Detectors =====
+static void detectKill(const FrameView& f, uint32_t now) {
+  if (f.subtype == MGMT_DEAUTH) stats.deauths++;
+  else stats.disassocs++;
+  if (!config.deauth_per_sec || !f.ta || !f.bssid) return;
+
+  uint64_t key = killKey(f.subtype, f.ta, f.bssid);
+  uint32_t rate = kill_rate.add(key, now);
+  if (rate <= config.deauth_per_sec) return;
+
+  WidsAlert a;
+  newAlert(&a, f.subtype == MGMT_DEAUTH ? WIDS_DEAUTH_FLOOD : WIDS_DISASSOC_FLOOD, f, now, rate,
+           config.deauth_per_sec);
+  memcpy(a.ta, f.ta, 6);
+  memcpy(a.bssid, f.bssid, 6);
+  raiseAlert(a, key);
+}
+
+static void rotateEpoch(uint32_t now) {
+  if (now - epoch_start < WIDS_EPOCH_MS) return;
+  epoch_cur ^= 1;
+  seen_bssids[epoch_cur].clear();
+  seen_pairs[epoch_cur].clear();
+  ssid_bssids.clear();
+  epoch_start = now;
+}
+
+static uint32_t countNewBssid(uint32_t now) {
+  uint32_t elapsed = now - new_start;
+  if (elapsed >= 2000) {
+    new_prev = 0;
+    new_cur = 0;
+    new_start = now;
+    elapsed = 0;
+  } else if (elapsed >= 1000) {
+    new_prev = new_cur;
+    new_cur = 0;
+    new_start += 1000;
+    elapsed -= 1000;
+  }
+  new_cur++;
+  return new_cur + new_prev * (1000 - elapsed) / 1000;
+}
+
+// SSID element, or length 0 for a hidden / blanked one
+static uint8_t beaconSSID(const FrameView& f, const uint8_t** ssid) {
+  if (f.body_len < BEACON_FIXED_LEN + 2) return 0;
+  const uint8_t* ie = f.body + BEACON_FIXED_LEN;
+  uint8_t len = ie[1];
+  if (ie[0] != 0 || len == 0 || len > 32 || BEACON_FIXED_LEN + 2 + len > f.body_len) return 0;
+  for (uint8_t i = 0; i < len; i++) {
+    if (ie[2 + i]) {
+      *ssid = ie + 2;
+      return len;
+    }
+  }
+  return 0;
+}
+
+static void detectBeacon(const FrameView& f, uint32_t now) {
+  if (!f.bssid) return;
+  stats.beacons++;
+  rotateEpoch(now);
+
+  uint64_t bh = macHash64(f.bssid);
+  if (!seen_bssids[epoch_cur].mayContainHash(bh)) {
+    bool known = seen_bssids[epoch_cur ^ 1].mayContainHash(bh);
+    seen_bssids[epoch_cur].addHash(bh);
+    if (!known && f.subtype == MGMT_BEACON) {
+      stats.new_bssids++;
+      uint32_t rate = countNewBssid(now);
+      if (config.new_bssids_per_sec && rate > config.new_bssids_per_sec && (int32_t)(now - learn_until) >= 0) {
+        WidsAlert a;
+        newAlert(&a, WIDS_BEACON_FLOOD, f, now, rate, config.new_bssids_per_sec);
+        memcpy(a.bssid, f.bssid, 6);
+        raiseAlert(a, f.channel);  // One beacon flood alert per channel per cooldown
+      }
+    }
+  }
+
+  const uint8_t* ssid;
+  uint8_t ssid_len = beaconSSID(f, &ssid);
+  if (!ssid_len || !config.bssids_per_ssid) return;
+
+  uint64_t sh = bytesHash64(ssid, ssid_len);
+  uint64_t pair = hashMix64(sh ^ bh);
+  if (seen_pairs[epoch_cur].mayContainHash(pair)) return;
+  seen_pairs[epoch_cur].addHash(pair);
+
+  uint32_t count = ssid_bssids.add(sh);
+  if (count <= config.bssids_per_ssid) return;
+
+  WidsAlert a;
+  newAlert(&a, WIDS_SSID_BSSIDS, f, now, count, config.bssids_per_ssid);
+  memcpy(a.bssid, f.bssid, 6);
+  memcpy(a.ssid, ssid, ssid_len);
+  a.ssid_len = ssid_len;
+  raiseAlert(a, sh);
+}
+
+// ===== Public API =====
+void widsReset(uint32_t now) {
+  memset(&stats, 0, sizeof(stats));
+  memset(cooldowns, 0, sizeof(cooldowns));
+  for (auto& c : cooldowns) c.until = now;
+  kill_rate.reset(now);
+  seen_bssids[0].clear();
+  seen_bssids[1].clear();
+  seen_pairs[0].clear();
+  seen_pairs[1].clear();
+  ssid_bssids.clear();
+  epoch_start = now;
+  learn_until = now + WIDS_LEARN_MS;
+  new_cur = new_prev = 0;
+  new_start = now;
+  __atomic_store_n(&ring_tail, __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+WidsConfig& widsConfig() {
+  return config;
+}
+
+const WidsStats& widsStats() {
+  return stats;
+}
+
+void widsFrame(const FrameView& f, uint32_t now) {
+  stats.frames++;
+  if (f.type != 0) return;
+
+  switch (f.subtype) {
+    case MGMT_DEAUTH:
+    case MGMT_DISASSOC:
+      detectKill(f, now);
+      break;
+    case MGMT_BEACON:
+    case MGMT_PROBE_RESPONSE:
+      detectBeacon(f, now);
+      break;
+    default:
+      break;
+  }
+}
+
+bool widsNextAlert(WidsAlert* out) {
+  uint32_t tail = ring_tail;
+  if (tail == __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE)) return false;
+  *out = ring[tail & (WIDS_ALERT_RING - 1)];
+  __atomic_store_n(&ring_tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+const char* widsAlertName(uint8_t type) {
+  return type < WIDS_ALERT_TYPES ? alert_names[type] : "?";
+}
+
+static int formatMac(char* out, size_t room, const char* name, const uint8_t* mac) {
+  return snprintf(out, room, ",\"%s\":\"%02X:%02X:%02X:%02X:%02X:%02X\"", name, mac[0], mac[1], mac[2], mac[3],
+                  mac[4], mac[5]);
+}
+
+int widsFormatAlert(const WidsAlert& a, char* out, size_t room) {
+  static const uint8_t zero[6] = {};
+  int n = snprintf(out, room, "{\"wids\":\"%s\",\"ms\":%lu,\"ch\":%u", widsAlertName(a.type),
+                   (unsigned long)a.ms, a.channel);
+  if (memcmp(a.ta, zero, 6)) n += formatMac(out + n, room - n, "ta", a.ta);
+  n += formatMac(out + n, room - n, "bssid", a.bssid);
+  if (a.ssid_len) {
+    n += snprintf(out + n, room - n, ",\"ssid\":\"");
+    for (uint8_t i = 0; i < a.ssid_len && (size_t)n + 8 < room; i++) {
+      uint8_t c = (uint8_t)a.ssid[i];
+      if (c == '"' || c == '\\') n += snprintf(out + n, room - n, "\\%c", c);
+      else if (c < 0x20 || c >= 0x7F) n += snprintf(out + n, room - n, "\\u%04x", c);
+      else out[n++] = c;
+    }
+    n += snprintf(out + n, room - n, "\"");
+  }
+  n += snprintf(out + n, room - n, ",\"value\":%lu,\"limit\":%lu}", (unsigned long)a.value, (unsigned long)a.limit);
+  return n;
+}
+
+size_t widsMemory() {
+  return kill_rate.bytes() + 2 * seen_bssids[0].bytes() + 2 * seen_pairs[0].bytes() + ssid_bssids.bytes();
+}
@@ -0,0 +1,94 @@
+#ifndef WIDS_H
+#define WIDS_H
+
+#include "frame_view.h"
+
+// ===== Configuration Constants =====
+#define WIDS_ALERT_RING 16       // Queued alerts (power of two)
+#define WIDS_COOLDOWN_SLOTS 16   // Recently raised alerts remembered for the cooldown
+#define WIDS_RATE_WIDTH 256      // Count-min cells per row
+#define WIDS_RATE_DEPTH 4
+#define WIDS_SEEN_BITS 8192      // Bloom filter bits per epoch (BSSIDs, SSID/BSSID pairs)
+#define WIDS_SEEN_HASHES 4
+#define WIDS_SSID_WIDTH 256      // Count-min cells per row for BSSIDs per SSID
+#define WIDS_SSID_DEPTH 3
+
+// ===== Detector Defaults =====
+#define WIDS_DEAUTH_PER_SEC 20   // Deauth or disassoc frames per (type, TA, BSSID)
+#define WIDS_NEW_BSSIDS_PER_SEC 60
+#define WIDS_BSSIDS_PER_SSID 6   // Distinct BSSIDs advertising one SSID per epoch
+#define WIDS_LEARN_MS 10000      // No beacon flood alerts while the first BSSIDs come in
+#define WIDS_EPOCH_MS 60000      // Seen-sets rotate; a BSSID is "new" if unseen for an epoch
+#define WIDS_COOLDOWN_MS 10000   // The same alert is not raised again within this
+
+// ===== Wireless Intrusion Detection =====
+// Constant memory and constant work per frame: count-min sketches give
+// per-key rates over a sliding one-second window, keyed by (subtype,
+// transmitter, BSSID); two rotating Bloom filters remember which BSSIDs and
+// SSID/BSSID pairs were seen in the last epoch or two.
+//
+//   deauth_flood / disassoc_flood  one (type, TA, BSSID) above the rate
+//   beacon_flood                   new BSSIDs per second above the rate
+//   ssid_bssids                    one SSID advertised by more BSSIDs than allowed
+//
+// The core is plain C++ with the time passed in, so the same code runs in
+// the RX callback and on the host (CLI/wids_replay.cpp replays captures).
+enum WidsAlertType : uint8_t {
+  WIDS_DEAUTH_FLOOD,
+  WIDS_DISASSOC_FLOOD,
+  WIDS_BEACON_FLOOD,
+  WIDS_SSID_BSSIDS,
+  WIDS_ALERT_TYPES,
+};
+
+typedef struct {
+  uint32_t ms;
+  uint8_t type;      // WidsAlertType
+  uint8_t channel;
+  uint8_t ta[6];     // Transmitter (zero for beacon floods)
+  uint8_t bssid[6];
+  uint32_t value;    // Rate (frames/s, BSSIDs/s) or BSSID count
+  uint32_t limit;    // Threshold it crossed
+  uint8_t ssid_len;
+  char ssid[32];
+} WidsAlert;
+
+typedef struct {
+  uint16_t deauth_per_sec;     // 0 disables each detector
+  uint16_t new_bssids_per_sec;
+  uint16_t bssids_per_ssid;
+  uint32_t cooldown_ms;
+} WidsConfig;
+
+typedef struct {
+  uint32_t frames;
+  uint32_t deauths;
+  uint32_t disassocs;
+  uint32_t beacons;
+  uint32_t new_bssids;
+  uint32_t alerts[WIDS_ALERT_TYPES];
+  uint32_t suppressed;  // Within the cooldown
+  uint32_t dropped;     // Alert ring full
+} WidsStats;
+
+// Forgets everything learned; detection starts learning again at `now`
+void widsReset(uint32_t now);
+
+WidsConfig& widsConfig();
+const WidsStats& widsStats();
+
+// Feeds one decoded frame (RX callback)
+void widsFrame(const FrameView& f, uint32_t now);
+
+// Takes the oldest queued alert; false if there is none (loop() side)
+bool widsNextAlert(WidsAlert* out);
+
+const char* widsAlertName(uint8_t type);
+
+// One compact JSON line, no newline; returns the length
+int widsFormatAlert(const WidsAlert& a, char* out, size_t room);
+
+// Sketch and filter memory in bytes
+size_t widsMemory();
+
+#endif  // WIDS_H
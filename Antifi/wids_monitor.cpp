@@ -0,0 +1,71 @@
+#include "wids_monitor.h"
+#include "rx_bus.h"
+#include "wids.h"
+
+static int wids_rx = -1;
+static unsigned long started_ms = 0;
+
+// Frames arrive decoded and filtered to the management subtypes below
+static void onFrame(const RxFrame& rx) {
+  widsFrame(rx.view, millis());
+}
+
+bool widsMonitorStart() {
+  if (wids_rx >= 0) return true;
+
+  RxSubscription sub = { "wids", RX_PKT_MGMT,
+                         FRAME_BIT(0, 0x05) | FRAME_BIT(0, 0x08) | FRAME_BIT(0, 0x0A) | FRAME_BIT(0, 0x0C), -128,
+                         false, onFrame };
+  started_ms = millis();
+  widsReset(started_ms);
+  wids_rx = rxBusSubscribe(sub);
+  return wids_rx >= 0;
+}
+
+void widsMonitorStop() {
+  rxBusUnsubscribe(wids_rx);
+  wids_rx = -1;
+}
+
+bool widsMonitorActive() {
+  return wids_rx >= 0;
+}
+
+void widsMonitorLoop() {
+  WidsAlert a;
+  char line[400];
+  for (int i = 0; i < WIDS_DRAIN_BUDGET && widsNextAlert(&a); i++) {
+    widsFormatAlert(a, line, sizeof(line));
+    Serial.println(line);
+  }
+}
+
+bool widsMonitorSetThreshold(const String& name, long value) {
+  if (value < 0 || value > 65535) return false;
+  WidsConfig& c = widsConfig();
+  if (name == "deauth") c.deauth_per_sec = value;
+  else if (name == "beacons") c.new_bssids_per_sec = value;
+  else if (name == "ssid") c.bssids_per_ssid = value;
+  else return false;
+  return true;
+}
+
+void widsMonitorReport() {
+  const WidsConfig& c = widsConfig();
+  const WidsStats& s = widsStats();
+
+  Serial.println("\n=== WIDS ===");
+  Serial.printf("Monitoring: %s | Channel: %u | %lu s | Sketch memory: %u bytes\n", wids_rx >= 0 ? "on" : "off",
+                rxBusChannel(), wids_rx >= 0 ? (millis() - started_ms) / 1000 : 0UL, (unsigned)widsMemory());
+  Serial.printf("Thresholds (0 = off): deauth/disassoc %u/s per (TA, BSSID) | new BSSIDs %u/s | "
+                "BSSIDs per SSID %u | Cooldown: %lu s\n",
+                c.deauth_per_sec, c.new_bssids_per_sec, c.bssids_per_ssid, (unsigned long)(c.cooldown_ms / 1000));
+  Serial.printf("Frames: %lu | Deauth: %lu | Disassoc: %lu | Beacons/responses: %lu | New BSSIDs: %lu\n",
+                (unsigned long)s.frames, (unsigned long)s.deauths, (unsigned long)s.disassocs,
+                (unsigned long)s.beacons, (unsigned long)s.new_bssids);
+  Serial.print("Alerts:");
+  for (int t = 0; t < WIDS_ALERT_TYPES; t++) {
+    Serial.printf(" %s %lu |", widsAlertName(t), (unsigned long)s.alerts[t]);
+  }
+  Serial.printf(" suppressed %lu | dropped %lu\n", (unsigned long)s.suppressed, (unsigned long)s.dropped);
+}
@@ -0,0 +1,21 @@
+#ifndef WIDS_MONITOR_H
+#define WIDS_MONITOR_H
+
+#include <Arduino.h>
+
+// ===== Configuration Constants =====
+#define WIDS_DRAIN_BUDGET 4  // Alerts printed per loop() pass
+
+// ===== WIDS Monitor =====
+// Runs the detectors in wids.h as an RX bus subscriber (management frames,
+// no channel claim) and prints each alert as one JSON line from loop().
+bool widsMonitorStart();
+void widsMonitorStop();
+bool widsMonitorActive();
+void widsMonitorLoop();
+void widsMonitorReport();
+
+// "deauth", "beacons" or "ssid"; 0 disables the detector
+bool widsMonitorSetThreshold(const String& name, long value);
+
+#endif  // WIDS_MONITOR_H
@@ -0,0 +1,175 @@
+/*
+ * Replays the beacons of a PCAPNG capture through the scan's beacon change
+ * detection (beacon_hash.h) on the host and reports how many would skip IE
+ * parsing.
+ *
+ * Build from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/beacon_replay.cpp -o beacon_replay
+ *
+ * Usage:
+ *     ./beacon_replay capture.pcapng [-n] [-v]
+ *
+ * Every BSSID keeps the hash of its last parsed beacon, as APInfo does, and
+ * a beacon with the same hash counts as skipped. Hashes are seeded with WPS
+ * detection on, the scan's default; -n turns it off. Unlike the device, the
+ * replay never recycles a record, so captures with more than MAX_APS
+ * beaconing BSSIDs skip a little more here than on the device.
+ *
+ * Parsed beacons are split into the first one of each AP and those whose
+ * body changed. For the changes, the elements that differ from the AP's
+ * previous parsed beacon are tallied (vendor elements by OUI and type), so
+ * a low skip rate can be traced to the element that churns. -v adds a row
+ * per AP.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "beacon_hash.h"
+#include "frame_view.h"
+#include "pcapng.h"
+
+typedef struct {
+  uint32_t hash;
+  std::vector<uint8_t> body;  // From the capability field on, last parsed beacon
+  uint32_t beacons;
+  uint32_t parsed;
+  char ssid[33];
+} BeaconAP;
+
+static std::map<uint64_t, BeaconAP> aps;
+static std::map<std::string, uint32_t> changed_elements;
+static uint32_t beacons = 0, first_seen = 0, changed = 0, skipped = 0;
+
+static uint64_t macKey(const uint8_t* mac) {
+  uint64_t key = 0;
+  for (int i = 0; i < 6; i++) key = (key << 8) | mac[i];
+  return key;
+}
+
+// Contents of the hashed elements by name; TIM and BSS Load differ every
+// time and never count
+static void splitElements(const std::vector<uint8_t>& body, std::map<std::string, std::string>& out) {
+  char name[32];
+  if (body.size() >= 2) out["capability"] = std::string((const char*)body.data(), 2);
+  for (size_t pos = 2; pos + 2 <= body.size();) {
+    uint8_t id = body[pos];
+    size_t size = 2 + body[pos + 1];
+    if (pos + size > body.size()) break;
+    if (id == BEACON_ELEMENT_TIM || id == BEACON_ELEMENT_BSS_LOAD) {
+      pos += size;
+      continue;
+    }
+    if (id == 221 && size >= 6) {
+      snprintf(name, sizeof(name), "221 (%02X%02X%02X/%u)", body[pos + 2], body[pos + 3], body[pos + 4],
+               body[pos + 5]);
+    } else {
+      snprintf(name, sizeof(name), "%u", id);
+    }
+    out[name].append((const char*)&body[pos + 2], size - 2);
+    pos += size;
+  }
+}
+
+static void tallyChanges(const std::vector<uint8_t>& before, const std::vector<uint8_t>& after) {
+  std::map<std::string, std::string> a, b;
+  splitElements(before, a);
+  splitElements(after, b);
+  for (std::map<std::string, std::string>::iterator it = b.begin(); it != b.end(); ++it) {
+    std::map<std::string, std::string>::iterator old = a.find(it->first);
+    if (old == a.end() || old->second != it->second) changed_elements[it->first]++;
+  }
+  for (std::map<std::string, std::string>::iterator it = a.begin(); it != a.end(); ++it) {
+    if (!b.count(it->first)) changed_elements[it->first]++;
+  }
+}
+
+// Same decision as updateAPInfo(): a zero hash always parses
+static void replayBeacon(const FrameView& f, uint32_t seed) {
+  beacons++;
+  BeaconAP& ap = aps[macKey(f.bssid)];
+  ap.beacons++;
+  uint32_t hash = beaconBodyHash(f.frame, f.len, seed);
+  if (hash != 0 && hash == ap.hash) {
+    skipped++;
+    return;
+  }
+
+  std::vector<uint8_t> body;
+  if (f.len > BEACON_CAPABILITY_OFFSET) body.assign(f.frame + BEACON_CAPABILITY_OFFSET, f.frame + f.len);
+  if (ap.parsed == 0) {
+    first_seen++;
+    uint8_t ssid_len = 0;
+    if (body.size() >= 4 && body[2] == 0) ssid_len = body[3] > 32 ? 32 : body[3];
+    if (4u + ssid_len > body.size()) ssid_len = 0;
+    memcpy(ap.ssid, body.data() + 4, ssid_len);
+    ap.ssid[ssid_len] = '\0';
+  } else {
+    changed++;
+    tallyChanges(ap.body, body);
+  }
+  ap.hash = hash;
+  ap.body.swap(body);
+  ap.parsed++;
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: beacon_replay <capture.pcapng> [-n] [-v]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) usage();
+  const char* path = argv[1];
+  uint32_t seed = 1;
+  bool verbose = false;
+  for (int i = 2; i < argc; i++) {
+    if (!strcmp(argv[i], "-n")) seed = 0;
+    else if (!strcmp(argv[i], "-v")) verbose = true;
+    else usage();
+  }
+
+  PcapReader reader;
+  if (!pcapOpen(&reader, path)) return 1;
+  PcapFrame pf;
+  while (pcapNext(&reader, &pf, 0)) {
+    FrameView f;
+    if (!frameDecode(pf.frame, pf.len, 0, pf.channel, &f)) continue;
+    if (f.key == FRAME_KEY(0, 8) && f.bssid) replayBeacon(f, seed);
+  }
+  pcapClose(&reader);
+  if (reader.bad) return 1;
+  if (beacons == 0) {
+    fprintf(stderr, "%s: no beacons\n", path);
+    return 1;
+  }
+
+  uint32_t parsed = first_seen + changed;
+  printf("%s: %u beacons from %u APs\n", path, beacons, (unsigned)aps.size());
+  printf("parsed  %8u (%5.1f%%) | %u first of an AP | %u changed\n", parsed, parsed * 100.0 / beacons, first_seen,
+         changed);
+  printf("skipped %8u (%5.1f%%)\n", skipped, skipped * 100.0 / beacons);
+
+  if (!changed_elements.empty()) {
+    printf("elements behind the changes:\n");
+    for (std::map<std::string, uint32_t>::iterator it = changed_elements.begin(); it != changed_elements.end();
+         ++it) {
+      printf("  %-20s %8u\n", it->first.c_str(), it->second);
+    }
+  }
+
+  if (verbose) {
+    printf("%-17s  %-32s %8s %8s %8s\n", "BSSID", "SSID", "beacons", "parsed", "skipped");
+    for (std::map<uint64_t, BeaconAP>::iterator it = aps.begin(); it != aps.end(); ++it) {
+      const BeaconAP& ap = it->second;
+      uint64_t k = it->first;
+      printf("%02X:%02X:%02X:%02X:%02X:%02X  %-32s %8u %8u %7.1f%%\n", (unsigned)(k >> 40) & 0xFF,
+             (unsigned)(k >> 32) & 0xFF, (unsigned)(k >> 24) & 0xFF, (unsigned)(k >> 16) & 0xFF,
+             (unsigned)(k >> 8) & 0xFF, (unsigned)k & 0xFF, ap.ssid, ap.beacons, ap.parsed,
+             (ap.beacons - ap.parsed) * 100.0 / ap.beacons);
+    }
+  }
+  return 0;
+}
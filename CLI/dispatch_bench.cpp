@@ -0,0 +1,205 @@
+/*
+ * Measures the per-frame cost of the scan's frame decode and table dispatch
+ * (frame_view.h) by replaying a PCAPNG capture on the host.
+ *
+ * Build from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/dispatch_bench.cpp -o dispatch_bench
+ *
+ * Usage:
+ *     ./dispatch_bench capture.pcapng [-n passes]
+ *
+ * The capture is loaded into memory and replayed `passes` times (default:
+ * enough for about a second per row). The analyzers are registered for the
+ * same keys as the scan's passive and enhanced tables but only fold a few
+ * header bytes into a checksum, so the figures are the decode and dispatch
+ * overhead the scan adds before its own work. A hand-written switch over
+ * type/subtype with the passive registrations is the baseline. Cycles come
+ * from the TSC on x86 (reference cycles, not core cycles) and are left out
+ * elsewhere; `scan perf` gives the device figures for the full path.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "frame_view.h"
+#include "pcapng.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+#define TARGET_NS 1000000000ULL  // Row length when -n is not given
+
+// Frame type/subtype values, as scan.h names them
+#define MGMT 0
+#define DATA 2
+#define PROBE_REQUEST 4
+#define PROBE_RESPONSE 5
+#define BEACON 8
+
+typedef struct {
+  uint32_t offset;
+  uint16_t len;
+  uint8_t channel;
+} StoredFrame;
+
+static std::vector<uint8_t> bytes;
+static std::vector<StoredFrame> frames;
+
+// ===== Stand-in Analyzers =====
+static volatile uint32_t sink;
+static uint32_t checksum = 0;
+
+#define ANALYZER(name, salt)                                     \
+  __attribute__((noinline)) static void name(const FrameView& f) { \
+    checksum += f.key * (salt) + (f.bssid ? f.bssid[5] : 0);     \
+  }
+
+ANALYZER(countFrame, 1)
+ANALYZER(analyzeBeacon, 3)
+ANALYZER(analyzeProbeResponse, 5)
+ANALYZER(analyzeProbeRequest, 7)
+ANALYZER(analyzeAPFrameEnhanced, 11)
+ANALYZER(processClientFrame, 13)
+
+// ===== Tables =====
+// Same registrations as scan.cpp
+#define MGMT_FRAMES FRAME_BITS_OF_TYPE(MGMT)
+#define DATA_FRAMES FRAME_BITS_OF_TYPE(DATA)
+
+static constexpr AnalyzerReg passive_analyzers[] = {
+  { MGMT_FRAMES | DATA_FRAMES, countFrame },
+  { FRAME_BIT(MGMT, BEACON), analyzeBeacon },
+  { FRAME_BIT(MGMT, PROBE_RESPONSE), analyzeProbeResponse },
+  { FRAME_BIT(MGMT, PROBE_REQUEST), analyzeProbeRequest },
+  { MGMT_FRAMES | DATA_FRAMES, processClientFrame },
+};
+
+static constexpr AnalyzerReg enhanced_analyzers[] = {
+  { MGMT_FRAMES | DATA_FRAMES, countFrame },
+  { FRAME_BIT(MGMT, BEACON) | FRAME_BIT(MGMT, PROBE_RESPONSE), analyzeAPFrameEnhanced },
+  { FRAME_BIT(MGMT, PROBE_REQUEST), analyzeProbeRequest },
+  { MGMT_FRAMES | DATA_FRAMES, processClientFrame },
+};
+
+static constexpr uint8_t passive_dispatch[FRAME_KEYS] = DISPATCH_TABLE(passive_analyzers);
+static constexpr uint8_t enhanced_dispatch[FRAME_KEYS] = DISPATCH_TABLE(enhanced_analyzers);
+
+// ===== Replay Passes =====
+typedef void (*PassFn)(const FrameView& f);
+
+static void decodeOnly(const FrameView& f) {
+  checksum += f.hdr_len;
+}
+
+static void passiveTable(const FrameView& f) {
+  frameDispatch(passive_dispatch, passive_analyzers, f);
+}
+
+static void enhancedTable(const FrameView& f) {
+  frameDispatch(enhanced_dispatch, enhanced_analyzers, f);
+}
+
+static void passiveSwitch(const FrameView& f) {
+  if (f.type != MGMT && f.type != DATA) return;
+  countFrame(f);
+  if (f.type == MGMT) {
+    switch (f.subtype) {
+      case BEACON:
+        analyzeBeacon(f);
+        break;
+      case PROBE_RESPONSE:
+        analyzeProbeResponse(f);
+        break;
+      case PROBE_REQUEST:
+        analyzeProbeRequest(f);
+        break;
+    }
+  }
+  processClientFrame(f);
+}
+
+static inline void replay(PassFn fn) {
+  const uint8_t* base = bytes.data();
+  for (size_t i = 0; i < frames.size(); i++) {
+    FrameView f;
+    if (frameDecode(base + frames[i].offset, frames[i].len, -60, frames[i].channel, &f)) fn(f);
+  }
+}
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+static void bench(const char* name, PassFn fn, unsigned long passes) {
+  replay(fn);  // Warm the caches and the branch predictors
+
+  if (passes == 0) {
+    uint64_t start = nowNs();
+    replay(fn);
+    uint64_t one = nowNs() - start;
+    passes = one ? TARGET_NS / one : 1000;
+    if (passes == 0) passes = 1;
+  }
+
+  uint64_t start = nowNs();
+#if HAVE_TSC
+  uint64_t tsc = __rdtsc();
+#endif
+  for (unsigned long p = 0; p < passes; p++) replay(fn);
+#if HAVE_TSC
+  tsc = __rdtsc() - tsc;
+#endif
+  uint64_t ns = nowNs() - start;
+
+  double n = (double)passes * frames.size();
+  printf("%-16s | %8.1f ns/frame", name, ns / n);
+#if HAVE_TSC
+  printf(" | %8.1f cycles/frame", tsc / n);
+#endif
+  printf(" | %lu passes\n", passes);
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: dispatch_bench <capture.pcapng> [-n passes]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) usage();
+  const char* path = argv[1];
+  unsigned long passes = 0;
+  for (int i = 2; i < argc; i++) {
+    if (i + 1 >= argc || strcmp(argv[i], "-n")) usage();
+    passes = strtoul(argv[++i], NULL, 10);
+    if (passes == 0) usage();
+  }
+
+  PcapReader reader;
+  if (!pcapOpen(&reader, path)) return 1;
+  PcapFrame pf;
+  while (pcapNext(&reader, &pf, 0)) {
+    StoredFrame s = { (uint32_t)bytes.size(), pf.len, pf.channel };
+    bytes.insert(bytes.end(), pf.frame, pf.frame + pf.len);
+    frames.push_back(s);
+  }
+  pcapClose(&reader);
+  if (reader.bad) return 1;
+  if (frames.empty()) {
+    fprintf(stderr, "%s: no 802.11 frames\n", path);
+    return 1;
+  }
+
+  printf("%s: %u frames, %.1f KB\n", path, (unsigned)frames.size(), bytes.size() / 1024.0);
+  bench("decode", decodeOnly, passes);
+  bench("passive switch", passiveSwitch, passes);
+  bench("passive table", passiveTable, passes);
+  bench("enhanced table", enhancedTable, passes);
+  sink = checksum;
+  return 0;
+}
@@ -0,0 +1,102 @@
+"""
+Decode flow records (/flows/flows.bin on the SD card) to CSV or JSON lines.
+
+The file is a 16-byte header (magic "AFFL", version, record length) followed by
+48-byte records, one per finished flow; see Antifi/flow.h. Every `flow -s sd`
+session appends to the same file and restarts the sequence at 1, so the
+decoder numbers sessions and counts gaps within each one (the device's export
+ring overflowed). The columns follow the serial CSV sink, plus the session.
+"""
+import argparse
+import csv
+import json
+import struct
+import sys
+
+MAGIC = 0x4C464641
+VERSION = 1
+HEADER = struct.Struct("<IHH8x")
+RECORD = struct.Struct("<I6s6s6sBBIIIIHbbbB2x")
+
+# FlowEndReason
+REASONS = {1: "idle", 2: "active", 3: "evicted", 4: "flushed"}
+
+FIELDS = ["session", "seq", "reason", "ch", "class", "addr1", "addr2", "bssid", "packets", "bytes",
+          "first_ms", "last_ms", "retries", "rssi", "rssi_min", "rssi_max"]
+
+
+def format_mac(raw):
+    return ":".join("%02X" % b for b in raw)
+
+
+def decode(data, record_len, stats):
+    """Yields one dict per record, in file order."""
+    session = 0
+    last_seq = None
+    end = HEADER.size + (len(data) - HEADER.size) // record_len * record_len
+    for offset in range(HEADER.size, end, record_len):
+        (seq, addr1, addr2, bssid, cls, ch, packets, nbytes, first, last, retries, rssi, rssi_min, rssi_max,
+         reason) = RECORD.unpack_from(data, offset)
+        if last_seq is None or seq <= last_seq:
+            session += 1
+        elif seq != last_seq + 1:
+            stats["gaps"] += 1
+        last_seq = seq
+        stats["records"] += 1
+        stats["packets"] += packets
+        yield {
+            "session": session,
+            "seq": seq,
+            "reason": REASONS.get(reason, str(reason)),
+            "ch": ch,
+            "class": "%d.%d" % (cls >> 4, cls & 0x0F),
+            "addr1": format_mac(addr1),
+            "addr2": format_mac(addr2),
+            "bssid": format_mac(bssid),
+            "packets": packets,
+            "bytes": nbytes,
+            "first_ms": first,
+            "last_ms": last,
+            "retries": retries,
+            "rssi": rssi,
+            "rssi_min": rssi_min,
+            "rssi_max": rssi_max,
+        }
+    stats["sessions"] = session
+    stats["torn_bytes"] = len(data) - end
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode Antifi flow records to CSV or JSON lines")
+    parser.add_argument("flows", help="flows.bin copied from the SD card")
+    parser.add_argument("--format", choices=("csv", "json"), default="csv")
+    parser.add_argument("--output", help="Output file (stdout if omitted)")
+    args = parser.parse_args()
+
+    with open(args.flows, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit("%s: too short for a flow file" % args.flows)
+    magic, version, record_len = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION or record_len < RECORD.size:
+        sys.exit("%s: not a version %d flow file" % (args.flows, VERSION))
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    stats = {"sessions": 0, "records": 0, "packets": 0, "gaps": 0, "torn_bytes": 0}
+    if args.format == "csv":
+        writer = csv.DictWriter(out, fieldnames=FIELDS)
+        writer.writeheader()
+        for record in decode(data, record_len, stats):
+            writer.writerow(record)
+    else:
+        for record in decode(data, record_len, stats):
+            out.write(json.dumps(record) + "\n")
+    if args.output:
+        out.close()
+
+    sys.stderr.write("%d records (%d frames) in %d sessions | %d sequence gaps | %d trailing bytes\n" % (
+        stats["records"], stats["packets"], stats["sessions"], stats["gaps"], stats["torn_bytes"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,224 @@
+"""
+Generate synthetic PCAPNG captures for the host replay tools.
+
+The captures are radiotap (linktype 127) with the channel field set, so
+every frame carries its 2.4 GHz channel the way scan_replay and
+beacon_replay expect. They stand in for recordings where none are at hand;
+a real capture shows what the device meets in the field, a synthetic one
+shows that the tools and the detectors behave as intended.
+
+Scenarios:
+  beacons   APs beaconing for --seconds with the elements real APs carry.
+            TIM and BSS Load change every beacon; a few APs also change
+            their body from time to time (ERP/HT protection as legacy
+            stations come and go, a WMM EDCA update, one channel switch
+            countdown), which is what beacon_replay should see as parses.
+  attacks   A few APs beaconing for 35 s with one attack of each kind the
+            WIDS detects, in turn: a deauth flood (10-14 s), a disassoc
+            flood (16-20 s), a beacon flood of random BSSIDs (22-25 s) and
+            an evil twin, one AP's SSID from 8 more BSSIDs (27-33 s). A
+            station leaving politely at 5 s must not alert. The committed
+            fixture CLI/fixtures/wids_attacks.pcapng is
+                gen_capture.py attacks CLI/fixtures/wids_attacks.pcapng
+            and CLI/fixtures/wids_attacks.expected is what wids_replay
+            prints for it.
+"""
+import argparse
+import random
+import struct
+
+BEACON_TU_MS = 1.024
+CHANNELS = [1, 1, 1, 6, 6, 6, 6, 11, 11, 11, 3, 9, 13, 2]
+
+
+# ===== PCAPNG =====
+def write_pcapng(path, frames):
+    """frames: (ms, channel, 802.11 frame bytes), any order"""
+    with open(path, "wb") as out:
+        def block(kind, body):
+            body += b"\0" * (-len(body) % 4)
+            n = len(body) + 12
+            out.write(struct.pack("<II", kind, n) + body + struct.pack("<I", n))
+
+        block(0x0A0D0D0A, struct.pack("<IHHq", 0x1A2B3C4D, 1, 0, -1))
+        block(1, struct.pack("<HHI", 127, 0, 65535))
+        for ms, channel, frame in sorted(frames, key=lambda f: f[0]):
+            freq = 2484 if channel == 14 else 2407 + 5 * channel
+            radiotap = struct.pack("<BBHI", 0, 0, 12, 1 << 3) + struct.pack("<HH", freq, 0x80)
+            data = radiotap + frame
+            us = int(ms * 1000)
+            block(6, struct.pack("<IIIII", 0, us >> 32, us & 0xFFFFFFFF, len(data), len(data)) + data)
+
+
+# ===== 802.11 =====
+def mac_header(subtype, ra, ta, bssid, seq):
+    fc = bytes([subtype << 4, 0])
+    return fc + b"\0\0" + ra + ta + bssid + struct.pack("<H", (seq & 0xFFF) << 4)
+
+
+def element(eid, data):
+    return bytes([eid, len(data)]) + data
+
+
+def vendor(oui, kind, data):
+    return element(221, oui + bytes([kind]) + data)
+
+
+BROADCAST = b"\xff" * 6
+
+
+# ===== Beacons =====
+class BeaconingAP:
+    def __init__(self, i, rng):
+        self.bssid = bytes([0x02, 0x00, 0x5E, 0x10, i >> 8, i & 0xFF])
+        self.channel = rng.choice(CHANNELS)
+        self.ssid = b"" if rng.random() < 0.1 else b"net-%02d" % i
+        self.secure = rng.random() < 0.85
+        self.dtim_period = rng.choice([1, 1, 2, 3])
+        self.bss_load = rng.random() < 0.4
+        self.wps = rng.random() < 0.3
+        self.country = rng.random() < 0.7
+        self.stations = rng.randint(0, 12)
+        self.protection = False
+        self.edca_count = 0
+        self.csa = None  # (first beacon, count)
+        self.seq = rng.randint(0, 4095)
+        self.offset = rng.uniform(0, 100 * BEACON_TU_MS)
+
+    def body(self, n, rng):
+        tsf = int((self.offset + n * 100 * BEACON_TU_MS) * 1000)
+        capability = 0x0001 | (0x0010 if self.secure else 0) | 0x0400
+        b = struct.pack("<QHH", tsf, 100, capability)
+        b += element(0, self.ssid)
+        b += element(1, bytes([0x82, 0x84, 0x8B, 0x96, 0x0C, 0x12, 0x18, 0x24]))
+        b += element(3, bytes([self.channel]))
+        # TIM: DTIM count cycles, the bitmap follows buffered traffic
+        bitmap = bytes([rng.getrandbits(8) if rng.random() < 0.3 else 0])
+        b += element(5, bytes([n % self.dtim_period, self.dtim_period, 0]) + bitmap)
+        if self.country:
+            b += element(7, b"US " + bytes([1, 11, 30]))
+        if self.csa and self.csa[0] <= n < self.csa[0] + self.csa[1]:
+            b += element(37, bytes([1, 6, self.csa[1] - (n - self.csa[0])]))
+        if self.bss_load:
+            utilization = max(0, min(255, int(rng.gauss(60, 20))))
+            b += element(11, struct.pack("<HBH", self.stations, utilization, 0))
+        b += element(42, bytes([0x03 if self.protection else 0x00]))
+        b += element(45, struct.pack("<HB", 0x19EF, 0x17) + b"\xff\xff" + b"\0" * 21)
+        if self.secure:
+            b += element(48, struct.pack("<H", 1) + b"\x00\x0f\xac\x04" + struct.pack("<H", 1) +
+                         b"\x00\x0f\xac\x04" + struct.pack("<H", 1) + b"\x00\x0f\xac\x02" + b"\x00\x00")
+        b += element(50, bytes([0x30, 0x48, 0x60, 0x6C]))
+        b += element(61, bytes([self.channel, 0x00, 0x04 if self.protection else 0x00]) + b"\0" * 19)
+        b += element(127, b"\x04\x00\x08\x00\x00\x00\x00\x40")
+        b += vendor(b"\x00\x50\xf2", 2, bytes([1, 1, 0x80 | (self.edca_count & 0x0F), 0]) +
+                    b"\x03\xa4\x00\x00\x27\xa4\x00\x00\x42\x43\x5e\x00\x62\x32\x2f\x00")
+        if self.wps:
+            b += vendor(b"\x00\x50\xf2", 4, b"\x10\x4a\x00\x01\x10\x10\x44\x00\x01\x02")
+        return b
+
+    def frame(self, n, rng):
+        self.seq += 1
+        return mac_header(8, BROADCAST, self.bssid, self.bssid, self.seq) + self.body(n, rng)
+
+
+def beacons(args, rng):
+    aps = [BeaconingAP(i, rng) for i in range(args.aps)]
+    count = int(args.seconds * 1000 / (100 * BEACON_TU_MS))
+
+    # Body changes: protection flips on a fifth of the APs, now and then;
+    # a couple of EDCA updates; one channel switch countdown
+    flips = {ap.bssid: sorted(rng.sample(range(count), rng.randint(1, 4)))
+             for ap in aps if rng.random() < 0.2}
+    edca = {ap.bssid: rng.randrange(count) for ap in rng.sample(aps, min(2, len(aps)))}
+    aps[0].csa = (count // 2, 10)
+
+    frames = []
+    for ap in aps:
+        for n in range(count):
+            if n in flips.get(ap.bssid, ()):
+                ap.protection = not ap.protection
+            if edca.get(ap.bssid) == n:
+                ap.edca_count += 1
+            if rng.random() < 0.05:
+                ap.stations = max(0, ap.stations + rng.choice([-1, 1]))
+            if rng.random() < args.loss:
+                continue
+            frames.append((ap.offset + n * 100 * BEACON_TU_MS, ap.channel, ap.frame(n, rng)))
+    return frames
+
+
+# ===== Attacks =====
+def kill_frame(subtype, ra, ta, bssid, seq, reason=7):
+    return mac_header(subtype, ra, ta, bssid, seq) + struct.pack("<H", reason)
+
+
+def flood(frames, start, seconds, per_second, make):
+    """make(n) -> (channel, frame) for the n-th frame of the flood"""
+    for n in range(int(seconds * per_second)):
+        channel, frame = make(n)
+        frames.append((start * 1000 + n * 1000.0 / per_second, channel, frame))
+
+
+def attacks(args, rng):
+    seconds = 35
+    aps = [BeaconingAP(i, rng) for i in range(4)]
+    for i, ap in enumerate(aps):
+        ap.ssid = b"net-%02d" % i  # The twin needs a name to copy
+    count = int(seconds * 1000 / (100 * BEACON_TU_MS))
+    frames = []
+    for ap in aps:
+        for n in range(count):
+            frames.append((ap.offset + n * 100 * BEACON_TU_MS, ap.channel, ap.frame(n, rng)))
+
+    station = bytes([0x02, 0x00, 0x5E, 0x20, 0x00, 0x01])
+    victim, bouncer, cloned = aps[1], aps[2], aps[3]
+
+    # A station leaving: one deauth each way, far below any rate
+    frames.append((5000, victim.channel, kill_frame(12, victim.bssid, station, victim.bssid, 1, 3)))
+    frames.append((5002, victim.channel, kill_frame(12, station, victim.bssid, victim.bssid, 2, 3)))
+
+    # Deauth flood spoofing the AP, to broadcast, 50 frames/s for 4 s
+    flood(frames, 10, 4, 50, lambda n: (victim.channel, kill_frame(12, BROADCAST, victim.bssid, victim.bssid, n)))
+    # Disassoc flood at one station, 40 frames/s for 4 s
+    flood(frames, 16, 4, 40, lambda n: (bouncer.channel, kill_frame(10, station, bouncer.bssid, bouncer.bssid, n)))
+
+    # Beacon flood: 150 random BSSIDs/s with random SSIDs, one beacon each
+    def fake_beacon(n):
+        bssid = bytes([0x02] + [rng.getrandbits(8) for _ in range(5)])
+        ssid = bytes(rng.choice(b"abcdefghijklmnopqrstuvwxyz") for _ in range(8))
+        body = struct.pack("<QHH", 0, 100, 0x0001) + element(0, ssid) + element(3, bytes([6]))
+        return 6, mac_header(8, BROADCAST, bssid, bssid, n) + body
+
+    flood(frames, 22, 3, 150, fake_beacon)
+
+    # Evil twin: the cloned AP's SSID from 8 more BSSIDs coming up one by
+    # one, each beaconing every 100 TU for 4 s
+    for i in range(8):
+        twin = bytes([0x02, 0x00, 0x5E, 0x30, 0x00, i])
+        for n in range(int(4000 / (100 * BEACON_TU_MS))):
+            frame = mac_header(8, BROADCAST, twin, twin, n) + cloned.body(n, rng)
+            frames.append((27000 + i * 250 + n * 100 * BEACON_TU_MS, cloned.channel, frame))
+    return frames
+
+
+SCENARIOS = {"attacks": attacks, "beacons": beacons}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("scenario", choices=sorted(SCENARIOS))
+    parser.add_argument("output", help="PCAPNG file to write")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--seconds", type=float, default=60)
+    parser.add_argument("--aps", type=int, default=40)
+    parser.add_argument("--loss", type=float, default=0.1, help="fraction of beacons not captured")
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    frames = SCENARIOS[args.scenario](args, rng)
+    write_pcapng(args.output, frames)
+    print("%s: %d frames" % (args.output, len(frames)))
+
+
+if __name__ == "__main__":
+    main()
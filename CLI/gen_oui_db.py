@@ -0,0 +1,184 @@
+"""
+Generate Antifi/oui_db.h from an IEEE OUI registry CSV.
+
+The registry (data/oui.csv) uses the IEEE MA-L export layout:
+    Registry,Assignment,Organization Name,Organization Address
+The vendored copy holds every MA-L assignment with the address column left
+empty (the generator never reads it). Refresh it with the current export from
+https://standards-oui.ieee.org/oui/oui.csv and rerun this script; the firmware
+only ever includes the generated header.
+
+Output is a sorted uint32_t key array, a per-key offset into a deduplicated
+vendor name pool and the pool itself, all const so they stay in flash.
+
+The whole registry costs about 590 KB of flash, mostly names of vendors that
+hold a single block. By default only vendors holding at least --min-blocks
+assignments are kept: that keeps every large phone, laptop, chipset and router
+vendor (about 16k of the 35k OUIs) for about 106 KB. --min-blocks 1 builds the
+full table. Blocks assigned to the IEEE Registration Authority itself are
+split into MA-M/MA-S ranges whose owners a 24-bit key cannot tell apart, so
+they are always left out.
+"""
+import argparse
+import collections
+import csv
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_INPUT = os.path.join(ROOT, "data", "oui.csv")
+DEFAULT_OUTPUT = os.path.join(ROOT, "Antifi", "oui_db.h")
+DEFAULT_MAX_NAME = 24
+DEFAULT_MIN_BLOCKS = 3
+SPLIT_BLOCK_OWNER = "IEEE Registration Authority"
+
+# Corporate suffixes that only cost flash and vendor column width
+SUFFIX_RE = re.compile(
+    r"[ ,.]+(inc|corp|corporation|co|ltd|limited|llc|gmbh|ag|sa|s\.a|bv|b\.v|oy|ab|plc|pte|pty|srl|spa)\.?$",
+    re.IGNORECASE,
+)
+
+
+def short_name(name, max_len):
+    """Strip legal suffixes and clamp the vendor name to max_len characters."""
+    name = " ".join(name.split())
+    while True:
+        trimmed = SUFFIX_RE.sub("", name).strip(" ,.")
+        if trimmed == name or not trimmed:
+            break
+        name = trimmed
+    return name[:max_len].rstrip()
+
+
+def c_string(text):
+    """Escape text for a C string literal."""
+    out = []
+    for ch in text:
+        if ch in "\\\"":
+            out.append("\\" + ch)
+        elif 32 <= ord(ch) < 127:
+            out.append(ch)
+        else:
+            for b in ch.encode("utf-8"):
+                out.append("\\%03o" % b)
+    return "".join(out)
+
+
+def load_registry(path, max_len):
+    """Return {oui_int: vendor}; the first assignment of a duplicate OUI wins."""
+    entries = {}
+    with open(path, newline="", encoding="utf-8") as f:
+        for row in csv.DictReader(f):
+            assignment = (row.get("Assignment") or "").strip()
+            name = (row.get("Organization Name") or "").strip()
+            if len(assignment) != 6 or not name or name == SPLIT_BLOCK_OWNER:
+                continue
+            try:
+                key = int(assignment, 16)
+            except ValueError:
+                continue
+            entries.setdefault(key, short_name(name, max_len))
+    return entries
+
+
+def keep_major_vendors(entries, min_blocks):
+    """Drop vendors that hold fewer than min_blocks OUIs."""
+    blocks = collections.Counter(entries.values())
+    return {key: name for key, name in entries.items() if blocks[name] >= min_blocks}
+
+
+def generate(entries, source, registry_size, min_blocks):
+    keys = sorted(entries)
+    pool = []
+    offsets = {}
+    pool_len = 0
+    for key in keys:
+        name = entries[key]
+        if name not in offsets:
+            offsets[name] = pool_len
+            pool.append(name)
+            pool_len += len(name.encode("utf-8")) + 1
+
+    offset_type = "uint16_t" if pool_len <= 0xFFFF else "uint32_t"
+    offset_size = 2 if offset_type == "uint16_t" else 4
+    keys_bytes = 4 * len(keys)
+    offsets_bytes = offset_size * len(keys)
+    report = {
+        "entries": len(keys),
+        "vendors": len(pool),
+        "keys_bytes": keys_bytes,
+        "offsets_bytes": offsets_bytes,
+        "pool_bytes": pool_len,
+        "total_bytes": keys_bytes + offsets_bytes + pool_len,
+    }
+
+    lines = []
+    lines.append("// Generated by CLI/gen_oui_db.py from %s -- do not edit." % source)
+    lines.append("// Vendors with >= %d MA-L blocks: %d of %d registry OUIs" % (min_blocks, len(keys), registry_size))
+    lines.append("// Flash cost: %(entries)d OUIs, %(vendors)d vendors, "
+                 "%(keys_bytes)d B keys + %(offsets_bytes)d B offsets + "
+                 "%(pool_bytes)d B names = %(total_bytes)d B" % report)
+    lines.append("#ifndef OUI_DB_H")
+    lines.append("#define OUI_DB_H")
+    lines.append("")
+    lines.append("#include <stdint.h>")
+    lines.append("")
+    lines.append("#define OUI_DB_ENTRIES %d" % len(keys))
+    lines.append("")
+    lines.append("// Sorted 24-bit OUIs (searched with binary search)")
+    lines.append("static constexpr uint32_t oui_db_keys[OUI_DB_ENTRIES] = {")
+    for i in range(0, len(keys), 8):
+        chunk = ", ".join("0x%06X" % k for k in keys[i:i + 8])
+        lines.append("  %s," % chunk)
+    lines.append("};")
+    lines.append("")
+    lines.append("// Offset of each key's vendor name in oui_db_names")
+    lines.append("static constexpr %s oui_db_name_offsets[OUI_DB_ENTRIES] = {" % offset_type)
+    for i in range(0, len(keys), 12):
+        chunk = ", ".join(str(offsets[entries[k]]) for k in keys[i:i + 12])
+        lines.append("  %s," % chunk)
+    lines.append("};")
+    lines.append("")
+    lines.append("// Deduplicated, NUL-separated vendor names")
+    lines.append("static constexpr char oui_db_names[] =")
+    for name in pool:
+        lines.append("  \"%s\\0\"" % c_string(name))
+    lines.append("  \"\";")
+    lines.append("")
+    lines.append("#endif  // OUI_DB_H")
+    return "\n".join(lines) + "\n", report
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the flash-resident OUI vendor table")
+    parser.add_argument("-i", "--input", default=DEFAULT_INPUT, help="IEEE OUI CSV (default: data/oui.csv)")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="generated header (default: Antifi/oui_db.h)")
+    parser.add_argument("--max-name", type=int, default=DEFAULT_MAX_NAME,
+                        help="truncate vendor names to this many characters (default: %d)" % DEFAULT_MAX_NAME)
+    parser.add_argument("--min-blocks", type=int, default=DEFAULT_MIN_BLOCKS,
+                        help="keep vendors holding at least this many OUIs, 1 for all (default: %d)"
+                        % DEFAULT_MIN_BLOCKS)
+    args = parser.parse_args()
+
+    registry = load_registry(args.input, args.max_name)
+    entries = keep_major_vendors(registry, args.min_blocks)
+    if not entries:
+        print("No OUI assignments found in %s" % args.input, file=sys.stderr)
+        return 1
+
+    source = os.path.relpath(args.input, ROOT).replace(os.sep, "/")
+    header, report = generate(entries, source, len(registry), args.min_blocks)
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+
+    print("Wrote %s" % args.output)
+    print("  OUIs:     %d of %d in the registry" % (report["entries"], len(registry)))
+    print("  Vendors:  %d (deduplicated)" % report["vendors"])
+    print("  Flash:    %d B keys + %d B offsets + %d B names = %d B" % (
+        report["keys_bytes"], report["offsets_bytes"], report["pool_bytes"], report["total_bytes"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
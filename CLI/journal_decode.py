@@ -0,0 +1,107 @@
+"""
+Decode the scan journal (/journal/scan.jnl on the SD card) to CSV or JSON lines.
+
+The journal is a sequence of 512-byte blocks. Each block starts with a 64-byte
+header (magic "AFJL", version, record count, block number, boot number and a
+CRC-32) followed by up to seven 64-byte records; see Antifi/scan_journal.h.
+Blocks that fail the check are reported and skipped, so a journal copied off a
+card that was pulled mid-write still decodes up to the damage. Gaps in the
+record sequence mean the device's staging buffer overflowed.
+"""
+import argparse
+import csv
+import json
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4C4A4641
+VERSION = 1
+BLOCK = 512
+RECORD = 64
+PER_BLOCK = 7
+
+HEADER = struct.Struct("<IHHIHHI")
+RECORD_FMT = struct.Struct("<IIBBbB6s6sB32s7x")
+
+# ScanEventType, in enum order (same names as the serial event stream)
+EVENT_NAMES = [
+    "reset", "ap+", "ap-", "ap_ssid", "ap_rssi", "ap_enc", "ap_chan",
+    "sta+", "sta-", "sta_rssi", "assoc", "disassoc",
+]
+
+FIELDS = ["boot", "block", "seq", "ms", "ev", "mac", "peer", "ch", "rssi", "enc", "ssid"]
+
+
+def format_mac(raw):
+    return ":".join("%02X" % b for b in raw)
+
+
+def block_valid(block):
+    magic, version, count, _, _, _, crc = HEADER.unpack_from(block)
+    if magic != MAGIC or version != VERSION or not 1 <= count <= PER_BLOCK:
+        return False
+    return zlib.crc32(block[RECORD:], zlib.crc32(block[:16])) == crc
+
+
+def decode(data, stats):
+    """Yields one dict per record, in file order."""
+    last_seq = None
+    for offset in range(0, len(data) - len(data) % BLOCK, BLOCK):
+        block = data[offset:offset + BLOCK]
+        if not block_valid(block):
+            stats["bad_blocks"] += 1
+            continue
+        _, _, count, number, boot, _, _ = HEADER.unpack_from(block)
+        stats["blocks"] += 1
+        for i in range(count):
+            seq, ms, kind, ch, rssi, enc, mac, peer, ssid_len, ssid = RECORD_FMT.unpack_from(block, RECORD * (i + 1))
+            if last_seq is not None and seq != last_seq + 1:
+                stats["gaps"] += 1
+            last_seq = seq
+            stats["records"] += 1
+            yield {
+                "boot": boot,
+                "block": number,
+                "seq": seq,
+                "ms": ms,
+                "ev": EVENT_NAMES[kind] if kind < len(EVENT_NAMES) else str(kind),
+                "mac": format_mac(mac),
+                "peer": format_mac(peer),
+                "ch": ch,
+                "rssi": rssi,
+                "enc": enc,
+                "ssid": ssid[:min(ssid_len, 32)].decode("utf-8", errors="replace"),
+            }
+    stats["torn_bytes"] = len(data) % BLOCK
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the Antifi scan journal to CSV or JSON lines")
+    parser.add_argument("journal", help="Journal file copied from the SD card")
+    parser.add_argument("--format", choices=("csv", "json"), default="csv")
+    parser.add_argument("--output", help="Output file (stdout if omitted)")
+    args = parser.parse_args()
+
+    with open(args.journal, "rb") as f:
+        data = f.read()
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    stats = {"blocks": 0, "bad_blocks": 0, "records": 0, "gaps": 0, "torn_bytes": 0}
+    if args.format == "csv":
+        writer = csv.DictWriter(out, fieldnames=FIELDS)
+        writer.writeheader()
+        for record in decode(data, stats):
+            writer.writerow(record)
+    else:
+        for record in decode(data, stats):
+            out.write(json.dumps(record) + "\n")
+    if args.output:
+        out.close()
+
+    sys.stderr.write("%d records in %d blocks | %d bad blocks | %d sequence gaps | %d trailing bytes\n" % (
+        stats["records"], stats["blocks"], stats["bad_blocks"], stats["gaps"], stats["torn_bytes"]))
+
+
+if __name__ == "__main__":
+    main()
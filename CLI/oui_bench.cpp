@@ -0,0 +1,71 @@
+/*
+ * Host benchmark for the flash OUI table: lookups per second and table size.
+ *
+ * Build and run from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/oui_bench.cpp Antifi/oui.cpp -o oui_bench
+ *     ./oui_bench [lookups] [hit-percent]
+ *
+ * Looks up a fixed set of MACs: hit-percent of them (default 50) carry an OUI
+ * from the table, the rest random 24-bit OUIs that mostly miss, like
+ * a busy channel with some randomized client MACs. Prints lookups per second,
+ * nanoseconds per lookup and the table's flash cost. The device runs the same
+ * binary search from flash, so expect it to be slower in absolute terms but
+ * to scale the same way with the table size (log2 of the entry count).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "oui.h"
+#include "oui_db.h"
+
+#define MAC_SET 4096  // Distinct MACs cycled through (fits in cache, like a live scan)
+
+static uint32_t rng = 2463534242u;
+
+static uint32_t next() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+int main(int argc, char** argv) {
+  long lookups = argc > 1 ? atol(argv[1]) : 20000000L;
+  int hit_percent = argc > 2 ? atoi(argv[2]) : 50;
+
+  std::vector<uint8_t> macs(MAC_SET * 6);
+  for (int i = 0; i < MAC_SET; i++) {
+    uint8_t* mac = &macs[i * 6];
+    uint32_t oui = ((int)(next() % 100) < hit_percent) ? oui_db_keys[next() % OUI_DB_ENTRIES]
+                                                       : (next() & 0xFFFFFF);
+    mac[0] = oui >> 16;
+    mac[1] = oui >> 8;
+    mac[2] = oui;
+    uint32_t nic = next();
+    mac[3] = nic >> 16;
+    mac[4] = nic >> 8;
+    mac[5] = nic;
+  }
+
+  // Warm up and count hits once
+  int hits = 0;
+  for (int i = 0; i < MAC_SET; i++) {
+    if (ouiLookup(&macs[i * 6]) != OUI_NOT_FOUND) hits++;
+  }
+
+  long found = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (long n = 0; n < lookups; n++) {
+    found += ouiLookup(&macs[(n & (MAC_SET - 1)) * 6]) != OUI_NOT_FOUND;
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  size_t flash = sizeof(oui_db_keys) + sizeof(oui_db_name_offsets) + sizeof(oui_db_names);
+  printf("Table:    %d OUIs, %zu B flash (%zu B keys + %zu B offsets + %zu B names)\n", ouiTableSize(), flash,
+         sizeof(oui_db_keys), sizeof(oui_db_name_offsets), sizeof(oui_db_names));
+  printf("MACs:     %d distinct, %.1f%% found in the table\n", MAC_SET, 100.0 * hits / MAC_SET);
+  printf("Lookups:  %ld in %.3f s = %.1f M lookups/s, %.1f ns each (%ld found)\n", lookups, secs,
+         lookups / secs / 1e6, secs * 1e9 / lookups, found);
+  return 0;
+}
@@ -0,0 +1,207 @@
+/*
+ * PCAPNG reader shared by the host replay tools (wids_replay, scan_replay,
+ * dispatch_bench, beacon_replay).
+ *
+ * Reads 802.11 (linktype 105) and radiotap (127) interfaces from Enhanced
+ * Packet Blocks, in either byte order. Radiotap headers and trailing FCS
+ * are stripped; the radiotap channel is used when present, the caller's
+ * default otherwise. Header-only: each tool includes it once.
+ */
+#ifndef CLI_PCAPNG_H
+#define CLI_PCAPNG_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#define PCAPNG_SHB 0x0A0D0D0Au
+#define PCAPNG_IDB 0x00000001u
+#define PCAPNG_EPB 0x00000006u
+#define PCAPNG_BYTE_ORDER 0x1A2B3C4Du
+#define LINKTYPE_IEEE802_11 105
+#define LINKTYPE_RADIOTAP 127
+#define RADIOTAP_FLAGS_FCS 0x10
+
+typedef struct {
+  uint16_t linktype;
+  uint64_t ticks_per_sec;
+} PcapInterface;
+
+typedef struct {
+  FILE* f;
+  const char* path;
+  bool swapped;
+  bool bad;  // Not a pcapng file
+  std::vector<PcapInterface> interfaces;
+  std::vector<uint8_t> block;
+  uint32_t packets;  // Enhanced Packet Blocks read, 802.11 or not
+} PcapReader;
+
+// One 802.11 frame; `frame` is valid until the next pcapNext()
+typedef struct {
+  const uint8_t* frame;
+  uint16_t len;
+  uint8_t channel;  // 0 if neither radiotap nor the caller named one
+  uint64_t ms;      // Capture timestamp
+} PcapFrame;
+
+static uint16_t pcapRd16(const PcapReader* r, const uint8_t* p) {
+  return r->swapped ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+}
+
+static uint32_t pcapRd32(const PcapReader* r, const uint8_t* p) {
+  return r->swapped ? ((uint32_t)pcapRd16(r, p) << 16) | pcapRd16(r, p + 2)
+                    : pcapRd16(r, p) | ((uint32_t)pcapRd16(r, p + 2) << 16);
+}
+
+// Radiotap is always little-endian
+static uint16_t le16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t le32(const uint8_t* p) {
+  return le16(p) | ((uint32_t)le16(p + 2) << 16);
+}
+
+static uint64_t tsresolTicks(uint8_t v) {
+  uint64_t ticks = 1;
+  if (v & 0x80) return ticks << (v & 0x7F);
+  for (uint8_t i = 0; i < v; i++) ticks *= 10;
+  return ticks;
+}
+
+static PcapInterface parseIDB(const PcapReader* r, const uint8_t* body, uint32_t len) {
+  PcapInterface i = { 0, 1000000 };
+  if (len < 8) return i;
+  i.linktype = pcapRd16(r, body);
+  for (uint32_t off = 8; off + 4 <= len;) {
+    uint16_t code = pcapRd16(r, body + off);
+    uint16_t olen = pcapRd16(r, body + off + 2);
+    if (code == 0) break;
+    if (code == 9 && olen >= 1 && off + 5 <= len) i.ticks_per_sec = tsresolTicks(body[off + 4]);
+    off += 4 + ((olen + 3) & ~3u);
+  }
+  return i;
+}
+
+static uint8_t freqToChannel(uint16_t mhz) {
+  if (mhz == 2484) return 14;
+  if (mhz >= 2412 && mhz <= 2472) return (mhz - 2407) / 5;
+  return 0;
+}
+
+// Strips the radiotap header; picks up the channel and whether an FCS trails
+static bool stripRadiotap(const uint8_t** frame, uint32_t* len, uint8_t* channel) {
+  const uint8_t* p = *frame;
+  if (*len < 8) return false;
+  uint16_t hdr_len = le16(p + 2);
+  if (hdr_len > *len) return false;
+
+  uint32_t present = le32(p + 4);
+  uint32_t off = 8;
+  for (uint32_t word = present; word & 0x80000000u; off += 4) {  // Extended bitmaps
+    if (off + 4 > hdr_len) return false;
+    word = le32(p + off);
+  }
+
+  bool fcs = false;
+  if (present & (1u << 0)) off = ((off + 7) & ~7u) + 8;  // TSFT
+  if (present & (1u << 1)) {                             // Flags
+    if (off < hdr_len) fcs = p[off] & RADIOTAP_FLAGS_FCS;
+    off += 1;
+  }
+  if (present & (1u << 2)) off += 1;  // Rate
+  if (present & (1u << 3)) {          // Channel
+    off = (off + 1) & ~1u;
+    if (off + 2 <= hdr_len) *channel = freqToChannel(le16(p + off));
+  }
+
+  *frame = p + hdr_len;
+  *len -= hdr_len;
+  if (fcs && *len >= 4) *len -= 4;
+  return true;
+}
+
+static bool pcapOpen(PcapReader* r, const char* path) {
+  r->f = fopen(path, "rb");
+  r->path = path;
+  r->swapped = false;
+  r->bad = false;
+  r->interfaces.clear();
+  r->packets = 0;
+  if (!r->f) perror(path);
+  return r->f != NULL;
+}
+
+static void pcapClose(PcapReader* r) {
+  if (r->f) fclose(r->f);
+  r->f = NULL;
+}
+
+// Next 802.11 frame; false at the end of the capture or on a corrupt block
+static bool pcapNext(PcapReader* r, PcapFrame* out, uint8_t default_channel) {
+  uint8_t head[8];
+  while (fread(head, 1, 8, r->f) == 8) {
+    uint32_t type = pcapRd32(r, head);
+    if (type == PCAPNG_SHB) {
+      // Byte order is only known once the section header's magic is read
+      uint8_t magic[4];
+      if (fread(magic, 1, 4, r->f) != 4) return false;
+      r->swapped = false;
+      if (pcapRd32(r, magic) != PCAPNG_BYTE_ORDER) r->swapped = true;
+      if (pcapRd32(r, magic) != PCAPNG_BYTE_ORDER) {
+        fprintf(stderr, "%s: not a pcapng file\n", r->path);
+        r->bad = true;
+        return false;
+      }
+      r->interfaces.clear();
+      uint32_t total = pcapRd32(r, head + 4);
+      if (total < 16 || fseek(r->f, total - 12, SEEK_CUR) != 0) return false;
+      continue;
+    }
+
+    uint32_t total = pcapRd32(r, head + 4);
+    if (total < 12 || total % 4) {
+      fprintf(stderr, "%s: corrupt block, stopping\n", r->path);
+      return false;
+    }
+    r->block.resize(total - 8);
+    if (fread(r->block.data(), 1, r->block.size(), r->f) != r->block.size()) return false;
+    const uint8_t* body = r->block.data();
+    uint32_t body_len = total - 12;
+
+    if (type == PCAPNG_IDB) {
+      r->interfaces.push_back(parseIDB(r, body, body_len));
+      continue;
+    }
+    if (type != PCAPNG_EPB || body_len < 20) continue;
+
+    r->packets++;
+    uint32_t iface = pcapRd32(r, body);
+    if (iface >= r->interfaces.size()) continue;
+    const PcapInterface& itf = r->interfaces[iface];
+    uint64_t ticks = ((uint64_t)pcapRd32(r, body + 4) << 32) | pcapRd32(r, body + 8);
+    uint32_t caplen = pcapRd32(r, body + 12);
+    if (caplen > body_len - 20) continue;
+
+    const uint8_t* frame = body + 20;
+    uint32_t len = caplen;
+    uint8_t channel = default_channel;
+    if (itf.linktype == LINKTYPE_RADIOTAP) {
+      if (!stripRadiotap(&frame, &len, &channel)) continue;
+    } else if (itf.linktype != LINKTYPE_IEEE802_11) {
+      continue;
+    }
+    if (len > 0xFFFF) continue;
+
+    out->frame = frame;
+    out->len = len;
+    out->channel = channel;
+    out->ms = ticks * 1000 / itf.ticks_per_sec;
+    return true;
+  }
+  return false;
+}
+
+#endif  // CLI_PCAPNG_H
@@ -0,0 +1,148 @@
+import argparse
+import json
+import sys
+import time
+
+DEFAULT_BAUD = 921600
+REDRAW_INTERVAL = 1.0  # seconds between table redraws
+
+# wifi_auth_mode_t values as sent in "enc"
+ENCRYPTION_NAMES = [
+    "OPEN", "WEP", "WPA", "WPA2", "WPA/WPA2", "WPA2-ENT", "WPA3", "WPA2/WPA3",
+    "WAPI", "OWE", "WPA3-ENT-192",
+]
+
+
+class ScanTable:
+    """
+    Rebuilds the scanner's AP/client tables from `scan -f events` output.
+    Snapshot rows carry the stream position they were taken at; queued events
+    at or below it are already reflected and are skipped.
+    """
+
+    def __init__(self):
+        self.aps = {}
+        self.stations = {}
+        self.baseline = 0
+        self.last_seq = 0
+        self.gaps = 0
+
+    def apply(self, ev):
+        kind = ev.get("ev")
+        seq = ev.get("seq", 0)
+
+        if kind == "snap":
+            self.aps.clear()
+            self.stations.clear()
+            self.baseline = seq
+            self.last_seq = seq
+            return
+        if kind == "snap_end":
+            return
+        if kind == "reset":
+            self.aps.clear()
+            self.stations.clear()
+            self.baseline = seq
+            self.last_seq = seq
+            return
+        if kind == "lost":
+            self.gaps += 1
+            return
+
+        is_snapshot_row = seq == self.baseline and kind in ("ap+", "sta+")
+        if not is_snapshot_row:
+            if seq <= self.baseline:
+                return
+            if self.last_seq and seq != self.last_seq + 1:
+                self.gaps += 1
+            self.last_seq = seq
+
+        mac = ev.get("mac")
+        if kind == "ap+":
+            self.aps[mac] = {k: ev.get(k) for k in ("ssid", "ch", "rssi", "enc")}
+        elif kind == "ap-":
+            self.aps.pop(mac, None)
+        elif kind == "sta+":
+            self.stations[mac] = {k: ev.get(k) for k in ("ch", "rssi", "ap")}
+        elif kind == "sta-":
+            self.stations.pop(mac, None)
+        elif kind in ("assoc", "disassoc"):
+            record = self.stations.get(mac)
+            if record is None:
+                return
+            if kind == "assoc":
+                record["ap"] = ev.get("ap")
+            elif record.get("ap") == ev.get("ap"):
+                record["ap"] = "00:00:00:00:00:00"
+        else:
+            record = self.aps.get(mac) if kind.startswith("ap_") else self.stations.get(mac)
+            if record is None:
+                return
+            for key in ("ssid", "ch", "rssi", "enc"):
+                if key in ev:
+                    record[key] = ev[key]
+
+    def render(self):
+        lines = ["SSID                             | RSSI | Ch | Encryption   | BSSID"]
+        for mac, ap in sorted(self.aps.items(), key=lambda item: -(item[1].get("rssi") or -128)):
+            enc = ap.get("enc") or 0
+            lines.append("%-32s | %4s | %2s | %-12s | %s" % (
+                ap.get("ssid") or "[Hidden]", ap.get("rssi"), ap.get("ch"),
+                ENCRYPTION_NAMES[enc] if enc < len(ENCRYPTION_NAMES) else enc, mac))
+        lines.append("")
+        lines.append("Client            | RSSI | Ch | AP")
+        for mac, sta in sorted(self.stations.items(), key=lambda item: -(item[1].get("rssi") or -128)):
+            lines.append("%s | %4s | %2s | %s" % (mac, sta.get("rssi"), sta.get("ch"), sta.get("ap")))
+        lines.append("")
+        lines.append("APs: %d | Clients: %d | Seq: %d | Gaps: %d%s" % (
+            len(self.aps), len(self.stations), self.last_seq, self.gaps,
+            " (send 'scan snapshot' to resync)" if self.gaps else ""))
+        return "\n".join(lines)
+
+
+def read_lines(args):
+    if args.port:
+        import serial
+        ser = serial.Serial(args.port, args.baud, timeout=0.1)
+        if args.start:
+            ser.write(b"scan -f events\n")
+        pending = b""
+        while True:
+            pending += ser.read(4096)
+            while b"\n" in pending:
+                line, pending = pending.split(b"\n", 1)
+                yield line.decode("utf-8", errors="replace")
+    else:
+        for line in sys.stdin:
+            yield line
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Rebuild scan tables from the JSON-lines event stream")
+    parser.add_argument("--port", help="Serial port (reads stdin if omitted)")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD)
+    parser.add_argument("--start", action="store_true", help="Send 'scan -f events' on connect")
+    args = parser.parse_args()
+
+    table = ScanTable()
+    last_draw = 0.0
+    for line in read_lines(args):
+        line = line.strip()
+        if not line.startswith("{"):
+            continue
+        try:
+            table.apply(json.loads(line))
+        except ValueError:
+            continue
+
+        now = time.time()
+        if now - last_draw >= REDRAW_INTERVAL:
+            sys.stdout.write("\x1b[2J\x1b[H" + table.render() + "\n")
+            sys.stdout.flush()
+            last_draw = now
+
+    print(table.render())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,273 @@
+/*
+ * Replays a PCAPNG capture through the sketch's channel scheduler on the host
+ * and reports how fast each dwell mode discovers what the capture holds.
+ *
+ * Build from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/scan_replay.cpp Antifi/channel_sched.cpp -o scan_replay
+ *
+ * Usage:
+ *     ./scan_replay capture.pcapng [-h hop-ms] [-l limit-s] [-s]
+ *
+ * The capture stands in for the air on every channel at once, so it should
+ * be recorded on all channels in parallel (several radios merged with
+ * mergecap, or generated); frames carry their channel in radiotap. A frame
+ * is heard only while the simulated radio is tuned to its channel, and the
+ * capture repeats until everything in it was found or the limit (600 s) ran
+ * out. Discoveries are APs (beacons and probe responses), or stations with
+ * -s: unicast transmitters and receivers other than the BSSID, as the scan
+ * tables count them.
+ *
+ * For the fixed round-robin (-h, 500 ms by default) and the adaptive dwell,
+ * prints the time until 50/90/95% of all records in the capture were found.
+ * t95 is the benchmark the adaptive scheduler is tuned for.
+ *
+ * Each row also gives the time to the first table the scan draws (after its
+ * first sweep, or right after the fast-start driver scan) with how many of
+ * the records it held, and the time until all of them were in the table.
+ * AP replays add fast-start rows: a passive driver scan of SEED_DWELL_MS per
+ * channel hears the capture first, then the scheduler takes over.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <vector>
+#include "frame_view.h"
+#include "channel_sched.h"
+#include "pcapng.h"
+
+#define SCAN_LOOP_MS 10        // loop() cadence driving the hops
+#define RECORDS_PER_FRAME 2    // An AP, or a station pair
+#define RECORD_NONE 0xFFFFFFFFu
+#define SEED_DWELL_MS 120      // SCAN_SEED_DWELL_MS (scan.h)
+
+typedef struct {
+  uint64_t ms;  // Since the first frame
+  uint8_t channel;
+  uint32_t records[RECORDS_PER_FRAME];
+} AirFrame;
+
+// Position in the repeating capture
+typedef struct {
+  size_t next;
+  uint64_t base;  // Start of the current repeat
+} AirCursor;
+
+typedef struct {
+  std::vector<bool> seen;
+  std::vector<uint32_t> found_at;  // Time of each discovery, in order
+  unsigned long first_table_ms;
+  uint32_t first_table_found;
+} ScanRun;
+
+static std::vector<AirFrame> air;
+static uint32_t record_count = 0;
+static uint64_t air_period = 0;  // Capture length, the period it repeats with
+
+// ===== Host Clock =====
+static unsigned long clock_ms = 0;
+
+unsigned long millis() {
+  return clock_ms;
+}
+
+// ===== Capture =====
+static uint64_t macKey(const uint8_t* mac) {
+  uint64_t key = 0;
+  for (int i = 0; i < 6; i++) key = (key << 8) | mac[i];
+  return key;
+}
+
+static bool isUnicast(const uint8_t* mac) {
+  static const uint8_t zero[6] = { 0 };
+  return mac && !(mac[0] & 0x01) && memcmp(mac, zero, 6) != 0;
+}
+
+static uint32_t recordId(std::map<uint64_t, uint32_t>& ids, const uint8_t* mac) {
+  std::map<uint64_t, uint32_t>::iterator it = ids.find(macKey(mac));
+  if (it != ids.end()) return it->second;
+  ids[macKey(mac)] = record_count;
+  return record_count++;
+}
+
+// Reads the frames that name a record; false if the capture is unusable
+static bool loadAir(const char* path, bool stations) {
+  PcapReader reader;
+  if (!pcapOpen(&reader, path)) return false;
+
+  std::map<uint64_t, uint32_t> ids;
+  PcapFrame pf;
+  bool have_t0 = false;
+  uint64_t t0_ms = 0;
+  uint32_t no_channel = 0;
+
+  while (pcapNext(&reader, &pf, 0)) {
+    if (!have_t0) {
+      t0_ms = pf.ms;
+      have_t0 = true;
+    }
+    FrameView f;
+    if (!frameDecode(pf.frame, pf.len, 0, pf.channel, &f)) continue;
+    if (pf.channel < 1 || pf.channel > CHAN_COUNT) {
+      no_channel++;
+      continue;
+    }
+
+    AirFrame a = { pf.ms - t0_ms, pf.channel, { RECORD_NONE, RECORD_NONE } };
+    if (!stations) {
+      if (f.key == FRAME_KEY(0, 8) || f.key == FRAME_KEY(0, 5)) {  // Beacon, probe response
+        if (isUnicast(f.bssid)) a.records[0] = recordId(ids, f.bssid);
+      }
+    } else if (f.type == 0 || f.type == 2) {
+      const uint8_t* ends[RECORDS_PER_FRAME] = { f.ta, f.ra };
+      for (int i = 0; i < RECORDS_PER_FRAME; i++) {
+        if (isUnicast(ends[i]) && !(f.bssid && memcmp(ends[i], f.bssid, 6) == 0)) {
+          a.records[i] = recordId(ids, ends[i]);
+        }
+      }
+    }
+    if (a.records[0] != RECORD_NONE || a.records[1] != RECORD_NONE) air.push_back(a);
+  }
+  pcapClose(&reader);
+  if (reader.bad) return false;
+
+  if (no_channel) fprintf(stderr, "%u frames without a 2.4 GHz channel skipped\n", no_channel);
+  if (air.empty()) {
+    fprintf(stderr, "%s: no %s with a channel in the capture\n", path, stations ? "stations" : "APs");
+    return false;
+  }
+  air_period = air.back().ms + 1;
+  return true;
+}
+
+// ===== Simulation =====
+// Plays the air up to `until` with the radio on `tuned`, recording what it hears
+static void hearUntil(AirCursor& c, uint64_t until, int tuned, ScanRun& run) {
+  while (c.base + air[c.next].ms < until) {
+    const AirFrame& a = air[c.next];
+    if (a.channel == tuned) {
+      clock_ms = c.base + a.ms;
+      for (int i = 0; i < RECORDS_PER_FRAME; i++) {
+        uint32_t r = a.records[i];
+        if (r == RECORD_NONE || run.seen[r]) continue;
+        run.seen[r] = true;
+        run.found_at.push_back(clock_ms);
+        chanSchedDiscovered(a.channel);
+      }
+    }
+    if (++c.next == air.size()) {
+      c.next = 0;
+      c.base += air_period;
+    }
+  }
+}
+
+static void noteFirstTable(ScanRun& run, unsigned long now) {
+  if (run.first_table_ms) return;
+  run.first_table_ms = now;
+  run.first_table_found = run.found_at.size();
+}
+
+// Runs one scan over the repeating capture until everything was found and
+// a table drawn, or the limit ran out
+static void simulate(uint8_t mode, bool fast_start, unsigned long hop_ms, unsigned long limit_ms, ScanRun& run) {
+  run.seen.assign(record_count, false);
+  run.found_at.clear();
+  run.first_table_ms = 0;
+  run.first_table_found = 0;
+
+  clock_ms = 0;
+  int tuned = 1;
+  chanSchedReset(clock_ms, tuned);
+
+  // The driver scan listens to each channel in turn; sniffing starts after
+  AirCursor c = { 0, 0 };
+  unsigned long t = 0;
+  if (fast_start) {
+    for (int ch = 1; ch <= CHAN_COUNT; ch++) {
+      t += SEED_DWELL_MS;
+      hearUntil(c, t, ch, run);
+    }
+    noteFirstTable(run, t);
+  }
+
+  for (t += SCAN_LOOP_MS; t <= limit_ms && (run.found_at.size() < record_count || !run.first_table_ms);
+       t += SCAN_LOOP_MS) {
+    hearUntil(c, t, tuned, run);  // Frames on the air until this loop() pass
+
+    clock_ms = t;
+    bool sweep_done;
+    int ch = chanSchedTick(clock_ms, mode, hop_ms, &sweep_done);
+    if (ch) tuned = ch;
+    if (sweep_done) noteFirstTable(run, t);
+  }
+}
+
+static void printTime(const ScanRun& run, int pct) {
+  uint32_t k = (record_count * pct + 99) / 100;
+  if (k == 0 || k > run.found_at.size()) {
+    printf(" | t%d      -  ", pct);
+  } else {
+    printf(" | t%d %6.1f s", pct, run.found_at[k - 1] / 1000.0);
+  }
+}
+
+static void report(const char* name, uint8_t mode, bool fast_start, unsigned long hop_ms, unsigned long limit_ms) {
+  ScanRun run;
+  simulate(mode, fast_start, hop_ms, limit_ms, run);
+  printf("%-22s", name);
+  printTime(run, 50);
+  printTime(run, 90);
+  printTime(run, 95);
+  if (run.first_table_ms) {
+    printf(" | first table %5.1f s (%u/%u)", run.first_table_ms / 1000.0, run.first_table_found, record_count);
+  } else {
+    printf(" | first table     -");
+  }
+  if (run.found_at.size() == record_count) {
+    printf(" | all %6.1f s\n", run.found_at.back() / 1000.0);
+  } else {
+    printf(" | all      -   (%u/%u)\n", (unsigned)run.found_at.size(), record_count);
+  }
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: scan_replay <capture.pcapng> [-h hop-ms] [-l limit-s] [-s]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) usage();
+  const char* path = argv[1];
+  unsigned long hop_ms = 500;
+  unsigned long limit_ms = 600 * 1000UL;
+  bool stations = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (!strcmp(argv[i], "-s")) {
+      stations = true;
+      continue;
+    }
+    if (i + 1 >= argc) usage();
+    long v = strtol(argv[i + 1], NULL, 10);
+    if (v <= 0) usage();
+    if (!strcmp(argv[i], "-h")) hop_ms = v;
+    else if (!strcmp(argv[i], "-l")) limit_ms = v * 1000UL;
+    else usage();
+    i++;
+  }
+
+  if (!loadAir(path, stations)) return 1;
+  printf("%s: %u %s over %.1f s of capture\n", path, record_count, stations ? "stations" : "APs",
+         air_period / 1000.0);
+
+  char fixed[32];
+  snprintf(fixed, sizeof(fixed), "fixed (%lu ms)", hop_ms);
+  report(fixed, DWELL_FIXED, false, hop_ms, limit_ms);
+  report("adaptive", DWELL_ADAPTIVE, false, hop_ms, limit_ms);
+  if (!stations) {
+    report("fast start + fixed", DWELL_FIXED, true, hop_ms, limit_ms);
+    report("fast start + adaptive", DWELL_ADAPTIVE, true, hop_ms, limit_ms);
+  }
+  return 0;
+}
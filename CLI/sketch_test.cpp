@@ -0,0 +1,396 @@
+/*
+ * Host test for the probabilistic sketches in sketch.h.
+ *
+ * Build and run from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/sketch_test.cpp -o sketch_test
+ *     ./sketch_test
+ *
+ * Streams of synthetic MACs go through each sketch next to an exact count,
+ * and the sketch is held to the bound its comment in sketch.h promises.
+ * Keys come from a fixed-seed generator, so every run sees the same streams
+ * and the checks are repeatable. Prints one line per check and exits
+ * non-zero if any failed.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "sketch.h"
+
+// ===== Keys =====
+// xorshift64*: fixed seed, so a failure reproduces
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t nextRandom() {
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return rng_state * 0x2545F4914F6CDD1DULL;
+}
+
+// Locally administered MAC numbered n, run through the sketches' own hash
+static void macFor(uint32_t n, uint8_t* mac) {
+  mac[0] = 0x02;
+  mac[1] = 0x5A;
+  mac[2] = n >> 24;
+  mac[3] = n >> 16;
+  mac[4] = n >> 8;
+  mac[5] = n;
+}
+
+static uint64_t keyHash(uint32_t n) {
+  uint8_t mac[6];
+  macFor(n, mac);
+  return macHash64(mac);
+}
+
+// Zipf-like key numbers in [0, n): key k drawn with weight 1 / (k + 1)
+static uint32_t zipfKey(const double* cdf, uint32_t n) {
+  double u = (double)(nextRandom() >> 11) / (double)(1ULL << 53);
+  uint32_t lo = 0, hi = n - 1;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (cdf[mid] < u) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+static void zipfCdf(double* cdf, uint32_t n) {
+  double sum = 0;
+  for (uint32_t k = 0; k < n; k++) sum += 1.0 / (k + 1);
+  double acc = 0;
+  for (uint32_t k = 0; k < n; k++) {
+    acc += 1.0 / (k + 1) / sum;
+    cdf[k] = acc;
+  }
+  cdf[n - 1] = 1.0;
+}
+
+// ===== Checks =====
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  printf("%s  %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok) failures++;
+}
+
+// ===== HyperLogLog =====
+static void testHllSmallCounts() {
+  printf("-- HyperLogLog\n");
+  HyperLogLog<8> hll;
+  check(hll.empty() && hll.estimate() == 0, "empty sketch estimates 0");
+  // Linear counting: standard error of sqrt(m (e^t - t - 1)) keys at t = n / m
+  bool close = true;
+  const double m = HyperLogLog<8>::REGISTERS;
+  for (uint32_t n = 1; n <= 200; n++) {
+    hll.add(keyHash(n));
+    double t = n / m;
+    double bound = 3 * sqrt(m * (exp(t) - t - 1)) + 1;
+    if (fabs((double)hll.estimate() - n) > bound) close = false;
+  }
+  check(close, "linear counting stays within 3 sigma + 1 of the truth up to 200 keys (P = 8)");
+
+  uint32_t before = hll.estimate();
+  for (int round = 0; round < 100; round++) {
+    for (uint32_t n = 1; n <= 200; n++) hll.add(keyHash(n));
+  }
+  check(hll.estimate() == before, "repeating keys does not move the estimate");
+
+  hll.clear();
+  check(hll.empty(), "clear empties the sketch");
+}
+
+// Relative error over independent streams of n distinct keys, against
+// 1.04 / sqrt(2^P): the RMS within 1.5 sigma, no single stream past 4 sigma
+template <int P>
+static void testHllError(uint32_t n, int trials) {
+  double sum_sq = 0, worst = 0;
+  for (int t = 0; t < trials; t++) {
+    HyperLogLog<P> hll;
+    uint32_t base = (uint32_t)nextRandom();
+    for (uint32_t i = 0; i < n; i++) hll.add(keyHash(base + i));
+    double rel = ((double)hll.estimate() - n) / n;
+    sum_sq += rel * rel;
+    if (fabs(rel) > worst) worst = fabs(rel);
+  }
+  double rms = sqrt(sum_sq / trials) * 100;
+  double sigma = HyperLogLog<P>::errorPercent();
+  char what[128];
+  snprintf(what, sizeof(what), "P = %d, %u keys: RMS error %.2f%% within 1.5 x %.2f%%", P, n, rms, sigma);
+  check(rms <= 1.5 * sigma, what);
+  snprintf(what, sizeof(what), "P = %d, %u keys: worst of %d streams %.2f%% within 4 x %.2f%%", P, n, trials,
+           worst * 100, sigma);
+  check(worst * 100 <= 4 * sigma, what);
+}
+
+static void testHllMerge() {
+  HyperLogLog<10> a, b, both;
+  for (uint32_t i = 0; i < 3000; i++) {
+    a.add(keyHash(i));
+    both.add(keyHash(i));
+  }
+  for (uint32_t i = 2000; i < 6000; i++) {
+    b.add(keyHash(i));
+    both.add(keyHash(i));
+  }
+  HyperLogLog<10> merged = a;
+  merged.merge(b);
+  check(merged.estimate() == both.estimate(), "merge equals the sketch of the union");
+  double rel = fabs((double)merged.estimate() - 6000) / 6000 * 100;
+  check(rel <= 3 * HyperLogLog<10>::errorPercent(), "merged estimate of overlapping sets is within 3 sigma");
+  merged.merge(a);
+  check(merged.estimate() == both.estimate(), "merging a subset again changes nothing");
+}
+
+// ===== Bloom Filter =====
+// n entries, then 100000 keys that were never added
+template <int BITS, int K>
+static void testBloom(uint32_t n) {
+  printf("-- Bloom filter, %d bits, %d probes, %u entries\n", BITS, K, n);
+  BloomFilter<BITS, K> bloom;
+  uint8_t mac[6];
+  for (uint32_t i = 0; i < n; i++) {
+    macFor(i, mac);
+    bloom.add(mac);
+  }
+  bool all = true;
+  for (uint32_t i = 0; i < n; i++) {
+    macFor(i, mac);
+    if (!bloom.mayContain(mac)) all = false;
+  }
+  check(all, "no false negatives");
+  check(bloom.size() == n, "size counts the adds");
+
+  uint32_t fp = 0;
+  const uint32_t probes = 100000;
+  for (uint32_t i = 0; i < probes; i++) {
+    macFor(1000000 + i, mac);
+    if (bloom.mayContain(mac)) fp++;
+  }
+  double rate = (double)fp / probes;
+  double expected = pow(1 - exp(-(double)K * n / BITS), K);
+  char what[128];
+  snprintf(what, sizeof(what), "false positives %.3f%% within 1.5 x the predicted %.3f%%", rate * 100, expected * 100);
+  check(rate <= 1.5 * expected, what);
+
+  bloom.clear();
+  macFor(0, mac);
+  check(!bloom.mayContain(mac) && bloom.size() == 0, "clear forgets every entry");
+}
+
+// ===== Space-Saving =====
+#define SS_KEYS 1000
+
+static uint32_t keyNumber(const uint8_t* mac) {
+  return ((uint32_t)mac[2] << 24) | ((uint32_t)mac[3] << 16) | ((uint32_t)mac[4] << 8) | mac[5];
+}
+
+// Table invariants against exact per-key counts
+template <int K>
+static void checkSpaceSaving(const SpaceSaving<K, 6>& ss, const uint32_t* truth, const uint32_t* truth_bytes,
+                             uint32_t n_keys, uint32_t total, uint64_t total_bytes) {
+  bool sorted = true, bounded = true, bytes_low = true;
+  bool tracked[SS_KEYS] = {};
+  for (int i = 0; i < ss.size(); i++) {
+    const typename SpaceSaving<K, 6>::Entry& e = ss.at(i);
+    uint32_t k = keyNumber(e.key);
+    tracked[k] = true;
+    if (i > 0 && ss.at(i - 1).count < e.count) sorted = false;
+    if (e.count - e.error > truth[k] || truth[k] > e.count) bounded = false;
+    if (e.bytes > truth_bytes[k]) bytes_low = false;
+  }
+  bool heavy = true;
+  for (uint32_t k = 0; k < n_keys; k++) {
+    if (truth[k] > total / K && !tracked[k]) heavy = false;
+  }
+  check(sorted, "entries are sorted by count, largest first");
+  check(bounded, "count - error <= true frames <= count for every entry");
+  check(heavy, "every key with more than total / K frames is tracked");
+  check(bytes_low, "per-entry bytes are a lower bound");
+  check(ss.frames() == total && ss.bytes() == total_bytes, "frame and byte totals are exact");
+}
+
+template <int K>
+static void testSpaceSavingZipf(uint32_t n_keys, uint32_t frames) {
+  printf("-- Space-Saving, K = %d, %u frames over %u Zipf keys\n", K, frames, n_keys);
+  static double cdf[SS_KEYS];
+  static uint32_t truth[SS_KEYS], truth_bytes[SS_KEYS];
+  zipfCdf(cdf, n_keys);
+  memset(truth, 0, sizeof(truth));
+  memset(truth_bytes, 0, sizeof(truth_bytes));
+
+  SpaceSaving<K, 6> ss;
+  uint8_t mac[6];
+  uint64_t total_bytes = 0;
+  for (uint32_t f = 0; f < frames; f++) {
+    uint32_t k = zipfKey(cdf, n_keys);
+    uint32_t len = 24 + (uint32_t)(nextRandom() % 1500);
+    macFor(k, mac);
+    ss.offer(mac, macHash64(mac), len);
+    truth[k]++;
+    truth_bytes[k] += len;
+    total_bytes += len;
+  }
+  check(ss.size() == K, "table is full");
+  checkSpaceSaving<K>(ss, truth, truth_bytes, n_keys, frames, total_bytes);
+}
+
+// Every tracked key must still be found through the index: offering each
+// once more only counts it, so nothing is evicted and every count rises by 1
+template <int K>
+static bool indexFindsAll(SpaceSaving<K, 6>& ss, uint64_t (*hashOf)(uint32_t)) {
+  uint32_t keys[K], counts[K];
+  int n = ss.size();
+  for (int i = 0; i < n; i++) {
+    keys[i] = keyNumber(ss.at(i).key);
+    counts[i] = ss.at(i).count;
+  }
+  uint8_t mac[6];
+  for (int i = 0; i < n; i++) {
+    macFor(keys[i], mac);
+    ss.offer(mac, hashOf(keys[i]), 1);
+  }
+  if (ss.size() != n) return false;
+  for (int i = 0; i < n; i++) {
+    bool found = false;
+    for (int j = 0; j < n; j++) {
+      if (keyNumber(ss.at(j).key) == keys[i]) found = ss.at(j).count == counts[i] + 1;
+    }
+    if (!found) return false;
+  }
+  return true;
+}
+
+// Crafted hashes: every key's home is one of the last index slots, so chains
+// run long and wrap past the end while evictions unindex from their middle
+static uint64_t crowdedHash(uint32_t n) {
+  return 13 + n % 3;  // K = 4 has 16 index slots: homes 13, 14 and 15
+}
+
+static void testSpaceSavingIndex() {
+  printf("-- Space-Saving index\n");
+  SpaceSaving<16, 6> churn;
+  uint8_t mac[6];
+  for (uint32_t f = 0; f < 200000; f++) {
+    uint32_t k = (uint32_t)(nextRandom() % SS_KEYS);
+    macFor(k, mac);
+    churn.offer(mac, macHash64(mac), 100);
+  }
+  check(indexFindsAll<16>(churn, keyHash), "after 200k uniform frames every tracked key is still indexed");
+
+  SpaceSaving<4, 6> crowded;
+  bool ok = true;
+  for (uint32_t f = 0; f < 5000 && ok; f++) {
+    uint32_t k = (uint32_t)(nextRandom() % 12);
+    macFor(k, mac);
+    crowded.offer(mac, crowdedHash(k), 1);
+    if (f % 50 == 49) ok = indexFindsAll<4>(crowded, crowdedHash);
+  }
+  check(ok, "colliding, wrapping probe chains survive eviction (backward-shift unindex)");
+
+  crowded.clear();
+  check(crowded.size() == 0 && crowded.frames() == 0, "clear empties the table");
+  macFor(1, mac);
+  crowded.offer(mac, crowdedHash(1), 10);
+  check(crowded.size() == 1 && crowded.at(0).count == 1 && crowded.at(0).error == 0,
+        "a key offered after clear starts from zero");
+}
+
+// ===== Count-Min =====
+static void testCountMin() {
+  printf("-- Count-min sketch, 256 x 4\n");
+  const uint32_t n_keys = 2000, events = 20000;
+  static double cdf[n_keys];
+  static uint32_t truth[n_keys];
+  zipfCdf(cdf, n_keys);
+
+  CountMin<256, 4> cm;
+  for (uint32_t i = 0; i < events; i++) {
+    uint32_t k = zipfKey(cdf, n_keys);
+    cm.add(keyHash(k));
+    truth[k]++;
+  }
+  bool never_under = true;
+  uint32_t within = 0;
+  double bound = exp(1.0) * events / 256;
+  for (uint32_t k = 0; k < n_keys; k++) {
+    uint16_t est = cm.estimate(keyHash(k));
+    if (est < truth[k]) never_under = false;
+    if (est - truth[k] <= bound) within++;
+  }
+  check(never_under, "never undercounts");
+  char what[128];
+  snprintf(what, sizeof(what), "%.1f%% of keys within e * total / W of the truth (promised %.1f%%)",
+           within * 100.0 / n_keys, (1 - exp(-4.0)) * 100);
+  check(within >= (1 - exp(-4.0)) * n_keys, what);
+
+  CountMin<256, 4> alone;
+  bool exact = true;
+  for (uint32_t i = 1; i <= 1000; i++) {
+    if (alone.add(keyHash(7)) != i) exact = false;
+  }
+  check(exact && alone.estimate(keyHash(7)) == 1000, "a key with no collisions counts exactly");
+  for (uint32_t i = 0; i < 70000; i++) alone.add(keyHash(7));
+  check(alone.estimate(keyHash(7)) == UINT16_MAX && alone.add(keyHash(7)) == UINT16_MAX,
+        "cells saturate at 65535 instead of wrapping");
+  alone.clear();
+  check(alone.estimate(keyHash(7)) == 0, "clear zeroes every cell");
+}
+
+// Key added every `step` ms for `ms`; returns the rate the last add reported
+// and whether every rate after the first window stayed within `tolerance`
+static uint32_t steadyRate(SlidingCountMin<256, 4>& rate, uint64_t h, uint32_t* now, uint32_t ms, uint32_t step,
+                           uint32_t window, double tolerance, bool* steady) {
+  uint32_t expected = window / step;
+  uint32_t last = 0;
+  *steady = true;
+  for (uint32_t t = 0; t < ms; t += step, *now += step) {
+    last = rate.add(h, *now);
+    if (t >= window && fabs((double)last - expected) > tolerance * expected) *steady = false;
+  }
+  return last;
+}
+
+static void testSlidingCountMin() {
+  printf("-- Sliding-window count-min, 1000 ms window\n");
+  SlidingCountMin<256, 4> rate(1000);
+  uint32_t now = 5000;
+  rate.reset(now);
+  bool steady;
+  steadyRate(rate, keyHash(1), &now, 5000, 10, 1000, 0.02, &steady);
+  check(steady, "100 events/s reads as 100 +/- 2% once a window has passed");
+
+  now += 490;  // Into the next window: the full one before it overlaps by 51%
+  uint32_t r = rate.add(keyHash(1), now);
+  check(r >= 50 && r <= 54, "after a pause only the overlapping part of the old window counts (~52)");
+  now += 2500;  // Both windows stale
+  check(rate.add(keyHash(1), now) == 1, "after two idle windows the rate starts over at 1");
+
+  steadyRate(rate, keyHash(2), &now, 3000, 10, 1000, 0.02, &steady);
+  uint32_t other = rate.add(keyHash(3), now);
+  check(other <= 1 + (uint32_t)(exp(1.0) * 200 / 256) + 1, "a quiet key is not inflated past the count-min bound");
+
+  // millis() wraps after 49.7 days
+  now = 0xFFFFFFFFu - 2500;
+  rate.reset(now);
+  steadyRate(rate, keyHash(4), &now, 5000, 10, 1000, 0.02, &steady);
+  check(steady, "rate stays steady across the millis() wrap");
+}
+
+int main() {
+  testHllSmallCounts();
+  testHllError<8>(1000, 400);
+  testHllError<8>(100000, 200);
+  testHllError<10>(10000, 200);
+  testHllError<12>(50000, 100);
+  testHllMerge();
+  testBloom<1024, 5>(100);   // printed_bssids in scan.cpp, one entry per AP
+  testBloom<8192, 4>(1000);  // WIDS seen sets
+  testSpaceSavingZipf<16>(SS_KEYS, 50000);  // TOP_TALKERS_K
+  testSpaceSavingZipf<64>(SS_KEYS, 50000);
+  testSpaceSavingIndex();
+  testCountMin();
+  testSlidingCountMin();
+  printf("%d failure(s)\n", failures);
+  return failures ? 1 : 0;
+}
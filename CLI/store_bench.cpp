@@ -0,0 +1,309 @@
+/*
+ * Measures how long the scan snapshot takes to load for a given number of
+ * records, using the sketch's snapshot codec on the host.
+ *
+ * Build from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/store_bench.cpp -o store_bench
+ *
+ * Usage:
+ *     ./store_bench [records ...]      (default: 1000 10000)
+ *
+ * Builds a snapshot of APs, stations and SSIDs in the 1:3:1 mix of the
+ * device tables (MAX_APS, MAX_CLIENTS, SSID_TABLE_CAPACITY), with the field
+ * layout scan_store.cpp writes, then times the two load passes: the CRC and
+ * framing check, and the record walk decoding every field into flat arrays.
+ * The device adds the SD read and the table inserts (`scan store` reports the
+ * whole load); it also refuses files over SCAN_STORE_MAX_BYTES, which is
+ * flagged, so the larger sizes show where the format would go rather than
+ * what a device holds today.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "scan_store_codec.h"
+
+#define TARGET_NS 500000000ULL  // Time spent per size
+#define MAX_RECORDS 100000      // Keeps each count in the end record's u16
+#define MAX_PROBED 10           // MAX_PROBED_APS (scan.h)
+
+// ===== Decoded Records =====
+typedef struct {
+  uint8_t bssid[6];
+  uint8_t flags, channel, primary, secondary, encryption, wps_version;
+  int8_t rssi[3];
+  uint8_t beacon_interval;
+  uint16_t capability, data_rate;
+  int16_t clients;
+  uint8_t country[3];
+  uint32_t packets;
+  uint8_t original_ssid_len, ssid_len;
+  char ssid[33];
+} StoredAP;
+
+typedef struct {
+  uint8_t mac[6];
+  uint8_t flags, channel;
+  int8_t rssi[3];
+  uint16_t probes;
+  uint32_t packets;
+  uint16_t data_rate;
+  uint8_t target[6];
+  uint8_t probed_count;
+  uint8_t probed[MAX_PROBED][6];
+  uint8_t ssid_len;
+  char ssid[33];
+} StoredStation;
+
+typedef struct {
+  uint8_t flags, channel;
+  int8_t rssi;
+  uint16_t probes;
+  uint8_t bssid[6];
+  uint8_t ssid_len;
+  char ssid[33];
+} StoredSSID;
+
+static std::vector<StoredAP> aps;
+static std::vector<StoredStation> stations;
+static std::vector<StoredSSID> ssids;
+
+// ===== Snapshot Builder =====
+static void randomBytes(uint8_t* p, size_t n) {
+  for (size_t i = 0; i < n; i++) p[i] = rand();
+}
+
+static uint8_t randomSSID(char* out) {
+  uint8_t len = 4 + rand() % 16;
+  for (int i = 0; i < len; i++) out[i] = 'a' + rand() % 26;
+  return len;
+}
+
+static void append(std::vector<uint8_t>& file, const uint8_t* p, size_t n) {
+  file.insert(file.end(), p, p + n);
+}
+
+// Same field order as encodeAP(), encodeStation() and encodeSSID()
+static void buildRecord(RecordOut& r, int i) {
+  uint8_t mac[6], other[6];
+  char ssid[32];
+  uint8_t ssid_len = randomSSID(ssid);
+  randomBytes(mac, 6);
+
+  switch (i % 5) {
+    case 0:
+      beginRecord(r, STORE_TAG_AP);
+      putBytes(r, mac, 6);
+      put8(r, 0x11);
+      put8(r, 1 + rand() % 13);
+      put8(r, 6);
+      put8(r, 0);
+      put8(r, 3);
+      put8(r, 0);
+      put8(r, -60);
+      put8(r, -75);
+      put8(r, -50);
+      put8(r, 100);
+      put16(r, 0x0431);
+      put16(r, 1440);
+      put16(r, rand() % 8);
+      putBytes(r, "US ", 3);
+      put32(r, rand());
+      put8(r, ssid_len);
+      putString(r, ssid, ssid_len);
+      break;
+    case 4:
+      beginRecord(r, STORE_TAG_SSID);
+      put8(r, 1);
+      put8(r, 1 + rand() % 13);
+      put8(r, -70);
+      put16(r, rand() % 500);
+      randomBytes(other, 6);
+      putBytes(r, other, 6);
+      put64(r, 0);
+      putString(r, ssid, ssid_len);
+      break;
+    default: {
+      beginRecord(r, STORE_TAG_STATION);
+      putBytes(r, mac, 6);
+      put8(r, 1);
+      put8(r, 1 + rand() % 13);
+      put8(r, -65);
+      put8(r, -80);
+      put8(r, -55);
+      put16(r, rand() % 200);
+      put32(r, rand());
+      put16(r, 540);
+      randomBytes(other, 6);
+      putBytes(r, other, 6);
+      uint8_t probed = rand() % (MAX_PROBED + 1);
+      put8(r, probed);
+      for (int k = 0; k < probed; k++) {
+        randomBytes(other, 6);
+        putBytes(r, other, 6);
+      }
+      putString(r, ssid, ssid_len);
+      break;
+    }
+  }
+  endRecord(r);
+}
+
+static void buildSnapshot(std::vector<uint8_t>& file, int records) {
+  uint8_t header[STORE_HEADER_LEN] = {
+    (uint8_t)SCAN_STORE_MAGIC, (uint8_t)(SCAN_STORE_MAGIC >> 8), (uint8_t)(SCAN_STORE_MAGIC >> 16),
+    (uint8_t)(SCAN_STORE_MAGIC >> 24), (uint8_t)SCAN_STORE_VERSION, (uint8_t)(SCAN_STORE_VERSION >> 8), 0, 0
+  };
+  file.clear();
+  append(file, header, sizeof(header));
+
+  uint16_t counts[3] = { 0, 0, 0 };
+  RecordOut r;
+  for (int i = 0; i < records; i++) {
+    buildRecord(r, i);
+    append(file, r.b, r.n);
+    counts[r.b[0] - STORE_TAG_AP]++;
+  }
+
+  beginRecord(r, STORE_TAG_END);
+  for (int i = 0; i < 3; i++) put16(r, counts[i]);
+  endRecord(r);
+  r.b[1] += 4;  // The CRC is part of the end record but not of its own input
+  append(file, r.b, r.n);
+  uint32_t crc = crc32Le(0, file.data(), file.size());
+  uint8_t tail[4] = { (uint8_t)crc, (uint8_t)(crc >> 8), (uint8_t)(crc >> 16), (uint8_t)(crc >> 24) };
+  append(file, tail, sizeof(tail));
+}
+
+// ===== Load =====
+// Same field order as restoreAP(), restoreStation() and restoreSSID()
+static void restoreAP(RecordIn& r) {
+  StoredAP& a = aps[aps.size() - 1];
+  getBytes(r, a.bssid, 6);
+  a.flags = get8(r);
+  a.channel = get8(r);
+  a.primary = get8(r);
+  a.secondary = get8(r);
+  a.encryption = get8(r);
+  a.wps_version = get8(r);
+  getBytes(r, a.rssi, 3);
+  a.beacon_interval = get8(r);
+  a.capability = get16(r);
+  a.data_rate = get16(r);
+  a.clients = (int16_t)get16(r);
+  getBytes(r, a.country, 3);
+  a.packets = get32(r);
+  a.original_ssid_len = get8(r);
+  a.ssid_len = getString(r, a.ssid);
+}
+
+static void restoreStation(RecordIn& r) {
+  StoredStation& s = stations[stations.size() - 1];
+  getBytes(r, s.mac, 6);
+  s.flags = get8(r);
+  s.channel = get8(r);
+  getBytes(r, s.rssi, 3);
+  s.probes = get16(r);
+  s.packets = get32(r);
+  s.data_rate = get16(r);
+  getBytes(r, s.target, 6);
+  s.probed_count = get8(r);
+  if (s.probed_count > MAX_PROBED) s.probed_count = MAX_PROBED;
+  for (int i = 0; i < s.probed_count; i++) getBytes(r, s.probed[i], 6);
+  s.ssid_len = getString(r, s.ssid);
+}
+
+static void restoreSSID(RecordIn& r) {
+  StoredSSID& s = ssids[ssids.size() - 1];
+  s.flags = get8(r);
+  s.channel = get8(r);
+  s.rssi = get8(r);
+  s.probes = get16(r);
+  getBytes(r, s.bssid, 6);
+  get64(r);
+  s.ssid_len = getString(r, s.ssid);
+}
+
+static int walk(const std::vector<uint8_t>& file) {
+  aps.clear();
+  stations.clear();
+  ssids.clear();
+  size_t o = STORE_HEADER_LEN;
+  uint8_t tag;
+  RecordIn r;
+  int restored = 0;
+  while (snapshotNextRecord(file.data(), file.size(), &o, &tag, &r)) {
+    switch (tag) {
+      case STORE_TAG_AP:
+        aps.resize(aps.size() + 1);
+        restoreAP(r);
+        break;
+      case STORE_TAG_STATION:
+        stations.resize(stations.size() + 1);
+        restoreStation(r);
+        break;
+      case STORE_TAG_SSID:
+        ssids.resize(ssids.size() + 1);
+        restoreSSID(r);
+        break;
+      default: continue;
+    }
+    restored++;
+  }
+  return restored;
+}
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+static void bench(int records) {
+  std::vector<uint8_t> file;
+  buildSnapshot(file, records);
+  aps.reserve(records);
+  stations.reserve(records);
+  ssids.reserve(records);
+
+  uint64_t check_ns = 0, walk_ns = 0;
+  int runs = 0, restored = 0;
+  while (check_ns + walk_ns < TARGET_NS || runs < 3) {
+    uint64_t t0 = nowNs();
+    const char* error = snapshotError(file.data(), file.size());
+    uint64_t t1 = nowNs();
+    restored = walk(file);
+    uint64_t t2 = nowNs();
+    if (error || restored != records) {
+      fprintf(stderr, "%d records: %s, %d restored\n", records, error ? error : "load incomplete", restored);
+      exit(1);
+    }
+    check_ns += t1 - t0;
+    walk_ns += t2 - t1;
+    runs++;
+  }
+
+  double check_us = check_ns / 1000.0 / runs;
+  double walk_us = walk_ns / 1000.0 / runs;
+  printf("%6d records | %7lu bytes | check %8.1f us | walk %8.1f us | total %8.1f us | %5.3f us/record%s\n",
+         records, (unsigned long)file.size(), check_us, walk_us, check_us + walk_us, (check_us + walk_us) / records,
+         file.size() > SCAN_STORE_MAX_BYTES ? " | over the device limit" : "");
+}
+
+int main(int argc, char** argv) {
+  srand(1);
+  if (argc < 2) {
+    bench(1000);
+    bench(10000);
+    return 0;
+  }
+  for (int i = 1; i < argc; i++) {
+    int records = atoi(argv[i]);
+    if (records <= 0 || records > MAX_RECORDS) {
+      fprintf(stderr, "Usage: store_bench [records ...]\n");
+      return 2;
+    }
+    bench(records);
+  }
+  return 0;
+}
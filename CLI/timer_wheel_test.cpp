@@ -0,0 +1,179 @@
+/*
+ * Host test for the scan timer wheel, driven by a fake clock.
+ *
+ * Build and run from the repository root (no Arduino core needed):
+ *     g++ -std=c++11 -O2 -I Antifi CLI/timer_wheel_test.cpp Antifi/timer_wheel.cpp -o timer_wheel_test
+ *     ./timer_wheel_test
+ *
+ * Without ARDUINO defined the wheel is built with 64 slots per record type
+ * and calls the handlers defined below instead of the scan tables'. Each
+ * handler keeps a "last seen" time per record the way the real ones do, so
+ * re-arming, expiry and cancellation are exercised as on the device. Prints
+ * one line per check and exits non-zero if any failed.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "timer_wheel.h"
+
+#define SLOTS 64
+
+// ===== Fake Records =====
+// A record is live while now < last_seen + ttl; the handler re-arms it for
+// that time and otherwise counts an expiry, like the scan record handlers.
+typedef struct {
+  bool live;
+  unsigned long last_seen;
+  unsigned long ttl;
+  int expired;            // Times the handler dropped it
+  unsigned long expired_at;
+  int checks;             // Times the handler ran for it
+} FakeRecord;
+
+static FakeRecord records[TIMER_TYPES][SLOTS];
+
+static bool expire(TimerType type, uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  FakeRecord& r = records[type][id];
+  r.checks++;
+  if (!r.live) return false;
+  unsigned long deadline = r.last_seen + r.ttl;
+  if ((long)(deadline - now) > 0) {
+    *rearm_at = deadline;
+    return true;
+  }
+  r.live = false;
+  r.expired++;
+  r.expired_at = now;
+  return false;
+}
+
+bool apTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  return expire(TIMER_AP, id, now, rearm_at);
+}
+bool clientTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  return expire(TIMER_CLIENT, id, now, rearm_at);
+}
+bool assocTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  return expire(TIMER_ASSOC, id, now, rearm_at);
+}
+bool ssidTimerExpired(uint16_t id, unsigned long now, unsigned long* rearm_at) {
+  return expire(TIMER_SSID, id, now, rearm_at);
+}
+
+// ===== Fake Clock =====
+static unsigned long clock_ms = 0;
+
+static void reset(unsigned long start) {
+  memset(records, 0, sizeof(records));
+  clock_ms = start;
+  timerWheelReset(clock_ms);
+}
+
+static void add(TimerType type, uint16_t id, unsigned long ttl) {
+  FakeRecord& r = records[type][id];
+  r.live = true;
+  r.last_seen = clock_ms;
+  r.ttl = ttl;
+  timerArm(type, id, clock_ms + ttl);
+}
+
+// Moves the clock in steps the way frames or loop() would, advancing each time
+static void run(unsigned long ms, unsigned long step = 50) {
+  unsigned long end = clock_ms + ms;
+  while (clock_ms < end) {
+    clock_ms += step;
+    if (clock_ms > end) clock_ms = end;
+    timerAdvance(clock_ms);
+  }
+}
+
+// ===== Checks =====
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  printf("%s  %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok) failures++;
+}
+
+static void testExpiry() {
+  reset(1000);
+  add(TIMER_AP, 3, 5000);
+  run(4900);
+  check(records[TIMER_AP][3].expired == 0, "record is kept before its deadline");
+  run(400);
+  check(records[TIMER_AP][3].expired == 1, "record expires within a tick of its deadline");
+  check(records[TIMER_AP][3].expired_at >= 6000 && records[TIMER_AP][3].expired_at <= 6000 + TIMER_TICK_MS,
+        "expiry time lies in [deadline, deadline + tick]");
+  check(!timerArmed(TIMER_AP, 3) && timerPending() == 0, "expired record is unarmed");
+}
+
+static void testRefresh() {
+  reset(0);
+  add(TIMER_CLIENT, 7, 2000);
+  for (int i = 0; i < 200; i++) {
+    run(50);
+    records[TIMER_CLIENT][7].last_seen = clock_ms;  // Refresh never touches the wheel
+  }
+  check(records[TIMER_CLIENT][7].expired == 0, "refreshed record survives past its first deadline");
+  check(records[TIMER_CLIENT][7].checks <= 10000 / 2000 + 1, "200 refreshes cost one check per ttl");
+  run(2500);
+  check(records[TIMER_CLIENT][7].expired == 1, "record expires once refreshes stop");
+}
+
+static void testCancelAndMove() {
+  reset(0);
+  add(TIMER_SSID, 1, 1000);
+  add(TIMER_SSID, 2, 1000);
+  timerCancel(TIMER_SSID, 1);
+  timerMove(TIMER_SSID, 2, 5);
+  records[TIMER_SSID][5] = records[TIMER_SSID][2];
+  records[TIMER_SSID][2].live = false;
+  run(2000);
+  check(records[TIMER_SSID][1].checks == 0, "cancelled timer never fires");
+  check(records[TIMER_SSID][2].checks == 0, "moved-from slot never fires");
+  check(records[TIMER_SSID][5].expired == 1, "moved-to slot fires with the original deadline");
+}
+
+static void testLevels() {
+  // 16 s, 17 min and 18 h horizons at 250 ms ticks and 64 slots per level
+  reset(0);
+  add(TIMER_AP, 0, 10 * 1000UL);
+  add(TIMER_AP, 1, 5 * 60 * 1000UL);
+  add(TIMER_AP, 2, 3 * 3600 * 1000UL);
+  add(TIMER_AP, 3, 30 * 3600 * 1000UL);  // Beyond the wheel: parked at the horizon
+  run(4 * 3600 * 1000UL, 1000);
+  check(records[TIMER_AP][0].expired == 1 && records[TIMER_AP][0].expired_at <= 10 * 1000UL + 1000,
+        "level 0 timer fires on time");
+  check(records[TIMER_AP][1].expired == 1 && records[TIMER_AP][1].expired_at <= 5 * 60 * 1000UL + 1000,
+        "level 1 timer fires on time after cascading");
+  check(records[TIMER_AP][2].expired == 1 && records[TIMER_AP][2].expired_at <= 3 * 3600 * 1000UL + 1000,
+        "level 2 timer fires on time after cascading");
+  check(records[TIMER_AP][3].expired == 0 && timerArmed(TIMER_AP, 3), "timer past the horizon is still pending");
+  run(27 * 3600 * 1000UL, 1000);
+  check(records[TIMER_AP][3].expired == 1 && records[TIMER_AP][3].expired_at <= 30 * 3600 * 1000UL + 1000,
+        "timer past the horizon fires after re-filing");
+}
+
+static void testIdleAndBudget() {
+  // A quiet channel: no frames for a long time, then one loop() advance
+  reset(0);
+  for (int i = 0; i < 40; i++) add(TIMER_CLIENT, i, 1000 + i);
+  clock_ms = 30 * 3600 * 1000UL;
+  int ran = timerAdvance(clock_ms);
+  check(ran == TIMER_BUDGET, "one advance runs at most the handler budget");
+  int total = ran;
+  while ((ran = timerAdvance(clock_ms)) > 0) total += ran;
+  int expired = 0;
+  for (int i = 0; i < 40; i++) expired += records[TIMER_CLIENT][i].expired;
+  check(total == 40 && expired == 40, "later advances at the same time drain the rest");
+  check(timerPending() == 0, "nothing left armed after an idle catch-up");
+}
+
+int main() {
+  testExpiry();
+  testRefresh();
+  testCancelAndMove();
+  testLevels();
+  testIdleAndBudget();
+  printf("%d failure(s)\n", failures);
+  return failures ? 1 : 0;
+}